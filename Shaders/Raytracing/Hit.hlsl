@@ -1,10 +1,22 @@
 #include "Common.hlsl"
 #include "../Utils/Sampling.hlsl"
+#include "../Utils/Lights.hlsl"
+
+// Random numbers of the bounces, like SamplerType of the CPU path tracer.
+// SAMPLER_SOBOL (default): sobolSeed with Cranley-Patterson rotation and
+// hashed light samples. SAMPLER_OWEN: Owen scrambled Sobol with its own
+// dimensions for every decision. SAMPLER_BLUE_NOISE: the same dimensions
+// with the blue noise keys of gBlueNoiseKeys.
+#define SAMPLER_SOBOL 0
+#define SAMPLER_OWEN 1
+#define SAMPLER_BLUE_NOISE 2
+#define SAMPLER SAMPLER_SOBOL
 
 // #DXR Extra: Per-Instance Data
 cbuffer GlobalParams : register(b0)
 {
     uint frameCount;
+    uint lightCount;
 }
 
 // #DXR Extra - Another ray type
@@ -20,6 +32,12 @@ StructuredBuffer<int> indices: register(t1);
 // Raytracing acceleration structure, accessed as a SRV
 RaytracingAccelerationStructure SceneBVH : register(t2);
 
+// Explicit lights, see Lights.hlsl. Area lights are not in the TLAS.
+StructuredBuffer<Light> gLights : register(t3);
+
+// Ranking and scrambling keys of the blue noise sampler, CPU::BlueNoiseKeys
+StructuredBuffer<uint> gBlueNoiseKeys : register(t4);
+
 cbuffer DisneyMaterialParams : register(b1)
 {
     float4 baseColor;
@@ -82,6 +100,39 @@ float3 mon2lin(float3 x)
     return float3(pow(x[0], 2.2), pow(x[1], 2.2), pow(x[2], 2.2));
 }
 
+// Pdf of Disney_BRDF_Sample returning L
+float Disney_BRDF_Pdf(float3 L, float3 V, float3 N)
+{
+    float alpha_GTR1 = lerp(0.1, 0.001, clearcoatGloss);
+    float alpha_GTR2 = max(0.001, roughness * roughness);
+    
+    float r_diffuse = (1.0 - metallic);
+    float r_specular = 1.;
+    float r_clearcoat = 0.25 * clearcoat;
+    float r_sum = r_diffuse + r_specular + r_clearcoat;
+
+    float p_diffuse = r_diffuse / r_sum;
+    float p_specular = r_specular / r_sum;
+    float p_clearcoat = r_clearcoat / r_sum;
+    
+    float NdotL = dot(N, L);
+    float NdotV = dot(N, V);
+    float3 H = normalize(L + V);
+    float NdotH = dot(N, H);
+    float LdotH = dot(L, H);
+    
+    float Ds = GTR2(NdotH, alpha_GTR2);
+    float Dr = GTR1(NdotH, alpha_GTR1);
+    
+    float pdf_diffuse = NdotL / PI;
+    float pdf_specular = (Ds * NdotH) / (4.0 * LdotH);
+    float pdf_clearcoat = (Dr * NdotH) / (4.0 * LdotH);
+    
+    float pdf = p_diffuse * pdf_diffuse + p_specular * pdf_specular + p_clearcoat * pdf_clearcoat;
+    
+    return max(1e-10, pdf);
+}
+
 // seed for sample
 // seed1 for choose diffuse or specular or clearcoat
 float3 Disney_BRDF_Sample(float2 seed, float seed1, float3 V, float3 N, float3 T, float3 B, out float pdf)
@@ -96,7 +147,6 @@ float3 Disney_BRDF_Sample(float2 seed, float seed1, float3 V, float3 N, float3 T
 
     float p_diffuse = r_diffuse / r_sum;
     float p_specular = r_specular / r_sum;
-    float p_clearcoat = r_clearcoat / r_sum;
     
     float3x3 TBN = transpose(float3x3(T, B, N));
     
@@ -115,22 +165,7 @@ float3 Disney_BRDF_Sample(float2 seed, float seed1, float3 V, float3 N, float3 T
         L = GTR1Sample(TBN, seed, alpha_GTR1, V);
     }
     
-    float NdotL = dot(N, L);
-    float NdotV = dot(N, V);
-    float3 H = normalize(L + V);
-    float NdotH = dot(N, H);
-    float LdotH = dot(L, H);
-    
-    float Ds = GTR2(NdotH, alpha_GTR2);
-    float Dr = GTR1(NdotH, alpha_GTR1);
-    
-    float pdf_diffuse = NdotL / PI;
-    float pdf_specular = (Ds * NdotH) / (4.0 * LdotH);
-    float pdf_clearcoat = (Dr * NdotH) / (4.0 * LdotH);
-    
-    pdf = p_diffuse * pdf_diffuse + p_specular * pdf_specular + p_clearcoat * pdf_clearcoat;
-    
-    pdf = max(1e-10, pdf);
+    pdf = Disney_BRDF_Pdf(L, V, N);
     
     return L;
 }
@@ -190,6 +225,107 @@ float3 Disney_BRDF(float3 L, float3 V, float3 N)
     return F_diffuse * (1.0 - metallic) + F_specular + F_clearcoat * 0.25 * clearcoat;
 }
 
+// First light whose cdf is above u. Same pmf as LightList::Select, which
+// uses an alias table on the CPU
+uint SelectLight(float u)
+{
+    uint lo = 0;
+    uint hi = lightCount - 1;
+    while (lo < hi)
+    {
+        uint mid = (lo + hi) / 2;
+        if (u < gLights[mid].cdf)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+bool IsOccluded(float3 origin, float3 direction, float tMax)
+{
+    RayDesc ray;
+    ray.Origin = origin;
+    ray.Direction = direction;
+    ray.TMin = 0.01;
+    ray.TMax = tMax;
+
+    ShadowHitInfo shadowPayload;
+    shadowPayload.isHit = false;
+
+    // Shadow hit group and ShadowMiss, as in PlaneClosestHit
+    TraceRay(SceneBVH, RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH, 0xFF, 1, 0, 1, ray, shadowPayload);
+    return shadowPayload.isHit;
+}
+
+// Decision offset of bounce depth with SAMPLER_OWEN or SAMPLER_BLUE_NOISE,
+// PathTracer::SequenceSample
+float SequenceSample(uint2 launchIndex, uint depth, uint offset)
+{
+    uint dimension = depth * kDimensionsPerBounce + offset;
+    uint scramble = pixelSeed(launchIndex.x, launchIndex.y);
+#if SAMPLER == SAMPLER_BLUE_NOISE
+    uint2 pixel = launchIndex % kBlueNoiseTileSize;
+    uint word = gBlueNoiseKeys[(pixel.y * kBlueNoiseTileSize + pixel.x) * kBlueNoiseWordsPerPixel + offset / 2];
+    return blueNoiseSobol(frameCount, dimension, (word >> (16 * (offset & 1))) & 0xffff, scramble);
+#else
+    return sobolOwen(frameCount, dimension, scramble);
+#endif
+}
+
+// Next event estimation: one light sample, weighted against Disney_BRDF_Sample
+// with the power heuristic. Same random numbers as PathTracer::LightSeed.
+float3 SampleDirectLight(float3 position, float3 N, float3 V, uint2 launchIndex, uint depth)
+{
+#if SAMPLER != SAMPLER_SOBOL
+    float uSelect = SequenceSample(launchIndex, depth, 3);
+    float2 u = float2(SequenceSample(launchIndex, depth, 4), SequenceSample(launchIndex, depth, 5));
+#else
+    uint dimension = 1024 + 3 * depth;
+    float uSelect = hashRandom(launchIndex.x, launchIndex.y, frameCount, dimension);
+    float2 u = float2(hashRandom(launchIndex.x, launchIndex.y, frameCount, dimension + 1),
+                      hashRandom(launchIndex.x, launchIndex.y, frameCount, dimension + 2));
+#endif
+
+    Light light = gLights[SelectLight(uSelect)];
+    float3 L;
+    float distance;
+    float pdf;
+    float3 radiance = SampleLight(light, position, u, L, distance, pdf);
+    pdf *= light.pmf;
+
+    float cosI = dot(N, L);
+    if (pdf <= 0 || cosI <= 0)
+        return float3(0, 0, 0);
+
+    float3 brdf = Disney_BRDF(L, V, N);
+    if (all(brdf == 0) || IsOccluded(position, L, distance * 0.999))
+        return float3(0, 0, 0);
+
+    float weight = light.type == LIGHT_POINT ? 1 : PowerHeuristic(pdf, Disney_BRDF_Pdf(L, V, N));
+    return radiance * brdf * (cosI * weight / pdf);
+}
+
+// The area lights are not in the TLAS: find the closest one along the BRDF
+// sampled ray, tMax is shortened to it. Returns its MIS weighted emission.
+float3 IntersectLights(float3 origin, float3 direction, float bsdfPdf, inout float tMax)
+{
+    float3 emission = float3(0, 0, 0);
+    for (uint i = 0; i < lightCount; ++i)
+    {
+        Light light = gLights[i];
+        float t;
+        if (!IntersectLight(light, origin, direction, tMax, t))
+            continue;
+
+        tMax = t;
+        emission = float3(0, 0, 0);
+        if (dot(direction, LightNormal(light)) < 0)
+            emission = light.emission * PowerHeuristic(bsdfPdf, LightPdf(light, direction, t) * light.pmf);
+    }
+    return emission;
+}
+
 [shader("closesthit")] 
 export void ClosestHit(inout HitInfo payload, Attributes attrib)
 {
@@ -247,8 +383,12 @@ export void ClosestHit(inout HitInfo payload, Attributes attrib)
         }
         else
         {
+#if SAMPLER != SAMPLER_SOBOL
+            seed = float2(SequenceSample(launchIndex, payload.depth, 0), SequenceSample(launchIndex, payload.depth, 1));
+#else
             seed = sobolSeed(frameCount, payload.depth);
             seed = CranleyPattersonRotation(seed, launchIndex);
+#endif
         }
         
         float3 bounceDir;
@@ -274,7 +414,11 @@ export void ClosestHit(inout HitInfo payload, Attributes attrib)
         {
             float3 wo = normalize(-WorldRayDirection());
                         
+#if SAMPLER != SAMPLER_SOBOL
+            float seed1 = SequenceSample(launchIndex, payload.depth, 2);
+#else
             float seed1 = rand_2to1(seed);
+#endif
             // seed1 = 0.1;
             bounceDir = Disney_BRDF_Sample(seed, seed1, wo, hitNormal, hitTangent, hitBitangent, pdf);            
             
@@ -291,6 +435,15 @@ export void ClosestHit(inout HitInfo payload, Attributes attrib)
         ray.TMin = 0.01;
         ray.TMax = 1000;
         
+        // Explicit lights: sample one directly and check whether the bounce
+        // reaches one before the scene
+        float3 lightEmission = float3(0, 0, 0);
+        if (lightCount > 0)
+        {
+            color += SampleDirectLight(ray.Origin, hitNormal, normalize(-WorldRayDirection()), launchIndex, payload.depth);
+            lightEmission = IntersectLights(ray.Origin, bounceDir, pdf, ray.TMax);
+        }
+        
         HitInfo bouncePayload;
         bouncePayload.depth = payload.depth + 1;
             
@@ -304,7 +457,13 @@ export void ClosestHit(inout HitInfo payload, Attributes attrib)
         ray,
         bouncePayload);
                     
-        color += bouncePayload.color.xyz * brdf * cosI / pdf;
+        // A light in front of everything else replaces the sky the
+        // shortened ray found
+        float3 bounceColor = bouncePayload.color.xyz;
+        if (ray.TMax < 1000 && bouncePayload.depth == 999)
+            bounceColor = lightEmission;
+        
+        color += bounceColor * brdf * cosI / pdf;
         
         
         payload.color = float4(color, 1);
@@ -6,6 +6,10 @@
 #define NUM_SAMPLES 2
 #define NUM_RINGS 4 // Poisson disk'else ring count
 #define SSP_MAX 1e10
+// Adaptive sampling: a pixel stops tracing once the standard error of its mean
+// luminance is below ADAPTIVE_THRESHOLD times the mean, 0 disables it
+#define ADAPTIVE_THRESHOLD 0.0
+#define ADAPTIVE_MIN_SAMPLES 16
 
 // Raytracing output texture, accessed as a UAV
 RWTexture2D< float4 > gOutput : register(u0);
@@ -13,7 +17,11 @@ RWTexture2D< float4 > gOutput : register(u0);
 // Raytracing acceleration structure, accessed as a SRV
 RaytracingAccelerationStructure SceneBVH : register(t0);
 
-Texture2D frameTexture : register(t1);
+// Progressive accumulation: rgb = radiance sum, w = sample count
+RWTexture2D< float4 > gAccumulation : register(u1);
+
+// Running mean and M2 (Welford) of the sample luminance
+RWTexture2D< float2 > gVariance : register(u2);
 
 // #DXR Extra: Perspective Camera
 cbuffer CameraParams : register(b0)
@@ -47,6 +55,19 @@ void poissonDiskSamples(const in float2 randomSeed, inout float2 poissonDisk[])
     }
 }
 
+float Luminance(float3 c)
+{
+    return dot(c, float3(0.2126, 0.7152, 0.0722));
+}
+
+bool IsConverged(float4 accumulation, float2 moments)
+{
+    if (ADAPTIVE_THRESHOLD <= 0 || accumulation.w < max(ADAPTIVE_MIN_SAMPLES, 2))
+        return false;
+    float variance = moments.y / (accumulation.w - 1.f);
+    return sqrt(variance / accumulation.w) < ADAPTIVE_THRESHOLD * max(moments.x, 1e-3);
+}
+
 [shader("raygeneration")] 
 export void RayGen() {
     // Initialize the ray payload
@@ -59,6 +80,17 @@ export void RayGen() {
     float2 dims = float2(DispatchRaysDimensions().xy); // resolution: 1920x1080
     float aspectRatio = dims.x / dims.y;
     float2 uv = (launchIndex.xy + 0.5f) / dims.xy;
+
+    // frameCount is reset to 0 whenever the camera or a material changes
+    float4 accumulation = frameCount == 0 ? float4(0, 0, 0, 0) : gAccumulation[launchIndex];
+    float2 moments = frameCount == 0 ? float2(0, 0) : gVariance[launchIndex];
+
+    // Converged pixels keep their average and skip the trace
+    if (IsConverged(accumulation, moments))
+    {
+        gOutput[launchIndex] = float4(accumulation.rgb / accumulation.w, 1.f);
+        return;
+    }
         
     // float2 poissonDisk[NUM_SAMPLES];
     // poissonDiskSamples(uv, poissonDisk);
@@ -125,17 +157,21 @@ export void RayGen() {
         
     color += payload.color.xyz;
     
-    float4 frameColor = frameTexture[launchIndex];
-    
-    if (frameCount < SSP_MAX)
+    if (accumulation.w < SSP_MAX)
     {
-        gOutput[launchIndex] = (frameColor * float(frameCount) + float4(color, 1.f)) / float(frameCount + 1);
-    }
-    else
-    {
-        gOutput[launchIndex] = frameColor;
+        accumulation += float4(color, 1.f);
+        gAccumulation[launchIndex] = accumulation;
+
+        float luminance = Luminance(color);
+        float delta = luminance - moments.x;
+        moments.x += delta / accumulation.w;
+        moments.y += delta * (luminance - moments.x);
+        gVariance[launchIndex] = moments;
     }
     
+    // Only the displayed average is quantized to 8 bits
+    gOutput[launchIndex] = float4(accumulation.rgb / max(accumulation.w, 1.f), 1.f);
+    
     if (SSP_MAX == 0)
     {
         gOutput[launchIndex] = float4(color, 1.f);
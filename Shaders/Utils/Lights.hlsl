@@ -0,0 +1,115 @@
+// Explicit light list shared by the GPU and CPU path tracers (Source/CPU/Lights.h
+// is the C++ port). Point lights store their intensity in emission, triangle
+// and quad lights their radiance; area lights emit on the side of
+// cross(edge0, edge1). pmf / cdf are the light selection probabilities,
+// proportional to the emitted power.
+
+#define LIGHT_POINT 0
+#define LIGHT_TRIANGLE 1
+#define LIGHT_QUAD 2
+
+struct Light
+{
+    float3 position;    // point position, first vertex of triangles / corner of quads
+    uint type;
+    float3 edge0;
+    float area;
+    float3 edge1;
+    float pmf;
+    float3 emission;
+    float cdf;          // sum of the pmf up to and including this light
+};
+
+float3 LightNormal(Light light)
+{
+    return normalize(cross(light.edge0, light.edge1));
+}
+
+// Samples a point on the light as seen from position. L and distance point
+// at it, pdf is per solid angle (a delta for point lights) without the
+// selection probability. Returns the incident radiance, 0 when the sample
+// sees the back of an area light.
+float3 SampleLight(Light light, float3 position, float2 u, out float3 L, out float distance, out float pdf)
+{
+    if (light.type == LIGHT_POINT)
+    {
+        float3 d = light.position - position;
+        distance = length(d);
+        L = d / distance;
+        pdf = 1;
+        return light.emission / (distance * distance);
+    }
+
+    float3 p;
+    if (light.type == LIGHT_TRIANGLE)
+    {
+        // Uniform barycentrics
+        float s = sqrt(u.x);
+        p = light.position + light.edge0 * (s * (1 - u.y)) + light.edge1 * (s * u.y);
+    }
+    else
+    {
+        p = light.position + light.edge0 * u.x + light.edge1 * u.y;
+    }
+
+    float3 d = p - position;
+    distance = length(d);
+    L = d / distance;
+
+    float cosLight = -dot(L, LightNormal(light));
+    if (cosLight <= 0)
+    {
+        pdf = 0;
+        return float3(0, 0, 0);
+    }
+
+    pdf = distance * distance / (cosLight * light.area);
+    return light.emission;
+}
+
+// Solid angle pdf of SampleLight reaching the light at distance along L,
+// what MIS needs when a BRDF sampled ray hits an area light
+float LightPdf(Light light, float3 L, float distance)
+{
+    if (light.type == LIGHT_POINT)
+        return 0;
+
+    float cosLight = -dot(L, LightNormal(light));
+    if (cosLight <= 0)
+        return 0;
+    return distance * distance / (cosLight * light.area);
+}
+
+// Ray / area light intersection, the GPU lights are not part of the TLAS
+bool IntersectLight(Light light, float3 origin, float3 direction, float tMax, out float t)
+{
+    t = 0;
+    if (light.type == LIGHT_POINT)
+        return false;
+
+    // Moller-Trumbore, parallelogram for quads
+    float3 p = cross(direction, light.edge1);
+    float det = dot(light.edge0, p);
+    if (abs(det) < 1e-8)
+        return false;
+
+    float invDet = 1 / det;
+    float3 s = origin - light.position;
+    float b1 = dot(s, p) * invDet;
+    float3 q = cross(s, light.edge0);
+    float b2 = dot(direction, q) * invDet;
+    if (b1 < 0 || b2 < 0 || b1 > 1 || b2 > 1)
+        return false;
+    if (light.type == LIGHT_TRIANGLE && b1 + b2 > 1)
+        return false;
+
+    t = dot(light.edge1, q) * invDet;
+    return t > 0 && t < tMax;
+}
+
+float PowerHeuristic(float a, float b)
+{
+    float a2 = a * a;
+    float b2 = b * b;
+    return a2 + b2 > 0 ? a2 / (a2 + b2) : 0;
+}
@@ -1,4 +1,5 @@
 #include "Math.hlsl"
+#include "SobolMatrices.hlsl"
 
 #define PI 3.141592653589793
 #define PI2 6.283185307179586
@@ -66,6 +67,86 @@ float2 CranleyPattersonRotation(float2 seed, float2 rayIndex)
 
 }
 
+// Uniform [0, 1) number hashed from pixel (x, y), frame i and dimension b,
+// for decisions outside the Sobol dimensions (light sampling)
+float hashRandom(uint x, uint y, uint i, uint b)
+{
+    uint seed = (x * uint(1973) + y * uint(9277) + i * uint(26699) + b * uint(116539)) | uint(1);
+    wang_hash(seed);
+    return float(wang_hash(seed)) / 4294967296.0;
+}
+
+uint mixBits(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Hash based Owen scrambling, see sobolOwen in Source/CPU/Sampling.h
+uint nestedUniformScramble(uint x, uint seed)
+{
+    x = reversebits(x);
+    x ^= x * 0x3d20adeau;
+    x += seed;
+    x *= (seed >> 16) | 1u;
+    x ^= x * 0x05526c56u;
+    x ^= x * 0x53a22864u;
+    return reversebits(x);
+}
+
+// Dimension d of the ith Sobol point from the generated table, no gray code
+uint sobolBits(uint d, uint i)
+{
+    uint result = 0;
+    uint offset = d * 32;
+    for (uint j = 0; i; i >>= 1, j++)
+        if (i & 1)
+            result ^= SobolMatrices[j + offset];
+    return result;
+}
+
+// ith point of dimension d (below kSobolMatrixDimensions) of the Owen
+// scrambled sequence of seed
+float sobolOwen(uint i, uint d, uint seed)
+{
+    uint index = nestedUniformScramble(i, seed);
+    uint result = nestedUniformScramble(sobolBits(d, index), seed ^ mixBits(d + 1));
+    return float(result >> 8) * (1.0 / 16777216.0);
+}
+
+uint pixelSeed(uint x, uint y)
+{
+    return mixBits(x * uint(1973) + y * uint(9277) + uint(26699));
+}
+
+// Dimensions one bounce takes with sobolOwen: BSDF sample (2), BSDF lobe
+// selection (1), light selection and light sample (3), Russian roulette (1)
+static const uint kDimensionsPerBounce = 7;
+
+// Blue noise sampler keys (Source/CPU/BlueNoise.h): a 128 x 128 tile, one
+// ranking << 8 | scrambling key per decision of a bounce, two per uint
+static const uint kBlueNoiseTileSize = 128;
+static const uint kBlueNoiseWordsPerPixel = 4;
+
+// Sobol with one fixed Owen scramble, CPU::blueNoiseSequence
+uint blueNoiseSequence(uint d, uint i)
+{
+    return nestedUniformScramble(sobolBits(d, i), mixBits(~d));
+}
+
+// ith point of dimension d (below kSobolMatrixDimensions) with the blue
+// noise key of d % kDimensionsPerBounce and the pixelSeed of the pixel
+float blueNoiseSobol(uint i, uint d, uint key, uint seed)
+{
+    uint value = blueNoiseSequence(d, i ^ (key >> 8));
+    value ^= (key & 0xff) << 24 | mixBits(seed ^ mixBits(d + 1)) >> 8;
+    return float(value >> 8) * (1.0 / 16777216.0);
+}
+
 float3 sphereSample(const in float2 seed)
 {
     float z = 1.0 - 2.0 * seed.x;
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    const double kConvergedFractions[] = { 0.5, 0.9, 0.99, 1.0 };
+    const size_t kFractionCount = sizeof(kConvergedFractions) / sizeof(kConvergedFractions[0]);
+
+    struct SamplerResult
+    {
+        double secondsToFraction[kFractionCount] = {};     // < 0 if not reached
+        uint32_t framesToFraction[kFractionCount] = {};
+        double seconds = 0.0;
+        uint64_t samples = 0;
+        uint32_t frames = 0;
+    };
+
+    // Renders until every pixel is below the relative error threshold (or
+    // maxFrames), recording the render time at which each fraction of the
+    // pixels got there. Both samplers use the same per pixel estimate.
+    SamplerResult Measure(const Scene& scene, PathTracerSettings settings, uint32_t maxFrames, bool printTiles)
+    {
+        PathTracer tracer(scene, settings);
+        const size_t pixelCount = size_t(settings.width) * settings.height;
+        const float minSamples = float(std::max(2u, settings.adaptiveMinSamples));
+
+        SamplerResult result;
+        std::fill(std::begin(result.secondsToFraction), std::end(result.secondsToFraction), -1.0);
+
+        for (uint32_t frame = 0; frame < maxFrames; ++frame)
+        {
+            RenderStats stats = tracer.RenderFrame();
+            result.seconds += stats.seconds;
+            result.samples += stats.samples;
+            result.frames = frame + 1;
+
+            size_t converged = 0;
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                if (tracer.GetAccumulation()[i].w >= minSamples && tracer.GetRelativeError(i) < settings.adaptiveThreshold)
+                    ++converged;
+            }
+            double fraction = double(converged) / double(pixelCount);
+
+            for (size_t f = 0; f < kFractionCount; ++f)
+            {
+                if (result.secondsToFraction[f] < 0.0 && fraction >= kConvergedFractions[f])
+                {
+                    result.secondsToFraction[f] = result.seconds;
+                    result.framesToFraction[f] = frame + 1;
+                }
+            }
+
+            if (printTiles && (frame & (frame + 1)) == 0)
+            {
+                std::printf("  frame %5u: %6.2f%% pixels converged, %zu / %zu tiles active, %.1f ms\n", frame + 1,
+                    fraction * 100.0, size_t(tracer.GetActiveTileCount()), tracer.GetTiles().size(), stats.seconds * 1000.0);
+            }
+
+            if (converged == pixelCount)
+                break;
+        }
+        return result;
+    }
+
+    void Print(const char* name, const SamplerResult& result, size_t pixelCount)
+    {
+        std::printf("%-9s |", name);
+        for (size_t f = 0; f < kFractionCount; ++f)
+        {
+            if (result.secondsToFraction[f] < 0.0)
+                std::printf(" %18s", "not reached");
+            else
+                std::printf(" %8.2f s %5u f", result.secondsToFraction[f], result.framesToFraction[f]);
+        }
+        std::printf(" | %8.1f\n", double(result.samples) / double(pixelCount));
+    }
+
+    int RunAdaptive(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 160);
+        settings.height = args.GetInt("height", 90);
+        settings.threadCount = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+        settings.tileSize = args.GetInt("tile", 16);
+        settings.adaptiveThreshold = args.GetFloat("threshold", 0.05f);
+        settings.adaptiveMinSamples = args.GetInt("minspp", settings.adaptiveMinSamples);
+        const uint32_t maxFrames = args.GetInt("maxspp", 4096);
+        const size_t pixelCount = size_t(settings.width) * settings.height;
+
+        std::printf("%ux%u, relative error threshold %g after %u spp, at most %u spp\n", settings.width, settings.height,
+            settings.adaptiveThreshold, settings.adaptiveMinSamples, maxFrames);
+
+        std::printf("adaptive:\n");
+        settings.adaptiveSampling = true;
+        SamplerResult adaptive = Measure(scene, settings, maxFrames, true);
+        settings.adaptiveSampling = false;
+        SamplerResult uniform = Measure(scene, settings, maxFrames, false);
+
+        std::printf("time / frames to N%% of the pixels below the threshold\n");
+        std::printf("%-9s | %18s %18s %18s %18s | %8s\n", "sampler", "50%", "90%", "99%", "100%", "avg spp");
+        Print("uniform", uniform, pixelCount);
+        Print("adaptive", adaptive, pixelCount);
+        // Speedup at the largest fraction both samplers reached
+        for (size_t f = kFractionCount; f-- > 0;)
+        {
+            if (uniform.secondsToFraction[f] > 0.0 && adaptive.secondsToFraction[f] > 0.0)
+            {
+                std::printf("time to threshold (%g%% of the pixels) speedup %.2fx\n", kConvergedFractions[f] * 100.0,
+                    uniform.secondsToFraction[f] / adaptive.secondsToFraction[f]);
+                break;
+            }
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(adaptive, "Time to a relative error threshold, adaptive vs uniform sampling", RunAdaptive);
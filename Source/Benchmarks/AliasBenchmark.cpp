@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/AliasTable.h"
+#include "CPU/Timer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Heavy tailed weights with some zeros, like the luminance of a sky
+    // with a sun or the power of a few bright lights among many dim ones
+    std::vector<float> CreateWeights(uint32_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+        std::vector<float> weights(count);
+        for (float& w : weights)
+        {
+            float x = u(rng);
+            w = x < 0.05f ? 0.0f : std::pow(x, 16.0f);
+        }
+        return weights;
+    }
+
+    // Normalized inclusive prefix sum, what LightList and the shaders
+    // binary search
+    std::vector<float> BuildCdf(const std::vector<float>& weights)
+    {
+        std::vector<float> cdf(weights.size());
+        double sum = 0.0;
+        for (size_t i = 0; i < weights.size(); ++i)
+        {
+            sum += weights[i];
+            cdf[i] = float(sum);
+        }
+        for (float& c : cdf)
+            c = float(c / sum);
+        cdf.back() = 1.0f;
+        return cdf;
+    }
+
+    // Probability of every entry implied by the table against its pmf,
+    // relative to the mean probability. Exact up to rounding whatever the
+    // number of samples.
+    double MaxPmfError(const AliasTable<float>& table)
+    {
+        const std::vector<AliasEntry>& entries = table.GetEntries();
+        std::vector<double> implied(entries.size(), 0.0);
+        for (uint32_t i = 0; i < entries.size(); ++i)
+        {
+            implied[i] += entries[i].threshold;
+            implied[entries[i].alias] += 1.0 - entries[i].threshold;
+        }
+        double maxError = 0.0;
+        for (uint32_t i = 0; i < entries.size(); ++i)
+            maxError = std::max(maxError, std::fabs(implied[i] - double(table.Pmf(i)) * double(entries.size())));
+        return maxError;
+    }
+
+    int RunAlias(const Bench::BenchmarkArgs& args)
+    {
+        std::vector<uint32_t> counts;
+        std::stringstream list(args.GetString("counts", "1024,16384,262144,4194304,16777216"));
+        for (std::string item; std::getline(list, item, ',');)
+            counts.push_back(static_cast<uint32_t>(std::stoul(item)));
+        const uint32_t sampleCount = std::max(1, args.GetInt("samples", 1 << 22));
+        const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        TileScheduler scheduler(hardwareThreads);
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+        std::vector<float2> u(sampleCount);
+        for (float2& v : u)
+            v = float2(uniform(rng), uniform(rng));
+
+        std::printf("%u samples per table, %u hardware threads\n", sampleCount, hardwareThreads);
+        std::printf("%9s | %9s %9s %9s | %9s %9s %8s | %12s\n", "entries", "CDF build", "alias 1T",
+            "alias MT", "CDF ns", "alias ns", "speedup", "max pmf err");
+
+        for (uint32_t count : counts)
+        {
+            std::vector<float> weights = CreateWeights(count, rng);
+
+            Timer timer;
+            std::vector<float> cdf = BuildCdf(weights);
+            double cdfBuildMs = timer.GetMilliseconds();
+
+            AliasTable<float> table;
+            timer.Reset();
+            table.Build(weights);
+            double aliasBuildMs = timer.GetMilliseconds();
+            char aliasParallel[16] = "        -";
+            if (hardwareThreads > 1)
+            {
+                timer.Reset();
+                table.Build(weights, &scheduler);
+                std::snprintf(aliasParallel, sizeof(aliasParallel), "%7.2fms", timer.GetMilliseconds());
+            }
+
+            // The checksums keep the loops from being optimized out
+            uint64_t cdfChecksum = 0;
+            timer.Reset();
+            for (const float2& v : u)
+            {
+                size_t i = std::upper_bound(cdf.begin(), cdf.end(), v.x) - cdf.begin();
+                cdfChecksum += std::min(i, cdf.size() - 1);
+            }
+            double cdfNs = timer.GetSeconds() * 1e9 / sampleCount;
+
+            uint64_t aliasChecksum = 0;
+            float2 remapped;
+            timer.Reset();
+            for (const float2& v : u)
+                aliasChecksum += table.Sample(v, remapped);
+            double aliasNs = timer.GetSeconds() * 1e9 / sampleCount;
+
+            if (cdfChecksum > uint64_t(count) * sampleCount || aliasChecksum > uint64_t(count) * sampleCount)
+            {
+                std::printf("FAILED: index out of range\n");
+                return 1;
+            }
+
+            double error = MaxPmfError(table);
+            std::printf("%9u | %7.2fms %7.2fms %9s | %9.2f %9.2f %7.2fx | %12.3g\n", count, cdfBuildMs, aliasBuildMs,
+                aliasParallel, cdfNs, aliasNs, cdfNs / aliasNs, error);
+            if (error > 1e-3)
+            {
+                std::printf("FAILED: alias table does not reproduce the pmf\n");
+                return 1;
+            }
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(alias, "Alias table vs CDF binary search: build time and sampling cost at 1K-16M entries", RunAlias);
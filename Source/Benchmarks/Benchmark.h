@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+#include "Common/Args.h"
+
+namespace Bench
+{
+    // --name=value options of D3DRTBench, after the benchmark name
+    typedef Common::Args BenchmarkArgs;
+
+    typedef int (*BenchmarkFunction)(const BenchmarkArgs& args);
+
+    struct BenchmarkInfo
+    {
+        const char* name;
+        const char* description;
+        BenchmarkFunction function;
+    };
+
+    inline std::vector<BenchmarkInfo>& GetBenchmarks()
+    {
+        static std::vector<BenchmarkInfo> benchmarks;
+        return benchmarks;
+    }
+
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(const char* name, const char* description, BenchmarkFunction function)
+        {
+            GetBenchmarks().push_back({ name, description, function });
+        }
+    };
+}
+
+// Registers a benchmark that D3DRTBench can run by name, e.g.
+// REGISTER_BENCHMARK(occlusion, "Shadow ray any-hit vs closest-hit", RunOcclusion)
+#define REGISTER_BENCHMARK(name, description, function) \
+    static Bench::BenchmarkRegistrar s_benchmark_##name(#name, description, function)
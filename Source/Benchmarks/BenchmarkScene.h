@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/Camera.h"
+#include "CPU/SceneLoader.h"
+#include "CPU/Timer.h"
+
+namespace Bench
+{
+    // Loads the default D3DRTWindow scene. --root selects the directory
+    // containing Models/ (defaults to the working directory).
+    inline void LoadBenchmarkScene(const BenchmarkArgs& args, CPU::Scene& scene)
+    {
+        CPU::Timer timer;
+        CPU::SceneLoader::LoadDefaultScene(scene, args.GetString("root", ""));
+        std::printf("Scene: %zu triangles, %zu BVH nodes, loaded and built in %.1f ms\n",
+            scene.GetTriangleBVH().GetTriangleCount(), scene.GetTriangleBVH().GetNodeCount(), timer.GetMilliseconds());
+    }
+
+    // The armadillos and the plane of the default scene with a diffuse
+    // finish. The default materials are mostly glossy metal, which BRDF
+    // sampling handles better than any light sample. Not built.
+    inline void LoadDiffuseBenchmarkScene(const BenchmarkArgs& args, CPU::Scene& scene)
+    {
+        using namespace CPU;
+        Material diffuse;
+        diffuse.baseColor = float3(0.6f);
+        diffuse.roughness = 1.0f;
+        uint32_t material = scene.AddMaterial(diffuse);
+
+        const float4x4 scale = Scaling(0.008f, 0.008f, 0.008f);
+        uint32_t armadillo = scene.AddMesh(SceneLoader::LoadModel(args.GetString("root", "") + "Models/stanford-armadillo-pbr/model.dae"));
+        scene.AddInstance(armadillo, material, scale);
+        scene.AddInstance(armadillo, material, mul(Translation(-1.f, 0, 0), scale));
+        scene.AddInstance(armadillo, material, mul(Translation(1.f, 0, 0), scale));
+        scene.AddInstance(scene.AddMesh(SceneLoader::CreatePlane()), material, float4x4());
+    }
+
+    // The dragon of the default scene alone on its plane, both glossy
+    // metal. Not built.
+    inline void LoadDragonBenchmarkScene(const BenchmarkArgs& args, CPU::Scene& scene)
+    {
+        using namespace CPU;
+        Material planeMaterial;
+        planeMaterial.baseColor = float3(0.54f, 0.55f, 0.57f);
+        planeMaterial.metallic = 0.9f;
+        planeMaterial.roughness = 0.2f;
+
+        Material dragonMaterial;
+        dragonMaterial.baseColor = float3(1.f, 0.07f, 0.16f);
+        dragonMaterial.metallic = 0.9f;
+        dragonMaterial.roughness = 0.1f;
+
+        const float4x4 scale = Scaling(0.008f, 0.008f, 0.008f);
+        uint32_t dragon = scene.AddMesh(SceneLoader::LoadModel(args.GetString("root", "") + "Models/stanford-dragon-pbr/model.dae"));
+        scene.AddInstance(dragon, scene.AddMaterial(dragonMaterial), mul(Translation(0, 0, 0.6f), scale));
+        scene.AddInstance(scene.AddMesh(SceneLoader::CreatePlane()), scene.AddMaterial(planeMaterial), float4x4());
+    }
+
+    // The center armadillo of the default scene, metallic gold, on the
+    // plane. Not built.
+    inline void LoadArmadilloBenchmarkScene(const BenchmarkArgs& args, CPU::Scene& scene)
+    {
+        using namespace CPU;
+        Material planeMaterial;
+        planeMaterial.baseColor = float3(0.54f, 0.55f, 0.57f);
+        planeMaterial.metallic = 0.9f;
+        planeMaterial.roughness = 0.2f;
+
+        Material armadilloMaterial;
+        armadilloMaterial.baseColor = float3(0.82f, 0.67f, 0.16f);
+        armadilloMaterial.metallic = 0.8f;
+        armadilloMaterial.specular = 0.3f;
+        armadilloMaterial.roughness = 0.25f;
+
+        const float4x4 scale = Scaling(0.008f, 0.008f, 0.008f);
+        uint32_t armadillo = scene.AddMesh(SceneLoader::LoadModel(args.GetString("root", "") + "Models/stanford-armadillo-pbr/model.dae"));
+        scene.AddInstance(armadillo, scene.AddMaterial(armadilloMaterial), scale);
+        scene.AddInstance(scene.AddMesh(SceneLoader::CreatePlane()), scene.AddMaterial(planeMaterial), float4x4());
+    }
+
+    // One camera per line: eye xyz, center xyz
+    inline bool LoadCameraPath(const std::string& path, std::vector<CPU::Camera>& cameras)
+    {
+        FILE* file = std::fopen(path.c_str(), "r");
+        if (!file)
+            return false;
+        CPU::Camera camera;
+        while (std::fscanf(file, "%f %f %f %f %f %f", &camera.eye.x, &camera.eye.y, &camera.eye.z,
+            &camera.center.x, &camera.center.y, &camera.center.z) == 6)
+            cameras.push_back(camera);
+        std::fclose(file);
+        return !cameras.empty();
+    }
+
+    inline void SaveCameraPath(const std::string& path, const std::vector<CPU::Camera>& cameras)
+    {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file)
+            return;
+        for (const CPU::Camera& camera : cameras)
+        {
+            std::fprintf(file, "%f %f %f %f %f %f\n", camera.eye.x, camera.eye.y, camera.eye.z,
+                camera.center.x, camera.center.y, camera.center.z);
+        }
+        std::fclose(file);
+    }
+
+    // The default view orbiting the scene center, a small step per frame
+    // like a slow mouse drag
+    inline std::vector<CPU::Camera> CreateOrbitPath(uint32_t frameCount, float degreesPerFrame)
+    {
+        using namespace CPU;
+        std::vector<Camera> cameras;
+        Camera camera;
+        for (uint32_t i = 0; i < frameCount; ++i)
+        {
+            float angle = float(i) * degreesPerFrame * PI / 180.0f;
+            Camera c = camera;
+            c.eye.x = camera.eye.x * std::cos(angle) - camera.eye.z * std::sin(angle);
+            c.eye.z = camera.eye.x * std::sin(angle) + camera.eye.z * std::cos(angle);
+            cameras.push_back(c);
+        }
+        return cameras;
+    }
+
+    // RMSE of the displayed (clamped) image against the reference, rgb only
+    inline double ComputeRMSE(const std::vector<float>& image, const std::vector<float>& reference)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < image.size(); ++i)
+        {
+            double d = double(CPU::saturate(image[i])) - double(CPU::saturate(reference[i]));
+            sum += d * d;
+        }
+        return std::sqrt(sum / double(image.size()));
+    }
+}
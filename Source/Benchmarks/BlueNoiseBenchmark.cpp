@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Displayed (clamped) rgb minus the reference
+    std::vector<float> ComputeError(const std::vector<float>& image, const std::vector<float>& reference)
+    {
+        std::vector<float> error(image.size());
+        for (size_t i = 0; i < image.size(); ++i)
+            error[i] = saturate(image[i]) - saturate(reference[i]);
+        return error;
+    }
+
+    double ComputeRMS(const std::vector<float>& error)
+    {
+        double sum = 0.0;
+        for (float e : error)
+            sum += double(e) * e;
+        return std::sqrt(sum / double(error.size()));
+    }
+
+    // Separable Gaussian of the rgb error image, a simple model of the eye
+    // at a normal viewing distance: white noise keeps a good part of its
+    // energy, blue noise mostly averages out
+    std::vector<float> Blur(const std::vector<float>& rgb, uint32_t width, uint32_t height, float sigma)
+    {
+        const int radius = int(std::ceil(3.0f * sigma));
+        std::vector<float> kernel(2 * radius + 1);
+        float total = 0.0f;
+        for (int i = -radius; i <= radius; ++i)
+            total += kernel[i + radius] = std::exp(-0.5f * float(i * i) / (sigma * sigma));
+        for (float& k : kernel)
+            k /= total;
+
+        std::vector<float> rows(rgb.size()), result(rgb.size());
+        for (int y = 0; y < int(height); ++y)
+        {
+            for (int x = 0; x < int(width); ++x)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    float sum = 0.0f;
+                    for (int i = -radius; i <= radius; ++i)
+                        sum += kernel[i + radius] * rgb[(size_t(y) * width + std::clamp(x + i, 0, int(width) - 1)) * 3 + c];
+                    rows[(size_t(y) * width + x) * 3 + c] = sum;
+                }
+            }
+        }
+        for (int y = 0; y < int(height); ++y)
+        {
+            for (int x = 0; x < int(width); ++x)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    float sum = 0.0f;
+                    for (int i = -radius; i <= radius; ++i)
+                        sum += kernel[i + radius] * rows[(size_t(std::clamp(y + i, 0, int(height) - 1)) * width + x) * 3 + c];
+                    result[(size_t(y) * width + x) * 3 + c] = sum;
+                }
+            }
+        }
+        return result;
+    }
+
+    int RunBlueNoise(const Bench::BenchmarkArgs& args)
+    {
+        // The default scene is mostly glossy metal, whose noise comes from
+        // the later bounces; --scene=diffuse makes the first bounce count
+        Scene scene;
+        if (args.GetString("scene", "default") == "diffuse")
+        {
+            Bench::LoadDiffuseBenchmarkScene(args, scene);
+            scene.Build();
+        }
+        else
+            Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.width = args.GetInt("width", 128);
+        settings.height = args.GetInt("height", 128);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 1024));
+        const float sigma = args.GetFloat("sigma", 1.0f);
+
+        // Owen scrambled frames past the ones compared below
+        Timer timer;
+        std::vector<float> reference;
+        {
+            PathTracerSettings referenceSettings = settings;
+            referenceSettings.sampler = SamplerType::OwenSobol;
+            PathTracer tracer(scene, referenceSettings);
+            tracer.Reset(256);
+            for (uint32_t i = 0; i < referenceSpp; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(reference);
+        }
+        std::printf("%ux%u, reference %u spp rendered in %.1f s\n", settings.width, settings.height, referenceSpp, timer.GetSeconds());
+        std::printf("Perceptual error: RMSE of the error image blurred by a Gaussian of %.1f pixels\n\n", sigma);
+
+        const SamplerType samplers[] = { SamplerType::Sobol, SamplerType::OwenSobol, SamplerType::BlueNoise };
+        const char* names[] = { "sobol+cp", "owen", "bluenoise" };
+        const uint32_t counts[] = { 1, 2, 4 };
+        double baseline[3] = {};
+
+        std::printf("%-10s %4s | %9s %11s | %8s\n", "sampler", "spp", "RMSE", "perceptual", "vs sobol");
+        for (int s = 0; s < 3; ++s)
+        {
+            settings.sampler = samplers[s];
+            PathTracer tracer(scene, settings);
+            tracer.Reset();
+            uint32_t frames = 0;
+            std::vector<float> image;
+            for (int c = 0; c < 3; ++c)
+            {
+                for (; frames < counts[c]; ++frames)
+                    tracer.RenderFrame();
+                tracer.ResolveHDR(image);
+
+                std::vector<float> error = ComputeError(image, reference);
+                double rmse = ComputeRMS(error);
+                double perceptual = ComputeRMS(Blur(error, settings.width, settings.height, sigma));
+                if (s == 0)
+                    baseline[c] = perceptual;
+                std::printf("%-10s %4u | %9.5f %11.5f | %7.2fx\n", names[s], counts[c], rmse, perceptual, baseline[c] / perceptual);
+            }
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(bluenoise, "Perceptual (blurred) error at 1-4 spp of the blue noise sampler vs Sobol + Cranley-Patterson and Owen", RunBlueNoise);
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    inline float Quantize8(float x)
+    {
+        return std::floor(saturate(x) * 255.0f + 0.5f) / 255.0f;
+    }
+
+    int RunConvergence(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 64);
+        settings.height = args.GetInt("height", 36);
+        const uint32_t spp = std::max(1, args.GetInt("spp", 2048));
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 8192));
+
+        PathTracer tracer(scene, settings);
+        const size_t pixelCount = size_t(settings.width) * settings.height;
+
+        // Reference from a Sobol range that does not overlap the test frames
+        Timer timer;
+        std::vector<float> reference;
+        tracer.Reset(spp);
+        for (uint32_t i = 0; i < referenceSpp; ++i)
+            tracer.RenderFrame();
+        tracer.ResolveHDR(reference);
+        std::printf("%ux%u, reference %u spp rendered in %.1f s\n", settings.width, settings.height, referenceSpp, timer.GetSeconds());
+
+        // The old gOutput path: every frame is folded into an 8-bit running
+        // average, the new one keeps the float sum and resolves at the end
+        std::vector<float> unorm8(pixelCount * 3, 0.0f);
+        std::vector<float4> previous(pixelCount, float4(0.0f));
+        std::vector<float> resolved;
+
+        std::printf("    spp |  float32 RMSE   8-bit RMSE\n");
+        tracer.Reset();
+        uint32_t nextReport = 1;
+        for (uint32_t frame = 0; frame < spp; ++frame)
+        {
+            tracer.RenderFrame();
+
+            const std::vector<float4>& accumulation = tracer.GetAccumulation();
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    float color = accumulation[i][c] - previous[i][c];
+                    float& pixel = unorm8[i * 3 + c];
+                    pixel = Quantize8((pixel * float(frame) + color) / float(frame + 1));
+                }
+                previous[i] = accumulation[i];
+            }
+
+            if (frame + 1 == nextReport || frame + 1 == spp)
+            {
+                tracer.ResolveHDR(resolved);
+                std::printf("%7u | %13.5f %12.5f\n", frame + 1, Bench::ComputeRMSE(resolved, reference), Bench::ComputeRMSE(unorm8, reference));
+                nextReport *= 4;
+            }
+        }
+
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(convergence, "RMSE over spp of the float32 accumulation vs the 8-bit running average", RunConvergence);
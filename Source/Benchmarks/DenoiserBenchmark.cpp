@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/Denoiser.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct Features
+    {
+        std::vector<float3> albedo;
+        std::vector<float3> normals;
+        std::vector<float> depth;
+    };
+
+    void DenoiseFrame(Denoiser& denoiser, const PathTracer& tracer, const Features& features, std::vector<float>& rgb)
+    {
+        std::vector<float> color, variance;
+        tracer.ResolveHDR(color);
+        tracer.ResolveVariance(variance);
+
+        DenoiserInput input;
+        input.width = tracer.GetSettings().width;
+        input.height = tracer.GetSettings().height;
+        input.color = color.data();
+        input.variance = variance.data();
+        input.albedo = features.albedo.data();
+        input.normal = features.normals.data();
+        input.depth = features.depth.data();
+        denoiser.Denoise(input, rgb);
+    }
+
+    int RunDenoiser(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        if (args.GetString("scene", "default") == "diffuse")
+        {
+            Bench::LoadDiffuseBenchmarkScene(args, scene);
+            scene.Build();
+        }
+        else
+            Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 256);
+        settings.height = args.GetInt("height", 144);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 1024));
+
+        DenoiserSettings denoiserSettings;
+        denoiserSettings.iterations = args.GetInt("iterations", denoiserSettings.iterations);
+        denoiserSettings.sigmaLuminance = args.GetFloat("sigmal", denoiserSettings.sigmaLuminance);
+        Denoiser denoiser(denoiserSettings);
+
+        // Quality: the denoised image against the noisy one with 16x the
+        // samples, both compared with an Owen scrambled reference
+        Timer timer;
+        std::vector<float> reference;
+        {
+            PathTracerSettings referenceSettings = settings;
+            referenceSettings.sampler = SamplerType::OwenSobol;
+            PathTracer tracer(scene, referenceSettings);
+            tracer.Reset(1u << 20);
+            for (uint32_t i = 0; i < referenceSpp; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(reference);
+        }
+        std::printf("%ux%u, reference %u spp rendered in %.1f s, %u a-trous passes\n\n", settings.width, settings.height,
+            referenceSpp, timer.GetSeconds(), denoiserSettings.iterations);
+
+        PathTracer tracer(scene, settings);
+        Features features;
+        tracer.RenderFeatures(features.albedo, features.normals, features.depth);
+
+        std::printf("%5s | %9s %9s | %8s %11s | %7s\n", "spp", "noisy", "denoised", "16x spp", "noisy 16x", "ratio");
+        std::vector<float> noisy, denoised, noisy16;
+        const uint32_t counts[] = { 1, 4 };
+        for (uint32_t spp : counts)
+        {
+            tracer.Reset();
+            for (uint32_t i = 0; i < spp; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(noisy);
+            DenoiseFrame(denoiser, tracer, features, denoised);
+
+            for (uint32_t i = spp; i < spp * 16; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(noisy16);
+
+            double noisyRMSE = Bench::ComputeRMSE(noisy, reference);
+            double denoisedRMSE = Bench::ComputeRMSE(denoised, reference);
+            double noisy16RMSE = Bench::ComputeRMSE(noisy16, reference);
+            std::printf("%5u | %9.5f %9.5f | %8u %11.5f | %6.2fx\n", spp, noisyRMSE, denoisedRMSE, spp * 16, noisy16RMSE,
+                noisy16RMSE / denoisedRMSE);
+        }
+
+        // Speed: one 1 spp frame at --timing resolution through every kernel width
+        settings.width = args.GetInt("timingwidth", 1920);
+        settings.height = args.GetInt("timingheight", 1080);
+        const int runs = std::max(1, args.GetInt("runs", 3));
+        PathTracer large(scene, settings);
+        large.RenderFeatures(features.albedo, features.normals, features.depth);
+        large.RenderFrame();
+
+        std::printf("\n%ux%u, 1 spp, %u threads, best of %d\n", settings.width, settings.height, denoiser.GetSettings().threadCount, runs);
+        const SimdWidth widths[] = { SimdWidth::Scalar, SimdWidth::SSE, SimdWidth::AVX2 };
+        for (SimdWidth width : widths)
+        {
+            if (width > GetMaxSimdWidth())
+                continue;
+            denoiserSettings.simdWidth = width;
+            Denoiser timed(denoiserSettings);
+            double best = INFINITY;
+            for (int run = 0; run < runs; ++run)
+            {
+                Timer denoiseTimer;
+                DenoiseFrame(timed, large, features, denoised);
+                best = std::min(best, denoiseTimer.GetMilliseconds());
+            }
+            std::printf("  %-7s %8.1f ms\n", ToString(width), best);
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(denoiser, "SVGF style a-trous denoiser: RMSE against 16x the samples and 1080p time per SIMD width", RunDenoiser);
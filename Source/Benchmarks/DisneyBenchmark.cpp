@@ -0,0 +1,183 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/DisneySIMD.h"
+#include "CPU/Sampling.h"
+#include "CPU/Timer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Random shading inputs: a frame per lane, V in the upper hemisphere and
+    // L anywhere on the sphere so half the lanes hit the NdotL < 0 mask
+    struct DisneyInputs
+    {
+        float3Array L, V, N, T, B;
+        std::vector<float> seedX, seedY, seed1;
+
+        DisneyInputs(uint32_t count, std::mt19937& rng)
+        {
+            std::uniform_real_distribution<float> u(0.0f, 1.0f);
+            L.Resize(count); V.Resize(count); N.Resize(count); T.Resize(count); B.Resize(count);
+            seedX.resize(count); seedY.resize(count); seed1.resize(count);
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                float3 n = sphereSample(float2(u(rng), u(rng)));
+                float3 t = normalize(cross(std::fabs(n.x) > 0.9f ? float3(0, 1, 0) : float3(1, 0, 0), n));
+                float3 b = cross(n, t);
+                TBNFrame tbn = { t, b, n };
+
+                N.Set(i, n);
+                T.Set(i, t);
+                B.Set(i, b);
+                V.Set(i, hemisphereSample(tbn, float2(u(rng), u(rng))));
+                L.Set(i, sphereSample(float2(u(rng), u(rng))));
+                seedX[i] = u(rng);
+                seedY[i] = u(rng);
+                seed1[i] = u(rng);
+            }
+        }
+    };
+
+    std::vector<Material> CreateMaterials(std::mt19937& rng, uint32_t count)
+    {
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+        std::vector<Material> materials(count);
+        for (Material& m : materials)
+        {
+            m.baseColor = float3(u(rng), u(rng), u(rng));
+            m.metallic = u(rng);
+            m.subsurface = u(rng);
+            m.specular = u(rng);
+            m.roughness = 0.05f + 0.95f * u(rng);
+            m.specularTint = u(rng);
+            m.sheen = u(rng);
+            m.sheenTint = u(rng);
+            m.clearcoat = u(rng);
+            m.clearcoatGloss = u(rng);
+        }
+        return materials;
+    }
+
+    // Fraction of values off the reference by more than tolerance, relative
+    // to max(|reference|, 1). Grazing lanes are ill conditioned (1 / (NdotL +
+    // NdotV), the pdf near LdotH = 0), so a few outliers are expected.
+    struct ErrorStats
+    {
+        double maxError = 0.0;
+        uint64_t outliers = 0;
+        uint64_t count = 0;
+
+        void Add(float value, float reference, float tolerance)
+        {
+            double error = std::fabs(double(value) - double(reference)) / std::max(1.0, std::fabs(double(reference)));
+            if (!(error <= tolerance))
+                ++outliers;
+            else
+                maxError = std::max(maxError, error);
+            ++count;
+        }
+
+        double OutlierFraction() const { return count ? double(outliers) / double(count) : 0.0; }
+    };
+
+    int RunDisney(const Bench::BenchmarkArgs& args)
+    {
+        const uint32_t count = args.GetInt("count", 1 << 16);
+        const uint32_t iterations = args.GetInt("iterations", 50);
+        const float tolerance = args.GetFloat("tolerance", 1e-3f);
+
+        std::mt19937 rng(1234);
+        DisneyInputs in(count, rng);
+        std::vector<Material> materials = CreateMaterials(rng, 8);
+
+        std::vector<SimdWidth> widths = { SimdWidth::Scalar };
+        if (GetMaxSimdWidth() >= SimdWidth::SSE)
+            widths.push_back(SimdWidth::SSE);
+        if (GetMaxSimdWidth() >= SimdWidth::AVX2)
+            widths.push_back(SimdWidth::AVX2);
+
+        float3Array f, fReference, L, LReference;
+        std::vector<float> pdf(count), pdfReference(count);
+        f.Resize(count); fReference.Resize(count); L.Resize(count); LReference.Resize(count);
+
+        // Validation against the scalar kernels, every material
+        bool failed = false;
+        for (SimdWidth width : widths)
+        {
+            if (width == SimdWidth::Scalar)
+                continue;
+
+            ErrorStats brdfError, directionError, pdfError;
+            for (const Material& material : materials)
+            {
+                Disney_BRDF_SoA(material, in.L.SoA(), in.V.SoA(), in.N.SoA(), fReference.SoA(), count, SimdWidth::Scalar);
+                Disney_BRDF_SoA(material, in.L.SoA(), in.V.SoA(), in.N.SoA(), f.SoA(), count, width);
+
+                Disney_BRDF_Sample_SoA(material, in.seedX.data(), in.seedY.data(), in.seed1.data(), in.V.SoA(), in.N.SoA(),
+                    in.T.SoA(), in.B.SoA(), LReference.SoA(), pdfReference.data(), count, SimdWidth::Scalar);
+                Disney_BRDF_Sample_SoA(material, in.seedX.data(), in.seedY.data(), in.seed1.data(), in.V.SoA(), in.N.SoA(),
+                    in.T.SoA(), in.B.SoA(), L.SoA(), pdf.data(), count, width);
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        brdfError.Add(f.Get(i)[c], fReference.Get(i)[c], tolerance);
+                        directionError.Add(L.Get(i)[c], LReference.Get(i)[c], tolerance);
+                    }
+                    // The pdf is evaluated at the sampled L, which already
+                    // differs by ~1e-5 (polynomial sin / cos / exp2), and the
+                    // GTR2 peak of low roughness amplifies that
+                    pdfError.Add(pdf[i], pdfReference[i], 10.0f * tolerance);
+                }
+            }
+
+            std::printf("%-6s vs scalar: BRDF max error %.2e (%.4f%% outliers), L %.2e (%.4f%%), pdf %.2e (%.4f%%)\n", ToString(width),
+                brdfError.maxError, brdfError.OutlierFraction() * 100.0, directionError.maxError, directionError.OutlierFraction() * 100.0,
+                pdfError.maxError, pdfError.OutlierFraction() * 100.0);
+
+            const double maxOutliers = 1e-3;
+            if (brdfError.OutlierFraction() > maxOutliers || directionError.OutlierFraction() > maxOutliers || pdfError.OutlierFraction() > maxOutliers)
+                failed = true;
+        }
+
+        // Throughput, all materials in turn like the wavefront shading stage
+        std::printf("%u lanes x %zu materials x %u iterations\n", count, materials.size(), iterations);
+        std::printf("width  |  Disney_BRDF Meval/s   Disney_BRDF_Sample Msample/s\n");
+        for (SimdWidth width : widths)
+        {
+            Timer evalTimer;
+            for (uint32_t it = 0; it < iterations; ++it)
+            {
+                for (const Material& material : materials)
+                    Disney_BRDF_SoA(material, in.L.SoA(), in.V.SoA(), in.N.SoA(), f.SoA(), count, width);
+            }
+            double evalSeconds = evalTimer.GetSeconds();
+
+            Timer sampleTimer;
+            for (uint32_t it = 0; it < iterations; ++it)
+            {
+                for (const Material& material : materials)
+                    Disney_BRDF_Sample_SoA(material, in.seedX.data(), in.seedY.data(), in.seed1.data(), in.V.SoA(), in.N.SoA(),
+                        in.T.SoA(), in.B.SoA(), L.SoA(), pdf.data(), count, width);
+            }
+            double sampleSeconds = sampleTimer.GetSeconds();
+
+            double evaluations = double(count) * materials.size() * iterations;
+            std::printf("%-6s | %20.1f %29.1f\n", ToString(width), evaluations / evalSeconds * 1e-6, evaluations / sampleSeconds * 1e-6);
+        }
+
+        if (failed)
+        {
+            std::printf("FAILED: SIMD kernels differ from the scalar Disney BRDF\n");
+            return 1;
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(disney, "SoA SSE / AVX2 Disney BRDF evaluation and sampling vs the scalar port", RunDisney);
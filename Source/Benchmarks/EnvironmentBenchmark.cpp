@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Outdoor style sky in the latitude-longitude layout of EnvironmentMap:
+    // a blue gradient, a dark ground and a small sun that provides most of
+    // the light
+    std::vector<float> CreateSky(uint32_t width, uint32_t height)
+    {
+        const float3 sunDirection = normalize(float3(0.5f, 0.6f, -0.4f));
+        const float sunCos = std::cos(0.03f);
+        const float3 sunRadiance = float3(1.0f, 0.9f, 0.75f) * 8000.0f;
+
+        std::vector<float> rgb(size_t(width) * height * 3);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            float theta = PI * (y + 0.5f) / height;
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                float phi = ((x + 0.5f) / width - 0.5f) * PI2;
+                float3 d(std::sin(theta) * std::sin(phi), std::cos(theta), -std::sin(theta) * std::cos(phi));
+
+                float3 color;
+                if (d.y < 0.0f)
+                    color = float3(0.08f, 0.07f, 0.06f);
+                else
+                    color = float3(0.9f, 0.95f, 1.0f) * (1.0f - d.y) + float3(0.25f, 0.45f, 0.9f) * d.y;
+                if (dot(d, sunDirection) > sunCos)
+                    color = sunRadiance;
+
+                float* texel = &rgb[3 * (size_t(y) * width + x)];
+                texel[0] = color.x;
+                texel[1] = color.y;
+                texel[2] = color.z;
+            }
+        }
+        return rgb;
+    }
+
+    std::vector<float> Render(const Scene& scene, const PathTracerSettings& settings, uint32_t spp, double& seconds,
+        uint32_t firstFrameIndex = 0)
+    {
+        PathTracer tracer(scene, settings);
+        tracer.Reset(firstFrameIndex);
+        seconds = 0.0;
+        for (uint32_t i = 0; i < spp; ++i)
+            seconds += tracer.RenderFrame().seconds;
+
+        std::vector<float> image;
+        tracer.ResolveHDR(image);
+        return image;
+    }
+
+    double MeanValue(const std::vector<float>& image)
+    {
+        double sum = 0.0;
+        for (float v : image)
+            sum += v;
+        return sum / double(image.size());
+    }
+
+    int RunEnvironment(const Bench::BenchmarkArgs& args)
+    {
+        const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        // Distribution build of a large map, one thread against all of them
+        {
+            const uint32_t width = args.GetInt("mapwidth", 4096);
+            const uint32_t height = width / 2;
+            std::vector<float> sky = CreateSky(width, height);
+            std::printf("%ux%u environment, sampling distribution build:\n", width, height);
+            std::vector<uint32_t> threadCounts = { 1u };
+            if (hardwareThreads > 1)
+                threadCounts.push_back(hardwareThreads);
+            for (uint32_t threads : threadCounts)
+            {
+                TileScheduler scheduler(threads);
+                EnvironmentMap environment;
+                std::vector<float> copy = sky;
+                Timer timer;
+                environment.Create(width, height, std::move(copy), &scheduler);
+                std::printf("  %2u threads: %8.2f ms\n", threads, timer.GetMilliseconds());
+            }
+        }
+
+        Scene scene;
+        Bench::LoadDiffuseBenchmarkScene(args, scene);
+        EnvironmentMap environment;
+        environment.Create(1024, 512, CreateSky(1024, 512));
+        scene.SetEnvironment(std::move(environment));
+        scene.Build();
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 96);
+        settings.height = args.GetInt("height", 54);
+        settings.threadCount = args.GetInt("threads", hardwareThreads);
+        const uint32_t spp = std::max(1, args.GetInt("spp", 32));
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 1024));
+
+        double seconds;
+        settings.nextEventEstimation = true;
+        std::vector<float> reference = Render(scene, settings, referenceSpp, seconds, spp);
+
+        std::printf("%ux%u, %u spp, reference %u spp\n", settings.width, settings.height, spp, referenceSpp);
+        std::printf("%-10s | %9s %10s %12s %14s\n", "estimator", "ms/frame", "mean", "RMSE", "1/(MSE*time)");
+        double baseline = 0.0;
+        for (bool useNee : { false, true })
+        {
+            settings.nextEventEstimation = useNee;
+            std::vector<float> image = Render(scene, settings, spp, seconds);
+            double rmse = Bench::ComputeRMSE(image, reference);
+            double efficiency = 1.0 / (rmse * rmse * seconds);
+            if (baseline == 0.0)
+                baseline = efficiency;
+            std::printf("%-10s | %9.2f %10.5f %12.6f %13.2fx\n", useNee ? "NEE + MIS" : "BRDF only", seconds * 1000.0 / spp,
+                MeanValue(image), rmse, efficiency / baseline);
+        }
+        std::printf("%-10s | %9s %10.5f\n", "reference", "", MeanValue(reference));
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(environment, "Importance sampled HDR environment: NEE + MIS vs BRDF sampling, distribution build time", RunEnvironment);
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct Variant
+    {
+        std::string name;
+        FireflyFilter filter;
+        float budget;
+    };
+
+    int RunFirefly(const Bench::BenchmarkArgs& args)
+    {
+        // The default scene with its lights and no light sampling: the small
+        // bright lights are only found by the BRDF samples of the glossy
+        // metal, each find is a firefly
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+        SceneLoader::AddDefaultLights(scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 128);
+        settings.height = args.GetInt("height", 72);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.nextEventEstimation = args.GetInt("nee", 0) != 0;
+        settings.fireflyBuckets = args.GetInt("buckets", settings.fireflyBuckets);
+        settings.fireflyGiniThreshold = args.GetFloat("gini", settings.fireflyGiniThreshold);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 4096));
+        const float maxSeconds = args.GetFloat("seconds", 8.0f);
+
+        // Plain average, the unbiased answer both filters are measured against
+        Timer timer;
+        std::vector<float> reference;
+        {
+            PathTracerSettings referenceSettings = settings;
+            referenceSettings.sampler = SamplerType::OwenSobol;
+            PathTracer tracer(scene, referenceSettings);
+            tracer.Reset(1u << 20);
+            for (uint32_t i = 0; i < referenceSpp; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(reference);
+        }
+        std::printf("%ux%u, NEE %s, reference %u spp rendered in %.1f s\n\n", settings.width, settings.height,
+            settings.nextEventEstimation ? "on" : "off", referenceSpp, timer.GetSeconds());
+
+        std::vector<Variant> variants;
+        variants.push_back({ "mean", FireflyFilter::None, 0.0f });
+        variants.push_back({ "trimmed " + std::to_string(settings.fireflyBuckets), FireflyFilter::TrimmedBucketMean, 0.0f });
+        const float budgets[] = { 0.001f, 0.01f, 0.05f };
+        for (float budget : budgets)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "clamp %g", budget);
+            variants.push_back({ name, FireflyFilter::Clamp, budget });
+        }
+
+        std::vector<float> checkpoints;
+        for (float seconds = 0.5f; seconds <= maxSeconds * 1.001f; seconds *= 2.0f)
+            checkpoints.push_back(seconds);
+
+        // Equal render time, the resolve included
+        std::vector<std::vector<double>> rmse(variants.size());
+        std::vector<uint32_t> finalSpp(variants.size());
+        std::vector<float> finalThreshold(variants.size());
+        for (size_t v = 0; v < variants.size(); ++v)
+        {
+            settings.fireflyFilter = variants[v].filter;
+            settings.fireflyBiasBudget = variants[v].budget;
+            PathTracer tracer(scene, settings);
+            std::vector<float> image;
+            double seconds = 0.0;
+            for (float checkpoint : checkpoints)
+            {
+                while (seconds < checkpoint)
+                    seconds += tracer.RenderFrame().seconds;
+                Timer resolveTimer;
+                tracer.ResolveHDR(image);
+                seconds += resolveTimer.GetSeconds();
+                rmse[v].push_back(Bench::ComputeRMSE(image, reference));
+            }
+            finalSpp[v] = tracer.GetFrameCount();
+            finalThreshold[v] = tracer.GetClampThreshold();
+        }
+
+        std::printf("%7s", "seconds");
+        for (const Variant& variant : variants)
+            std::printf(" | %10s", variant.name.c_str());
+        std::printf("\n");
+        for (size_t i = 0; i < checkpoints.size(); ++i)
+        {
+            std::printf("%7.1f", checkpoints[i]);
+            for (size_t v = 0; v < variants.size(); ++v)
+                std::printf(" | %10.5f", rmse[v][i]);
+            std::printf("\n");
+        }
+        std::printf("%7s", "spp");
+        for (size_t v = 0; v < variants.size(); ++v)
+            std::printf(" | %10u", finalSpp[v]);
+        std::printf("\n%7s", "clamp");
+        for (size_t v = 0; v < variants.size(); ++v)
+            std::printf(" | %10.3g", finalThreshold[v]);
+        std::printf("\n");
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(firefly, "Equal time RMSE of the plain mean vs a trimmed bucket mean and budgeted clamping under fireflies", RunFirefly);
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Indirect dominated: a white diffuse dragon on the metallic plane of
+    // the default scene, lit by a quad light facing the floor next to it
+    // under an almost black sky. The dragon only sees the light through
+    // the glossy reflection of the floor, which BRDF sampling of its
+    // diffuse surface rarely finds.
+    void LoadGuidingScene(const Bench::BenchmarkArgs& args, Scene& scene)
+    {
+        Material planeMaterial;
+        planeMaterial.baseColor = float3(0.54f, 0.55f, 0.57f);
+        planeMaterial.metallic = 0.9f;
+        planeMaterial.roughness = 0.2f;
+
+        Material dragonMaterial;
+        dragonMaterial.baseColor = float3(0.75f);
+        dragonMaterial.roughness = 1.0f;
+
+        const float4x4 scale = Scaling(0.008f, 0.008f, 0.008f);
+        uint32_t dragon = scene.AddMesh(SceneLoader::LoadModel(args.GetString("root", "") + "Models/stanford-dragon-pbr/model.dae"));
+        scene.AddInstance(dragon, scene.AddMaterial(dragonMaterial), scale);
+        scene.AddInstance(scene.AddMesh(SceneLoader::CreatePlane()), scene.AddMaterial(planeMaterial), float4x4());
+        scene.AddQuadLight(float3(0.9f, 0.35f, -0.15f), float3(0.3f, 0.0f, 0.0f), float3(0.0f, 0.0f, 0.3f), float3(60.0f));
+
+        EnvironmentMap sky;
+        sky.Create(8, 4, std::vector<float>(8 * 4 * 3, 0.01f));
+        scene.SetEnvironment(std::move(sky));
+        scene.Build();
+    }
+
+    int RunGuiding(const Bench::BenchmarkArgs& args)
+    {
+        Timer timer;
+        Scene scene;
+        LoadGuidingScene(args, scene);
+        std::printf("Scene loaded and built in %.1f ms\n", timer.GetMilliseconds());
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 128);
+        settings.height = args.GetInt("height", 72);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.nextEventEstimation = args.GetInt("nee", 1) != 0;
+        settings.guidingTrainingIterations = args.GetInt("iterations", settings.guidingTrainingIterations);
+        settings.guidingSpatialThreshold = args.GetFloat("threshold", settings.guidingSpatialThreshold);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 2048));
+        const float maxSeconds = args.GetFloat("seconds", 8.0f);
+
+        // Guided as well, it converges much faster here and is unbiased;
+        // the frames after training start far past the compared ones
+        timer.Reset();
+        std::vector<float> reference;
+        {
+            PathTracerSettings referenceSettings = settings;
+            referenceSettings.pathGuiding = true;
+            PathTracer tracer(scene, referenceSettings);
+            tracer.Reset(1u << 20);
+            while (tracer.IsGuidingTraining())
+                tracer.RenderFrame();
+            for (uint32_t i = 0; i < referenceSpp; ++i)
+                tracer.RenderFrame();
+            tracer.ResolveHDR(reference);
+        }
+        std::printf("%ux%u, NEE %s, reference %u guided spp rendered in %.1f s\n\n", settings.width, settings.height,
+            settings.nextEventEstimation ? "on" : "off", referenceSpp, timer.GetSeconds());
+
+        // Equal render time, training included: the guided image restarts
+        // after every training iteration, spp is that of the current image
+        std::printf("%7s | %6s %10s | %6s %11s %7s | %7s\n", "seconds", "spp", "BRDF RMSE", "spp", "guided RMSE", "leaves", "speedup");
+        std::vector<float> checkpoints;
+        for (float seconds = 0.5f; seconds <= maxSeconds * 1.001f; seconds *= 2.0f)
+            checkpoints.push_back(seconds);
+
+        std::vector<double> rmse[2];
+        std::vector<uint32_t> spp[2];
+        std::vector<size_t> leaves;
+        for (int guided = 0; guided < 2; ++guided)
+        {
+            settings.pathGuiding = guided != 0;
+            PathTracer tracer(scene, settings);
+            std::vector<float> image;
+            double seconds = 0.0;
+            for (float checkpoint : checkpoints)
+            {
+                while (seconds < checkpoint)
+                    seconds += tracer.RenderFrame().seconds;
+                tracer.ResolveHDR(image);
+                rmse[guided].push_back(Bench::ComputeRMSE(image, reference));
+                spp[guided].push_back(uint32_t(tracer.GetAccumulation()[0].w));
+                if (tracer.GetGuidingTree())
+                    leaves.push_back(tracer.GetGuidingTree()->GetLeafCount());
+            }
+        }
+
+        // Speedup: how much longer BRDF sampling alone needs for the same
+        // error, assuming RMSE falls with 1 / sqrt(time)
+        for (size_t i = 0; i < checkpoints.size(); ++i)
+        {
+            double ratio = rmse[0][i] / rmse[1][i];
+            std::printf("%7.1f | %6u %10.5f | %6u %11.5f %7zu | %6.2fx\n", checkpoints[i], spp[0][i], rmse[0][i],
+                spp[1][i], rmse[1][i], leaves[i], ratio * ratio);
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(guiding, "Equal time RMSE of BRDF sampling vs SD-tree path guiding on an indirectly lit dragon", RunGuiding);
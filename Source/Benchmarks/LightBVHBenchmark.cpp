@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+#include "CPU/Sampling.h"
+
+using namespace CPU;
+
+namespace
+{
+    // count small one sided emitters scattered over the space above the plane,
+    // facing random directions. The total power stays the same whatever the
+    // count, so the images of all counts are about as bright.
+    uint32_t AddEmitters(Scene& scene, uint32_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> px(-2.5f, 2.5f), py(0.05f, 1.5f), pz(-2.5f, 2.5f), u(0.0f, 1.0f);
+        const float size = 0.02f;
+
+        Mesh mesh;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            float3 center(px(rng), py(rng), pz(rng));
+            float3 n = sphereSample(float2(u(rng), u(rng)));
+            float3 t = normalize(cross(std::fabs(n.x) > 0.9f ? float3(0.0f, 1.0f, 0.0f) : float3(1.0f, 0.0f, 0.0f), n));
+            float3 b = cross(n, t);
+            float3 corners[3] = {
+                center + t * size,
+                center + (b * 0.866f - t * 0.5f) * size,
+                center - (b * 0.866f + t * 0.5f) * size,
+            };
+            for (const float3& p : corners)
+            {
+                mesh.positions.push_back(p);
+                mesh.normals.push_back(n);
+                mesh.indices.push_back(static_cast<uint32_t>(mesh.indices.size()));
+            }
+        }
+
+        const float triangleArea = 0.75f * std::sqrt(3.0f) * size * size;
+        Material material;
+        material.type = MaterialType::Light;
+        material.emission = float3(1.0f, 0.85f, 0.7f) * (400.0f / (PI * triangleArea * float(count)));
+        return scene.AddInstance(scene.AddMesh(std::move(mesh)), scene.AddMaterial(material), float4x4());
+    }
+
+    // Renders frames until the time budget is used up
+    uint32_t RenderForTime(PathTracer& tracer, double budget, double& seconds)
+    {
+        seconds = 0.0;
+        uint32_t frames = 0;
+        do
+        {
+            seconds += tracer.RenderFrame().seconds;
+            ++frames;
+        } while (seconds < budget);
+        return frames;
+    }
+
+    // The selection probabilities never sum to more than one (less when a
+    // subtree turns out not to reach the receiver) and SelectionPmf must
+    // give what Select returned, MIS depends on it
+    bool ValidatePmf(const LightList& lights, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> p(-3.0f, 3.0f), u(0.0f, 1.0f);
+        for (uint32_t it = 0; it < 64; ++it)
+        {
+            float3 position(p(rng), std::fabs(p(rng)), p(rng));
+            float3 normal = sphereSample(float2(u(rng), u(rng)));
+            double sum = 0.0;
+            for (uint32_t i = 0; i < lights.GetCount(); ++i)
+                sum += lights.SelectionPmf(LightSelection::BVH, position, normal, i);
+
+            float pmf;
+            uint32_t index = lights.Select(LightSelection::BVH, position, normal, u(rng), pmf);
+            float expected = index == kInvalidIndex ? 0.0f : lights.SelectionPmf(LightSelection::BVH, position, normal, index);
+            if (sum > 1.0 + 1e-4 || std::fabs(pmf - expected) > 1e-6f * std::max(1.0f, expected))
+            {
+                std::printf("FAILED: light BVH pmf sum %g, selected pmf %g vs %g\n", sum, pmf, expected);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int RunLightBVH(const Bench::BenchmarkArgs& args)
+    {
+        std::vector<uint32_t> counts;
+        std::stringstream list(args.GetString("counts", "1,16,256,4096"));
+        for (std::string item; std::getline(list, item, ',');)
+            counts.push_back(static_cast<uint32_t>(std::stoul(item)));
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 96);
+        settings.height = args.GetInt("height", 54);
+        settings.threadCount = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+        settings.nextEventEstimation = true;
+        const double budget = args.GetFloat("budget", 1.0f);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 512));
+
+        std::printf("%ux%u, %.2f s per estimator, reference %u spp with the light BVH\n", settings.width, settings.height,
+            budget, referenceSpp);
+        std::printf("%7s | %8s %8s %8s | %6s %10s | %6s %10s | %9s\n", "lights", "nodes", "build", "refit",
+            "spp", "power RMSE", "spp", "BVH RMSE", "MSE ratio");
+
+        for (uint32_t count : counts)
+        {
+            std::mt19937 rng(count);
+            Scene scene;
+            Bench::LoadDiffuseBenchmarkScene(args, scene);
+            uint32_t emitters = AddEmitters(scene, count, rng);
+            scene.Build();
+            if (!ValidatePmf(scene.GetLights(), rng))
+                return 1;
+
+            // Full build against a refit after the emitters moved
+            Timer timer;
+            LightBVH bvh;
+            bvh.Build(scene.GetLights().GetLights());
+            double buildMs = timer.GetMilliseconds();
+
+            scene.SetInstanceTransform(emitters, Translation(0.1f, 0.0f, 0.0f));
+            scene.Build();
+            timer.Reset();
+            bvh.Refit(scene.GetLights().GetLights());
+            double refitMs = timer.GetMilliseconds();
+            if (!ValidatePmf(scene.GetLights(), rng))
+                return 1;
+
+            // Reference from frames disjoint from the measured ones
+            settings.lightSelection = LightSelection::BVH;
+            std::vector<float> reference;
+            {
+                PathTracer tracer(scene, settings);
+                tracer.Reset(1 << 16);
+                for (uint32_t i = 0; i < referenceSpp; ++i)
+                    tracer.RenderFrame();
+                tracer.ResolveHDR(reference);
+            }
+
+            double rmse[2];
+            uint32_t spp[2];
+            for (LightSelection selection : { LightSelection::Power, LightSelection::BVH })
+            {
+                settings.lightSelection = selection;
+                PathTracer tracer(scene, settings);
+                double seconds;
+                uint32_t s = static_cast<uint32_t>(selection);
+                spp[s] = RenderForTime(tracer, budget, seconds);
+
+                std::vector<float> image;
+                tracer.ResolveHDR(image);
+                rmse[s] = Bench::ComputeRMSE(image, reference);
+            }
+
+            std::printf("%7u | %8zu %6.2fms %6.2fms | %6u %10.5f | %6u %10.5f | %8.2fx\n", scene.GetLights().GetCount(),
+                scene.GetLights().GetBVH().GetNodeCount(), buildMs, refitMs, spp[0], rmse[0], spp[1], rmse[1],
+                (rmse[0] * rmse[0]) / (rmse[1] * rmse[1]));
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(lightbvh, "Noise vs light count at equal time, power vs light BVH selection", RunLightBVH);
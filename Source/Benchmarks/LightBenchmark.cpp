@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct EstimatorResult
+    {
+        std::vector<float> image;
+        double seconds = 0.0;
+        uint64_t rays = 0;
+    };
+
+    EstimatorResult Render(const Scene& scene, const PathTracerSettings& settings, uint32_t spp, uint32_t firstFrameIndex = 0)
+    {
+        PathTracer tracer(scene, settings);
+        tracer.Reset(firstFrameIndex);
+
+        EstimatorResult result;
+        for (uint32_t i = 0; i < spp; ++i)
+        {
+            RenderStats stats = tracer.RenderFrame();
+            result.seconds += stats.seconds;
+            result.rays += stats.rays;
+        }
+        tracer.ResolveHDR(result.image);
+        return result;
+    }
+
+    double MeanValue(const std::vector<float>& image)
+    {
+        double sum = 0.0;
+        for (float v : image)
+            sum += v;
+        return sum / double(image.size());
+    }
+
+    int RunLights(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+        SceneLoader::AddDefaultLights(scene);
+        std::printf("%u lights\n", scene.GetLights().GetCount());
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 96);
+        settings.height = args.GetInt("height", 54);
+        settings.threadCount = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+        const uint32_t spp = std::max(1, args.GetInt("spp", 64));
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 2048));
+
+        // Reference with light sampling, frames disjoint from the measured ones
+        settings.nextEventEstimation = true;
+        EstimatorResult reference = Render(scene, settings, referenceSpp, spp);
+
+        std::printf("%ux%u, %u spp, reference %u spp\n", settings.width, settings.height, spp, referenceSpp);
+        std::printf("%-10s | %9s %9s %10s %12s %14s\n", "estimator", "ms/frame", "rays/px", "mean", "RMSE", "1/(MSE*time)");
+
+        double baseline = 0.0;
+        EstimatorResult nee;
+        for (bool useNee : { false, true })
+        {
+            settings.nextEventEstimation = useNee;
+            EstimatorResult result = Render(scene, settings, spp);
+            double rmse = Bench::ComputeRMSE(result.image, reference.image);
+            double efficiency = 1.0 / (rmse * rmse * result.seconds);
+            if (baseline == 0.0)
+                baseline = efficiency;
+
+            std::printf("%-10s | %9.2f %9.2f %10.5f %12.6f %13.2fx\n", useNee ? "NEE + MIS" : "BRDF only",
+                result.seconds * 1000.0 / spp, double(result.rays) / (double(settings.width) * settings.height * spp),
+                MeanValue(result.image), rmse, efficiency / baseline);
+            if (useNee)
+                nee = std::move(result);
+        }
+        std::printf("%-10s | %9s %9s %10.5f\n", "reference", "", "", MeanValue(reference.image));
+
+        // The wavefront shadow ray queue must give the same image, up to
+        // rounding (relative, emitters seen directly are ~40)
+        settings.nextEventEstimation = true;
+        settings.mode = PathTracerMode::Wavefront;
+        settings.shadingWidth = SimdWidth::Scalar;
+        EstimatorResult wavefront = Render(scene, settings, spp);
+        float maxDifference = 0.0f;
+        for (size_t i = 0; i < nee.image.size(); ++i)
+            maxDifference = std::max(maxDifference, std::fabs(nee.image[i] - wavefront.image[i]) / std::max(1.0f, nee.image[i]));
+        std::printf("max wavefront difference: %g\n", maxDifference);
+        if (maxDifference > 1e-4f)
+        {
+            std::printf("FAILED: wavefront light sampling differs from depth-first\n");
+            return 1;
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(lights, "Next event estimation with MIS vs BRDF sampling only, equal spp", RunLights);
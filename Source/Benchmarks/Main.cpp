@@ -0,0 +1,50 @@
+#include <cstring>
+#include <exception>
+#include "Benchmarks/Benchmark.h"
+
+using namespace Bench;
+
+static void PrintUsage()
+{
+    std::printf("Usage: D3DRTBench <benchmark|all> [--option=value ...]\n\nBenchmarks:\n");
+    for (const BenchmarkInfo& info : GetBenchmarks())
+        std::printf("  %-20s %s\n", info.name, info.description);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    BenchmarkArgs args(argc - 2, argv + 2);
+    int result = 0;
+    bool found = false;
+
+    try
+    {
+        for (const BenchmarkInfo& info : GetBenchmarks())
+        {
+            if (std::strcmp(argv[1], "all") != 0 && std::strcmp(argv[1], info.name) != 0)
+                continue;
+
+            found = true;
+            std::printf("== %s ==\n", info.name);
+            result |= info.function(args);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+
+    if (!found)
+    {
+        PrintUsage();
+        return 1;
+    }
+    return result;
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/MipGenerator.h"
+#include "CPU/TexturePipeline.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct MipMap
+    {
+        const char* name;
+        TextureLayout layout;
+        MipContent content;
+    };
+
+    const MipMap kMaps[] = {
+        { "albedo", TextureLayout::RGBA8, MipContent::SRGB },
+        { "roughness", TextureLayout::R8, MipContent::Linear },
+    };
+
+    double Median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    // Level 1 of an sRGB map averaged in sRGB space, what a plain 2x2 box
+    // over the 8-bit texels gives
+    std::vector<uint8_t> NaiveLevel(const uint8_t* texels, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> level(size_t(width / 2) * (height / 2) * 4);
+        for (uint32_t y = 0; y < height / 2; ++y)
+        {
+            for (uint32_t x = 0; x < width / 2; ++x)
+            {
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    const uint8_t* t = texels + ((size_t(y) * 2 * width) + x * 2) * 4 + c;
+                    const size_t row = size_t(width) * 4;
+                    level[(size_t(y) * (width / 2) + x) * 4 + c] = uint8_t((t[0] + t[4] + t[row] + t[row + 4] + 2) / 4);
+                }
+            }
+        }
+        return level;
+    }
+
+    int RunMips(const Bench::BenchmarkArgs& args)
+    {
+        const std::string root = args.GetString("root", "");
+        const int repeats = args.GetInt("repeats", 3);
+        TexturePipeline pipeline;
+        std::vector<uint32_t> handles;
+        for (const MipMap& map : kMaps)
+            handles.push_back(pipeline.Add(root + "Models/stanford-dragon-pbr/textures/DefaultMaterial_" + map.name + ".jpg", map.layout,
+                map.content == MipContent::SRGB));
+        pipeline.Load();
+
+        std::vector<uint32_t> threadCounts = { 1 };
+        const uint32_t maxThreadCount = args.GetInt("threads", int(std::thread::hardware_concurrency()));
+        if (maxThreadCount > 1)
+            threadCounts.push_back(maxThreadCount);
+
+        std::printf("%-10s | %-11s | %-6s | %7s | %6s | %8s | %8s\n", "map", "size", "filter", "threads", "levels", "ms", "MB/s");
+        for (size_t i = 0; i < handles.size(); ++i)
+        {
+            const DecodedTexture& texture = pipeline.GetTexture(handles[i]);
+            for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+            {
+                for (uint32_t threadCount : threadCounts)
+                {
+                    MipGeneratorSettings settings;
+                    settings.filter = filter;
+                    settings.threadCount = threadCount;
+                    MipGenerator generator(settings);
+                    std::vector<TextureMip> mips;
+                    std::vector<double> times;
+                    for (int r = 0; r < repeats; ++r)
+                    {
+                        Timer timer;
+                        generator.Generate(texture.texels.get(), texture.width, texture.height, texture.layout, kMaps[i].content, mips);
+                        times.push_back(timer.GetSeconds());
+                    }
+                    const double seconds = Median(times);
+                    char size[16];
+                    std::snprintf(size, sizeof(size), "%ux%u", texture.width, texture.height);
+                    std::printf("%-10s | %-11s | %-6s | %7u | %6zu | %8.1f | %8.1f\n", kMaps[i].name, size, ToString(filter),
+                        generator.GetSettings().threadCount, mips.size() + 1, seconds * 1000.0, texture.GetByteSize() * 1e-6 / seconds);
+                }
+            }
+        }
+
+        // A crop that is not a power of two: 1000x600 halves to 500x300,
+        // 250x150, 125x75, 62x37, ... so every odd level is reduced by a
+        // little more than two
+        const DecodedTexture& albedo = pipeline.GetTexture(handles[0]);
+        const uint32_t cropWidth = 1000, cropHeight = 600;
+        std::vector<uint8_t> crop(size_t(cropWidth) * cropHeight * 4);
+        for (uint32_t y = 0; y < cropHeight; ++y)
+            std::copy_n(albedo.texels.get() + size_t(y) * albedo.width * 4, cropWidth * 4, crop.data() + size_t(y) * cropWidth * 4);
+        MipGenerator kaiser;
+        std::vector<TextureMip> mips;
+        Timer timer;
+        kaiser.Generate(crop.data(), cropWidth, cropHeight, TextureLayout::RGBA8, MipContent::SRGB, mips);
+        std::printf("\n%ux%u crop: %zu levels in %.2f ms, last levels", cropWidth, cropHeight, mips.size() + 1, timer.GetMilliseconds());
+        for (size_t level = mips.size() - 4; level < mips.size(); ++level)
+            std::printf(" %ux%u", mips[level].width, mips[level].height);
+        std::printf("\n");
+
+        // Gamma: a 0 / 255 checkerboard is half the light, sRGB 188, not 128
+        const uint32_t checkerSize = 64;
+        std::vector<uint8_t> checker(size_t(checkerSize) * checkerSize * 4, 255);
+        for (uint32_t y = 0; y < checkerSize; ++y)
+        {
+            for (uint32_t x = 0; x < checkerSize; ++x)
+            {
+                for (uint32_t c = 0; c < 3; ++c)
+                    checker[(size_t(y) * checkerSize + x) * 4 + c] = ((x ^ y) & 1) ? 255 : 0;
+            }
+        }
+        MipGeneratorSettings boxSettings;
+        boxSettings.filter = MipFilter::Box;
+        MipGenerator box(boxSettings);
+        box.Generate(checker.data(), checkerSize, checkerSize, TextureLayout::RGBA8, MipContent::SRGB, mips);
+        std::printf("Checkerboard level 1: %u linear-light box, %u sRGB-space box\n", mips[0].texels[0],
+            NaiveLevel(checker.data(), checkerSize, checkerSize)[0]);
+
+        // How far the sRGB-space average is from the linear one on the albedo
+        box.Generate(albedo.texels.get(), albedo.width, albedo.height, TextureLayout::RGBA8, MipContent::SRGB, mips);
+        const std::vector<uint8_t> naive = NaiveLevel(albedo.texels.get(), albedo.width, albedo.height);
+        double difference = 0.0;
+        int maxDifference = 0;
+        for (size_t t = 0; t < naive.size(); ++t)
+        {
+            if (t % 4 == 3)
+                continue;
+            const int d = std::abs(int(mips[0].texels[t]) - int(naive[t]));
+            difference += d;
+            maxDifference = std::max(maxDifference, d);
+        }
+        std::printf("Albedo level 1, sRGB-space box vs linear-light box: mean %.3f, max %d codes\n", difference / (naive.size() / 4 * 3),
+            maxDifference);
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(mips, "Box and Kaiser mip chains of the PBR maps, gamma-correct, over the thread pool", RunMips);
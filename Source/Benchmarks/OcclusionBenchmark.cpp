@@ -0,0 +1,106 @@
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/Camera.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Builds the shadow rays PlaneClosestHit traces: one per primary ray that
+    // lands on the plane, from the hit point towards the hard coded light.
+    // Pixels are walked in 8x8 tiles so that consecutive rays are coherent,
+    // the same way a DispatchRays wave groups them.
+    std::vector<Ray> BuildPlaneShadowRays(const Scene& scene, uint32_t width, uint32_t height)
+    {
+        const float3 lightPos(2, 2, -2);
+        const uint32_t tileSize = 8;
+
+        Camera camera;
+        camera.Update(float(width) / float(height));
+
+        std::vector<Ray> shadowRays;
+        for (uint32_t ty = 0; ty < height; ty += tileSize)
+        {
+            for (uint32_t tx = 0; tx < width; tx += tileSize)
+            {
+                for (uint32_t y = ty; y < std::min(ty + tileSize, height); ++y)
+                {
+                    for (uint32_t x = tx; x < std::min(tx + tileSize, width); ++x)
+                    {
+                        Ray ray = camera.GenerateRay(float2(x + 0.5f, y + 0.5f), width, height);
+                        Hit hit;
+                        if (!scene.Intersect(ray, hit) || hit.instanceIndex != DEFAULT_SCENE_PLANE)
+                            continue;
+
+                        float3 worldOrigin = ray.origin + ray.direction * hit.t;
+                        shadowRays.push_back(Ray(worldOrigin, normalize(lightPos - worldOrigin), 0.01f, 100000.0f));
+                    }
+                }
+            }
+        }
+        return shadowRays;
+    }
+
+    template <typename Function>
+    double MeasureRaysPerSecond(const char* name, uint32_t rayCount, int iterations, Function function)
+    {
+        // Warm up caches once before timing
+        function();
+
+        Timer timer;
+        for (int i = 0; i < iterations; ++i)
+            function();
+        double seconds = timer.GetSeconds();
+
+        double raysPerSecond = double(rayCount) * iterations / seconds;
+        std::printf("  %-24s %8.2f Mrays/s  (%.2f ms per pass)\n", name, raysPerSecond * 1e-6, seconds * 1000.0 / iterations);
+        return raysPerSecond;
+    }
+
+    int RunOcclusion(const Bench::BenchmarkArgs& args)
+    {
+        const uint32_t width = args.GetInt("width", 1280);
+        const uint32_t height = args.GetInt("height", 720);
+        const int iterations = args.GetInt("iterations", 10);
+
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        std::vector<Ray> rays = BuildPlaneShadowRays(scene, width, height);
+        const uint32_t rayCount = static_cast<uint32_t>(rays.size());
+        std::printf("Plane shadow workload: %ux%u, %u shadow rays\n", width, height, rayCount);
+
+        std::vector<uint8_t> closest(rayCount), anyHit(rayCount), batched(rayCount);
+
+        double closestRate = MeasureRaysPerSecond("closest-hit", rayCount, iterations, [&]() {
+            for (uint32_t i = 0; i < rayCount; ++i)
+            {
+                Hit hit;
+                closest[i] = scene.Intersect(rays[i], hit) ? 1 : 0;
+            }
+        });
+
+        double anyHitRate = MeasureRaysPerSecond("any-hit", rayCount, iterations, [&]() {
+            for (uint32_t i = 0; i < rayCount; ++i)
+                anyHit[i] = scene.Occluded(rays[i]) ? 1 : 0;
+        });
+
+        double batchedRate = MeasureRaysPerSecond("any-hit batched", rayCount, iterations, [&]() {
+            scene.OccludedBatch(rays.data(), rayCount, batched.data());
+        });
+
+        uint32_t occludedCount = 0, mismatches = 0;
+        for (uint32_t i = 0; i < rayCount; ++i)
+        {
+            occludedCount += closest[i];
+            if (closest[i] != anyHit[i] || closest[i] != batched[i])
+                ++mismatches;
+        }
+
+        std::printf("  occluded: %u / %u, mismatches: %u\n", occludedCount, rayCount, mismatches);
+        std::printf("  speedup vs closest-hit: any-hit %.2fx, batched %.2fx\n", anyHitRate / closestRate, batchedRate / closestRate);
+        return mismatches == 0 ? 0 : 1;
+    }
+}
+
+REGISTER_BENCHMARK(occlusion, "Plane shadow rays: any-hit occlusion vs closest-hit (rays/s)", RunOcclusion);
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    int RunReprojection(const Bench::BenchmarkArgs& args)
+    {
+        // The default scene is mostly glossy metal, whose reflections do not
+        // move with the surface; --scene=diffuse reprojects exactly
+        Scene scene;
+        if (args.GetString("scene", "default") == "diffuse")
+        {
+            Bench::LoadDiffuseBenchmarkScene(args, scene);
+            scene.Build();
+        }
+        else
+            Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 128);
+        settings.height = args.GetInt("height", 72);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.maxHistoryLength = args.GetInt("history", settings.maxHistoryLength);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 256));
+        const uint32_t checkpointInterval = std::max(1, args.GetInt("interval", 8));
+
+        // --path=file replays a recorded path, --save=file writes the one used
+        std::vector<Camera> cameras;
+        const std::string pathFile = args.GetString("path", "");
+        if (!pathFile.empty())
+        {
+            if (!Bench::LoadCameraPath(pathFile, cameras))
+            {
+                std::fprintf(stderr, "Cannot read a camera path from %s\n", pathFile.c_str());
+                return 1;
+            }
+        }
+        else
+            cameras = Bench::CreateOrbitPath(args.GetInt("frames", 32), args.GetFloat("step", 0.5f));
+        if (!args.GetString("save", "").empty())
+            Bench::SaveCameraPath(args.GetString("save", ""), cameras);
+
+        std::printf("%ux%u, %zu cameras, one frame per camera, history clamped to %u frames\n", settings.width, settings.height,
+            cameras.size(), settings.maxHistoryLength);
+        std::printf("RMSE against %u spp at every %u-th camera\n\n", referenceSpp, checkpointInterval);
+
+        // Same cameras, frames and seeds, the accumulation restarted on every
+        // move or reprojected
+        PathTracerSettings reprojectionSettings = settings;
+        reprojectionSettings.temporalReprojection = true;
+        PathTracer restart(scene, settings);
+        PathTracer reprojection(scene, reprojectionSettings);
+        PathTracer reference(scene, settings);
+
+        std::printf("%6s | %11s | %11s %8s %10s | %8s\n", "camera", "restart", "reprojected", "history", "reproject", "gain");
+        std::vector<float> image, referenceImage;
+        double reprojectSeconds = 0.0;
+        for (size_t i = 0; i < cameras.size(); ++i)
+        {
+            restart.SetCamera(cameras[i]);
+            restart.RenderFrame();
+
+            Timer timer;
+            reprojection.SetCamera(cameras[i]);
+            reprojectSeconds += timer.GetSeconds();
+            reprojection.RenderFrame();
+
+            if ((i + 1) % checkpointInterval != 0 && i + 1 != cameras.size())
+                continue;
+
+            reference.SetCamera(cameras[i]);
+            reference.Reset(1u << 20);
+            for (uint32_t s = 0; s < referenceSpp; ++s)
+                reference.RenderFrame();
+            reference.ResolveHDR(referenceImage);
+
+            restart.ResolveHDR(image);
+            double restartRMSE = Bench::ComputeRMSE(image, referenceImage);
+            reprojection.ResolveHDR(image);
+            double reprojectionRMSE = Bench::ComputeRMSE(image, referenceImage);
+
+            // Average samples per pixel, the new one included
+            double history = 0.0;
+            for (const float4& sum : reprojection.GetAccumulation())
+                history += sum.w;
+            history /= double(reprojection.GetAccumulation().size());
+
+            double ratio = restartRMSE / reprojectionRMSE;
+            std::printf("%6zu | %11.5f | %11.5f %8.1f %8.2f ms | %7.2fx\n", i + 1, restartRMSE, reprojectionRMSE, history,
+                reprojectSeconds * 1000.0 / double(i + 1), ratio * ratio);
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(reprojection, "RMSE along a camera path of restarting the accumulation on every move vs temporal reprojection (--path=file)", RunReprojection);
@@ -0,0 +1,117 @@
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct RouletteConfig
+    {
+        const char* name;
+        uint32_t maxDepth;
+        bool russianRoulette;
+    };
+
+    struct ConfigResult
+    {
+        double secondsPerFrame = 0.0;
+        double raysPerPath = 0.0;
+        double variance = 0.0;          // per sample, mean over pixels
+        double mean = 0.0;              // mean pixel luminance
+    };
+
+    inline double Luminance(const float4& c)
+    {
+        return 0.2126 * c.x + 0.7152 * c.y + 0.0722 * c.z;
+    }
+
+    // Per pixel variance of the per frame luminance (Welford), the frame
+    // samples are the differences of the accumulated sums
+    ConfigResult Measure(const Scene& scene, PathTracerSettings settings, uint32_t frames)
+    {
+        PathTracer tracer(scene, settings);
+        const size_t pixelCount = size_t(settings.width) * settings.height;
+        std::vector<double> mean(pixelCount, 0.0), m2(pixelCount, 0.0);
+        std::vector<float4> previous(pixelCount, float4(0.0f));
+
+        ConfigResult result;
+        uint64_t rays = 0, samples = 0;
+        for (uint32_t frame = 0; frame < frames; ++frame)
+        {
+            RenderStats stats = tracer.RenderFrame();
+            result.secondsPerFrame += stats.seconds;
+            rays += stats.rays;
+            samples += stats.samples;
+
+            const std::vector<float4>& accumulation = tracer.GetAccumulation();
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                double sample = Luminance(accumulation[i]) - Luminance(previous[i]);
+                previous[i] = accumulation[i];
+
+                double delta = sample - mean[i];
+                mean[i] += delta / (frame + 1);
+                m2[i] += delta * (sample - mean[i]);
+            }
+        }
+
+        for (size_t i = 0; i < pixelCount; ++i)
+        {
+            result.variance += m2[i] / std::max(1u, frames - 1);
+            result.mean += mean[i];
+        }
+        result.variance /= double(pixelCount);
+        result.mean /= double(pixelCount);
+        result.secondsPerFrame /= frames;
+        result.raysPerPath = double(rays) / double(samples);
+        return result;
+    }
+
+    int RunRoulette(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 160);
+        settings.height = args.GetInt("height", 90);
+        settings.threadCount = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+        settings.rouletteMinBounces = args.GetInt("minbounces", settings.rouletteMinBounces);
+        const uint32_t frames = args.GetInt("frames", 64);
+
+        const RouletteConfig configs[] =
+        {
+            { "depth 4 (GPU)", 4, false },
+            { "depth 4 + RR", 4, true },
+            { "depth 16", 16, false },
+            { "depth 16 + RR", 16, true },
+            { "depth 64 + RR", 64, true },
+        };
+
+        std::printf("%ux%u, %u frames, roulette after %u bounces\n", settings.width, settings.height, frames, settings.rouletteMinBounces);
+        std::printf("%-15s | %9s %10s %12s %12s %14s\n", "config", "ms/frame", "rays/path", "mean lum", "variance", "1/(var*time)");
+
+        double baseline = 0.0;
+        for (const RouletteConfig& config : configs)
+        {
+            settings.maxDepth = config.maxDepth;
+            settings.russianRoulette = config.russianRoulette;
+            ConfigResult result = Measure(scene, settings, frames);
+
+            // Efficiency: inverse of variance x time per sample, relative to
+            // the first (GPU equivalent) configuration
+            double efficiency = 1.0 / (result.variance * result.secondsPerFrame);
+            if (baseline == 0.0)
+                baseline = efficiency;
+
+            std::printf("%-15s | %9.2f %10.2f %12.5f %12.6f %13.2fx\n", config.name, result.secondsPerFrame * 1000.0,
+                result.raysPerPath, result.mean, result.variance, efficiency / baseline);
+        }
+
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(roulette, "Variance per second of Russian roulette vs fixed depth path termination", RunRoulette);
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Comma separated list, e.g. --spp=1,4,16
+    std::vector<float> ParseList(const std::string& list)
+    {
+        std::vector<float> values;
+        for (size_t begin = 0; begin < list.size(); )
+        {
+            size_t end = std::min(list.find(',', begin), list.size());
+            values.push_back(static_cast<float>(std::atof(list.substr(begin, end - begin).c_str())));
+            begin = end + 1;
+        }
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    struct Result
+    {
+        const char* scene;
+        const char* sampler;
+        const char* budget;     // "spp" or "seconds"
+        float target;
+        uint32_t spp;
+        double seconds;
+        double rmse;
+    };
+
+    void PrintResult(const Result& result, FILE* csv)
+    {
+        std::printf("%-10s %-10s %7g %-7s | %6u %9.3f %9.5f\n", result.scene, result.sampler, result.target, result.budget,
+            result.spp, result.seconds, result.rmse);
+        if (csv)
+        {
+            std::fprintf(csv, "%s,%s,%s,%g,%u,%.6f,%.6f\n", result.scene, result.sampler, result.budget, result.target,
+                result.spp, result.seconds, result.rmse);
+        }
+    }
+
+    int RunSamplers(const Bench::BenchmarkArgs& args)
+    {
+        PathTracerSettings settings;
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.width = args.GetInt("width", 96);
+        settings.height = args.GetInt("height", 54);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 2048));
+        const std::vector<float> sppCounts = ParseList(args.GetString("spp", "1,4,16,64"));
+        const std::vector<float> budgets = ParseList(args.GetString("budgets", "0.25,1,4"));
+        const std::string sceneList = args.GetString("scenes", "dragon,armadillo");
+
+        // Machine readable results, one row per measurement
+        FILE* csv = nullptr;
+        const std::string csvPath = args.GetString("csv", "");
+        if (!csvPath.empty())
+        {
+            csv = std::fopen(csvPath.c_str(), "w");
+            if (!csv)
+            {
+                std::fprintf(stderr, "Cannot write %s\n", csvPath.c_str());
+                return 1;
+            }
+            std::fprintf(csv, "scene,sampler,budget,target,spp,seconds,rmse\n");
+        }
+
+        const SamplerType samplers[] = { SamplerType::Random, SamplerType::Sobol, SamplerType::OwenSobol, SamplerType::BlueNoise };
+        const char* samplerNames[] = { "rand_2to1", "sobol+cp", "owen", "bluenoise" };
+        const char* sceneNames[] = { "dragon", "armadillo" };
+
+        std::printf("%ux%u, depth %u, RMSE of the displayed image against %u spp; fixed spp, then fixed render time\n\n",
+            settings.width, settings.height, settings.maxDepth, referenceSpp);
+        for (const char* sceneName : sceneNames)
+        {
+            if (("," + sceneList + ",").find(std::string(",") + sceneName + ",") == std::string::npos)
+                continue;
+
+            Scene scene;
+            if (std::string(sceneName) == "dragon")
+                Bench::LoadDragonBenchmarkScene(args, scene);
+            else
+                Bench::LoadArmadilloBenchmarkScene(args, scene);
+            scene.Build();
+
+            // Owen scrambled frames far past the ones compared below
+            Timer timer;
+            std::vector<float> reference;
+            {
+                PathTracerSettings referenceSettings = settings;
+                referenceSettings.sampler = SamplerType::OwenSobol;
+                PathTracer tracer(scene, referenceSettings);
+                tracer.Reset(1u << 20);
+                for (uint32_t i = 0; i < referenceSpp; ++i)
+                    tracer.RenderFrame();
+                tracer.ResolveHDR(reference);
+            }
+            std::printf("%s: reference rendered in %.1f s\n", sceneName, timer.GetSeconds());
+            std::printf("%-10s %-10s %15s | %6s %9s %9s\n", "scene", "sampler", "budget", "spp", "seconds", "RMSE");
+
+            for (int s = 0; s < 4; ++s)
+            {
+                settings.sampler = samplers[s];
+                PathTracer tracer(scene, settings);
+                std::vector<float> image;
+
+                // Only RenderFrame is timed, not the resolves
+                tracer.Reset();
+                uint32_t frames = 0;
+                double seconds = 0.0;
+                for (float target : sppCounts)
+                {
+                    for (; frames < uint32_t(target); ++frames)
+                    {
+                        Timer frameTimer;
+                        tracer.RenderFrame();
+                        seconds += frameTimer.GetSeconds();
+                    }
+                    tracer.ResolveHDR(image);
+                    PrintResult({ sceneName, samplerNames[s], "spp", target, frames, seconds, Bench::ComputeRMSE(image, reference) }, csv);
+                }
+
+                tracer.Reset();
+                frames = 0;
+                seconds = 0.0;
+                for (float target : budgets)
+                {
+                    while (seconds < target)
+                    {
+                        Timer frameTimer;
+                        tracer.RenderFrame();
+                        seconds += frameTimer.GetSeconds();
+                        ++frames;
+                    }
+                    tracer.ResolveHDR(image);
+                    PrintResult({ sceneName, samplerNames[s], "seconds", target, frames, seconds, Bench::ComputeRMSE(image, reference) }, csv);
+                }
+            }
+            std::printf("\n");
+        }
+
+        if (csv)
+        {
+            std::fclose(csv);
+            std::printf("Wrote %s\n", csvPath.c_str());
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(samplers, "RMSE at fixed spp and fixed render time of rand_2to1, Sobol + Cranley-Patterson, Owen and blue noise sampling (--csv=file)", RunSamplers);
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct FrameResult
+    {
+        double seconds;
+        double imbalance;       // slowest thread busy time / average busy time
+        uint32_t stolen;
+    };
+
+    FrameResult RenderFrames(const Scene& scene, PathTracerSettings settings, uint32_t frames)
+    {
+        PathTracer tracer(scene, settings);
+        tracer.RenderFrame();   // warm up caches
+
+        FrameResult result = { 0.0, 0.0, 0 };
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            result.seconds += tracer.RenderFrame().seconds;
+
+            double maxBusy = 0.0, sumBusy = 0.0;
+            for (const TileScheduler::ThreadStats& stats : tracer.GetScheduler().GetThreadStats())
+            {
+                maxBusy = std::max(maxBusy, stats.busySeconds);
+                sumBusy += stats.busySeconds;
+                result.stolen += stats.stolen;
+            }
+            uint32_t threads = tracer.GetScheduler().GetThreadCount();
+            result.imbalance += sumBusy > 0.0 ? maxBusy / (sumBusy / threads) : 1.0;
+        }
+        result.seconds /= frames;
+        result.imbalance /= frames;
+        return result;
+    }
+
+    const char* ToString(TileOrder order)
+    {
+        switch (order)
+        {
+        case TileOrder::Morton: return "morton";
+        case TileOrder::Hilbert: return "hilbert";
+        default: return "scanline";
+        }
+    }
+
+    int RunScheduler(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 640);
+        settings.height = args.GetInt("height", 360);
+        settings.tileSize = args.GetInt("tile", 16);
+        const uint32_t frames = args.GetInt("frames", 4);
+        const uint32_t maxThreads = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+
+        std::printf("%ux%u, tile %u, %u frames per measurement\n", settings.width, settings.height, settings.tileSize, frames);
+        std::printf("threads |  static ms  speedup  imbalance |  stealing ms  speedup  imbalance  stolen/frame\n");
+
+        double baseline = 0.0;
+        std::vector<uint32_t> threadCounts;
+        for (uint32_t t = 1; t < maxThreads; t *= 2)
+            threadCounts.push_back(t);
+        threadCounts.push_back(maxThreads);
+
+        for (uint32_t threads : threadCounts)
+        {
+            settings.threadCount = threads;
+
+            settings.workStealing = false;
+            FrameResult fixed = RenderFrames(scene, settings, frames);
+            settings.workStealing = true;
+            FrameResult stealing = RenderFrames(scene, settings, frames);
+
+            if (threads == 1)
+                baseline = fixed.seconds;
+
+            std::printf("%7u | %10.1f %8.2f %10.2f | %12.1f %8.2f %10.2f %13u\n", threads,
+                fixed.seconds * 1000.0, baseline / fixed.seconds, fixed.imbalance,
+                stealing.seconds * 1000.0, baseline / stealing.seconds, stealing.imbalance, stealing.stolen / frames);
+        }
+
+        // Tile order only matters for locality, compare at full thread count
+        settings.threadCount = maxThreads;
+        settings.workStealing = true;
+        for (TileOrder order : { TileOrder::Scanline, TileOrder::Morton, TileOrder::Hilbert })
+        {
+            settings.tileOrder = order;
+            FrameResult result = RenderFrames(scene, settings, frames);
+            std::printf("order %-8s: %.1f ms per frame\n", ToString(order), result.seconds * 1000.0);
+        }
+
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(scheduler, "CPU path tracer scaling over 1..N threads, static split vs work stealing", RunScheduler);
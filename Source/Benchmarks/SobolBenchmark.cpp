@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/Sampling.h"
+#include "CPU/Timer.h"
+
+using namespace CPU;
+
+namespace
+{
+    const double kPi = 3.14159265358979323846;
+
+    // Whether the first 2^m values of a dimension fall one in each interval
+    // of length 2^-m, i.e. it is a (0, 1) sequence up to 2^m points
+    template<typename Value>
+    bool IsStratified(uint32_t m, Value value)
+    {
+        std::vector<bool> seen(size_t(1) << m, false);
+        for (uint32_t i = 0; i < (1u << m); ++i)
+        {
+            uint32_t cell = std::min(uint32_t(value(i) * double(1u << m)), (1u << m) - 1);
+            if (seen[cell])
+                return false;
+            seen[cell] = true;
+        }
+        return true;
+    }
+
+    // Whether the first 2^m points have 2^t points in every elementary
+    // interval of area 2^(t - m), the (t, m, 2)-net property
+    template<typename Point>
+    bool IsNet(uint32_t m, uint32_t t, Point point)
+    {
+        const uint32_t k = m - t;
+        for (uint32_t a = 0; a <= k; ++a)
+        {
+            std::vector<uint32_t> counts(size_t(1) << k, 0);
+            for (uint32_t i = 0; i < (1u << m); ++i)
+            {
+                float2 p = point(i);
+                uint32_t cx = std::min(uint32_t(p.x * double(1u << a)), (1u << a) - 1);
+                uint32_t cy = std::min(uint32_t(p.y * double(1u << (k - a))), (1u << (k - a)) - 1);
+                if (++counts[(cx << (k - a)) | cy] > (1u << t))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    // Smallest t for which the first 2^m points of dimensions a and b are a
+    // (t, m, 2)-net. Scrambling keeps t; a large t is a poorly stratified
+    // projection that Owen scrambling turns into variance.
+    uint32_t TValue(uint32_t a, uint32_t b, uint32_t m)
+    {
+        uint32_t t = 0;
+        while (t < m && !IsNet(m, t, [&](uint32_t i) { return float2(sobolBits(a, i) / 4294967296.0f, sobolBits(b, i) / 4294967296.0f); }))
+            ++t;
+        return t;
+    }
+
+    struct Integrand
+    {
+        const char* name;
+        double (*f)(double x, double y);
+        double reference;
+    };
+
+    double Gaussian(double x, double y)
+    {
+        return std::exp(-8.0 * ((x - 0.5) * (x - 0.5) + (y - 0.5) * (y - 0.5)));
+    }
+
+    double QuarterDisk(double x, double y)
+    {
+        return x * x + y * y < 0.5625 ? 1.0 : 0.0;
+    }
+
+    const Integrand kIntegrands[] =
+    {
+        { "gaussian", Gaussian, kPi / 8.0 * std::erf(std::sqrt(2.0)) * std::erf(std::sqrt(2.0)) },
+        { "disk", QuarterDisk, kPi * 0.5625 / 4.0 },
+    };
+
+    enum class Method { Random, SobolRotated, OwenSobol };
+    const char* kMethodNames[] = { "random", "sobol+cp", "owen" };
+
+    // Least squares slope of log(rmse) over log(n)
+    double Slope(const std::vector<uint32_t>& counts, const std::vector<double>& rmse)
+    {
+        double sx = 0, sy = 0, sxx = 0, sxy = 0;
+        const double n = double(counts.size());
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            double x = std::log(double(counts[i]));
+            double y = std::log(rmse[i]);
+            sx += x;
+            sy += y;
+            sxx += x * x;
+            sxy += x * y;
+        }
+        return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    }
+
+    int RunSobol(const Bench::BenchmarkArgs& args)
+    {
+        const uint32_t m = std::min(16, std::max(1, args.GetInt("log2points", 10)));
+        const uint32_t trials = std::max(2, args.GetInt("trials", 64));
+        const uint32_t seed = 0x9e3779b9u;
+
+        // Every dimension on its own, without and with scrambling
+        Timer timer;
+        uint32_t failures = 0;
+        for (uint32_t d = 0; d < kSobolMaxDimensions; ++d)
+        {
+            bool plain = IsStratified(m, [&](uint32_t i) { return sobolBits(d, i) / 4294967296.0; });
+            bool owen = IsStratified(m, [&](uint32_t i) { return double(sobolOwen(i, d, seed)); });
+            if (!plain || !owen)
+            {
+                std::printf("FAILED: dimension %u is not stratified over %u points (%s)\n", d, 1u << m, plain ? "owen" : "plain");
+                ++failures;
+            }
+        }
+        std::printf("%u dimensions stratified over %u points, plain and Owen scrambled (%.1fms)\n",
+            kSobolMaxDimensions - failures, 1u << m, timer.GetMilliseconds());
+
+        // The first two dimensions are a (0, 2) sequence; scrambling keeps
+        // every power of two prefix a (0, m, 2)-net
+        for (uint32_t k = 1; k <= m; ++k)
+        {
+            bool plain = IsNet(k, 0, [&](uint32_t i) { return float2(sobolBits(0, i) / 4294967296.0f, sobolBits(1, i) / 4294967296.0f); });
+            bool owen = IsNet(k, 0, [&](uint32_t i) { return float2(sobolOwen(i, 0, seed), sobolOwen(i, 1, seed)); });
+            if (!plain || !owen)
+            {
+                std::printf("FAILED: dimensions 0 and 1 are not a (0, %u, 2)-net (%s)\n", k, plain ? "owen" : "plain");
+                ++failures;
+            }
+        }
+        if (failures)
+            return 1;
+        std::printf("dimensions 0 and 1 are (0, m, 2)-nets for m = 1..%u, plain and Owen scrambled\n", m);
+
+        // Every two-dimensional projection of the dimensions the shaders
+        // read (D3DRTTables sobol --dimensions), the pairs a bounce may draw
+        const uint32_t projected = std::min<uint32_t>(args.GetInt("projections", 64), kSobolMaxDimensions);
+        uint32_t worstT = 0, tSum = 0, pairCount = 0;
+        timer.Reset();
+        for (uint32_t a = 0; a < projected; ++a)
+        {
+            for (uint32_t b = a + 1; b < projected; ++b)
+            {
+                const uint32_t t = TValue(a, b, 12);
+                worstT = std::max(worstT, t);
+                tSum += t;
+                ++pairCount;
+            }
+        }
+        std::printf("t of the first 4096 points over %u pairs of the first %u dimensions: worst %u, mean %.2f (%.1fms)\n\n", pairCount,
+            projected, worstT, double(tSum) / std::max(pairCount, 1u), timer.GetMilliseconds());
+
+        // Integration error over independent trials: a new random shift
+        // (Cranley-Patterson rotation) or a new scramble seed per trial
+        std::vector<uint32_t> counts;
+        for (uint32_t n = 16; n <= 4096; n *= 4)
+            counts.push_back(n);
+        const uint32_t pairs[][2] = { { 0, 1 }, { 6, 7 }, { 100, 101 }, { 1000, 1001 } };
+
+        std::printf("RMSE over %u trials; slope of log(RMSE) over log(N), random is -0.5;\n"
+            "t of the first 4096 points of each pair of dimensions\n", trials);
+        std::printf("%-9s %-10s %4s %-9s", "integrand", "dims", "t", "sampler");
+        for (uint32_t n : counts)
+            std::printf(" %9u", n);
+        std::printf(" %7s\n", "slope");
+
+        for (const Integrand& integrand : kIntegrands)
+        {
+            for (const auto& pair : pairs)
+            {
+                const uint32_t t = TValue(pair[0], pair[1], 12);
+                for (Method method : { Method::Random, Method::SobolRotated, Method::OwenSobol })
+                {
+                    std::vector<double> rmse;
+                    for (uint32_t n : counts)
+                    {
+                        std::mt19937 rng(n * 31 + pair[0]);
+                        std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+                        double squaredError = 0.0;
+                        for (uint32_t trial = 0; trial < trials; ++trial)
+                        {
+                            const float2 shift(uniform(rng), uniform(rng));
+                            const uint32_t scramble = mixBits(trial * 7919 + n);
+                            double sum = 0.0;
+                            for (uint32_t i = 0; i < n; ++i)
+                            {
+                                float2 p;
+                                if (method == Method::Random)
+                                    p = float2(uniform(rng), uniform(rng));
+                                else if (method == Method::SobolRotated)
+                                {
+                                    p = float2(sobolBits(pair[0], i) / 4294967296.0f + shift.x, sobolBits(pair[1], i) / 4294967296.0f + shift.y);
+                                    p = float2(p.x - std::floor(p.x), p.y - std::floor(p.y));
+                                }
+                                else
+                                    p = float2(sobolOwen(i, pair[0], scramble), sobolOwen(i, pair[1], scramble));
+                                sum += integrand.f(p.x, p.y);
+                            }
+                            double error = sum / n - integrand.reference;
+                            squaredError += error * error;
+                        }
+                        rmse.push_back(std::sqrt(squaredError / trials));
+                    }
+
+                    char dims[16];
+                    std::snprintf(dims, sizeof(dims), "%u,%u", pair[0], pair[1]);
+                    std::printf("%-9s %-10s %4u %-9s", integrand.name, dims, t, kMethodNames[int(method)]);
+                    for (double e : rmse)
+                        std::printf(" %9.2e", e);
+                    std::printf(" %7.2f\n", Slope(counts, rmse));
+                }
+            }
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(sobol, "Owen scrambled Sobol: stratification of all 1024 dimensions and convergence against random and Cranley-Patterson", RunSobol);
@@ -0,0 +1,240 @@
+#include <random>
+#include <sstream>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/Camera.h"
+#include "CPU/Scene.h"
+#include "CPU/Timer.h"
+
+using namespace CPU;
+
+namespace
+{
+    // Particle cloud filling the space above the plane of the default scene
+    std::vector<Sphere> CreateParticles(uint32_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> px(-2.0f, 2.0f), py(0.0f, 2.0f), pz(-2.0f, 2.0f);
+        // Keep the volume fraction roughly constant as the count grows
+        float radius = 0.004f * std::cbrt(1000000.0f / float(count));
+        std::uniform_real_distribution<float> pr(0.5f * radius, 1.5f * radius);
+
+        std::vector<Sphere> spheres(count);
+        for (Sphere& s : spheres)
+        {
+            s.center = float3(px(rng), py(rng), pz(rng));
+            s.radius = pr(rng);
+        }
+        return spheres;
+    }
+
+    Ray RandomRay(std::mt19937& rng, float extent)
+    {
+        std::uniform_real_distribution<float> u(-extent, extent);
+        Ray ray;
+        ray.origin = float3(u(rng), u(rng), u(rng));
+        ray.direction = float3(u(rng), u(rng), u(rng));
+        ray.tMin = std::uniform_real_distribution<float>(0.0f, 0.1f)(rng);
+        ray.tMax = 100000.0f;
+        return ray;
+    }
+
+    // Lane by lane comparison of the 8-wide test against the scalar port of
+    // RaySphereIntersectionTest. Rays start inside some spheres so that the
+    // t1 branch is exercised too.
+    uint32_t ValidatePacketTest(std::mt19937& rng, uint32_t iterations)
+    {
+        std::uniform_real_distribution<float> uc(-1.0f, 1.0f), ur(0.05f, 1.0f);
+        uint32_t mismatches = 0;
+
+        for (uint32_t it = 0; it < iterations; ++it)
+        {
+            SpherePacket packet;
+            Sphere spheres[SpherePacket::kWidth];
+            uint32_t used = 1 + it % SpherePacket::kWidth;
+            for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+            {
+                spheres[i].center = float3(uc(rng), uc(rng), uc(rng));
+                spheres[i].radius = ur(rng);
+                packet.centerX[i] = spheres[i].center.x;
+                packet.centerY[i] = spheres[i].center.y;
+                packet.centerZ[i] = spheres[i].center.z;
+                packet.radiusSq[i] = i < used ? spheres[i].radius * spheres[i].radius : -INFINITY;
+            }
+
+            Ray ray = RandomRay(rng, 2.0f);
+            float tMax = std::uniform_real_distribution<float>(0.5f, 4.0f)(rng);
+
+            alignas(32) float t[SpherePacket::kWidth];
+            uint32_t mask = IntersectSpherePacket(packet, ray, tMax, t);
+
+            for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+            {
+                float thit = 0.0f, tFar;
+                bool expected = i < used &&
+                    RaySphereIntersectionTest(ray, spheres[i].center, spheres[i].radius, thit, tFar) && thit <= tMax;
+                bool actual = (mask >> i) & 1;
+
+                // Roots within rounding of tMin / tMax may legitimately flip
+                bool nearEdge = std::fabs(thit - ray.tMin) < 1e-5f || std::fabs(thit - tMax) < 1e-5f;
+                if (expected != actual && !nearEdge)
+                    ++mismatches;
+                else if (expected && actual && std::fabs(t[i] - thit) > 1e-5f * std::max(1.0f, std::fabs(thit)))
+                    ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    // BVH closest hit against brute force over every sphere
+    uint32_t ValidateBVH(std::mt19937& rng, uint32_t sphereCount, uint32_t rayCount)
+    {
+        Scene scene;
+        std::vector<Sphere> spheres = CreateParticles(sphereCount, rng);
+        std::vector<Sphere> reference = spheres;
+        scene.AddSphereInstance(scene.AddSpheres(std::move(spheres)), scene.AddMaterial(Material()), float4x4());
+        scene.Build();
+
+        uint32_t mismatches = 0;
+        for (uint32_t r = 0; r < rayCount; ++r)
+        {
+            Ray ray = RandomRay(rng, 2.0f);
+            ray.direction = normalize(ray.direction);
+
+            float best = INFINITY;
+            for (const Sphere& s : reference)
+            {
+                float thit, tFar;
+                if (RaySphereIntersectionTest(ray, s.center, s.radius, thit, tFar) && thit <= ray.tMax)
+                    best = std::min(best, thit);
+            }
+
+            Hit hit;
+            bool found = scene.Intersect(ray, hit);
+            // Grazing hits are ill conditioned, allow for the different rounding
+            // of the vectorized solver
+            if (found != (best != INFINITY) || (found && std::fabs(hit.t - best) > 1e-3f * std::max(1.0f, best)))
+                ++mismatches;
+            if (found != scene.Occluded(ray))
+                ++mismatches;
+        }
+        return mismatches;
+    }
+
+    int RunSpheres(const Bench::BenchmarkArgs& args)
+    {
+        std::mt19937 rng(1234);
+        int result = 0;
+
+        uint32_t packetMismatches = ValidatePacketTest(rng, 200000);
+        uint32_t bvhMismatches = ValidateBVH(rng, 20000, 2000);
+        std::printf("Validation: packet vs scalar mismatches %u, BVH vs brute force mismatches %u\n", packetMismatches, bvhMismatches);
+        if (packetMismatches || bvhMismatches)
+            result = 1;
+
+        // Raw intersection throughput, one ray against a packet many times
+        {
+            const uint32_t packetCount = 4096;
+            const uint32_t rayCount = 2048;
+            std::vector<SpherePacket> packets(packetCount);
+            std::uniform_real_distribution<float> uc(-1.0f, 1.0f);
+            for (SpherePacket& p : packets)
+            {
+                for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+                {
+                    p.centerX[i] = uc(rng); p.centerY[i] = uc(rng); p.centerZ[i] = uc(rng);
+                    p.radiusSq[i] = 0.01f;
+                }
+            }
+            std::vector<Ray> rays(rayCount);
+            for (Ray& r : rays)
+                r = RandomRay(rng, 2.0f);
+
+            uint32_t hits = 0;
+            Timer timer;
+            for (const Ray& r : rays)
+            {
+                for (const SpherePacket& p : packets)
+                {
+                    alignas(32) float t[SpherePacket::kWidth];
+                    hits += IntersectSpherePacket(p, r, r.tMax, t) != 0;
+                }
+            }
+            double packetSeconds = timer.GetSeconds();
+
+            timer.Reset();
+            for (const Ray& r : rays)
+            {
+                for (const SpherePacket& p : packets)
+                {
+                    for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+                    {
+                        float thit, tFar;
+                        hits += RaySphereIntersectionTest(r, float3(p.centerX[i], p.centerY[i], p.centerZ[i]), 0.1f, thit, tFar);
+                    }
+                }
+            }
+            double scalarSeconds = timer.GetSeconds();
+
+            double tests = double(packetCount) * rayCount * SpherePacket::kWidth;
+            std::printf("Ray-sphere tests: 8-wide %.1f M/s, scalar %.1f M/s (%u)\n",
+                tests / packetSeconds * 1e-6, tests / scalarSeconds * 1e-6, hits & 1);
+        }
+
+        // Particle stress workload: primary rays from the default camera
+        const uint32_t width = args.GetInt("width", 640);
+        const uint32_t height = args.GetInt("height", 360);
+        std::stringstream counts(args.GetString("counts", "100000,1000000,4000000"));
+        std::string item;
+        while (std::getline(counts, item, ','))
+        {
+            uint32_t count = static_cast<uint32_t>(std::stoul(item));
+
+            Scene scene;
+            scene.AddSphereInstance(scene.AddSpheres(CreateParticles(count, rng)), scene.AddMaterial(Material()), float4x4());
+
+            Timer timer;
+            scene.Build();
+            double buildSeconds = timer.GetSeconds();
+
+            Camera camera;
+            camera.Update(float(width) / float(height));
+
+            uint32_t hits = 0, shadowed = 0;
+            timer.Reset();
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    Hit hit;
+                    Ray ray = camera.GenerateRay(float2(x + 0.5f, y + 0.5f), width, height);
+                    if (scene.Intersect(ray, hit))
+                        ++hits;
+                }
+            }
+            double primarySeconds = timer.GetSeconds();
+
+            timer.Reset();
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    Ray ray = camera.GenerateRay(float2(x + 0.5f, y + 0.5f), width, height);
+                    if (scene.Occluded(ray))
+                        ++shadowed;
+                }
+            }
+            double occlusionSeconds = timer.GetSeconds();
+
+            double rays = double(width) * height;
+            std::printf("%9u spheres: build %7.1f ms, %zu nodes, closest-hit %.2f Mrays/s, any-hit %.2f Mrays/s, coverage %.1f%%\n",
+                count, buildSeconds * 1000.0, scene.GetSphereBVH().GetNodeCount(),
+                rays / primarySeconds * 1e-6, rays / occlusionSeconds * 1e-6, 100.0 * hits / rays);
+            if (hits != shadowed)
+                result = 1;
+        }
+
+        return result;
+    }
+}
+
+REGISTER_BENCHMARK(spheres, "Procedural sphere leaves: 8-wide test validation and particle stress (rays/s)", RunSpheres);
@@ -0,0 +1,100 @@
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/TexturePipeline.h"
+#include "stb/stb_image.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct TextureMap
+    {
+        const char* name;
+        TextureLayout layout;
+        bool srgb;
+    };
+
+    const char* const kModels[] = { "stanford-armadillo-pbr", "stanford-bunny-pbr", "stanford-dragon-pbr" };
+    const TextureMap kMaps[] = {
+        { "albedo", TextureLayout::RGBA8, true },
+        { "emissive", TextureLayout::RGBA8, true },
+        { "roughness", TextureLayout::R8, false },
+        { "metallic", TextureLayout::R8, false },
+        { "AO", TextureLayout::R8, false },
+        { "opacity", TextureLayout::R8, false },
+    };
+
+    void PrintStats(const char* name, const TexturePipelineStats& stats, double baselineSeconds)
+    {
+        std::printf("%-18s | %5u / %2u | %8.1f | %9.1f | %9.1f | %8.1f | %8.1f | %7.2fx\n", name, stats.textureCount, stats.requestCount,
+            stats.readSeconds * 1000.0, stats.decodeSeconds * 1000.0, stats.GetDecodeMBps(), stats.totalSeconds * 1000.0,
+            (baselineSeconds - stats.totalSeconds) * 1000.0, baselineSeconds / stats.totalSeconds);
+    }
+
+    int RunTextures(const Bench::BenchmarkArgs& args)
+    {
+        const std::string root = args.GetString("root", "");
+        std::vector<std::string> paths;
+        std::vector<TextureMap> maps;
+        for (const char* model : kModels)
+        {
+            for (const TextureMap& map : kMaps)
+            {
+                paths.push_back(root + "Models/" + model + "/textures/DefaultMaterial_" + map.name + ".jpg");
+                maps.push_back(map);
+            }
+        }
+
+        // What ImportTexture did for the dragon albedo, for every map: a
+        // synchronous stbi_load each
+        Timer timer;
+        uint64_t compressedBytes = 0;
+        uint64_t decodedBytes = 0;
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            int width = 0, height = 0, channels = 0;
+            const int texelSize = int(GetTexelSize(maps[i].layout));
+            stbi_uc* texels = stbi_load(paths[i].c_str(), &width, &height, &channels, texelSize);
+            if (!texels)
+            {
+                std::fprintf(stderr, "Cannot load %s\n", paths[i].c_str());
+                return 1;
+            }
+            stbi_image_free(texels);
+            decodedBytes += uint64_t(width) * height * texelSize;
+            if (FILE* file = std::fopen(paths[i].c_str(), "rb"))
+            {
+                std::fseek(file, 0, SEEK_END);
+                compressedBytes += std::ftell(file);
+                std::fclose(file);
+            }
+        }
+        const double baselineSeconds = timer.GetSeconds();
+        std::printf("%zu maps of %zu materials, %.1f MB of JPEG, %.1f MB decoded\n", paths.size(), std::size(kModels),
+            compressedBytes * 1e-6, decodedBytes * 1e-6);
+        std::printf("Serial stbi_load: %.1f ms, %.1f MB/s\n\n", baselineSeconds * 1000.0, decodedBytes * 1e-6 / baselineSeconds);
+
+        std::printf("%-18s | %10s | %8s | %9s | %9s | %8s | %8s | %8s\n", "pipeline", "decoded", "read ms", "decode ms", "MB/s",
+            "total ms", "saved ms", "speedup");
+        std::vector<uint32_t> threadCounts = { 1 };
+        const uint32_t maxThreadCount = args.GetInt("threads", int(std::thread::hardware_concurrency()));
+        if (maxThreadCount > 1)
+            threadCounts.push_back(maxThreadCount);
+        for (uint32_t threadCount : threadCounts)
+        {
+            TexturePipeline pipeline(threadCount);
+            for (size_t i = 0; i < paths.size(); ++i)
+                pipeline.Add(paths[i], maps[i].layout, maps[i].srgb);
+            pipeline.Load();
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "%u thread%s", pipeline.GetThreadCount(), pipeline.GetThreadCount() > 1 ? "s" : "");
+            PrintStats(name, pipeline.GetStats(), baselineSeconds);
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(textures, "Serial stbi_load of every PBR map vs the shared, parallel TexturePipeline", RunTextures);
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "Benchmarks/Benchmark.h"
+#include "CPU/Timer.h"
+#include "CPU/ToneMapper.h"
+
+using namespace CPU;
+
+namespace
+{
+    uint8_t ReferenceSRGB8(float x)
+    {
+        double c = std::min(std::max(double(x), 0.0), 1.0);
+        double s = c <= 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055;
+        return static_cast<uint8_t>(std::floor(s * 255.0 + 0.5));
+    }
+
+    // Every --stride-th float in [0, 1] through the Clamp curve of every
+    // kernel width, against the double precision encode
+    void CheckEncode(uint32_t stride)
+    {
+        const uint32_t oneBits = 0x3F800000;
+        const uint32_t chunk = 3 * 65536;
+        std::vector<float> values(chunk);
+        std::vector<uint8_t> rgba;
+
+        const SimdWidth widths[] = { SimdWidth::Scalar, SimdWidth::SSE, SimdWidth::AVX2 };
+        for (SimdWidth width : widths)
+        {
+            if (width > GetMaxSimdWidth())
+                continue;
+            ToneMapperSettings settings;
+            settings.simdWidth = width;
+            ToneMapper toneMapper(settings);
+
+            uint64_t tested = 0, mismatches = 0;
+            for (uint64_t start = 0; start <= oneBits; start += uint64_t(chunk) * stride)
+            {
+                uint32_t count = 0;
+                for (uint64_t bits = start; bits <= oneBits && count < chunk; bits += stride)
+                {
+                    uint32_t b = static_cast<uint32_t>(bits);
+                    std::memcpy(&values[count++], &b, sizeof(float));
+                }
+                // Pad to whole pixels with zeros
+                const uint32_t pixels = (count + 2) / 3;
+                std::fill(values.begin() + count, values.begin() + pixels * 3, 0.0f);
+                toneMapper.Apply(values.data(), pixels, 1, rgba);
+                for (uint32_t i = 0; i < count; ++i)
+                    mismatches += rgba[(i / 3) * 4 + i % 3] != ReferenceSRGB8(values[i]);
+                tested += count;
+            }
+            std::printf("  %-7s %llu floats, %llu differ from the double precision encode\n", ToString(width),
+                (unsigned long long)tested, (unsigned long long)mismatches);
+        }
+    }
+
+    int RunToneMap(const Bench::BenchmarkArgs& args)
+    {
+        const uint32_t width = args.GetInt("width", 3840);
+        const uint32_t height = args.GetInt("height", 2160);
+        const int runs = std::max(1, args.GetInt("runs", 5));
+
+        std::printf("sRGB encode, every %d-th float in [0, 1]\n", std::max(1, args.GetInt("stride", 16)));
+        CheckEncode(std::max(1, args.GetInt("stride", 16)));
+
+        // Log-normal radiance around 0.18, a few stops either way like a
+        // rendered frame, with a long bright tail
+        std::vector<float> hdr(size_t(width) * height * 3);
+        std::mt19937 rng(1);
+        std::lognormal_distribution<float> radiance(std::log(0.18f), 1.5f);
+        for (float& value : hdr)
+            value = radiance(rng);
+
+        ToneMapperSettings settings;
+        settings.threadCount = args.GetInt("threads", 0);
+        settings.rowsPerTask = args.GetInt("rows", settings.rowsPerTask);
+        std::vector<uint8_t> rgba;
+        {
+            ToneMapper toneMapper(settings);
+            std::printf("\n%ux%u, %u threads, best of %d\n", width, height, toneMapper.GetSettings().threadCount, runs);
+        }
+        std::printf("%-9s", "curve");
+        const SimdWidth widths[] = { SimdWidth::Scalar, SimdWidth::SSE, SimdWidth::AVX2 };
+        for (SimdWidth simdWidth : widths)
+        {
+            if (simdWidth <= GetMaxSimdWidth())
+                std::printf(" | %8s %8s", ToString(simdWidth), "Mpix/s");
+        }
+        std::printf("\n");
+
+        const ToneCurve curves[] = { ToneCurve::Clamp, ToneCurve::Reinhard, ToneCurve::ACES, ToneCurve::AgX };
+        for (ToneCurve curve : curves)
+        {
+            std::printf("%-9s", ToString(curve));
+            for (SimdWidth simdWidth : widths)
+            {
+                if (simdWidth > GetMaxSimdWidth())
+                    continue;
+                settings.curve = curve;
+                settings.simdWidth = simdWidth;
+                ToneMapper toneMapper(settings);
+                toneMapper.Apply(hdr.data(), width, height, rgba);     // warm up the pages
+
+                double best = INFINITY;
+                for (int run = 0; run < runs; ++run)
+                {
+                    Timer timer;
+                    toneMapper.Apply(hdr.data(), width, height, rgba);
+                    best = std::min(best, timer.GetMilliseconds());
+                }
+                std::printf(" | %5.2f ms %8.0f", best, double(width) * height / (best * 1000.0));
+            }
+            std::printf("\n");
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(tonemap, "Exposure, tone curve and exact sRGB encode of a 4K HDR frame per SIMD width", RunToneMap);
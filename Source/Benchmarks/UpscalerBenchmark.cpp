@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+#include "CPU/TemporalUpscaler.h"
+
+using namespace CPU;
+
+namespace
+{
+    double ComputePSNR(const std::vector<float>& image, const std::vector<float>& reference)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < image.size(); ++i)
+        {
+            double d = double(saturate(image[i])) - double(saturate(reference[i]));
+            sum += d * d;
+        }
+        return 10.0 * std::log10(double(image.size()) / std::max(sum, 1e-20));
+    }
+
+    // One way of producing the output image of every camera: the full
+    // resolution tracer with temporal reprojection, or a lower resolution
+    // one restarted every frame and the TemporalUpscaler
+    struct Variant
+    {
+        std::string name;
+        std::unique_ptr<PathTracer> tracer;
+        std::unique_ptr<TemporalUpscaler> upscaler;
+        uint64_t rays = 0;
+        double traceSeconds = 0.0;
+        double upscaleSeconds = 0.0;
+        std::vector<float> output;          // upscaled frame of the current camera
+        std::vector<double> psnr;
+    };
+
+    int RunUpscaler(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 256);
+        settings.height = args.GetInt("height", 144);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.maxHistoryLength = args.GetInt("history", settings.maxHistoryLength);
+        const uint32_t referenceSpp = std::max(1, args.GetInt("reference", 128));
+        const uint32_t checkpointInterval = std::max(1, args.GetInt("interval", 8));
+
+        // --path=file replays a recorded path, --save=file writes the one used
+        std::vector<Camera> cameras;
+        const std::string pathFile = args.GetString("path", "");
+        if (!pathFile.empty())
+        {
+            if (!Bench::LoadCameraPath(pathFile, cameras))
+            {
+                std::fprintf(stderr, "Cannot read a camera path from %s\n", pathFile.c_str());
+                return 1;
+            }
+        }
+        else
+            cameras = Bench::CreateOrbitPath(args.GetInt("frames", 32), args.GetFloat("step", 0.5f));
+        if (!args.GetString("save", "").empty())
+            Bench::SaveCameraPath(args.GetString("save", ""), cameras);
+
+        std::vector<Variant> variants(1);
+        variants[0].name = "native";
+        PathTracerSettings nativeSettings = settings;
+        nativeSettings.temporalReprojection = true;
+        variants[0].tracer = std::make_unique<PathTracer>(scene, nativeSettings);
+
+        TemporalUpscalerSettings upscalerSettings;
+        upscalerSettings.maxHistoryLength = settings.maxHistoryLength;
+        upscalerSettings.clipGamma = args.GetFloat("gamma", upscalerSettings.clipGamma);
+        const float scales[] = { 0.5f, 0.7f, 1.0f };
+        for (float scale : scales)
+        {
+            Variant variant;
+            char name[32];
+            std::snprintf(name, sizeof(name), "taau %g", scale);
+            variant.name = name;
+            PathTracerSettings lowSettings = settings;
+            lowSettings.width = std::max(1u, static_cast<uint32_t>(std::lround(settings.width * scale)));
+            lowSettings.height = std::max(1u, static_cast<uint32_t>(std::lround(settings.height * scale)));
+            lowSettings.aovs = AOV_Depth;
+            variant.tracer = std::make_unique<PathTracer>(scene, lowSettings);
+            variant.upscaler = std::make_unique<TemporalUpscaler>(settings.width, settings.height, upscalerSettings);
+            variants.push_back(std::move(variant));
+        }
+
+        std::printf("%ux%u output, %zu cameras, one jittered sample per render pixel and camera, history up to %u frames\n",
+            settings.width, settings.height, cameras.size(), settings.maxHistoryLength);
+        std::printf("PSNR in dB against %u jittered spp at every %u-th camera\n\n", referenceSpp, checkpointInterval);
+
+        PathTracer reference(scene, settings);
+        std::vector<float> referenceImage, color, depth;
+        std::vector<uint32_t> checkpoints;
+        for (size_t i = 0; i < cameras.size(); ++i)
+        {
+            const float2 jitter = TemporalUpscaler::GetJitter(static_cast<uint32_t>(i));
+            for (Variant& variant : variants)
+            {
+                Timer timer;
+                variant.tracer->SetCamera(cameras[i]);
+                if (variant.upscaler)
+                    variant.tracer->Reset(static_cast<uint32_t>(i));
+                variant.tracer->SetJitter(jitter);
+                variant.rays += variant.tracer->RenderFrame().rays;
+                variant.traceSeconds += timer.GetSeconds();
+
+                if (!variant.upscaler)
+                    continue;
+                const PathTracerSettings& lowSettings = variant.tracer->GetSettings();
+                variant.tracer->ResolveHDR(color);
+                variant.tracer->GetAOVs().DecodeDepth(depth);
+                Timer upscaleTimer;
+                UpscalerInput input;
+                input.width = lowSettings.width;
+                input.height = lowSettings.height;
+                input.color = color.data();
+                input.depth = depth.data();
+                input.jitter = jitter;
+                input.camera = &cameras[i];
+                input.previousCamera = i > 0 ? &cameras[i - 1] : nullptr;
+                variant.upscaler->Upscale(input, variant.output);
+                variant.upscaleSeconds += upscaleTimer.GetSeconds();
+            }
+
+            if ((i + 1) % checkpointInterval != 0 && i + 1 != cameras.size())
+                continue;
+
+            // Box filtered over the pixel like the jittered variants
+            reference.SetCamera(cameras[i]);
+            reference.Reset(1u << 20);
+            for (uint32_t s = 0; s < referenceSpp; ++s)
+            {
+                reference.SetJitter(TemporalUpscaler::GetJitter(s));
+                reference.RenderFrame();
+            }
+            reference.ResolveHDR(referenceImage);
+
+            checkpoints.push_back(static_cast<uint32_t>(i + 1));
+            for (Variant& variant : variants)
+            {
+                if (!variant.upscaler)
+                    variant.tracer->ResolveHDR(variant.output);
+                variant.psnr.push_back(ComputePSNR(variant.output, referenceImage));
+            }
+        }
+
+        std::printf("%11s", "camera");
+        for (const Variant& variant : variants)
+            std::printf(" | %9s", variant.name.c_str());
+        std::printf("\n");
+        for (size_t c = 0; c < checkpoints.size(); ++c)
+        {
+            std::printf("%11u", checkpoints[c]);
+            for (const Variant& variant : variants)
+                std::printf(" | %9.2f", variant.psnr[c]);
+            std::printf("\n");
+        }
+
+        const double frames = double(cameras.size());
+        const double nativeRays = double(variants[0].rays);
+        std::printf("%11s", "Mrays/frame");
+        for (const Variant& variant : variants)
+            std::printf(" | %9.3f", double(variant.rays) / frames * 1e-6);
+        std::printf("\n%11s", "rays saved");
+        for (const Variant& variant : variants)
+            std::printf(" | %8.1f%%", 100.0 * (1.0 - double(variant.rays) / nativeRays));
+        std::printf("\n%11s", "trace ms");
+        for (const Variant& variant : variants)
+            std::printf(" | %9.2f", variant.traceSeconds * 1000.0 / frames);
+        std::printf("\n%11s", "upscale ms");
+        for (const Variant& variant : variants)
+            std::printf(" | %9.2f", variant.upscaleSeconds * 1000.0 / frames);
+        std::printf("\n");
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(upscaler, "PSNR and rays per frame along a camera path of native resolution vs temporal upscaling from 50-100% (--path=file)", RunUpscaler);
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "Benchmarks/BenchmarkScene.h"
+#include "CPU/PathTracer.h"
+
+using namespace CPU;
+
+namespace
+{
+    struct ModeResult
+    {
+        RenderStats stats;
+        std::vector<float4> accumulation;
+    };
+
+    ModeResult RenderFrames(const Scene& scene, const PathTracerSettings& settings, uint32_t frames)
+    {
+        PathTracer tracer(scene, settings);
+        tracer.RenderFrame();   // warm up caches
+        tracer.Reset();
+
+        ModeResult result;
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            RenderStats frame = tracer.RenderFrame();
+            result.stats.samples += frame.samples;
+            result.stats.rays += frame.rays;
+            result.stats.seconds += frame.seconds;
+        }
+        result.accumulation = tracer.GetAccumulation();
+        return result;
+    }
+
+    void Print(const char* name, const ModeResult& result, uint32_t frames)
+    {
+        const RenderStats& stats = result.stats;
+        std::printf("%-15s %8.1f ms/frame %8.2f Msamples/s %8.2f Mrays/s\n", name,
+            stats.seconds * 1000.0 / frames, stats.samples / stats.seconds * 1e-6, stats.rays / stats.seconds * 1e-6);
+    }
+
+    int RunWavefront(const Bench::BenchmarkArgs& args)
+    {
+        Scene scene;
+        Bench::LoadBenchmarkScene(args, scene);
+
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", 640);
+        settings.height = args.GetInt("height", 360);
+        settings.threadCount = args.GetInt("threads", std::max(1u, std::thread::hardware_concurrency()));
+        settings.tileSize = args.GetInt("tile", settings.tileSize);
+        settings.wavefrontTileSize = args.GetInt("batch", settings.wavefrontTileSize);
+        const uint32_t frames = args.GetInt("frames", 4);
+
+        std::printf("%ux%u, %u threads, %u frames, depth-first tile %u, wavefront batch %ux%u\n", settings.width, settings.height,
+            settings.threadCount, frames, settings.tileSize, settings.wavefrontTileSize, settings.wavefrontTileSize);
+
+        settings.mode = PathTracerMode::DepthFirst;
+        ModeResult depthFirst = RenderFrames(scene, settings, frames);
+        settings.mode = PathTracerMode::Wavefront;
+        settings.shadingWidth = SimdWidth::Scalar;
+        ModeResult wavefront = RenderFrames(scene, settings, frames);
+        settings.shadingWidth = GetMaxSimdWidth();
+        ModeResult wavefrontSimd = RenderFrames(scene, settings, frames);
+
+        Print("depth-first", depthFirst, frames);
+        Print("wavefront", wavefront, frames);
+        Print(settings.shadingWidth == SimdWidth::AVX2 ? "wavefront+avx2" : "wavefront+sse", wavefrontSimd, frames);
+        std::printf("speedup %.2fx, %.2fx with SIMD shading\n", depthFirst.stats.seconds / wavefront.stats.seconds,
+            depthFirst.stats.seconds / wavefrontSimd.stats.seconds);
+
+        // With scalar shading both modes trace the same paths with the same
+        // seeds. The SIMD kernels round differently, which can send a few
+        // paths elsewhere, so they are compared on average.
+        float maxDifference = 0.0f;
+        double simdDifference = 0.0;
+        for (size_t i = 0; i < depthFirst.accumulation.size(); ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                maxDifference = std::max(maxDifference, std::fabs(depthFirst.accumulation[i][c] - wavefront.accumulation[i][c]));
+                if (c < 3)
+                    simdDifference += std::fabs(saturate(depthFirst.accumulation[i][c] / frames) - saturate(wavefrontSimd.accumulation[i][c] / frames));
+            }
+        }
+        simdDifference /= depthFirst.accumulation.size() * 3.0;
+        std::printf("max accumulation difference: %g, mean SIMD pixel difference: %g\n", maxDifference, simdDifference);
+        if (maxDifference > 1e-4f * frames || simdDifference > 1e-3)
+        {
+            std::printf("FAILED: wavefront image differs from depth-first\n");
+            return 1;
+        }
+        return 0;
+    }
+}
+
+REGISTER_BENCHMARK(wavefront, "Wavefront (material sorted stages) vs depth-first CPU path tracing", RunWavefront);
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "CPU/Ray.h"
+
+namespace CPU
+{
+    // First hit outputs, PathTracerSettings::aovs is a combination of these
+    enum AOVFlags : uint32_t
+    {
+        AOV_None = 0,
+        AOV_Albedo = 1 << 0,        // base color, RGBA8 UNORM
+        AOV_Normal = 1 << 1,        // octahedral, 2 x 16 bit SNORM
+        AOV_Depth = 1 << 2,         // hit distance, half float
+        AOV_InstanceID = 1 << 3,    // 16 bit
+        AOV_MaterialID = 1 << 4,    // 16 bit
+        AOV_All = (1 << 5) - 1,
+    };
+
+    // 0xFFFF in the ID buffers: the camera ray missed
+    static const uint16_t kInvalidAOVID = 0xFFFF;
+
+    // What the camera ray of a pixel hit. The defaults are the sky.
+    struct FirstHit
+    {
+        float3 albedo = float3(1.0f);
+        float3 normal = float3(0.0f);
+        float depth = INFINITY;
+        uint32_t instanceIndex = kInvalidIndex;
+        uint32_t materialIndex = kInvalidIndex;
+    };
+
+    //-----------------------------------------------------------------------------
+    // Encodings
+    //-----------------------------------------------------------------------------
+
+    inline uint32_t PackUnorm8(const float3& c)
+    {
+        auto unorm = [](float x) { return static_cast<uint32_t>(saturate(x) * 255.0f + 0.5f); };
+        return unorm(c.x) | unorm(c.y) << 8 | unorm(c.z) << 16 | 0xFF000000u;
+    }
+
+    inline float3 UnpackUnorm8(uint32_t c)
+    {
+        return float3(float(c & 0xFF), float((c >> 8) & 0xFF), float((c >> 16) & 0xFF)) * (1.0f / 255.0f);
+    }
+
+    // Octahedral mapping of a unit vector, the lower hemisphere folded over
+    // the diagonals. Both halves at -32768, which no direction uses, are the
+    // zero normal of the sky.
+    static const uint32_t kZeroOctahedral = 0x80008000u;
+
+    inline uint32_t EncodeOctahedral(const float3& n)
+    {
+        float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+        if (sum == 0.0f)
+            return kZeroOctahedral;
+        float u = n.x / sum;
+        float v = n.y / sum;
+        if (n.z < 0.0f)
+        {
+            float foldedU = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+            float foldedV = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+            u = foldedU;
+            v = foldedV;
+        }
+        auto snorm = [](float x) { return static_cast<uint32_t>(static_cast<int32_t>(std::lround(clamp(x, -1.0f, 1.0f) * 32767.0f)) & 0xFFFF); };
+        return snorm(u) | snorm(v) << 16;
+    }
+
+    inline float3 DecodeOctahedral(uint32_t packed)
+    {
+        if (packed == kZeroOctahedral)
+            return float3(0.0f);
+        float u = float(static_cast<int16_t>(packed & 0xFFFF)) / 32767.0f;
+        float v = float(static_cast<int16_t>(packed >> 16)) / 32767.0f;
+        float3 n(u, v, 1.0f - std::abs(u) - std::abs(v));
+        if (n.z < 0.0f)
+        {
+            n.x = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+            n.y = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+        }
+        return normalize(n);
+    }
+
+    // IEEE half, rounded to nearest even; too large values become infinity
+    inline uint16_t FloatToHalf(float f)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        const uint32_t sign = (bits >> 16) & 0x8000;
+        const uint32_t magnitude = bits & 0x7FFFFFFF;
+
+        if (magnitude >= 0x7F800000)                    // inf, nan
+            return static_cast<uint16_t>(sign | 0x7C00 | (magnitude > 0x7F800000 ? 0x200 : 0));
+        if (magnitude >= 0x477FF000)                    // rounds past 65504
+            return static_cast<uint16_t>(sign | 0x7C00);
+        if (magnitude < 0x38800000)                     // denormal half, in units of 2^-24
+            return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::nearbyint(std::abs(f) * 16777216.0f)));
+        uint32_t half = ((magnitude - 0x38000000) >> 13);
+        const uint32_t rest = magnitude & 0x1FFF;
+        if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+            ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    inline float HalfToFloat(uint16_t h)
+    {
+        const uint32_t sign = uint32_t(h & 0x8000) << 16;
+        const uint32_t exponent = (h >> 10) & 0x1F;
+        const uint32_t mantissa = h & 0x3FF;
+        uint32_t bits;
+        if (exponent == 0)
+        {
+            float value = float(mantissa) * (1.0f / 16777216.0f);
+            return sign ? -value : value;
+        }
+        if (exponent == 31)
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        else
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Buffers
+    //-----------------------------------------------------------------------------
+
+    // One row major buffer per enabled AOV, the others stay empty. 12 bytes
+    // per pixel with all of them.
+    struct AOVBuffers
+    {
+        uint32_t flags = AOV_None;
+        std::vector<uint32_t> albedo;
+        std::vector<uint32_t> normal;
+        std::vector<uint16_t> depth;
+        std::vector<uint16_t> instanceID;
+        std::vector<uint16_t> materialID;
+
+        void Resize(uint32_t aovFlags, size_t pixelCount)
+        {
+            flags = aovFlags;
+            const FirstHit sky;
+            albedo.assign(flags & AOV_Albedo ? pixelCount : 0, PackUnorm8(sky.albedo));
+            normal.assign(flags & AOV_Normal ? pixelCount : 0, kZeroOctahedral);
+            depth.assign(flags & AOV_Depth ? pixelCount : 0, FloatToHalf(sky.depth));
+            instanceID.assign(flags & AOV_InstanceID ? pixelCount : 0, kInvalidAOVID);
+            materialID.assign(flags & AOV_MaterialID ? pixelCount : 0, kInvalidAOVID);
+        }
+
+        void Write(size_t pixel, const FirstHit& hit)
+        {
+            // IDs past 16 bits alias, 0xFFFF is kept for the sky
+            auto id = [](uint32_t index) { return index == kInvalidIndex ? kInvalidAOVID : static_cast<uint16_t>(std::min(index, 0xFFFEu)); };
+            if (flags & AOV_Albedo)
+                albedo[pixel] = PackUnorm8(hit.albedo);
+            if (flags & AOV_Normal)
+                normal[pixel] = EncodeOctahedral(hit.normal);
+            if (flags & AOV_Depth)
+                depth[pixel] = FloatToHalf(hit.depth);
+            if (flags & AOV_InstanceID)
+                instanceID[pixel] = id(hit.instanceIndex);
+            if (flags & AOV_MaterialID)
+                materialID[pixel] = id(hit.materialIndex);
+        }
+
+        // Float copy of the Depth AOV
+        void DecodeDepth(std::vector<float>& depthOut) const
+        {
+            depthOut.resize(depth.size());
+            for (size_t i = 0; i < depth.size(); ++i)
+                depthOut[i] = HalfToFloat(depth[i]);
+        }
+
+        // Float copies of the denoiser guides, Albedo | Normal | Depth must be on
+        void DecodeGuides(std::vector<float3>& albedoOut, std::vector<float3>& normalOut, std::vector<float>& depthOut) const
+        {
+            albedoOut.resize(albedo.size());
+            normalOut.resize(normal.size());
+            for (size_t i = 0; i < albedo.size(); ++i)
+                albedoOut[i] = UnpackUnorm8(albedo[i]);
+            for (size_t i = 0; i < normal.size(); ++i)
+                normalOut[i] = DecodeOctahedral(normal[i]);
+            DecodeDepth(depthOut);
+        }
+    };
+}
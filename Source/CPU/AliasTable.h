@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "CPU/TileScheduler.h"
+#include "CPU/VectorMath.h"
+
+namespace CPU
+{
+    // One column of an alias table: a sample landing in it keeps the column
+    // index if its fraction is below threshold and takes alias otherwise
+    struct AliasEntry
+    {
+        float threshold;
+        uint32_t alias;
+    };
+    static_assert(sizeof(AliasEntry) == 8, "AliasEntry should stay 8 bytes");
+
+    // Vose's alias method: O(n) build, O(1) sampling of a discrete
+    // distribution proportional to weights (any arithmetic type). A sample
+    // is one multiply and one 8-byte load where a CDF needs log2(n)
+    // dependent loads. Large inputs are summed, scaled and classified over
+    // the threads of a TileScheduler; only the pairing of small and large
+    // columns is serial.
+    template <typename Weight>
+    class AliasTable
+    {
+    public:
+        static const size_t kParallelThreshold = 1 << 16;
+
+        // Without a scheduler (or below kParallelThreshold entries) the
+        // table is built on the calling thread. An all zero (or empty)
+        // input leaves the table empty.
+        void Build(const std::vector<Weight>& weights, TileScheduler* scheduler = nullptr);
+
+        // One uniform both picks the column and decides against its
+        // threshold. u only carries 24 bits, tables much above 2^16 entries
+        // should use the two dimensional form.
+        uint32_t Sample(float u) const
+        {
+            const uint32_t count = GetCount();
+            float x = u * float(count);
+            uint32_t i = std::min(static_cast<uint32_t>(x), count - 1);
+            return x - float(i) < m_entries[i].threshold ? i : m_entries[i].alias;
+        }
+
+        // u.x picks the column, u.y decides against its threshold. remapped
+        // is what is left of both, uniform in [0, 1)^2 again, e.g. for the
+        // position within the sampled texel.
+        uint32_t Sample(const float2& u, float2& remapped) const
+        {
+            const uint32_t count = GetCount();
+            float x = u.x * float(count);
+            uint32_t i = std::min(static_cast<uint32_t>(x), count - 1);
+            remapped.x = std::min(x - float(i), kOneMinusEpsilon);
+
+            const AliasEntry& entry = m_entries[i];
+            if (u.y < entry.threshold)
+            {
+                remapped.y = std::min(u.y / entry.threshold, kOneMinusEpsilon);
+                return i;
+            }
+            remapped.y = std::min((u.y - entry.threshold) / (1.0f - entry.threshold), kOneMinusEpsilon);
+            return entry.alias;
+        }
+
+        float Pmf(uint32_t index) const { return m_pmf[index]; }
+
+        bool IsEmpty() const { return m_entries.empty(); }
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_entries.size()); }
+        double GetTotal() const { return m_total; }
+        const std::vector<AliasEntry>& GetEntries() const { return m_entries; }
+
+    private:
+        static constexpr float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+        std::vector<AliasEntry> m_entries;
+        std::vector<float> m_pmf;
+        double m_total = 0.0;
+    };
+
+    template <typename Weight>
+    void AliasTable<Weight>::Build(const std::vector<Weight>& weights, TileScheduler* scheduler)
+    {
+        m_entries.clear();
+        m_pmf.clear();
+        m_total = 0.0;
+        const size_t count = weights.size();
+        if (count == 0)
+            return;
+
+        // One contiguous range of the weights per scheduler thread,
+        // forEachRange(function) calls function(range, first, last) for each
+        const uint32_t rangeCount = scheduler && count >= kParallelThreshold ? scheduler->GetThreadCount() : 1;
+        auto forEachRange = [&](const auto& function) {
+            auto range = [&](uint32_t r, uint32_t) { function(r, count * r / rangeCount, count * (r + 1) / rangeCount); };
+            if (rangeCount > 1)
+                scheduler->Run(rangeCount, range);
+            else
+                range(0, 0);
+        };
+
+        // Total, per range partial sums added in order so the result does
+        // not depend on the thread count more than rounding
+        std::vector<double> partial(rangeCount, 0.0);
+        forEachRange([&](uint32_t t, size_t first, size_t last) {
+            double sum = 0.0;
+            for (size_t i = first; i < last; ++i)
+                sum += double(weights[i]);
+            partial[t] = sum;
+        });
+        for (double sum : partial)
+            m_total += sum;
+        if (!(m_total > 0.0))
+        {
+            m_total = 0.0;
+            return;
+        }
+
+        // Scale to a mean of one and split the columns into those below and
+        // above it, small ones from the front of each range of work
+        // and large ones from the back. Small columns keep their scaled
+        // weight as threshold.
+        m_entries.resize(count);
+        m_pmf.resize(count);
+        std::vector<uint32_t> work(count);
+        std::vector<size_t> smallEnd(rangeCount), largeBegin(rangeCount);
+        const double scale = double(count) / m_total;
+        forEachRange([&](uint32_t t, size_t first, size_t last) {
+            size_t smallNext = first, largeNext = last;
+            for (size_t i = first; i < last; ++i)
+            {
+                double scaled = double(weights[i]) * scale;
+                m_pmf[i] = float(double(weights[i]) / m_total);
+                m_entries[i] = { float(scaled), static_cast<uint32_t>(i) };
+                bool isSmall = scaled < 1.0;
+                work[isSmall ? smallNext : largeNext - 1] = static_cast<uint32_t>(i);
+                smallNext += isSmall;
+                largeNext -= !isSmall;
+            }
+            smallEnd[t] = smallNext;
+            largeBegin[t] = largeNext;
+        });
+
+        // Gather all small columns at the front and the large ones behind
+        // them, nothing to move with one range
+        size_t smallCount = smallEnd[0];
+        if (rangeCount > 1)
+        {
+            std::vector<uint32_t> largeList;
+            for (uint32_t t = 0; t < rangeCount; ++t)
+                largeList.insert(largeList.end(), work.begin() + largeBegin[t], work.begin() + count * (t + 1) / rangeCount);
+            for (uint32_t t = 1; t < rangeCount; ++t)
+            {
+                size_t first = count * t / rangeCount;
+                std::copy(work.begin() + first, work.begin() + smallEnd[t], work.begin() + smallCount);
+                smallCount += smallEnd[t] - first;
+            }
+            std::copy(largeList.begin(), largeList.end(), work.begin() + smallCount);
+        }
+
+        // Each large column tops up small ones until it is small itself. Its
+        // residual is kept in double, it would drift over many small columns
+        // in float. Small columns are a stack at the front of work, which
+        // never grows into the large columns still to do: a large column
+        // only turns small after using up at least one small one.
+        size_t smallTop = smallCount;
+        size_t largeNext = smallCount;
+        while (smallTop > 0 && largeNext < count)
+        {
+            uint32_t l = work[largeNext++];
+            double residual = double(weights[l]) * scale;
+            while (residual >= 1.0 && smallTop > 0)
+            {
+                uint32_t s = work[--smallTop];
+                m_entries[s].alias = l;
+                residual -= 1.0 - double(m_entries[s].threshold);
+            }
+            if (residual < 1.0)
+            {
+                m_entries[l].threshold = float(residual);
+                work[smallTop++] = l;
+            }
+            else
+            {
+                m_entries[l].threshold = 1.0f;
+            }
+        }
+
+        // What is left is one up to rounding
+        for (size_t i = largeNext; i < count; ++i)
+            m_entries[work[i]].threshold = 1.0f;
+        for (size_t i = 0; i < smallTop; ++i)
+            m_entries[work[i]] = { 1.0f, work[i] };
+    }
+}
@@ -0,0 +1,492 @@
+#include "CPU/BVH.h"
+#include <cassert>
+#include <numeric>
+
+namespace CPU
+{
+    namespace
+    {
+        const int kBinCount = 16;
+        // A traversal holds at most one entry per level plus the root
+        const int kStackSize = BVHBuilder::kMaxDepth + 2;
+
+        struct BuildTask
+        {
+            uint32_t node;
+            uint32_t first;
+            uint32_t count;
+            uint32_t depth;
+        };
+
+        // Levels of median splits that take count primitives down to one
+        inline uint32_t CeilLog2(uint32_t count)
+        {
+            uint32_t levels = 0;
+            while ((1ull << levels) < count)
+                ++levels;
+            return levels;
+        }
+
+        struct Bin
+        {
+            AABB bounds;
+            uint32_t count = 0;
+        };
+
+        // Slab test, returns the entry distance or INFINITY on a miss
+        inline float IntersectAABB(const BVHNode& node, const float3& origin, const float3& invDir, float tMin, float tMax)
+        {
+            float tx0 = (node.boundsMin.x - origin.x) * invDir.x;
+            float tx1 = (node.boundsMax.x - origin.x) * invDir.x;
+            float ty0 = (node.boundsMin.y - origin.y) * invDir.y;
+            float ty1 = (node.boundsMax.y - origin.y) * invDir.y;
+            float tz0 = (node.boundsMin.z - origin.z) * invDir.z;
+            float tz1 = (node.boundsMax.z - origin.z) * invDir.z;
+
+            float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), tMin));
+            float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), tMax));
+            return tNear <= tFar ? tNear : INFINITY;
+        }
+
+        // Moller-Trumbore, returns t or INFINITY. u and v are the DXR barycentrics.
+        inline float IntersectTriangle(const BVHTriangle& tri, const float3& origin, const float3& dir, float& u, float& v)
+        {
+            float3 pvec = cross(dir, tri.e2);
+            float det = dot(tri.e1, pvec);
+            if (det == 0.0f)
+                return INFINITY;
+
+            float invDet = 1.0f / det;
+            float3 tvec = origin - tri.v0;
+            u = dot(tvec, pvec) * invDet;
+            if (u < 0.0f || u > 1.0f)
+                return INFINITY;
+
+            float3 qvec = cross(tvec, tri.e1);
+            v = dot(dir, qvec) * invDet;
+            if (v < 0.0f || u + v > 1.0f)
+                return INFINITY;
+
+            return dot(tri.e2, qvec) * invDet;
+        }
+
+        inline float3 SafeInverse(const float3& d)
+        {
+            return float3(1.0f / d.x, 1.0f / d.y, 1.0f / d.z);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // Binned SAH build. Leaves are made when the SAH says so or when the range is
+    // small enough; ranges whose centroids cannot be binned are split at the median.
+    //
+    void BVHBuilder::Build(const std::vector<AABB>& primBounds, uint32_t maxLeafSize,
+        std::vector<BVHNode>& nodes, std::vector<uint32_t>& primOrder, float traversalCost)
+    {
+        const uint32_t primCount = static_cast<uint32_t>(primBounds.size());
+        maxLeafSize = std::max(1u, std::min(maxLeafSize, 255u));
+
+        nodes.clear();
+        primOrder.resize(primCount);
+        std::iota(primOrder.begin(), primOrder.end(), 0u);
+        if (primCount == 0)
+            return;
+
+        std::vector<float3> centroids(primCount);
+        for (uint32_t i = 0; i < primCount; ++i)
+            centroids[i] = primBounds[i].Centroid();
+
+        nodes.reserve(2 * primCount / std::max(1u, maxLeafSize / 2) + 1);
+        nodes.push_back(BVHNode());
+
+        std::vector<BuildTask> stack;
+        stack.push_back({ 0, 0, primCount, 0 });
+
+        while (!stack.empty())
+        {
+            BuildTask task = stack.back();
+            stack.pop_back();
+
+            AABB bounds, centroidBounds;
+            for (uint32_t i = task.first; i < task.first + task.count; ++i)
+            {
+                bounds.Grow(primBounds[primOrder[i]]);
+                centroidBounds.Grow(centroids[primOrder[i]]);
+            }
+
+            BVHNode& node = nodes[task.node];
+            node.boundsMin = bounds.boundsMin;
+            node.boundsMax = bounds.boundsMax;
+            node.leftFirst = task.first;
+            node.primCount = static_cast<uint16_t>(task.count);
+            node.axis = 0;
+            node.flags = 0;
+
+            if (task.count <= 1)
+                continue;
+
+            // Skewed input (geometrically spaced primitives, say) makes SAH
+            // peel off a few primitives per level; past the depth budget only
+            // median splits are left
+            const bool depthLimited = task.depth + CeilLog2(task.count) >= kMaxDepth;
+
+            // Find the cheapest bin boundary over the three axes
+            float bestCost = INFINITY;
+            int bestAxis = -1;
+            int bestSplit = 0;
+            float3 extent = centroidBounds.boundsMax - centroidBounds.boundsMin;
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                // A denormal extent overflows the bin scale, such ranges are
+                // split at the median like coincident centroids
+                float scale = kBinCount / extent[axis];
+                if (extent[axis] <= 0.0f || scale == INFINITY || depthLimited)
+                    continue;
+
+                Bin bins[kBinCount];
+                for (uint32_t i = task.first; i < task.first + task.count; ++i)
+                {
+                    uint32_t prim = primOrder[i];
+                    int b = std::min(kBinCount - 1, static_cast<int>((centroids[prim][axis] - centroidBounds.boundsMin[axis]) * scale));
+                    bins[b].count++;
+                    bins[b].bounds.Grow(primBounds[prim]);
+                }
+
+                float leftArea[kBinCount - 1];
+                uint32_t leftCount[kBinCount - 1];
+                AABB leftBox;
+                uint32_t leftSum = 0;
+                for (int b = 0; b < kBinCount - 1; ++b)
+                {
+                    leftSum += bins[b].count;
+                    leftBox.Grow(bins[b].bounds);
+                    leftCount[b] = leftSum;
+                    leftArea[b] = leftBox.SurfaceArea();
+                }
+
+                AABB rightBox;
+                uint32_t rightSum = 0;
+                for (int b = kBinCount - 1; b > 0; --b)
+                {
+                    rightSum += bins[b].count;
+                    rightBox.Grow(bins[b].bounds);
+                    float cost = leftCount[b - 1] * leftArea[b - 1] + rightSum * rightBox.SurfaceArea();
+                    if (leftCount[b - 1] > 0 && rightSum > 0 && cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = b;
+                    }
+                }
+            }
+
+            float leafCost = task.count * bounds.SurfaceArea();
+            float splitCost = traversalCost * bounds.SurfaceArea() + bestCost;
+            if (task.count <= maxLeafSize && (bestAxis < 0 || splitCost >= leafCost))
+                continue;
+
+            uint32_t mid;
+            int splitAxis = bestAxis;
+            if (bestAxis >= 0)
+            {
+                float scale = kBinCount / extent[bestAxis];
+                float lo = centroidBounds.boundsMin[bestAxis];
+                uint32_t* begin = primOrder.data() + task.first;
+                uint32_t* split = std::partition(begin, begin + task.count, [&](uint32_t prim)
+                    {
+                        int b = std::min(kBinCount - 1, static_cast<int>((centroids[prim][bestAxis] - lo) * scale));
+                        return b < bestSplit;
+                    });
+                mid = static_cast<uint32_t>(split - primOrder.data());
+            }
+            else
+            {
+                // Median along the widest centroid extent. When all centroids
+                // coincide any split is as good as another.
+                splitAxis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+                mid = task.first + task.count / 2;
+                uint32_t* begin = primOrder.data() + task.first;
+                std::nth_element(begin, primOrder.data() + mid, begin + task.count, [&](uint32_t a, uint32_t b)
+                    {
+                        return centroids[a][splitAxis] < centroids[b][splitAxis];
+                    });
+            }
+
+            uint32_t left = static_cast<uint32_t>(nodes.size());
+            nodes.push_back(BVHNode());
+            nodes.push_back(BVHNode());
+
+            BVHNode& parent = nodes[task.node];
+            parent.leftFirst = left;
+            parent.primCount = 0;
+            parent.axis = static_cast<uint8_t>(splitAxis);
+
+            stack.push_back({ left + 1, mid, task.first + task.count - mid, task.depth + 1 });
+            stack.push_back({ left, task.first, mid - task.first, task.depth + 1 });
+        }
+
+        // Children bounds are only known after their task ran, decide the
+        // occlusion order in a final pass
+        for (BVHNode& node : nodes)
+        {
+            if (node.IsLeaf())
+                continue;
+            AABB l, r;
+            l.Grow(nodes[node.leftFirst].boundsMin); l.Grow(nodes[node.leftFirst].boundsMax);
+            r.Grow(nodes[node.leftFirst + 1].boundsMin); r.Grow(nodes[node.leftFirst + 1].boundsMax);
+            if (r.SurfaceArea() > l.SurfaceArea())
+                node.flags |= BVH_FLAG_OCCLUSION_RIGHT_FIRST;
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // Triangle BVH
+    //
+    void TriangleBVH::Build(std::vector<BVHTriangle>&& triangles)
+    {
+        std::vector<AABB> primBounds(triangles.size());
+        m_bounds = AABB();
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            const BVHTriangle& tri = triangles[i];
+            primBounds[i].Grow(tri.v0);
+            primBounds[i].Grow(tri.v0 + tri.e1);
+            primBounds[i].Grow(tri.v0 + tri.e2);
+            m_bounds.Grow(primBounds[i]);
+        }
+
+        std::vector<uint32_t> primOrder;
+        BVHBuilder::Build(primBounds, 4, m_nodes, primOrder);
+
+        // Store triangles in leaf order so a leaf is a contiguous range
+        m_triangles.resize(triangles.size());
+        for (size_t i = 0; i < primOrder.size(); ++i)
+            m_triangles[i] = triangles[primOrder[i]];
+        triangles.clear();
+    }
+
+    bool TriangleBVH::Intersect(const Ray& ray, Hit& hit) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const float3 invDir = SafeInverse(ray.direction);
+        float tMax = ray.tMax;
+        bool found = false;
+
+        const BVHNode* stack[kStackSize];
+        int stackPtr = 0;
+        const BVHNode* node = &m_nodes[0];
+        if (IntersectAABB(*node, ray.origin, invDir, ray.tMin, tMax) == INFINITY)
+            return false;
+
+        while (true)
+        {
+            if (node->IsLeaf())
+            {
+                for (uint32_t i = node->leftFirst; i < node->leftFirst + node->primCount; ++i)
+                {
+                    float u, v;
+                    float t = IntersectTriangle(m_triangles[i], ray.origin, ray.direction, u, v);
+                    if (t >= ray.tMin && t < tMax)
+                    {
+                        tMax = t;
+                        hit.t = t;
+                        hit.bary = float2(u, v);
+                        hit.instanceIndex = m_triangles[i].instanceIndex;
+                        hit.primitiveIndex = m_triangles[i].primitiveIndex;
+                        found = true;
+                    }
+                }
+                if (stackPtr == 0)
+                    break;
+                node = stack[--stackPtr];
+                continue;
+            }
+
+            // Front to back: visit the nearer child, defer the other one
+            const BVHNode* c0 = &m_nodes[node->leftFirst];
+            const BVHNode* c1 = &m_nodes[node->leftFirst + 1];
+            float d0 = IntersectAABB(*c0, ray.origin, invDir, ray.tMin, tMax);
+            float d1 = IntersectAABB(*c1, ray.origin, invDir, ray.tMin, tMax);
+            if (d0 > d1)
+            {
+                std::swap(d0, d1);
+                std::swap(c0, c1);
+            }
+
+            if (d0 == INFINITY)
+            {
+                if (stackPtr == 0)
+                    break;
+                node = stack[--stackPtr];
+            }
+            else
+            {
+                node = c0;
+                if (d1 != INFINITY)
+                {
+                    assert(stackPtr < kStackSize);
+                    stack[stackPtr++] = c1;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    bool TriangleBVH::Occluded(const Ray& ray) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const float3 invDir = SafeInverse(ray.direction);
+
+        const BVHNode* stack[kStackSize];
+        int stackPtr = 0;
+        stack[stackPtr++] = &m_nodes[0];
+
+        while (stackPtr > 0)
+        {
+            const BVHNode* node = stack[--stackPtr];
+            if (IntersectAABB(*node, ray.origin, invDir, ray.tMin, ray.tMax) == INFINITY)
+                continue;
+
+            if (node->IsLeaf())
+            {
+                for (uint32_t i = node->leftFirst; i < node->leftFirst + node->primCount; ++i)
+                {
+                    float u, v;
+                    float t = IntersectTriangle(m_triangles[i], ray.origin, ray.direction, u, v);
+                    if (t >= ray.tMin && t <= ray.tMax)
+                        return true;
+                }
+                continue;
+            }
+
+            // No need for front to back order, the larger child is the more
+            // likely blocker so it is popped first
+            uint32_t first = node->leftFirst;
+            uint32_t second = node->leftFirst + 1;
+            if (node->flags & BVH_FLAG_OCCLUSION_RIGHT_FIRST)
+                std::swap(first, second);
+            assert(stackPtr + 2 <= kStackSize);
+            stack[stackPtr++] = &m_nodes[second];
+            stack[stackPtr++] = &m_nodes[first];
+        }
+
+        return false;
+    }
+
+    void TriangleBVH::OccludedBatch(const Ray* rays, uint32_t count, uint8_t* occluded) const
+    {
+        for (uint32_t first = 0; first < count; first += kPacketSize)
+            OccludedPacket(rays + first, std::min(kPacketSize, count - first), occluded + first);
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // Packet any-hit traversal. Lanes are kept in SoA form so the per node box
+    // test and the per triangle test are plain loops the compiler vectorizes.
+    // A lane that found a blocker gets tMax = -inf and drops out of every test.
+    //
+    void TriangleBVH::OccludedPacket(const Ray* rays, uint32_t count, uint8_t* occluded) const
+    {
+        const uint32_t N = kPacketSize;
+
+        alignas(32) float ox[N], oy[N], oz[N];
+        alignas(32) float dx[N], dy[N], dz[N];
+        alignas(32) float ix[N], iy[N], iz[N];
+        alignas(32) float tMin[N], tMax[N];
+        alignas(32) int32_t blocked[N];
+
+        for (uint32_t i = 0; i < N; ++i)
+        {
+            const Ray& r = rays[i < count ? i : 0];
+            ox[i] = r.origin.x; oy[i] = r.origin.y; oz[i] = r.origin.z;
+            dx[i] = r.direction.x; dy[i] = r.direction.y; dz[i] = r.direction.z;
+            ix[i] = 1.0f / r.direction.x; iy[i] = 1.0f / r.direction.y; iz[i] = 1.0f / r.direction.z;
+            tMin[i] = r.tMin;
+            tMax[i] = i < count ? r.tMax : -INFINITY;
+            blocked[i] = 0;
+        }
+
+        if (!m_nodes.empty())
+        {
+            uint32_t stack[kStackSize];
+            int stackPtr = 0;
+            stack[stackPtr++] = 0;
+            uint32_t remaining = count;
+
+            while (stackPtr > 0 && remaining > 0)
+            {
+                const BVHNode& node = m_nodes[stack[--stackPtr]];
+
+                int32_t anyHit = 0;
+                for (uint32_t i = 0; i < N; ++i)
+                {
+                    float tx0 = (node.boundsMin.x - ox[i]) * ix[i];
+                    float tx1 = (node.boundsMax.x - ox[i]) * ix[i];
+                    float ty0 = (node.boundsMin.y - oy[i]) * iy[i];
+                    float ty1 = (node.boundsMax.y - oy[i]) * iy[i];
+                    float tz0 = (node.boundsMin.z - oz[i]) * iz[i];
+                    float tz1 = (node.boundsMax.z - oz[i]) * iz[i];
+                    float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), tMin[i]));
+                    float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), tMax[i]));
+                    anyHit |= (tNear <= tFar) ? 1 : 0;
+                }
+                if (!anyHit)
+                    continue;
+
+                if (!node.IsLeaf())
+                {
+                    uint32_t first = node.leftFirst;
+                    uint32_t second = node.leftFirst + 1;
+                    if (node.flags & BVH_FLAG_OCCLUSION_RIGHT_FIRST)
+                        std::swap(first, second);
+                    assert(stackPtr + 2 <= kStackSize);
+                    stack[stackPtr++] = second;
+                    stack[stackPtr++] = first;
+                    continue;
+                }
+
+                for (uint32_t p = node.leftFirst; p < node.leftFirst + node.primCount; ++p)
+                {
+                    const BVHTriangle& tri = m_triangles[p];
+                    for (uint32_t i = 0; i < N; ++i)
+                    {
+                        // pvec = cross(d, e2)
+                        float px = dy[i] * tri.e2.z - dz[i] * tri.e2.y;
+                        float py = dz[i] * tri.e2.x - dx[i] * tri.e2.z;
+                        float pz = dx[i] * tri.e2.y - dy[i] * tri.e2.x;
+                        float det = tri.e1.x * px + tri.e1.y * py + tri.e1.z * pz;
+                        float invDet = 1.0f / det;
+                        float tx = ox[i] - tri.v0.x, ty = oy[i] - tri.v0.y, tz = oz[i] - tri.v0.z;
+                        float u = (tx * px + ty * py + tz * pz) * invDet;
+                        // qvec = cross(tvec, e1)
+                        float qx = ty * tri.e1.z - tz * tri.e1.y;
+                        float qy = tz * tri.e1.x - tx * tri.e1.z;
+                        float qz = tx * tri.e1.y - ty * tri.e1.x;
+                        float v = (dx[i] * qx + dy[i] * qy + dz[i] * qz) * invDet;
+                        float t = (tri.e2.x * qx + tri.e2.y * qy + tri.e2.z * qz) * invDet;
+
+                        bool hit = det != 0.0f && u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= tMin[i] && t <= tMax[i];
+                        blocked[i] |= hit ? 1 : 0;
+                        tMax[i] = hit ? -INFINITY : tMax[i];
+                    }
+                }
+
+                int32_t blockedCount = 0;
+                for (uint32_t i = 0; i < N; ++i)
+                    blockedCount += blocked[i];
+                remaining = count - static_cast<uint32_t>(blockedCount);
+            }
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+            occluded[i] = static_cast<uint8_t>(blocked[i]);
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+#include "CPU/Ray.h"
+
+namespace CPU
+{
+    // 32 byte node, two nodes share a cache line. Interior nodes store the index
+    // of the left child in leftFirst (the right child is leftFirst + 1), leaves
+    // store the first primitive and primCount > 0.
+    struct BVHNode
+    {
+        float3 boundsMin;
+        uint32_t leftFirst;
+        float3 boundsMax;
+        uint16_t primCount;
+        uint8_t axis;
+        uint8_t flags;
+
+        bool IsLeaf() const { return primCount > 0; }
+    };
+    static_assert(sizeof(BVHNode) == 32, "BVHNode should stay 32 bytes");
+
+    enum BVHNodeFlags : uint8_t
+    {
+        // Right child has the larger surface area, i.e. is the more likely
+        // occluder. Any-hit traversal visits it first.
+        BVH_FLAG_OCCLUSION_RIGHT_FIRST = 1,
+    };
+
+    // Binned SAH builder over generic primitive bounds. Returns the node array
+    // (root at index 0) and the primitive order referenced by the leaves.
+    // traversalCost is the cost of visiting a node relative to one primitive
+    // test; the default 0 splits whenever the children are cheaper to test.
+    // No leaf is deeper than kMaxDepth: once the depth left for a range only
+    // fits halving it down to single primitives, it is split at the median.
+    class BVHBuilder
+    {
+    public:
+        static const uint32_t kMaxDepth = 62;
+
+        static void Build(const std::vector<AABB>& primBounds, uint32_t maxLeafSize,
+            std::vector<BVHNode>& nodes, std::vector<uint32_t>& primOrder, float traversalCost = 0.0f);
+    };
+
+    // World space triangle, stored in BVH order with precomputed edges for the
+    // Moller-Trumbore test
+    struct BVHTriangle
+    {
+        float3 v0;
+        float3 e1;
+        float3 e2;
+        uint32_t instanceIndex;
+        uint32_t primitiveIndex;
+        uint32_t pad;
+    };
+
+    class TriangleBVH
+    {
+    public:
+        // Rays of OccludedBatch are traversed together in packets of this size
+        static const uint32_t kPacketSize = 64;
+
+        void Build(std::vector<BVHTriangle>&& triangles);
+
+        // Closest hit query, equivalent of TraceRay with a closest-hit shader
+        bool Intersect(const Ray& ray, Hit& hit) const;
+
+        // Any hit query for shadow rays: returns as soon as any intersection in
+        // [tMin, tMax] is found and does not compute hit attributes
+        bool Occluded(const Ray& ray) const;
+
+        // Occlusion for many rays at once. Rays are traversed in packets of
+        // kPacketSize; coherent rays (e.g. shadow rays of neighbouring pixels
+        // towards the same light) share node fetches and box tests. occluded[i]
+        // is set to 1 if ray i is blocked, 0 otherwise.
+        void OccludedBatch(const Ray* rays, uint32_t count, uint8_t* occluded) const;
+
+        const AABB& GetBounds() const { return m_bounds; }
+        size_t GetTriangleCount() const { return m_triangles.size(); }
+        size_t GetNodeCount() const { return m_nodes.size(); }
+        bool IsEmpty() const { return m_triangles.empty(); }
+
+    private:
+        void OccludedPacket(const Ray* rays, uint32_t count, uint8_t* occluded) const;
+
+        std::vector<BVHNode> m_nodes;
+        std::vector<BVHTriangle> m_triangles;
+        AABB m_bounds;
+    };
+}
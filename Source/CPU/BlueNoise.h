@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// Keys of the blue noise sampler (Heitz et al. 2019, "A Low-Discrepancy
+// Sampler that Distributes Monte Carlo Errors as a Blue Noise in Screen
+// Space"). Every pixel of a kBlueNoiseTileSize square tile, repeated over
+// the image, has a ranking and a scrambling key per decision of a bounce:
+// the ranking key is XORed into the Sobol index, the scrambling key into
+// the top 8 bits of the value. The tool D3DRTTables optimizes them so that
+// the error of neighbouring pixels differs as much as possible at 1 to 16
+// spp, which leaves mostly high frequency (blue) noise.
+
+namespace CPU
+{
+    static const uint32_t kBlueNoiseTileSize = 128;
+    static const uint32_t kBlueNoiseKeysPerPixel = 7;     // kDimensionsPerBounce
+    static const uint32_t kBlueNoiseWordsPerPixel = 4;    // two 16-bit keys per word, the last half unused
+
+    // Row major pixels, key k in bits 16 * (k & 1) of word k / 2, each key
+    // ranking << 8 | scrambling. Generated into BlueNoiseKeys.cpp.
+    extern const uint32_t BlueNoiseKeys[kBlueNoiseTileSize * kBlueNoiseTileSize * kBlueNoiseWordsPerPixel];
+
+    inline uint32_t blueNoiseKey(uint32_t x, uint32_t y, uint32_t k)
+    {
+        const uint32_t pixel = (y % kBlueNoiseTileSize) * kBlueNoiseTileSize + x % kBlueNoiseTileSize;
+        return (BlueNoiseKeys[pixel * kBlueNoiseWordsPerPixel + k / 2] >> (16 * (k & 1))) & 0xffffu;
+    }
+}
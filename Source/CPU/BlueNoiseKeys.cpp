@@ -0,0 +1,5473 @@
+// Generated by D3DRTTables bluenoise --iterations=32 --seed=1, do not edit.
+// See Source/CPU/BlueNoise.h for the layout.
+
+#include "CPU/BlueNoise.h"
+
+namespace CPU
+{
+    const uint32_t BlueNoiseKeys[kBlueNoiseTileSize * kBlueNoiseTileSize * kBlueNoiseWordsPerPixel] =
+    {
+        0x36a036a1, 0x4bab27ff, 0xfd04fd6a, 0x000094e0, 0xb65db6fe, 0xe3d30927, 0x58015874, 0x0000d774, 0x29df291b, 0xfbb32bbf, 0x6aaa6aba, 0x0000cbf0,
+        0xb0e6b03a, 0x9ae77f8b, 0x6df26dd5, 0x0000958a, 0x842284ec, 0x02fa36ee, 0xd3f8d3e8, 0x000069b7, 0x72e07222, 0xf9d93ed1, 0xa69fa6aa, 0x00000f83,
+        0x3dc23dfb, 0xe1a2ea0f, 0xa019a06d, 0x0000f882, 0xbec8beb9, 0x40640f02, 0xd703d73a, 0x00008f69, 0x235c2386, 0xa9d3c6c0, 0xa46ba432, 0x0000d735,
+        0xb921b99b, 0x4e39b747, 0xf330f391, 0x000026b2, 0xddecdd62, 0xd5c9cb23, 0xde3bdeed, 0x00001398, 0xeb82eb69, 0xd0dbe6a2, 0x57cf5780, 0x000069e3,
+        0x7d677d9a, 0x7b263cd1, 0x7041705a, 0x0000afff, 0x9c9b9cdc, 0x515c40f3, 0x553b5509, 0x0000ebe9, 0xc4dcc40c, 0x7b6077d2, 0x3edc3eb4, 0x0000f3f0,
+        0x36a036c5, 0x84c8f537, 0x2ef82e5a, 0x00003d72, 0x8f1c8fda, 0x778e3971, 0x56d15637, 0x00008f1e, 0xd10fd133, 0xc19d574f, 0xe3b1e3b5, 0x0000055d,
+        0x78bc7847, 0xfd61a5ce, 0x1c8e1c7c, 0x00008e45, 0x8bb78bb9, 0xa3e2bd37, 0x08fc08bd, 0x0000adba, 0x2cf92c1a, 0xaaaba033, 0x0f500f83, 0x00007c7d,
+        0x9b489b6b, 0x38367842, 0x860b8656, 0x000014b5, 0xbc4fbc4f, 0xfa28c3c3, 0x435b43a0, 0x00004763, 0x99c6992b, 0x069b57b5, 0x6a5e6a5c, 0x0000c3a0,
+        0xa8a9a89d, 0xebef12fe, 0xf1f6f1a8, 0x0000b696, 0x9f169fdb, 0x1a4ec2b4, 0xebb3eb6d, 0x0000b19a, 0x493c4952, 0x220fe1e4, 0x601c606e, 0x0000d967,
+        0xe0c3e0ae, 0x109d2b74, 0x04b30431, 0x00008db1, 0x257e25f1, 0x96b36c10, 0x10d41076, 0x000034ab, 0x1e5d1ebb, 0x5ab778a9, 0xcb91cbe3, 0x00006447,
+        0x7a877a42, 0x18156848, 0xfe35fe6b, 0x00008881, 0x34ea34c7, 0xbf9468f4, 0x6298627b, 0x000010e3, 0x4bcd4bee, 0x551f04c8, 0xd7e4d759, 0x00006676,
+        0x8aca8aef, 0x41b36ed4, 0xda96da22, 0x0000c5ec, 0x88f78840, 0x815855b1, 0x6bed6b1e, 0x0000d9e6, 0xf387f359, 0xfbcf8ad7, 0xde7dde9b, 0x000067e1,
+        0xb29bb24f, 0x30c29a2b, 0x24ac2426, 0x00006730, 0xba0cbac3, 0x4de9219b, 0x12811203, 0x00002bb9, 0x2ec62e25, 0xc6b6fcac, 0xa064a001, 0x00009221,
+        0x7db87db2, 0x95b8f557, 0x39ce39c5, 0x0000ea39, 0x3b823b31, 0x013b25a8, 0x1e661e9d, 0x0000065d, 0xea1deae6, 0xda547916, 0x6b036b61, 0x00000e00,
+        0xf985f9a1, 0xb61b82ce, 0xb6a5b6e5, 0x00001f07, 0x5abd5ab2, 0xff4ee973, 0x5a9c5a25, 0x000066b8, 0xefecef48, 0x9e5c4763, 0x92d19282, 0x0000cc10,
+        0xe1c5e1a6, 0xcf48db26, 0xd55dd5fb, 0x00000033, 0xf624f6b6, 0xd33029ba, 0xfe99fe2d, 0x00008953, 0xb9e9b94e, 0xde51bdcb, 0x4fb74fbb, 0x0000d30a,
+        0xbeb5be16, 0xc2ca0534, 0x8a5c8add, 0x00002da5, 0xe6dde645, 0x5704e7e2, 0x4f894fc0, 0x0000e20d, 0x261a26d3, 0xe4d36482, 0xa614a60d, 0x0000b1ef,
+        0x8785878a, 0xbc24c23d, 0x8618862d, 0x00005ae8, 0xc94ac9d0, 0x6e60aa03, 0xbd4fbd3f, 0x0000051b, 0xb5ecb54c, 0x287df337, 0x9aa39adc, 0x0000ecd6,
+        0x7a027a3c, 0x1fc5e5cc, 0x3840380f, 0x0000f31d, 0x250e2502, 0xa0d068a2, 0xcf11cfc1, 0x000005fc, 0x05a505d1, 0xeb5285f1, 0x587c58a9, 0x00009f6e,
+        0x69db69d6, 0xc794a752, 0x57b157ac, 0x00004378, 0x7dbf7d77, 0x0b7b20ab, 0x40cb4027, 0x0000ac74, 0x53b1537c, 0xd2dbdb59, 0xd265d207, 0x00002da4,
+        0x9ec99e01, 0xd93436d2, 0x23a723fc, 0x0000180c, 0x7ec37e44, 0x1f1a2944, 0xb46bb4c3, 0x0000df57, 0x3fa33f2b, 0x33df5430, 0xcd08cd3f, 0x00001af5,
+        0x50a05089, 0xaa020ae6, 0xcbf2cbf7, 0x000074bf, 0x0bc70b5c, 0x07c75f92, 0x47b847bb, 0x000058df, 0x34c83408, 0x9193641a, 0xb570b527, 0x0000e272,
+        0x86f0865d, 0x0dcb2dba, 0x7f537fef, 0x00002fa4, 0xfeb8fe3c, 0xcb272532, 0x144214fc, 0x0000a628, 0x908090d7, 0xdc540e27, 0x095809b7, 0x00006130,
+        0x691169dc, 0xe9a37d0b, 0xf1acf19e, 0x00009334, 0xe9a8e9b1, 0x95886320, 0xdc7cdcfb, 0x000021c6, 0xe655e633, 0xcc9a9e61, 0x7fe97f09, 0x0000a4e9,
+        0x024b02fe, 0x421606e8, 0xa2bca268, 0x0000396c, 0x7fb87faf, 0x7c551709, 0x6d7a6d6f, 0x000070e5, 0x4d854dd5, 0x0234f560, 0x475747a0, 0x0000ac1e,
+        0x3d523d1b, 0x10f90b63, 0x9e769e06, 0x0000d79b, 0xaa68aa34, 0x6480b9f6, 0x039503df, 0x00008d2e, 0x96249651, 0x559de296, 0x077107fd, 0x00002747,
+        0x0aef0a94, 0x5a3f4278, 0x7faa7f38, 0x00006914, 0x553055f5, 0x321f786f, 0xf9b0f915, 0x000019cb, 0x6dce6d0a, 0x4444544a, 0x560b5647, 0x00001295,
+        0x9ec99e6c, 0xe9a3c80f, 0xb428b4b5, 0x0000771f, 0x157c1562, 0x5b9f65e7, 0xaa0caa65, 0x0000f26b, 0x9e0d9eea, 0x86c03f71, 0xf639f64c, 0x0000bc79,
+        0x014a0181, 0x0c258722, 0x233a2375, 0x0000fc32, 0x13a11308, 0x17f900ca, 0x416241bd, 0x0000e0ac, 0x1fd71fa2, 0xfece2728, 0x491049a6, 0x0000d967,
+        0x3faf3fb0, 0x3a5b26c9, 0x40a0405c, 0x000094bc, 0x83468372, 0xd9c71dcc, 0x0be10bb0, 0x000052c9, 0xca16ca99, 0x2fe8675a, 0xe899e8a7, 0x00001bcb,
+        0xce44ceee, 0x7f5eab3e, 0xbf57bff7, 0x0000ab5a, 0xaf22afea, 0x8c864e37, 0xf251f2fd, 0x00004aad, 0xade5ad74, 0x13a51bef, 0x044704e8, 0x0000c607,
+        0x1e461eb6, 0x6a4086f0, 0x3520358c, 0x0000959b, 0x88ef8870, 0xff3a36ee, 0x785278a7, 0x0000e0f4, 0x93bf93ff, 0x25a2f528, 0x4c284ca5, 0x0000f1d2,
+        0x1c051c2e, 0x13b1d4f6, 0xff08ffed, 0x0000e17b, 0x5299528f, 0x013c239d, 0x68c368be, 0x00005ee7, 0x167816d5, 0x45a55f92, 0x8139814c, 0x000032ce,
+        0x1c581c24, 0x7e550f3e, 0xabddab9c, 0x0000e61a, 0xa5eca5d3, 0x21ede5dc, 0xf2e4f20c, 0x000044a4, 0xe0ede07d, 0x3ff6e299, 0xfe21fe67, 0x0000ecc8,
+        0xe740e768, 0xac511146, 0x00e800b3, 0x00005037, 0xb212b285, 0x43a736df, 0xc983c9e7, 0x00006c15, 0x3de93d92, 0x93e99338, 0xd7c2d77f, 0x000082fe,
+        0xb8eab879, 0xc15d4a1d, 0xef7aef8e, 0x00003231, 0xf7e0f7a1, 0xdd4d18d0, 0xc937c9ff, 0x0000b77d, 0xf83af8c7, 0x1dda97c7, 0x89dc89cc, 0x00002ab6,
+        0x05d0054b, 0x21113496, 0x982698a2, 0x00004c3f, 0xfce2fc4a, 0x4cd8d0b5, 0x674c67fc, 0x00003f4c, 0xcf40cf1d, 0x0919c77f, 0x1c291c3f, 0x0000cd68,
+        0xfc84fc12, 0xd34fedec, 0x690c6962, 0x000065af, 0x57fc57fd, 0x4366a4d4, 0x3976397f, 0x00007281, 0x2f5c2f86, 0xb1db397b, 0x129d1204, 0x00002afb,
+        0x4de84d3b, 0xc45460e9, 0xacebace6, 0x00003340, 0x0cd60c13, 0xc4f4d901, 0xabf0abfe, 0x00005d62, 0x1a291a02, 0x31a8f5a3, 0x4c084cc8, 0x00004311,
+        0x013b014c, 0x62cd95f7, 0x023702ab, 0x0000f632, 0x9d749d00, 0x2843a841, 0x01120128, 0x0000ddca, 0xfdd7fd81, 0xcc7a7909, 0xb7a7b7fd, 0x00001a33,
+        0x37823705, 0x515253b1, 0xb88db8a4, 0x0000b2c5, 0x30093086, 0x0e15f12b, 0x3ba23bd3, 0x0000e06c, 0x48f448b8, 0x694cc6ce, 0x38ae3854, 0x00004bc6,
+        0x37963764, 0xe9d381cf, 0x273c2733, 0x00009dae, 0xcf66cf37, 0xe3f27a37, 0x4e674e19, 0x0000b9b1, 0x7a2f7a65, 0xa1238700, 0x36183637, 0x0000f1b2,
+        0x5b345b37, 0x754bd4f5, 0x78ed784f, 0x0000f904, 0xdad5dac1, 0xed840b61, 0xf457f49e, 0x0000f0bc, 0x2ba22bec, 0xa36b3f4f, 0x913991c0, 0x00008580,
+        0xa54ca55a, 0x037b7ec2, 0xdd9bdd24, 0x00009d1b, 0xa22fa252, 0x7c9d4dc8, 0xe7e1e764, 0x00007ea3, 0x4ebf4ecb, 0x726d020b, 0x0269028e, 0x00001902,
+        0x60fd60c0, 0x8c0ee6a2, 0x2354234c, 0x0000f50c, 0xe703e733, 0xae0dedf1, 0x67da67ac, 0x00002357, 0x2ed12eee, 0x778471d6, 0xbfa5bfdb, 0x0000e101,
+        0xa583a585, 0x22fe02b4, 0x2d772d71, 0x000099e0, 0x3017303d, 0xc20c6627, 0x0f880f9b, 0x0000d7a5, 0x63a0634b, 0x29a235ad, 0x588158db, 0x0000a4e9,
+        0x54db544a, 0x3b557190, 0xcbadcb88, 0x0000f0ae, 0x6a076aa0, 0x4ce0d44a, 0x17961798, 0x0000cd2e, 0x7dcf7d8e, 0x158a5ca2, 0x5b655b2e, 0x00008f68,
+        0xd5a1d5c5, 0x4cd407d7, 0xe04ce000, 0x0000fbfe, 0x3f533f5b, 0x9bcaa5d4, 0x3b313b7f, 0x000045e4, 0xf2a0f275, 0xf17636ff, 0xd14cd11e, 0x0000330a,
+        0xd78bd70e, 0xbbd18171, 0x240b24d7, 0x00002466, 0xaf60afae, 0x571a326f, 0xc317c393, 0x00003c0f, 0x95a0950f, 0x78cd3f8d, 0x0ea70e0a, 0x0000d7c6,
+        0x9e399e7a, 0x1521ac26, 0x5a2a5abd, 0x000012d6, 0xda8edae0, 0xb801fa67, 0x11101108, 0x00003a5e, 0xc7a1c7f2, 0x163a4daa, 0xeb52eba2, 0x0000d918,
+        0xf120f15e, 0x7fc18553, 0xce95cee8, 0x00007b0f, 0x1f8e1f1b, 0xe2834756, 0x4aea4a22, 0x00001c14, 0xda18da35, 0xb05319b3, 0xf211f238, 0x00009dec,
+        0x020902dc, 0x1e4c99d7, 0x860986bd, 0x000078fe, 0x94cd9468, 0x430ef157, 0x57095750, 0x00001a6c, 0x4843483f, 0x32ce93a3, 0x3b363b27, 0x0000aa37,
+        0xb574b521, 0x56f3732d, 0x8b708b35, 0x00004012, 0x5c875c59, 0x829e07d7, 0xd129d107, 0x0000c62d, 0x861086fb, 0xadb0d335, 0x4ff24f37, 0x00008330,
+        0x592359c4, 0xc27c52ee, 0x85618596, 0x00002bf9, 0x915f91b2, 0x8867a29f, 0xed8eed17, 0x0000bbdf, 0x171e17f6, 0x75b12754, 0xcb39cb82, 0x0000f5e7,
+        0x454d450c, 0x1cde3bdf, 0x51525107, 0x0000b6a8, 0x57b057bb, 0xddf4458f, 0xca37ca95, 0x000090fb, 0x35ee35be, 0x7a7e2227, 0x57565738, 0x00003233,
+        0x9a039a9a, 0x0c3dcfd2, 0xdbffdba2, 0x00000272, 0xf6b3f655, 0x724af4de, 0x7d5e7d60, 0x0000e5cb, 0x783d78a3, 0xce45d8e5, 0x4e664edd, 0x0000330a,
+        0x11bc118e, 0xc5a59507, 0x60406048, 0x0000ee15, 0xdfd7dfbe, 0xff8d843e, 0x692d6944, 0x0000761d, 0xb616b68c, 0x560d4956, 0x16f216b2, 0x0000ebf6,
+        0xea41ea95, 0x3fdfb4e9, 0xfd36fd98, 0x00003080, 0x14171442, 0xbf1b6239, 0x6fa76fea, 0x00006ea9, 0xdb46db2a, 0x2523c3c3, 0x844b8456, 0x0000a836,
+        0x4e944ecb, 0x8296c300, 0xced1ce21, 0x0000c68d, 0x261c26ab, 0x32cffb47, 0xcc51ccea, 0x000054b0, 0x08250871, 0x8d67dad8, 0x3e9c3e60, 0x00002e3a,
+        0xaed3ae45, 0x5fb25433, 0xe24ce25f, 0x0000f198, 0xe54ae55c, 0x026788ec, 0xa954a955, 0x000013e3, 0x93229350, 0x42065902, 0x0cb40c82, 0x00000ccf,
+        0x8610868e, 0xb871789d, 0xcf7bcff4, 0x000090b9, 0x7b227b2a, 0xba4ffae7, 0x3eec3eae, 0x0000de96, 0x234a23d9, 0x6364a320, 0x8c348ca3, 0x0000f7f6,
+        0x0bc50bf5, 0x4ad67456, 0xa29ba28c, 0x0000d5d7, 0x65116527, 0xb36c5922, 0x851f852c, 0x00005e94, 0x618c617e, 0xb23a9745, 0x551255c1, 0x0000688b,
+        0x5bc95ba0, 0x1fb51ee7, 0x2864285c, 0x000009ed, 0x8dc48d41, 0x0e7d3c5f, 0x9cc99c6e, 0x0000035d, 0x601e608c, 0x13b1280c, 0xd1ecd1b9, 0x0000976b,
+        0x08b3082c, 0x0d164a56, 0x742a74e2, 0x00008261, 0x4f924f50, 0x17511fdf, 0xdcbddce5, 0x00000200, 0xc8aac851, 0x1092d4f5, 0x1c971ce2, 0x000051d9,
+        0x915e91cb, 0x8b3015f9, 0xd223d229, 0x00000cb5, 0xcd24cd43, 0x8e279acc, 0xbf12bf0d, 0x0000a965, 0x8ff98f29, 0xdc7a89de, 0x81a5813a, 0x00003e90,
+        0x3d193dc5, 0x13f881fe, 0x19261942, 0x0000ab64, 0xf265f27a, 0x262fba7f, 0xe53ae5fd, 0x00002d35, 0xbe35beb7, 0x65908cde, 0x7dcb7d8d, 0x000054d8,
+        0x549654bb, 0x40f9c6be, 0x8b888b76, 0x0000bb70, 0xdfaddf32, 0x211620e0, 0x6bda6b2b, 0x00000f39, 0x5885589b, 0x5c9c204b, 0x0b830b6f, 0x0000b41d,
+        0xab39ab1d, 0xa9f1c87a, 0x3317337d, 0x000049a9, 0xe2fce263, 0x4b86e2e2, 0x103a10b7, 0x00003869, 0xac2dace9, 0xe927b05a, 0x37dd370a, 0x00001fc3,
+        0xc994c9de, 0x14416d46, 0x771e7798, 0x0000378c, 0x47ec470f, 0x99791434, 0xa5e2a5a2, 0x0000fde3, 0x6b1f6b95, 0x312ee2ec, 0x5c445ca3, 0x0000b38d,
+        0x299e295d, 0xf1762cbf, 0x928092d6, 0x00009b09, 0xcbebcb14, 0x291d3d73, 0x820282e5, 0x00002cd6, 0x28bd28c0, 0xae40f83b, 0x33023332, 0x0000301f,
+        0xdfc2df5d, 0xaa331afd, 0xfacffa16, 0x00003406, 0x34aa34b9, 0x532e264f, 0xddffdda3, 0x00004004, 0xe03be030, 0x79703fad, 0x3a443af9, 0x00009b97,
+        0x70ea7059, 0x7b67166a, 0x8b648be1, 0x00009214, 0xfad0faeb, 0xc99a20de, 0xeb55ebe6, 0x00007cfe, 0x5b445b1c, 0xe08d7092, 0x0214022f, 0x0000381a,
+        0xacc2ac6a, 0x3bdd4fd0, 0x90a5903f, 0x000032b0, 0x62a262ab, 0xffb3b2cb, 0x876f87bd, 0x0000893d, 0x098d09e3, 0xa9f20525, 0x4579453f, 0x0000ef69,
+        0x89ed891d, 0xc7ca01c8, 0x1b0f1b2e, 0x0000b5cd, 0x3e6b3e1a, 0x0ad67ccf, 0x4b324b2a, 0x0000a1b4, 0x86b8867f, 0xcc8aa50d, 0x607660bd, 0x0000cc56,
+        0x106910a5, 0xc2d57e86, 0x0bd40bc3, 0x0000ade9, 0x985698da, 0x85a868f4, 0x0cb80c0f, 0x00003824, 0x532653a1, 0x93ecb3e7, 0x4266421f, 0x0000ca0b,
+        0x971e97ad, 0x94f8717a, 0x7f8e7f16, 0x000009b3, 0x9dfd9d1c, 0x65325ea3, 0xddf9ddf0, 0x0000bb58, 0x93a69313, 0x1f4e6d85, 0x9d949d25, 0x0000b3a8,
+        0x8fa58f2c, 0xb61b33e0, 0xeecfeec7, 0x00007960, 0xb057b02a, 0xf86c38f2, 0x2d4f2dfd, 0x0000c9f4, 0xb97cb914, 0xa5be7659, 0x9851980c, 0x0000bd55,
+        0x4bbf4be3, 0xb1ad828c, 0x50395065, 0x00002e9b, 0x8f028f5f, 0x7fcd95be, 0x0127016b, 0x0000c393, 0xeb2aebdd, 0x81560aa6, 0x124112f2, 0x00009331,
+        0x28be28da, 0xd2bba165, 0x8159814e, 0x000060ec, 0xf8b7f89a, 0xbf74e607, 0x3c183c6b, 0x0000b143, 0x3ef53e0e, 0x6ed1b03a, 0x1f231f44, 0x0000c1b9,
+        0x8e188e67, 0xee86b615, 0x232e23b7, 0x0000ec16, 0xd50bd56b, 0x4a05246c, 0xf67ef66a, 0x0000330a, 0x7e3b7eb8, 0x2ffed06f, 0xe756e7e4, 0x0000a8e9,
+        0x7ab87ae2, 0x93f3c1b1, 0xef18ef95, 0x00002289, 0x134d133b, 0x0dc3fdbe, 0x505d50c6, 0x0000221a, 0x416d41d1, 0xc82a407d, 0x41f54127, 0x00002274,
+        0xb69ab6b5, 0xc3ac69c8, 0xb953b988, 0x00004d7d, 0x9e3c9e2c, 0xfd61937e, 0xe192e13e, 0x000051a7, 0xe93de98f, 0xb5f8a887, 0x01ab01c7, 0x0000f682,
+        0x4b674b12, 0x5c6f5ae3, 0x7600762d, 0x000067d0, 0xef0eefb2, 0x5666a7db, 0xb2eab20b, 0x00000bfd, 0xd2d6d25f, 0x09b699d7, 0x284728ea, 0x0000289b,
+        0x823e8242, 0xdecb7cb8, 0x8cee8cdf, 0x00001e03, 0x43ec43fb, 0xa7be9f2a, 0x151a1560, 0x00003d8c, 0xae11ae2e, 0x289c6f7d, 0x82338259, 0x0000ed28,
+        0x03a203c7, 0x3c0265e7, 0x8f278f52, 0x00002ae2, 0x70a47057, 0x2cce6689, 0xfa06fa2f, 0x00009bf7, 0xd0b9d0ce, 0xd7cb8ede, 0x995d9966, 0x000009d3,
+        0xa99fa9e8, 0x1a93af03, 0xbbbabb33, 0x0000bc85, 0x8a258a02, 0xdb2dfff4, 0x7b907baa, 0x0000030d, 0x76ed760a, 0xf1f48681, 0x65ef65a5, 0x000068d5,
+        0x46304690, 0x4fde44bc, 0x1b211b40, 0x00008fbe, 0x48da4866, 0x289c2ceb, 0x1f441ffb, 0x0000378c, 0xd5ded578, 0x99fd375f, 0xa459a44d, 0x0000fbb4,
+        0xb394b3c8, 0x754c303a, 0x928c92ac, 0x0000c8b0, 0xccfecc21, 0x9906a973, 0xccbcccfd, 0x0000aa07, 0xf8a4f8a1, 0xa7be3e3c, 0xcdd8cd93, 0x00002390,
+        0x780478df, 0x4299987b, 0x36963639, 0x0000dbd4, 0x4ed04e17, 0x3348979a, 0x1ff11f43, 0x000057e8, 0x6c076ca8, 0xd21e26ac, 0x9a439ab6, 0x0000ba10,
+        0x14ac141b, 0x912c9fdc, 0x20262085, 0x000019ca, 0x1b831b4f, 0x53cbc32e, 0x48cf4891, 0x0000f508, 0x723472a6, 0xe01eb9f7, 0x9973992e, 0x00002530,
+        0xf75af7ab, 0x09b6c1fe, 0x94c59480, 0x0000de57, 0x575457ff, 0x939c139e, 0x57615787, 0x00007460, 0xa973a91c, 0xbfa90205, 0x44de446c, 0x00008dd1,
+        0x962a9677, 0x320cd09b, 0x3b503b13, 0x00007594, 0x3abb3a1a, 0xe24348d7, 0xdf9bdf22, 0x0000dfb7, 0xa4b0a4f1, 0xf99516aa, 0xf50df571, 0x00009f79,
+        0x19171936, 0x0c344f57, 0x25c02562, 0x000035c2, 0x929392a5, 0x85d67fc4, 0xd6afd60c, 0x00000bdc, 0x6dc06d99, 0x0e04ebcc, 0x7045706b, 0x0000ad85,
+        0x42ed4252, 0xe3a588e1, 0xfb9efb07, 0x00003c2c, 0x45ee4561, 0x0c38c918, 0x2a6f2a17, 0x000063a9, 0xb1e5b189, 0x1c4d5c86, 0x02e5029e, 0x00000d18,
+        0xf6f0f606, 0xecd365c5, 0x7a177a72, 0x000079a3, 0xf75af759, 0x7fcd86c1, 0xf247f2c3, 0x0000b17e, 0x67e567df, 0xdc8fdde8, 0xe14fe158, 0x000079d1,
+        0xe4cbe427, 0xb7c8caa9, 0x4233421b, 0x0000695c, 0x672b673b, 0x88f95b0b, 0xe07de076, 0x0000e18f, 0x43c64379, 0xd214041e, 0x2695267c, 0x0000d6eb,
+        0x1a421a38, 0xf0f76625, 0x94029483, 0x00003f33, 0x58bd58af, 0xc9f47923, 0xfcf2fc04, 0x00005954, 0x11d911a5, 0xb0b8eacd, 0x742874e3, 0x0000864f,
+        0xbf28bf59, 0x9b56c564, 0xcffecf40, 0x00003a2d, 0xc2e4c2bb, 0x038461d6, 0x34203402, 0x00009698, 0x2b102b4b, 0xa060544e, 0xa19ea1f1, 0x00002643,
+        0x40aa407a, 0x0b549a81, 0x4aa54a20, 0x0000ee33, 0xe5d0e58b, 0xd3f8e5cc, 0xdf32df3f, 0x00000282, 0xf285f2d0, 0xc0ca9cad, 0x682b684b, 0x0000988a,
+        0xbb08bb3e, 0x7fba639e, 0x10251090, 0x00001833, 0x8bee8b8d, 0x8cf8a399, 0x368036cc, 0x00005ac9, 0x92c5929d, 0xef001832, 0x024802a3, 0x00006b8b,
+        0x34db34bc, 0x7a2a8ad7, 0x1afc1ad5, 0x0000e7ad, 0x71cd718c, 0x76c0a060, 0xadb7ad13, 0x0000040c, 0xb800b873, 0xeef20955, 0x816981b9, 0x0000b601,
+        0xd0ccd04b, 0xe59c3bce, 0xf70ef7c3, 0x0000482d, 0xa8f4a89a, 0x0d543aff, 0xc4ffc4f3, 0x0000370e, 0xb35bb330, 0xcfa7d1d4, 0x342b349d, 0x00009b4e,
+        0xcb1ccbd0, 0x77fa7dc0, 0x2354239c, 0x0000d549, 0x2fd02fef, 0x317676f4, 0x10d4107a, 0x0000eb17, 0x305d3079, 0xc177846e, 0x847484af, 0x00007b87,
+        0xa977a965, 0xfc3c6400, 0x52bc5213, 0x00000aec, 0x78b778b0, 0x8eee96c8, 0xbf05bfee, 0x00009a6b, 0x38313811, 0x32602fc7, 0xa3b5a3da, 0x00000729,
+        0x343e34b9, 0x4448fcbc, 0x0b650b68, 0x000013f7, 0xddecdd94, 0xe93e40c3, 0x70aa7021, 0x0000af98, 0x873d876f, 0x038c644f, 0x560d5652, 0x00003135,
+        0x9ff69fba, 0xcc276889, 0xc61bc6a1, 0x00006bff, 0x4bb34b3d, 0xc52a9317, 0x53975326, 0x0000741e, 0x2ffe2f3a, 0xbf021615, 0xeb3eebfd, 0x0000bf30,
+        0x9a379ab1, 0xa5870c01, 0xbdb4bdb8, 0x0000e5ad, 0xcd22cd05, 0xa5a16f48, 0x6d786dd7, 0x00007dbf, 0xe45de466, 0x68bf85f0, 0xbb1abb5f, 0x000044c6,
+        0x3cc53c83, 0xd192bd77, 0xa094a0d5, 0x00006c15, 0x4cf64cff, 0x5e1de45d, 0x212821ec, 0x00009847, 0x582c582a, 0xc864b335, 0xf275f296, 0x0000b94e,
+        0x0d9a0d01, 0xd0384192, 0xd512d5f8, 0x0000627a, 0xfb09fb41, 0x4909772f, 0x5f435fc8, 0x000091fb, 0x08250871, 0xc715dd15, 0x7ab17abd, 0x0000a0bb,
+        0x99ce9992, 0x0a262dfb, 0x5e665e2d, 0x00000b87, 0xe328e3c6, 0x0ecb892e, 0x5708577f, 0x00005b1d, 0x7fc97fc0, 0x80f70459, 0x69116991, 0x0000c940,
+        0xbd72bd0c, 0x26d668f4, 0x502250d2, 0x00009c46, 0x58ce581e, 0x78d9550b, 0x08170863, 0x00002fa4, 0x961e961f, 0x2db9f0ab, 0xfdc0fd90, 0x000077ee,
+        0x3773377a, 0xe22ded22, 0xe274e2ea, 0x0000a836, 0x6950699d, 0xbcdbc0fe, 0x88a888a2, 0x0000e1e2, 0xa260a2fb, 0x230fe9cd, 0x7f0b7f58, 0x00006dfb,
+        0x0fe30f96, 0xb72a1e15, 0xdc43dc15, 0x0000e937, 0xf810f830, 0x2fc15d13, 0x9a0d9a99, 0x00002357, 0x52a95258, 0x84081c9c, 0x532b5336, 0x00002066,
+        0xa359a380, 0x4929fefc, 0x119511f6, 0x00009850, 0xe431e4fc, 0x45468ea3, 0x2b002b65, 0x00009db5, 0x99389986, 0x95670149, 0xbee2beed, 0x0000f21d,
+        0x9b709b42, 0x7d3dfe87, 0x50525048, 0x00001d02, 0x83a083fd, 0x92676b7d, 0x36e636ea, 0x0000e533, 0x358d3522, 0x9a9d5530, 0x232b2355, 0x000051e8,
+        0x3245325b, 0x877ff8da, 0x1759171b, 0x00001114, 0x01f101fb, 0xbf1b3ae0, 0xefcdefe0, 0x0000f196, 0xf15ef12e, 0x5fca474c, 0x4350432c, 0x00005daf,
+        0xf0c9f028, 0x40bfdaba, 0x4aaf4a92, 0x000095eb, 0x1d3c1d16, 0xdec4e13a, 0x3b8b3b2f, 0x0000ce8e, 0xa26aa279, 0x217c25d6, 0x7d857da0, 0x0000281c,
+        0x3de03d5d, 0x18ca9638, 0xcf7fcf43, 0x0000b423, 0x9ede9e96, 0x75dd6eb6, 0x2c422ce0, 0x00003b2d, 0x7b607b66, 0x156a9a4d, 0x1736177f, 0x00003d33,
+        0xee2dee6d, 0x7a78c5e5, 0x51db5137, 0x00007d5e, 0x221b22f0, 0x037bdd15, 0x00eb00b2, 0x00007c4e, 0x4b0e4bf0, 0xd6732262, 0x43c44324, 0x00006a45,
+        0xf11ef1f1, 0x391f9c2a, 0xfd23fdb8, 0x00000963, 0xde3cdebb, 0x9268f7e7, 0x06ac06b8, 0x0000d875, 0x3be43b90, 0x55890f02, 0x423a421b, 0x00008202,
+        0x063006e5, 0x6d5102ca, 0x3de43d10, 0x000098ae, 0x71f27176, 0x40c658a3, 0x44524422, 0x000031ab, 0x438c4309, 0xb674824c, 0xe446e41b, 0x0000a410,
+        0x931193c6, 0x117537d6, 0x2fbe2f2e, 0x0000d1eb, 0xf419f40f, 0xde5d92d8, 0xf375f395, 0x0000b1a8, 0x229e22e9, 0x376fe833, 0x392d394b, 0x0000dea8,
+        0xfdc2fdb3, 0x1d4a5b25, 0xb331b377, 0x00008bbe, 0xd10bd1fe, 0xe1a3b1a0, 0x3a213a81, 0x00004170, 0x37503782, 0xc1057567, 0xb650b6c7, 0x0000bf4e,
+        0xf895f8da, 0x034490f9, 0x0d6b0d8e, 0x0000d1c2, 0xfe9dfefa, 0x45790461, 0x0882088d, 0x0000db81, 0x312b3173, 0x03f2bc37, 0x3ad13a57, 0x00008c9b,
+        0x4ec04e96, 0xa5c21853, 0x407040b8, 0x00001c99, 0x2af12a29, 0x88a6293b, 0xa401a491, 0x00004c70, 0xbce4bc81, 0xed230785, 0x3f083ffe, 0x0000dce2,
+        0x049004b4, 0xaeee8c62, 0xde54defc, 0x00005df6, 0x0fdf0f22, 0x0ff5a3e0, 0x57b15728, 0x00001873, 0x6b156b69, 0x0814765d, 0xef0fef2e, 0x00006858,
+        0xa939a9d8, 0x5f4e778f, 0xc66ac693, 0x00005976, 0x91269139, 0x74d317f5, 0x30453046, 0x0000ff5c, 0xb19ab10e, 0xe8e222ab, 0xc294c2ee, 0x00000083,
+        0x223d225f, 0x25a2fe0b, 0x3fde3fcc, 0x0000bbd0, 0x9c429ca0, 0x701a6f49, 0x6abc6a07, 0x000071c9, 0xf430f43d, 0x20302d8d, 0x87ba8796, 0x000086fd,
+        0x5de25db6, 0x90dcf14c, 0xa700a7de, 0x00004090, 0xc051c0b0, 0x37fa43fd, 0xb767b707, 0x000098ae, 0x78c17826, 0x94f8f46a, 0x3123319f, 0x00001617,
+        0xb428b44b, 0xf2493657, 0x3fc23fdf, 0x00009e09, 0xf7b6f741, 0x8b8465e4, 0x592059ba, 0x00005538, 0xfd00fd9e, 0xe5621b51, 0x5a935ac4, 0x00005208,
+        0x49294914, 0x6e506b34, 0xb4efb40b, 0x0000b1b3, 0x467f4652, 0x694e3a4e, 0x896789b2, 0x00002c67, 0x4b694b92, 0x5f69e75d, 0xbad9ba57, 0x0000bd2f,
+        0x3d4e3dc6, 0x396f1c0d, 0x3fb43f1d, 0x0000072b, 0x940e94c3, 0x3ddedd6d, 0xc16ec1b0, 0x00007569, 0x89bb8996, 0xb5f7c0c0, 0x55bf5507, 0x0000cc8d,
+        0x20f52069, 0x13773341, 0x82178219, 0x0000c1d0, 0xb46bb4fa, 0xdb3835ee, 0x3f123fd8, 0x00000272, 0x5f215f8a, 0x0eea5683, 0xb387b3df, 0x0000352f,
+        0x1c341c13, 0xaea4a1da, 0x5d4b5df7, 0x0000e669, 0x9bd99b13, 0xd6cf53fc, 0x3b863bfd, 0x00002e9b, 0xafc0af60, 0x655a2629, 0xc279c249, 0x0000abcb,
+        0x0ab10a55, 0x128cadc2, 0x74de74d7, 0x0000442e, 0x47d14730, 0xc69c6205, 0x3e0d3e86, 0x0000d9a5, 0xff46ffea, 0x5bf90e99, 0xbcbfbcfb, 0x0000e17b,
+        0xfd3bfdc5, 0x0f874438, 0x55fb55c9, 0x0000eadc, 0x2ead2e41, 0xe0439808, 0x9f2f9f0e, 0x0000574a, 0xf50df5d7, 0xdb2e7bbe, 0xb152b159, 0x00007ea3,
+        0xe311e326, 0xa0806e49, 0x324832d7, 0x0000281c, 0x43c3437b, 0xfaea37fa, 0xb36cb36a, 0x000047bb, 0x7a117a18, 0xcb7a37a1, 0x6274620b, 0x00002289,
+        0x964d96aa, 0xb313ca2e, 0x1b901b09, 0x00009561, 0xf3faf30c, 0xf2491144, 0x38963896, 0x000035ad, 0xae0cae2c, 0xf8e70ca1, 0x952095be, 0x00003003,
+        0x16a016d7, 0x5f9055cd, 0x315d3111, 0x00003e12, 0x93139337, 0x1f3e94c5, 0x844e84a3, 0x000094bd, 0x61e46187, 0x771c4a61, 0x5427544d, 0x0000a577,
+        0x09fc09a5, 0x8e04bcb5, 0xe748e7af, 0x0000ca74, 0x02a702ad, 0x28c1fbfb, 0xfa58faf0, 0x0000fca0, 0x50395003, 0xefd1b6ea, 0xc257c2c4, 0x0000dd2a,
+        0x5ebd5e0c, 0xbc1a9fc7, 0xdc5cdc3e, 0x000084a2, 0xaae0aab8, 0x697d453b, 0xe5a2e50a, 0x00003b13, 0x8e828ec1, 0xa44f42db, 0x0d370de4, 0x00005a09,
+        0x792f7946, 0xad21baf5, 0xa167a137, 0x0000c9e4, 0x87c18791, 0xbb2c7cc0, 0x734e73ec, 0x00006fa7, 0x0ddb0d95, 0x215d57e3, 0x664d664d, 0x0000b543,
+        0xc0cbc0ad, 0xb7b395be, 0x9ab19a7e, 0x000008b5, 0xeef8ee43, 0x137d99ab, 0x2b712b98, 0x00007e9c, 0x01a50173, 0x981be604, 0x83468321, 0x00007473,
+        0x7e8c7e17, 0x584dbdb6, 0xf0fbf0b9, 0x000084db, 0x4f094f1c, 0x68448c5c, 0xb36eb3a3, 0x000091d5, 0x5c465c18, 0xe23fd1f6, 0xd2fed205, 0x00005cd6,
+        0xcbf7cb4d, 0xf4ae1df2, 0x95859562, 0x0000660f, 0xb843b8ed, 0xb98fa6a9, 0x260f26d2, 0x00005b64, 0xacf0ac22, 0x16bea3db, 0xeae3ea3f, 0x00001589,
+        0x712171b0, 0x44f92c16, 0x210c21f8, 0x00004347, 0x6017608a, 0x3f28d623, 0xc6b3c60a, 0x0000b32c, 0xa115a1d0, 0x1645b939, 0xbf7dbfe0, 0x00006815,
+        0xb6ecb606, 0x6fb5c27a, 0xc50ac570, 0x00003d11, 0x870d873d, 0xfcd9cb24, 0xe361e374, 0x0000cc8d, 0x28d42873, 0xdc8f3ff1, 0x57c557df, 0x0000df57,
+        0x96799656, 0xdce4dadb, 0xda8adabd, 0x0000e2a4, 0x9d229d3a, 0xa0614547, 0x97319765, 0x0000b250, 0xfdc7fdc2, 0x7ee23a30, 0x1c971ce1, 0x0000f3fc,
+        0x840184c3, 0x0ccb2d12, 0x06f70650, 0x00005b54, 0x9adb9a08, 0x5378b67f, 0x4b764bd5, 0x000022ea, 0x5ac15a4f, 0x25a2f9b8, 0x09c109d1, 0x00006b48,
+        0x8daa8d6d, 0xd96a8515, 0xdf58dffe, 0x00005237, 0xfc51fc77, 0x47890a14, 0xb7b0b771, 0x0000092c, 0xd13ad10f, 0x46f63323, 0x412d41d0, 0x000003a0,
+        0xfcb0fc46, 0x60a00155, 0xac8cac38, 0x00004b97, 0xf57ff580, 0xfacf5dd2, 0xf0d2f01a, 0x000055f8, 0xcd7acd6d, 0xa22342bc, 0xb766b714, 0x00006579,
+        0xcdcfcdee, 0x7a8f096b, 0xc2afc263, 0x00000f53, 0xbc4ebc5c, 0x619a8579, 0x270f2736, 0x00003a13, 0x173a17d4, 0x6b2b3d64, 0x26f22668, 0x0000f51a,
+        0x92af92f6, 0x55c98da1, 0x69c36918, 0x00000633, 0xc3d3c336, 0x704af93a, 0xcd62cd7b, 0x00003f83, 0x1c681c62, 0x24924b0c, 0x540b5427, 0x0000c5be,
+        0x512c510a, 0x4927804c, 0xad11ad4a, 0x0000e1b9, 0x26cf2627, 0x5dc8edc2, 0x50935061, 0x00000339, 0xb680b6da, 0x998d5f9b, 0x436a43d9, 0x00002e9a,
+        0xc08dc0f3, 0x2ec0c0a8, 0x4b2f4ba9, 0x0000f893, 0x71c671cb, 0x376f4948, 0xbda6bd81, 0x00009215, 0xb389b3a1, 0xf39b947b, 0xf2edf2cb, 0x00006976,
+        0xf125f151, 0x9d064e08, 0x29102965, 0x0000478f, 0xb1c1b150, 0x6415af0b, 0x04a20462, 0x00008fe3, 0xcae5ca74, 0x80db1199, 0xed0ded7c, 0x00003c73,
+        0x90e690f6, 0x3b575cbd, 0xcb7ccb76, 0x0000a364, 0x144e1493, 0xfe2efcc5, 0xe913e933, 0x00001875, 0xd32bd3c9, 0xdbdaeabd, 0x3fa23f5f, 0x0000f4ce,
+        0xed0eed4e, 0x027bc910, 0xabe6ab57, 0x0000eb29, 0xd233d20d, 0x6e2278e0, 0x43374343, 0x0000b84e, 0xbfe8bf62, 0xb4ac7a69, 0x963a96ad, 0x00007921,
+        0x869a8684, 0xfb0de15d, 0xa358a3da, 0x0000cf10, 0x921d92a4, 0xb9ccd707, 0xe4ace405, 0x00000d39, 0xca55ca92, 0x53078ca1, 0x8b688b3d, 0x0000b543,
+        0x98a6987d, 0xb2ebfd47, 0xe6abe60a, 0x00009184, 0x57765742, 0xf5b979a8, 0xfafbfa03, 0x00004e37, 0xbdcebd8c, 0x96b396b3, 0x44584438, 0x0000e107,
+        0xf7f9f79a, 0x01415601, 0xfb46fb17, 0x00000f99, 0x099e09d4, 0xa1237056, 0x73897341, 0x0000ed17, 0xca9ecab8, 0x0ca941c4, 0x3be03b2a, 0x0000e1e2,
+        0xff74ffcb, 0x1dde33a5, 0x2dc32d3d, 0x000052ca, 0xfce7fce2, 0xcec553fc, 0x0dc60d97, 0x0000e44d, 0x481d487f, 0xfc2f2d71, 0x4e624ef0, 0x0000dcde,
+        0x82d482dd, 0x9a60f9c6, 0x65226566, 0x0000830e, 0xf69cf677, 0xf977a39a, 0x9b939b12, 0x0000b3df, 0xa7caa73b, 0x05457232, 0x367836ea, 0x00009214,
+        0xa137a1bf, 0x9a1e1fe1, 0x854e8588, 0x0000983a, 0x93229341, 0xa78e254d, 0x789e786b, 0x0000c217, 0x61176127, 0x7a0955fc, 0x8e468ee4, 0x00007c4e,
+        0x589058bb, 0x332e3883, 0x44924449, 0x0000370f, 0xc70dc734, 0x43798cde, 0xfab8fad0, 0x0000657b, 0x681f6848, 0xe567ef93, 0x4c6c4c95, 0x0000b1d7,
+        0x67706754, 0xbf4b83cc, 0x4af64aec, 0x0000658b, 0x1dca1d84, 0x790fcbf7, 0x10b3105a, 0x0000f45c, 0xca55ca94, 0xdc8b60eb, 0x472b4776, 0x00001717,
+        0xcd28cddb, 0x97c77167, 0x9fef9f1b, 0x00005306, 0x16521659, 0x44460cf9, 0x83ac832d, 0x0000854c, 0xd111d132, 0x3d3aa6d4, 0xc6f5c688, 0x0000eed6,
+        0x0ab10aeb, 0xcd44a778, 0xfd2dfdbb, 0x00001321, 0x526c526a, 0x9dd454f1, 0x974f97b6, 0x0000115b, 0x093209f3, 0xd0f3bdcb, 0x118811f5, 0x0000d0a5,
+        0xc63ec6b0, 0x411eabc3, 0x771f7775, 0x00008dd0, 0xf436f4f8, 0xdb438998, 0xb3cfb36e, 0x00000c39, 0x395c3990, 0x30ceaa7a, 0x53b253aa, 0x0000a418,
+        0xa75ea732, 0x7a85e45d, 0xb651b616, 0x0000761f, 0xade7ad17, 0xbe6d515c, 0x11681140, 0x0000bc85, 0x5cec5c04, 0xf0b6c6b9, 0x0c700c7c, 0x00000992,
+        0x55d0550e, 0xb2472a79, 0x1ea51ebd, 0x0000cfcf, 0x642f64fb, 0x9d533719, 0x776377b3, 0x00001f8b, 0xca5ecae7, 0x1d414c29, 0x550755cf, 0x00007651,
+        0xdeeede62, 0xee931cd0, 0x097f093e, 0x00008990, 0x5dc35d4f, 0x615ab97f, 0xfd22fd5e, 0x00008c61, 0x71dc715c, 0x6e9f76a6, 0x45bb4503, 0x0000acc0,
+        0xf871f81a, 0xe958376e, 0x692f6989, 0x00004aa9, 0xf55af56a, 0x3c9ab062, 0x5ebf5eaf, 0x0000d8c4, 0xba22bab4, 0x01456257, 0xb837b855, 0x0000f10d,
+        0x58d9586a, 0xe7e21aab, 0xff46ff4c, 0x0000e1b7, 0x89b28932, 0xb3e59e2a, 0xf44af4ba, 0x0000c44d, 0x1ba91b55, 0xa30197c4, 0xfab3fa65, 0x00009714,
+        0x6f326f1b, 0x56a7bcb7, 0xbc87bcdf, 0x00007861, 0x022e024e, 0xe2c152e3, 0x32a53254, 0x00001279, 0x152d1577, 0xc89ac6ce, 0x7fa57f70, 0x00004625,
+        0x3b673b18, 0x8c782fbd, 0xb9adb98e, 0x0000fba1, 0xfde1fd17, 0xeb931406, 0xac6eacbc, 0x00001588, 0x787f7891, 0x76c4c743, 0xd800d866, 0x00008463,
+        0xdc0bdcff, 0x87d52254, 0x17b11714, 0x0000a758, 0x0fed0fdf, 0x0ea9ccfd, 0x8c948caa, 0x00000d53, 0xd9e2d921, 0x7bf12dbf, 0x4c924cb0, 0x000021cb,
+        0x85d485c5, 0x49469e57, 0xffeeff4e, 0x0000a31e, 0xd792d7cb, 0xb03c45b2, 0x5e775e3f, 0x00000cca, 0x2c5f2ca9, 0x0c263b5c, 0x63d86329, 0x00009fb1,
+        0x6a236a90, 0xcd7a5294, 0xf678f6df, 0x0000c227, 0xe94de933, 0x4905c62e, 0x74a374d7, 0x00004762, 0x3be93b29, 0xafb33196, 0x576f578b, 0x0000858e,
+        0x60276055, 0x9a7248d6, 0x724d725e, 0x000027ea, 0x00ae00c5, 0xa4beedcc, 0xab9dab3f, 0x000042cf, 0x32bc327c, 0x0ef44bdd, 0x46894633, 0x0000be2f,
+        0xa207a2c4, 0x954c3454, 0xa321a317, 0x0000b905, 0xa960a9d0, 0x594ac0dc, 0x917e9151, 0x0000da05, 0x635f63b1, 0xd8f833ff, 0xa8b1a83d, 0x00002216,
+        0x22972260, 0x9979fae5, 0x13651347, 0x00009eb4, 0x681a68d5, 0x42d6f928, 0x064706ee, 0x0000ceaa, 0xd7e6d773, 0xa97e5312, 0x160816dc, 0x000069ff,
+        0xd983d9cb, 0x19e0fb73, 0x78be7889, 0x00003a13, 0x0cca0c9d, 0xf3ccc950, 0xe53ce57a, 0x0000d874, 0xbf0dbfae, 0x8c981fef, 0x22132223, 0x000060a6,
+        0xefbfefc4, 0x40646e5b, 0x07a707f7, 0x0000a764, 0x9d579de4, 0xe5f292be, 0xeb4deb58, 0x00005fb4, 0xecd2ecdb, 0xd68d52fc, 0xe5a5e588, 0x000068c7,
+        0xeaa6eaca, 0x227ba05b, 0x8b998b30, 0x00008bee, 0x06e20653, 0xe062f5d6, 0x08b20882, 0x00004c69, 0x7112713c, 0x87f7a42e, 0xf2d6f2d7, 0x0000585b,
+        0x419c415a, 0x4de80329, 0x6d0e6d42, 0x00005a2b, 0x1a061a02, 0x4f265081, 0xec95ec1b, 0x00000c63, 0x2a6e2ae4, 0x2f02fb30, 0x38f738a1, 0x0000eafd,
+        0xb23eb2b9, 0xb884e2d2, 0x6df16dcd, 0x00002cf9, 0x149c1435, 0xc6b5af03, 0x2fbe2f7a, 0x0000e7d2, 0x163916af, 0xc8c64d29, 0xc30bc370, 0x00002988,
+        0xeed9ee2a, 0x43effc7b, 0x22e022fe, 0x00008d4a, 0x7d417d65, 0xd240ce53, 0xa3cda347, 0x000039f3, 0x491c4910, 0x8b3f4044, 0x4c994cc9, 0x0000b2cc,
+        0x27932732, 0x1d1fcfd7, 0x6dc06d9c, 0x0000dcad, 0xcd40cd7b, 0xa4c2a11a, 0xd685d6ce, 0x0000ee5f, 0x08ed08d1, 0xd2ab38b3, 0x9f5c9fcf, 0x0000187a,
+        0x122d120c, 0x9a41bff8, 0xc8f8c8b2, 0x000035ad, 0xd4e2d4c4, 0x25212595, 0x426d423c, 0x00009cc1, 0xa665a640, 0xe01e53f2, 0xf680f6dd, 0x0000ff1a,
+        0xb5f7b5f1, 0x964cb817, 0xa6aba6ed, 0x00007f8c, 0x44c144c8, 0xe7e2eaaf, 0xc756c750, 0x00007384, 0xce32cec9, 0xf6e28800, 0x7aa97a33, 0x00005cd6,
+        0x32903267, 0x7074c244, 0x32ec323d, 0x00004525, 0x34f63441, 0x5ba7f761, 0x579357c3, 0x00009d31, 0x33df3329, 0xf1a373ef, 0xda15dacf, 0x0000f582,
+        0x63ea63c7, 0xfc0dae66, 0xb0fdb04f, 0x000020a5, 0x90ca9023, 0x98670cdb, 0xd69bd6fa, 0x0000b649, 0x47194729, 0x3ef50049, 0x40874035, 0x0000c02d,
+        0x12e912f4, 0x8911d8e6, 0x57085738, 0x00001e88, 0xac1aac84, 0xf803eafd, 0x2c412ce0, 0x0000c840, 0xcb35cbe2, 0xb46676f0, 0x9fe79ff8, 0x0000c32c,
+        0xf35bf328, 0x3c8853f0, 0x85aa85ea, 0x0000d6b8, 0x43544347, 0x4eb7e6f7, 0x90599057, 0x0000c7f7, 0x473947b1, 0x1441d85a, 0x13e4130f, 0x00003f4d,
+        0xd983d9c8, 0xce47d356, 0x881888e9, 0x0000cf2e, 0x6e026e46, 0x8126c6a8, 0x7af57ad8, 0x0000563a, 0x7aea7ab0, 0xa871bff4, 0x64836452, 0x0000735e,
+        0x660e66ef, 0x833bc071, 0xd908d969, 0x00006327, 0x754a75f6, 0xf0f4d2cb, 0xd222d29c, 0x0000f3f1, 0x3c013c1c, 0x53bd0d59, 0xaeadaeed, 0x00009220,
+        0x2f202fe9, 0x8296fef4, 0x9591952e, 0x00009f47, 0x73fa7358, 0x2c291955, 0x238123ef, 0x0000307e, 0x00a20072, 0x7499c35a, 0x1d091df6, 0x0000dd79,
+        0x68ea68f4, 0xf174df69, 0x5a765ac7, 0x000045c7, 0xb387b3a7, 0xffb31baa, 0x9856981f, 0x0000c532, 0x39073912, 0xf0183919, 0x3d913db4, 0x00002274,
+        0xd2d9d2a5, 0x82e99c1f, 0xcd1fcd77, 0x00006678, 0x24512401, 0x41796863, 0x33ab33de, 0x0000fb4d, 0x16211605, 0x9a1effc5, 0x79777987, 0x0000b2dd,
+        0x540654bb, 0x972302f4, 0xb384b32c, 0x00009423, 0xea0eea75, 0xc40b0b16, 0x0a6e0a55, 0x0000c412, 0x2d5b2d9f, 0x0f84471d, 0xfce1fc4d, 0x00008330,
+        0xe3fae3a7, 0x249c5431, 0x995799bd, 0x00000272, 0x74c0744c, 0x2d21958c, 0xf7eef7f5, 0x00006ae0, 0xfbcefb6e, 0x2e53925a, 0xbee2bee5, 0x0000c0e7,
+        0x39ea395d, 0x3e1dee33, 0x210821f0, 0x0000e189, 0x1bc91bd5, 0xbc4b01cd, 0x532b534f, 0x0000c313, 0x0c1b0ceb, 0x834e1fda, 0xd4bbd4cf, 0x000065f0,
+        0x453f4503, 0xed53c189, 0x6f656ffd, 0x0000aad0, 0x6d966df6, 0x7f2b73d3, 0x480c484a, 0x00002865, 0xae5aaebe, 0xa88029fb, 0xac34ac1a, 0x00000fe6,
+        0x93c1938d, 0x175164a2, 0xebeceb42, 0x0000b250, 0x9b299be7, 0x262e76db, 0x15a41593, 0x0000c310, 0x3f453fe0, 0xa51dd40a, 0x2c232cf8, 0x000047ac,
+        0x560356df, 0xbe136e48, 0x974a97b4, 0x0000dbb6, 0x633a63f0, 0xe283e6e8, 0xdff2dfb6, 0x00007c81, 0xa4dda461, 0xdb5474d9, 0x35f23551, 0x00007206,
+        0x1a701a34, 0x65e366a7, 0xb9c4b99f, 0x0000a0fa, 0xf50ff5d1, 0x18e4675a, 0xe882e87a, 0x0000e17b, 0xf25cf20d, 0xf55f20e2, 0xb652b6e8, 0x00008b3f,
+        0x5ddd5d63, 0x55f083d7, 0xf325f3bc, 0x0000d51b, 0xe779e73b, 0x1e55a5ef, 0x7ac87a3d, 0x00008d71, 0x86698661, 0x4dd515b9, 0xee53ee0d, 0x00001b02,
+        0x62fc627c, 0x01fa7150, 0xd74bd7ef, 0x0000c268, 0xd7fbd760, 0xc79c2635, 0x1da91d2f, 0x00005e54, 0xabd5ab43, 0x70cd4c83, 0xb418b4d5, 0x0000bbce,
+        0x0bdd0bb0, 0x0f154bca, 0xf58bf59f, 0x00004611, 0x9d8f9de7, 0xdf9e8d9c, 0x5c1f5cb2, 0x0000d8e6, 0x2fc52f2f, 0x5252dde8, 0xce87cef2, 0x00002556,
+        0x7319733d, 0xb46c5cfd, 0x36bc36fb, 0x00008bb1, 0x6d6d6dcd, 0x71da4c29, 0xa515a50b, 0x0000ad85, 0x7250729e, 0x382b9d6a, 0x1bc71b88, 0x00008880,
+        0xb1e5b17a, 0x047b27d0, 0x847c843f, 0x000043b0, 0x5adf5a24, 0x574d2932, 0x67fd67e4, 0x00006ad7, 0xd206d2a1, 0x0a5f2c54, 0x953695eb, 0x0000531f,
+        0x7256720f, 0x2bc1c248, 0xb7ddb708, 0x0000a491, 0x3f9b3ff8, 0x30b07bd2, 0xc9abc95c, 0x0000fc1a, 0x37ae37dd, 0xeab1841f, 0x9b169b2b, 0x0000dcbf,
+        0x57bb57bd, 0x42b832e0, 0xd41fd483, 0x0000bf40, 0x9509954e, 0x52d8a4ab, 0x0177017f, 0x0000db29, 0xec44ecf3, 0x8ddb9160, 0x324432f1, 0x00007f06,
+        0xec81ec2b, 0xc17cd5a3, 0x661a66fe, 0x0000cb94, 0x57085741, 0x09e3232b, 0x46b746e7, 0x00005bdc, 0x6dfa6ded, 0x647f59dc, 0x569e5647, 0x0000af78,
+        0xf2e0f242, 0x6fd01686, 0x196b199e, 0x0000d5d7, 0x2f6d2f9a, 0xf69638b2, 0xdd0edd78, 0x0000fe88, 0xf7fff715, 0x29fda8bf, 0x8f3d8fe6, 0x00003011,
+        0xc2a9c255, 0x08d7b8b5, 0xa229a29a, 0x0000a31e, 0x086c089c, 0xeef36c7d, 0x774a775e, 0x0000d5eb, 0xa33ca3c2, 0x9fc75b73, 0x2bfa2b1d, 0x0000e9dd,
+        0xe29ae287, 0xec6cd404, 0x355c355b, 0x000083dd, 0x98dc98bd, 0x4206a934, 0x0c2b0cf7, 0x0000f363, 0x464746dd, 0x22d2dea5, 0x2433241e, 0x0000f5f9,
+        0x711e7189, 0x25f35240, 0x00fe00a8, 0x0000b9d0, 0x0c5d0c74, 0xcaeda3e7, 0x293029a7, 0x0000a2ce, 0xc9d4c9e7, 0x6cc3eef3, 0xdeaade15, 0x0000db1e,
+        0xed0ced4f, 0xa441733e, 0x9e4d9eb7, 0x00003475, 0xf936f9c3, 0xff4896f2, 0xb001b0d3, 0x00008880, 0xd5d7d58c, 0xa27c9829, 0xc45ec4ee, 0x0000dcbb,
+        0xa536a515, 0x647f0ff8, 0x26132601, 0x00000c0d, 0xcba4cb6c, 0x061505c8, 0xf89df89e, 0x000045e7, 0x88cd88ec, 0xf174553d, 0xed56edf5, 0x0000c593,
+        0x2fe32fed, 0xc8b92cc6, 0xccb9cc65, 0x0000384c, 0x7fca7fbe, 0xd2a9900f, 0x73fc7339, 0x000050d8, 0x17c417d8, 0x03c665e7, 0x6f006f4c, 0x00002da4,
+        0x0c3c0c9a, 0xaf2258a3, 0x7817781f, 0x0000f662, 0xab43abc1, 0x3a56e5da, 0x9e709e86, 0x000072bf, 0xfebbfed4, 0x55560e5b, 0xba45ba34, 0x00007d28,
+        0xc530c542, 0x11416196, 0xbd49bd62, 0x0000c1e7, 0x60566025, 0xf4aeb3da, 0xd78cd7c6, 0x00003b72, 0x02050268, 0xf103f1cb, 0x77e8776e, 0x00002f2c,
+        0xd9ebd9e0, 0x19eac958, 0xeeceeed0, 0x00009b09, 0xb5d3b525, 0xe6dc7b3d, 0x867086d9, 0x00006b8b, 0xb8b3b8ef, 0x591dc86e, 0x69666923, 0x0000115b,
+        0xc7dac7fc, 0xf1aed826, 0x6efc6e57, 0x0000bbac, 0x5f245f62, 0xf11c138b, 0x05690563, 0x0000cf8d, 0x82be826a, 0x26214a1d, 0xed79edd4, 0x00009c0e,
+        0x57e15743, 0x65ba58dd, 0x075a0755, 0x0000f278, 0xcdd9cdfd, 0x3ef5d973, 0xcbf4cbf8, 0x00005360, 0x1bf61b2e, 0xc7eb0b59, 0x7727773c, 0x0000fc5c,
+        0xd43fd461, 0xb9dcd3cb, 0x7e507e38, 0x0000f5fd, 0xf1a0f1aa, 0x1f4cfbbe, 0xd3add3f7, 0x0000b910, 0x8141813e, 0xa7ffdc57, 0xe886e83d, 0x0000e9e2,
+        0xdfb7dfb5, 0xe71ec96e, 0xa399a39d, 0x00009514, 0x8dcf8dba, 0x11526fc9, 0x3020308d, 0x000018ba, 0x9f9b9f5c, 0x6de319a8, 0x1a1a1a3b, 0x0000b4f6,
+        0x5d795deb, 0xe95ce98c, 0x1a581a91, 0x00001398, 0x94cb940f, 0x094af2d7, 0x11941191, 0x00007666, 0x5f895f5e, 0x5b75c998, 0xb94db9ac, 0x000049f3,
+        0x8fe98f8c, 0x1f4ce2e9, 0x23a023f5, 0x0000dbeb, 0x48d54830, 0xe2434bb3, 0xf87bf8d3, 0x00008373, 0x15e91567, 0x80d8da5b, 0xf80af804, 0x00005706,
+        0x16f71620, 0xa29cacc0, 0xb8cab86c, 0x0000beee, 0xb33bb351, 0x7bfb9833, 0x8a1c8a3a, 0x0000ff12, 0xbaefbae1, 0x1fb552ed, 0x3c093cd9, 0x0000e103,
+        0x257a25dc, 0xad333f83, 0x0e6c0e37, 0x0000d666, 0x28c628c0, 0x71a8f7dc, 0x56a75642, 0x0000ab56, 0xe77ce74c, 0x359f44db, 0x4d374d97, 0x00009eae,
+        0x496e49ad, 0xc9a57510, 0xc1f4c14c, 0x0000b543, 0x421042cf, 0x49563d8d, 0x9d3a9db1, 0x00005cb0, 0x291e293a, 0xd8c437df, 0x63d66378, 0x00001317,
+        0xf7fcf745, 0xed7956fc, 0x262a2654, 0x0000ee5f, 0x91a291a4, 0x04ed6c37, 0xa1e6a1b8, 0x0000ab2c, 0x73937329, 0x8516264b, 0x857085ec, 0x00007f40,
+        0xc28cc288, 0x85377fc0, 0xc10ac11b, 0x00001a6e, 0x8d968d7c, 0x2ca00ca1, 0x20602047, 0x0000e2b1, 0x821b8222, 0xe6e93991, 0xfdcafdf7, 0x0000c8ce,
+        0xa258a287, 0xf01e5a1c, 0x14671441, 0x0000a82e, 0x851e85db, 0x2ba3a841, 0x33aa33eb, 0x00004f30, 0x0e670eee, 0xb7758bec, 0x02ee0234, 0x0000afff,
+        0x430743d6, 0xc08505b7, 0x6829685c, 0x000000a1, 0xde72debe, 0x2052d057, 0xc35dc3e5, 0x00004e08, 0x01c4017f, 0x60b5e4dd, 0x94d99436, 0x000095b4,
+        0x9e4c9eb7, 0x80373eb1, 0x028d0242, 0x0000f38c, 0xada6ade1, 0x454836df, 0xbd97bd95, 0x0000c413, 0x35a63548, 0x4366400a, 0xb7d3b7d7, 0x00009a16,
+        0xe015e0c7, 0xd38bf469, 0x5c7d5c38, 0x00000283, 0x4699467b, 0x65cd38f0, 0x94b894cf, 0x0000e232, 0xf2faf2d5, 0x44f989fe, 0x63376391, 0x0000f0d3,
+        0x30e63087, 0x48c59405, 0xcc7acc60, 0x0000a055, 0x98a39811, 0xb362a1d1, 0xc2eac208, 0x00006168, 0x34c83479, 0x45a61d58, 0x66be6634, 0x0000c2af,
+        0xe515e521, 0xf495242b, 0x610a613b, 0x0000c82d, 0x4e2a4e3f, 0x255a6eb4, 0x7c747cc8, 0x00001d9c, 0xd0edd0fd, 0xa4be7de1, 0xcad6ca66, 0x00003ce6,
+        0xbba7bb9c, 0x5672a7d4, 0xa3d4a37d, 0x0000d09b, 0x27dc277b, 0xf4dd0376, 0x79567944, 0x000031ab, 0x92ca9208, 0xdda450c0, 0x98b198ab, 0x00001ae3,
+        0x31233188, 0x4e570277, 0xce65ced2, 0x0000c173, 0xc93cc929, 0x6c80b281, 0x158f1504, 0x000049f2, 0x71367159, 0xc962e69b, 0x946094c1, 0x000029db,
+        0x256b2599, 0x84fc2fcb, 0x4205426e, 0x00005bcf, 0xb84fb8e7, 0x192e2581, 0x11b5115a, 0x00009197, 0x42164261, 0xf691c518, 0xb9f4b931, 0x00006d82,
+        0x191519e3, 0x5d146215, 0x484a488a, 0x0000406e, 0xb085b0d1, 0x2278a053, 0x02e5021b, 0x00009222, 0xe1d3e186, 0x8d385eb1, 0x67ed6723, 0x0000ff9e,
+        0xb39cb370, 0xd3c8ba7f, 0x4c774cde, 0x0000368c, 0xcae5ca54, 0xb73f0d86, 0x7e667ee7, 0x0000e345, 0x05db050a, 0x1076b201, 0x086e08cb, 0x0000d2e0,
+        0x3a003adc, 0x583fca34, 0x49bb4971, 0x00009cc8, 0x9d6d9d34, 0x8dc4cfee, 0xc7bbc742, 0x0000d5eb, 0xb908b9ec, 0x199f2226, 0x28a8281e, 0x000087bc,
+        0x5b2f5b47, 0x6e61e2e3, 0xc0c7c09a, 0x000080a1, 0x77017746, 0xaffd4f2a, 0xc2f4c28a, 0x00005e12, 0x3f393f19, 0x9fe75d13, 0xa980a9b5, 0x0000caf0,
+        0x8b6e8bc9, 0x971ce305, 0xaacaaa07, 0x0000a53c, 0xccd4cc02, 0xe922dfd4, 0xadd4ad7f, 0x00002864, 0x6b4c6b6a, 0x38b66c25, 0x881c886a, 0x0000015d,
+        0xbfd4bfc5, 0x8aa66ec8, 0x459b4579, 0x00005f34, 0x16f1162e, 0x8c588994, 0xc8f9c843, 0x0000357c, 0x7942795c, 0xf8889113, 0x692469b0, 0x0000c3de,
+        0x569b5632, 0x6250ab15, 0x77e9770c, 0x000045bb, 0x9aa99aeb, 0xc2caf53a, 0x14ed1473, 0x0000f4a8, 0xfd1ffd44, 0x5b0a288f, 0x2c3d2c50, 0x0000cc12,
+        0xc75dc7fb, 0x99f1dba5, 0x1e121e5a, 0x0000409d, 0xf68af62c, 0x11d98ad7, 0x0604062c, 0x00003e4c, 0x5a1b5acf, 0xbe1be1ab, 0x612661f7, 0x0000daa3,
+        0xb8d1b899, 0xb60059e3, 0x5f545f73, 0x0000e17a, 0xdfbfdfa4, 0x7a268d82, 0x21e82165, 0x00006577, 0xcf56cf58, 0x42560ee7, 0x7c3d7c07, 0x0000a9a6,
+        0xa418a44c, 0x4b09c6ba, 0x39d03931, 0x0000182a, 0x91d991e4, 0x954e5b23, 0x995699e5, 0x00008772, 0x2c432ca2, 0x8125d6cb, 0x32a132e2, 0x00005165,
+        0x3a033adb, 0x1815c2c7, 0x4d404d88, 0x0000b5a8, 0x1bbf1b42, 0xb303726f, 0xa999a90f, 0x000053fa, 0xc6ecc608, 0xc114ac3e, 0x7f2b7f3b, 0x000073c2,
+        0x7d327d91, 0x9f899a55, 0xd49bd412, 0x0000b8b1, 0x968696d2, 0x20ad7f70, 0x62096268, 0x000028a4, 0x7f2e7fa2, 0x0506dde5, 0x30f8306c, 0x00006800,
+        0xd6e9d6f4, 0xef53d6c9, 0xbf39bfb6, 0x0000d387, 0x81d78122, 0xf92926ab, 0x5c385c34, 0x00006109, 0x84918419, 0xb41eb779, 0x8f9d8f0c, 0x0000fffd,
+        0x38b238d3, 0x4ca03df2, 0x71ee71b3, 0x00002dc7, 0xe206e27a, 0xa0c44fea, 0x484c4849, 0x000071b6, 0x30c630fb, 0x460153f0, 0x50dc506e, 0x0000d3c6,
+        0xd19ed1b5, 0x9e56c535, 0x69cb6999, 0x000091c6, 0xcacbca34, 0x16f933df, 0x44d54498, 0x0000d4a5, 0x8b6a8bb6, 0xbe1b31e0, 0xbb87bbfe, 0x0000a5b4,
+        0x0c6b0c13, 0x850710de, 0x8c788c92, 0x00001436, 0x6b3b6b8c, 0x964aec52, 0x057d05ad, 0x0000f372, 0xdda8ddb8, 0x86271a7c, 0x3f163f08, 0x0000fc32,
+        0x222a22ad, 0x550f4f6f, 0xd14ed1b9, 0x0000033d, 0x1c351cd3, 0xc4caab60, 0xa76ea7d8, 0x0000db67, 0x53a15376, 0x046d892e, 0xd0aad096, 0x00001fe3,
+        0x71ed71b4, 0xc8c68cde, 0x602060f4, 0x0000c8cf, 0x5aa85ade, 0xac21632d, 0x5050501d, 0x000036ab, 0xdd3ddd40, 0xde54388f, 0x2aed2a16, 0x00007931,
+        0x7ee47e0a, 0x5b8237a1, 0xa476a4b0, 0x0000a2e8, 0x352e35f1, 0x96ca20e6, 0xdf03df0a, 0x000067af, 0x24d52479, 0x40b09133, 0x8be58bc7, 0x000040ee,
+        0x68a86896, 0xd6050061, 0xcbeacb17, 0x0000433f, 0xd833d8fa, 0xfa492b74, 0x5eef5e01, 0x000064b5, 0xe8f9e862, 0xaf5b66c5, 0xe28ae2a2, 0x00005008,
+        0x1d391df5, 0xfcf7c6a8, 0x585e58bf, 0x0000f62e, 0x17c21768, 0xc7177dab, 0x4b4a4b45, 0x00008bee, 0x62216208, 0x36cdeaf2, 0x3a143ae3, 0x00001b73,
+        0x93df9347, 0xb94573ef, 0x8b1f8b42, 0x0000c76d, 0x151c1551, 0x9fb88483, 0x7fc97f29, 0x0000bcee, 0x0ddd0d64, 0xbb2b2c99, 0xea2fea4b, 0x000065a6,
+        0x09f709e7, 0xd792695a, 0xa299a28e, 0x00008cb1, 0xdfa0dfe4, 0x544d0d46, 0xeb2eebac, 0x00002bbb, 0x6d7b6d93, 0x126adbec, 0xc910c922, 0x00007e9d,
+        0xe503e56a, 0x91837eff, 0xe3dee3d1, 0x000084a2, 0x85828529, 0x5fbf22dd, 0x8f1b8f69, 0x00004cf6, 0xec81ec4b, 0x5507fd7c, 0x5caa5c43, 0x00006c99,
+        0x4a384a53, 0xe5a3c789, 0x948f94a5, 0x0000e64d, 0xfe3dfece, 0x99c956cd, 0xeca1ec47, 0x0000a8d5, 0xd7b9d7f0, 0x0e8acfb7, 0x58d7586e, 0x000010f7,
+        0x2751277a, 0x4361595e, 0xc1b9c1bc, 0x000083af, 0x7bdb7bd0, 0xba4f49a0, 0x71fb71b9, 0x00005dd9, 0x3dc03d09, 0xf9181bd0, 0x626a6224, 0x00003795,
+        0x852e8561, 0x487fffc5, 0xc2aac215, 0x0000e032, 0x367e3617, 0xcc249327, 0x83b883d9, 0x0000265a, 0xead0ea92, 0x8e98d6b5, 0x7e3d7ebb, 0x0000b409,
+        0x08b008b6, 0xf9d8fa9d, 0xda4dda1f, 0x0000b2dd, 0x65b66562, 0x1a6af524, 0x6d706d01, 0x000023a4, 0x6834686a, 0xd44f3a20, 0x627e62e0, 0x0000424e,
+        0x360736f7, 0xaeee72cf, 0x20a8209d, 0x00006814, 0x1ced1c18, 0xc9fad6ca, 0xa032a0a2, 0x00003611, 0x4c454c60, 0x217cc071, 0x46054640, 0x00001b05,
+        0xbbcbbbee, 0x74478aa7, 0x066a069b, 0x0000dcd5, 0xebd1ebd8, 0xaa331b53, 0x7acd7aac, 0x0000988d, 0xfc31fceb, 0x9169c51a, 0x2f3c2ff4, 0x00006d15,
+        0x3b6c3b32, 0x9ced0374, 0xd4fcd40d, 0x000098d1, 0xdad0da22, 0x87f7044b, 0x8084809c, 0x00008201, 0x7e537e05, 0x541958a4, 0xeb97eb3d, 0x0000df21,
+        0x9de99d86, 0x328ac143, 0x014701ea, 0x0000b8ac, 0xe1d2e187, 0x97ab73d0, 0x8a958ac6, 0x0000ea17, 0x70497000, 0xdf74de1d, 0xdb75db70, 0x00004204,
+        0x575857bb, 0xc5bcf314, 0xe74ee782, 0x0000a564, 0xd641d68f, 0xc6f4d42a, 0xe4ece442, 0x0000060c, 0x397e39e3, 0xaaad501c, 0x27142742, 0x00008f1a,
+        0x3cc73ca3, 0xd24070f6, 0xb98ab941, 0x0000c18d, 0x48a0486d, 0x46ef6f85, 0x6c186c6f, 0x0000df57, 0x6058608d, 0x37f894c7, 0xdc34dcc9, 0x0000e53f,
+        0xf0e2f048, 0xfaeefb8e, 0x0b990bff, 0x00009214, 0x3530358a, 0x4926ac20, 0x68376803, 0x00001164, 0xdce9dc9b, 0xdf1a8880, 0x05f80549, 0x00009850,
+        0xea9deadf, 0x07156196, 0x00dc00c0, 0x00001302, 0xe22be23a, 0x692e49df, 0xef0cef15, 0x0000cf07, 0xf6e7f6d7, 0x65d664a2, 0xd85bd8fe, 0x00007aa3,
+        0xe733e709, 0xcd459faa, 0x2d162d23, 0x0000e4d6, 0xe66be63c, 0xd1759fea, 0x50ac506b, 0x000090e0, 0x270c2736, 0xd18180ef, 0xbc06bc7a, 0x000001a0,
+        0xac0cacaa, 0x10e13d71, 0xf541f51e, 0x000057f8, 0xc6c9c636, 0x7fce45c3, 0xd25cd24d, 0x0000f552, 0x53b7532f, 0x1993219b, 0x7f657f23, 0x00003a13,
+        0xc8c8c8d7, 0x9053e3d3, 0xce58cebb, 0x0000b9bc, 0xa6caa68e, 0x3f076aca, 0xc8dbc80c, 0x00009a8a, 0x6c726c81, 0x48e87c78, 0x024202e6, 0x0000b0a8,
+        0x3117313b, 0x18e580f3, 0x56465643, 0x000044ed, 0xb4c8b416, 0x8204d287, 0xb5bcb5ca, 0x0000b3b3, 0x4fe54fec, 0x5d177d04, 0x9e6e9eae, 0x00004e08,
+        0xd715d760, 0x5089da5d, 0x460146de, 0x0000f56e, 0x26a52642, 0x3ba085f3, 0x600d6092, 0x00005599, 0x4ac54a6a, 0x43872336, 0xc290c233, 0x0000ef48,
+        0xb892b86e, 0x57d9fdf0, 0x529e52c0, 0x00004a55, 0x0e1a0ee3, 0x94675eed, 0x858c85bd, 0x00007551, 0xb4e6b481, 0x3e61c3c3, 0x44cb4473, 0x00008080,
+        0x06e20649, 0xba4b04ca, 0x3c003c74, 0x0000187a, 0xe5a5e512, 0x68bf2626, 0x2d452d81, 0x00006c14, 0xedeaed21, 0x71cde973, 0x3e593e11, 0x0000ff62,
+        0x4d5a4d06, 0x76f62f44, 0x148e1425, 0x00002976, 0x0ac20a16, 0x0e5c4da8, 0x29dd29e0, 0x00007ea3, 0x8d5e8d6f, 0x00d88911, 0xa42ea4ae, 0x0000192a,
+        0xf281f229, 0xb68a219b, 0x5f4c5f02, 0x0000d6a8, 0xb19bb131, 0x27535a5c, 0x2d232dc5, 0x0000d067, 0x0d070d8f, 0x918e9338, 0xf89af887, 0x00005d26,
+        0x43db4332, 0x52a716ab, 0x003400a4, 0x000075e3, 0xd139d1f7, 0xd16486ce, 0x23a623f8, 0x0000b12f, 0xe97fe940, 0xe8b3451d, 0x9c629cc5, 0x0000616b,
+        0x6e7c6e13, 0xeee94e0b, 0x9cd69cf3, 0x00008571, 0x5cde5c91, 0xadcd5d83, 0x1fe51fee, 0x0000b831, 0x65cd655a, 0xec5c6ed5, 0xa3b7a316, 0x0000357a,
+        0x32e632a2, 0x7b8fa120, 0x1c981c86, 0x00001fac, 0xa65fa60d, 0xa59e88d0, 0x78167839, 0x00002a7b, 0xef07efc8, 0x1f3a2134, 0xbc74bc03, 0x00001616,
+        0x9d029d1d, 0x91f188be, 0x5fb35f56, 0x00005ce8, 0x6c5b6cb9, 0xb02a2ec6, 0x877e8795, 0x0000d404, 0xdcc0dc7d, 0x27b37e3a, 0xe5b6e5d0, 0x0000648b,
+        0xf123f1bb, 0xab51a25e, 0x2513251f, 0x0000c012, 0x6eb56e69, 0x6840e75d, 0xda1fda3b, 0x00002866, 0x99c09928, 0x1e9394f3, 0x04ad0473, 0x0000e899,
+        0x01310167, 0x3e8d57ce, 0x8aaa8a04, 0x000058c7, 0x1c901c35, 0x14aecb23, 0xe86de8bf, 0x00002311, 0x4ac54aa0, 0xce55d923, 0x5e665e23, 0x0000e4ab,
+        0x960c9664, 0x59b784ef, 0xb114b176, 0x000063f6, 0xb97eb904, 0x55dd3756, 0xfd23fdfe, 0x0000b542, 0xd24dd28e, 0x9526fec7, 0x8ca88ce1, 0x0000d6b9,
+        0xbb36bb52, 0x29bfca50, 0x95a295b1, 0x00008953, 0x434943f9, 0x44c1fefc, 0x260a269a, 0x0000b221, 0xeca5ec7c, 0xe4dea392, 0xe4b0e4fa, 0x0000d5a5,
+        0xf845f879, 0xdf9ef356, 0xbf1dbf5b, 0x00000272, 0x86bc868e, 0x595c2b45, 0x6a1b6a72, 0x00007efe, 0x33ab33a9, 0xc2f48841, 0x34f73453, 0x00006e67,
+        0xf694f650, 0xa0be6ecb, 0xe831e85f, 0x00002547, 0x6be06b37, 0x33aa19f5, 0x76517660, 0x0000dbea, 0x5244523f, 0x31569b57, 0xd866d82c, 0x0000789d,
+        0x892f8969, 0x763ea2c0, 0x394d395f, 0x0000b354, 0xbaf5bae7, 0x967344a9, 0xcaaaca24, 0x00007552, 0x439f43ae, 0xc52a0486, 0x14ee1425, 0x000030cf,
+        0xef0fef7e, 0x3247824c, 0xe747e788, 0x000088e4, 0xd4e3d47f, 0x6ed1f663, 0xc3c2c394, 0x00005adc, 0x394a3955, 0x8516a4ab, 0xb5c9b564, 0x00006578,
+        0xe117e126, 0x512d4956, 0x1253129a, 0x00005648, 0x96a396ff, 0x5c2d5d3f, 0x81a08184, 0x00008272, 0x002d008e, 0x80e9bab5, 0x3215329d, 0x0000b7f3,
+        0x43eb4308, 0xe3ddac54, 0x9d7d9d21, 0x0000a84b, 0x8a448ad6, 0x8716a253, 0xc9aec948, 0x0000be10, 0x92f092bb, 0xa5c20274, 0x95fc9540, 0x0000eaf6,
+        0x3cdc3c2e, 0xe4207519, 0x68d0687d, 0x00002037, 0x6f696fe3, 0xbc4b5a5c, 0xcffbcf6d, 0x0000e899, 0x9d5c9d1e, 0x72a8fdc0, 0xa2e7a216, 0x00004d81,
+        0x1c051cdb, 0xfa99bfc8, 0x9be19bff, 0x00004325, 0x01090193, 0xf3f932e0, 0x606560fd, 0x0000c01d, 0xc792c791, 0x8e96af0b, 0xb00ab097, 0x000077b0,
+        0xdcdedc8c, 0x304a19aa, 0xafc7af9a, 0x0000efc3, 0xe902e951, 0x290183cc, 0x14b21469, 0x000036b3, 0xdeeaded8, 0x2a439d1f, 0x497e49b8, 0x00009fe0,
+        0xa70fa789, 0x5b0aa552, 0xd9a7d929, 0x000049a3, 0x0f7c0fcb, 0x4d58e972, 0x68816836, 0x000084fe, 0x4daf4d1f, 0xe3dd0048, 0x994599af, 0x0000b782,
+        0xaabbaa53, 0x29d66874, 0x329c3230, 0x0000f642, 0x9de19d74, 0xe47c1367, 0x852385dd, 0x00001a0c, 0x6a0b6ae7, 0x6c600e0b, 0x559955a3, 0x000066b1,
+        0xc32ac3af, 0xb9cc0b9c, 0x234723c0, 0x00007623, 0x5b455b3b, 0xc3bb7564, 0x2a842a19, 0x00007860, 0xff76ff18, 0x50e792c5, 0x9e049edf, 0x00007aa3,
+        0xd918d911, 0x4b748aa1, 0x4da04d66, 0x0000d13b, 0x299b29cd, 0x06639361, 0x1b621be5, 0x0000f162, 0xbc32bc49, 0xf3195e38, 0x0b570b03, 0x00007afe,
+        0xf949f96c, 0x1e15a5d3, 0xb2b9b21f, 0x000033b2, 0x6b1a6bd6, 0xad2395f7, 0x9cdd9c46, 0x00002a05, 0x9fa39f28, 0x1d4d460d, 0x7d337d69, 0x00009a6b,
+        0xaa62aaaf, 0xb8842f39, 0x6f026fe5, 0x00007fdc, 0x78f27809, 0x030529f9, 0x3bb13b7b, 0x00003641, 0xbf7fbf2e, 0x9a8d675c, 0x50805020, 0x0000cbab,
+        0xfb8bfbbc, 0x76624030, 0x3669369e, 0x0000ccc5, 0xad7eadfd, 0xd6901622, 0xdb71db5a, 0x0000a0ba, 0x298129bc, 0x0424a4aa, 0x3524359f, 0x0000b176,
+        0x313231f3, 0xad2efbfa, 0xa069a0b9, 0x00000e5d, 0x228b228a, 0x9af192c6, 0xa925a912, 0x00007460, 0x72f87275, 0xb666c6a8, 0xc4a0c449, 0x0000ce07,
+        0x53b5537a, 0x40c78d71, 0x129b128b, 0x0000bd6f, 0x10f51046, 0x9eed1dab, 0x8d6b8d3a, 0x0000ef9b, 0x16341688, 0x9aa552c3, 0xce3dce86, 0x00006d23,
+        0xd553d55a, 0x46c661e4, 0xf347f328, 0x0000dc9d, 0x2808289c, 0x43a605a6, 0x4ed54e8a, 0x0000b5b6, 0xbf87bf20, 0x83386c8c, 0xfda1fd7a, 0x00009d30,
+        0xb688b656, 0x4ff606bc, 0x873087fc, 0x00009101, 0x3b5c3b34, 0x5cb2dee4, 0x17ae17e9, 0x00003c13, 0x8f318f5b, 0x9f1f68f4, 0x1460143a, 0x00008c61,
+        0xf7baf7a8, 0xfeee3bff, 0x6244628b, 0x0000eeef, 0x402e400b, 0xa90d508a, 0x6a336aff, 0x000022b6, 0x3aa33ad1, 0x2478a42e, 0x963996e8, 0x0000933e,
+        0x85a0857d, 0xb4f413b9, 0x6c026c5b, 0x0000c8b5, 0x96689627, 0xf228de51, 0x7a0e7a74, 0x0000c712, 0xc0fcc08c, 0x4e89ab73, 0xd223d22b, 0x00000d5d,
+        0xa4f8a48c, 0x7af6d233, 0x3a7c3a65, 0x000044a1, 0x8a7e8a75, 0x9fb8bea0, 0x8a078a8c, 0x00000e26, 0x28132815, 0xd91d2113, 0x0eab0efa, 0x0000f4bc,
+        0xb764b767, 0xa291a52f, 0x02ab02d9, 0x0000f519, 0xd113d15e, 0xb3e147ce, 0x62a5620d, 0x00007e72, 0x36aa3675, 0xe2a3fbbd, 0xf58df58d, 0x0000bd2c,
+        0x75277558, 0x1b6a074b, 0x4504456e, 0x00000433, 0x95a8950e, 0x0a5dc2ce, 0xeb53eb11, 0x0000197a, 0x8eb38e2d, 0x70e2bfcb, 0x144814e5, 0x0000a19a,
+        0xd914d9d7, 0xf6187e84, 0xc182c13d, 0x00002e66, 0x703570a2, 0x0f8720bf, 0x8649863a, 0x0000212a, 0x52ef5279, 0x75cdda26, 0x6be46bea, 0x0000fffd,
+        0xb138b1d3, 0xf551908f, 0x19d5197f, 0x00003941, 0x2bf62bd3, 0x38884538, 0xd78dd70c, 0x0000c62c, 0x943e9482, 0x1eac454d, 0xbc07bca1, 0x0000fab9,
+        0x9e2f9e1d, 0x59b95aa3, 0x5c455c55, 0x0000ff62, 0xa6d7a648, 0x2558dd66, 0xfa3bfacd, 0x00001417, 0x29c629ec, 0xbd6da3e0, 0x982a98e6, 0x0000e7c0,
+        0x3b293bd1, 0x54df9a55, 0x1c781c74, 0x00003f4d, 0x67db6792, 0x6a5065a4, 0xa34ba321, 0x0000c2b8, 0xdbebdbeb, 0x8025d88a, 0x5e285eeb, 0x0000ce8c,
+        0xe71ee74c, 0xfc395ba5, 0x6746677f, 0x000017d5, 0xdeebde60, 0x6d913fcd, 0x411841bd, 0x00008772, 0xfd4cfd1a, 0xd081f256, 0x5a065a97, 0x000038b8,
+        0x395f3918, 0x3076396e, 0xd4f3d484, 0x00006935, 0xd7b6d7cb, 0x03f4b003, 0x566d5646, 0x0000627a, 0x29642964, 0x9528da2c, 0xec11ecb2, 0x00003240,
+        0xbae8ba17, 0xa9814d55, 0xd40fd4f1, 0x000049a8, 0x4e794eb3, 0x67b284ff, 0x465946bd, 0x00002f63, 0xa237a269, 0x3a3cebf3, 0xad36ad21, 0x00004411,
+        0x6a6e6a0b, 0xb7cc18a8, 0x39bd3957, 0x0000e337, 0xf08af0f9, 0x07a4f12b, 0x97c29792, 0x00003f33, 0x28c228e8, 0x5de70f46, 0xb214b24c, 0x0000a629,
+        0xbad3ba68, 0x03f11c32, 0x858d8553, 0x0000850e, 0x79127914, 0xa8016d86, 0xcc12ccc7, 0x000079a3, 0x4bfa4bc5, 0x080a8332, 0x351e35c1, 0x0000dbad,
+        0xe223e2aa, 0x833715fe, 0x8a198a1a, 0x0000f35c, 0x48f748d6, 0x04c3330e, 0xa299a28e, 0x0000cf2e, 0x7048707b, 0x08e0b2f1, 0x521252f8, 0x0000772d,
+        0x471a472b, 0xcbedab4c, 0xdab5da50, 0x000092ea, 0x4db84d93, 0x948a6296, 0x4a6a4a45, 0x0000820e, 0x32a6322a, 0x0744309d, 0x458f4577, 0x00000362,
+        0xc893c890, 0x5a3c387b, 0xa14aa1bd, 0x00000248, 0xa78ea7ff, 0x3129d038, 0x45fb4559, 0x00004525, 0x9e3f9e9c, 0x8dd7b0d8, 0x472147a2, 0x00001016,
+        0x6e136ee3, 0x4bf66cf4, 0x3a693ac1, 0x00000ced, 0x7cb27ca8, 0x33f643f8, 0x5336530e, 0x0000f426, 0x5ad15a40, 0xa51d8ea1, 0x07b00702, 0x0000308c,
+        0xae11ae1a, 0xe2322f45, 0x5dc65d80, 0x0000aa36, 0xbb2abb5b, 0x9c3ec001, 0xd05ed03e, 0x00006291, 0x7663767c, 0x1ac862d5, 0x002d00dd, 0x0000a7af,
+        0x293e296e, 0xea5873f0, 0xdfa9df96, 0x0000fc73, 0x5a7e5ae1, 0xeec76e57, 0x8e4a8e85, 0x0000682a, 0xa7e0a7fb, 0x96ca47b2, 0xe953e90c, 0x0000364a,
+        0x73a9739b, 0x01352039, 0xe36ce327, 0x00001aa5, 0x0d650da4, 0x6ca33005, 0x2cc62cca, 0x000057fa, 0x5d315d41, 0xa31dac65, 0x35c33578, 0x00006190,
+        0x467e460c, 0x7beabe8b, 0xa976a9d2, 0x0000d388, 0xbf4fbfeb, 0x0747f028, 0xe933e95b, 0x000038e6, 0xe9b4e9d2, 0xb5701855, 0x1ce21ca6, 0x00007d61,
+        0x2c6e2c9a, 0x290223f6, 0x7ff47fb6, 0x00000d87, 0x87598737, 0x4817ea0c, 0x1c5b1c34, 0x00003ef3, 0xcd59cd11, 0x98727862, 0xb6fab6be, 0x0000685a,
+        0x2cf02ca9, 0xfe11ffac, 0x2667264a, 0x00004f43, 0xc937c96f, 0xcf34e9b0, 0xe1b0e102, 0x00004fcc, 0x7ac57a43, 0x5fdc1bef, 0xe112e1fa, 0x0000b4f1,
+        0x991e9920, 0xaa132593, 0x3b323bab, 0x00007e10, 0xd112d19d, 0x6c1cc1ba, 0xf4c1f4cc, 0x0000b83a, 0x455045f6, 0xcf25d23b, 0x42c64291, 0x000020a4,
+        0x1cc31cc8, 0x469913b5, 0xc317c3e4, 0x00002486, 0xdc24dc2d, 0x0c3b7849, 0x537c5374, 0x0000065d, 0xc2d0c2b7, 0x85f7e4c7, 0xdb6edb4f, 0x0000d026,
+        0xbbeebb60, 0xe6610ad4, 0xabdeabb7, 0x000057f8, 0x146b140d, 0x3a025ca2, 0x713e7104, 0x0000b18e, 0xb35eb3d3, 0xd0f2dcb7, 0x4d6d4d38, 0x0000e553,
+        0x85a9856a, 0xe95c2885, 0x1b5c1b37, 0x000003ed, 0x5b5c5bdf, 0x331fa7b0, 0xd5acd595, 0x00003dd3, 0x01cc01fa, 0xd95fa72f, 0x172b17eb, 0x0000bc16,
+        0xb2d9b245, 0x51d858e3, 0x7e877eef, 0x0000f873, 0xf071f056, 0xe08048d5, 0x347c3435, 0x0000c831, 0x072e0795, 0x1930defa, 0xe27fe229, 0x000064b5,
+        0xdd76dd34, 0xba31b200, 0x21cd219b, 0x0000918a, 0x1cb81c79, 0x328cd9a3, 0x1dc91d7a, 0x00009a00, 0x83018385, 0xf20dec4c, 0xcf9acfd6, 0x000089d8,
+        0xcf3ecfd7, 0xad0d56f0, 0x0364038e, 0x00005e6f, 0xbc10bc91, 0x0bcb8731, 0x4b764bd4, 0x0000f793, 0xdf08dfc9, 0x9b5c8720, 0x82fd82bc, 0x0000ed89,
+        0xd87fd84e, 0xa8f2b529, 0x86fe860a, 0x00001ce2, 0x77557731, 0x1ef800f7, 0xcfd8cff0, 0x00009090, 0x2c6a2ccc, 0x96a6ae14, 0x43c94304, 0x0000f170,
+        0x73117338, 0x582f85c1, 0x00c600d4, 0x0000e145, 0x5f115f27, 0xfab60f27, 0xc0acc048, 0x0000ff63, 0xc57ec5fd, 0xdfcb9070, 0xc87ac828, 0x0000330b,
+        0x18a91857, 0xddff456f, 0xf233f26f, 0x0000728b, 0x99289918, 0xd4adbdc9, 0xa9c3a92b, 0x000066f7, 0xeff2ef8a, 0x0141315d, 0x7d3d7d06, 0x0000fd73,
+        0xa80ea82e, 0xef6cf2a8, 0x247a241b, 0x000034d4, 0x86c3868a, 0xe36326bf, 0x4af34a3c, 0x00008a1b, 0x63a963d6, 0xf1033e3e, 0x97c29732, 0x0000f11e,
+        0x0b910b00, 0x33c30ae6, 0xb0abb059, 0x0000028e, 0x3a4e3aea, 0xb1556c39, 0x993d990b, 0x0000dfda, 0xa2a5a298, 0xd8f82b26, 0x3a473afa, 0x0000648b,
+        0xa0b3a0f3, 0x004a2f29, 0x98549897, 0x0000ca7f, 0x26bd26ec, 0x4db7df5b, 0x542a5493, 0x0000b2ac, 0x01de01ce, 0xa2e28bda, 0x97f2974e, 0x00002aa4,
+        0x08de0856, 0x43369053, 0xfaf1fab4, 0x00003639, 0x2e642e9e, 0xcec26d6b, 0xc0d9c0cc, 0x0000c073, 0x4d644d10, 0xf31984ec, 0xb3ecb3bd, 0x00002a49,
+        0x406b408e, 0xc0f5e607, 0xf45cf4f1, 0x00009a50, 0x1c8d1ce0, 0x2bd21853, 0x94fd9434, 0x000096e0, 0xdac3dabf, 0xd5b076d9, 0x0ddf0d94, 0x0000a038,
+        0xea9feace, 0x47a785fe, 0xe753e7ec, 0x0000cf41, 0x97fb97f7, 0x7f5270cd, 0xbac2ba6d, 0x00008e71, 0x92339219, 0x35f58bde, 0xe012e0b3, 0x0000bf25,
+        0xd33bd354, 0x6350cb6e, 0xe368e308, 0x00003a1d, 0xb1d9b1d0, 0xb699d901, 0x69a169d7, 0x00002a76, 0x5045507b, 0x68bf8f81, 0x0f500f91, 0x0000000d,
+        0xcd28cdb4, 0xd8205c60, 0x335a3315, 0x000014d6, 0x98619859, 0x95af143f, 0xa07da0d1, 0x000022e7, 0x37023745, 0xf53d70cf, 0x7cbc7cf6, 0x00001ad8,
+        0xd042d07c, 0xf1857652, 0xbd5fbde4, 0x0000a899, 0xa8e5a8f3, 0x98f236bf, 0x0e3f0e05, 0x00003a8c, 0x97ea973c, 0x2287f5d7, 0x3767372d, 0x0000ff13,
+        0xf230f230, 0x6023315d, 0x1be61bad, 0x000011e9, 0xd2f0d2f4, 0xba138481, 0x163816fb, 0x000049a9, 0x1601162d, 0xad4d85fe, 0x2e572e30, 0x00003711,
+        0x6cd96cd9, 0xfffd1c30, 0x094209ae, 0x0000de74, 0x5b7d5bdb, 0x0e1c5ed2, 0xbbdabb09, 0x00005add, 0xb3e7b331, 0x8cee45c4, 0xcd44cdee, 0x000090cb,
+        0xececec2f, 0x74faf228, 0x4a324a30, 0x00001832, 0x18cd18dc, 0x186a7306, 0x483e484e, 0x0000c4c1, 0x9eb09e31, 0xfc8da550, 0xd5a2d596, 0x0000a9fb,
+        0xa232a283, 0xb699bdc8, 0x86f08670, 0x0000a574, 0xe046e020, 0x8a27daa7, 0x7f8a7f14, 0x0000ff1a, 0x171517d2, 0x71b168b9, 0x737473c7, 0x0000a369,
+        0x09a409c6, 0x660c1ca3, 0x44bf4495, 0x0000d1bb, 0x971c9720, 0xf6957ff6, 0xff9affa0, 0x000069e9, 0xf01ef006, 0x14415473, 0xc16ac190, 0x00001fca,
+        0xf554f5a5, 0x4aabf792, 0x11dc111d, 0x0000afa2, 0xc6a5c651, 0xbe8ea5ab, 0x6dd96d0b, 0x00000f1b, 0x425342c1, 0x444661eb, 0x5b785ba4, 0x0000283a,
+        0x120d12d6, 0xf3180286, 0x2768273e, 0x00001b7a, 0xba3bbab0, 0xad209639, 0x66b766ee, 0x00002c27, 0x10af10f7, 0x0bb4544c, 0x59d45963, 0x00002289,
+        0xe9ade9b6, 0x6f15a63f, 0xe58ce515, 0x0000f7b2, 0xa0e4a033, 0xeb0e101c, 0xdff1dfe0, 0x0000e73d, 0x6c086ca0, 0x716e6634, 0xf8fff8aa, 0x00000ef1,
+        0xd897d861, 0x0f68eacf, 0xaad3aa91, 0x0000a95a, 0xeb4cebf7, 0x7548d8e4, 0xb0d6b0df, 0x00005fe8, 0xedb5ed4e, 0x49392ceb, 0x05b9056a, 0x000074d1,
+        0x112511d4, 0x974c746f, 0xb27ab251, 0x0000ded7, 0xe5f2e5b8, 0x33aa3c4d, 0x0a7b0af6, 0x0000a055, 0x7c4e7c5a, 0x46053c19, 0x75627568, 0x000029fc,
+        0x70fa7023, 0x00d3b5f8, 0x9da49d3c, 0x0000fb0c, 0xf5f3f516, 0x6fa1a320, 0xf04af010, 0x00000cca, 0xe497e476, 0xb508a93f, 0x80a480b5, 0x00005f74,
+        0x68a66823, 0x2a7e9745, 0x469c46b7, 0x00001f3d, 0xe61ce6df, 0xe9424572, 0x9a6e9aae, 0x00000eed, 0x7d537d08, 0x840862a7, 0x8d6a8d31, 0x0000013f,
+        0x7241721a, 0x51a7c975, 0xfd65fd0e, 0x0000ca83, 0xf231f220, 0xcf46ccd7, 0xcfc7cfa3, 0x00003c30, 0x6d316db4, 0xfe0d89ec, 0x58fe581f, 0x000086af,
+        0x1a061a92, 0xf3ce7ab7, 0xde51de34, 0x00002487, 0x411041c3, 0xf69198fa, 0x70c3700c, 0x0000805f, 0x737c7343, 0x80d5c10e, 0xf015f0e2, 0x0000fc1a,
+        0x4e594e67, 0xe7e14dd5, 0x9e119e2c, 0x0000ea7b, 0x77df77ee, 0xe04037a1, 0x2e132e7e, 0x0000df99, 0x78d97810, 0x53bf2ac4, 0x0ecd0e26, 0x000064c8,
+        0xf315f375, 0x7f52643d, 0x1c101c3d, 0x0000026e, 0x84598434, 0xb9a975a6, 0x6ed46e6c, 0x0000e1e2, 0x283d2827, 0xcc27bb19, 0x1b081b8c, 0x00003795,
+        0x65e66587, 0x4b36506c, 0x9f509f89, 0x000049dc, 0xd801d8fe, 0x5ac6e1dc, 0x040c04c4, 0x0000ac2e, 0xa7eda7b4, 0x4a5678e2, 0x822b8299, 0x0000283a,
+        0xbcc4bc14, 0x94ca2ebf, 0xed11ed9a, 0x0000f6bc, 0x6c706cd5, 0x20c09b00, 0x7dcf7d81, 0x0000f738, 0x98ec9837, 0x293d5cd2, 0xa637a6eb, 0x00008186,
+        0x8bc18bef, 0x27526f00, 0xb215b2b6, 0x0000129a, 0x852d8567, 0xcda58965, 0xa4d4a470, 0x00003f4c, 0xb446b410, 0x946a29ff, 0xbc98bc2c, 0x00000421,
+        0x530d5333, 0x47c69adc, 0x043404a0, 0x0000b5ac, 0x4dc14dc4, 0x4f29f873, 0x99ae9912, 0x00004f04, 0x49274912, 0x2b63f84e, 0x81dc8131, 0x00008d95,
+        0x482348e2, 0x4c27a9bd, 0x5d915dc6, 0x0000cb8d, 0xe161e107, 0x8bfaeaa4, 0x03690357, 0x0000ed89, 0x13101398, 0xee12c49e, 0x9fe29f18, 0x0000bc18,
+        0x111f113e, 0xcc9a0927, 0x85898535, 0x00005258, 0xc991c942, 0xf3ce6eba, 0x229c22ef, 0x0000c061, 0x38673862, 0x8fa6b0d9, 0x7b047ba6, 0x0000aba5,
+        0x1aa91a50, 0x075a91e4, 0xeeaaee83, 0x0000d2a5, 0xb538b5bd, 0x51d58553, 0x0e290e77, 0x000093d1, 0x37d237aa, 0x35e6b794, 0x652d6581, 0x0000d2eb,
+        0xe4eae4b4, 0x835ecfd0, 0x06870631, 0x0000c16d, 0x095e09ec, 0xae839e27, 0x06af0678, 0x0000de0c, 0xa136a140, 0x3baf3d70, 0x03180375, 0x00000172,
+        0xe7b6e77a, 0x74a8acc0, 0xd241d2f4, 0x00008f56, 0x409d4079, 0xb475cb22, 0x7d527d70, 0x0000b0f2, 0xe7a7e727, 0x25d83d71, 0x363b3615, 0x00004e8e,
+        0x5d585dc3, 0x9fe9cd51, 0x4f1a4f89, 0x00006116, 0xf967f9c6, 0x17aae290, 0xc29cc219, 0x0000b9c6, 0x7de67d7c, 0x5368f7e9, 0x1da71de1, 0x00002757,
+        0x9a9f9a3c, 0x0665b7f8, 0xc2f0c2f3, 0x0000c32d, 0xe3b3e3ae, 0xfcce0bea, 0x63d863cc, 0x0000412e, 0xdb97db1d, 0xd708751b, 0x4d484dd8, 0x00000770,
+        0xa1cba139, 0x8a28b0da, 0x1e4c1e00, 0x0000f1f1, 0x878d876c, 0x07c6ceaa, 0x4385433c, 0x0000230a, 0x241f243e, 0x840484fe, 0x5263522b, 0x0000668b,
+        0xcee7cef7, 0x08549439, 0x1a231a4b, 0x0000564b, 0x6823689f, 0x3cf5712f, 0xf563f5c2, 0x0000c9b9, 0x0910095f, 0xc8d6468f, 0xbf06bfa6, 0x0000f9a1,
+        0x61416182, 0xaccc6a37, 0xf7b8f710, 0x00004bd6, 0xf3a0f377, 0x78253e4f, 0xd87dd82a, 0x0000e428, 0x267d262f, 0x9fe67000, 0xe283e2f7, 0x000014c9,
+        0xf1dbf150, 0xc0ab8d04, 0x03d103c3, 0x0000e742, 0x584b5895, 0x0465bf84, 0x01650134, 0x0000c54d, 0x272527fb, 0xc2caced3, 0x520c52fb, 0x00004e43,
+        0xdd93dd9f, 0xe4ae7d3c, 0x29d629ce, 0x00007f91, 0xaa2eaaee, 0x805ede50, 0x7b477bfb, 0x0000ed29, 0x90259057, 0x12f98582, 0xcc04cc27, 0x0000dc96,
+        0x15c4151c, 0x6d914dad, 0x316131b4, 0x0000a285, 0x3ffa3f91, 0xfff91a5b, 0xfd5ffde0, 0x0000c186, 0xe93be967, 0x791af5f3, 0x0b9f0bf4, 0x00000f1b,
+        0xcfe0cf1e, 0xef5305ca, 0x7b727b2b, 0x0000c5be, 0x66e26626, 0x2f1fbef8, 0x75457508, 0x00005add, 0xf831f88a, 0xea4fa0ce, 0x9cab9cf1, 0x0000db29,
+        0xd368d328, 0x12a5b56f, 0x1bfe1b4c, 0x000035ac, 0xdab7da05, 0x1c3a6e1c, 0x7f487f63, 0x000099d6, 0xe7f4e77a, 0x535b7b42, 0x37583716, 0x00009eb4,
+        0x890f89d2, 0x7bf55317, 0x5ed35e61, 0x000024fc, 0xade9adc9, 0x2df2da59, 0x60436049, 0x000085be, 0xccbfcc97, 0x7d467bb9, 0xfe5dfe67, 0x00009cc9,
+        0x99329994, 0xbf99bbbd, 0x2f772f18, 0x00001ad3, 0xfb5afbb2, 0xc1cae269, 0xaaf2aa78, 0x0000e619, 0x4dda4d29, 0x2e405cff, 0x23552396, 0x00000fbd,
+        0x62d56274, 0x7eb2b617, 0x77e777a0, 0x0000db67, 0x64246480, 0x6bcd7179, 0x5d805d10, 0x000033f5, 0x9c819c54, 0x0444139a, 0x32f9320b, 0x0000b891,
+        0xe03fe0f8, 0x9723cf2e, 0xa693a6ca, 0x0000e187, 0xbdc5bd1f, 0x13154662, 0xb39eb3a1, 0x0000fc1d, 0x845b8463, 0x318de18b, 0x3abc3ac5, 0x0000f221,
+        0xa196a176, 0xb9cc5cff, 0x28a42887, 0x0000d3f8, 0x354e35e7, 0x70023419, 0x1c5c1c1c, 0x0000a0c8, 0x3c403cd4, 0x64f0d85b, 0x2c382c6e, 0x00007760,
+        0xc4e2c4b6, 0x142c992a, 0x9c569cbb, 0x00002f0b, 0xdc3cdc86, 0x1755034d, 0x963a9654, 0x00003364, 0xe6f9e67c, 0x69500d26, 0x72047271, 0x00001f53,
+        0x27492774, 0xc8ba72af, 0x110a116a, 0x0000236d, 0xe5e5e583, 0xe1f24b64, 0x2354233c, 0x00005706, 0xc75dc7fc, 0x19cdc65f, 0x55425556, 0x0000de70,
+        0x1e291e71, 0xe18dfab0, 0x714171f9, 0x0000599f, 0xdbf9db16, 0x4a3649f5, 0x734c73ec, 0x0000fe0c, 0x45a3456e, 0x4a46616b, 0x16741618, 0x00001614,
+        0xbbf7bba5, 0xee0c1e14, 0x0b950b58, 0x00006bfb, 0x90149084, 0x7cdd7a66, 0x95bc953f, 0x0000492d, 0x98b89815, 0x04150274, 0x9b749b2e, 0x0000a385,
+        0x0b5d0b4b, 0xa14189ea, 0xb346b3aa, 0x00006258, 0xa543a580, 0x61cd77db, 0xc214c299, 0x000086a2, 0x92239211, 0x0c7e004b, 0x5180512f, 0x0000ba80,
+        0x217321f9, 0x0ff5b7a7, 0x9010902a, 0x000070b1, 0x37d1377a, 0xae33aa02, 0x5a1e5ab6, 0x0000bc31, 0x85f68528, 0x54a3fd43, 0x9214927d, 0x0000ed74,
+        0xeb13eb9c, 0xadc3fb7b, 0xf417f43e, 0x00001432, 0xcc42cc82, 0x67bb14c6, 0x81318134, 0x0000055d, 0xb97eb927, 0xe79db0a7, 0x62e562f5, 0x0000acfe,
+        0xd642d68c, 0x47b90c27, 0x7b797b8e, 0x000045ba, 0xf350f3a6, 0x8a644b1b, 0x4d724d6d, 0x00006347, 0x4ae84ad1, 0x6a40d2cb, 0x425042b5, 0x0000dd57,
+        0xb642b69c, 0xee93ee8c, 0x9edd9ed7, 0x000009e2, 0xbe2cbe2e, 0x98f16d93, 0xa028a0ab, 0x0000ef48, 0x2c6d2ccc, 0x9c06fab2, 0x486f483f, 0x000004cf,
+        0x154e159d, 0x49b9e98f, 0x31493135, 0x0000ec37, 0x83eb838e, 0xfd0300b8, 0x7b0e7b76, 0x0000caec, 0xd008d085, 0x1cc92a39, 0x2355238c, 0x0000a728,
+        0x0b360be8, 0xfe183cb4, 0xe4c4e499, 0x0000fab1, 0xce15ceed, 0xb8858f20, 0xaa24aaca, 0x0000c712, 0x1ed71ebc, 0x7b1d9c95, 0xc665c67f, 0x0000aeb9,
+        0x730d7358, 0xde5f3339, 0xd9d7d980, 0x0000bf5b, 0x62b16244, 0xb6719fae, 0xfe97fe39, 0x0000a195, 0xd399d33c, 0x95888bfe, 0xbb66bb40, 0x00004d43,
+        0x8c088c37, 0xbd1b74d3, 0x63246370, 0x000066c5, 0xdfd7df7b, 0x1d5542f8, 0xc052c037, 0x000049ae, 0xf6d2f6c6, 0xfcbff9ac, 0x7d517d4d, 0x00001aac,
+        0x7ccf7cda, 0x7f5fcdd2, 0x786778f9, 0x0000b6cc, 0x29a02933, 0x22f372ce, 0xd6acd620, 0x0000f0f9, 0x4956498a, 0x161b5151, 0x7e737e75, 0x00004980,
+        0xdd10dd42, 0xca9a0786, 0x90b69049, 0x0000e7ad, 0x855085fc, 0x257294ba, 0xd03ed044, 0x00007391, 0x6b8c6bd2, 0x68c0a1db, 0xd25ed2d3, 0x00004912,
+        0x127212cb, 0xc78a7dc1, 0xf331f3e3, 0x00004fcc, 0x9ead9ec5, 0xdc91c918, 0xd86fd88b, 0x0000e4af, 0xa2dca2e2, 0xe921ace2, 0x293c2980, 0x0000fd93,
+        0x883d886f, 0xfb6c20ee, 0x6530658b, 0x0000d3eb, 0x34fa34bc, 0xbedb2fd9, 0x9a929a29, 0x0000f110, 0xce11ce12, 0x16bc18aa, 0x6b446bfa, 0x00008e9b,
+        0x15fe1571, 0x5f2247df, 0x8b9c8b80, 0x00006f08, 0x474e470e, 0x60d129c6, 0x828982b1, 0x00002575, 0x2e982ef1, 0xff0b3cff, 0xeca3ec46, 0x000093d5,
+        0x4eba4e8d, 0x75481786, 0x2694267e, 0x0000ac49, 0xfd0ffd60, 0x33863bcd, 0x61c66194, 0x0000748e, 0xf309f386, 0x70636d5a, 0x5c305cd7, 0x0000bb10,
+        0x7c3c7ccc, 0x766d2356, 0x050705c6, 0x0000984e, 0xf552f526, 0xba35a803, 0xf260f2c1, 0x00004410, 0xd7b9d79d, 0x6221de57, 0x1f4e1ffc, 0x0000c012,
+        0x067f067e, 0xcc85ed33, 0xe595e590, 0x00003d72, 0x50a550ce, 0xb48f9855, 0x14861426, 0x00004e6a, 0xb38bb383, 0x06842845, 0x1f8a1ff4, 0x0000de05,
+        0xc8d1c8bc, 0xc2f5c5e1, 0x228a223a, 0x0000b081, 0xc684c6dc, 0xba341389, 0x94859494, 0x00000cca, 0x9207923c, 0x92e99359, 0x587e581d, 0x00001095,
+        0x8d3f8d4a, 0xb7c9054a, 0x0b160b12, 0x000020a4, 0x5eed5e08, 0x49ab066a, 0x1a731ae1, 0x0000e9dc, 0x621d62bf, 0x6d9f6a85, 0x7b057b96, 0x0000b637,
+        0xf6e0f62f, 0x0ea32a45, 0x81b2812f, 0x000021cd, 0xa050a031, 0xae0c07b5, 0x5ad85a84, 0x00008780, 0x27b5274c, 0x99fed4f4, 0x13ed13a1, 0x00006fea,
+        0xbcffbc22, 0x8e0e1c9e, 0xbaf7ba84, 0x0000c974, 0x9eed9ef2, 0x2531f42d, 0xf77cf730, 0x00005009, 0xfd7dfd9e, 0x4df6ef93, 0xa1b8a1ca, 0x00002a67,
+        0xa7c0a74e, 0xe5620647, 0x84528446, 0x00000ec0, 0x309f30d8, 0x1658564d, 0xfe1ffedb, 0x00009a01, 0xb180b15b, 0x8e5826bf, 0x190319e0, 0x0000a7ae,
+        0x2d6f2d66, 0x3bd0f1e8, 0x1f1a1f3a, 0x0000bff1, 0x41d741b2, 0xb90ec9e3, 0x6958699a, 0x00000560, 0x2bf22bfa, 0xa2cc5ba4, 0xaf4baf26, 0x0000fede,
+        0xbd06bd9c, 0xdcfe39f2, 0x818581c5, 0x0000548b, 0xca76cae9, 0x3b568729, 0x1e491e58, 0x0000d17a, 0xf805f8b6, 0x2c202f99, 0x9fa69ff1, 0x00000e5d,
+        0x4d5e4d4d, 0x0a240249, 0xf70ef7c6, 0x0000d458, 0xf5b2f57d, 0x25213ece, 0x5ed45e65, 0x00008a71, 0x5bcd5b44, 0xdadbabab, 0xc36cc314, 0x000086a2,
+        0xadd5adab, 0x35192222, 0x1cdb1c8a, 0x00005365, 0xd33ad338, 0xb6f77351, 0x044c0472, 0x0000446d, 0xcdbacd93, 0xaf5b6aa2, 0x5a375a35, 0x0000f95c,
+        0x251e25d3, 0xc845dc44, 0x183418b6, 0x0000f26b, 0x11f61130, 0x7e5c004a, 0x04040426, 0x000040ef, 0x31aa31bb, 0xa97b333e, 0x9da79dfb, 0x000050a7,
+        0xf5c9f5d9, 0x33e0e2ef, 0xa02ca083, 0x0000c227, 0x985c98c5, 0x2a634beb, 0xd25ed235, 0x00000362, 0xb236b22b, 0x85f8ecb0, 0x412541f1, 0x00002366,
+        0x5a0c5aa2, 0x93912334, 0xd737d747, 0x00000acf, 0x2ff32f39, 0x9b763711, 0xae34ae63, 0x00002fa9, 0xa431a4c8, 0x7f7ee155, 0x37ef37b5, 0x0000dbeb,
+        0x6bc96bb7, 0x024495e7, 0x533f532b, 0x00003e6c, 0x54265463, 0x570bd52a, 0xdb8ddb98, 0x0000a719, 0xefb4ef0b, 0xaa51cad9, 0xb365b32d, 0x0000ccaa,
+        0xfbabfbbd, 0x7adab438, 0x6d486d41, 0x0000cb95, 0x6cd56c1e, 0xa765113f, 0x352435bf, 0x0000618b, 0x47c44732, 0x4d145e67, 0xa88ca801, 0x0000e426,
+        0xf3b3f37b, 0x013ae5e2, 0x881a8812, 0x000076f3, 0x4e624e0e, 0x1cb4815e, 0xa9e8a9dc, 0x0000ac85, 0x0b370be5, 0x3edfa728, 0xdeecde6b, 0x0000bb5b,
+        0xdae2da8e, 0xb0586639, 0x68e7687c, 0x00009718, 0xc5efc554, 0x635e77f2, 0x88978884, 0x0000ceaa, 0x4de34de0, 0xd8da2fc6, 0x89c48986, 0x00002e63,
+        0xb04cb04b, 0xfd763a21, 0xe9fbe92b, 0x0000804b, 0xe1eee181, 0x8336e35e, 0x313731ad, 0x00003c8c, 0xc4e5c43d, 0x1c81db24, 0x8c018ca5, 0x0000c512,
+        0x96409685, 0xf4c28dbe, 0x52b05255, 0x00005539, 0xfae4fa11, 0x1ac89507, 0x612461a9, 0x0000c8b8, 0xe478e4b0, 0x3549ec83, 0xdef1deab, 0x00008bb7,
+        0xd49ed498, 0x20f04324, 0x9547958c, 0x0000be9c, 0xe488e479, 0x195e474f, 0xde57de44, 0x0000994e, 0x0b220b3e, 0xad208570, 0xc858c8b3, 0x0000f363,
+        0xc51bc5d9, 0x2d53f0d4, 0xd180d193, 0x00002ccb, 0x979b97df, 0x027b7623, 0x99579951, 0x000056c4, 0x67d1674a, 0x365888ea, 0xadcaad87, 0x000019d3,
+        0x62c96214, 0xa64eec1c, 0x9b1e9b33, 0x00006f15, 0xb2a7b29b, 0x57f21faa, 0xc726c7a7, 0x000077bf, 0x3c853ce6, 0x1439f0d4, 0x526e525a, 0x000049a9,
+        0xdc3edc10, 0x296017c3, 0x3d3a3dbf, 0x0000206d, 0xe545e560, 0xae9b329f, 0xabdcab23, 0x000030ce, 0x724c72f0, 0xa5437350, 0x3c2e3c76, 0x00006117,
+        0x94659478, 0x240d31a7, 0x0e540e0b, 0x000059f6, 0x04a104de, 0xca1b6efa, 0xe35de38c, 0x0000fc1a, 0x567d56d4, 0xd1dba365, 0xbcffbcfa, 0x0000290a,
+        0x378837a2, 0x99b94aaa, 0x6fd96f66, 0x00006c96, 0xb0bbb0bc, 0x8dc78ec1, 0xf35af3f5, 0x00000a2c, 0x23142380, 0x52a9dd53, 0x0ac90a9e, 0x00002cca,
+        0x68ac6896, 0x4006e313, 0xb775b768, 0x000082a2, 0xcb42cb30, 0x3e1d79a6, 0x06fc06aa, 0x0000be6f, 0x901b9057, 0x71b52cbb, 0x1f071f34, 0x000071c9,
+        0x6706677b, 0x28c07651, 0xbf06bfb1, 0x0000b9a1, 0x0bc90bf4, 0x86a12c9b, 0xbd11bdfd, 0x0000399d, 0xfa98fa30, 0x19ea433b, 0x6b8a6b59, 0x0000330a,
+        0xc163c17a, 0x42c56cd5, 0x5f5d5f9a, 0x0000c4cd, 0x53675338, 0x815926bf, 0x3cf23c58, 0x0000f02d, 0x2f6c2f5d, 0x43e71bd0, 0xcfa3cf4b, 0x0000b609,
+        0x11d411ac, 0x14427e3c, 0x758475b6, 0x0000d7a8, 0xb7e1b73d, 0x01442dac, 0x781278f0, 0x0000f84d, 0xbc0abcab, 0x9316aeb4, 0x280128e6, 0x000079a3,
+        0xcdbecda6, 0x165a6146, 0x908090a0, 0x0000defa, 0x093b09b8, 0x135ff63a, 0x43e24351, 0x000097f5, 0xa006a088, 0x01448d74, 0x7d097d35, 0x0000c6c1,
+        0x938993b4, 0xd6ea3465, 0x7ff77ff7, 0x0000f62e, 0xf3b3f37f, 0xde4c5f92, 0xc2a3c2b4, 0x000010f3, 0x29d629ef, 0x46c5ed4e, 0xb2c8b264, 0x0000860f,
+        0x5cd15c94, 0xa4434611, 0x30c13033, 0x000026df, 0x4d1c4d34, 0xca94710e, 0x83a88325, 0x00005ae8, 0x34a23407, 0x2cd9da5b, 0xc114c130, 0x000026e1,
+        0xf087f06f, 0xb053f3a9, 0x2b422bc5, 0x000000b6, 0x042e04b1, 0x8588cd51, 0x0b9b0b8f, 0x00009bae, 0x71127151, 0x0e0a2509, 0x99c29956, 0x0000fba0,
+        0x74937451, 0x62fc7bc0, 0xe20de213, 0x000055a7, 0x588f5897, 0x99807f3c, 0x350735db, 0x00009576, 0x08ec08df, 0xabf0adc7, 0x5ae25a3b, 0x0000c4b2,
+        0x818281fb, 0x15e0f256, 0x59825911, 0x000047f0, 0x1c141cb8, 0xf429e127, 0x099e09dd, 0x0000c413, 0x3b853bdd, 0x2a9e68d5, 0xd464d47c, 0x00004d00,
+        0x2b962b30, 0x50e7eef2, 0x17b6175a, 0x0000b1e5, 0xe911e991, 0x9f8314c6, 0x745b74d3, 0x0000fbbc, 0x514951ba, 0xaf323d00, 0xbd7bbd50, 0x000073b6,
+        0xb431b44b, 0x6aa10476, 0x54d55437, 0x0000370f, 0x280a2899, 0x6f09b968, 0x68626826, 0x00000162, 0x572b5736, 0x6fdfb615, 0xfd8afd0e, 0x0000ab2e,
+        0xdfa8df21, 0x72120076, 0xc065c0b4, 0x0000e272, 0x7dfa7d34, 0x88ce7e69, 0x2c932cd0, 0x00008a2f, 0x239923c3, 0x07c48c21, 0x076807c3, 0x00000982,
+        0x5be55bef, 0xda54cdaa, 0x9bce9b67, 0x0000d466, 0xc383c348, 0xdf8b8090, 0x8bee8b0f, 0x0000cbf5, 0xa26aa23e, 0x0a2b9476, 0x5b7b5b7d, 0x0000f3b2,
+        0x7c3d7cfb, 0xff7231df, 0x22f02245, 0x0000925d, 0xccc9ccd1, 0x94829a29, 0x8ea98eb6, 0x0000e10c, 0x3aaa3a1a, 0xadcc1fe1, 0x2c4b2c78, 0x00001029,
+        0xf130f128, 0xd7c9e2fd, 0x23502313, 0x0000b95f, 0xa9dfa9f2, 0x50e6c07c, 0xef5aeff7, 0x0000b00c, 0x92679258, 0x1cc8e5cc, 0x3a193a6f, 0x00001e2a,
+        0x54b25431, 0x0ff4c9a8, 0x567356c9, 0x0000d667, 0x3f463f7e, 0x7f67223b, 0x1dfb1d42, 0x0000c0ec, 0x6ad06aed, 0x90c93dff, 0x03f60314, 0x000059fa,
+        0x06150678, 0xfb71d924, 0x13191363, 0x00002864, 0xaac5aaad, 0x8d47458c, 0xb8abb8c4, 0x0000d805, 0x7ff27f72, 0x8c98958d, 0xa159a1fe, 0x0000ea5f,
+        0xa46ba4b7, 0x54a78ae1, 0x8f238fcb, 0x0000bc6b, 0xe9c7e9ad, 0x912cc560, 0xac08acb0, 0x0000e093, 0x5f135f2c, 0x724afd76, 0x716a71c2, 0x0000a677,
+        0x36223630, 0x0d7b7458, 0x5f4e5f53, 0x000003a0, 0xe42ae433, 0xc55d1a53, 0x216521fb, 0x0000d148, 0x4299428d, 0x8f653082, 0x7b177b77, 0x0000af66,
+        0x8bd28b66, 0x33cebdcb, 0x3a1e3a32, 0x00007da3, 0x0c700c33, 0xac2e77e2, 0x532053c6, 0x000060c0, 0x128612d7, 0x67f055d6, 0x88e0884a, 0x00007da9,
+        0x1194118c, 0xcbb080cf, 0x225622c3, 0x00006130, 0xca98ca4d, 0xb57ff228, 0xf8b6f898, 0x0000236c, 0x122812f6, 0x5556dd6c, 0x266a263c, 0x00003a1f,
+        0xbd00bdcf, 0x2f8cfa8c, 0xed0eed03, 0x0000bd9d, 0x434e432a, 0x0ecb6e48, 0x5cfb5cf3, 0x00007d72, 0xe114e1c4, 0x21d03b59, 0xdf68dfc9, 0x0000ead6,
+        0xc022c03a, 0x0c0a7e45, 0xa406a4aa, 0x00003df6, 0xa75fa7bd, 0x5d07da5d, 0xd60fd60b, 0x00007f02, 0x492649b8, 0x41b9222f, 0x0b170bcf, 0x00003d44,
+        0x9561955a, 0x4385501d, 0xecd5ec6e, 0x00001433, 0x1ad61aa3, 0x2b53305f, 0xf117f1e7, 0x0000d376, 0x402b40a1, 0x24ef2fe6, 0x58c158e1, 0x0000e848,
+        0x1c051c19, 0x95d96989, 0x951395fa, 0x0000c644, 0x21082160, 0x0d7cc7c1, 0xfc02fcd9, 0x0000cacd, 0xe38ee3b4, 0x3494e1a0, 0x8fdb8f8f, 0x00003735,
+        0xf5f1f5d2, 0x2a9c968c, 0xab10ab4a, 0x000015d6, 0x4c6c4c18, 0x4d9e0647, 0xabf2abf1, 0x0000eb5f, 0xa7ffa749, 0xd8544aca, 0x89bc8904, 0x00007f81,
+        0xafe4af6c, 0x75b10d70, 0xe63ee601, 0x00007034, 0x6472641a, 0xfd6e8372, 0x6bb26bb2, 0x0000b531, 0x76ea7653, 0xb500e0a1, 0x5cf15cc3, 0x00003d4d,
+        0x55e05551, 0xfba16d3d, 0x51555141, 0x0000e403, 0xcb48cb1d, 0xecd184ec, 0x7a397abc, 0x000069e3, 0x83018390, 0x02bb4fd5, 0xb5cbb5ca, 0x00007797,
+        0xe40be431, 0xaf225d51, 0xba9dba41, 0x00002556, 0xd06dd02f, 0xa4fccad9, 0xa918a99b, 0x000065b8, 0x76ee76ed, 0x3b9a9bc8, 0xd35bd3da, 0x0000c3ec,
+        0xe714e7b6, 0x560765a7, 0x23db2398, 0x0000c010, 0x889a8841, 0xd48e6cf5, 0x8a2e8aaa, 0x000056bb, 0xaf27af71, 0x67706022, 0xbee0be45, 0x00004c08,
+        0xc50cc5af, 0xbccd463a, 0xfd48fd11, 0x00004f81, 0x84a78486, 0x52a71540, 0x7f537f86, 0x000066a6, 0x727c72f1, 0x7097bab4, 0xc9fdc9da, 0x00003cfc,
+        0x0cf80cc1, 0xa45c8d71, 0x04b204b0, 0x00004012, 0x3b883b1e, 0x44461bee, 0x706a70b7, 0x0000a95a, 0xd3a1d3c5, 0xc435a23f, 0xb9d4b9d2, 0x000081a2,
+        0xb6eab6e9, 0x640303fa, 0xef7fefaf, 0x0000cbab, 0x8d548d78, 0x67ed3c66, 0x362b36ae, 0x0000a635, 0x97459762, 0x23fd6cf4, 0xda65dad1, 0x00009bf6,
+        0x6f096f88, 0x8715dddb, 0xfa07fa45, 0x0000f4f9, 0x003f00b8, 0x2ec02a39, 0x47f24750, 0x00008da2, 0x0a550aeb, 0x80287ec2, 0x0dfe0d7c, 0x0000aad9,
+        0x12131234, 0x6d7f2bbf, 0x340c348e, 0x00002e05, 0x866086ff, 0xe56731df, 0x4d284d58, 0x00000972, 0xe34ae3d4, 0xbaf5665a, 0x076d07c4, 0x000092b5,
+        0x74257443, 0x8f656d12, 0xed7eedd6, 0x0000dc3f, 0x14a9143c, 0xc1e8d79e, 0x23a1230e, 0x0000fc34, 0x7d4d7d5b, 0x32fae622, 0x21122169, 0x00004524,
+        0xc617c694, 0xc52aeb93, 0x533e5314, 0x000021a4, 0x80bc8094, 0xc06af5dd, 0xf8bff81c, 0x0000001c, 0xd2d2d270, 0x38507567, 0xfda0fd75, 0x00004311,
+        0x3f893f9b, 0xdd8ace68, 0x3160315e, 0x0000cf38, 0xa4b1a4c0, 0x6021454f, 0x61a4615b, 0x0000ad39, 0x755a75f2, 0xc32aabc0, 0x068c06e4, 0x00005e09,
+        0x4e284ec7, 0x3aba41bd, 0x7ab47ab4, 0x0000e8f6, 0x38333894, 0xee869ede, 0x6efa6e53, 0x00003406, 0x58ce5848, 0xb2470d67, 0xfe26fe54, 0x0000227b,
+        0x70ef70dd, 0x9ea6fdbd, 0xd917d9ef, 0x0000f4d2, 0xe5b0e5fa, 0xca14e607, 0x21f22165, 0x00005fb4, 0x02a10277, 0xdc2e0ad6, 0x2a182a22, 0x0000e8ad,
+        0x2c122cae, 0xdcc9eccc, 0x6fe36f5f, 0x000068ea, 0x32553211, 0x4e36fcc7, 0x0cad0cca, 0x0000bf79, 0x836583fc, 0x4879c100, 0x9ff39f26, 0x0000acfe,
+        0x48f548fd, 0xab812a41, 0x259025f6, 0x0000a6b4, 0x725d72b7, 0x28164a29, 0x71737129, 0x00004948, 0x897d89ca, 0x9975958f, 0xd400d4b7, 0x00003043,
+        0xbd17bd95, 0x96f1982a, 0xe5bee5c1, 0x0000cb35, 0x3e313e78, 0xbe136061, 0x9fc39f3b, 0x0000466e, 0x074107b4, 0x9b5cd738, 0xfe2ffe74, 0x0000b4a8,
+        0xbbd0bbe7, 0xc185c051, 0x790c795a, 0x000074b0, 0xf627f6d4, 0xa2519b3f, 0xe79ae73d, 0x00006996, 0x723b7233, 0x109c7356, 0x093d0931, 0x000096e9,
+        0x1ecd1e84, 0xca26933a, 0x271327db, 0x000077cd, 0xd9dcd9be, 0x83a181fe, 0x6a476a51, 0x00000e5f, 0x7c997c78, 0x71620bea, 0xfc54fcf9, 0x00001788,
+        0xcea1ceb1, 0x1fac40bc, 0x290329bf, 0x000060c0, 0x4bb04b94, 0xab7ec789, 0x7934790f, 0x0000df46, 0x0070007b, 0x05c51fda, 0x6d9c6d7a, 0x0000715e,
+        0xf21ef267, 0x33492b3a, 0x6b6c6b5f, 0x00002746, 0x72a97216, 0x6e2252fd, 0xe3bee3c5, 0x00002216, 0xef0fef7e, 0xb38f73ed, 0x0c280cec, 0x0000c24b,
+        0xbce7bcdf, 0x11200821, 0xa06ba010, 0x00008cde, 0x0ad70a91, 0x216e61a6, 0x30a430e0, 0x00008bbe, 0x07f40761, 0x4909dceb, 0xe5fce5be, 0x0000f2a5,
+        0xa3e0a38c, 0xfa1872cf, 0x727b72a7, 0x00007672, 0x0dee0daa, 0x11559ca3, 0x19c21907, 0x0000afa6, 0xd2c5d2bd, 0xc6279894, 0x04ef041a, 0x00008118,
+        0x193e1962, 0x18a5bc31, 0x3d0d3d84, 0x00007622, 0xe517e59f, 0x78d96908, 0x8cef8c08, 0x0000562f, 0xa7a8a7e7, 0xb68f164b, 0x4a324a65, 0x000025b2,
+        0x9c269c1f, 0xf9d9a366, 0xf4b1f4ed, 0x0000733f, 0xa135a175, 0x13ee5faa, 0x6c746c9f, 0x00008cc3, 0xd8d5d8c1, 0x352915bc, 0xbda8bd85, 0x00002557,
+        0x3b883b99, 0x78bae6a2, 0xcde0cdaa, 0x0000ab2d, 0x16e71688, 0x27b0463a, 0x5c8a5cad, 0x000021eb, 0x64706479, 0x84c89955, 0xe6e2e6da, 0x000073db,
+        0x0a590a69, 0x6c10675a, 0xe003e041, 0x00005984, 0x63be6361, 0x8bb85278, 0xda3bda95, 0x0000f262, 0xed90ed68, 0x17515923, 0xbc96bc99, 0x000007c2,
+        0x7d557d91, 0x10f24fea, 0x9c129c5c, 0x00000e18, 0x32593210, 0xc27c2a2b, 0xcb91cbcb, 0x0000c1b9, 0x356c35d3, 0x62325d5c, 0xfbeafb09, 0x000095f5,
+        0x0cfb0c0c, 0x40ba8c00, 0x092909de, 0x00008742, 0xfe03fe92, 0x0155c866, 0x3c193cd5, 0x0000cc45, 0x5d5b5dc0, 0x509701a3, 0x4721472f, 0x00007160,
+        0xaf10afed, 0x8487cb28, 0xeaa4ea0b, 0x00006687, 0x610461fa, 0x5ac823e0, 0x25be2541, 0x0000de8e, 0x53395310, 0x53390d5b, 0x6330636d, 0x0000f2d9,
+        0xe9cce966, 0xc70b7b49, 0x497d49df, 0x0000ff01, 0xbee7be47, 0xdd0ca4b0, 0x115a11cd, 0x0000a95a, 0xf63ff652, 0x6d9ed6f5, 0x31b331e5, 0x0000fca1,
+        0x96ec960d, 0x2addd32c, 0x43f443c0, 0x00002076, 0xc2fac222, 0xa67e0048, 0x7d527d4b, 0x0000b3a9, 0x3a943ae7, 0xbe6e26a9, 0x1d731d26, 0x00006ad6,
+        0xa1caa149, 0x90b395be, 0x0a4b0ae7, 0x00009c06, 0xfa8bfa00, 0x389773d2, 0xcf11cfcb, 0x0000ff63, 0x87e287fd, 0x4ce27f3c, 0x7ff57fcf, 0x0000729d,
+        0x32883211, 0xea2260d3, 0x8a198a4b, 0x00000cd9, 0xeb58eb34, 0x10e5b8cb, 0x0aec0a4a, 0x0000c8cf, 0xcc98cc46, 0xafce7a23, 0xba41bae6, 0x00001dad,
+        0x737a73f8, 0x2c21a029, 0xc8f5c8b3, 0x00002ddb, 0xcb3ccb34, 0x50e7e421, 0x578057a9, 0x000015d7, 0xb35cb3fc, 0x58434b9c, 0x20722097, 0x00001602,
+        0xb248b2f0, 0x6cdf05d7, 0xfc24fcbd, 0x0000ec84, 0x77687708, 0xbda81355, 0x2f6f2fe2, 0x0000428f, 0x7a6e7a7f, 0x8aa73628, 0x4683460c, 0x00007ee0,
+        0x631f638e, 0xed0e22a2, 0x21e0217a, 0x0000d7a4, 0x286328bb, 0xe85c0ee7, 0x5a2f5ae3, 0x000033e6, 0x92d79206, 0x919dda59, 0x526052e9, 0x00008061,
+        0x07cf0708, 0x5933b4d8, 0x30653062, 0x0000cb0b, 0x7fa77f1b, 0xad4df1d4, 0x5cd65c68, 0x0000a4e8, 0x96de9654, 0x124e092e, 0xd945d9a8, 0x00005927,
+        0xe6dce645, 0x142f9ce5, 0x830b8374, 0x00001aac, 0xbb50bb34, 0x68228579, 0x124112c9, 0x0000e389, 0x12ea12f5, 0xb5f79b37, 0x1b211b9a, 0x0000858a,
+        0xc535c5de, 0x9bdca82c, 0x314f3115, 0x00004010, 0xb9f3b981, 0x7062702d, 0x99709929, 0x00009bf7, 0x6be96b5e, 0xa51d72ab, 0xafdaaf28, 0x0000cfac,
+        0x5b425b92, 0xf42f458c, 0x01a501f4, 0x00008ae4, 0x845584fc, 0x77b22254, 0xf25ef22e, 0x00007594, 0x43334396, 0x4c5e1199, 0x01ff01a3, 0x00006f2a,
+        0x51bd517a, 0x205357fc, 0xa613a684, 0x00004aef, 0x085c0833, 0x05e5ee3d, 0xf175f16d, 0x0000d9a4, 0x187618a3, 0xa7393cad, 0x1a2d1af5, 0x0000378c,
+        0x76b17670, 0x454bc6be, 0x098a099e, 0x000048af, 0xf328f33f, 0x57ff32dc, 0xe80ee8af, 0x00004616, 0x80ea8079, 0xd9382f44, 0x7c987c20, 0x000034ce,
+        0x22a42286, 0x36aaaef9, 0x1d031db4, 0x00008187, 0x020302fe, 0x252395f8, 0xac7fac31, 0x00009829, 0xb17eb108, 0x056541c4, 0x7b807ba7, 0x0000d43b,
+        0x140f14cc, 0xf0f4fb3b, 0x56a756ca, 0x0000bcfe, 0x313a3189, 0xd8dbc923, 0xf8f5f816, 0x00000243, 0x2d6a2d49, 0x331ca6b8, 0x8b4a8ba4, 0x0000c772,
+        0x69b3694c, 0x43993a5e, 0x7788774f, 0x0000cf2a, 0x068c0675, 0x91825571, 0xcae3ca46, 0x00007e3e, 0x464346df, 0xc3a8e422, 0x4bdf4b23, 0x00008720,
+        0x9d929d12, 0xafe467a3, 0xd5d4d553, 0x0000b380, 0x997299db, 0xd490ac98, 0x5a725a21, 0x0000a655, 0xfcf8fc98, 0xcbebbcd8, 0xd303d320, 0x00007281,
+        0xcee1ce55, 0xbd748cdf, 0x604860bf, 0x000086a2, 0xe6c0e619, 0x2f0fc017, 0x307e3063, 0x00007ea3, 0xe6e7e682, 0x60b23d80, 0xa8cfa82b, 0x00001b0d,
+        0x6d736dcc, 0x49361955, 0xfb9bfbc9, 0x0000f87e, 0xb039b098, 0x76fb1afe, 0xe89be897, 0x0000fe8b, 0x9e369e7b, 0x4954c865, 0x540c54e5, 0x00009214,
+        0x293c29e6, 0x97d911fe, 0xe685e605, 0x0000a14a, 0xa360a3a4, 0x0f34574e, 0x307c306a, 0x0000d23a, 0x1ce71c33, 0x406fd735, 0x566c5684, 0x00001b02,
+        0x14d814aa, 0x5b4edbc4, 0x2f702f75, 0x0000338c, 0x21ec216e, 0x4b5f9b56, 0xa157a16d, 0x00009e0e, 0x96d49657, 0xd95bf9ab, 0xafcdaf2a, 0x00007931,
+        0xe8c8e88c, 0x7112d40c, 0x1e1e1ea4, 0x0000c013, 0x40ea40fd, 0xf36efcb3, 0x54475455, 0x00002166, 0x559d556f, 0xf77cce68, 0x554e5553, 0x0000997b,
+        0x25cc2549, 0xd5de40bc, 0xda10dae8, 0x0000fc52, 0x6d8b6dce, 0x1faa99d7, 0x38813870, 0x0000c313, 0xe90ce9b3, 0x3f88e672, 0x210f219e, 0x0000d466,
+        0x15a115fa, 0xcd24d634, 0x230923df, 0x000071c5, 0x9e849eb9, 0x6e60e06d, 0xec69ecdd, 0x000074c2, 0xe29ee2f9, 0x2e5379b8, 0x4287423d, 0x0000061b,
+        0xa9a7a951, 0xe420d504, 0xd35cd33b, 0x000048d2, 0x4b014b8d, 0xde6bcfce, 0xbbcabbfc, 0x0000ec15, 0x241124f0, 0x23d006e8, 0xee45ee05, 0x0000457b,
+        0x588f5858, 0x4a6999d6, 0x5481546d, 0x00009c0c, 0xaf8caf8a, 0x194de70c, 0xe4bbe4cd, 0x000021ea, 0x460046dc, 0x2d473f01, 0x545054e9, 0x000043c7,
+        0x4a724a64, 0x17dbabf7, 0xb72bb7c5, 0x0000394c, 0x666b66e1, 0x5c9eab84, 0x367d3679, 0x000068b5, 0x28b8283f, 0x7c3f461f, 0x36b736a4, 0x00007d19,
+        0xe834e8e2, 0xa87ba5d4, 0x86988637, 0x000065f0, 0x18671830, 0xf803cfaf, 0xb6ceb689, 0x0000a719, 0x33993377, 0x1055b200, 0x86378640, 0x000059b8,
+        0xba8dba7e, 0x1060c4b6, 0x275327fc, 0x0000b77c, 0x1a9e1ab3, 0x383e99d7, 0x8710872e, 0x00008fd0, 0xa08ba08d, 0x1c8ad4bb, 0xa970a934, 0x0000d774,
+        0xb758b741, 0xdddb6ed5, 0x6a726a8c, 0x00005ee7, 0xd6ced6ab, 0xff48bb6a, 0x968d9620, 0x00003ee7, 0x203320c8, 0x96c9578f, 0x45bf4504, 0x00005ff6,
+        0x631a638c, 0x6abf3dce, 0x216e21d0, 0x000037ce, 0xff2aff5e, 0xba4fb225, 0x0a740a95, 0x00004f42, 0xad40ade0, 0x03446400, 0xe642e606, 0x00009840,
+        0x25b5256a, 0x8a18d32b, 0x9445943d, 0x0000c54d, 0x3fb33ffb, 0x9e2c77d9, 0x786978c3, 0x0000d2f8, 0x0019008f, 0xd5315333, 0xa88ca83d, 0x0000d126,
+        0x12bc12b7, 0x48c139f0, 0x43a94394, 0x000094a7, 0xc613c684, 0x6c106ba2, 0xc216c2fd, 0x000074b0, 0xd46fd42e, 0xee13702d, 0xe0fce067, 0x00005f26,
+        0xfd8afd06, 0x6948ef81, 0x17cc1772, 0x0000acc0, 0x26c42667, 0xbb3c39ce, 0x0a310aa3, 0x00008950, 0x94e89455, 0xa6410a14, 0xc1f8c1a1, 0x00009599,
+        0xa963a9aa, 0x079b9a29, 0x046a0448, 0x000067ae, 0xe8bee897, 0x9bcae4fd, 0xc85bc80d, 0x00004554, 0x831083ee, 0xa183a366, 0x551155ad, 0x000080cf,
+        0x01e7017e, 0x45a590fa, 0xe953e910, 0x0000ce5a, 0x9ef89e35, 0x40c60b97, 0x24f32419, 0x0000e544, 0xde30deba, 0x13936fc5, 0xee38ee5a, 0x0000a02e,
+        0x27142749, 0x4e36ab7c, 0xbda4bdf3, 0x00005f65, 0x621e62a9, 0x94072721, 0xfb7bfb28, 0x0000fd27, 0x5c275c65, 0x8984c567, 0xd75cd73c, 0x0000c78c,
+        0x8a0b8a61, 0xcbeb5248, 0x7b867b9b, 0x0000e093, 0xabdaabeb, 0x7e5f2e56, 0x3e593ed0, 0x00005d90, 0xafa0afb0, 0x582824eb, 0xdb49db37, 0x00004af2,
+        0xd423d491, 0xbb60df57, 0xd0d0d0f9, 0x0000269c, 0xed76edce, 0x27534129, 0xfa1bfa31, 0x0000832b, 0xb4b8b43a, 0x2d1f77d2, 0xd9c5d9c1, 0x0000e5db,
+        0x4a7e4a6d, 0x0426ecb0, 0x411c418d, 0x00009714, 0x2e4f2e4d, 0x9de69c63, 0x962c960e, 0x0000ea72, 0xdbdedb14, 0xda549641, 0x416e41d6, 0x000064b0,
+        0x66f066db, 0xaae14e56, 0x118111b1, 0x0000847c, 0xed0eed12, 0xa4b9a8c0, 0x552e55ed, 0x00006587, 0x5d0f5d4a, 0x6c102c65, 0x110c115b, 0x0000cb69,
+        0x247224bb, 0x14bb60fa, 0xba49ba26, 0x0000d0a5, 0x4aa04a48, 0x911c91e4, 0x360636db, 0x00004590, 0xdc7bdcfd, 0x70eaf1d5, 0xa464a4b3, 0x000034aa,
+        0x2fc32f62, 0x02fbfc7c, 0x65496553, 0x0000456c, 0x62446269, 0x9491b828, 0x4f064f47, 0x0000c7fc, 0x16f0160b, 0xac2cc4fc, 0x0caa0cc9, 0x000092c8,
+        0x61ff6103, 0x32f60e99, 0x74977460, 0x00005384, 0x1e121eb8, 0x42066ecb, 0xcdaecd0d, 0x00005e6e, 0x8ce98c8f, 0x255d9638, 0x50f8506a, 0x00003e12,
+        0xcafdca90, 0x172c0c45, 0x8da28dc5, 0x000022b6, 0x1cfb1ccd, 0x603304f7, 0x5023509a, 0x000090f5, 0xa136a151, 0xffc276db, 0xff01ff1c, 0x0000de87,
+        0x252e25c0, 0xab81bef6, 0xe27ee225, 0x0000cb74, 0xad3dad3f, 0xe2b86eb6, 0xa095a08d, 0x000052c9, 0x991d9986, 0x670c9fd2, 0xd466d45c, 0x00001164,
+        0x3feb3f23, 0x0e74526c, 0xdc31dc95, 0x0000a198, 0x675f678d, 0xb11338d3, 0x2c842cad, 0x0000a294, 0x303830c6, 0x4d26aa87, 0xab9eab34, 0x000077ee,
+        0xc1b7c1fa, 0x27125433, 0xc93cc97c, 0x00003826, 0xe94ae90a, 0xa24165d9, 0x011c01bd, 0x00005f65, 0xc53bc5fc, 0x4ec4541a, 0x465d4601, 0x00003cb2,
+        0x2ad42abc, 0x95b71d53, 0xf1f7f1ee, 0x00000d62, 0xab59ab8a, 0x87c810c3, 0x41d44134, 0x000064c9, 0xdeb4debf, 0x3c1887b3, 0x7d9b7da4, 0x0000e4ca,
+        0xa7d7a7f4, 0x3c9a1b2c, 0xc798c765, 0x00000f72, 0x40fc40d8, 0x2aa3b937, 0xbc12bcf4, 0x0000802a, 0xa171a1f8, 0x44463ecd, 0xbe96be10, 0x000048b7,
+        0x3b6d3bdd, 0x217d6ad5, 0x71f971ba, 0x00002656, 0xe029e08a, 0xf55d24eb, 0x976b9751, 0x00000d96, 0x9eec9eaf, 0xf96af6cb, 0x3527356e, 0x0000069f,
+        0x28ad282d, 0x4dd4b8b4, 0x019001de, 0x0000f02c, 0x082c08b2, 0x92c855b2, 0xc9c4c9fc, 0x00008ae4, 0x5d1f5d7b, 0x54bfe803, 0x1670166c, 0x0000ff9e,
+        0xf126f1b3, 0xf35a88fe, 0x3cb23c53, 0x0000371f, 0x7848782c, 0x8c79ec5f, 0xc72ec730, 0x00000c9a, 0xa6cfa695, 0x8958a0df, 0x429842c9, 0x00008b3f,
+        0x5ddf5d2c, 0x926741c6, 0xb3a4b3f8, 0x00009b91, 0xa15da174, 0xc9948ede, 0x0cc40c61, 0x000086fc, 0x1344133d, 0x1d557052, 0xca4eca80, 0x000054e8,
+        0x85178521, 0xd34f23df, 0x9dca9d66, 0x0000a401, 0x711b71c3, 0x663303d5, 0x4d394d1a, 0x0000ce10, 0x559b5505, 0x48f70beb, 0xfdd4fdd7, 0x0000a999,
+        0x7de27dff, 0x04b11782, 0x601760c6, 0x0000040d, 0x4b154b11, 0x574d99ea, 0x22752292, 0x00007cee, 0x05650592, 0xbbbe3adf, 0x154115a6, 0x00007422,
+        0x6ada6a52, 0x316e5ebc, 0x3e5c3ee4, 0x00001e58, 0x44504440, 0xc8d986fe, 0xfc00fc3b, 0x0000688b, 0xb0efb0af, 0x2ad28b21, 0xbb97bb1e, 0x0000e7c3,
+        0x25522505, 0x6af3e15d, 0x57ce578e, 0x0000a564, 0x34223482, 0x33c32456, 0x36eb36e9, 0x0000de67, 0x224c22a4, 0x9f839c88, 0xe7bde794, 0x0000ece8,
+        0x3a473a5b, 0x5e068ecf, 0x12b5126c, 0x00006c8b, 0xdd3edd5c, 0x0ad414cf, 0xa51fa5bd, 0x0000049e, 0xc0cfc070, 0x635a63ac, 0x31c6311e, 0x00005739,
+        0x44e04423, 0xa6de9570, 0x9e0a9e99, 0x00009c71, 0xbb96bbeb, 0xb299601f, 0x3035302e, 0x0000669e, 0xa56fa56a, 0x584da020, 0xb725b7f6, 0x0000b9bc,
+        0xacc1ac68, 0x181f6758, 0x688a68bf, 0x00007c6d, 0xdb0adbf9, 0xd14f43fd, 0x16961624, 0x0000abc5, 0x201720a9, 0xe3ddd6ca, 0x719e71e9, 0x00007260,
+        0xa331a38e, 0x220f8a7e, 0x54cd5489, 0x00005706, 0xc3acc320, 0x937475e2, 0x5e705e99, 0x0000c82f, 0x410c414c, 0xd85beb8f, 0xdc1edc7b, 0x00005ad7,
+        0x232623f4, 0xa1bef61c, 0x74f374b6, 0x0000dadb, 0x53a25305, 0xa0e00997, 0x3b913b90, 0x0000387b, 0xf131f1f7, 0xb939d9a5, 0x78a378c4, 0x00009b91,
+        0x3c293c13, 0x0c56ecd3, 0x539c53ca, 0x00000a72, 0xec94ec24, 0x0b343bc0, 0xe2f1e2ba, 0x0000d43b, 0x706a707c, 0x2ca049e6, 0x834f83b1, 0x0000027f,
+        0x8a148add, 0x5f4d1cda, 0x5d045d84, 0x0000c710, 0xef7fef9c, 0xc82a29c6, 0x0d6a0d36, 0x0000e959, 0xd324d355, 0xb02a84b3, 0x8c068cc6, 0x0000174a,
+        0x61936125, 0x007baf0b, 0x580358b7, 0x00007140, 0x5fb15f9d, 0xc5273bf0, 0x3f093f3b, 0x0000f453, 0x1f221f03, 0x44859cd4, 0x23ac23f4, 0x000091c8,
+        0xc8ebc854, 0xf94815bc, 0x075607b6, 0x00003a9d, 0x3205328a, 0x48051fa3, 0xa029a0d1, 0x000003a0, 0xf204f27f, 0x412e26af, 0x45be45bd, 0x00003e4c,
+        0x152d1589, 0x90911c9a, 0x5cbe5cb0, 0x00002c0a, 0xa99ba92c, 0xb92395f8, 0x3a4f3ae7, 0x00005564, 0x24a52409, 0x4e241baa, 0x8d408ddc, 0x0000fe18,
+        0x46f14687, 0xf5c27567, 0xb617b674, 0x00007c70, 0xff16ff9a, 0x05653711, 0x034a03ce, 0x0000167f, 0xec7fec40, 0x39e3dac4, 0xa46fa4b0, 0x00000f63,
+        0x261c268a, 0x09cbf88d, 0xb301b3e2, 0x00000b1f, 0x193319c8, 0x69dd6ee9, 0xbfb8bf42, 0x000087bf, 0xbe28bedb, 0xa61d6c32, 0x1aa61a07, 0x00006de1,
+        0xc30dc33f, 0x7701ad42, 0x713a7134, 0x0000dcbf, 0x3282320c, 0x902c310e, 0xae4aaea0, 0x0000a038, 0x3712378c, 0xa39eb1c9, 0x93699382, 0x00005fb5,
+        0x7865786f, 0xc96580cf, 0x8504859a, 0x00006328, 0x77ae77ee, 0x5b07de78, 0xd75fd77e, 0x00009ef6, 0xc8a2c8d2, 0x90cb3cf1, 0x936793c7, 0x0000c6f2,
+        0x9cc89c5c, 0xe252dfeb, 0x5b145b99, 0x0000b742, 0x5a265a99, 0x007b5734, 0xaa24aacc, 0x0000f4ce, 0xd038d03b, 0xa64f52f1, 0x5eeb5e0d, 0x00004c04,
+        0xc864c8be, 0x9a763eff, 0x3e143e1d, 0x00006a08, 0xc9d9c9b6, 0xc2f4292b, 0x32dd3282, 0x0000ebd6, 0xf6aaf6f1, 0x4874b1e7, 0xe802e825, 0x00008dbe,
+        0x12a112a7, 0xe5529003, 0xfaf4faa8, 0x0000c08d, 0x4c5b4cea, 0x3e1ee5de, 0x448244ba, 0x0000b241, 0xef7bef97, 0xc1759dea, 0xb569b50d, 0x0000a355,
+        0xb2c8b28b, 0x2459b35b, 0x22312204, 0x00004acd, 0x86248601, 0xcd2abc01, 0xfa0efa05, 0x0000f730, 0x21972159, 0xf39b8ce1, 0x522352b9, 0x00002fd5,
+        0x35cd35ab, 0x7a015fed, 0xf5b5f5a5, 0x00001d14, 0x41f14187, 0xc90f85f0, 0x5611566b, 0x0000c532, 0x47ca476a, 0x7ddf55cd, 0xfc25fc56, 0x00000d26,
+        0xa18aa1a3, 0xd90410c4, 0xb386b39c, 0x0000d004, 0xcb35cbd8, 0xd7b405a1, 0xd923d915, 0x00003613, 0xe4d0e489, 0x5773468c, 0xed7aedd6, 0x00003468,
+        0xb03bb0e2, 0xaabd75e2, 0x2a652aad, 0x00007351, 0x38703864, 0x84073b91, 0x35e335ac, 0x0000a0d8, 0xeca0ec12, 0xfb6e0ca4, 0xc49dc430, 0x00009a3f,
+        0x688b6862, 0x06e41321, 0x061e0616, 0x00009150, 0x3cc03ca2, 0xd92d6b4e, 0xc640c6e2, 0x000060c0, 0x25ab252a, 0xa6516090, 0x1cb11c10, 0x00006157,
+        0xe288e248, 0x47b9d284, 0x918d9119, 0x0000efe2, 0x21de215d, 0x29bda31a, 0xb62fb648, 0x0000ce59, 0x0711071e, 0x3acff1d4, 0x94919411, 0x0000564b,
+        0x0dec0d6d, 0x6cf0e7e2, 0xb06ab0a8, 0x00001eac, 0x843f8462, 0x594dcb6e, 0x0d610d85, 0x0000378c, 0x824182b8, 0x59c93b1d, 0x14371405, 0x0000d9de,
+        0x400c407e, 0x7c8e55cc, 0x858d8570, 0x00003639, 0xd987d951, 0x3ef55120, 0xa530a5ad, 0x0000db81, 0xac8bac01, 0xfcf735bc, 0x2e432ea6, 0x0000fc32,
+        0x64f46466, 0x6f607cfa, 0xab8cab36, 0x000034f1, 0x6d936d5b, 0x50908530, 0xa9e5a9f8, 0x000082d0, 0x7fa17fb3, 0x62b2578d, 0x0b630b4a, 0x00001598,
+        0x52af52fe, 0x7b1da333, 0xf75bf7f6, 0x00001688, 0x041204c4, 0x4ba13320, 0x2b802b4b, 0x0000b542, 0x46c04620, 0x701af79f, 0x50a950ad, 0x00005624,
+        0xcb41cb19, 0xb61b3b31, 0xda2cda41, 0x00004b6d, 0x713d71a6, 0x81b5ca51, 0x2a152add, 0x0000b947, 0xa875a85b, 0x9406c1ba, 0x465e46b4, 0x00000f1b,
+        0xf126f10f, 0x92c9536c, 0x5028509f, 0x00003711, 0x5725579c, 0x1dc8f59a, 0x33a033da, 0x000062ec, 0x5ec45ea4, 0x9ec4fb3b, 0x4f7d4fd3, 0x000070c7,
+        0xfb8bfbd3, 0xfe0d81b7, 0xfe52fefc, 0x00002744, 0x38d33860, 0x81fb1b53, 0x926592af, 0x0000d674, 0xedb5ed47, 0x9f97e16a, 0x72ff720f, 0x0000e4f5,
+        0x19bd198d, 0xd96b32e1, 0x672d6713, 0x0000b3a8, 0x563656d5, 0x7bad5dfd, 0xfc9efcf9, 0x000074bd, 0x117511f6, 0xa2c020e8, 0x614f6160, 0x0000a31e,
+        0x3d343d14, 0x9723ec69, 0xfdb2fddc, 0x00006191, 0x8af18ad4, 0x3cea22b4, 0xe9ade97b, 0x00005ed8, 0x24272426, 0x1f3a9b55, 0x8e238ed9, 0x000074b1,
+        0x580d5841, 0x66101601, 0x02860210, 0x00008342, 0xa5b0a5f3, 0xdbf3e6bd, 0x97c29793, 0x0000392c, 0x6da76d89, 0x0e5c7ab4, 0x30083087, 0x000069ca,
+        0xc2c1c2fd, 0x0d7dc4a8, 0xd433d444, 0x00005d65, 0xbea5be96, 0xa4fc36df, 0xb4a8b485, 0x0000fbd2, 0x780878bb, 0xfece54a7, 0xaa76aa9d, 0x0000cb95,
+        0xc21bc294, 0xf5ba824d, 0x0caa0c49, 0x000050ff, 0x110d1199, 0x52890cd7, 0xa8d8a893, 0x00007b19, 0xf68ef6c3, 0x878841f8, 0xf19af186, 0x0000c793,
+        0xb726b7b9, 0xf357590b, 0x910e91da, 0x00003657, 0x6a306a4e, 0x90df86cf, 0x757575ce, 0x00007a28, 0xffeeffa6, 0xe3dc4033, 0xadb2addf, 0x0000fa0c,
+        0xe765e763, 0xda389cea, 0xa0afa0c1, 0x0000d1eb, 0xe0ece017, 0x95d929db, 0xc82ac807, 0x00002200, 0xe538e533, 0x8e98ba7f, 0xf14bf110, 0x00001945,
+        0x3df43d3a, 0x14bd60ef, 0x5b9a5b49, 0x00003c2d, 0x0674062a, 0x6d7f96be, 0xcdaecd81, 0x00003e21, 0x55965580, 0xe4d3ba35, 0xf08ff0ee, 0x00007f7d,
+        0x6dcd6d50, 0x744a4077, 0x1a6f1a5f, 0x00000b1c, 0x4ad74a32, 0xf31f8df2, 0xa57da5a4, 0x00003241, 0x910391f5, 0x2aed16fd, 0xbe7fbe19, 0x000076cc,
+        0x57b1573d, 0xddf3e7dc, 0x5ef55eb8, 0x00009c79, 0xeeacee52, 0x0cd74278, 0xe544e50e, 0x00004d47, 0x61a46124, 0x17e56efa, 0x8b9b8b05, 0x0000fdfd,
+        0xc80cc8a9, 0xe1fd0f27, 0x78157867, 0x0000028c, 0x1736173d, 0x1dd795be, 0x930e9365, 0x00008da6, 0xdf01df62, 0xa1619df1, 0x7f527f33, 0x0000bd10,
+        0xcd3ecd4a, 0xb6995d6f, 0x688b687d, 0x00005a2b, 0xbb1fbbab, 0xb57fe051, 0x9f129f2e, 0x0000c4b2, 0x7bc77b8f, 0xf0033006, 0x7a877a23, 0x0000e86f,
+        0xe820e823, 0xbf7599aa, 0xa51da59e, 0x00001fcb, 0x3696365a, 0xed7a438f, 0x4c714cce, 0x00007e9d, 0x220a2205, 0x00d479ff, 0x2689268f, 0x00002b19,
+        0xf912f912, 0xb72b560b, 0x90c99036, 0x00005b1d, 0x51065158, 0xa17e1df3, 0x3f603f93, 0x00009714, 0xae9aaecd, 0xfece2839, 0xba18ba30, 0x000062d9,
+        0x7b2c7b93, 0x219264a4, 0xeadcea3b, 0x0000fc70, 0x43ca435e, 0x8e47c918, 0x591059a8, 0x0000a355, 0xa9b4a919, 0x6dbf9a20, 0x86828634, 0x00008dd0,
+        0x8f128f27, 0xb7d8ab7c, 0xaa49aaf6, 0x00001317, 0x4f034fa2, 0x2af38ddc, 0x9c939c09, 0x0000864e, 0x672b67c2, 0xce55edd0, 0x8f208fa3, 0x00008b43,
+        0x67c96768, 0xa0a1323a, 0x972b9711, 0x00004e7c, 0x04c00408, 0xcf7a5ae2, 0x7b997b24, 0x00002c45, 0xe4ede4ce, 0x6c60939e, 0x1161115e, 0x0000fece,
+        0x579e5747, 0xd1078501, 0x556e5558, 0x0000d6a5, 0xd60bd6d5, 0x61bbea93, 0x2ad92a6f, 0x0000ce8e, 0x450445bb, 0x3f9a4766, 0xb6b5b6de, 0x00006935,
+        0x4f924f2a, 0xf5c2cf2c, 0x52ea5246, 0x0000e3b6, 0xfa6cfac6, 0xfe7743ad, 0xc16dc170, 0x0000d087, 0xba73ba76, 0x12776b4b, 0xcc45cc22, 0x00006a76,
+        0xbfcdbfed, 0x6021b8d8, 0x4da94dee, 0x00006d0f, 0xd98ad9c3, 0x1751e639, 0x0c5e0c0b, 0x00001bb2, 0xc9fbc954, 0xfacb315d, 0xed51eda4, 0x0000b443,
+        0x477d470c, 0xfbe79ee5, 0x8bca8bd6, 0x00005db5, 0xdb15db94, 0xfb6efba7, 0x644764a1, 0x000071bf, 0xa97da932, 0xfeadfd96, 0x99e199f4, 0x0000e050,
+        0xa325a356, 0xd1b4b660, 0x3dbb3d2d, 0x0000d3c7, 0x62d26273, 0x7b12123f, 0xc6e1c636, 0x0000ffbc, 0x1db51dc3, 0xaa14755d, 0x029c02e1, 0x0000acc0,
+        0xc356c3da, 0x4cf67916, 0x0c540ce1, 0x00003b24, 0x0cfe0c8f, 0x8998078a, 0x968e9654, 0x00003ccc, 0xf914f921, 0x507bdea6, 0x952c950e, 0x0000dd3a,
+        0x99b1999c, 0x2e80d3a5, 0x0aee0ab5, 0x0000def5, 0x52975229, 0xaa910c0f, 0xf01bf0dc, 0x0000fecc, 0xe3a4e32d, 0xde5faf0a, 0x973f97ba, 0x00002b7b,
+        0x8c0b8c30, 0xbbff5567, 0x44a94421, 0x0000f763, 0x0a190a1a, 0xf9d95e3d, 0xf35cf35f, 0x00009d31, 0xc103c186, 0x0ef45eed, 0x1a4e1afc, 0x00005db0,
+        0x4ee54efd, 0x348d0b94, 0x15351518, 0x00000a47, 0x9abc9a93, 0x45a70ddd, 0x34853455, 0x0000330a, 0xceacce8e, 0x9f67c435, 0x2dc62d37, 0x0000beee,
+        0xf919f99c, 0xceb6092d, 0xaa2baa26, 0x00003241, 0xc701c718, 0x3e025372, 0x43b8439d, 0x000010f7, 0xb760b7c7, 0xfff45067, 0x06d50692, 0x0000d1c2,
+        0x39b73958, 0x87ff99e9, 0x16d21677, 0x0000ae8a, 0x4fe44fec, 0xf8035c5c, 0xcf8bcff1, 0x0000c66d, 0x214b215c, 0x9c066fcb, 0xf47ff42f, 0x00005cb5,
+        0x1fa01f86, 0xeae75c2c, 0xb935b9b9, 0x00005ca7, 0x42fc4207, 0x3ce5b221, 0x0c560c3b, 0x000001ff, 0x4ad94a31, 0xe762f38e, 0x3f553fbe, 0x0000b911,
+        0x029502b8, 0x9679673e, 0xd777d79f, 0x0000644f, 0x42144272, 0xba8ff425, 0xf470f44f, 0x0000be10, 0x5a345aee, 0x94824e34, 0xc815c83c, 0x00009b6c,
+        0x68d86854, 0x3c888b62, 0x2c512c0d, 0x00003ed3, 0x0a0b0a41, 0xcdc43a30, 0xc47bc417, 0x000029f9, 0x97a79747, 0x047b50d2, 0xb368b3af, 0x00009245,
+        0x07a40709, 0xe4a2ced1, 0xc185c1e3, 0x0000a808, 0xff9effbc, 0x31a9177a, 0x622362fb, 0x0000593d, 0x8d488d99, 0x30cfd409, 0x7ec17ed5, 0x00000eb5,
+        0x06f106e7, 0x238c8ea1, 0xb4e5b43b, 0x0000273a, 0x6eb26ecd, 0x002b04b2, 0x8a8a8a35, 0x0000933f, 0xe1cfe1cb, 0xee10f12b, 0xd0f1d087, 0x000094e0,
+        0x88de88d5, 0xe7b5dec4, 0x1a251a93, 0x0000c223, 0x4cf74c8d, 0x92dc2212, 0x8fe38f05, 0x00003313, 0x08500892, 0x017a152f, 0x6d186dc7, 0x0000c4f2,
+        0xa627a657, 0x673ed859, 0xa775a78d, 0x0000b7cc, 0xaaa2aa71, 0xda8b82c1, 0x4b374b82, 0x0000b3a9, 0xe3d2e347, 0x431937d4, 0x89c08931, 0x000077ad,
+        0x2cd72c71, 0x6d60d239, 0xceb5ce0e, 0x00008ac3, 0x5afa5a1c, 0x6c6a37ff, 0x6f606f8a, 0x000083a2, 0x613b6181, 0xdae502f6, 0x18871888, 0x00007bdc,
+        0x685c6892, 0xfbaa45c4, 0x487d48df, 0x00001602, 0x71cc7184, 0xdddbea0c, 0x6e496ea0, 0x0000e0ad, 0x16ff16a9, 0x5fc87050, 0x2bf42b1e, 0x000046e7,
+        0xa219a2bc, 0x128a5312, 0xd103d144, 0x0000eef6, 0xd118d1d2, 0x697e44c4, 0x2c682c5e, 0x000018e3, 0xdf7bdf70, 0xf4deae8a, 0x6b5e6bb6, 0x0000b342,
+        0xaf86afda, 0x55f63cc0, 0x741a7486, 0x0000c874, 0xb58db507, 0x3bafbac3, 0x99ad99d8, 0x0000bfe4, 0x851285dc, 0xfbaadf24, 0xccd1cc25, 0x0000870e,
+        0xca1bca95, 0xc10bbd4b, 0x12341294, 0x0000603e, 0x5cd65ca2, 0x44448ce2, 0x804580f2, 0x0000098d, 0x2ff32f39, 0x42564dd5, 0xce1dced2, 0x00002352,
+        0xa30aa35f, 0x047b1955, 0xa276a223, 0x0000464f, 0xaae2aad3, 0xeaa72508, 0x90479037, 0x0000acc0, 0x9c369c52, 0x9267f22b, 0x4ab94a17, 0x0000df74,
+        0xd5fdd560, 0x7e6d40c0, 0xd19ed125, 0x00002864, 0x7bc47b2e, 0x3246d502, 0x9bc19b33, 0x0000cd6d, 0xec21ec6c, 0x3f8cb617, 0x69266939, 0x00008e2f,
+        0x843d8491, 0xa7458da1, 0x9ea09e87, 0x0000ae74, 0xb4fcb4e2, 0x528c38f1, 0xfd61fd12, 0x0000b442, 0x779b7777, 0xff598233, 0xbe77be8c, 0x0000cb07,
+        0x8e958e48, 0x3338c6c1, 0x066b0631, 0x00002486, 0x6d3b6d98, 0xa4a05680, 0x89188945, 0x00008961, 0xe87ce815, 0x4b062d4d, 0x34a934a0, 0x00004b3a,
+        0x3cc03c09, 0x26587b2d, 0x1045106b, 0x0000969f, 0xe2d7e2df, 0x39b7a8b8, 0x9b849b22, 0x0000d91a, 0xeac3eaa9, 0xed79d57c, 0xd9c3d9d5, 0x0000ea94,
+        0x0a110abd, 0x829f7dbf, 0x544c5453, 0x000008a1, 0xf58cf559, 0xec00109c, 0x39973987, 0x000097ea, 0xd751d7c6, 0x29c0d6a8, 0x72e472b9, 0x0000e7c3,
+        0x0ec50e0a, 0x4cc479dd, 0x236323c7, 0x00003e91, 0x523f5294, 0x54a3ba16, 0x9c5d9c6e, 0x00004311, 0xc46ec476, 0x2efd61d5, 0x3dda3d8c, 0x0000f452,
+        0xea15eab7, 0x6b40e13e, 0xd63cd642, 0x0000d7a5, 0xf8fdf8d1, 0x6d7e7419, 0x39c939d6, 0x0000814e, 0x8e3c8eff, 0x3c9af5a7, 0x29bd2944, 0x00008e30,
+        0xbde7bd14, 0xc87ae8ce, 0x8e588ef3, 0x0000b4f5, 0x9d2f9dad, 0xa57ea6d1, 0xb445b457, 0x00002587, 0x7dc37d9f, 0x36377352, 0x79797979, 0x0000d2f8,
+        0x610261a9, 0xc27fd03c, 0x5839581f, 0x00006af4, 0x74d6744b, 0x230f87be, 0x33623322, 0x00008b9c, 0x9f949f63, 0x444394c7, 0x6a8e6a89, 0x0000b9c6,
+        0xd144d18b, 0x2f9c734d, 0x0a720a9f, 0x000049a8, 0x96ce9601, 0xe9ecc489, 0x0b940b92, 0x0000ebe2, 0x52fa52a4, 0x429931e1, 0x237923b4, 0x000033e4,
+        0x6e5d6eb0, 0xa50de11b, 0x732e730c, 0x0000073d, 0xc939c932, 0x65bc9d4a, 0x55ed55e1, 0x0000c54c, 0x9e1e9eaf, 0x4105fc46, 0xe947e904, 0x0000398c,
+        0xaeaaaeb0, 0x6d979070, 0x756875ad, 0x0000e5d9, 0x085b0862, 0x3db7b4d6, 0x8a1f8a3e, 0x0000f02d, 0x7687761b, 0x2eb6bd48, 0x3c393cb5, 0x00002166,
+        0x597f596a, 0x805878cf, 0x259b25d0, 0x0000fe21, 0x4f3f4f8d, 0x7f2bc596, 0xeff1ef5b, 0x0000a650, 0x116f1141, 0x876b3d73, 0x4fe74f5f, 0x000041f0,
+        0xd151d179, 0xa8ae349c, 0xa094a08c, 0x0000eabe, 0x43334355, 0xecd1783e, 0xeda8ed98, 0x00007860, 0x80688037, 0xfa0d7cb9, 0x4f614f06, 0x0000998a,
+        0x8c6c8ca7, 0xe47fd74b, 0xeb51ebee, 0x000035dc, 0x21832183, 0xb2c18c61, 0x6ac56a8b, 0x00005cd6, 0x76f67652, 0xa9d04e2f, 0x60bd6020, 0x000006df,
+        0x8b6d8b09, 0xd74dc743, 0xb93eb932, 0x0000aba7, 0x1fc31feb, 0xae13ef1c, 0x62dd62be, 0x0000ea5f, 0xf238f278, 0xe1360748, 0x0aaa0ada, 0x000032cf,
+        0xafcfaf91, 0xe6c096dd, 0xa15aa1e2, 0x00000563, 0xa7fca7cb, 0x0a2bd899, 0x350435d1, 0x00004d82, 0xed1cedf3, 0x7dac6a7d, 0xdc3cdc19, 0x000050b9,
+        0x1d1e1d39, 0x619a86f3, 0xc16fc184, 0x0000249b, 0xa1b6a160, 0xc91d7836, 0x2a7e2a4e, 0x0000c478, 0x26792605, 0xe7174b56, 0x0ba90b83, 0x0000f93d,
+        0x63bf6351, 0xee7d2d71, 0x34523424, 0x00006c09, 0xafc7afa9, 0x3c0a8ad7, 0x37593759, 0x00003d92, 0xd77bd7bb, 0x6610a366, 0xa06ea0db, 0x0000eed7,
+        0x11591155, 0xec81a78a, 0x963e96e9, 0x000064c9, 0xdb3edb9d, 0x5e9078cf, 0xd8f1d870, 0x000085cc, 0x0f3f0fd7, 0x870954f2, 0x95eb95b4, 0x0000ddb8,
+        0x621c62ac, 0x19eedf3c, 0x2b032be3, 0x000065e1, 0x36aa361b, 0xc3d62c74, 0x9ea39e3d, 0x0000505b, 0xfa53faee, 0x3a374d52, 0x8028801d, 0x00008c68,
+        0x09750996, 0xe77c6225, 0xce7ace44, 0x00003bbd, 0xe4bae4f7, 0x2202af3f, 0x3524358f, 0x000088c3, 0x04f0043c, 0x98a68810, 0x5a305a0b, 0x0000bc18,
+        0x3fd73fa5, 0x46053816, 0x95409538, 0x00002e76, 0x05db0594, 0xe14000c9, 0x642164f2, 0x0000364a, 0x17e41747, 0xd61e6250, 0x3e243e26, 0x0000c060,
+        0xef7bef34, 0xec52b52b, 0x8b6a8b08, 0x0000d387, 0xb3c4b366, 0x0d24495d, 0x547454c9, 0x00008990, 0xfcdafc0c, 0x15933220, 0x2d982d0d, 0x000027b8,
+        0x7f0f7f21, 0x6ffdd3b7, 0x00400036, 0x00003d72, 0xc034c088, 0x5d1de0d2, 0x0d6e0da8, 0x000000bc, 0x55425594, 0x6840c62e, 0x853c85f9, 0x00007a0f,
+        0x9ff69f53, 0x65bb64a2, 0xacafac02, 0x0000b9b1, 0xcbe7cbe1, 0x6a00dfa5, 0x6a5d6af3, 0x00002b0b, 0x96c29697, 0xf457eb4e, 0x05fa050e, 0x00009b91,
+        0x28532828, 0xf7e909d7, 0xe8efe85d, 0x0000ec15, 0xb53ab5df, 0xe23d2754, 0xef62ef5a, 0x00000c53, 0x51d8513d, 0xc945d293, 0xd83fd846, 0x00002f4f,
+        0x1a381aaf, 0x7af6c1dc, 0x4ea84e02, 0x00002ca9, 0xc09dc031, 0xf2de514c, 0x9fd09f91, 0x0000de95, 0x873a8746, 0x2d2962d5, 0xbfbabf46, 0x0000039f,
+        0x68246860, 0xe793b126, 0xd736d7f1, 0x00003d8e, 0xb389b35a, 0x12f5706f, 0x7721770b, 0x00002aa4, 0xd8a8d83d, 0x4d97ef5b, 0x5d415d7d, 0x0000c6af,
+        0x7fc97f52, 0x4a05e312, 0x095b0939, 0x0000e1cb, 0xf384f304, 0xc89a37de, 0x5d335dd5, 0x0000a577, 0xaccdacae, 0xd8d36d17, 0x256d2549, 0x00001cd3,
+        0xdcffdcda, 0x16bd7d42, 0x87c1870d, 0x00003104, 0x599b5991, 0xab7fe22d, 0xd05ed033, 0x00005e50, 0xa6c9a6d8, 0xfbcf177a, 0x92ce9287, 0x000056b9,
+        0xc3e4c3bc, 0xd0b437a9, 0xc3dcc39a, 0x0000fe5c, 0xb7d9b7bb, 0xd46ad0e8, 0xe374e33f, 0x00008d2f, 0x7bc17b62, 0xf177e1f8, 0xbc85bc23, 0x00008c61,
+        0x01020150, 0x38508b5f, 0x374f3757, 0x000077d1, 0x095009a4, 0xc2390ad7, 0x93b593ba, 0x00005da7, 0xaaa3aad7, 0x29e2f9bc, 0xd8ffd8a8, 0x00003230,
+        0x6be26b21, 0x535d06ea, 0x0e1c0e1f, 0x0000ad7c, 0xaae7aa31, 0x2bbcf4a4, 0x4c874c5c, 0x00003457, 0x4ce94cac, 0xd5c95f6a, 0x9acf9a61, 0x0000b142,
+        0xa947a994, 0x19f2356f, 0x84d38494, 0x0000ab85, 0x074507b4, 0xc3250855, 0xe18ce168, 0x0000aca6, 0x4d2e4d02, 0x5de7e0d3, 0xeaddead4, 0x0000ebea,
+        0xf7d8f7de, 0x6f82c7c1, 0x985598e3, 0x0000e033, 0x22912232, 0xb47b7d34, 0x2dee2db2, 0x00007e61, 0x18bd1814, 0x3adcf303, 0x8037801c, 0x00007051,
+        0xcb29cba4, 0x60b25492, 0x4e104e63, 0x0000ac8c, 0x9a5a9aeb, 0xbea9e6a1, 0x74df743a, 0x0000d2a5, 0x3f7c3f32, 0xaf519643, 0x365f3659, 0x0000a308,
+        0x862286dd, 0xee9864e9, 0x442544cf, 0x0000bd1c, 0x256925b4, 0x16daa93f, 0x2d6f2d02, 0x00004af2, 0x2fc62f8a, 0x99f39a94, 0x0ea10eb9, 0x00009116,
+        0x15f31500, 0xa513864a, 0xe63de6db, 0x00002b0a, 0xfd2ffde0, 0x8237e342, 0x439943df, 0x00008ff5, 0x3c053c47, 0x162fafcd, 0x065606b0, 0x00004ea9,
+        0xf2a9f2f4, 0x5b86a5d4, 0x180a1800, 0x00000cbc, 0x581058a6, 0x6f1c8ce1, 0x9b119bbf, 0x0000b5b1, 0xc059c053, 0x667f460d, 0xaf36af20, 0x0000c523,
+        0xe326e3c4, 0x8c0f58dd, 0x673767bf, 0x0000974b, 0xc40ec4c8, 0x4c5fcae3, 0x048104a9, 0x00003879, 0x32083255, 0x1fb13df2, 0xe1abe1f7, 0x0000a375,
+        0x0552057c, 0xf5512db1, 0xd9acd997, 0x0000acb8, 0x06730679, 0x1e8a30f2, 0x7d9c7db4, 0x000047f0, 0x157115fc, 0xbd6c6937, 0x535e536f, 0x00003768,
+        0x3ca23c2a, 0x3a5bc6da, 0x5ce15ce6, 0x0000f0ec, 0x72557235, 0xc75568f4, 0xd51ed5d7, 0x0000ea16, 0x05dd0595, 0x9cc7d8e5, 0x4cc04c83, 0x0000dc98,
+        0xb5f4b51b, 0xb9ec1c67, 0x04e70483, 0x00009dae, 0x73ae7370, 0xdf1fd183, 0x8c5d8c15, 0x00000b63, 0x204b202e, 0xc37cc89c, 0x5f405f51, 0x000039fd,
+        0xd9aed9df, 0xd48062e9, 0x55ac5555, 0x0000563e, 0x7ff97f15, 0x63a1eafd, 0x8b638bbd, 0x0000c97d, 0x8b0b8b44, 0x0daa9744, 0xbacaba6a, 0x00003a9f,
+        0x237b23a1, 0x296619a6, 0xc643c6ae, 0x0000a651, 0x8b808b62, 0x8fa78bd0, 0x2b3b2b0f, 0x0000968a, 0x0e3b0e75, 0x3619d9f6, 0xa51fa54c, 0x0000ea0d,
+        0x0d190d4f, 0x9bca489b, 0x1c6d1c7a, 0x00007760, 0xedeeed4e, 0x1a6ab8b5, 0x63f0631a, 0x00000448, 0xc8fac8b8, 0xb4fffd43, 0xa6b6a666, 0x000093e2,
+        0x2de12def, 0x95d9f38e, 0xf126f130, 0x0000b2ac, 0x27a82768, 0xba4d2bbc, 0x202220bc, 0x00006f14, 0x7f327f99, 0x0a2bf659, 0xe54fe5b7, 0x00001f2c,
+        0x97dd971b, 0xd62e34c0, 0xafb6af0a, 0x00005306, 0x15d815a4, 0x1205349a, 0x0da20dfd, 0x0000366c, 0xf4f3f40a, 0x186b99ab, 0x989098a9, 0x0000bb0c,
+        0x42a74288, 0x28e20e59, 0xd07ed059, 0x0000f31e, 0x7bb67bb2, 0x594ace93, 0xebb3eb6b, 0x00009ad1, 0x253e250d, 0xca9af87e, 0xab76abe4, 0x00009f0e,
+        0x9f3c9fbc, 0xdddb883a, 0x847c84de, 0x0000f26b, 0xbe47bec1, 0xaf336bbe, 0xae7dae43, 0x00003a2c, 0x8e1a8e63, 0xa79f1cda, 0xba41ba1d, 0x000006a0,
+        0x09790934, 0x89a78082, 0x7352732d, 0x00006b8b, 0x4fa94fe7, 0x5be8b15a, 0x0d670dd8, 0x00007c70, 0xfd3efd7c, 0x3b97f967, 0xfe21fe91, 0x00008730,
+        0x2d122d38, 0x3ddb8b52, 0x884f882e, 0x00009049, 0x8ddf8dd6, 0xc5ca34ef, 0x737b7323, 0x000081a2, 0xe6d0e645, 0x70e3b8d8, 0x88138800, 0x0000d7da,
+        0x4ac34a32, 0xa363454f, 0xc016c039, 0x0000f31d, 0xcc9bcc6d, 0x1aca3769, 0xc47ac4da, 0x00003a2d, 0x9ddb9dac, 0xa17c86cf, 0x4f034f45, 0x0000dbea,
+        0x535c5374, 0xec10d349, 0xa332a3cd, 0x00009f0e, 0x7b607bd4, 0xe543daa5, 0x45034547, 0x0000c023, 0x06b20685, 0xcd27bf3b, 0x50dc50be, 0x00006200,
+        0x64bd6463, 0x0c0aef32, 0x6fd86f66, 0x00006617, 0x12d4126f, 0x157a3fc0, 0xfc5bfc0d, 0x0000584d, 0x5e025ec6, 0xb4fa74e2, 0x916d9105, 0x000038af,
+        0x20de2052, 0xd54f7bdc, 0x2a0d2a25, 0x000086ff, 0x3a6c3aa4, 0xbba9d8e6, 0xf216f2e7, 0x00008f5f, 0xa88da833, 0x9c588fde, 0x3e8b3e2d, 0x0000563d,
+        0x314631d2, 0x512d7f3d, 0x80ed8025, 0x0000b1a8, 0x93b69335, 0xbd856ecf, 0xc8f8c86d, 0x0000498c, 0x95b1952d, 0x005c1286, 0xc677c6e8, 0x0000aa09,
+        0xb351b3a7, 0xc55ddf52, 0x4e7a4ed7, 0x0000c97c, 0x5b3b5b21, 0x4648cbd8, 0x5ff85f18, 0x0000e17b, 0xf508f582, 0x0e34c871, 0xf95ff9ae, 0x00000739,
+        0x58ec58da, 0x6d9dcc31, 0x4d234d5d, 0x0000b3d1, 0x9461942f, 0x9ac97a76, 0x7f357f0f, 0x000018f2, 0x2bfc2b51, 0x14f9f1af, 0xc2ebc208, 0x000099d1,
+        0x32c93223, 0x9479464d, 0x9ce79c68, 0x0000819d, 0xa02ea08f, 0x578afe8e, 0xb051b0df, 0x000033ab, 0xff5eff2b, 0xfece1d20, 0x1e3e1eb6, 0x0000d74b,
+        0x33b133bd, 0xb1ad09ba, 0xa022a01f, 0x0000e702, 0x984c989f, 0xbf1381f5, 0xd18ad1b2, 0x00005079, 0xc76ac7cb, 0xfd831c99, 0xd06ad089, 0x00001dc3,
+        0x2db72deb, 0xaf71c5f1, 0xc402c4cf, 0x0000f0b3, 0x43724344, 0xd8db315c, 0x733673c4, 0x00001788, 0xe5fce57a, 0x54ec2b3b, 0x477b4746, 0x0000ec8b,
+        0xed98edc8, 0x45491701, 0x5d3d5d72, 0x0000ef9b, 0x621962f9, 0x9c3be5d8, 0xa973a935, 0x00006200, 0xf3daf3fc, 0xa57c32e3, 0x95979521, 0x0000a907,
+        0xdfb8df1e, 0x677aeef3, 0x3fde3f08, 0x0000c312, 0x6daa6d09, 0xc8553fc0, 0x35523549, 0x00002b3d, 0x1d5f1db5, 0x9728a39f, 0x2f582feb, 0x00009d7f,
+        0xac0bacac, 0xf08668f4, 0x0d6b0d96, 0x0000ca06, 0x0e850e36, 0x2d42ee3d, 0x85648530, 0x00001359, 0xbdc0bdb3, 0x4ac99cf7, 0x6f1c6fbc, 0x000084a2,
+        0xa61da6bc, 0x7a091953, 0xc26ac2e5, 0x000065f1, 0xf6a3f6f0, 0x8c98ed1c, 0xf206f227, 0x0000f0d2, 0x496a49f8, 0xb47a4fea, 0x165f1644, 0x0000e5db,
+        0x8dd58dd6, 0x308cf0a9, 0x0a6a0af5, 0x00009458, 0x0a420a62, 0x5acb37c0, 0xd64dd61e, 0x0000ca8d, 0x572757c7, 0x6d9e3b31, 0x6abb6a52, 0x0000b3dd,
+        0x142b140e, 0x5aa799ea, 0x24af24f6, 0x0000c132, 0x061806ff, 0x079baa87, 0xbb24bb48, 0x00003c4d, 0xe18be12d, 0xef52e312, 0xfb44fb18, 0x000077d0,
+        0xc45ec437, 0x84d54d4a, 0x18901811, 0x00009014, 0x9dba9d31, 0x15939d27, 0x864886f3, 0x0000aad9, 0x0ed10e13, 0x240ff93a, 0xd167d16b, 0x00007696,
+        0x47e447fe, 0xdbef9544, 0x419b41fd, 0x0000b6a9, 0xe87ee867, 0x2a667ebf, 0xe65de647, 0x00009134, 0x90ee90cb, 0xc8c6b2a6, 0x7dac7d37, 0x00003b13,
+        0xc346c3b9, 0x6940a0db, 0xd750d712, 0x0000677f, 0x682e68bb, 0x87f7eef2, 0xdf9edf78, 0x0000b775, 0xa7ada7e2, 0xe3a32d4d, 0x7c107c49, 0x00002556,
+        0xc6c3c620, 0xe0028da7, 0xd329d323, 0x00002fcb, 0x210a213f, 0x98f186fe, 0xe8ede8a5, 0x0000575b, 0x0cc70cd2, 0xc49a3b4c, 0x4883480d, 0x0000b52c,
+        0x339d33d7, 0x6e2efa4e, 0x26012664, 0x00007a29, 0x4cd34cee, 0x0bb58dea, 0xc42fc4ec, 0x0000f562, 0x445b444d, 0xa3f2c7c5, 0x24fc24e5, 0x000099a8,
+        0xbe4cbef8, 0x2d53ae98, 0x5c895c5a, 0x00009cf7, 0x7708772d, 0xdcf8599c, 0xe842e803, 0x000063a6, 0x5189515d, 0xd44c08d9, 0x931e935c, 0x0000f7f9,
+        0x253525de, 0x45264eb2, 0xbddabd8b, 0x000022b6, 0x26df26e4, 0x97688188, 0xac4aacb9, 0x0000ca83, 0x36ff36ae, 0xe92d7069, 0x096a0943, 0x00000192,
+        0x9c639c59, 0xa8d07ac0, 0x8ebb8ec2, 0x000046e4, 0x82b98293, 0xeb176759, 0x27c0279c, 0x00000033, 0xe602e668, 0xa27fc32e, 0x33a133d5, 0x00002156,
+        0x15ed15d8, 0x56ddbd75, 0xa564a5b0, 0x0000d1db, 0x63886357, 0xac5b2626, 0xad67ad98, 0x0000ac08, 0xb473b42b, 0xd309ae9f, 0xaab6aa2f, 0x0000b9cc,
+        0xd393d3b4, 0x9106182c, 0xdb5fdbff, 0x00005cae, 0xf55ff526, 0x80d87ba0, 0x29ea2910, 0x0000881e, 0x997399c6, 0x072b8001, 0x1536150e, 0x00005505,
+        0xd335d3f7, 0xdfdbc535, 0xf935f99d, 0x0000a055, 0xccabcc77, 0xf5bf568d, 0x97cc976f, 0x00009d30, 0x67af67ae, 0x3acd88c1, 0x872e87a6, 0x000045cd,
+        0x062f06b1, 0x8bb83992, 0xfb63fb8d, 0x0000dcd5, 0x3b283b51, 0x89eee5a1, 0xa50ca5b3, 0x00001129, 0xf840f865, 0x4f5e1cec, 0x89778983, 0x0000b77d,
+        0x541e5481, 0xd7d435ee, 0xec2dece8, 0x0000e3b0, 0x9c3f9c2d, 0x5e567ec2, 0x906690c9, 0x0000a455, 0xd98bd968, 0x8d27c040, 0xf1d3f11f, 0x00008a1b,
+        0x16661616, 0x4af67351, 0x32a932e7, 0x00002e66, 0x2425240c, 0xf10b2abf, 0x337733ce, 0x00000f6f, 0x03430329, 0x06661b53, 0xd336d37c, 0x00005399,
+        0x13be135c, 0x8c9b05b4, 0xb263b20f, 0x0000773b, 0x9c179c5b, 0x4f97862e, 0xe36fe388, 0x0000adfb, 0x835483cc, 0x78cd1f65, 0x844584b2, 0x000071ee,
+        0x991c9945, 0x6c1cc737, 0xc0f1c0f7, 0x0000e5c2, 0x41ea412b, 0xc6a42ac6, 0x275227bb, 0x0000a63c, 0xb51eb55a, 0x2f1f824d, 0x7c217c92, 0x0000e689,
+        0x9f649f5a, 0x7970f9b9, 0x0a0b0a6a, 0x00009783, 0x48db486b, 0x94fed297, 0x641764ab, 0x0000c02d, 0xe899e8c4, 0xaa51412a, 0x0bdc0b2c, 0x0000b613,
+        0xf7d1f729, 0xb0c9bec9, 0x3d4b3df5, 0x00009d8a, 0x2e0a2e69, 0x13553866, 0x7c787c7b, 0x00000fbd, 0x852b8520, 0xf6fd2037, 0xc423c413, 0x0000bd8e,
+        0x20572032, 0xce3a24e9, 0x362736d3, 0x0000eb64, 0x171417df, 0x6e6095c8, 0xf24bf290, 0x00008b2e, 0x03160388, 0xc6254bad, 0x91c79132, 0x00005834,
+        0xae8eae8a, 0x97d6333e, 0x0f2d0f81, 0x0000cf53, 0x68e66822, 0x8108d4cb, 0x30b9307b, 0x0000f60c, 0xf5b4f5d5, 0xd1cbf2ea, 0x56555637, 0x000064c8,
+        0x25d425bd, 0x21e231e0, 0x9b5a9b54, 0x000090cb, 0xf633f624, 0xb4df2544, 0x23e823b9, 0x00005bd7, 0x94f094d5, 0x9ea60cd9, 0xfd59fdd7, 0x0000ee74,
+        0x47c14779, 0xbd4bd8d9, 0x527752c0, 0x00001f4c, 0x23af235f, 0x7097b3a7, 0xdaefda4f, 0x00005ae8, 0x0d640d94, 0x60b2cd57, 0x0783079b, 0x0000c08f,
+        0xa468a4b6, 0x0927b23f, 0x6be56b54, 0x00002795, 0x890a8998, 0x593c9738, 0x803880f4, 0x00004ef6, 0xe2f5e2f8, 0x51d847ce, 0xd764d723, 0x0000a410,
+        0x27032796, 0x39915ae3, 0x09c9092f, 0x00007622, 0x2623267d, 0xd0db81cf, 0xd065d09d, 0x0000e693, 0x8e618ea7, 0xf7299c1f, 0xe379e3a3, 0x00009850,
+        0x5aa65ada, 0xd60db71f, 0x735a7390, 0x0000456e, 0x21ef2103, 0x186b9e25, 0x0b420be6, 0x0000ba13, 0x9eb39e9c, 0xbf4b89ee, 0x35b135a1, 0x0000eb99,
+        0x426e4227, 0xa541b024, 0x222822ae, 0x00002b4b, 0x5c265c17, 0x5e8010bc, 0x5db85dd8, 0x0000c5be, 0x14ad1474, 0x53bf39ee, 0x40344020, 0x0000988a,
+        0x91b49135, 0x771c7ea9, 0xf699f62a, 0x0000ac4a, 0xdf56df7a, 0x826e9640, 0xd58cd598, 0x0000cf10, 0x9f099fd0, 0x304f697d, 0xb21ab25c, 0x00005b62,
+        0x528752f7, 0xe6a2641a, 0x970097cd, 0x000058df, 0x2309235a, 0xc6ca0969, 0x6a8a6a88, 0x00001788, 0x358d3598, 0xea529a55, 0x6a186a99, 0x00009b14,
+        0xe4c3e480, 0x18a5706d, 0x8f0e8fbb, 0x00004430, 0xeeadeecc, 0xb1272061, 0x2b162b75, 0x0000b4f7, 0x777e7747, 0x082b60ef, 0x587858a4, 0x0000c237,
+        0x5c705c84, 0xf9d9595d, 0x5ef05ebe, 0x00004611, 0xce16ce19, 0x5157fd73, 0xd103d1bf, 0x00000272, 0xfd4cfd44, 0xd76bccaa, 0x876087d1, 0x00001768,
+        0xc90dc991, 0x7c0018ec, 0x4b1d4b9c, 0x000049a8, 0x56db5667, 0xfd6d2d26, 0x1c301c16, 0x0000928a, 0x519e510a, 0x61bbdb5b, 0x76457616, 0x00006684,
+        0x13dd13a1, 0xe4615343, 0x329a3288, 0x0000b70e, 0x0dd70dd0, 0xbcdbd476, 0xc2f7c288, 0x0000cc07, 0x9402948c, 0x90a6aeeb, 0x8c5e8cdd, 0x00006fa7,
+        0x1e781ea3, 0x4ce27b3d, 0x4d844d3c, 0x000029ba, 0x3b873b4f, 0x1731a99f, 0xa684a68f, 0x0000de67, 0xcb16cb92, 0x68c8e152, 0xb669b6c4, 0x000008e6,
+        0x7dfc7d39, 0xb0a33221, 0x4c884c37, 0x0000cbcf, 0x271d2730, 0x1b6cdedb, 0x598059a5, 0x0000daf5, 0x34383452, 0xecf2e4d8, 0x1a271a9c, 0x0000defb,
+        0xc13ec16a, 0xd492b566, 0xd5ead596, 0x0000ec03, 0xa3b1a3f3, 0x5e728ecf, 0x9e729e04, 0x00008a1b, 0x898d898e, 0x8b4f5d13, 0x06e906ad, 0x000046b0,
+        0x3b843ba0, 0x8bf752bc, 0xf9cef935, 0x00006d15, 0x2fd32f5c, 0xfbb3bc38, 0x53ab533b, 0x00009c0f, 0x259025b6, 0x135f56cd, 0x26282658, 0x00009122,
+        0x1c2c1c5d, 0xa6a624af, 0x66a66679, 0x000084a2, 0xd3c3d3ea, 0xd9049778, 0x742c7464, 0x00004012, 0x0ac60ad2, 0x8dbb2648, 0xb930b9e3, 0x0000a519,
+        0x42074201, 0x6dc33d80, 0xd191d1b0, 0x0000648b, 0x44014434, 0x47c50855, 0x270d27e5, 0x0000bf19, 0xd315d3c9, 0xa85bf1d4, 0xee3fee8e, 0x00002e9b,
+        0xf995f9ea, 0x2a66938e, 0x8d3f8d83, 0x00007bdc, 0x1ddc1d87, 0x97692f39, 0x271527d4, 0x00007b4f, 0xfe37fe8f, 0xd337cfad, 0xcf6acf14, 0x00008d71,
+        0x335f3382, 0xa8c5d34a, 0x345a3488, 0x0000e9e2, 0xdcd3dc2b, 0x4ca7020b, 0x4d8a4d89, 0x0000478f, 0x7bd47b42, 0xa0deab6b, 0x29fc2944, 0x0000f0ad,
+        0x14751441, 0x7af67209, 0xf35cf311, 0x0000ad66, 0x5d8c5d44, 0x0cd70696, 0x839c8338, 0x0000ccdd, 0x03a5035a, 0x3ea6bdb9, 0x96e796a7, 0x00004acc,
+        0xea29ea20, 0x1915ec4c, 0x2b4d2bc5, 0x00002a67, 0x185118da, 0x9e2dd6a3, 0x00400054, 0x00001c47, 0xe2f4e284, 0x4a172c4d, 0x7ead7ec3, 0x0000790f,
+        0x7d177dda, 0x7967a879, 0x11691193, 0x0000d0eb, 0xe6e1e678, 0x37e7396c, 0x48ee482b, 0x0000086b, 0xd94fd9b8, 0xa98e80cf, 0xe3e6e3e8, 0x0000493b,
+        0xb9aab998, 0xd60e13e1, 0xad31add0, 0x0000c013, 0xd058d085, 0x3abb6019, 0x345c3498, 0x0000327c, 0xc3e4c300, 0x7855f9a7, 0xa36da332, 0x0000035d,
+        0x88088837, 0x098bf9d8, 0x656a657d, 0x00006815, 0xfc15fcdc, 0xb06c88fe, 0xffbbff53, 0x00009331, 0x3d593de3, 0x52d8785f, 0x5eaf5ef7, 0x00002f35,
+        0x9126913b, 0x78b2f069, 0x28c62833, 0x00003824, 0x6a246a92, 0xc1ca49f5, 0xf7d5f77f, 0x0000ee24, 0xae0dae18, 0x51516f85, 0xd619d689, 0x0000feec,
+        0xa1a0a13a, 0xc0455eed, 0x6a666a30, 0x0000fba1, 0x3e083eb5, 0x5d0f1555, 0x703e70ed, 0x00005a47, 0x2b2f2b0c, 0x31285f91, 0x203620ae, 0x000097d5,
+        0xf641f66a, 0x18150136, 0x477747b8, 0x00001049, 0x190e1993, 0x17aa93b1, 0xfd28fd81, 0x0000eb64, 0x3af83a6d, 0x5bff0fa7, 0xe165e17a, 0x00003483,
+        0xc3aec38f, 0x2f022f39, 0x7e677ef5, 0x000092cb, 0xbfb1bfe0, 0x4ca912fe, 0xef13efcb, 0x0000f501, 0xc634c6db, 0xbba9d6b5, 0x13b3135a, 0x00005d65,
+        0x313931aa, 0x63a512da, 0xcb3acb72, 0x00009614, 0xa10ca1bd, 0xa9f030a1, 0x8998897d, 0x00005a29, 0x3bc23b64, 0x9bd976d4, 0x5f1f5fc5, 0x00008a1a,
+        0x96619644, 0xc17d2cbf, 0xee43ee49, 0x00006647, 0xf732f77d, 0xc107f1d6, 0xe307e360, 0x000093c4, 0x2cc72cef, 0x4ce8749d, 0x7a967ad7, 0x000088e4,
+        0xa665a6a9, 0xcc8ab1af, 0x1d9b1d4a, 0x0000da1b, 0xa82aa828, 0x2b2221a8, 0x3187310a, 0x0000b910, 0x07380779, 0xa7511778, 0x62b562da, 0x00001d14,
+        0xcfe5cf07, 0x4ff618d3, 0xc266c2c9, 0x0000a384, 0x61d3610e, 0xc0d4b468, 0xac77ac59, 0x0000d9ea, 0x53f6533d, 0x38552e3b, 0x354f35f4, 0x0000fd1d,
+        0xc498c4f2, 0xfbee9c6a, 0x6d036d60, 0x00006604, 0x333a3352, 0xcdc20af9, 0xe3dbe393, 0x00000bcf, 0xc70dc734, 0xd66b38f1, 0x634163cb, 0x00001dac,
+        0x053f05be, 0xa551e972, 0x115e1146, 0x0000424f, 0x31f331b4, 0xb2545022, 0x21ec21bd, 0x0000624f, 0x0738077e, 0x8dc7e15d, 0x04ba042c, 0x00003bf1,
+        0x37613763, 0x68c1b707, 0x505e503a, 0x0000b533, 0x8cc08cd6, 0x716f5ed2, 0x7c477c5e, 0x00007aa3, 0x13211309, 0x176a913c, 0xd8f2d8e1, 0x00002402,
+        0xfe11fed2, 0xb0138fe1, 0x1b201b6b, 0x0000250a, 0x00a5000a, 0x2272391f, 0x3a5a3ad2, 0x00000433, 0x025a02c3, 0xcf2a8d3c, 0x8f258ff4, 0x0000b701,
+        0x191f1918, 0x31453bce, 0x141a1477, 0x0000ffc5, 0xa41ea45d, 0x4eb57666, 0x1ced1ca6, 0x00006c96, 0x08cc08b0, 0x2b63b1d8, 0xe122e12c, 0x00006730,
+        0xb176b1f6, 0xca645578, 0x9a879a2c, 0x0000c802, 0x98be9836, 0xdb2e915a, 0x5a3f5a4a, 0x0000a4e9, 0xa2a6a291, 0x77ddc17a, 0xeb92ebb1, 0x000048e8,
+        0xadd5ade7, 0x7002cc7c, 0xcd71cd52, 0x00009df5, 0x21e82116, 0x5c68148b, 0x92ed92f5, 0x0000aec1, 0x3e493e1b, 0x578718b9, 0xca72ca30, 0x000067a9,
+        0xa003a055, 0x6a00bb12, 0x901290e3, 0x0000ed52, 0x69b0696e, 0x18158ca1, 0x70427044, 0x000014e0, 0x8982898f, 0x3f3cd13b, 0xfc0efcd4, 0x0000b580,
+        0x5d1c5d1b, 0x3d5b0534, 0xc35bc3ff, 0x00004e08, 0xedeceda1, 0xffab8f5e, 0xabf2ab50, 0x0000e289, 0x17ff177f, 0x9de73df2, 0x27372727, 0x0000dc1e,
+        0xabd0ab40, 0x4cf6201e, 0x4f164f9c, 0x00007ef9, 0xe411e463, 0xa0619bd0, 0xcf25cf98, 0x0000e828, 0xf9cff914, 0xe2c50e5b, 0x1891181b, 0x0000ccb2,
+        0x855d8599, 0x0e870e27, 0xdec3de2e, 0x0000d7da, 0xb208b27f, 0x7f59fa15, 0x2a6f2a95, 0x0000a451, 0x09ec09c3, 0x101c2f82, 0xaa63aa6c, 0x0000bf24,
+        0xd480d4c6, 0xfe218336, 0xf643f615, 0x00000563, 0x444b4447, 0x4216b835, 0x512e51ed, 0x00004e48, 0x07dd07c8, 0x4ce197be, 0x83f783f3, 0x00009a9f,
+        0x0fe50f91, 0x137b004a, 0x5e9e5e28, 0x0000c2e7, 0xe87be8ae, 0xdae5560b, 0x860d86d4, 0x00006328, 0x4aa64a6d, 0x736cfa98, 0x0d0c0d93, 0x0000b8d0,
+        0x417c4134, 0x7c7e81e1, 0x7e877e50, 0x00000c9d, 0xd480d4c1, 0xbc4aac67, 0x5a035a08, 0x00009599, 0xfb45fbd0, 0x4f363468, 0x4d594dbc, 0x0000482d,
+        0xf97bf9e6, 0xa1beadb8, 0x85678595, 0x00009c4f, 0x99f19963, 0x8c587ebb, 0xbc66bcdd, 0x00006923, 0xe2c7e2a5, 0x5788cdac, 0x132a1342, 0x00003e12,
+        0xe66de651, 0xcbf515c2, 0xb9a4b91e, 0x0000650f, 0x0e260eca, 0xdea4a6ee, 0x3c603c4c, 0x00003b13, 0x6f2a6fc5, 0xf4dce55b, 0xe986e9d7, 0x0000d29b,
+        0x325a328c, 0xdb540ca5, 0x6535652b, 0x0000aa4a, 0x94189413, 0x26a6a437, 0x384e38f1, 0x0000e2e2, 0xb4ccb4ef, 0x762cc5a7, 0x6b9b6b49, 0x0000e184,
+        0xaf66afad, 0x41efd7b5, 0x46714637, 0x0000236d, 0x0b340be2, 0xae901be8, 0x910691c1, 0x00003002, 0x653a65a0, 0x7162c43e, 0x5e375eca, 0x0000d867,
+        0xe2aee225, 0x75cca1d0, 0x5a6f5a29, 0x0000a3e3, 0xd347d3f6, 0xfc3d9c62, 0xdc80dc4b, 0x00002da4, 0x8b0f8bd2, 0xebd1b9f5, 0xcde6cde9, 0x00001112,
+        0xff0dff31, 0x692282ce, 0x78047875, 0x0000b197, 0x8d488d3d, 0xe1e37d08, 0x2f972f0c, 0x000064a6, 0xe638e62f, 0x051a5773, 0xfe24fe59, 0x0000d3bb,
+        0xec2cecf0, 0xc97ab226, 0xd030d097, 0x0000e4e2, 0x33673323, 0xdbdcf549, 0xc75cc719, 0x0000df56, 0x0fea0fc1, 0x47596cb6, 0x7295726e, 0x0000324a,
+        0x76a876a3, 0x47f9c5c8, 0xbf70bf25, 0x0000eeb5, 0xc3cec3cb, 0x1a50aa0b, 0xde32de91, 0x000031ab, 0x800080f6, 0x48954fea, 0x53f453c4, 0x0000d4a5,
+        0x1c651c3d, 0x3c199587, 0xc93cc92f, 0x000059e8, 0xd6acd662, 0x782a90f8, 0xba7cbac5, 0x00008e60, 0x18261817, 0x328c06d7, 0x48d14871, 0x0000e17b,
+        0x24c12416, 0xa541ad33, 0x933393ea, 0x00005a54, 0xb88cb85e, 0x8aa48ee1, 0xa172a134, 0x0000ca0e, 0xd91bd91e, 0x42244911, 0x512f515c, 0x0000b7ff,
+        0xaccaac3b, 0xab11a70c, 0xb91bb95b, 0x0000aa58, 0xcf37cf52, 0xba32e7a6, 0xad44ad09, 0x0000a31e, 0xebf6eb28, 0x5c6a91ef, 0x127712cc, 0x0000c35f,
+        0x29672964, 0xe5807a9b, 0xaf6daf3b, 0x0000f262, 0xf9cef97f, 0x217c1641, 0xdd36dd0c, 0x0000a1f8, 0x57955740, 0x01b8c7cd, 0xba3aba13, 0x0000290a,
+        0xf2d8f255, 0xfd49ea02, 0x251425a6, 0x00004358, 0xb66bb64d, 0x80241a51, 0xeaf0eab5, 0x0000d50a, 0x046d04b2, 0x7f42de2c, 0xb473b425, 0x00008950,
+        0xd42fd4de, 0x36b9e972, 0x76cd76d3, 0x0000e4cb, 0x3d623d67, 0x09e2946c, 0x891c8934, 0x000064f7, 0x8dd98d41, 0xddf8d64a, 0x5357536d, 0x000007fc,
+        0x17041763, 0x791a468f, 0x00a90082, 0x0000bcbb, 0x100d1087, 0x3e63976c, 0x78ae781d, 0x0000b5a2, 0x98c598a0, 0x3db757e3, 0x1873186d, 0x0000bcfe,
+        0xb545b56f, 0x762e7414, 0xa298a202, 0x00006d15, 0xe58ce502, 0xc525e0dc, 0x90ac908d, 0x0000376d, 0x8dd58ddd, 0x0565d93e, 0x963096ac, 0x00009a16,
+        0xb1e8b171, 0x17559378, 0x49e64977, 0x0000cc98, 0x7f877fe6, 0xcc6576d9, 0x1b581b19, 0x0000b409, 0x73d87352, 0xc27ac008, 0x19a2192a, 0x00004ef6,
+        0x7a3c7a28, 0x044482cc, 0x8261820a, 0x00005723, 0xb6fdb6d1, 0x831fd9e0, 0x930d93df, 0x0000de9d, 0x9f0a9f15, 0x5be6b69e, 0xbda2bdfd, 0x0000b4a8,
+        0x683868be, 0xa89188be, 0xce74ce2c, 0x0000c4e7, 0x1aec1ae1, 0xdf77b0c7, 0x280328a1, 0x000085be, 0x419a4154, 0xdf5423d6, 0xac72acfc, 0x000070b2,
+        0xab53ab91, 0xd28b0bd4, 0x06bf068d, 0x000084c0, 0x4b024b2f, 0x513abf77, 0x8f1f8fde, 0x0000426f, 0xc8f6c8ae, 0xa64ffc42, 0x8977893b, 0x0000c16d,
+        0xdf72dfca, 0x5f90c408, 0xca42caa3, 0x000022d6, 0x1a771aa1, 0xd5df2afe, 0x4a174aa5, 0x0000c02d, 0xc54dc5d6, 0x5c9d68f4, 0x629a62c8, 0x00006a8b,
+        0x3fdf3f2e, 0x29f3b560, 0x37db377d, 0x00001c93, 0x483a4843, 0x3a459063, 0x3a073ad6, 0x0000b696, 0x47bb47ec, 0xc634d924, 0x34b734a5, 0x0000c63d,
+        0x216721c6, 0x76a8804f, 0x94e394dd, 0x0000091c, 0x5b895b6e, 0x7b7b9331, 0x56ef5663, 0x00001d3c, 0x72f67205, 0x398c3a4e, 0x3fa83f91, 0x0000beb1,
+        0xbc80bca0, 0xb3136d7d, 0x182118a8, 0x0000bd1d, 0xa875a8bf, 0x1dd4408c, 0x66536642, 0x00002d0a, 0xf54af56d, 0xd85276d2, 0xbb92bbe5, 0x00005c28,
+        0x5860583d, 0x23d04147, 0x886588b0, 0x0000805f, 0xa31aa3d6, 0x919304ca, 0x4c0b4ca6, 0x00008261, 0xe208e220, 0x54cb6f48, 0xc187c161, 0x0000890e,
+        0xf1d6f172, 0xa4836365, 0x604e604d, 0x0000f426, 0x4de44d18, 0xcf2420eb, 0x4e8a4ecb, 0x0000a577, 0x75797597, 0x1dad7ab6, 0x484d48a8, 0x0000ac47,
+        0xfa32fa0a, 0xcc45d7a3, 0x3d103d3c, 0x0000d6a5, 0xb7d3b78b, 0x96cad773, 0x9cbc9c2c, 0x0000488f, 0xe882e899, 0x262140b9, 0xf47df46c, 0x000041d0,
+        0x53125387, 0x1ff131e3, 0xd8ffd8a1, 0x0000a355, 0xbceebce0, 0xd8c7ca2e, 0xde27deb0, 0x0000952b, 0xea5cea35, 0x39af15c3, 0xb2fab20d, 0x00001dd3,
+        0x1d611da0, 0xc409a133, 0xeecfee62, 0x00009415, 0xaa47aa47, 0xe5dcdf5b, 0x09410923, 0x0000fe32, 0xd4ded441, 0x34d89fd3, 0x22dd2223, 0x0000c5be,
+        0x17ab179e, 0x3ef5bdf6, 0xd9edd96a, 0x00003340, 0xdbbfdb64, 0x398d7409, 0xa7aea7e7, 0x000057f9, 0x4ada4a6d, 0x4a36d0c4, 0x3141312d, 0x0000ad07,
+        0xb6bbb63a, 0xdd81e9e2, 0x0ea60e0a, 0x0000ea17, 0xbf16bf96, 0xdfc9e866, 0x13e713a0, 0x0000033c, 0xf60af65f, 0x8b346dea, 0x0e5a0e8f, 0x0000d677,
+        0x5e1a5e56, 0xfd0eac1a, 0xe99ee91c, 0x00003b1a, 0xee0eeece, 0x067ba05e, 0xd22bd21d, 0x0000f738, 0x1079105b, 0xbddb204e, 0x17e317e6, 0x0000e2d2,
+        0x242a2447, 0x4019dea5, 0xe570e589, 0x0000d6c7, 0x02b40283, 0xa333db5a, 0x16e5160e, 0x00009daf, 0x111711b9, 0x241284be, 0x08fd084f, 0x0000f552,
+        0xf1dbf108, 0x468dcc08, 0x6b4c6bec, 0x0000dc1f, 0xc76cc737, 0x94aebdb6, 0xdf3edfed, 0x0000098d, 0x325c320b, 0xe862992a, 0xe73ae78d, 0x0000d1c3,
+        0x6d8d6d20, 0x013b8ad7, 0x529052fb, 0x00000204, 0x18e918df, 0x732a7d86, 0xc657c6e0, 0x00006684, 0x3e133ec4, 0xa4415b82, 0x7fdd7fae, 0x00006679,
+        0x334f33e4, 0x95aebc62, 0x7db57d10, 0x0000b967, 0xeb12eb2c, 0x37d80ae9, 0x726872f1, 0x000026bd, 0xa221a2cc, 0x5de74b60, 0x3f1e3f6b, 0x0000c840,
+        0xd81fd89e, 0xefd39d59, 0x93e293c4, 0x0000b18e, 0xd2f0d209, 0x6250be06, 0xb2bcb212, 0x000054b8, 0xdab5daa7, 0x9b23f698, 0x5daf5df4, 0x0000b00e,
+        0xc76fc738, 0xc4b64dae, 0xf24ff2a4, 0x0000dcb7, 0x9e379e72, 0x40e4e9b0, 0x4ff64fe9, 0x0000825f, 0xebd4eb9c, 0xb93f7ec2, 0xf751f70d, 0x0000cb69,
+        0xb89ab8cf, 0xe5d3f663, 0x4c9f4c69, 0x0000f0ce, 0x1734173e, 0x90d6dfe5, 0x450b45a7, 0x0000e3a4, 0x0e390eb0, 0xa741b8ea, 0x14ec1447, 0x00007460,
+        0xed5eed88, 0x7012580c, 0x45e045f6, 0x00007381, 0x7866789b, 0x0a9b3a4d, 0xbcf6bc47, 0x00001119, 0xd177d17a, 0xa060fefb, 0x77d87788, 0x000059d5,
+        0x262726fc, 0x9c88944d, 0x8c998c00, 0x0000364e, 0x94fc9499, 0x1239383f, 0xc26ac2a7, 0x0000c3fd, 0x6c406cef, 0x30cede1d, 0x744074a6, 0x0000de74,
+        0x09ef09e5, 0x61327bd9, 0x73297301, 0x0000c02d, 0x8f6a8f2f, 0xcbcab6a7, 0x885f88d9, 0x00008720, 0x784e785b, 0x90dc43a9, 0xf15df12e, 0x00007d72,
+        0x87a48786, 0xeec6ee50, 0x1163112b, 0x00009514, 0x1aa51aed, 0x26a24d56, 0xc667c69d, 0x000002b2, 0x155415fc, 0x48e60527, 0xd461d438, 0x0000c974,
+        0xb911b922, 0xa09fc179, 0xfd5bfd31, 0x0000f7c5, 0xb2e1b22a, 0xfa981851, 0x11081154, 0x00002f0a, 0x600e60f8, 0x007bf7e7, 0x1c5b1c33, 0x0000436e,
+        0x2599252f, 0xb6cc8efe, 0x0a0b0aca, 0x00004ef4, 0xc24fc21d, 0xa2c0e90c, 0xd606d63a, 0x0000d574, 0x458b452b, 0xc2854cd5, 0x03bd0306, 0x0000876b,
+        0x17df178d, 0xf5c14f29, 0x279727d6, 0x0000b824, 0xac42ace8, 0x6b823fce, 0xdd22dd39, 0x000064c8, 0x29ae2989, 0x18c8bbc2, 0x5fb15f98, 0x00008950,
+        0x2e302eef, 0x88c6d402, 0x837583f5, 0x000080dd, 0xaaa9aaac, 0x25a24e2d, 0x246f24fb, 0x0000ac48, 0xe7aae786, 0xc87a93c3, 0x7e577e8f, 0x00001c92,
+        0xf905f92b, 0x3576bcb6, 0x260b26cf, 0x00007594, 0x042f0498, 0x1460e933, 0x927b922d, 0x0000c407, 0xdf7fdf9f, 0xd7a417fd, 0x4a4e4ae4, 0x00005ce9,
+        0x253e2508, 0x3828c5c9, 0x87bf8792, 0x00000a2f, 0x76fe76bc, 0xef306fca, 0xf50af577, 0x00008131, 0x70c2703f, 0x4e26bc3b, 0xd6b3d6a4, 0x000021cd,
+        0xb48bb483, 0x22784241, 0xa108a114, 0x0000bb8e, 0x79f2791b, 0x33b7ae14, 0x1fce1ffa, 0x0000993e, 0x815081fe, 0x4d9e4adc, 0xfafbfa01, 0x00002e1c,
+        0xdf4cdf24, 0xf07c4bad, 0xb605b676, 0x000046c1, 0x63de637d, 0x75cd478d, 0xf10bf153, 0x0000b4f1, 0x15ca15eb, 0x640d66c5, 0x835e8344, 0x0000cb8d,
+        0xecf8ecbb, 0x272032de, 0x71d1713e, 0x0000dfb1, 0x62bc62c1, 0x2ebd0fa4, 0x7206720d, 0x000007d3, 0x25c225b7, 0x57a748f6, 0x465d461f, 0x0000790f,
+        0x98d498b4, 0x10e563d0, 0xfcb9fc96, 0x000060af, 0x23ea239a, 0xb5850329, 0xdf66dfd3, 0x00004230, 0x1e581eb9, 0xb297c5d1, 0x821482fd, 0x00006017,
+        0x80ee8066, 0xafa16977, 0x314f31f3, 0x000043e4, 0xf9bef9d3, 0x42a69a28, 0x0fe20fb0, 0x0000c09c, 0x65db65d1, 0xef00c663, 0x2410246c, 0x000019b2,
+        0x690d69dc, 0x3950bef7, 0xc63dc655, 0x000057a6, 0x9a929aff, 0x8eee9c98, 0x394d39f4, 0x00004a1c, 0xf158f189, 0x6252c4fe, 0xac3bacad, 0x00005b64,
+        0x8cf48c75, 0x7770a9c0, 0x78b0788a, 0x0000ba76, 0x1a171abd, 0x32022189, 0x53a853c9, 0x00006108, 0xda36da06, 0x996756cd, 0x521552e6, 0x00009614,
+        0x3bd23b6e, 0xe32cdca7, 0x10721095, 0x0000e189, 0xa313a3a8, 0xbb1b28fb, 0xe8f8e839, 0x0000fabc, 0x9ea69e63, 0x8fa77fc2, 0x4c7b4c92, 0x0000b280,
+        0x793279a7, 0x88c72ebf, 0x8869883d, 0x0000d5bb, 0x05df05af, 0x80d7bf77, 0x156f1522, 0x00005e90, 0x0e440e2c, 0x275d9047, 0x19ae1989, 0x000056c0,
+        0x52ed527b, 0x33abeb8f, 0x83118342, 0x00001988, 0x972697ea, 0x8cf816c1, 0xe53ae581, 0x0000a4a0, 0x409d408c, 0xecd3ddeb, 0x7df47dea, 0x00007adc,
+        0x1322130a, 0xb129a887, 0x3edf3ecd, 0x00000db3, 0x52d15263, 0xc28ada5b, 0x0d0f0d3a, 0x0000e4e2, 0x23362333, 0x7dac44b9, 0xb26ab2ae, 0x0000bfc0,
+        0xd364d398, 0xfb1f44db, 0x517951db, 0x000099a8, 0x1a9c1a96, 0xa5a32a44, 0x10c010c3, 0x00009e7b, 0x9720978d, 0x077bb6f8, 0xb686b66d, 0x00006f96,
+        0x9485945a, 0xfd6e8728, 0x9a179a7a, 0x000031ab, 0xe1e6e131, 0xc455e7e1, 0x2324238e, 0x0000223e, 0xaea7ae0a, 0xbc6cbe72, 0x648f64ce, 0x0000a837,
+        0x82fb825f, 0xfa775f12, 0x11f01158, 0x00001414, 0x275927fb, 0x9a72f32a, 0x54b55481, 0x0000959a, 0xc15ac1df, 0x65503fce, 0x746d749b, 0x0000cfaa,
+        0x62f762fa, 0xdb91616b, 0xef00ef00, 0x0000720f, 0xd433d401, 0x63a13dff, 0xcf45cf0a, 0x0000fe25, 0xa134a10d, 0x0e0aa0df, 0x70507081, 0x0000c46d,
+        0x37ed3747, 0x1b6c22eb, 0xecafec0f, 0x000017ba, 0x36bc36ff, 0xc6940748, 0xa5dca5d4, 0x00001fd3, 0x1dc01dce, 0x09cb3bce, 0xf3cdf354, 0x00000e43,
+        0xcd27cda4, 0x36ce75a6, 0xe2b9e24b, 0x000018f7, 0x47ee471b, 0xae5bbff6, 0x335c3312, 0x0000a8e9, 0x92909298, 0x210fdae4, 0xdc4adca0, 0x0000a2ba,
+        0x4cc74c59, 0x488039ed, 0xffbcffeb, 0x000013bf, 0xf164f13c, 0x316fa452, 0xf6a6f674, 0x0000cb94, 0x19c81944, 0xcd33b024, 0x70bd702c, 0x000000a1,
+        0x5bd15b66, 0x19937d45, 0xf775f757, 0x000000b8, 0x05a50570, 0x172a2f54, 0x28fd28a6, 0x0000d09a, 0x64756476, 0xc2d97bfd, 0xd666d690, 0x0000ec5f,
+        0x25812589, 0x8209ebf0, 0xcf80cfdb, 0x00004ca9, 0xcb92cb4a, 0x00dbdc5b, 0x346334f7, 0x0000290a, 0x071b0775, 0x02cff777, 0x00ac0083, 0x0000d1bd,
+        0xc1f1c1bc, 0x8b574f29, 0x144414a4, 0x0000b66b, 0xb157b123, 0x14c6dbd9, 0x667966dd, 0x0000cd9e, 0x4ddb4d1d, 0xdebc4dca, 0x6a5c6afc, 0x0000b0a8,
+        0x9d1a9dac, 0x40649b34, 0x294c2921, 0x00004f42, 0x04f2040f, 0x501743fd, 0x78a978c8, 0x00008020, 0x999a99de, 0x4df6b7d5, 0xa620a654, 0x000070cc,
+        0xc732c77d, 0x7098dba4, 0x9b959b92, 0x00004d77, 0xe926e964, 0x431f51cb, 0x2f192f1c, 0x00004dc1, 0xc1e1c1b7, 0x7f3f554d, 0x29d129e9, 0x0000bfa5,
+        0x03e4032d, 0xb8fe5b23, 0xdc3ddca4, 0x00003a61, 0xa6f9a671, 0x06ed28bf, 0x814b81b4, 0x0000d7da, 0x03980333, 0x717097ad, 0xcbcfcb84, 0x0000d387,
+        0x07f40745, 0xbf1b60bb, 0x559855f7, 0x0000261e, 0x0b190b1a, 0x80f7e7cc, 0x3d613d04, 0x000070e5, 0xc8fbc862, 0x68a069f5, 0xc93ec95e, 0x000067e0,
+        0x5a4f5ab0, 0x7ce34fd5, 0xc6e9c651, 0x0000ad07, 0x50a25058, 0x75cdea4e, 0x055f050a, 0x0000fa38, 0x3bcf3b5b, 0x551fbc37, 0x1061101d, 0x0000226c,
+        0x190e19fc, 0xbb4b9f6c, 0xb570b522, 0x00003c2c, 0x2c8a2cc1, 0xe9520341, 0x0b160b0c, 0x000089ef, 0xd7bed737, 0xc1d6460e, 0x828582b9, 0x0000864f,
+        0x7e097e7f, 0x57737759, 0x975c97fd, 0x0000f373, 0x6db16d41, 0x206d20bf, 0x087d087d, 0x00002d76, 0x65e76586, 0x67703aff, 0xb9b4b919, 0x00009b6b,
+        0xab97abde, 0x61323a31, 0x1c641cfa, 0x00000dc0, 0xe3e7e38e, 0xe9d34f07, 0xb648b6a8, 0x0000c8b5, 0x6fb66fef, 0xb885e723, 0xda13dac5, 0x000098d1,
+        0xbc45bc10, 0xac239957, 0x80eb80c6, 0x0000bf79, 0x3ba13b38, 0x59488468, 0x18971892, 0x00007281, 0x8a318a42, 0x572dc657, 0xd88cd8e1, 0x0000cc07,
+        0x953c9587, 0xd34d854a, 0xcf63cfbb, 0x00003bed, 0xec79ec6b, 0x158af59a, 0x3e0b3eaa, 0x0000b142, 0x15991570, 0xa5be63da, 0x910d9124, 0x0000afa7,
+        0x567456d4, 0x96b6c650, 0x606760f1, 0x0000f19c, 0x5e0f5e3d, 0x1c41186c, 0x80b28040, 0x00001e4c, 0x240b2439, 0x4b091e2c, 0xf95ff90f, 0x00004526,
+        0x21a8210f, 0xda6bd739, 0x7ddc7d4c, 0x0000908a, 0x171617b9, 0xb4dcebbd, 0x5f3d5fba, 0x0000098d, 0x176f174b, 0x905ebc48, 0x931d9351, 0x000049f3,
+        0x99a6992b, 0xe95849db, 0xe731e78f, 0x00005bb5, 0x8d6c8d9a, 0x8837b127, 0xe038e08b, 0x00002f86, 0xc716c790, 0xc32451ed, 0xeaa6ea43, 0x00001c92,
+        0xd091d086, 0xa0411a0d, 0xe872e8d4, 0x00001702, 0xb489b4f0, 0xb4a3d588, 0x462746aa, 0x0000e7c3, 0xe540e573, 0x0d848828, 0x7342738d, 0x000072f4,
+        0x6fb76fe7, 0x7e96e150, 0x0b6a0b23, 0x00005567, 0xb8edb8b5, 0x4ec9a36c, 0x0e590e52, 0x0000ceab, 0xf194f150, 0x0665d6ca, 0xe52fe5b0, 0x0000e769,
+        0x80ae808e, 0xfea93640, 0x9ba49bf1, 0x000020b6, 0x1c6f1c31, 0xc2bceb4e, 0x4af64a2b, 0x0000eeb5, 0xc04ec01e, 0x88257888, 0x58085817, 0x00002948,
+        0xe6c6e6dc, 0xf1df76f2, 0xbb80bb50, 0x000015c2, 0x454e4593, 0x46f4a943, 0x1fb21f7f, 0x000077b1, 0x744974f4, 0x0804252a, 0x891d8936, 0x0000feec,
+        0xf4a4f47a, 0x6d108f00, 0xd32fd36d, 0x000000e3, 0x56e556ff, 0x4e577567, 0x252e2577, 0x0000dceb, 0x1fa91f89, 0x5c9878ff, 0x913a9149, 0x00004ca9,
+        0x6a0b6ab3, 0xb61bacbd, 0x588858ba, 0x000057f9, 0x00d10075, 0xf17c4be3, 0x706b70ba, 0x0000fafa, 0x6ab36a45, 0xed6f4968, 0x963a962b, 0x0000ce38,
+        0x24342401, 0x1dd66c74, 0xd369d36a, 0x0000fcdd, 0x6b0c6b14, 0xa9724a93, 0x7d2f7dd2, 0x0000f3b2, 0x171c173f, 0xa1a0d9a4, 0x8bba8b26, 0x0000b236,
+        0x2be82b6e, 0x8628f923, 0x0d630d4a, 0x0000362d, 0x80ed8078, 0x1ade4991, 0xd3aed314, 0x0000f562, 0x51aa510f, 0x2c302f59, 0x27322718, 0x00001e68,
+        0x7b837b02, 0x6f58b4a7, 0x26a026fa, 0x0000e389, 0x28bd28e9, 0x7196cd53, 0xb094b014, 0x0000976c, 0x38ee3827, 0x81f7cf01, 0x19a819aa, 0x00009b91,
+        0xe02ae033, 0xa21152fc, 0x1b5c1b3d, 0x0000b697, 0x711b718b, 0x4eb59b54, 0xfaf0fab7, 0x00000a72, 0x3d663d67, 0x6322d54b, 0xa15aa1fe, 0x00000362,
+        0x37d1373a, 0x0c3a4988, 0x44e844fe, 0x0000c773, 0x9ae59a00, 0x7269a83f, 0x803780d5, 0x0000ad4a, 0x11fc11da, 0x4707e83e, 0xc806c8de, 0x0000524b,
+        0xdf68df11, 0x1d43bf08, 0xcabbca91, 0x00006436, 0xdf90dfea, 0x5618942a, 0x6b856b34, 0x0000336c, 0xd7fbd761, 0x62f04763, 0x86c8860e, 0x0000cc38,
+        0x2f552f16, 0x2dc0b687, 0x8c828c31, 0x0000b8cc, 0x6f876ff8, 0xc3c215ab, 0xcf36cf5c, 0x0000966a, 0x825182c3, 0x95d95d91, 0x3b8a3b2f, 0x000020e5,
+        0x9c0c9ceb, 0xe8b22fc4, 0x148014fa, 0x0000c12d, 0x07440715, 0x67dfded3, 0x8c698c3e, 0x00009791, 0xcdd6cd10, 0xc3d5caf1, 0x79157907, 0x00006478,
+        0x63136381, 0x9a06e52d, 0x295a29ba, 0x00008190, 0x5f115f22, 0x38d398b4, 0x1d681d2f, 0x000078a3, 0x9ff59fb2, 0x15e49aca, 0x62f76230, 0x0000c7e5,
+        0x361c36d7, 0x8b17ae54, 0x0f380f28, 0x000081af, 0xe0d4e0cd, 0x6c6057ae, 0xb843b8ad, 0x0000d175, 0xf127f1ed, 0xf0177651, 0x518751a5, 0x0000a966,
+        0x788f78d2, 0x86d56afa, 0x24132421, 0x00004763, 0x16f7168e, 0xe518f8ec, 0x60d96029, 0x000015d3, 0x13fa139e, 0x199df3ac, 0xe246e208, 0x0000c412,
+        0x1107112b, 0x683ad624, 0x35033532, 0x0000392d, 0xfd91fdc4, 0x8e17cb5e, 0xb722b7be, 0x0000e337, 0x22ef2279, 0xdf618636, 0xdbb0dba9, 0x0000f652,
+        0xef08ef56, 0x10f2ae60, 0x1d9a1d88, 0x00001088, 0xe405e444, 0xc1f4e7e1, 0x36b436a5, 0x0000aba7, 0xda03daa1, 0x74abc918, 0xd07bd09b, 0x00008952,
+        0x15cc154a, 0x72da4ead, 0x685c68fa, 0x00002e19, 0xcedacefd, 0xccf599d7, 0x345b348e, 0x0000a401, 0x79fa79cb, 0x41240c3d, 0x79fc790f, 0x000027df,
+        0x66bf6641, 0x9c575145, 0x8a518ac7, 0x0000a2d4, 0x4e2a4eea, 0x159be932, 0x41634193, 0x000049a9, 0x0b320be0, 0xe2433cf2, 0x42fa42f1, 0x0000139a,
+        0x7aed7a7d, 0x1d73d0c4, 0x5774577e, 0x00005058, 0x351f3589, 0xeb93315c, 0x17e617e7, 0x0000b531, 0xe7dbe750, 0x8906f9c4, 0x70af7025, 0x0000321f,
+        0x3ef03ebf, 0xbf95af05, 0xa219a288, 0x00003741, 0xc452c4f9, 0x89bcdb26, 0x9c9b9c92, 0x00006435, 0x0edd0e27, 0x9d07c300, 0x7d517da8, 0x00008402,
+        0x9ed39e95, 0x5b17ec2a, 0x39b03992, 0x0000ca7e, 0xf264f23e, 0x4a367651, 0x1b001b8f, 0x00003eb3, 0xca73ca65, 0x8827d1f6, 0xe970e979, 0x00002f66,
+        0xb1c4b156, 0x70946061, 0x3ccc3c35, 0x00008860, 0x810e817e, 0xda70c88f, 0x1467145e, 0x0000f2ec, 0xbf7dbfd4, 0x39d8b3c4, 0xfea9fe53, 0x00007304,
+        0xe827e87a, 0x86550b14, 0x5bc85b93, 0x00005209, 0xf304f3fd, 0x393c9833, 0xe5a3e53d, 0x00006b96, 0x9ac69a68, 0x2c42403b, 0x4f024fb5, 0x0000d266,
+        0xeaf8ea58, 0xa8f19781, 0xdd08dd3c, 0x0000f8ec, 0x611561fa, 0x34109d35, 0xafbfaf37, 0x00002637, 0x547354cc, 0xacccdbe5, 0xc8e0c87d, 0x000014b5,
+        0xc4e8c4e9, 0xae1ad2b7, 0xfd2ffd64, 0x000011c3, 0xfde4fdc7, 0x14557988, 0x1ca51ce9, 0x0000478f, 0x1c371cdb, 0x4ca75c2c, 0xe04be0e5, 0x000034aa,
+        0x8a1c8a4e, 0x584daf1c, 0x5aa45a17, 0x000008c0, 0xa9e7a977, 0xfdfc68f9, 0xf61cf672, 0x00000989, 0xcdf7cd5d, 0x4c3675d9, 0x601b608d, 0x00001788,
+        0x196a1943, 0x6480a800, 0xd4add49a, 0x00000aed, 0xc3cec384, 0xb88f38ff, 0xdfa4df11, 0x00004290, 0xd3ebd338, 0x250fafbd, 0xd8f9d8e4, 0x0000c4ab,
+        0xb1e4b126, 0x593386d0, 0x0e680e4b, 0x00007dbd, 0xf1cef151, 0x45364a62, 0xbc86bca2, 0x0000ae07, 0x78747894, 0xf1ca349b, 0x6dbd6d93, 0x0000ccc5,
+        0x0f7c0f31, 0x6112c0f3, 0xb841b8b6, 0x00005739, 0xca55cad5, 0x8411dbe6, 0xb51fb572, 0x00004c05, 0xc8cdc86e, 0x3f72aacd, 0x8e218e99, 0x0000a42e,
+        0x0a6d0ad2, 0xa7fc7ec0, 0xa401a4ca, 0x0000ec03, 0x99b79900, 0xcd7a34ef, 0x757d7570, 0x00006b96, 0xc914c98e, 0x36ceaf66, 0xc632c6ff, 0x0000d886,
+        0x4e4d4e97, 0xeef2e390, 0xedd0ed6a, 0x0000037f, 0xf5caf59e, 0x329860d3, 0x76c476e7, 0x00006c59, 0x345d3496, 0xdbab62b9, 0x9040904a, 0x000026ea,
+        0x5546558a, 0x7e2bbb38, 0x53d15377, 0x00002ec2, 0xd046d0f5, 0xa543e1d4, 0x1b5d1b1f, 0x0000a385, 0xff40ff77, 0x21f23cff, 0x047e042e, 0x00000192,
+        0x864186f4, 0xc87a43ca, 0xe204e2be, 0x00001e85, 0x89c6893f, 0x263d7b3c, 0xd602d60a, 0x0000d144, 0x37a8378d, 0xbdea44db, 0xe672e683, 0x000047ef,
+        0x9160910b, 0xe4c31367, 0x01fe01bc, 0x0000e5e2, 0x60176011, 0x582926ad, 0x8822881d, 0x00002536, 0x785478dc, 0xecd3f5e0, 0x520252ae, 0x00008660,
+        0x43044370, 0xfc2f0f00, 0x12f91242, 0x0000edd4, 0xaa77aa67, 0xfcce1836, 0xce1dcef9, 0x0000c6e7, 0x94649487, 0xb9f57ec2, 0x057e0591, 0x00007351,
+        0xb2a4b281, 0x66111d12, 0x821d8264, 0x0000bb31, 0x922392a9, 0xc6779012, 0x900690cc, 0x0000c9a1, 0xadd3adc6, 0xc1a26c89, 0x66596659, 0x00004ef6,
+        0xb45fb436, 0x0cd1e422, 0xc008c01d, 0x00007f70, 0x272227d4, 0x68fd20e0, 0xf6f7f6a4, 0x0000bfad, 0x94a9944a, 0x2f729b31, 0x4ff04f01, 0x000079d1,
+        0x981998e3, 0xba35960f, 0xde35deb2, 0x00008c72, 0x8fe88f19, 0x2ec1554c, 0xcd0bcd75, 0x000076ae, 0x7bdb7be7, 0xa20dc37f, 0xa57aa581, 0x00009ad1,
+        0x74e87452, 0x61e784c1, 0xd47fd49b, 0x0000fb7e, 0x185c1840, 0x049bc59c, 0x786478e4, 0x00000971, 0x2a3e2a3b, 0xead3891c, 0x12f01244, 0x00000503,
+        0xabdeab28, 0xcbecb1dd, 0xe605e66d, 0x0000a207, 0xda10da9e, 0xec00c0f7, 0xe904e925, 0x00003e12, 0x552155d7, 0xd84c3ecd, 0x56df5618, 0x000056c0,
+        0x67916722, 0xf751d986, 0x44464441, 0x0000968a, 0x743f744d, 0x2da294be, 0xcffacfb5, 0x0000072b, 0x65076526, 0x52d866da, 0x9f139f92, 0x0000b5b1,
+        0xec7cec22, 0xb5b4b690, 0xd58bd5cd, 0x00007170, 0x5a015a58, 0x13f07751, 0xb749b741, 0x000083a2, 0x1d3b1dac, 0x97d4ed4c, 0x00200085, 0x0000cb69,
+        0xa213a234, 0x99773811, 0xfe68fe8e, 0x0000bd2e, 0xf3b3f378, 0x0744578d, 0xff85ffb5, 0x0000d6eb, 0x4afe4a0c, 0x99f3ca6e, 0xdc4cdc32, 0x0000404f,
+        0xe1d2e1f8, 0xda1e1bd1, 0xad7bad3d, 0x00009507, 0xb7c4b703, 0xc0f87f47, 0x35a5359b, 0x0000edd7, 0x81bc8184, 0x6750dc97, 0xa96ca9d8, 0x00000add,
+        0xd879d861, 0x6cdfbe07, 0x3830382f, 0x0000b709, 0x5f185f7a, 0xf63d2c99, 0x14ed1491, 0x00005a45, 0x87b48735, 0x9ae64bc9, 0xb3c8b368, 0x00003f39,
+        0x9ae59af3, 0x487b454f, 0x96e196bc, 0x00004004, 0xc31fc359, 0x9d3b51cd, 0xb44ab4c3, 0x0000086f, 0xc210c235, 0xa1238b2e, 0x392c39e7, 0x00001f14,
+        0xf2dcf2f5, 0x82e841b9, 0xc380c34e, 0x00004020, 0x4bf24b9c, 0x7e5607f7, 0x692b697a, 0x0000873a, 0x0d650dbe, 0x2182fb73, 0x64b664c2, 0x00002575,
+        0x96e9965b, 0x49051478, 0xdc12dc30, 0x0000670e, 0x303a30f7, 0xfc4656b1, 0xb072b096, 0x000098af, 0xf81af822, 0xda6192a7, 0x6f4e6f67, 0x00002f5a,
+        0x8a998a1e, 0x240fef3d, 0x7c957cef, 0x0000455c, 0x3da93d74, 0x97ab26d7, 0x36ba369d, 0x0000ff49, 0xdc50dc5e, 0x6deabf01, 0x38813884, 0x00002775,
+        0xf6eaf6d4, 0xa8a49c6a, 0xcdb8cd6d, 0x00003638, 0x40e94059, 0x919e9928, 0x29bd2905, 0x0000703e, 0x405b4045, 0x40661fd5, 0x94119438, 0x0000f02e,
+        0xf6aaf6ad, 0xc6251aaa, 0x81ef81df, 0x000010bf, 0x764976f2, 0x7859e659, 0x6e4e6e60, 0x0000f643, 0xd83cd855, 0xa123c737, 0x504150ba, 0x000076aa,
+        0x260e2660, 0x34601788, 0xd964d901, 0x00003f73, 0x67d9679c, 0x34e42354, 0x81538160, 0x0000974b, 0xeb36eb2b, 0xd51e9d9e, 0x054605e4, 0x000006cf,
+        0x690969ef, 0xc7eac0b2, 0x17ca17f5, 0x0000e5ad, 0xf265f257, 0x57f013e7, 0x38b5381f, 0x0000ce38, 0x3f853f63, 0x7475b4a6, 0x6eb36e35, 0x00007672,
+        0x29e329b4, 0x0125dfd4, 0xecedec5b, 0x000012d3, 0x3b2e3b45, 0x1a93c567, 0x664b66f8, 0x0000aad9, 0x6d1b6d8e, 0x4b7d95be, 0x7b1b7ba1, 0x00003506,
+        0x323032f6, 0x8fe5a1e7, 0x2d602dd2, 0x0000d13f, 0x63f363a1, 0xfe11e94e, 0x01ff01ae, 0x00001f44, 0x28c32894, 0xcfa2c743, 0x0b050bc8, 0x00005109,
+        0x7f887fc7, 0x865519d7, 0xeedceeab, 0x0000256b, 0x7c877c2d, 0xc8644f06, 0x524752e0, 0x0000be11, 0xf0d7f0f3, 0xc6ca4b96, 0x33b73395, 0x00000292,
+        0xac91ac67, 0x3f0a6fc9, 0xa70ba7b6, 0x00002d27, 0xe13ee1b9, 0x8cdbe421, 0xcd62cd28, 0x000067af, 0xfe74fe96, 0x551854cd, 0xe56ce5ba, 0x0000ad4b,
+        0x085a08e4, 0x1f2a6cb5, 0xfefffeac, 0x0000337f, 0x7d167d13, 0xa8794daf, 0x5c6f5c28, 0x0000385b, 0x16b21655, 0x7112e599, 0x73a4731f, 0x0000f582,
+        0x4dab4d15, 0xe66927b0, 0x02340211, 0x0000fc35, 0xc30ec38f, 0x4c4a1eda, 0x2d642d8c, 0x00009615, 0xd1a0d1d7, 0xd1056b34, 0x7ccb7caf, 0x0000c6b2,
+        0xb2d8b245, 0x89eed2d2, 0xfafcfaab, 0x00004acc, 0x22db22f3, 0x0bcb13e3, 0x4340438a, 0x000029ba, 0xee78ee44, 0x89641188, 0xa08fa03a, 0x000013d3,
+        0x897c899a, 0xe77ff7ee, 0xfc20fcb9, 0x0000d0a5, 0x9eb19e9c, 0x41c524d2, 0x8f218fcc, 0x000098f6, 0xcb3fcb6f, 0x84875ddd, 0x01200187, 0x00003e6c,
+        0x63e5638a, 0xb51deacc, 0x768676e1, 0x0000bf79, 0x4d0a4d19, 0xc28690bd, 0x447c4435, 0x00002556, 0x978f97c6, 0x79a23892, 0xf44cf415, 0x00002975,
+        0xc4efc4b1, 0xbe4b2199, 0xb262b2f1, 0x00009614, 0xe041e052, 0x8e07f1d7, 0x6d5a6d87, 0x0000512c, 0x41c2417c, 0xac5b4a60, 0x858f8542, 0x0000fc9e,
+        0x4a324adb, 0xe821958e, 0x606a604f, 0x0000a31e, 0x91dd91b4, 0xca64103d, 0x3fa83f79, 0x00004618, 0x8097807d, 0x917360da, 0x007400db, 0x0000905d,
+        0x366136f2, 0x391fa945, 0xeaa1ea0e, 0x0000b0f2, 0x05df05c1, 0xbca95cfc, 0xe946e905, 0x00009fe0, 0x9f979f63, 0xf0ebd674, 0x2503259d, 0x0000ca11,
+        0x777a7742, 0x89f7a5db, 0x4a4c4ac5, 0x000057f8, 0x230f23ac, 0x2a607351, 0xf7e9f76c, 0x0000f056, 0x21a2210a, 0xd02a30df, 0xf153f19b, 0x00007fbf,
+        0x11cb118a, 0x26f348e6, 0xcf7acf71, 0x0000c05e, 0x34a4349c, 0x69a70907, 0x824d8255, 0x00001a4c, 0x7e837ee6, 0x7dc06224, 0x759475ec, 0x0000b13b,
+        0xa740a78b, 0x061cc244, 0x6ea66e65, 0x000077b1, 0x327232d1, 0xf9969e63, 0x79767970, 0x00002d75, 0xd26cd229, 0xd92d2795, 0x17871733, 0x0000b813,
+        0x5bbf5b34, 0x9fa6e4a2, 0x348a34a6, 0x0000ebd7, 0x573257bb, 0x4ce06296, 0x2cc02cc7, 0x00003281, 0x177617f9, 0xb1d6a120, 0x435343af, 0x0000f31d,
+        0x22eb227b, 0x5da709d9, 0x7b0e7b56, 0x00008190, 0xc906c969, 0x75b27351, 0xb9b0b947, 0x000001fd, 0x5373539c, 0x37ab6c7a, 0xf40df4fd, 0x0000c802,
+        0x62bf624e, 0xdc8acca8, 0x205d2020, 0x0000bef1, 0x49674993, 0xe566e932, 0xb166b10d, 0x00005e50, 0x9209920a, 0x570a1166, 0x580d58c1, 0x0000394c,
+        0xe97be916, 0xe77f03a3, 0x6fe56f5d, 0x0000f483, 0x925c9273, 0xefd3af3e, 0x1b8b1ba6, 0x0000af38, 0x59fa5968, 0xe1c99e27, 0x400d4053, 0x0000eeb5,
+        0xe477e463, 0xa73dd2d2, 0x484f48d7, 0x0000f433, 0xce15ce13, 0x2963b747, 0x4f734fc1, 0x00008b2f, 0x8a3f8aaa, 0x1cc6281e, 0xbaecba5b, 0x0000ccd5,
+        0x9852982b, 0xc4b563d9, 0xc16fc13f, 0x000004cf, 0x8439846c, 0x2af3bee4, 0x0d350df3, 0x000012ac, 0xd84ad891, 0x07d6464f, 0xb776b75a, 0x000006d6,
+        0x43334357, 0x8f64414e, 0x631263a6, 0x0000c186, 0x26df261b, 0x76c057a5, 0xb215b2ba, 0x00008fee, 0x95ff9568, 0x712a471d, 0x62da62a3, 0x0000b38d,
+        0x7d467d5a, 0xda8b1853, 0xff6effaa, 0x00005ae8, 0xf970f9da, 0xfb9b4030, 0xab00ab87, 0x0000fe33, 0x44d9441b, 0xae725b22, 0x3b3b3b0f, 0x0000d1fd,
+        0x82ba8279, 0x6c7cba7f, 0xf54af511, 0x0000a26f, 0xcb9ccbb6, 0x7a097909, 0xc0a7c001, 0x000080a2, 0x999e99bd, 0x4d5dfcbd, 0x6e346efc, 0x0000236c,
+        0x68db689c, 0xe5e3b8b4, 0xda59dafd, 0x0000742e, 0x246524d4, 0x3b48f9da, 0x8d8e8d35, 0x00000209, 0xc351c3b3, 0xcd45a754, 0xb81fb85f, 0x0000dd67,
+        0x9e3e9eca, 0xa083c5ba, 0x844a84dd, 0x0000c310, 0x8943899f, 0x80a6fbf9, 0x8a708a68, 0x00001863, 0xdfc2df5c, 0xe4673efc, 0x80ae80e1, 0x0000e7e2,
+        0x3e7c3ed3, 0x9269454d, 0xc775c788, 0x0000f30c, 0x11d811b2, 0xdcc46559, 0x8dad8dab, 0x0000ddb9, 0xfb90fb6e, 0xf2cb38f2, 0xb35ab3f8, 0x0000d624,
+        0xee7cee47, 0x25593123, 0x5c2e5c66, 0x0000e73d, 0x659e6579, 0xbb4b16c1, 0xb740b7ae, 0x0000dcbb, 0x6845682b, 0x58d62f5a, 0x025b0239, 0x0000014d,
+        0xb276b280, 0x4629bab3, 0xe041e0b6, 0x00001892, 0x07760749, 0x3d773912, 0x06480614, 0x00005237, 0x42234224, 0x6950d5cb, 0x5a795a38, 0x00008742,
+        0xd187d13f, 0x53076808, 0x7a017a7c, 0x0000d30f, 0xf435f4ec, 0x87f710bc, 0x366e3628, 0x00006c98, 0xbbcabbb6, 0x7e23dbe5, 0x1d3b1d4b, 0x0000c110,
+        0xd7ffd747, 0x26a2e37d, 0x15a01599, 0x00002a86, 0xbce6bc2a, 0x26599117, 0xb1adb1eb, 0x00001dac, 0x16381634, 0x7962b617, 0xfaf9faa3, 0x0000b77c,
+        0x0d0a0d15, 0x0dcb2926, 0x542854e7, 0x0000a3ae, 0x33e033f0, 0x05449161, 0x179e17cf, 0x00002f1c, 0x08a108de, 0x1595597c, 0xc942c907, 0x00009104,
+        0xdc0adcfb, 0xf39bd5f0, 0xaf9eaf34, 0x0000847c, 0x63cf6304, 0x0a2b3a32, 0x8c5f8cc6, 0x0000b251, 0xb982b95b, 0xaf32f87c, 0x158d1578, 0x0000735e,
+        0x26f42673, 0x4ca20161, 0xee4ceea0, 0x00000c63, 0x583d589f, 0xcff7128b, 0x45f345da, 0x0000aa25, 0x15511506, 0x2ff02d0c, 0x39c239d6, 0x0000dca5,
+        0xa5daa5f6, 0xe5a2de6c, 0x73ba7386, 0x000061d0, 0xb380b3dc, 0x0a36e9b3, 0xe6a4e6bf, 0x00009714, 0x9f9f9f23, 0x6b8f3d8c, 0x50535090, 0x0000d49b,
+        0x225c2202, 0x2fd668a2, 0xd69bd633, 0x0000751b, 0x599859af, 0xc01759a0, 0x13491314, 0x0000b5cc, 0xbef3be82, 0xa4cbbb40, 0x2a132a39, 0x0000f7c1,
+        0x8a4d8ad8, 0xb894ff40, 0xeefdeeb9, 0x0000c54c, 0xe24fe25a, 0x1639bdc9, 0x32ed323e, 0x00009214, 0x01c401d3, 0x61b2c000, 0xb75bb7fa, 0x00004466,
+        0x1ccb1c87, 0x7ab577e2, 0x32aa32ef, 0x0000709a, 0x9d299db7, 0xac5a7cc0, 0x665f6612, 0x000072fe, 0x9f959f64, 0x605aa28c, 0x624a624e, 0x00002aea,
+        0x4c284c15, 0x087de69a, 0x8a218a1c, 0x0000d913, 0x9eda9efc, 0xc3d03891, 0xc108c13b, 0x00001f51, 0xc2d5c2dd, 0x1cbb89e0, 0x3bf83b4d, 0x00000dec,
+        0x2b982be8, 0x007b578e, 0xc9bdc9bf, 0x00004d77, 0x84e384c4, 0x4116404d, 0xf4a1f416, 0x000000b2, 0xe739e772, 0x38505f99, 0xd07dd09b, 0x00002205,
+        0xb38db35e, 0x8f1adce8, 0x0def0df5, 0x0000a5a6, 0x177c17d1, 0xaa7b46db, 0xa80ea89e, 0x0000f662, 0x570b571d, 0x16c81226, 0x79da798d, 0x0000ce07,
+        0xd669d65c, 0xb3e3a70d, 0x126a1220, 0x000070b8, 0x070d0747, 0x9cbef91c, 0x412941c5, 0x0000e3a4, 0x03e60385, 0x8778856f, 0xeb4ceb01, 0x0000e95f,
+        0x9c5f9c21, 0x7b1a3adf, 0xd14dd1f2, 0x0000c593, 0x8a5c8ab9, 0xc2f50706, 0x1931198e, 0x0000fd62, 0xbc2dbc6e, 0x36d94ae6, 0x1d9b1d4a, 0x000013ca,
+        0x107c100a, 0xb86204e8, 0x79f679ec, 0x0000f793, 0x69426961, 0xcab96b7d, 0xa0d4a068, 0x000058b0, 0x46c14684, 0xe723632a, 0x5bfa5b22, 0x00005ccf,
+        0xdb33dbfe, 0xd336efbd, 0x6ec16e26, 0x00005f65, 0x1c3a1c2f, 0xe84fe604, 0x115d111b, 0x0000be9e, 0x14eb14ed, 0x4805ef69, 0x0f2d0f81, 0x000095e9,
+        0x946a94cd, 0xdcf3201c, 0x6dd76d72, 0x000038e6, 0x83c283fe, 0xd18b655a, 0xdbf0dba3, 0x0000e8f6, 0xeff4ef42, 0xe56224e8, 0x5b035bb4, 0x0000b9fe,
+        0x946494bf, 0xd8db6ebb, 0x2b222bec, 0x00004bc6, 0x59fe59a4, 0x4a0840bc, 0xfca6fca4, 0x0000614f, 0xc7d1c771, 0xd0c4cf57, 0x27622768, 0x00005abb,
+        0x12c6120b, 0x9f895c2c, 0xf02bf06e, 0x00009b18, 0x09480967, 0x3e639ea3, 0xdc4cdc10, 0x000016f3, 0x8e3f8e91, 0xa0087bc1, 0xae96ae8f, 0x000005fc,
+        0x2bbc2bdf, 0x7296f79e, 0xf40ff461, 0x00000ed9, 0x65b86562, 0x83e120c9, 0x23d92323, 0x0000bf6f, 0x08c608d7, 0x7b8fddeb, 0x13bf13cb, 0x0000a8c9,
+        0xe607e658, 0x8d67fd3b, 0x966c96a7, 0x0000053f, 0x70c1704e, 0xefc1a337, 0xa455a41f, 0x000060af, 0xaf88afa4, 0xb2d11eda, 0x45b84542, 0x00003e91,
+        0x7b267bfc, 0x17dba0f3, 0x4dda4d25, 0x00001017, 0xcaf7ca98, 0x4f5fa4cd, 0x5d405d54, 0x0000d50b, 0xa5dca560, 0xa5f642f8, 0xaa63aa87, 0x0000d51d,
+        0x3c573c5e, 0x84f712fd, 0x4356432e, 0x0000fac5, 0x53b25399, 0xb1ad71a9, 0x5f945fa8, 0x0000a4dd, 0xbed0be9d, 0x7fcd9c6a, 0x5002507f, 0x0000c5b8,
+        0x50a0500c, 0xeae1c036, 0xd46fd461, 0x0000f662, 0x23ae230b, 0x291fa020, 0xe53ce574, 0x00009f7b, 0x7d477d6c, 0x726de45d, 0x39a139e2, 0x0000491f,
+        0x36903665, 0xc015aa0b, 0xf293f2f1, 0x00007b43, 0xa98ea928, 0x60335778, 0xea5bea1c, 0x0000890e, 0x36e336d0, 0x93ef54cd, 0x15601501, 0x00003455,
+        0x03e70304, 0xd23bfb63, 0xea2aeaa9, 0x00001368, 0x359035fa, 0x2030d904, 0x73bc7300, 0x0000970e, 0xbb18bbfc, 0x3ac33ab0, 0x14fa144b, 0x0000a3f6,
+        0xefb6ef05, 0xe2933991, 0xb119b151, 0x00006df4, 0x2cdd2c5d, 0xc45796be, 0x7acd7a85, 0x0000dbad, 0xcfe0cf1c, 0x19c8b4d5, 0x4b354bd2, 0x0000b910,
+        0xa177a1f8, 0x6fa0f8c5, 0x74967460, 0x00006830, 0x6b8b6bd2, 0xcc8f1edb, 0x001000a6, 0x0000f370, 0xf969f99b, 0xb36c3320, 0xa20da262, 0x0000352f,
+        0x86d986db, 0x00191655, 0xcd06cd60, 0x00008980, 0x0477046b, 0x5666eb00, 0x257c25a0, 0x0000c490, 0x26af26fa, 0xaa3fb937, 0xcab6ca76, 0x0000a044,
+        0x9c239c38, 0x31e69f5c, 0x6883680f, 0x000089ff, 0xe36ce30e, 0x9d2caf41, 0xc096c01e, 0x00002c67, 0x126112eb, 0x15f9276b, 0x5f985f4a, 0x000010fc,
+        0x41a841c9, 0x5e82a052, 0xae49aea6, 0x0000dab7, 0xa9b4a953, 0xfd865089, 0x0c730cd0, 0x00005cb0, 0xcd02cd30, 0xa80d04c8, 0x06ad060a, 0x00005f1f,
+        0xb32fb32e, 0x2ea37499, 0xa415a4f5, 0x00000362, 0x7a937a24, 0x004a9ddf, 0xb0f8b0ad, 0x0000650f, 0xc920c9ab, 0xfee72fd9, 0x7c9d7c2d, 0x00005934,
+        0x98e698ae, 0xc4b61322, 0x8af58a18, 0x0000d048, 0xe1bae1d2, 0x8d78009f, 0x9f0a9fac, 0x000039ed, 0x0aca0ab0, 0x33b7f1ac, 0xb917b924, 0x00004e08,
+        0xb2d2b231, 0xdec4fa30, 0x153415f0, 0x00009922, 0x7b9c7b66, 0x5b860a27, 0x906f90af, 0x000077bf, 0xb432b49a, 0x1dd75f87, 0x47384719, 0x00006a8b,
+        0x835b8300, 0xfa76a8c2, 0xc36fc315, 0x0000ab64, 0xd8a7d8c2, 0xdb542e45, 0xb282b2b9, 0x00003e59, 0x6936698f, 0xdcefa7d4, 0x34d73489, 0x00002fcb,
+        0xeceeec2e, 0x90c82f29, 0xf06ef03a, 0x000098d1, 0xb620b62f, 0x75b2cfd3, 0x973297e3, 0x0000e4a9, 0x14aa1435, 0x8a256fc9, 0x47c447c8, 0x000095a7,
+        0x823282f4, 0x2bd25f92, 0xc5bbc58a, 0x000048a3, 0x0aed0aac, 0x19909bea, 0x9545953c, 0x0000f93e, 0xae95aef3, 0x492952fc, 0x919f91cb, 0x000004df,
+        0x0c460c2a, 0x70a8f8f9, 0x1e111eca, 0x00006090, 0xa37ca332, 0x9db853f2, 0x66ce66c7, 0x00002865, 0x7a037a29, 0x47661955, 0x2ab42a62, 0x0000b27d,
+        0x65e765db, 0xad9f6351, 0x8f7e8f3d, 0x00004bde, 0x068206f3, 0x439952ed, 0xa8b3a855, 0x000093d4, 0xd103d132, 0xf00b37bf, 0x644c6448, 0x00008cda,
+        0x330233b7, 0xbcd1ec4c, 0x2b052b61, 0x00001d28, 0x41a64179, 0x754decd4, 0x4ae94a2e, 0x0000bbae, 0x9a1d9aaf, 0x3776f2eb, 0x79fb79e7, 0x00001117,
+        0x9b249b38, 0xb1a3d9db, 0x2a682a85, 0x00008aee, 0x42ee4254, 0x8aa48bbe, 0x4ca24c1e, 0x0000aee9, 0x2208223a, 0x5c17aded, 0x215b210f, 0x0000f3b2,
+        0x79127914, 0x6550c498, 0x2a142a3b, 0x00002fba, 0x4e554e46, 0x0a5e2d45, 0x6a5c6a90, 0x0000dbee, 0x2dd42d79, 0x7d442a2a, 0x4b8d4b29, 0x0000d58f,
+        0xe9b3e951, 0x57896f6b, 0x8d888d59, 0x00009f75, 0x233d2396, 0x4ec940e6, 0xcf02cf0f, 0x0000ec03, 0x380338ee, 0x9953de2b, 0x63f263f1, 0x0000b301,
+        0x5292528f, 0xa78e6439, 0x1396135b, 0x00000cb5, 0xd0bdd0a6, 0x366c6525, 0xf3f6f3ec, 0x00002497, 0xde15de44, 0x86c70d26, 0x313031ae, 0x00005ad8,
+        0xc2a0c2d2, 0xc9f8834d, 0x7383738f, 0x00008e60, 0x350c3571, 0x1304f0a8, 0x48914833, 0x0000dc1f, 0x5b275b5d, 0xbecc8ce2, 0x4a304ac1, 0x00000f1b,
+        0x8728879f, 0xd0f87b40, 0xff4dffb5, 0x00007131, 0x81698104, 0xa5beeccc, 0x9d4c9dda, 0x0000575b, 0x721d7263, 0x9d5285f3, 0xaf86afbd, 0x000062d5,
+        0x571b571d, 0x5090e65f, 0xf9b3f958, 0x0000ad8b, 0x30e5303e, 0xf4ae83ce, 0xb16fb1da, 0x0000606a, 0xdf40df2e, 0xc55d84cf, 0x274e27e2, 0x00006230,
+        0x088608b9, 0xf89bacb8, 0x371e3732, 0x0000c060, 0x164e1673, 0xb8cc25ab, 0x7ad67a16, 0x0000fc1a, 0x1e6d1ea2, 0xe7c136d2, 0x0e9b0e82, 0x00007281,
+        0x8d958d3b, 0x9528e1a0, 0x5d3a5ded, 0x000093b9, 0x82338242, 0x8488a2db, 0x33593310, 0x0000e829, 0xaea9aeb5, 0xb22afec7, 0x9500954a, 0x0000d157,
+        0xc19cc13e, 0x559f0e25, 0xd53bd564, 0x0000ea7f, 0x7e357e66, 0x0916c720, 0x5c9d5ca2, 0x00001c88, 0x68d368cc, 0x0dcb018e, 0x2b7c2b99, 0x000021bc,
+        0x9236922c, 0x2d428583, 0xc2ffc293, 0x0000064c, 0x69d86960, 0xfbcf167d, 0xa61ba685, 0x000044ef, 0xd5cbd50f, 0xfd3de832, 0xc6bbc64c, 0x00006b7f,
+        0xc809c8c5, 0xe09359dd, 0x186d185b, 0x0000b105, 0xb089b059, 0x3d0af9b9, 0x2805282a, 0x00000c19, 0xb0c1b000, 0xd9d46de0, 0xc5afc567, 0x00009301,
+        0xb1bab172, 0xb02813b7, 0xd60ad6d3, 0x0000d991, 0x4b514b25, 0x726d2f26, 0x890a89b6, 0x0000be2e, 0x835083ca, 0x92062d38, 0xd1a2d17c, 0x00006915,
+        0x874587b6, 0xbb464c29, 0x07c507dc, 0x00000ecf, 0xb6d1b676, 0xc15fd475, 0x61e16156, 0x0000fb82, 0x1955195f, 0xa870905a, 0x7dcb7d00, 0x00003606,
+        0x6e666e2e, 0xd8e5a06a, 0xb62cb64a, 0x00008a3f, 0x9cd69cb4, 0xd4fd95be, 0x63bc6343, 0x0000f26a, 0x70c7703b, 0x5b708d26, 0x1b1f1bc4, 0x0000caa1,
+        0xaee8ae62, 0x240f52dc, 0x3a373a86, 0x000046bf, 0x9c109ca6, 0xaa1a59a3, 0xe4f2e4fc, 0x00004b04, 0x28c62831, 0x559d20c9, 0x4008406a, 0x000050d4,
+        0x83968317, 0x0154d284, 0x13d813cc, 0x00004eb0, 0x3e563ec1, 0x1555fcbe, 0x135c1313, 0x000042d1, 0x335133b4, 0xdb5ee1e2, 0x7efd7ef4, 0x00003968,
+        0xd042d071, 0x87101ed3, 0xcf00cf73, 0x0000b697, 0x9fe59f0d, 0x314674ef, 0x6538655d, 0x0000df87, 0x357235d2, 0x50891e53, 0x896f893a, 0x0000c8af,
+        0xa585a5f4, 0x2d530659, 0x0c560ce6, 0x0000d1bb, 0xc621c62c, 0xd3205cd5, 0xd2b5d2d5, 0x00008850, 0x97a2976a, 0x6a00286d, 0x7f2a7f36, 0x0000887b,
+        0xefaeef88, 0x71960e25, 0x5c145c07, 0x00005841, 0x6b336b25, 0x5307c0c0, 0x55fc55f4, 0x00003a64, 0x1c841cdc, 0xff4d9a4b, 0xd9e8d968, 0x00007b0e,
+        0xa1d5a1f6, 0x58b82e08, 0x42a64229, 0x000064c9, 0xc1c8c1a4, 0x15066ca9, 0x7a917a6b, 0x00009618, 0xcb32cbc5, 0x905ce721, 0xdae2da5a, 0x00004ea9,
+        0xff96ff68, 0x5157a6d2, 0xf563f5cb, 0x000079ae, 0xbe8dbe5a, 0x6bc38e5e, 0xc074c017, 0x00003ecc, 0x8c248c88, 0xff366256, 0x561956a1, 0x000026bc,
+        0x50175085, 0x1915ac8a, 0x0d500d17, 0x0000236d, 0xe414e4c5, 0x382be3fd, 0xd1a9d15f, 0x000094b9, 0x9f0a9fa1, 0x6550219b, 0xe494e43f, 0x0000703b,
+        0x02a702de, 0xa5836fcb, 0xa298a200, 0x0000ea81, 0xd8a8d8de, 0x3516712f, 0x6f236ff7, 0x000032a0, 0x3bfb3b59, 0xa4fc616c, 0x291e29b2, 0x0000bbd3,
+        0x317331d1, 0xb44bc043, 0x759175a8, 0x00005b36, 0x089a08e3, 0xa1516977, 0x8aa88a4a, 0x0000f719, 0x691d6936, 0x66df37d6, 0xc20ac234, 0x0000386e,
+        0xf6d1f66b, 0x143d9e9a, 0x2a192a7a, 0x0000555b, 0x06510675, 0xf66ee8b0, 0x061106d7, 0x000016fc, 0x569d56d6, 0xaad02f2d, 0xd71ed708, 0x0000e089,
+        0xbacfba3d, 0x8e476420, 0x96d99624, 0x00006ce0, 0x304530a1, 0x47c8f26e, 0x78af7897, 0x0000c1b9, 0x44e9444b, 0xe8516dba, 0x5291526e, 0x00008f1e,
+        0x4472440b, 0x3edceb72, 0x762976e6, 0x0000ad38, 0xc91ec9db, 0xc98ac8ef, 0x8880883b, 0x00004c40, 0x01b201a3, 0xcf4a61c0, 0x5a275a56, 0x00004e42,
+        0xf95af924, 0xb22ab5d9, 0xba3bbaf3, 0x0000701a, 0xf845f885, 0xdb3ca053, 0x6cd16c9a, 0x00006b77, 0x95d9955c, 0xe331874d, 0xb128b101, 0x0000aba6,
+        0x68e868e3, 0x19ee9013, 0xae78ae3c, 0x000087c6, 0xb214b2d3, 0x3202b494, 0xc553c5cf, 0x00006c8b, 0xe9d8e9d0, 0xfb6426eb, 0x388838f2, 0x0000f93e,
+        0xce50ce8d, 0xd44bf237, 0x3bf03bb3, 0x0000a3be, 0x807c80a6, 0xc182d85b, 0xc6cbc66c, 0x0000f26b, 0xe85ae834, 0x0924120b, 0x412441f9, 0x000056c1,
+        0x90d49055, 0x5a4b6db4, 0x8f1d8f60, 0x00009fb2, 0x8be98b42, 0x09f5f2eb, 0x823c828f, 0x000061af, 0x08e6086c, 0x48beed4c, 0x19bb198a, 0x0000af5a,
+        0xfd99fd74, 0xac5b4d05, 0xb851b859, 0x00002066, 0xbbd8bbd1, 0xc5ca4b88, 0x1f771f29, 0x00006f9a, 0x6a3e6a36, 0x4199fa3a, 0xefbbefcd, 0x00001225,
+        0x220722d5, 0x6190d824, 0x2d962dd4, 0x0000d4ea, 0xf5d8f5ff, 0x61106876, 0x559555d6, 0x0000aec8, 0xd10ad168, 0x85a60300, 0x47b24777, 0x0000ee33,
+        0x890e89d1, 0x964f553c, 0x9b959b1d, 0x0000e3e2, 0xff44ffe4, 0x558dfcbc, 0x45054545, 0x000018f2, 0x94e494f2, 0xf0899345, 0xac09accc, 0x00004d2d,
+        0x6e236ec0, 0xbe13bb57, 0x9d819dab, 0x0000f7cc, 0x6dcb6dbc, 0x02fbfefb, 0x850c8575, 0x0000869c, 0x12d612f2, 0x0e767e42, 0x7e5a7eb9, 0x00006435,
+        0x67ba67b6, 0xb413de36, 0x30a2300b, 0x000049a9, 0x5a5d5abd, 0xbd8b42f1, 0x2a802ab4, 0x0000bd2f, 0xc210c20b, 0x9391e213, 0x69d96974, 0x000070ba,
+        0x47d64772, 0xfb11a8ff, 0x6730675a, 0x0000cc13, 0x480d4876, 0x1e6aa029, 0x336833b6, 0x0000e00d, 0xef0def9a, 0x2cdd9e95, 0x48bd4871, 0x000022ba,
+        0xcd90cd1a, 0x6e405a5c, 0x2c4c2ca9, 0x0000b0a2, 0xcec2ce60, 0x401376db, 0x15481517, 0x00006f67, 0x10db10f5, 0x5362bea0, 0xe73de736, 0x000011ac,
+        0x4d8b4dd1, 0xdddf8331, 0xcc06cc1f, 0x0000d7ca, 0x8c178cda, 0xd7e45fe8, 0x351935ca, 0x00001dac, 0x2b002b12, 0x68bf5033, 0xca7dca88, 0x00003d92,
+        0xaf84af28, 0x95b619d5, 0x5e395eb2, 0x00003ec5, 0x0170018d, 0xb2b4a9c0, 0x53e55330, 0x00006fae, 0x2e112e17, 0xa85b2e63, 0x569156eb, 0x00005e06,
+        0xf261f279, 0xd0847f3c, 0x8dc58d6b, 0x00001fac, 0x606560e0, 0x24b91585, 0x20b1208f, 0x00005adc, 0xb36eb386, 0x30cf6aca, 0x8e828e58, 0x00002a9b,
+        0xaa44aa6b, 0x0744d2c1, 0x9fed9fbc, 0x0000f85c, 0x14081458, 0xea4974e2, 0x04c10466, 0x0000b357, 0xe434e4fa, 0xfae113e3, 0x3c1a3c68, 0x00006ea6,
+        0x37e7371c, 0xe59d5672, 0x2de72dbf, 0x00000362, 0x5323539d, 0x056778fd, 0xeaaaeab8, 0x000069d4, 0x09690997, 0xf29b3e30, 0xd05cd0b7, 0x00000208,
+        0xc735c797, 0x768e4204, 0x012e01d7, 0x0000ef5f, 0x743f744d, 0xfd739a57, 0x77d777d8, 0x0000b151, 0xb6d1b6d3, 0x54cf42ad, 0xdf30df85, 0x0000c1b8,
+        0x2f732f29, 0xae13e50a, 0x15fc1542, 0x0000c112, 0x4fa44f6b, 0x582d9228, 0x53555345, 0x00006130, 0x216a21b1, 0x07c487de, 0x462046a8, 0x00009009,
+        0xa3eda3a7, 0x217d88a2, 0xc0adc097, 0x0000a837, 0xda70daad, 0x9977b4d6, 0x799f795c, 0x0000c227, 0xef7eef96, 0x88b839ed, 0xf7d2f787, 0x0000946b,
+        0x467d4676, 0x32df8451, 0x4bb64bec, 0x00001d29, 0xf07af00d, 0x65c30734, 0x3b363b0c, 0x00000ded, 0x9c899cc7, 0x8947d688, 0xf664f6ae, 0x00008331,
+        0x96f8965f, 0x5c5da0d1, 0xbaefba29, 0x0000086b, 0x450945f3, 0x6d1c4eb6, 0x407d40f2, 0x0000d264, 0xc076c056, 0x42256c62, 0x08610886, 0x00008850,
+        0xeb38eb69, 0xbf6dd06b, 0x986f98bf, 0x00005209, 0x1306138e, 0x9cd908e3, 0x97379792, 0x0000a999, 0x58aa58e2, 0x4bab7949, 0x53c15363, 0x0000ddca,
+        0x703770da, 0xb5ffced3, 0x0bd60b9c, 0x0000874d, 0x6a416a29, 0x25a2a72c, 0xae45aed8, 0x0000bb2f, 0xee91ee3a, 0x5f22e8cd, 0xa57fa5cf, 0x000086bc,
+        0xeb42eb63, 0x8947b1c1, 0xed02ed8b, 0x000097fe, 0x8a788aab, 0x605115cf, 0x411541e5, 0x0000bf24, 0x0acd0a90, 0x01f4c100, 0x74767424, 0x0000487d,
+        0xf152f1ea, 0xa31136ad, 0x70b77091, 0x0000a2ba, 0xf707f778, 0x7dea2412, 0xaf48af2b, 0x00007381, 0x63176379, 0x8325f2d5, 0x86088655, 0x0000be11,
+        0x66086625, 0xb353fb98, 0x7cf57c7c, 0x00009c79, 0x16db16af, 0x8981d276, 0x98b398d9, 0x000062d0, 0xa91aa95f, 0x2f0fa72e, 0xf563f5ae, 0x00007db1,
+        0xbf2ebf92, 0x9cbd93f7, 0xb277b293, 0x00000f1b, 0x94ff947c, 0xd22000ca, 0xfcdefc88, 0x0000231a, 0x61746155, 0x34496b34, 0x0abc0a30, 0x0000cb10,
+        0xb1e6b1ed, 0x971c85c1, 0x6eda6e05, 0x0000f7e7, 0x98bc9831, 0xe5f27250, 0xf032f085, 0x0000dcad, 0xf121f10a, 0xede301cc, 0x0d520d34, 0x0000412f,
+        0x4ed14eb9, 0xa9f2a8c3, 0x8767879e, 0x00001853, 0x055e05e3, 0x95d918d5, 0x33783383, 0x0000ea69, 0xd7e2d7c4, 0x8c7912fe, 0x00b70081, 0x00001129,
+        0xd113d13e, 0x46906c7d, 0x4f324f61, 0x000095b4, 0x82bb8237, 0x2963f457, 0x407f40e5, 0x00008061, 0x4ee74efd, 0xb254fefa, 0x28fb28a3, 0x000035f1,
+        0x3b0f3b38, 0x17d501ca, 0xc7d3c792, 0x0000ba59, 0x300d3054, 0xbe6e51b4, 0x860a8640, 0x00006190, 0xbc71bc13, 0xed0ea53a, 0xd27dd29e, 0x0000e184,
+        0xbc9bbc8a, 0xe63c492d, 0x820b82bc, 0x0000e489, 0x11af1197, 0xc43b489c, 0xa469a4b6, 0x0000850e, 0xf00bf082, 0x3e8df761, 0x4f534f87, 0x0000c44d,
+        0x4e3d4e5d, 0x2af3f873, 0x3935399d, 0x0000d405, 0xfeeefeff, 0x2f40ed4f, 0x275b2705, 0x00007f81, 0x30e33083, 0x0025daa4, 0x30853080, 0x00008a44,
+        0x94fc94d5, 0x25a2e1a3, 0xd178d125, 0x00008eb1, 0x4de74def, 0x255970d0, 0x9bec9b1f, 0x00008bc3, 0xc5b0c520, 0xd404f26a, 0x52a15257, 0x0000d867,
+        0x2dc32dc7, 0xd62fa298, 0xc17dc19e, 0x00006c98, 0xba3cba9d, 0xa81ae3ec, 0x5ec95edc, 0x00000092, 0xbf83bfc7, 0x14eebeb9, 0x599959db, 0x00006c8b,
+        0xa358a375, 0x42c5cbce, 0xcf19cff3, 0x00004430, 0xb537b51f, 0x81cfe94d, 0x7b857b7a, 0x0000486f, 0x6ecc6e3e, 0xa1611ada, 0x4da34d6f, 0x0000028d,
+        0xce9ecec8, 0xff446285, 0xabf0ab00, 0x0000414e, 0xe3c5e3c4, 0xde542905, 0xe8f3e831, 0x00006814, 0x0efe0e31, 0xf6ae8df6, 0x7b687bfd, 0x00006d8b,
+        0xa6d0a628, 0x7e552374, 0xd4cdd43f, 0x000000b7, 0x27912737, 0x87f5bb3a, 0xa9afa926, 0x0000f196, 0x319131a3, 0xc52ab617, 0x1e5a1eaa, 0x00009c8a,
+        0x768776d3, 0xc17c6dba, 0xe6eee6f2, 0x000093b6, 0x413741d5, 0xb12afcc7, 0xea6eea00, 0x00008260, 0xf0aaf0ae, 0x6840b0e7, 0x2a4c2ae2, 0x0000e3b3,
+        0xc3a5c3c1, 0x1e817a3c, 0xb94bb9b0, 0x00000183, 0x7b407bec, 0xc70bc435, 0x985e98f6, 0x00007044, 0xcc47cc83, 0x59cbc0b5, 0x46db4674, 0x00001988,
+        0x66696646, 0x34193553, 0x3266322a, 0x0000ff9f, 0x1bba1b3b, 0xe7943656, 0x03f8035e, 0x0000246b, 0x64e26439, 0x8f4459a1, 0x6a5b6a56, 0x00008f14,
+        0x9b4c9b14, 0x44f9b75f, 0xf91af983, 0x00001d88, 0x47d14769, 0x3702c9f1, 0x81348151, 0x0000dde1, 0xfddcfd6d, 0xfa49c918, 0x833283c5, 0x00006e5b,
+        0x3d193dc4, 0x0e680d5b, 0xc591c5d0, 0x00000ad3, 0x69bc692e, 0x34191685, 0x04050499, 0x0000e06c, 0xe815e810, 0x68bf78c2, 0x2e682e5b, 0x0000203a,
+        0x0e550e3a, 0x7db402f9, 0x1ab51a3e, 0x00002af9, 0xfed0fe0e, 0xe79d90fe, 0xbca8bcc5, 0x00008771, 0x03f003b0, 0xf096775f, 0xe530e5c5, 0x0000fb23,
+        0x1a4a1a86, 0x8c17702f, 0x632c637d, 0x0000c1c5, 0x27f127ce, 0xc425024b, 0xd0bad0ac, 0x00002fdb, 0xd0ccd0f0, 0xdb54b98b, 0xb746b70e, 0x0000e6cb,
+        0x710f712a, 0x7075b3a4, 0x30fd300b, 0x00002e63, 0xbe88be5b, 0xcca5fd0c, 0x8bb38bcc, 0x00009614, 0xd100d132, 0x035b5ca3, 0xb6c8b649, 0x0000fbfc,
+        0x926c928a, 0xb57f6ac9, 0x1ea71ee8, 0x00009c46, 0xefb5efef, 0x5e901188, 0x459445b4, 0x00005db0, 0x146d14ba, 0xe9a343f5, 0x66aa66bb, 0x0000c060,
+        0x72ee72f5, 0x78da8c70, 0x9ecf9e6d, 0x00001dac, 0x54265417, 0x8fa6393e, 0x7e3d7eb0, 0x000095f5, 0x6df36d4e, 0xb05969fa, 0x2f7e2fd1, 0x0000c944,
+        0x5e585e43, 0x9e933e4d, 0x80698096, 0x0000b096, 0x7a8f7ac4, 0x7cdd6d10, 0x096d09ec, 0x00007444, 0x09c10960, 0x194ea093, 0x4db34de6, 0x0000bf79,
+        0x31533123, 0x96c98165, 0xdf58df1c, 0x00003a5e, 0x235a239e, 0x09258b56, 0x68586837, 0x0000f38c, 0xf51ef5d0, 0x84375533, 0xf6eaf672, 0x0000d8f5,
+        0x7f0f7f1e, 0x5a3c06ce, 0x0da60dbb, 0x0000070d, 0xabfcab57, 0x92b65d91, 0xc268c2dc, 0x00005da1, 0xeaacea2f, 0x41c110de, 0x9a609a3c, 0x00009ed1,
+        0x7df27d92, 0x583fcbf1, 0xf61df675, 0x00001888, 0x7e277ea7, 0x7f5325fa, 0xa55aa5ae, 0x0000d17a, 0xd9f6d998, 0x33dfdac4, 0x4ae14acb, 0x0000da77,
+        0x095a09d3, 0xa7a1469c, 0x45fd4552, 0x0000fc0c, 0x639f6332, 0xf2ae325c, 0x57d75732, 0x00000c63, 0x709b7082, 0x8e979d15, 0x269a2626, 0x000056bb,
+        0xe563e5a5, 0xf7e83997, 0xf8bff87b, 0x00009b69, 0xbc4dbcc3, 0x8a354cd6, 0xac4aaca0, 0x00001088, 0x32f832b1, 0x03f69c1d, 0x1c771c28, 0x000084de,
+        0x0f3b0fa9, 0x31dfd1c4, 0x46444640, 0x0000805f, 0xb2f9b211, 0xbe619f63, 0xc309c3c6, 0x000020e4, 0x79a97932, 0x02341ecf, 0x27c627b8, 0x0000962a,
+        0x30a7308a, 0xa9d0f959, 0x90b8906f, 0x0000c8cf, 0x0d320de3, 0xb6cf5832, 0x00750092, 0x00005e6f, 0xf03ef073, 0x1be03cff, 0x565456e9, 0x0000ff63,
+        0x5a5b5a50, 0xd2a8b286, 0x98d098e7, 0x000030a0, 0x7ede7ee7, 0x370263fa, 0xfc58fc38, 0x0000098d, 0x50dc50ad, 0xc8345ac2, 0xd358d3f3, 0x0000e103,
+        0x674b67c8, 0xb408edf1, 0x570c5742, 0x000051d8, 0xae22ae31, 0x3491180a, 0xc0dfc0cf, 0x00005223, 0x1d861d67, 0xea224143, 0xc7cfc78b, 0x00004e43,
+        0xcc9dcc93, 0x35485ae3, 0x90af9098, 0x00002274, 0x3f773f56, 0x47c178ce, 0xf119f158, 0x0000833d, 0x87c287f8, 0x2ca2cc7f, 0x428b4290, 0x0000b8ee,
+        0x7314737e, 0x17aa77d9, 0x01e1018c, 0x000020e5, 0x9db59d42, 0x8437a230, 0x2a472af0, 0x00000272, 0x82d28220, 0x8029c0fe, 0xac0cac94, 0x00002566,
+        0x04990426, 0x21ad7bbb, 0xd8f2d858, 0x00008507, 0xc118c183, 0xbe6e16c2, 0x3bec3b3a, 0x0000bd2f, 0xa877a8b2, 0x76a8b715, 0xa05fa0d1, 0x00006d0f,
+        0xd77ed7bd, 0x99a63d71, 0x713c713b, 0x00007f8f, 0xf1e8f10d, 0x6ce156f0, 0xadb4add0, 0x000087a2, 0xc9cfc96a, 0xc50b24d4, 0xeab5ea88, 0x0000f0ec,
+        0x2bac2bc1, 0x7d7e3b3e, 0x2cf22c5e, 0x0000de9d, 0xead7ea33, 0xef00bef8, 0x390539d8, 0x0000cc94, 0xc5d5c53f, 0x8f6441c6, 0xce97cec8, 0x00008bec,
+        0x0f4a0f84, 0x78dd06c7, 0xbd6dbdc2, 0x0000dba8, 0xa3e2a337, 0x94690aa6, 0xea54ead8, 0x0000872b, 0x42044290, 0xf86bc5e6, 0x7f7e7fd7, 0x0000a9fa,
+        0xc81ec8d8, 0x0c78a6d4, 0xf8e7f8b8, 0x00000362, 0x33593389, 0x83262729, 0xcd12cdd5, 0x0000f038, 0x3253325f, 0x2e5d7a7e, 0x688e68cf, 0x0000f91a,
+        0x5fcc5f2a, 0x91f1ec2a, 0xe970e987, 0x0000b380, 0x29832981, 0x23a22f99, 0xa209a216, 0x00001f88, 0x00df008f, 0x0bd79e61, 0x08e8084d, 0x0000c0c4,
+        0x833b83d4, 0xc24b1bd6, 0xec92ecab, 0x0000660f, 0x98a6984a, 0x62bf3c4c, 0x9b559bc9, 0x0000ffc3, 0x442d44b0, 0x96d9aafe, 0x344934de, 0x0000cedd,
+        0x3af93a58, 0x35cfa2a1, 0x3470348e, 0x0000d3a5, 0xdba1db14, 0x6ff36c7d, 0x6bb56b0f, 0x0000b0cc, 0xe814e82b, 0x94b3de9f, 0x8ba68bd8, 0x000037a0,
+        0x6391637d, 0x677a1c59, 0x49fe49e2, 0x00003b13, 0x9a399a2c, 0xe2c1fac9, 0x9343932c, 0x00009c86, 0xd5f8d560, 0x3990904f, 0x9c3a9cea, 0x0000201a,
+        0x5ef05ec9, 0x932e80cf, 0x395939b4, 0x0000bc84, 0x0fe40f62, 0xa9511fa3, 0x937d939c, 0x000074b0, 0x96629611, 0x835e112b, 0x873c87ac, 0x00008028,
+        0x23082309, 0xbccd78e1, 0xd9fdd9a4, 0x0000a11d, 0xc510c55c, 0x1aacd4f6, 0x61546182, 0x000099c8, 0x89b0893f, 0xa36877b6, 0xc4dfc4c0, 0x000067af,
+        0xd324d3cb, 0x7db5eb93, 0xf2a3f275, 0x0000c227, 0x8eff8ecc, 0xb05dd249, 0x52995225, 0x00001fa5, 0xee14ee38, 0xfb4830a3, 0xf016f0e6, 0x000021d5,
+        0x746974d0, 0xaccc372a, 0x7f397fe6, 0x0000693e, 0x9964995d, 0x64f09338, 0xef82ef5f, 0x0000e325, 0x6ad16a50, 0xa736086f, 0xc70fc75f, 0x0000563d,
+        0xfb0afb65, 0x78cdf525, 0xa049a040, 0x00008e8e, 0x22012207, 0x9c4b6625, 0x39f439b3, 0x0000f32d, 0x9cd49cd5, 0x47a672ab, 0x376f375e, 0x00000753,
+        0xcecdce2d, 0x68419e35, 0x0dbf0d47, 0x00007680, 0x2a0c2ad9, 0x4a385602, 0x96d3963d, 0x0000a836, 0x2409241f, 0xe931134d, 0x20b3208e, 0x0000ab25,
+        0xd2c7d276, 0x6ec27cc2, 0x546b5487, 0x00005ed8, 0x8e818ee8, 0xd38fbc31, 0x1bf41b5e, 0x000098f7, 0xc7e7c7d4, 0x6841dfb8, 0x7f8e7f23, 0x0000b891,
+        0x17201707, 0xeb17c409, 0x128a1207, 0x0000a507, 0xe211e223, 0xb58a9ea1, 0xf2f0f2ee, 0x00006217, 0x224b22d9, 0xbe1ffc78, 0x55ee554b, 0x0000b5b7,
+        0x8aea8a29, 0x46efe63a, 0x52ec52ff, 0x0000ec45, 0x981d98ef, 0x1a6ac59c, 0xf43cf44b, 0x00005ccf, 0x659b6592, 0xab7e41c7, 0x3db03d90, 0x000044f0,
+        0xf932f992, 0x8f672ab0, 0xb653b60b, 0x0000a255, 0x26262659, 0x194e4e07, 0x604a60e2, 0x0000beee, 0x913d913d, 0xd19fbcc9, 0x4935498c, 0x0000b189,
+        0x3bf03b30, 0x09352511, 0x2cc92cc4, 0x00007b70, 0x99f499ba, 0x3da04b56, 0x6fb06fed, 0x00007f06, 0x15f41521, 0x05f599e9, 0x66436649, 0x00007e62,
+        0xa6dca6f0, 0xaa3f1545, 0xf8ebf89e, 0x0000609e, 0x0e330e74, 0xa9d02326, 0xfd30fd24, 0x00008061, 0x7689764c, 0x3548cb51, 0xf4b3f4e8, 0x0000a885,
+        0x5b315b36, 0x15553b71, 0x510d516e, 0x0000d5ca, 0xdcebdc37, 0x12390ee5, 0xf450f49f, 0x00000272, 0xcb35cbd1, 0x1a21420a, 0x1f571f17, 0x00000f53,
+        0xa764a74c, 0x0a340518, 0x131c13dc, 0x0000bd8e, 0x71e171fe, 0xb463c0f3, 0xd95cd93c, 0x0000467f, 0x844e841f, 0xcc83a550, 0xc76dc794, 0x0000a947,
+        0xfd56fded, 0xf4c2fcc5, 0xbc16bc58, 0x00004b3b, 0xb1e7b137, 0x68f0a9c5, 0x7c667c25, 0x0000e8f6, 0x6b436b99, 0xb6715243, 0xa579a536, 0x00004502,
+        0xc935c9d3, 0xe8c033f0, 0xd697d6f3, 0x00009d90, 0x9792974c, 0x1bac7442, 0x0ad10ad2, 0x0000889b, 0x19291996, 0xd66d5248, 0x0c560c40, 0x00000ba2,
+        0x1bc71b9e, 0x508918d3, 0x168b16b8, 0x00004a6e, 0x9da99d4a, 0x96c9957e, 0x80468080, 0x0000fd88, 0x337233cc, 0x468e03d7, 0xdd23ddb4, 0x0000b476,
+        0x70887082, 0xb94a7dbb, 0x5ef35eb9, 0x0000072b, 0x6a636a5f, 0xfed29e63, 0xb8acb88a, 0x00002689, 0xf476f4b9, 0xf618dbc4, 0x54c75434, 0x0000fe9e,
+        0x3dff3d45, 0x35278558, 0xcbf2cbf1, 0x0000eae6, 0x99ba99f8, 0x9169fdde, 0x188e18a3, 0x0000d087, 0x3c623c60, 0x905d113f, 0xfdf2fd85, 0x000056b7,
+        0x8ddf8dd4, 0xcb9a2226, 0xe386e355, 0x00008ab7, 0xb5e4b589, 0xaf32c48b, 0xe734e708, 0x00006ee1, 0xeab6eaf9, 0x512f6a4c, 0x5f805f10, 0x0000d744,
+        0xfbe1fbff, 0xd2d60ca7, 0xcd1bcdd8, 0x0000f71a, 0x7d857d47, 0x51d293c7, 0x94719428, 0x00006252, 0x3c093c66, 0x3029cad8, 0x4fb64fe3, 0x0000eb16,
+        0x6bce6b51, 0x6f6451b2, 0x0b900b64, 0x0000676d, 0xe8c5e811, 0x25b06e35, 0xfda8fd7d, 0x0000678b, 0x68966868, 0xc655bcd7, 0x8e4e8e84, 0x00003bb9,
+        0xc81ec8d2, 0x0ff4af42, 0x5ee25e3f, 0x0000d267, 0xadf2adcf, 0x1aa51fd1, 0xf4b3f462, 0x0000df57, 0xb3f6b351, 0x7f6d62e5, 0x210c217c, 0x0000273a,
+        0x01730187, 0xe358e2fc, 0xaa9baa3d, 0x0000dceb, 0x51d951ce, 0xb02ab987, 0x59b059f7, 0x0000075d, 0x0094004b, 0xdf9e3121, 0xadaead4c, 0x00006e35,
+        0x7165717e, 0x3d29b2ec, 0x321832b0, 0x00004af2, 0xd312d307, 0x2d425c24, 0x41e741f1, 0x00000033, 0x811a8193, 0xe61369ca, 0x484548de, 0x0000832f,
+        0x540054b1, 0x6f7f2534, 0xa45da4d5, 0x0000206d, 0x68a2689b, 0xb8038d75, 0x63ca636a, 0x0000e335, 0xcee2ce8e, 0x34028dbf, 0xa3c0a359, 0x000082fe,
+        0xd9c1d958, 0x287e46b9, 0xb892b82b, 0x000070b1, 0xdd49dd9c, 0xd22b8bd0, 0x3ca83ca3, 0x0000b3a9, 0x968296d0, 0x1ac821f4, 0x926c92cf, 0x0000e920,
+        0x3a193a9b, 0x9f6806eb, 0xa267a2cd, 0x0000785f, 0x8f228f2b, 0x7547adc2, 0x73b473a4, 0x0000c8cf, 0xa71ba778, 0xa80db960, 0xfc0dfc07, 0x000096f5,
+        0xa1c9a1f4, 0xa3dc50cd, 0x13e713a8, 0x0000d997, 0x9e849e5a, 0xc2094efa, 0xda1adac6, 0x000071b6, 0x7a307aa7, 0x121960e4, 0xdcbfdc48, 0x00000d87,
+        0xa798a70e, 0xcc0702b4, 0xa0a6a0d2, 0x0000d875, 0xb585b574, 0xec82e199, 0xed07eddb, 0x0000cefc, 0x005d008d, 0xa33a0f01, 0x73be7304, 0x0000b57c,
+        0x9aa39a47, 0xc4546b4e, 0x1cda1cd5, 0x00005484, 0x6c196c99, 0xd5b0dd15, 0xf904f920, 0x00006f2b, 0x04c90409, 0x4fe1927b, 0xd20cd238, 0x0000bbc3,
+        0x7fe27f8c, 0x89c47e3d, 0x31653156, 0x00007051, 0xdeb3de23, 0x1d2145d5, 0x6c886cb7, 0x0000af38, 0x86958641, 0x7fc946ae, 0x1b251ba9, 0x00002f35,
+        0x8a928ae2, 0xfdfc99aa, 0x266c26fd, 0x0000cd10, 0x609260da, 0x9ebd9338, 0x75337504, 0x000059c7, 0x268e2681, 0x15926427, 0xd3d3d376, 0x0000df56,
+        0xd9aed9d4, 0x4b74828f, 0xe164e143, 0x0000dfeb, 0x3c643c7f, 0x4666732f, 0x1cc11c23, 0x00004bd6, 0x01e30102, 0xec6f8796, 0xf65af6fd, 0x0000d829,
+        0x7b8c7b57, 0xc0f8e4dc, 0x71707122, 0x0000975d, 0x282928f1, 0x0ccb3620, 0xef74ef5d, 0x000009ec, 0x9c2a9c1f, 0x70ca7921, 0x75a875c9, 0x00008420,
+        0xced2cea6, 0x09e2a453, 0x4c1d4cc3, 0x00008602, 0xc3c7c371, 0x37e6f4d1, 0xc609c60a, 0x0000fecc, 0xd69cd68f, 0x85f7daa5, 0x9ed99e64, 0x00009ce0,
+        0x5ce35c5f, 0xb2a3b224, 0x2326238d, 0x0000065d, 0x7523756d, 0xf0264458, 0xd020d066, 0x0000ff01, 0x19d319af, 0x8a278731, 0x44c64495, 0x000074b1,
+        0xb1bab1f2, 0x62b30074, 0x6ba76b2b, 0x0000de74, 0x9c5e9c13, 0x29bdd42a, 0x97c197d7, 0x0000c76e, 0xb9c3b921, 0xcc7a48df, 0x1aa01a6e, 0x0000af0f,
+        0xf522f5b3, 0xe92e939e, 0x2f6a2f04, 0x0000dc1e, 0xe8e8e8bf, 0x7e553e4e, 0x789078de, 0x0000a876, 0x41144101, 0x744ad4f6, 0xf866f832, 0x0000dada,
+        0xa3cfa3f5, 0x65ba96be, 0xc921c902, 0x00008ce1, 0xdf8edf78, 0x33b1d8c4, 0x5d3c5dca, 0x00003395, 0x802d8038, 0x69224cd6, 0x1820182b, 0x000028db,
+        0xcafbca66, 0x93779aae, 0x1e5d1e1a, 0x000095d1, 0xe705e7cb, 0xfccff346, 0x260826ff, 0x00003f92, 0x0cc30cd3, 0xd1f89a55, 0xbdabbda9, 0x000022b7,
+        0xff66ffc6, 0x08683591, 0x2b142b2d, 0x00007423, 0xc40fc47f, 0x44be42c4, 0x489d48b3, 0x000089c3, 0x50a25039, 0x59886e20, 0xc6f1c6f6, 0x0000dcbc,
+        0xb7f7b76b, 0x4446a0a4, 0x13e213ad, 0x000019b3, 0x69cb69db, 0x01397da8, 0x2a6e2af8, 0x0000a364, 0x00a60002, 0x130d3580, 0xe7f3e7b3, 0x00001a0d,
+        0x00f00009, 0x694a3752, 0xf850f8f5, 0x00009fc1, 0xeae0ea6e, 0xe7928da0, 0xe913e930, 0x00004f42, 0xe33ae328, 0x5eb920cb, 0xf934f99a, 0x0000efbb,
+        0xcc98cc6f, 0x9f2e5ade, 0x620d624e, 0x000058e8, 0xbf46bf99, 0xee93ae87, 0x47254706, 0x0000c11b, 0x31983138, 0x13e570ed, 0x0f1c0f6b, 0x000009f1,
+        0xed92ed6c, 0xc625bd4a, 0x96389639, 0x00004311, 0xda4ada95, 0x94b65b23, 0xbb3dbbc6, 0x0000cab7, 0xdd6dddbc, 0x6cdfa743, 0xb317b38d, 0x000045ba,
+        0xbf82bf0b, 0x39e13754, 0xf9a8f9a5, 0x0000b8bb, 0xa627a616, 0x68c2c640, 0xf44ef413, 0x0000d07a, 0x95d49555, 0x3b9124d6, 0x492c4992, 0x00003df7,
+        0xd703d747, 0xf3675472, 0xd002d008, 0x0000b910, 0x530653fa, 0x1660024b, 0x9d6e9d28, 0x00004fa3, 0x870f8771, 0xae5bced0, 0xcd62cd3c, 0x00005246,
+        0x986c9820, 0xf3039339, 0x06d70607, 0x00009714, 0xef39ef96, 0x8428d577, 0xbdd4bd3f, 0x0000f75c, 0x76a1769b, 0xf551445b, 0xb4dbb463, 0x0000d0b9,
+        0xb56ab52b, 0x094aabff, 0xfc4cfc12, 0x00001935, 0x479847b0, 0x738a4fb9, 0x0f850f02, 0x0000d96d, 0x84c784db, 0xa58fe6a3, 0x0aff0a17, 0x00009177,
+        0xcac9ca04, 0xf0f4da5b, 0x69486941, 0x000014b4, 0xfcd9fcad, 0xb7dc1baa, 0x23a62377, 0x0000b443, 0x31c9317d, 0x5768d3eb, 0x04e40412, 0x00007097,
+        0x7fbf7f8e, 0xd54310b9, 0xf905f96c, 0x0000e4f5, 0xfaf9fa63, 0x17aa32e0, 0xedeaed02, 0x0000f6c4, 0x70e970a2, 0x2e32da5b, 0x1c321c0f, 0x00005876,
+        0x78497829, 0x489fd548, 0xe6e3e679, 0x000099c8, 0x63a56399, 0x4a05ebfd, 0xf901f933, 0x00002cac, 0x420e4271, 0xc6ca7839, 0x384e38f4, 0x0000d52d,
+        0x03dd03cf, 0x13187f49, 0xd8c7d82f, 0x00003606, 0xcd41cd1d, 0x4067e0bd, 0xcfb2cf09, 0x00007754, 0x7ced7c58, 0xbf13df6a, 0x8d238df2, 0x0000a5b8,
+        0xd639d655, 0xc7eb59a3, 0x04010434, 0x00004e43, 0x3e053e3b, 0x4d77921c, 0xf231f2f6, 0x0000b810, 0xe987e94e, 0x9c583f80, 0xec1bec0d, 0x0000e5ef,
+        0x1afa1a19, 0xf729bdf5, 0x6b5f6bff, 0x00001b07, 0x1fa81f50, 0x69dd7ff6, 0xe1d6e12c, 0x00009dae, 0xe85ae8f2, 0x944fc6ba, 0x080f08c4, 0x0000c8cf,
+        0x78c6789e, 0xcb6594c5, 0x232c23b7, 0x00009a2a, 0xe4e3e4c7, 0x0b353df2, 0x975c9762, 0x0000c710, 0xa577a526, 0xac5a0946, 0x588b58d6, 0x0000c54c,
+        0x812681de, 0x3b90ba86, 0x3f8f3ff8, 0x00008961, 0x5eee5ebe, 0xb6e50278, 0x735873be, 0x0000ac3e, 0xd0e8d0d5, 0x2ff2c184, 0x4c3d4c1c, 0x0000b2f1,
+        0xedeeed70, 0xd71ba433, 0x0f7c0f6d, 0x0000e244, 0x52a552fc, 0x54cbbdf6, 0xfafefaed, 0x00003cf3, 0xefd5ef2e, 0x1555a3db, 0x05f9050a, 0x00006605,
+        0x982b9813, 0xa951a9ce, 0xfb7bfb44, 0x000035a0, 0xfb5ffb64, 0xead3609d, 0x5b2b5b4b, 0x00001b47, 0xf9cff977, 0xce400aeb, 0xe194e19d, 0x0000f62e,
+        0x6a7d6a71, 0x9c3e84e2, 0xdc47dc9d, 0x0000fe0c, 0xd89fd827, 0x48111bd0, 0x2e472e64, 0x000083f9, 0xe7f8e76e, 0x4196b837, 0x11621160, 0x00002f2e,
+        0x7911799f, 0x2f211199, 0x0ab50a2e, 0x000037f0, 0xc74bc714, 0xb033ce51, 0x0749076a, 0x0000d5e7, 0x7ee17ee5, 0x2192c6c3, 0x0e500eff, 0x0000c1b1,
+        0xce3dce88, 0x57dd1bec, 0xbb6fbbaa, 0x0000462f, 0x46344623, 0xe6152e3b, 0xf642f612, 0x0000f90a, 0x293d2908, 0x6ca01a53, 0x942f94d7, 0x0000cbaa,
+        0x2bd82be3, 0x03e4ff58, 0x345134a2, 0x000086ff, 0x9b149bed, 0xb2931f31, 0x956b9579, 0x0000aa37, 0x173117eb, 0x49097e3f, 0xf238f27a, 0x0000b813,
+        0xa51da52f, 0x76bc18d0, 0x75fe7515, 0x00002bc2, 0x526452b1, 0x8e67d549, 0xec2dece8, 0x0000fa72, 0x7234729f, 0x0226d039, 0x4a524aa6, 0x0000060d,
+        0x93619358, 0x8bf87622, 0xa35ba349, 0x000082a2, 0x99ca99a6, 0x091cced7, 0xba3fba34, 0x00000433, 0x43e74324, 0xc52a63c5, 0xa365a3de, 0x00004280,
+        0xf4c7f4b7, 0x14b1b4a9, 0x168a16b4, 0x000056bb, 0x1c1f1c21, 0xd0724e8f, 0x348b34af, 0x00009334, 0x85f9852a, 0x20c135ed, 0xabdbab87, 0x0000f40c,
+        0xdeeadeef, 0xbaadcf57, 0xe19ae164, 0x00000653, 0x8729876f, 0xcc7a101e, 0x73627322, 0x00009df5, 0x00c8000a, 0x0a5cc33c, 0x51af510b, 0x00002c86,
+        0x3e223e3c, 0x50e7dadb, 0x317b313c, 0x0000df86, 0x04260428, 0x7d96a72f, 0x8e2b8ea5, 0x00001d6c, 0x7001703c, 0xb2a9615a, 0x5b435b52, 0x0000b467,
+        0x5ae55ac3, 0x40798232, 0xe551e503, 0x00002704, 0x69cd69f4, 0x1b6c03c8, 0xcb08cb3c, 0x0000d8eb, 0x51f151c9, 0x3150066d, 0x82a08289, 0x00006f35,
+        0x5a025a5e, 0x5a9f16bc, 0xee0dee0b, 0x00005564, 0xdedadebe, 0x55f2570d, 0xa0aca0e5, 0x00006600, 0x570e57bd, 0x289cfcc5, 0xa425a453, 0x000028a5,
+        0xa9e5a9d6, 0x8c88a52e, 0x9f019f82, 0x0000a651, 0xd97fd97b, 0xfb11e664, 0x97e197fc, 0x0000d9e5, 0x42644281, 0x142f8fa0, 0x594f59bc, 0x00000432,
+        0xb1bbb14b, 0x84f72ec6, 0xae6faedb, 0x00003f33, 0xfa27fa7b, 0x7100bcea, 0xa94ba950, 0x00005225, 0x6ff06f8f, 0xffcc615a, 0x7ac97a3f, 0x000087bc,
+        0x9b959b81, 0x8b788f9e, 0xc58bc502, 0x00007b0e, 0x56d156d7, 0x840756f3, 0xa028a0d6, 0x000037f0, 0x561e5681, 0x9da9e9cd, 0xabc0ab61, 0x0000b213,
+        0xbe32be94, 0x829f814c, 0xf337f3fb, 0x0000493b, 0x32dc3289, 0x037b7b42, 0xb5e5b5ce, 0x00009f31, 0x9ecb9e35, 0xd25fb947, 0x3b893b71, 0x0000f75d,
+        0x8ab38a30, 0xfdb66974, 0x256d252f, 0x0000fdcc, 0x3ad23a41, 0x51ce9455, 0x344f34f3, 0x000087a3, 0x74d77496, 0xe723206b, 0xdf42df43, 0x00005009,
+        0x5b425b85, 0x3a3cec4f, 0xf68af607, 0x0000c312, 0xa647a68a, 0xf7577ec2, 0x842b84a4, 0x00001d44, 0xeb0febbd, 0xf56e4ae2, 0xc959c949, 0x00000c43,
+        0xc17dc1fd, 0xc01465b9, 0x11221144, 0x0000c7fc, 0x7cd67c15, 0xf69193c8, 0xd8a7d857, 0x00000f00, 0xda6eda5c, 0x79981702, 0x054605ec, 0x00003103,
+        0x06de06a5, 0x635a69f4, 0xf3f3f3ac, 0x0000b443, 0xb5f8b516, 0xb295c243, 0x60ba60ac, 0x0000086a, 0xdd3cdd96, 0x143dcbf1, 0x14a514de, 0x000080ef,
+        0x8352837e, 0x4f2708d2, 0xa80ba8fe, 0x0000d4c7, 0xd12cd109, 0x892f7862, 0xeaecea1d, 0x000001fd, 0xbec3beb7, 0x619b1b52, 0x66af6689, 0x00001b14,
+        0x372937c6, 0xb7cc7a51, 0x394739a3, 0x00000b63, 0x050705dc, 0x94c9cefb, 0x160b1689, 0x00008580, 0x59635929, 0x9aec44c4, 0x08190868, 0x0000da6e,
+        0xdf79dfb0, 0xabc512cf, 0xed3fed8e, 0x0000ee5f, 0x00780038, 0x9e2f038a, 0x3b8c3b29, 0x00008390, 0xa023a079, 0x5c061dd0, 0xf326f3a1, 0x000098c1,
+        0x1f591f0e, 0x7f5e9227, 0x959995e9, 0x0000581d, 0xcdeacdcf, 0x70989c98, 0x280c28c4, 0x00009515, 0xc22ec2f9, 0xb894c2c5, 0x4e1d4e39, 0x00004fb1,
+        0xb32eb32e, 0x4b867c7b, 0xecf8ecfb, 0x000075fe, 0xdf95df72, 0xba456805, 0xd560d5ca, 0x00004710, 0x216721c1, 0xf01843f8, 0x9e799e25, 0x0000f5e7,
+        0xf342f347, 0xc7eb99e8, 0x0bf60b59, 0x0000fa7e, 0x88e188e4, 0x7af5c2cc, 0x949f94a8, 0x0000f6ec, 0xd3d0d327, 0xe1a27ec2, 0x89a18988, 0x0000d9ea,
+        0x783c782e, 0x1280efbd, 0xdf49df13, 0x000012f8, 0x46d846f8, 0x72a9f79a, 0x180418eb, 0x00002c3a, 0xa0b1a0c7, 0xc4ca1586, 0x3d163d6e, 0x00004a12,
+        0x44cc447f, 0xb61bdde5, 0x1045107c, 0x0000c8b0, 0x842d846f, 0x59b7702f, 0xfb77fb6e, 0x0000e5c2, 0x379d3746, 0x5f4df361, 0x252c2549, 0x0000406e,
+        0x77fc773d, 0xa58378b6, 0x7ea67ea7, 0x000082ff, 0xf4faf46d, 0x95f1e213, 0x21ed21be, 0x0000d16a, 0x5c8b5c7e, 0x5cc832df, 0x642264f0, 0x00005bb0,
+        0x56555673, 0xae131dd0, 0x261b2620, 0x0000b2ea, 0x58f55898, 0x5d660c46, 0x663266bb, 0x0000d967, 0x90b29068, 0x4ad4a7ab, 0xb506b580, 0x0000398c,
+        0x6b696bca, 0x3abefddb, 0x2ae42a1c, 0x00008130, 0x97dc973f, 0xb36cec21, 0xd0b4d06f, 0x000071ca, 0xc0bdc037, 0xa85993d7, 0x30f130a0, 0x00005f42,
+        0x33e5334f, 0xa641c418, 0xc9a0c9f3, 0x00007c4f, 0x6ac46a9a, 0x51408e5b, 0x8e4c8e89, 0x00009887, 0x26d22679, 0xc5a2c998, 0x46264683, 0x000063aa,
+        0xedd9ed19, 0x52d88fde, 0x874d875b, 0x0000f3f0, 0x32e332fd, 0xcc652cbf, 0xffa3ff75, 0x00007a60, 0x31c031f6, 0xfb70702d, 0x7e537eb7, 0x000009e0,
+        0x9da79dbe, 0xda6bd635, 0x26132620, 0x000033e6, 0xc35ac357, 0x7098e9cd, 0x270c27e5, 0x00008f5f, 0x4bf64be7, 0xeb318f7f, 0x467646cf, 0x0000b6d7,
+        0x14cb14c3, 0x68f02062, 0xe010e016, 0x00002289, 0x04f004f4, 0x2730ced3, 0xbc17bc4d, 0x00009bc9, 0xfb6dfb67, 0x5d1779fd, 0x54ad5442, 0x00003233,
+        0x5ce35c53, 0x4c0bd111, 0x56915614, 0x0000e06d, 0xaf11af16, 0xf4e3968c, 0xf5f4f5a6, 0x00008118, 0x403f40c0, 0xddf32906, 0x67686736, 0x000037df,
+        0x4a544a48, 0x8188c7c3, 0xdcebdca4, 0x0000fd62, 0xf1ccf130, 0xe852f6d7, 0xfc56fca5, 0x0000a5e8, 0x3177312e, 0x27fecd05, 0x3cf73c53, 0x00001dd3,
+        0xd6e6d658, 0x396f25ac, 0xb88ab852, 0x0000ec5f, 0xa1a2a15b, 0x64126458, 0x869086c2, 0x00007aa3, 0xd9e1d927, 0xd6b0120a, 0x1f0c1f2e, 0x00008f90,
+        0x18921899, 0xa80d5922, 0x195e1910, 0x0000ca74, 0x18fd1841, 0xd104454d, 0x7c367c0e, 0x0000a1b1, 0xdde9dd5b, 0xcfc56ed3, 0xcfc5cfd1, 0x0000fba0,
+        0xb03cb00f, 0x1993f923, 0x459d4545, 0x00003ad3, 0xf8b4f866, 0x509d5ae0, 0xa61fa609, 0x0000ab08, 0x65136573, 0x05a43070, 0x8ae88aae, 0x00002575,
+        0x3d1d3d19, 0xf73b143d, 0x2eab2e4e, 0x00004941, 0xd170d1c8, 0xbc9952ed, 0x6e956e7a, 0x00006a8a, 0x7b847b03, 0x59b71e73, 0x6e006e24, 0x0000ad07,
+        0x61e9619e, 0x406f44df, 0x310c3113, 0x0000f83e, 0xd059d080, 0x29e80858, 0x3df63db6, 0x00001d14, 0x45204597, 0x9af32511, 0xa6afa60f, 0x0000edc3,
+        0x213521df, 0xc035b758, 0x145d14dd, 0x0000cdce, 0x8c168c55, 0xbf9ac8ee, 0x5914597b, 0x0000a384, 0x2e672e63, 0xfd866cf4, 0xd9f7d971, 0x00005ee9,
+        0x460646f9, 0x33b29b4c, 0xa447a45a, 0x00001cf4, 0x3d513dc3, 0xc6e2c8d0, 0x6eb56ed6, 0x000015d7, 0x474a4734, 0x65b2fa57, 0x724072c9, 0x0000f296,
+        0x65166521, 0x33cfa253, 0x47dc472c, 0x0000b08e, 0x636663c4, 0xa9f1fa63, 0x4d0d4d3d, 0x0000e4c2, 0x77287747, 0xdb50258e, 0x2e2a2e5e, 0x0000966b,
+        0x05620587, 0x230fc723, 0x3e653ec7, 0x0000f3f1, 0x0fa10fdf, 0x296307a1, 0x9f919fbd, 0x00002589, 0x38ee3816, 0x8d28ed7b, 0x6746674f, 0x00002066,
+        0xd518d59b, 0x8946901f, 0xcb43cb0a, 0x00005dd8, 0xc4e9c4fd, 0xc814d58e, 0x8c348c6b, 0x0000dc3f, 0x562456d4, 0x0f85732f, 0x445c446a, 0x0000e9ab,
+        0x271f27f7, 0x5152dd1e, 0xb889b85c, 0x00005fb5, 0x9fe19f85, 0x722af336, 0x09af09b9, 0x0000f482, 0x3363331c, 0x3baf92f9, 0xd248d216, 0x0000c5f2,
+        0xb116b18e, 0x9e9c3a21, 0x541154c3, 0x00002ca4, 0x429e4232, 0xe958e45d, 0x45b84544, 0x00001614, 0xd7bad7b8, 0x88c74572, 0x759475cf, 0x0000472f,
+        0x2e1a2e6a, 0x8237bef6, 0x00be0086, 0x00001088, 0x7c387ca2, 0x4d9e1ab4, 0x761076c0, 0x0000d71d, 0xfe79fe99, 0x685090f9, 0xb3f7b32c, 0x00007473,
+        0xa10ba1e3, 0xd52d9253, 0x8a718a32, 0x00007d4c, 0x84348466, 0xc78470ab, 0xf056f0c1, 0x0000eeca, 0xc4cfc477, 0x6d1c456f, 0x599159e4, 0x0000de89,
+        0x3e643e61, 0x4f29514e, 0x16ed1690, 0x0000a4dc, 0xfa1cfa0c, 0xd7bbc1fe, 0xd3aad310, 0x0000ee5f, 0xa37da33c, 0x44266367, 0x8598853a, 0x00005706,
+        0x845e843c, 0xf0732b32, 0x07740785, 0x00005059, 0x43b7433e, 0x5b89e1bd, 0x7769779c, 0x0000c9b8, 0x2bde2bcf, 0x08158cde, 0x5f8f5f29, 0x000006ac,
+        0x29a8295c, 0x4f271eed, 0x12771282, 0x0000b743, 0xb668b670, 0x4447b026, 0xfff8ffb3, 0x00008201, 0x364d36f9, 0x68222509, 0x8a278a1f, 0x00000f83,
+        0x44d544b2, 0x78cd5430, 0xe515e59e, 0x00002fa4, 0xcb85cb6f, 0xf65118d5, 0x134113f9, 0x0000695d, 0xf197f1b2, 0xf86d57be, 0xc054c0b1, 0x0000c2ac,
+        0x84158421, 0x3e76cfaf, 0x37d03720, 0x0000c34d, 0x7f1d7fbd, 0x78556759, 0x5b105b2d, 0x0000aa5a, 0x124b123d, 0xcdfa69ca, 0xea1ceafa, 0x0000ec03,
+        0xa5ada527, 0xf7512b3a, 0x70d4703b, 0x000071ef, 0xd3cad30e, 0x60cf5bb8, 0x840e8415, 0x000018ac, 0x4ee64eff, 0xb1fcdf3b, 0x04790416, 0x00000963,
+        0xf0c9f03a, 0x6ec32f29, 0xac4aacf4, 0x0000efcb, 0xa6c5a64c, 0xe56343c9, 0xe56ce5dc, 0x00000039, 0x62756290, 0xa51de6fc, 0x7f677f20, 0x00005b1c,
+        0xf3d6f3fa, 0xec837a29, 0xae67ae1b, 0x0000eb18, 0x1b841b6c, 0xb1230b9c, 0x992199cf, 0x0000a2b5, 0xe759e7d7, 0xd60407f7, 0x662266f4, 0x000089db,
+        0x2e302ece, 0x2992fef9, 0xe9d4e9bf, 0x000080a2, 0x5d7c5dab, 0x7549d74b, 0x38e93893, 0x0000d1d9, 0xf49af430, 0x45db9808, 0x090a09e9, 0x00002175,
+        0x3a8f3a98, 0x15e58b10, 0x419d41bf, 0x0000f26a, 0xa6cca6d9, 0x5c9d58e3, 0xc29bc272, 0x0000b4a8, 0x0a6b0ab6, 0xa19e2c1e, 0x15e71500, 0x00002976,
+        0x160c169d, 0x014633df, 0xe961e971, 0x0000a6b1, 0xe8aee8b7, 0x0f685ca4, 0xa885a858, 0x0000187a, 0x5da65dfd, 0xf111a554, 0xf1fcf1a3, 0x00005049,
+        0x126d1248, 0x84754e08, 0xba5dba32, 0x0000bbb1, 0xa2c5a2aa, 0xeb0eb9f8, 0xe673e6d3, 0x00009616, 0xeffeefbc, 0x706c58d9, 0xff98ff29, 0x0000f6ec,
+        0x8fb78f1b, 0x2f0f2bbf, 0xb2eab217, 0x0000e73c, 0x35f53504, 0xe2d70ee5, 0x6c6c6c38, 0x00005bdd, 0x491449cf, 0x127c18d5, 0x613a6113, 0x0000c4b2,
+        0x5edb5ea1, 0xfb1e87b0, 0x8340833a, 0x00000743, 0xa6f1a697, 0xa3c3c816, 0x79ac79be, 0x00004904, 0xa036a0fa, 0xb67bb405, 0x50595082, 0x0000ba10,
+        0x6a3b6ab4, 0xe1a2371b, 0x9f2d9f1c, 0x00008603, 0x264a2668, 0x43b9e680, 0x8cd58c23, 0x00001b73, 0x8e578e91, 0x98f1ba2f, 0x39fa39b1, 0x000057e8,
+        0xf2f4f23d, 0x38d81d2b, 0x122112ca, 0x000092c9, 0x6d9f6d5b, 0x9e3ee05d, 0x5d095d57, 0x0000908a, 0x80538064, 0x4b090d0b, 0xc451c47e, 0x00002d74,
+        0x4a844acb, 0x13a5bef8, 0x1ed21e1e, 0x000022c5, 0x890e8989, 0x2a9cf654, 0xf2c3f224, 0x0000a498, 0x4498448a, 0xfd0d3a4c, 0xa409a495, 0x0000d96c,
+        0x5648563a, 0x797161f9, 0x0e2e0ea4, 0x0000c227, 0x19031936, 0x6af01036, 0x0b620be3, 0x0000f99e, 0xdb1cdbee, 0x38a19f55, 0x2dbe2d89, 0x000043c6,
+        0x27c427b5, 0x73db82cf, 0xe354e33f, 0x000077d1, 0x630863fb, 0x54668790, 0x73cb738f, 0x00003e92, 0x0e700eef, 0x38ba45fb, 0x591a597c, 0x0000a031,
+        0x8e368ecb, 0x8d3797c8, 0x04c40437, 0x00003824, 0x43e943a5, 0x2912305f, 0x7f147f76, 0x0000902b, 0x53ce532e, 0x3b554b63, 0xee74ee2c, 0x00000e0d,
+        0xcc35cce1, 0xda040486, 0xfc8ffcf8, 0x0000bc4e, 0xbc7ebc9c, 0x60a009d7, 0x73657321, 0x0000ec94, 0x6bc06b5e, 0xea8334c0, 0x1e5f1e93, 0x00008f53,
+        0xea06ea53, 0xb0474ec3, 0x15541546, 0x0000e84a, 0xc840c81b, 0xaa9158aa, 0x7f527fe5, 0x00001aac, 0x9e589ec2, 0x0dcba1d4, 0xcc07ccd2, 0x00002675,
+        0x75d67506, 0x1e4dea0c, 0x5d2c5def, 0x000035ae, 0x8e398ef7, 0x5178fe7d, 0x4829485c, 0x0000b0cd, 0x2f6c2ff0, 0xfae88ffe, 0x75ab7576, 0x0000ea18,
+        0x4e2b4e03, 0x34cf293b, 0x76c576db, 0x00008818, 0x75ba7551, 0x89f7fb31, 0x0b6b0bf0, 0x00003e6c, 0x6274627e, 0xe9236485, 0x809180d9, 0x000030ce,
+        0xae67ae77, 0xf7576400, 0x8dbf8d04, 0x0000f893, 0x043304d8, 0x314836e0, 0x9a519aa6, 0x00004ca9, 0x4c2a4c99, 0xbf034229, 0x28832839, 0x0000b84e,
+        0xd76ad738, 0x37e986cf, 0x9f1f9f56, 0x0000456e, 0xc50cc5ec, 0x80255032, 0x2640269d, 0x0000aa09, 0x9d7f9dc7, 0xd5cb16b4, 0xdb53dbcb, 0x00006f19,
+        0x450e4554, 0x021921dc, 0x0b140bc0, 0x00005a2b, 0x19b51914, 0xd46d7ba0, 0xb72eb74d, 0x00008950, 0x6acf6a51, 0x8a79ec32, 0x15f615b8, 0x0000660f,
+        0x94189487, 0x41998fde, 0x630d634c, 0x00004e37, 0x9dc59dc3, 0x59324112, 0x21cf212f, 0x00005cb5, 0x25c625b7, 0xb9cdacb8, 0xa7c3a7ef, 0x0000be91,
+        0xd480d483, 0xf45c793c, 0xe50ce531, 0x00006821, 0x1df11dc3, 0xd6057134, 0x5d3a5d87, 0x00004e7c, 0x7ff17f8a, 0xd69c732d, 0xa436a463, 0x00008a1b,
+        0x7baa7b82, 0x2ad64d35, 0xff4aff48, 0x00003639, 0xb690b650, 0x05c49c6a, 0x2352238a, 0x0000ce34, 0x5029503f, 0x8e66bc38, 0xc316c39f, 0x000019b7,
+        0x579e57fe, 0x9e5c6d86, 0x99a799d6, 0x00007e3f, 0xe9aee911, 0xc30be5dd, 0xf54ff51c, 0x00002741, 0x03c10344, 0x5b69bd36, 0xceb0ce59, 0x0000479f,
+        0x8fc38fef, 0xad9f6625, 0x55fb55f9, 0x0000e939, 0x9b389bdc, 0x694f523d, 0x42784264, 0x0000493b, 0x711c7190, 0x916824ab, 0xca4fca85, 0x000027ea,
+        0x042f0460, 0xafde91be, 0xd402d426, 0x00000e5d, 0x96c296db, 0x1a5f59a1, 0xb73fb7bc, 0x0000b0cd, 0x14881479, 0x50e73510, 0x827e82cd, 0x00007f8b,
+        0x58de586b, 0xea5b51bc, 0x9f6e9fc0, 0x00003695, 0xa914a965, 0x6030ac54, 0xa20da297, 0x0000e9dc, 0x13a91358, 0x80e9e55e, 0x44054447, 0x0000d6eb,
+        0xfb5cfb32, 0x2f210088, 0x881b88ae, 0x0000684b, 0x3d1d3d91, 0xf29b2abf, 0xaf32af38, 0x000065e1, 0xbe4cbee7, 0xc879b2a6, 0xb157b15e, 0x00002ed6,
+        0x6a766a2f, 0xe4d3b715, 0xa95ea9f4, 0x00007b0e, 0xe0dbe07e, 0xd044b987, 0x2e072eca, 0x0000e2f6, 0xe1cce102, 0x931637d5, 0x910b91fd, 0x0000e106,
+        0xa594a5d4, 0x5f2038f0, 0x360f3685, 0x0000fc73, 0x9d749dc6, 0xdc540285, 0x6f976f3b, 0x0000b3a8, 0xde3dde86, 0x060c3e31, 0x250325cc, 0x00003411,
+        0xd7c6d7bc, 0x58a9b3a7, 0x90da9084, 0x00003f37, 0xb684b6d0, 0xa80d201e, 0x61a66165, 0x0000d0fb, 0xa7aba7b0, 0x9e16105c, 0x58165897, 0x00000162,
+        0x7cb97ce0, 0xe323af89, 0x294529e4, 0x0000908a, 0x0b6f0bbf, 0xe56475ad, 0x4e4c4e44, 0x0000b90d, 0x894b8938, 0x036c3fce, 0x0b150bb3, 0x00006251,
+        0x14d61444, 0x7102ae3f, 0x68c5682e, 0x0000bd2f, 0xddc8ddb7, 0x0ff491be, 0x004f0056, 0x00003541, 0xd43dd483, 0x1e1a5ae2, 0x10c01021, 0x00009c06,
+        0x020802fe, 0xc3a2d091, 0xc1c8c1ce, 0x0000aebf, 0x437b433c, 0xf5cc0416, 0xfc5cfc45, 0x00007acc, 0x2d102df2, 0x67d3dfe9, 0x658d65c1, 0x00001eb9,
+        0xaca5ac38, 0x7afdb3a7, 0xc454c4ce, 0x0000352f, 0x3f2f3fd3, 0xb8ecdb5a, 0xc444c40d, 0x0000908a, 0x4c1f4ca0, 0x624e91be, 0x78ad7836, 0x0000c44d,
+        0x1633168a, 0x78dd0307, 0x77077735, 0x0000ed28, 0x870087d1, 0x124dbba6, 0x435b43a9, 0x0000a809, 0x6c386c82, 0xd692b617, 0x8a8d8ab1, 0x0000d0a5,
+        0x0c060c2a, 0x80df65e4, 0x33b0337f, 0x0000ff1e, 0xebe2eb4f, 0x8cd0c91a, 0x311b3103, 0x0000d187, 0x36d83664, 0xc7f506e8, 0x66ba661b, 0x00003d13,
+        0x909890df, 0x8136b9c8, 0xf87ef848, 0x00002f35, 0x52d55208, 0xab84834f, 0x671a6711, 0x0000a4dc, 0x033b03e5, 0x227bd60a, 0xe8dce8c4, 0x0000f808,
+        0x2f3f2f23, 0xf264cb22, 0x1029107e, 0x00007770, 0x51e25156, 0x6e028082, 0xdbf9dba0, 0x00004090, 0xef50ef28, 0xdf8bcd51, 0x4282423b, 0x00004ed2,
+        0x7e797e94, 0x399fccd8, 0x07460701, 0x0000598d, 0x7bc07b44, 0xd2565c60, 0x17ea170d, 0x0000a628, 0x58e85868, 0xffce78e2, 0x0bad0bf2, 0x00006d35,
+        0xb84eb8b2, 0x7e22c1fc, 0xa9caa929, 0x0000e524, 0x866e8685, 0x3dcac271, 0x7ca67c59, 0x0000e244, 0xa05ba032, 0x940620f5, 0xc9c3c92a, 0x00003d7b,
+        0x517c51f6, 0xfdcfacd1, 0xd21ad2d3, 0x00002fba, 0xf2e9f2a4, 0x3c6532a3, 0xcc10ccc3, 0x0000cd8d, 0x68a96809, 0xe342dadb, 0xfb9cfb62, 0x0000bea0,
+        0xaa1eaa1d, 0x6b2232ce, 0x65706526, 0x000085bb, 0x91e6910b, 0x34eb6400, 0xee0bee12, 0x000051a6, 0xfd77fdc4, 0x89983966, 0x6b486bbf, 0x00008850,
+        0x3bff3b93, 0x07d4111a, 0x32a5328c, 0x0000269c, 0x6cfc6cea, 0xb7246565, 0x5ce95cbc, 0x0000a75f, 0x865686de, 0x917188de, 0x714b7177, 0x00007f8e,
+        0x83d1838c, 0xaa9ab0db, 0x547f5473, 0x0000850b, 0xb9ddb960, 0xad51fa98, 0x8b1b8b57, 0x0000563e, 0x6dbf6dc6, 0xa3c02428, 0x881f888b, 0x00001fd3,
+        0xee78ee6c, 0x900968a3, 0x1da31dd9, 0x000010dd, 0x9393930b, 0x6e2276d9, 0x38373801, 0x0000bbf1, 0x562556d5, 0x7afa10aa, 0x1004108a, 0x00001015,
+        0x98a698e2, 0xf1debdc8, 0xd19bd18f, 0x00009114, 0x56e65690, 0x93e9e3a0, 0xb708b7dd, 0x00007141, 0xeda1edcc, 0x5a38cc67, 0x5c3b5c33, 0x00009888,
+        0xf586f5f5, 0xdb503e31, 0xa99da987, 0x0000dfc4, 0x3917399f, 0xf11f8b40, 0xa69aa6ad, 0x0000c112, 0xf83ef809, 0x50e4bf87, 0xc7a4c785, 0x0000f362,
+        0x9a419a35, 0x19cb7519, 0x10ef10a5, 0x0000d91a, 0x02c102fc, 0xde5e12da, 0xb6b7b677, 0x00000aa2, 0x97ac97fe, 0x97af947a, 0x3ad83a08, 0x0000000c,
+        0x3dd83d3c, 0x87160d26, 0x54b5548a, 0x0000535b, 0x53f053dd, 0x019b38f1, 0x064106ed, 0x00008bbf, 0x309230a3, 0x9cc7e75e, 0xd179d147, 0x0000d5cb,
+        0xb21eb22f, 0x7c1a56b1, 0x2eae2e64, 0x0000ab08, 0x06cc06f6, 0xab02fd43, 0xd423d4b4, 0x00001ea8, 0xb2f6b250, 0x5094dd63, 0x6b4a6bf1, 0x0000db53,
+        0xc64fc657, 0xe47f95fa, 0xd743d71f, 0x0000145e, 0xe62fe635, 0x8e2704f4, 0x1a251a2a, 0x0000d8b7, 0x4b5d4beb, 0xa3f23f31, 0x9c1e9c75, 0x00000f63,
+        0x1c2c1c09, 0x3719df57, 0xce90ce9b, 0x0000c3a0, 0x8ce98c11, 0xe25225af, 0x12331283, 0x00009f87, 0xf51bf505, 0xbe977fc4, 0xbbbdbb18, 0x000067f4,
+        0x60ed60fd, 0xedf1e723, 0x6a2a6a54, 0x00003fbf, 0x03a20370, 0x02f9facf, 0x10b2107b, 0x0000d734, 0x03e303d4, 0x4699c6e1, 0x46cc46c9, 0x00002da4,
+        0x2a922a10, 0x8f988be0, 0x52ec52e5, 0x0000f373, 0x21ee2103, 0x20d2b5d0, 0x56035658, 0x00001d68, 0x11e5118e, 0x74d0cfd3, 0xaf6eafde, 0x00008150,
+        0xb32fb3ce, 0xaf3370ec, 0xd5dad53b, 0x0000ff63, 0x566e56f6, 0x11a5cbf3, 0x609360e1, 0x0000081c, 0xb415b43f, 0x4399cbae, 0x240e24ff, 0x00000eb3,
+        0xb8bcb86c, 0xf08c423b, 0x8828881d, 0x00003ecc, 0xcebcce71, 0x0bcb0ad4, 0x837a833d, 0x0000e06c, 0xfaf9faa2, 0x3c6032da, 0x54935463, 0x0000efb6,
+        0x696269d2, 0xf8953160, 0xa418a41e, 0x000056a6, 0x75e375ee, 0x1b3deacf, 0xd151d1f5, 0x000090c9, 0xcd96cdac, 0xa29fcd51, 0x382d3841, 0x0000da67,
+        0x16b21634, 0x9ea84279, 0x9d2e9d60, 0x0000c840, 0x491e498b, 0x347219ab, 0xe95de95d, 0x0000867c, 0xb1bab170, 0x50282a44, 0x4edc4eca, 0x00000163,
+        0x50da5086, 0xc32a46ad, 0x91ff91e3, 0x0000712e, 0x04cf048e, 0x55a76fc9, 0x9ccd9cfd, 0x00006d96, 0xa65ba6b7, 0x4226cbd3, 0xd432d4bd, 0x0000a764,
+        0x6ebe6e2c, 0x1bde4405, 0x5236520e, 0x00007d43, 0xa537a57a, 0x55623220, 0x0fe90fbc, 0x0000c453, 0x06e40667, 0xe80e9257, 0xc861c87b, 0x0000751a,
+        0x464146d5, 0x9bb35243, 0x901a9086, 0x00008463, 0xff21ff57, 0x5acb20e6, 0x95dc95a0, 0x00007dbf, 0x76df765e, 0x5c90fab3, 0xe155e1e1, 0x0000399d,
+        0xb6fdb61e, 0x162ff760, 0x292c29ee, 0x0000dc5b, 0xc1d7c1a3, 0x110503f6, 0x529052d7, 0x000048f2, 0x3aae3a31, 0x9549f053, 0x177e176e, 0x0000686a,
+        0xaedfaeb2, 0x651a39e3, 0x587b58c6, 0x0000b180, 0xda7dda69, 0x123a768d, 0xa099a088, 0x0000f452, 0x43dd4393, 0x11a554a5, 0xb343b3b0, 0x000049a9,
+        0xead0eaca, 0x43a71d6a, 0x7848785c, 0x0000c09c, 0xd815d8d3, 0xf3741302, 0x59f859aa, 0x0000aec0, 0x9b2f9b1d, 0xf5d3b747, 0xa3b5a32c, 0x00000b97,
+        0xb510b526, 0x5f32680b, 0x9a649a29, 0x0000fc72, 0x4520459d, 0xb03e0ddb, 0xfff2ffb6, 0x000093bc, 0x23752322, 0xd9bc7f72, 0x1db11dea, 0x0000bb79,
+        0xbe18be65, 0xd52e6bf4, 0x13ff1344, 0x00006b96, 0x4a234a55, 0xa1d08188, 0x59165991, 0x00001a93, 0x2d182d3d, 0x973889c1, 0x9c589c02, 0x00009d31,
+        0x360736f1, 0x4f36bcf8, 0x576e5757, 0x000034d4, 0xbd4dbdc1, 0x04952bc6, 0xb0c9b066, 0x0000ff63, 0x0671068c, 0xd54f6ee9, 0xd810d8eb, 0x0000b28e,
+        0xb8b4b81a, 0x3ef46658, 0xea92ea3d, 0x0000c393, 0x1d191d35, 0xdd7261d5, 0x83b383e4, 0x00001b45, 0x9894980a, 0x0684ce91, 0x83308329, 0x0000d817,
+        0xfde8fd32, 0x16c53496, 0x131913c6, 0x0000be62, 0x7f527f30, 0xb0b9bc48, 0x6d5d6df4, 0x0000b70d, 0x6a016a2f, 0x6ebf71ff, 0xbfbfbf1b, 0x00007f43,
+        0x3f3b3fe5, 0x2960fada, 0x9b629bbd, 0x0000fbfc, 0x262726f8, 0x3402acc0, 0x87f687ea, 0x00007031, 0x6c1d6c8b, 0x9728a1e0, 0x17e217e3, 0x0000c300,
+        0x81e08176, 0xf63d39bf, 0xf9c4f9de, 0x0000a29e, 0x2df22d81, 0x0b5cc3ba, 0x06e40648, 0x0000f7ba, 0xef11ef65, 0x34cdef13, 0x88e58808, 0x00000e83,
+        0xb9f3b942, 0x20b96d7d, 0x459c4574, 0x0000df21, 0x9d159d42, 0x5589e75d, 0x996f990b, 0x0000d5a5, 0xd63ed6c6, 0xc324054b, 0x522252c4, 0x00006d7b,
+        0x55ba557e, 0x90b32a74, 0xa34fa33f, 0x0000cf6d, 0x40ba4088, 0x47f9dc5b, 0x3874382c, 0x0000bfcc, 0x7bf77b8d, 0x870975e2, 0xca36caf3, 0x0000a155,
+        0x68bc6853, 0xc8459f54, 0x05aa058f, 0x0000fc29, 0xd63fd6d6, 0x236d88ac, 0xdd1ddd88, 0x00001c1a, 0x57c75767, 0x6c614b72, 0xd73cd7d5, 0x00007170,
+        0x58b1583a, 0x489f186a, 0xfd65fd0e, 0x0000baf3, 0x63a663e1, 0x4de8a935, 0xf422f455, 0x0000baee, 0xc197c1ac, 0xe662c489, 0xa613a667, 0x000026b7,
+        0xadc2adab, 0x8794ffc5, 0x7f167f75, 0x00002f63, 0x856485f2, 0xb6009c6a, 0xfb0cfb3f, 0x0000201a, 0xcdcfcd33, 0xe61e5472, 0x910191fd, 0x0000a58a,
+        0x146c1468, 0x29a292ba, 0xbdb5bdaa, 0x00004212, 0x74ee7432, 0x4526c3c0, 0x86718690, 0x0000475d, 0xbd21bdb0, 0xbe710785, 0xe4bee463, 0x00002903,
+        0x9cda9c44, 0xf69bcd05, 0x9343932b, 0x00005cd6, 0x42ea42ff, 0x34ceed35, 0xbe67bec7, 0x0000d23f, 0xa111a1b2, 0x21630034, 0x6a746a00, 0x00002536,
+        0xa63ca6de, 0xe580fbf9, 0x90a6903a, 0x00003507, 0xeaf0ea10, 0x5aaf9020, 0xe0fde06a, 0x0000cb8d, 0x9f839f5d, 0x0a5c7a3f, 0xd178d115, 0x00002ba4,
+        0xc055c0a9, 0x9eec1c29, 0x4e4f4e43, 0x000025ff, 0xd4dfd4f4, 0xa065e3a1, 0x08710816, 0x0000a2d9, 0xa168a1fa, 0x2fe87f79, 0x085608c3, 0x0000b3a8,
+        0x67e1678f, 0x598220eb, 0x72e472ee, 0x0000c840, 0x22a82222, 0x23f27af6, 0x0b1b0b1f, 0x0000f3b2, 0xca71ca55, 0x913dcca8, 0xad2fadd7, 0x00006ad4,
+        0xf59cf5b8, 0xf588a70b, 0xbe6bbe40, 0x0000660f, 0x9b3b9be0, 0x8a787d01, 0xb5b4b5ba, 0x0000b505, 0x730873a3, 0x71bca1d9, 0xf672f6d1, 0x0000d4f8,
+        0xa56aa52c, 0x7099f3fc, 0x6be76bfb, 0x00005324, 0xd2a9d28c, 0x2b7d1f5d, 0xb068b070, 0x0000a450, 0x2f112f4a, 0x22d25772, 0xac1dacd5, 0x00008b61,
+        0xdbebdbde, 0xca147256, 0x50d850c2, 0x00001b7a, 0xf4d5f4f2, 0xf11c649b, 0x12e01209, 0x0000a577, 0xa4efa464, 0xb31c39ce, 0x7aaa7a30, 0x00008bef,
+        0x93fa9339, 0xe2462f39, 0x3420341d, 0x0000d8b7, 0x3b883b1b, 0xda7ab662, 0x20bc200d, 0x0000e817, 0x85d5851b, 0xa383c0c1, 0xf805f869, 0x0000e878,
+        0x253c2596, 0x742aaef9, 0x88e78848, 0x00002786, 0x30383019, 0x8059f763, 0xd564d5b9, 0x0000534a, 0xa067a0ad, 0xfd1164d5, 0xb83fb820, 0x0000c2be,
+        0xfceefc03, 0xfa18560c, 0x8fbd8f66, 0x0000843d, 0x2a502aa4, 0x8c797150, 0x771e7797, 0x0000dd57, 0x127312dc, 0x6550b280, 0xc4a1c44c, 0x00000be2,
+        0x5b5e5bdd, 0xa2b468c5, 0xb781b72b, 0x00003340, 0x517e51af, 0x5457c565, 0x996f99a6, 0x00006f28, 0x12c41201, 0x9fe751dc, 0x5ba45b11, 0x0000a6d7,
+        0x39f73934, 0x568c182f, 0xaeecaeb5, 0x00008880, 0xb6f5b6ab, 0x65507b2f, 0x9447948d, 0x00005c50, 0x40244008, 0x905e43bc, 0x04150461, 0x0000c313,
+        0x8a7d8afb, 0xf457b65b, 0xb092b014, 0x000094f5, 0x7b6f7b56, 0x1a2128fc, 0x517e511b, 0x0000cd6c, 0x8dac8ded, 0xe9d392fa, 0x336e3334, 0x00008742,
+        0x82898269, 0x7aa2b660, 0x2adb2add, 0x00009b19, 0x30aa30a2, 0xdadb80fe, 0x54a35411, 0x0000ee37, 0xec2cec6f, 0x64af0ddb, 0x380d38d0, 0x0000edc8,
+        0x94a2940a, 0x882fa2ed, 0x591d59ac, 0x0000850e, 0x9b0c9b85, 0x323f8b62, 0xdc4adc1a, 0x00003cb2, 0x6923692d, 0xaca079b6, 0xd6dbd624, 0x0000f1aa,
+        0x88a388ee, 0xe6c15241, 0x2047200c, 0x00009434, 0xfe93fec2, 0x2b21da5d, 0xa129a1b8, 0x00008660, 0x4d2b4d36, 0x711a2d8e, 0x39b83991, 0x0000bdee,
+        0x383238bf, 0xafe5792d, 0xe2bde24b, 0x0000a33c, 0x9d749d42, 0xf86e48e9, 0xffaaff5b, 0x000000c4, 0xbb5fbbb3, 0xbab02c1d, 0x96f69641, 0x00004cf6,
+        0xd14dd108, 0xdc0eef42, 0x07f60713, 0x00009a00, 0xcb70cb92, 0xb74ba21a, 0xf89cf8fe, 0x0000acb8, 0x30663039, 0x1f655c67, 0x22f222fe, 0x00005306,
+        0xd503d5a3, 0x83375adc, 0xbe86bef0, 0x0000dc1f, 0x364336f3, 0xe5e234ee, 0xf148f116, 0x0000241c, 0xb522b56f, 0x5faf6fc9, 0xfc48fc2e, 0x000023f2,
+        0xb047b058, 0xfa59f760, 0x435243ad, 0x000021cd, 0xc7cdc7c8, 0xd244adde, 0xdf1adfd4, 0x00000820, 0x4a174aa1, 0x3fd80685, 0x52f452c5, 0x0000269c,
+        0xdcffdcd8, 0x660ce3ec, 0xafcaaf7c, 0x0000040c, 0x6b3b6bef, 0x78cd12b4, 0x34a334df, 0x0000ada6, 0x9b739b51, 0x28e0d17c, 0x55e955c8, 0x0000b7b1,
+        0xbe84be52, 0xc90dbbe9, 0x5db25dab, 0x0000bfbc, 0xf626f6ed, 0xabfd8733, 0xd25cd221, 0x0000b2df, 0xef0cef7f, 0x9a078fa0, 0x90939044, 0x0000ea28,
+        0xbe3fbe94, 0x104e6f46, 0x2394239a, 0x00009ac1, 0xaccbac69, 0x1f81c2e8, 0x7c877c1d, 0x0000588a, 0x73ab7333, 0x44865aa3, 0xb157b148, 0x0000231a,
+        0x3130310b, 0xd5b04935, 0x0a7a0ab6, 0x0000a2c9, 0x2e552e16, 0xfe260e5b, 0xbc90bce4, 0x0000c7f1, 0x2dd02dd1, 0x2b926863, 0xc4abc411, 0x0000d5eb,
+        0xf365f33d, 0x847e3e3e, 0xefeeefb6, 0x00000733, 0xb417b46b, 0x9e67a846, 0x842584c1, 0x0000cd69, 0x93fb9378, 0xee12becb, 0x2db82d6b, 0x000071db,
+        0xc026c03a, 0x76b275e4, 0x407a4034, 0x0000a95a, 0x0b080b87, 0x43362ce6, 0xd0bed0ac, 0x00000850, 0x92a7924a, 0xdd0dc5e8, 0x5e4f5ecb, 0x00008a90,
+        0x54a954fc, 0xff4b83fe, 0x80ca808f, 0x00008a45, 0x371437cb, 0x7985e605, 0x71067153, 0x00008bdd, 0xf12ef13e, 0xb8f925d6, 0xd482d4f2, 0x00008f56,
+        0xdbb0db32, 0xcefa7a44, 0x51f0516a, 0x000080a2, 0x500150a6, 0x42c5c59c, 0xb656b672, 0x0000f7d8, 0x9ae09aac, 0x931ccad9, 0x240d24d1, 0x00001845,
+        0xeb1debe4, 0xe8809329, 0x971597e5, 0x0000de1e, 0xa1a3a1b4, 0x52527da9, 0xdbfbdb59, 0x00000011, 0x06b10683, 0xe5e32e42, 0x99dd999f, 0x00007360,
+        0x1e821eba, 0x79e2ea4c, 0xd2a8d22b, 0x000074b1, 0xd0efd05d, 0x08e065a5, 0xd1edd124, 0x00008670, 0x67a16725, 0xab0ce8ce, 0x21912164, 0x000076ab,
+        0x592c5937, 0xd0ab58c3, 0x86b28633, 0x00008780, 0x8f518f64, 0xb5704aa0, 0x71d271cc, 0x0000b00c, 0x7a0b7add, 0x41ee9642, 0x3a3e3a1c, 0x0000100a,
+        0x1e2b1ead, 0xa6de3cce, 0xb79eb79d, 0x0000f0d2, 0x932f939c, 0xf7e960e3, 0x917091d9, 0x00008941, 0xa82ca8ec, 0x8d98c489, 0x0f940fd7, 0x0000a455,
+        0x8894888b, 0x1506ad4b, 0x580358b3, 0x0000830f, 0x55e2557a, 0x2521f925, 0xe666e604, 0x00004a8d, 0x50505007, 0x955349f0, 0xa7a7a781, 0x0000d6a5,
+        0x214d21c6, 0xd56f3df1, 0x561f56ad, 0x0000a245, 0xfa95fab3, 0x782bdce4, 0xf0e2f0fb, 0x00006996, 0x6fe96f89, 0x7075ed32, 0xfdcafdf7, 0x0000074f,
+        0xec1bec63, 0x906b8d4a, 0xbe1dbe5e, 0x0000bf4e, 0x74ae74bb, 0xb31366a4, 0x7784771a, 0x000027c6, 0xb538b5da, 0x42d602ca, 0xb7abb700, 0x00007251,
+        0x42904281, 0x08345c2c, 0xed58ed5c, 0x00008db1, 0xbfa7bfc5, 0xd531f3b6, 0x415a41e6, 0x000018ac, 0x838c837d, 0xedd3595e, 0x47cb471e, 0x0000be10,
+        0xf1dff181, 0x12fc3dce, 0x824b8219, 0x0000b105, 0x61b061c6, 0x7e55fbbd, 0x6dce6dc3, 0x00006eb8, 0x393d3982, 0xe32c2942, 0x13ac13ac, 0x00001253,
+        0x82738200, 0x04e49edf, 0x4a574a4f, 0x00005584, 0xb155b136, 0x1f816b48, 0x87708745, 0x0000faa0, 0xd60ad66a, 0x8cf8b5d6, 0xfb23fbbc, 0x00006224,
+        0x47584792, 0x6e9facbb, 0x25e42555, 0x0000bcee, 0x9a519a60, 0x5c1d1eda, 0x887388ed, 0x00006c99, 0xccc9ccd3, 0x060e05a5, 0x19331989, 0x00004a8f,
+        0xaf59af1b, 0x542dd3c8, 0xe850e8e3, 0x0000d2f8, 0x84f18450, 0x81375d50, 0x3d683d98, 0x00004c07, 0x57565773, 0x101cca9a, 0xa408a4a3, 0x0000b9ce,
+        0x3ead3e93, 0x44c60d9a, 0xe870e89d, 0x0000ec62, 0x312e31f1, 0xc385fd47, 0x14b3141a, 0x00008def, 0xb241b2c8, 0xdd19e422, 0xbe06be60, 0x00002aa4,
+        0x512d512d, 0x4b29d738, 0xa7ada734, 0x0000d13f, 0x815581ff, 0x998d3ece, 0x88a288d4, 0x00007351, 0x000a00ad, 0x2ae2030a, 0xbd42bde2, 0x0000d5ca,
+        0xd2d0d27a, 0xc0f54899, 0x23e923b4, 0x00005799, 0xc092c00d, 0xa4a39c61, 0x96c69666, 0x000095f5, 0xeb72eb43, 0x758e13e3, 0x205220b6, 0x00000362,
+        0x3cb73cdd, 0x5cb22abf, 0x4a404a41, 0x00004cf3, 0xe683e672, 0xcdfa87cf, 0xf731f7ff, 0x000017c9, 0x3439342e, 0x4ec976a9, 0xc317c33b, 0x000048d2,
+        0x4de14dee, 0xa07cabd1, 0xa8fba850, 0x000060af, 0x26f8267f, 0xd454b73b, 0xf0a4f013, 0x00003826, 0x640b6414, 0x150954cd, 0x3821389c, 0x00004fb4,
+        0xb461b4bc, 0x245291b0, 0xff77ff73, 0x000035ad, 0x60bc60f8, 0xd0b4c8d8, 0xe202e26e, 0x00004996, 0xfe35fec7, 0xbfdb4b68, 0xb064b0ca, 0x00005284,
+        0x224d2277, 0x142cd01a, 0x723872c1, 0x000050ab, 0xe1c4e1ce, 0x8a2647ed, 0xdacfda84, 0x00009df5, 0x140e149a, 0x64f1635a, 0x2eac2e85, 0x0000ada7,
+        0xf4c9f428, 0xc89aa654, 0xc1cfc114, 0x00000272, 0x229622f8, 0x1aaceacc, 0x1ad61a04, 0x00005cb5, 0x7f287ffc, 0x0235e7dc, 0x1c751cc3, 0x0000adf9,
+        0x3f283f14, 0xce47e945, 0x9d5e9dd5, 0x0000e3cb, 0x8e108e22, 0xadc26d46, 0x4b8d4b37, 0x00008a18, 0x4a2a4ada, 0x8bc75b82, 0x706870a8, 0x00007cfe,
+        0x0177015d, 0x47d13492, 0x144d14cc, 0x00002a49, 0x9f669f25, 0x4195fc42, 0x17e3179b, 0x0000fdec, 0xb88cb85f, 0x156a1afd, 0x74fc7410, 0x00007ff9,
+        0x7a607ad3, 0x3376ff4e, 0xfb5efbd0, 0x0000b246, 0x9ef89e21, 0x4d9e96be, 0xa2bca2ac, 0x0000135e, 0x21eb217a, 0x1ec9d973, 0xb375b320, 0x0000b25e,
+        0xa108a1fb, 0x2213b948, 0x6764678b, 0x0000fc65, 0xf45bf4c7, 0x123924eb, 0x45c845c9, 0x0000c613, 0x10b01076, 0x763f0886, 0x834a8399, 0x0000a718,
+        0xc538c56d, 0x8c6082cf, 0xe144e1fb, 0x0000df0b, 0x5c965c86, 0x1a81d211, 0xf102f11e, 0x000064b1, 0x6f696fe0, 0x2805438f, 0x2cc22c9e, 0x0000b096,
+        0x6a416aee, 0x64f0e55d, 0x0614067e, 0x00005654, 0xaf6eaf89, 0xd9c9b6ea, 0xc5ccc522, 0x00007f8f, 0xeb50eb20, 0x0144ab7c, 0x9f539f98, 0x000070da,
+        0x79b9793d, 0x9996ab40, 0x832683dc, 0x0000b22c, 0xb144b18e, 0x3ac37566, 0x1c211c53, 0x0000a907, 0x157815d6, 0x0464b825, 0xde6fde3a, 0x000022f5,
+        0x2c812cc2, 0x88467e16, 0xbac9ba66, 0x00009940, 0x5a795aa3, 0x1c48d635, 0x9f1f9f5c, 0x0000d6a7, 0xc40cc495, 0x3f980ca6, 0x494a4954, 0x0000cdf0,
+        0xf913f986, 0xb67123d4, 0xc2e9c2b8, 0x00008e22, 0x131813f3, 0xa31a972a, 0x9c519c5e, 0x0000b6d7, 0x1ea31ed8, 0xf8773769, 0x131013c2, 0x00004fcc,
+        0x7eb97eb9, 0xdd389639, 0xe877e8a9, 0x000088f2, 0x68e968c9, 0xac5fd99e, 0x0686068b, 0x0000c4c4, 0x474d4796, 0xab14e583, 0x9b6d9bb7, 0x000049a9,
+        0xdf0bdfe2, 0xd1920f01, 0x2c452c02, 0x000072e4, 0x5d965d80, 0x47aee31e, 0xf18af1e9, 0x0000a485, 0xc3dbc3f3, 0x175136d0, 0x2d4f2dbd, 0x0000c227,
+        0x1ee31ef5, 0x3a912a29, 0x8a388af4, 0x0000701b, 0xa674a61b, 0x8df8fb39, 0x95d4959d, 0x0000dd40, 0xe2cfe2f1, 0x6bcdccb1, 0x3d103d1f, 0x00000de6,
+        0x2109217c, 0x067bdba6, 0x46c946cf, 0x0000aed9, 0x71e071bb, 0x82163076, 0xb02ab002, 0x0000858f, 0x427e4256, 0xc4078c65, 0x222a22a7, 0x000059fb,
+        0xc895c8b7, 0x0e0813e6, 0xb19eb1d8, 0x00006df4, 0x71497165, 0x47a61386, 0x9d0c9d05, 0x00006e51, 0x1b001b37, 0x74259a4e, 0xd80ed8ac, 0x0000c8b5,
+        0x042b043f, 0xc7eb15c1, 0xbce4bccb, 0x0000a018, 0xe90fe9f1, 0xed793992, 0x84648497, 0x0000e8ad, 0xade1ad75, 0x688f0ed9, 0x277d27f7, 0x0000da66,
+        0x33303380, 0xf09b49d1, 0xab11ab4a, 0x000078fe, 0x37593711, 0xf1df65e5, 0xf576f535, 0x0000bd63, 0xb0f0b050, 0xe18afc7b, 0x078a0711, 0x00006aaf,
+        0x4aa94a65, 0x3c9a6d38, 0xda19dad9, 0x0000d349, 0x24a22431, 0x56ece94d, 0x7687761f, 0x0000cd34, 0x4b6f4b12, 0x4c5fee80, 0x17b4179b, 0x0000648b,
+        0xba0ebaa9, 0x5875e06d, 0x7f357f6c, 0x0000d026, 0x16201604, 0xe1231ce1, 0x627a62db, 0x0000c612, 0x2ce12cdd, 0xfbcf35e3, 0x5c255cc0, 0x0000edbb,
+        0xa5ffa573, 0xa06570d1, 0x5aa55a10, 0x000078ff, 0xa918a99c, 0xde545efc, 0x5500557d, 0x00008739, 0x23382331, 0x39fd7da9, 0xda69dacf, 0x00009f31,
+        0xcb45cb8a, 0x29c07d50, 0x51d051cf, 0x0000b2d3, 0x43cc43ec, 0x5c1dcfa9, 0x4f0d4f64, 0x00000d71, 0x5b255b39, 0xbc992515, 0x1c651c6a, 0x0000d377,
+        0x1fb81f59, 0xcd2520eb, 0xd803d864, 0x000083af, 0xedb1ed4a, 0x42b91bd2, 0xc0aec0c5, 0x0000933f, 0x25b125ee, 0xad51798a, 0xaa01aada, 0x000012a5,
+        0x21762122, 0x20b0fa9d, 0xbdddbd39, 0x0000ae85, 0x9ff29faf, 0xe420a93e, 0xeb2beb6e, 0x0000e7c2, 0x1ac71add, 0x3fc3cf34, 0x8cad8ce1, 0x00006300,
+        0xd010d0fc, 0x98e66a05, 0x2942294b, 0x0000c810, 0xcfb2cfb5, 0x1c81aee0, 0x6c686c99, 0x0000b409, 0xcee6cec9, 0xc9647f41, 0xf8d1f8d5, 0x00005e6e,
+        0xc0cac0ac, 0x28e858d9, 0x8f7e8f3e, 0x0000438f, 0x5c175c85, 0x998d8c61, 0xce4ace52, 0x000023ff, 0x99df99e9, 0x3a2f0d43, 0x43c0439c, 0x00001f53,
+        0x47a9474f, 0xd2eb36e0, 0x2f022f66, 0x00000972, 0x8e2a8e28, 0xe9a36268, 0x3620366a, 0x00000863, 0x28c2282c, 0x593265da, 0xb726b7c4, 0x00003241,
+        0x378f3799, 0xae5ba25c, 0xeb93ebe2, 0x00001165, 0x081b0869, 0x081c5ae0, 0x62056286, 0x0000f21d, 0x7dbc7dc0, 0x8d6776f2, 0x0d060d9f, 0x000096e0,
+        0xd113d12e, 0xa851e6f4, 0x626d628f, 0x0000d875, 0x9493940b, 0x666089ef, 0x5fb05f81, 0x000005fd, 0xb9d7b9d8, 0xcac4c65c, 0xf10af1d7, 0x00004eba,
+        0x0d260dc9, 0xd7ebf5a3, 0xc8a1c880, 0x0000a02a, 0xd7bed7eb, 0xd9bcbc37, 0xbdb2bd8d, 0x000023cb, 0x9f7c9f58, 0xd6926f48, 0xaeb7ae23, 0x00001ae3,
+        0x0e2d0ecb, 0x18de07bc, 0xb1e8b18a, 0x0000f282, 0xc7efc70c, 0x0cc21d28, 0xd9d4d9c6, 0x0000a076, 0x659d6561, 0xc65b6842, 0x9570952f, 0x0000fc1a,
+        0x42644275, 0x7e2a14bc, 0x8c988c83, 0x000037f0, 0x37023715, 0x4fd6216b, 0x69006960, 0x0000fdbe, 0xbfc6bf1e, 0xdae5f3ad, 0x727d7212, 0x0000e5a5,
+        0x7e527e0f, 0xa061df97, 0x259e25f8, 0x0000155e, 0x31d331dc, 0x0144ee2c, 0xb62fb6b7, 0x00001e24, 0x3fc63f20, 0xb88b6f2b, 0x8988893a, 0x0000a195,
+        0xb39db344, 0x240f458d, 0x2e042ed4, 0x00004f43, 0xacfbac22, 0xf7e96176, 0xdb05db42, 0x00005489, 0x9e319ee8, 0x6d7dadc0, 0x08eb0843, 0x00008d69,
+        0xedd5edcf, 0xce4620ee, 0x1fad1fe2, 0x0000dbd4, 0x3fb93f57, 0xe3214fcf, 0x03ab0349, 0x00001f53, 0x760a76f3, 0xc2f5c0c0, 0xf551f5f4, 0x000065e1,
+        0x56b8562a, 0x7c9240bc, 0xa37fa336, 0x00009e45, 0x7c8f7c8a, 0x3aa0b52e, 0x7892782b, 0x0000434f, 0x323f3243, 0x7bd9aa1a, 0x0707079f, 0x00005e6e,
+        0xc1c2c1e6, 0xb3a3d3d4, 0x51735124, 0x000007fc, 0x5b6c5b17, 0x5c90272b, 0x7b9a7ba4, 0x00006ae1, 0xe556e593, 0x45a691fe, 0x6c586cbd, 0x0000be11,
+        0x7fa87fad, 0x80c856fc, 0xb321b339, 0x000079cf, 0x77c6773e, 0xbe996c39, 0x992c99b0, 0x00007ef8, 0xdaadda9a, 0x20c03339, 0x3d5e3d13, 0x0000741f,
+        0xbd48bda2, 0x8ec73ce0, 0xd19fd121, 0x0000817f, 0x067b0659, 0x64bb0f80, 0x534e5350, 0x0000f263, 0xd87cd8c7, 0x370285f3, 0x8cac8ce7, 0x00009a3e,
+        0xf3c9f398, 0xc35dc5c1, 0xcfd8cf0a, 0x000065b5, 0xec7dec9e, 0x08bd12f3, 0xc998c9d2, 0x0000e924, 0x0a060a4f, 0xe8207510, 0x90d19039, 0x00001ec3,
+        0x083b0857, 0x02c4548d, 0x630d6332, 0x0000af99, 0x21202158, 0xc55e0274, 0xda6fda89, 0x0000ab64, 0xd480d4c5, 0x542db7e9, 0xf375f354, 0x00009e05,
+        0xf6dff653, 0x8978c80f, 0x465846fc, 0x00003c0c, 0x7587754f, 0x142dba35, 0xb029b004, 0x00002456, 0xee11ee97, 0xd704a5d2, 0xb597b511, 0x0000d8ee,
+        0x7f527ffc, 0x5bc83a30, 0x3d983d46, 0x00008ada, 0x8b908b9f, 0xfcc58997, 0xfaf4faa4, 0x0000c1fb, 0xd3cdd375, 0x23d2824c, 0xf258f211, 0x00007e5e,
+        0x8a798a8e, 0x1905bdf6, 0xb45db453, 0x0000edf6, 0x8ebb8ec0, 0x2ea22dcb, 0xfcf8fca3, 0x000024f5, 0xd94ad987, 0x26598b2e, 0x2f902fd5, 0x0000c845,
+        0x97db97ca, 0x3a50cf30, 0xed7bedfc, 0x000026ba, 0x48f748ed, 0x17da39df, 0xb72db7ba, 0x00009a8a, 0x535f5325, 0x30b2f560, 0xb917b993, 0x00003f3a,
+        0xc3d8c3bf, 0x349a2dfb, 0x6e756e00, 0x000099ae, 0x1fcd1fc8, 0x23ae3682, 0x324b3235, 0x00006717, 0xafa3afe6, 0xfce1d6cb, 0x963e960f, 0x00006fd0,
+        0x63dd637b, 0x1b6bb158, 0x5e9d5eb7, 0x00002a04, 0xb7edb788, 0x972cf1ac, 0xcb3fcb62, 0x0000f1e3, 0xbd13bd1c, 0x77fe3a21, 0x39483931, 0x0000fabc,
+        0xe897e817, 0x88f85471, 0xc197c1c9, 0x000028f9, 0x40cb408e, 0x7908c23c, 0x2e262ef0, 0x00003e12, 0xefb4efd1, 0xcb18b440, 0x628262c0, 0x0000c6cf,
+        0x5add5aa1, 0xbf6da8bd, 0x86528654, 0x0000482d, 0xb038b0ae, 0x6fff0774, 0x6fd06f7a, 0x0000ba21, 0xbfbbbfe2, 0x6cbf0037, 0x8213824a, 0x0000a899,
+        0x347f3445, 0xff4fea0c, 0x046604dc, 0x00005506, 0x876a87f0, 0x632288e1, 0xd328d3e8, 0x0000bd5d, 0x8917896e, 0xec818682, 0xd0f3d093, 0x00006384,
+        0x2f162fcd, 0xc99a2b39, 0x9fa69fba, 0x00000205, 0x44d6441d, 0x22f0342f, 0x96409611, 0x00001a03, 0x7f117f5c, 0x066320d6, 0xc666c67a, 0x00005ab0,
+        0xc30bc3c9, 0xf2cccfce, 0xe415e491, 0x0000f823, 0xf2a3f284, 0x1cca65e7, 0x10f31092, 0x0000f718, 0xc863c821, 0x051d18d1, 0x375e3791, 0x0000e2e2,
+        0x22f22275, 0x776f9116, 0x99209990, 0x000082ff, 0x5a665a17, 0x920a3412, 0xc4aac4b6, 0x00000c1c, 0x453f45c6, 0x5822675e, 0x9ccf9c72, 0x0000f690,
+        0x7b397b11, 0xce5592bd, 0x6a046a4a, 0x000021ea, 0xe488e4e8, 0x5ad8a265, 0xf57df50e, 0x00000572, 0x23ff238c, 0x75cdf769, 0x75137592, 0x00007cee,
+        0xff9effa1, 0x9cc40ca1, 0xbd6bbdc8, 0x000092d5, 0xab09abec, 0xb48e9f55, 0x7aa57a47, 0x00008263, 0x2df92d35, 0xfa111782, 0x42c04214, 0x00004d7d,
+        0x02a4020e, 0xfcce6c2d, 0xdc48dc18, 0x00000570, 0x32cc32d2, 0x76ed0e5a, 0x59ae5967, 0x0000f3f1, 0xefdeef1f, 0xfe284fad, 0xd326d3fa, 0x00005299,
+        0x21ea21d8, 0x0134de50, 0xcccecc92, 0x00009101, 0xec40ecd7, 0xfe4c01c8, 0x719b714d, 0x00004b2f, 0xf558f523, 0x8d175fd3, 0xe7b2e7fc, 0x0000c0f2,
+        0x06b906a0, 0x6edf4499, 0x8141816f, 0x00006ea6, 0x12ed12f3, 0x9316840f, 0x8a888a31, 0x0000616a, 0x85138521, 0xd9bebc4b, 0x4ac14a79, 0x00006678,
+        0x212f21f3, 0xdd67b7d6, 0x5f255f4c, 0x0000a5e8, 0xcce3cc2c, 0x7a0974ed, 0xf18bf12e, 0x0000d7a5, 0x91a59142, 0x3c739361, 0x604d604f, 0x0000170a,
+        0x50245038, 0x3fce32e0, 0x068906e3, 0x0000d6a8, 0x024502ff, 0x17554747, 0x3b693b99, 0x0000f6ce, 0x67cf6730, 0xe3dd0fa6, 0xc81dc8f9, 0x0000591c,
+        0xdf18df93, 0xc2b541bd, 0xb0f5b009, 0x0000eb16, 0x2e362ecb, 0xd34fa9bd, 0xbda0bd18, 0x000027b8, 0x50855058, 0xd954b5f8, 0xfd34fd9d, 0x000037ab,
+        0x55ff55c6, 0x347080f1, 0xb697b636, 0x00008cf2, 0xa71ba75d, 0x87c4de2c, 0x34fb3447, 0x0000b4b5, 0x26e9266f, 0xd82d77a8, 0x4d254d73, 0x000094bc,
+        0xb66eb64b, 0x0a5cca59, 0x1d631d22, 0x00002a04, 0x69e769b7, 0x99a684ec, 0xc9c5c976, 0x0000a1ce, 0x0684065c, 0xea20d210, 0x6a5c6ae2, 0x00009901,
+        0xdb29db9e, 0x45662880, 0x5b915bd7, 0x00006931, 0x611061bb, 0xb1005922, 0x87a78703, 0x000064c9, 0x1cac1cd5, 0x126436ad, 0x3d593de5, 0x0000e61b,
+        0x3e2a3ec0, 0x304ed474, 0x3e9d3e6c, 0x0000e345, 0x3ebe3e9b, 0x17a79bc8, 0x93169323, 0x00007881, 0x63336392, 0x9b57f8f4, 0x6aaa6a8e, 0x0000f1f1,
+        0x2c2c2c57, 0x959198ae, 0x0bea0bf7, 0x0000c90b, 0x564b5655, 0xca18982a, 0x1736177a, 0x00001a33, 0x3d463d0d, 0xde203c78, 0x24c8242d, 0x00004ca8,
+        0xd5bed5f6, 0x6400f7c9, 0xef37ef5b, 0x000034d4, 0x833f832f, 0xf551b1a0, 0xaf3aafa9, 0x0000b41d, 0x97cd97f2, 0xe8b3bfcb, 0xfb65fba6, 0x000020ad,
+        0x0b820b9a, 0xf53d5d95, 0x73217302, 0x00005d77, 0xad42ad81, 0x0c5c675c, 0x8fba8fd6, 0x0000b94e, 0x04ce040c, 0x3ddb6322, 0xe43fe4e7, 0x0000370a,
+        0x4c034c70, 0xe9d382b1, 0x41a641ee, 0x0000b8d0, 0x276a27f6, 0x635b1a0c, 0xed79edc1, 0x0000fb52, 0x4678460d, 0x6e229745, 0xe3e1e3e5, 0x00001128,
+        0x3e393ea8, 0x82796702, 0x56a7564d, 0x0000a1d7, 0x9ea09ecf, 0xd1db3b4c, 0x240d241f, 0x0000a864, 0x56bb56a8, 0xb3e2732d, 0x17421761, 0x0000f1f1,
+        0xad92ad72, 0xefd3af88, 0xd94fd91b, 0x0000ba91, 0x106710a3, 0x6d9f4046, 0x755f7561, 0x0000ad86, 0x69dc69a0, 0x246d20af, 0x172e17f2, 0x000035ae,
+        0x463d46d6, 0x754d2d79, 0x456345ef, 0x000013bf, 0xde7ede5e, 0x4378a600, 0x29fd29b2, 0x0000bdbc, 0xa7c7a763, 0xc72a1275, 0x04450475, 0x00002864,
+        0x12691242, 0x2f032a45, 0x18221896, 0x0000b3d7, 0x6bba6beb, 0x632268ca, 0x9810988a, 0x000053fb, 0x9ae29a1c, 0x33610757, 0x957d9543, 0x0000ef17,
+        0xd213d266, 0xcb18ac48, 0x0caf0cca, 0x000003a0, 0x58cc584a, 0xbdc04731, 0x8e028e19, 0x0000c4b2, 0xbb45bb66, 0xa7512cb0, 0x48324890, 0x00004b42,
+        0xcbbccbab, 0x9d91f200, 0xda1bdacb, 0x00003406, 0xe1d3e146, 0x62501d53, 0x58445844, 0x000005fc, 0x4f124ffd, 0xde5eb974, 0x82f98216, 0x00003b26,
+        0x846284ba, 0xcaebd8e6, 0xebd0eb3d, 0x00008bda, 0x7db67d9a, 0x78dde9fd, 0x73df73fb, 0x000095af, 0xea7feaab, 0x6cdf4278, 0x0be50bf7, 0x00009397,
+        0x826182a5, 0xb22ae051, 0x64416492, 0x0000928a, 0x20182025, 0x62c34fa8, 0xb6acb6ef, 0x0000ec16, 0x054d05fd, 0x883697c4, 0xc90ec92e, 0x00000ec9,
+        0x8fdf8fd8, 0x3f8a7a46, 0x02e30299, 0x00009577, 0x51d0518a, 0x658de3c2, 0x92f1921a, 0x0000412f, 0x88458899, 0xd0b4be5c, 0x062d0656, 0x00002f9a,
+        0x45d04584, 0x8d06b272, 0x9b639bc3, 0x00004e48, 0xd2b2d2f7, 0x86c0e269, 0x7ed87e68, 0x0000a859, 0x46d846a4, 0xdbb0f6e5, 0xe81ce8a5, 0x00004977,
+        0x37233738, 0xcf488f5e, 0x205020aa, 0x00007a0e, 0xd701d742, 0x0c34601c, 0xc6f6c617, 0x00001a2a, 0xeb91ebc8, 0x8760ef1d, 0x84ba8491, 0x0000d659,
+        0x90889086, 0x77120341, 0xb9a9b9c9, 0x00000583, 0xe780e796, 0xb87146db, 0x68be6898, 0x0000fc5f, 0xa9d9a926, 0x93b35d38, 0x6eb26e67, 0x0000f9ec,
+        0x213d2105, 0x4f26e972, 0x992499c7, 0x0000d867, 0x7910796d, 0x26872faa, 0xce03ce48, 0x0000a1dd, 0x08c1087e, 0xdbef315d, 0x73047376, 0x00006335,
+        0x93c9932c, 0x76556f2d, 0x830a836c, 0x0000ec96, 0xa2c6a2c5, 0xce254033, 0x8b648bb2, 0x0000a808, 0xc225c242, 0xf0731501, 0x760b76d9, 0x0000b813,
+        0xae6caec5, 0xee7d8dec, 0x426242e6, 0x00006b15, 0xa2eea2a7, 0xe33167da, 0x55be554e, 0x000067e8, 0xf441f4e0, 0xf45f9544, 0xd357d332, 0x00006fca,
+        0x5f0f5fe4, 0x98f1ca21, 0xef0cef32, 0x0000ddfb, 0x3e343ea3, 0x2db80485, 0x20aa208d, 0x00001fa5, 0xd06fd0ac, 0x99dcc4fe, 0x096a09ee, 0x0000e90a,
+        0xee09eeb1, 0x1b1f9bca, 0x4b934b0d, 0x0000d51d, 0xaa5aaabc, 0xd2402657, 0x6f9d6fc5, 0x0000a95a, 0x24742464, 0x8404df69, 0x60f460b1, 0x00002c0a,
+        0x487e4865, 0x6aea45db, 0x92ce927f, 0x00006486, 0xbb91bb50, 0x702b246b, 0xe313e392, 0x000087be, 0xc71bc786, 0x32b2cad2, 0xa20da21a, 0x0000f1f9,
+        0xa3aea395, 0x532d712a, 0xc72dc775, 0x00004aed, 0xd9ecd9c1, 0x2a667ccd, 0x6e1a6ed9, 0x0000e503, 0x437f4350, 0xa0813cff, 0x240f2437, 0x00005e6e,
+        0x751d75aa, 0x11aae8d3, 0xd801d839, 0x000028a4, 0x02e50204, 0xcbe73c7f, 0x4dd84d7c, 0x0000c2a0, 0x7aeb7ab3, 0x05665923, 0x3de83d85, 0x000074f3,
+        0xdcb1dc10, 0x077b9952, 0x0c0a0ce6, 0x0000f99e, 0x1b621bbe, 0xe243e49d, 0xe059e01d, 0x00004ed2, 0x749774bb, 0x080a2906, 0x1c961ce2, 0x0000b33d,
+        0x9f269f84, 0xcda41640, 0xab83ab50, 0x000046be, 0x4d984d84, 0xe15cb15f, 0xb20ab2bc, 0x000019b3, 0x26e92622, 0xe6c01c32, 0x3b383b0c, 0x00008bef,
+        0x361c36c3, 0x56521baf, 0x53a153a0, 0x00005f2b, 0xae7baee6, 0x40f588d1, 0x421342b8, 0x00002c57, 0x4ab34a2d, 0xcf4843fa, 0x1609168d, 0x000041d2,
+        0xec4eec73, 0x089cd6cb, 0xbc22bc17, 0x00004942, 0xfed1fee5, 0x6ec3b695, 0x6d916d3d, 0x00000162, 0xb5d5b550, 0x08345cc6, 0xe4f7e4fe, 0x000000d3,
+        0x9afc9a92, 0x6ffd0da6, 0x0d540d3e, 0x0000a2ba, 0x6676662a, 0xdb2ea11a, 0x3df93d0d, 0x0000b5cd, 0x025802c6, 0xa4a1b717, 0x8d518de1, 0x00003ce2,
+        0x92a89211, 0x28527385, 0x32583216, 0x0000bde5, 0x60f360ac, 0xc6ca0a3e, 0xb77db7aa, 0x0000d9ca, 0xda8fdae4, 0x4aa75283, 0xf9a5f913, 0x0000d6cb,
+        0xcfe2cf1d, 0xe662c0fe, 0x934593ba, 0x0000300a, 0xe6dbe67c, 0x87964e8b, 0x4b6d4bac, 0x0000ae85, 0x70ee70a6, 0x82e9b8c8, 0x3161313c, 0x00001188,
+        0xf80af831, 0x731a1d5a, 0x80368073, 0x000087b2, 0x6a226aef, 0x1da9f26e, 0xb9aeb939, 0x00009a90, 0x9e289e10, 0xd0c9712f, 0x887f88a0, 0x000027ff,
+        0x62e36275, 0xbd1b41c4, 0x5b775bb6, 0x0000348d, 0xc428c4ea, 0x8e071f67, 0x32cf3271, 0x000035c4, 0x74be7444, 0xd2d404c8, 0xe857e8ec, 0x0000d387,
+        0x266926f6, 0x9a067b56, 0xbc45bcae, 0x0000f993, 0x49eb49aa, 0xf66e1953, 0x74e3743a, 0x0000905d, 0x27d527a4, 0x570dd17f, 0xbb6cbb85, 0x0000d265,
+        0xac0fac2b, 0x089dd739, 0x020902c6, 0x0000d91e, 0xebadeb15, 0x95b62629, 0x35bc35fd, 0x00007e9d, 0xf889f866, 0x0a5f47c8, 0x75477568, 0x0000be11,
+        0x8bca8bb1, 0x6ea0cc0e, 0x94ac9433, 0x00003a8c, 0x1ae71a51, 0x13f933df, 0x504350fc, 0x00002756, 0x642564cd, 0x65d20aa6, 0x757c750d, 0x000033ab,
+        0xb034b052, 0xeadaf7e3, 0xea58eaf4, 0x0000c3ec, 0xe60fe6f8, 0xd2dbd826, 0xe20ae2a1, 0x00007f06, 0x53525354, 0xb3922a26, 0x5a5a5a58, 0x000075a9,
+        0x9e039e83, 0xa3c298b5, 0x27f32751, 0x0000f0ec, 0x05a70580, 0x33c32c1b, 0x99509959, 0x0000bdf1, 0x8ef08eb0, 0xaa0d7937, 0x4c7d4cdf, 0x00004ba8,
+        0x06f206e7, 0x774a54cc, 0xa4f1a42a, 0x0000c2a2, 0xb41cb497, 0x514249d7, 0xdc83dcfd, 0x00007cdc, 0x6f006f73, 0x53d88e0f, 0x9b559bc6, 0x0000f7d8,
+        0x22c22291, 0xfbceffc6, 0x1b521ba7, 0x0000fb72, 0xf309f38e, 0x791aa62d, 0x9ec99e6f, 0x000018e6, 0xc569c518, 0x1638f9d9, 0xa8c8a87e, 0x00009850,
+        0xd56fd527, 0xc5357ec0, 0xce5cce18, 0x0000edd6, 0x562756d4, 0x5253d94d, 0xf6b8f621, 0x0000d43b, 0x07de0722, 0x181a2456, 0x3426349e, 0x0000e958,
+        0xd650d6d7, 0x0c2b1c9e, 0x3e163e09, 0x0000b891, 0xae2dae93, 0xcfdbe932, 0x8b7e8b97, 0x0000139b, 0x157015df, 0xb1df65e4, 0x1e8c1e2e, 0x000062ae,
+        0x87e387fe, 0x9c79d977, 0x7fd67f22, 0x000090d7, 0x649f64ce, 0xd86ba83f, 0x355d3531, 0x000035ac, 0xe513e559, 0x677be83d, 0xb8bbb82a, 0x00006f7a,
+        0x46a146de, 0x29c2ea0c, 0x473547d8, 0x0000dbeb, 0x261e2605, 0xb61a110a, 0x4d1e4d1d, 0x00004957, 0x04e20490, 0x8adf6fc9, 0x8b8f8bc9, 0x00007ffe,
+        0x59da59a4, 0xec0e0f01, 0x16841635, 0x00005475, 0xd69fd69d, 0x10778231, 0x6944696a, 0x0000455d, 0x7769777c, 0x8b7851d2, 0x27842766, 0x000052e8,
+        0xf7dbf7dd, 0x4630ccce, 0x7af57af3, 0x00005ee8, 0xc45fc4cb, 0x95e6526c, 0xd99bd921, 0x00002353, 0x5fd25fd0, 0x0d7d7451, 0xcff5cfba, 0x0000e3b1,
+        0xe13ae106, 0x43f688df, 0xad72adde, 0x0000051b, 0xacfaacaa, 0x4b05c5d3, 0x40c640b8, 0x000011d5, 0x930e9339, 0x57828cfe, 0xf50ef53d, 0x000032d4,
+        0x7030705f, 0x5a4f4ce9, 0xb98bb9ac, 0x000033f3, 0x340934bd, 0xe5808fa1, 0xe270e283, 0x00003f33, 0xb51fb5a9, 0x555d9ddf, 0x918f9143, 0x00008ae4,
+        0x6c0c6c2f, 0xeef222dd, 0x89fc895c, 0x0000f26b, 0x0cbd0c2e, 0xcc85a4ac, 0x11181178, 0x000089c3, 0x2dbb2d17, 0x80812ac6, 0x0f510f22, 0x000010e8,
+        0x035e037d, 0xc37caf2d, 0x394439f0, 0x0000be8e, 0xae7dae8b, 0x1dd704b7, 0xef45ef04, 0x00002d9b, 0x9dcd9dd2, 0x10aa1b2c, 0x3030301f, 0x00003fb0,
+        0x33c1330b, 0x5bed197e, 0x178b17f6, 0x0000ff01, 0xe620e6c1, 0x01878a4f, 0x1bef1bed, 0x00006ebc, 0xf1ecf175, 0x6af0d863, 0x751a75b0, 0x00003082,
+        0xfe54fe81, 0x97e9675a, 0xe6ffe647, 0x0000574b, 0x76027611, 0x545256cd, 0x2c5d2ca9, 0x00000540, 0x4bc44bb0, 0x605853f0, 0xde44de40, 0x00007b51,
+        0x08f708ee, 0x20d2550b, 0x657265ae, 0x00006791, 0x7112712e, 0x93938f21, 0x54a95415, 0x00000a2f, 0x75407522, 0x3f198d74, 0x178017f2, 0x0000ba91,
+        0x213521dc, 0x75b18dde, 0x86908695, 0x00006ebc, 0xf6f7f635, 0xbe6c50dc, 0x3c5e3c15, 0x0000c7ce, 0xa70fa784, 0x78676452, 0x23e323bc, 0x0000d30a,
+        0x501b50a4, 0xfcbc2fa2, 0x13e613e3, 0x0000b0e6, 0x12ef12aa, 0xf959413b, 0x3a393abe, 0x000080ff, 0xa17ea1b7, 0xbd03228b, 0xba31ba0e, 0x00003f33,
+        0x3ece3e91, 0x3448cdee, 0x27a327b0, 0x0000edf6, 0x232623f4, 0x0e048d84, 0x71b07180, 0x0000f254, 0x8aef8a15, 0xcae758df, 0x42934241, 0x0000091c,
+        0x069106a0, 0x6d7f2454, 0xe53ae58b, 0x00000963, 0x7f287fa4, 0x1cdab747, 0xb335b3ef, 0x0000cbaf, 0xfc85fcaa, 0xe8c15573, 0xad82ad43, 0x0000ba10,
+        0x5bba5bdc, 0x8c84defb, 0xe66ee6b3, 0x00009615, 0x25ac2540, 0x02a4eab0, 0x0f280f80, 0x0000a493, 0xb251b2a7, 0xfaee42fb, 0x8c608c8e, 0x00008ae4,
+        0x86ef867f, 0x63d1ac51, 0xd15ed17f, 0x0000b5cc, 0x7a527a7e, 0x8ce34ce9, 0xecdeec65, 0x0000bf9c, 0xbb18bbc2, 0x9268a903, 0x58fe5816, 0x00007756,
+        0x03980356, 0xa01a74ba, 0xfe2cfe17, 0x0000dbd5, 0xd113d171, 0xb88459dd, 0x31f43151, 0x00001298, 0xbc19bc24, 0xd8ab30f2, 0xa9cda963, 0x000099a8,
+        0xfdcefdc4, 0x3ab882fe, 0xab9dab8e, 0x000066c8, 0x68da6897, 0xf5031395, 0x401b40bf, 0x000000cf, 0xa1d5a1f5, 0x8237372f, 0x828882f3, 0x00003113,
+        0x55a7555f, 0x2a16ea0c, 0xf298f229, 0x0000d23b, 0x48f4486e, 0x410547ee, 0xcc0fcc2f, 0x0000049e, 0xc316c37b, 0xf948f8c5, 0x89ff895d, 0x000089c3,
+        0xdc7adc6b, 0x09e2a3e0, 0x2e562ebd, 0x00000aab, 0xb466b453, 0xff4f58a3, 0xce08ce1f, 0x00000cca, 0x873b87f6, 0xd1a44bc4, 0xac78ac0f, 0x000060b4,
+        0x8bc58b3e, 0xa78ee1c8, 0xaf82afc7, 0x000064c8, 0xcd0ccd96, 0x6cc3ec33, 0xd36cd3aa, 0x0000bf10, 0x60346009, 0xce3bedcc, 0x1b1e1b2c, 0x0000b1a8,
+        0x72d8729b, 0x62509baa, 0x8b358b23, 0x00002864, 0x68a86814, 0xaeec2838, 0xe67ae6fa, 0x0000f5bc, 0xbfd4bf23, 0x9c6855dd, 0x300730ef, 0x00003d13,
+        0xb43cb4bd, 0x1af2f028, 0x3f1c3f7c, 0x0000b8bc, 0xd591d568, 0x2d4749df, 0x83ef83d5, 0x0000da91, 0xaccfac9e, 0x410cf7e7, 0x87dd8725, 0x000037cf,
+        0x901f9084, 0x89fae093, 0x95709566, 0x000036ab, 0x05f405f1, 0xc1ca6155, 0x5c2c5cee, 0x0000428f, 0xa8c6a8ab, 0xa38e7988, 0xabefab18, 0x00003f4d,
+        0x0ab10a8d, 0x06fa4837, 0x26532600, 0x00005539, 0xa6cba61f, 0x0a2b5a22, 0x7d877da1, 0x00004211, 0xf3d1f359, 0x5c1d7ac0, 0x1ebe1e29, 0x000048ad,
+        0x6d976d6c, 0x7f4238ff, 0x68d868c2, 0x00007251, 0xd423d436, 0xc3d6315f, 0xb51cb513, 0x0000748e, 0xeec8ee4e, 0x04ed90fa, 0xd26ad26d, 0x000035f1,
+        0xe5ece557, 0x6a605f91, 0x70307000, 0x0000aca7, 0xc30fc333, 0xa77ea0c7, 0xc628c605, 0x00000720, 0x70367084, 0x1e05da5b, 0x3ea23eb3, 0x0000fe1d,
+        0x09950956, 0x980ac100, 0xd752d7f7, 0x0000d14b, 0x1d671dca, 0xe95c75d9, 0x4f204f5b, 0x0000dd46, 0xeb3eeba5, 0x0e143cf1, 0xc3ffc3b8, 0x0000a101,
+        0x181718b4, 0xef0ed476, 0xe2fce2bb, 0x0000bbf1, 0x5f925f9e, 0xf186dc63, 0x7f537fe7, 0x0000179a, 0xbbffbb64, 0xb8ff10ba, 0x9aea9ab0, 0x00001b70,
+        0xb4dcb43c, 0xbe00b5d3, 0x562856e6, 0x000081a3, 0x4fe54fee, 0x660ccc0d, 0xe512e5cf, 0x00002b86, 0xa1faa1dc, 0x20d206e8, 0x4a594ab1, 0x00004090,
+        0x64e764b2, 0xe2ffd02a, 0x850d85dc, 0x00007031, 0xafadaff1, 0xaa816708, 0x969d9619, 0x0000a518, 0x363e366c, 0x7dacb579, 0x077a07db, 0x000094f5,
+        0x13211307, 0x0387fd8f, 0xff1cffdf, 0x00002867, 0xe77ce700, 0x3e053a20, 0x881e88dc, 0x00001364, 0x5774575f, 0x8837315f, 0x3427348b, 0x00005126,
+        0x9e8b9eb5, 0x8096e0e2, 0xb788b7ac, 0x00008153, 0x5b265bf7, 0x99720f85, 0xac73ac34, 0x00001947, 0x52a0521f, 0x5a4801d0, 0xdb40db1f, 0x000028a4,
+        0x93b59361, 0x41e7e2fd, 0x7ce47c4c, 0x0000a5e9, 0xdde5dd36, 0xde3cae6b, 0xe3b1e3ca, 0x0000f7e7, 0xbd64bd56, 0xc4caa62d, 0x7eb47e8e, 0x00006c99,
+        0xcb7fcb51, 0xafb3a6ad, 0x29892939, 0x0000d5a8, 0xa025a0c8, 0x37e628f8, 0x17461742, 0x0000ff9f, 0x053f05f1, 0x99754304, 0x0b2a0b7a, 0x0000f073,
+        0xf5fff5a6, 0xc985fae6, 0x4422443a, 0x0000447f, 0x6a2b6ad4, 0x85a977b4, 0xed6ced65, 0x000089a2, 0xf977f981, 0x33ab749d, 0xadb4ad3b, 0x000077d0,
+        0x456845d3, 0xa741b66e, 0x3ea23edf, 0x0000293a, 0x5bef5b1f, 0xf57cd7b6, 0x658f658b, 0x00003e26, 0xc522c5f9, 0xa9f18a27, 0x936293cd, 0x00009890,
+        0xb938b9d3, 0x8f667b3d, 0xb4bdb41e, 0x0000beee, 0xb9b2b9c7, 0x94f04a24, 0x533f53e7, 0x00009290, 0x11ec11de, 0xec81fefc, 0x0e360e10, 0x0000b2af,
+        0x6f6c6fd1, 0xce8ae65d, 0x0a980a1f, 0x0000636a, 0xb1bab176, 0x5068d092, 0x5f975fd0, 0x0000e6ca, 0x79a079ac, 0xff8df0a9, 0xc531c556, 0x00008818,
+        0x6d476d47, 0x85d468fa, 0x01ef012b, 0x0000f87e, 0x56e1562d, 0xa8912e8f, 0xd3f2d3a7, 0x000027c5, 0x0b360b22, 0xad10ed93, 0x89b489ef, 0x0000d3f8,
+        0x2dca2dcc, 0x1905a267, 0xf5b0f58f, 0x00008061, 0x529d52b7, 0xad510ed9, 0x4a4c4a85, 0x000031e6, 0xd41ed40d, 0x085c8aa8, 0xb658b67a, 0x0000bc11,
+        0x93ca932e, 0xb7dbaa0b, 0x584e5807, 0x000094a7, 0xd6cdd67b, 0x8e9989fe, 0x25992586, 0x000067af, 0x70f67081, 0xdf8fd5b0, 0x53c053af, 0x0000031b,
+        0x10301029, 0xac22dd94, 0xdc64dcae, 0x00004f5e, 0x98a79828, 0x2e415922, 0x3c0f3ca0, 0x0000f1e7, 0x30e13083, 0x68808ea1, 0x2bca2b6a, 0x00009339,
+        0x09620997, 0x06845f65, 0x3b693b97, 0x00008aed, 0x98c99842, 0x6f9fc6ad, 0x6972691f, 0x000045a2, 0xb565b5da, 0xa36b0186, 0xad16ad4a, 0x00002180,
+        0x266326dc, 0x4e48f6ac, 0x105a1019, 0x0000c712, 0xa137a1ea, 0x12eec58b, 0xef71efeb, 0x0000d52d, 0x6b496b7a, 0xa62399d5, 0x03270395, 0x0000015d,
+        0x8ac88a55, 0x9f962729, 0xa66fa6db, 0x00009207, 0xd43dd4f3, 0x9bca1afc, 0x928392ab, 0x0000b0cd, 0x2ba22b31, 0x479960c5, 0x420c424c, 0x00008bc1,
+        0x15fe15a2, 0x76b171af, 0xd05cd030, 0x00002497, 0xc3a8c38e, 0x79ccf524, 0x26cf263d, 0x00004af2, 0x3d3c3d80, 0x2ac2dde8, 0x7a247aba, 0x0000cfac,
+        0x96319657, 0xa20d1786, 0x3b463bb2, 0x0000800e, 0x5a0e5abf, 0xf45d453a, 0x2ca02c00, 0x0000ce82, 0x10a91074, 0xf886dfad, 0xc964c9da, 0x0000b924,
+        0x37f23741, 0x3ff58ffe, 0xf4adf475, 0x00007ba3, 0xbfccbfec, 0xe54186f0, 0xe5b3e5d6, 0x000022b7, 0x30c83073, 0x3f7c6658, 0x6b486beb, 0x0000c65a,
+        0x577757c7, 0x6e222abb, 0xa58ea551, 0x0000ada6, 0x173b176e, 0x51b3dcd4, 0xa652a65c, 0x00003a5b, 0x0f040f12, 0x2a8101ca, 0xba35ba40, 0x00000300,
+        0x44bd4449, 0xf5ae8da2, 0x91f9914a, 0x0000ab55, 0xc2f0c225, 0xf4a1a2e0, 0xd21dd289, 0x0000702e, 0x004100cd, 0xd4911d21, 0x8b7b8b97, 0x00004bc6,
+        0x5fb35f26, 0xecafb97f, 0xe5a9e589, 0x0000d4f8, 0xd99ed93b, 0xd107d6a3, 0x2887283b, 0x0000206b, 0xc9d4c960, 0x5f7547e6, 0x6cc36cb3, 0x000095a7,
+        0x6674665c, 0x4936143e, 0xf21af2f9, 0x00001436, 0x00d30036, 0x45c6560d, 0x55965524, 0x0000eea4, 0x9ee09e82, 0xdec9f5dd, 0x535c5331, 0x00006252,
+        0xa60fa6de, 0xc5ebc471, 0x1e031ed6, 0x0000bdef, 0x2f6e2f77, 0xadb2f563, 0x105b10d5, 0x000079cc, 0xb1cab13c, 0x42b94fd7, 0x17371723, 0x00008590,
+        0x7ce17c27, 0x335c908c, 0xf2c9f250, 0x00004f42, 0x4f504f45, 0xdd045dae, 0x210f219f, 0x000021d4, 0x9b729bd3, 0xae132629, 0xdf05df4c, 0x00002366,
+        0x423b4223, 0x525209e6, 0x13171324, 0x0000fc1a, 0x110a112a, 0xb9cd39ff, 0xde2dde11, 0x00004fb6, 0x86c286e8, 0x509d9b37, 0x7aa97a33, 0x00000a2c,
+        0xf7def7ff, 0xa363e393, 0xe707e7d4, 0x00006328, 0x8fa28f2c, 0x249d27eb, 0x69206912, 0x00000412, 0x833d830d, 0xce553aee, 0x73ae73dc, 0x0000a285,
+        0xbd9ebd7e, 0x2480d01d, 0xa774a712, 0x00001f88, 0x19c019f0, 0xd29cae63, 0x27792765, 0x00004977, 0x40294079, 0x33f66256, 0xb5c0b538, 0x000046ba,
+        0x365c3683, 0xd04d39ce, 0x010401c0, 0x000080c1, 0x3a3f3a0b, 0xff5ab5a0, 0xcabecab5, 0x00008580, 0x1ed21e87, 0x8c98d404, 0x77eb7740, 0x00008f69,
+        0x6205622f, 0x9a9705b4, 0xd862d8f3, 0x000084e5, 0xa5bba521, 0xa7314143, 0xe398e3e9, 0x00007251, 0x4443443c, 0x7f3d379a, 0x9c299c4f, 0x000001fc,
+        0x89208923, 0x7c124cd4, 0xeb0ceb0a, 0x0000ae75, 0x66c4663e, 0x4ec3897a, 0x342b3494, 0x0000434c, 0xced4ce6b, 0xfb18e002, 0x7d517de7, 0x0000660b,
+        0xaf46af63, 0xcb9a7676, 0x6b1c6be2, 0x00008330, 0x9bf39b96, 0x0d140bd1, 0x8f5d8fc7, 0x00005e6e, 0x386238d5, 0x19ca01f9, 0xbb98bbcd, 0x00004c04,
+        0x01e1013a, 0x56ff12de, 0xf868f89d, 0x000099a9, 0xb4d4b470, 0xaf5b88ef, 0x6e0d6e29, 0x00003e02, 0xab25abe2, 0xce4496ef, 0xed7aed80, 0x000032ae,
+        0xa7faa775, 0x96b61d28, 0x32233203, 0x00001b73, 0x9e879ec6, 0x89f3ab7c, 0x982c9845, 0x00002d1c, 0xb73bb7bd, 0x99fa7bff, 0x831a8348, 0x0000b0cd,
+        0x30a23082, 0xfad91a0d, 0x48b34880, 0x0000ec98, 0xb504b558, 0x809684c6, 0xd611d6d2, 0x00003d73, 0x00c100f4, 0x4f368ee1, 0xa460a430, 0x00006248,
+        0x915c91ed, 0x763b47b1, 0xee6feed9, 0x0000d7d7, 0x319031d6, 0x35105380, 0xf99bf958, 0x00007669, 0x280c280d, 0x8e47bad0, 0x777c77ca, 0x0000b52c,
+        0x4b8e4bcc, 0x6ed09644, 0xcf68cf3e, 0x0000b9c6, 0xe447e4f3, 0x4f25f2d4, 0x97d69791, 0x000046ba, 0x85308555, 0xc65d8fe1, 0x574d5752, 0x00006579,
+        0x67af6736, 0x41b95503, 0x3c793c09, 0x0000a2ce, 0xb143b14f, 0xe9586a85, 0x797479c9, 0x00002e63, 0x5ab45a40, 0x4a3673d6, 0x4e894e3b, 0x0000755e,
+        0x1a3f1ac7, 0x97d7e02d, 0x3e893e28, 0x00005adc, 0x910991f2, 0x022b4cca, 0x431843c7, 0x00001ed3, 0x07d80721, 0x0c15cdd3, 0xe2bee2b6, 0x00006d7d,
+        0x100c10d0, 0x43e68ee0, 0x65ba65ea, 0x00007b9c, 0x117c11ef, 0x81c8ee50, 0x8d5a8d02, 0x0000165e, 0xb0ecb080, 0x13dd24eb, 0x78317800, 0x00008e45,
+        0xc0d8c0ff, 0x2531574f, 0x22562206, 0x000047ef, 0xadf3ad7e, 0x9e9cd826, 0x30f53069, 0x0000864f, 0xc6b5c683, 0x778ee7a0, 0x6733677f, 0x0000e56a,
+        0x5f0e5fd9, 0x4a368bac, 0x5ba25b10, 0x00009c47, 0x72547234, 0x265ddcd4, 0xe19de1e8, 0x0000e7d2, 0x37d2377e, 0x1fc53ace, 0xa51da5a4, 0x000038a4,
+        0x7c6c7c5d, 0x7728066a, 0x968896a5, 0x0000107f, 0x784478c1, 0x509dd349, 0x11c611da, 0x00008f68, 0xef49ef77, 0x080a1aaa, 0x601a60d8, 0x00007208,
+        0xeaadea14, 0xff4f595e, 0x5dde5d5a, 0x00007d53, 0x2d612dbb, 0x63baa729, 0xba43ba35, 0x0000dc1e, 0xf3cff35c, 0x4610f1ac, 0xe0cce0ce, 0x00006fe8,
+        0x31c93108, 0x2fbedec4, 0xfbb9fb95, 0x0000eb17, 0xa627a61e, 0x3f7ddd83, 0xf0b0f0e5, 0x000022ba, 0x49364998, 0x68bf97be, 0x58425840, 0x00009d8a,
+        0xd6ebd6d0, 0x88a412ff, 0x0e570e8a, 0x0000f6d9, 0x3b373b1e, 0xead8c560, 0xd05cd033, 0x0000d816, 0xc4efc4fc, 0x49c187b4, 0xbcc8bc8a, 0x00004325,
+        0x580c585e, 0x719bbef6, 0xe84ee85a, 0x00007560, 0x1b471b39, 0x700097c7, 0xdb0edb14, 0x0000f4d1, 0xd311d39d, 0x430f5ea3, 0x11ee11e6, 0x000012a5,
+        0xe0c4e0c7, 0x376be36d, 0xccb6ccbf, 0x0000263a, 0x896b891c, 0x2152e0af, 0xb2e9b221, 0x0000720f, 0x3bc73bf0, 0x0b496b4e, 0x44fc44d5, 0x00001729,
+        0xb158b108, 0xa21d2754, 0x58c758e1, 0x0000936b, 0x1a3b1ac4, 0x4b7d1fda, 0x33f53334, 0x0000358c, 0x1d8b1d1d, 0xdbef0d26, 0x13111364, 0x000041bd,
+        0x1c341c2e, 0x4a080ddb, 0xc62cc660, 0x0000044d, 0xd5c5d515, 0x32efeed3, 0xdda5dd5f, 0x0000a46f, 0x4a764a97, 0x2a671c32, 0x668b66b7, 0x00005dc9,
+        0x2e392e9f, 0x3fdf2e62, 0x5f815f13, 0x00004232, 0xe772e73e, 0x3f02e1a0, 0xdf49df1d, 0x0000ac47, 0xac96acab, 0xdb541bec, 0x9b869b62, 0x0000db67,
+        0xadb9ad53, 0x47254572, 0xd9c6d987, 0x00004410, 0xda89dae4, 0x0e7dd40c, 0xa349a344, 0x0000c843, 0xafcbaf6a, 0x2b7ef0e8, 0x540454ee, 0x0000e3b7,
+        0x9f719fa3, 0x7212934f, 0x9353935f, 0x0000ca83, 0x102810f5, 0xfed2c7c3, 0x16f016bb, 0x0000b6a8, 0x68fe6831, 0xfdce87c1, 0x12761284, 0x00004d7c,
+        0x62286271, 0x1e93635a, 0x1a6f1ad9, 0x0000fece, 0x0f0c0f6e, 0x5a27d101, 0x289c2819, 0x000083fe, 0x5ced5c2b, 0x09a58bd1, 0x38b0387a, 0x0000b8ee,
+        0xfb70fb9d, 0xf2b7453b, 0x8e7c8e3a, 0x0000814a, 0x35f23504, 0x8604478f, 0xbfb2bf5f, 0x00003194, 0xe45ce45a, 0xe958cdd0, 0x492049fe, 0x00005854,
+        0x11fe113f, 0x6e601d65, 0xe8b7e8f5, 0x0000b396, 0x912391a0, 0x5258f717, 0x858f855e, 0x00000a64, 0xbc88bca6, 0xf744f7a9, 0x85168547, 0x000073c2,
+        0x9205928c, 0x0ff4dceb, 0xc068c017, 0x0000e589, 0x0dd00d65, 0x6a1c9638, 0xfac3fa79, 0x000033a0, 0xe062e01b, 0xb8febf0b, 0x645764be, 0x0000392d,
+        0x38ae38b8, 0xa3a044b2, 0x7c297cf1, 0x00001757, 0x38d7382f, 0x5c905565, 0x91259131, 0x00004eb7, 0x06930626, 0xdbaba2db, 0x626c62d7, 0x00003203,
+        0x240224f7, 0x2963ee4c, 0xaca1ac4c, 0x00002ef9, 0x856a8584, 0xe2285ebd, 0x55c9555f, 0x0000cb0e, 0x644064e6, 0xe8b1441e, 0xd0fed005, 0x0000dd5d,
+        0xe239e230, 0x65b24912, 0x43a74352, 0x00007e81, 0x465346e6, 0x798bdb36, 0x304930f4, 0x00006a90, 0xe456e492, 0xbbd04fea, 0x38a33816, 0x0000c132,
+        0xabe8abd6, 0x30b09d2a, 0x596c59e3, 0x00003a9f, 0xe2a0e232, 0xa9d38cde, 0x384c3835, 0x00005477, 0x569c568b, 0xfcaac77e, 0xc35bc37e, 0x0000c510,
+        0xa259a28a, 0x26a2010f, 0xbdaebd23, 0x00004f48, 0x503550c7, 0x5e1d1541, 0x487748d6, 0x0000cde8, 0x531053ee, 0xfc3a6bc8, 0xbe61bea4, 0x0000f882,
+        0xc7b9c78d, 0x6b7d02fa, 0x426e429a, 0x00009619, 0x7012703d, 0x954f063b, 0x29fa29b0, 0x0000bf5c, 0x454c450b, 0xce3db1e6, 0x7df47df8, 0x000090cb,
+        0x38353881, 0x16390ed9, 0x4f714f3e, 0x000021ad, 0xfeb8fe61, 0x7fba1146, 0xf74cf7f1, 0x00007681, 0x87ca8744, 0xc105672d, 0xbc48bca9, 0x00004b05,
+        0x6833681e, 0x5f17b66e, 0x3aac3aed, 0x00009d31, 0x2ffd2f90, 0x088260e2, 0xb852b88e, 0x0000ca08, 0x8bed8bc0, 0x791a40b9, 0xc30bc322, 0x000081bf,
+        0x3c3c3c5e, 0xb69998af, 0x30583087, 0x000030ce, 0x93cc9371, 0xf9ab219b, 0x0aa90a9d, 0x00008a50, 0xa1dca1ad, 0x2c4c0ad4, 0x21f121f3, 0x00003965,
+        0xf45af42c, 0x8217b88b, 0xdf47df36, 0x00009905, 0xa0c1a03c, 0xbfeb2354, 0xe442e449, 0x0000c06d, 0x757f75f1, 0xac9bdf15, 0x7b0b7b64, 0x00007025,
+        0x61a0612e, 0x8a5c2980, 0xde6bde20, 0x00000dd8, 0xf942f9db, 0x6b4219b3, 0xf9f8f9a5, 0x000057fa, 0x2db72d1d, 0xdcde1fe1, 0xab81abcb, 0x00003440,
+        0xcc24cc3a, 0x1f2e38f2, 0x5b0d5b57, 0x00006f4a, 0x58495868, 0xf948ca67, 0xa47ba43d, 0x00006f2a, 0xd6dad623, 0x0b0aeafd, 0x7a2e7a3c, 0x00005506,
+        0x8f2b8f2e, 0xe4c37e2d, 0xa354a340, 0x000022cb, 0x290129ff, 0x96b67cff, 0xa26da231, 0x00009ecd, 0x6bdb6b55, 0x4266daa7, 0xd678d642, 0x00003e35,
+        0x68236894, 0x7e54363e, 0xac87ac17, 0x000092c1, 0x053905ba, 0x701af760, 0x13b81320, 0x0000f601, 0xed81ed3b, 0xb61b0437, 0x0ecb0e34, 0x00005d65,
+        0xe3f3e3f6, 0x5dff93b0, 0x6b9d6b88, 0x0000535b, 0x8549851c, 0x0ffc958f, 0x98b2987b, 0x000032ae, 0x94ac9468, 0x38d36295, 0x143f14be, 0x0000d7a5,
+        0xfde4fdc5, 0x11aacad8, 0x1955191a, 0x0000562f, 0xe852e89e, 0x1eda1bec, 0xaea7aeb1, 0x000046ea, 0xeeafee50, 0x7ce34dbc, 0xfb61fb23, 0x000050e8,
+        0xb6a9b69c, 0xc1b51446, 0x804a80a4, 0x00008580, 0x863b866b, 0x5dd764a3, 0x60036060, 0x000038f3, 0x5dc55d41, 0x38509b54, 0xed70ed84, 0x00003fed,
+        0xe668e6d1, 0xbc2b7f34, 0x9d509d95, 0x0000d71d, 0xbfebbfe1, 0x864a91e5, 0x899e8900, 0x0000168b, 0xe8c6e855, 0x007b0514, 0x252c254e, 0x0000a8cb,
+        0x33bc335e, 0x3e8d4b11, 0xf116f1eb, 0x0000c1b9, 0x422742f5, 0x92d939a3, 0x396e3990, 0x0000a7ae, 0x9f459f98, 0x7c8e2f45, 0x886c8839, 0x00002277,
+        0xdc6adc24, 0x09d7e763, 0xa4e8a402, 0x0000f155, 0x49544946, 0x9ca64d56, 0x1c171c83, 0x00004611, 0xd268d2d7, 0xe3205303, 0x1bf21bbd, 0x000056d4,
+        0xb098b03c, 0xafa1f5dc, 0x15ed159b, 0x000062d1, 0x06940602, 0x584ddd1d, 0xa75ca7d0, 0x000032ce, 0xed95ed6b, 0xe80c6975, 0xad28adab, 0x000029ea,
+        0xce5fce76, 0xabe00ca1, 0xe25ee28c, 0x00003943, 0x473c4735, 0x9e79c4fc, 0x1c5a1c31, 0x0000d4f8, 0x40594087, 0xdf924630, 0x05830512, 0x000033a0,
+        0x49c949ed, 0xa7c2153f, 0x4ed14e70, 0x0000d9ca, 0x12ad12ba, 0x8637cbae, 0xd591d574, 0x00004c06, 0xbe38be1f, 0xfbcebdcb, 0x68896804, 0x0000d38a,
+        0x4f5c4fad, 0x8c47167a, 0x092e0956, 0x00003dbf, 0xf645f6d0, 0x25e7f7de, 0x4baa4b04, 0x000057f9, 0xc2e3c21c, 0xfcce239d, 0x9b919b94, 0x00006000,
+        0x4b544b4b, 0x45251a97, 0x49374927, 0x0000b28e, 0x76487609, 0xa2238dcf, 0xbf94bfe6, 0x0000e7a4, 0xbfeabf96, 0xda8b7b3f, 0x3a0d3a87, 0x0000eb89,
+        0x45014589, 0x100fdedb, 0x857b852d, 0x000006ed, 0x66356678, 0x91d99ad7, 0x81ca8127, 0x000055b8, 0x54755408, 0x1815e3d3, 0x1f1b1f78, 0x00007568,
+        0xe8c3e864, 0xa641aaf8, 0xdf19dfd0, 0x0000830e, 0x86698662, 0xb773373a, 0x969b96d7, 0x0000bfbb, 0x023b02be, 0x0975e6b8, 0xf21cf23b, 0x00009615,
+        0x467c465e, 0xb3e2f9fa, 0x03840331, 0x0000fda3, 0x908990f8, 0x0145dd1d, 0x89f78951, 0x00007384, 0xc6c3c6f1, 0x2a9c8634, 0x979a9712, 0x0000323c,
+        0xc803c828, 0x2890625c, 0x984398c6, 0x00003aed, 0x583858ef, 0x9f8de127, 0x143a1460, 0x0000075d, 0x75f77561, 0xab0214b5, 0x53205366, 0x0000d049,
+        0xc08bc0ac, 0x21a2c1fd, 0xdaa1dabe, 0x0000a0ae, 0x16f6162e, 0x5ccee1fe, 0x8a678a39, 0x0000650f, 0xd8ecd869, 0x8d478331, 0x017e017e, 0x0000fc5c,
+        0x906690a7, 0xc2a8bb39, 0x6c0c6c62, 0x0000f538, 0x6d5d6d92, 0x2e4244bc, 0x5282522a, 0x0000fc1c, 0x8fb58fd0, 0xd2d594be, 0x89a289bc, 0x00007943,
+        0xa58fa58c, 0x774a797e, 0x62ad62c2, 0x0000c3d2, 0xb9c5b9e2, 0xed6cbf76, 0x1d1a1d64, 0x0000241c, 0x7373730c, 0xd46bbbe9, 0x047c047d, 0x0000d49a,
+        0xacd2ace5, 0x84bf824d, 0x419b413d, 0x0000e6f4, 0xe5a4e526, 0x4a39dc44, 0x10a810d9, 0x0000bb8e, 0x24c42431, 0x103efb8d, 0xfb6bfbbf, 0x0000cbab,
+        0xd129d1c9, 0xb0387b56, 0x69b069e3, 0x000099aa, 0x12ef1229, 0xa1be075e, 0x525752a5, 0x0000a4c8, 0x296b299d, 0xbe71b0a5, 0xab3aab31, 0x0000a5fd,
+        0x8cf08c59, 0x632fe3ec, 0x1f4f1ff8, 0x0000f5d9, 0xad47ad83, 0x4e362d5b, 0x71b471d4, 0x0000170b, 0x4bf34b91, 0xaf5113cc, 0xc755c7e2, 0x00008bc3,
+        0xa2dba242, 0xcc081c59, 0x72bf72cc, 0x00001f14, 0x027402a3, 0xf4ae51d4, 0xd055d068, 0x000035f0, 0x581a5892, 0x018386cf, 0x6a046a48, 0x000077b0,
+        0x84eb847d, 0x16bed244, 0x33ce33cc, 0x0000bbc3, 0x46cc4621, 0x582d4446, 0x154b1500, 0x0000a155, 0xd500d563, 0x6c93a313, 0x15e715e6, 0x0000f170,
+        0xf873f847, 0x953d6400, 0x2b422bca, 0x0000f7e7, 0x56a45628, 0x91fd403b, 0x32e732da, 0x0000327c, 0x77547732, 0x4345df05, 0xe9d8e9c1, 0x0000926b,
+        0xe16ce106, 0xabf03c23, 0x6e6d6e36, 0x00009a6b, 0xf8dcf841, 0xdae57b3f, 0x728572a7, 0x00000919, 0x44d244f7, 0xd60ea4ed, 0x9b5c9b1d, 0x00009f0e,
+        0x0c3f0c5b, 0xe2bd2fc7, 0xe2f8e2a6, 0x0000f320, 0x485948e8, 0xcfc76d3a, 0x597e59a0, 0x00005985, 0xa80da81f, 0xa1dcdd15, 0x74b67453, 0x0000f50c,
+        0x4fed4f2b, 0xf3f25192, 0x1a001a88, 0x000065f1, 0x8dc88d92, 0xdcf45eed, 0x237b233f, 0x00003a13, 0xf495f4cf, 0x78a30feb, 0xe4fde4be, 0x00006f96,
+        0x358735d6, 0x78123a16, 0x4763474b, 0x0000039f, 0x7e297ea1, 0xcc652226, 0xf412f4cc, 0x00002986, 0xc6b6c682, 0xfc4e5292, 0x125e121f, 0x0000ab2e,
+        0xa719a711, 0x4fd77919, 0xb5eab5e7, 0x00008061, 0xe0a2e078, 0xc60b1e21, 0x48424862, 0x00005564, 0x5a5a5a6b, 0x85f7bc3b, 0x0c760c74, 0x0000cd10,
+        0xe1dfe182, 0x317f362f, 0x359c3535, 0x0000b811, 0xf435f4be, 0x1c33eaf2, 0x61fb61a3, 0x0000e6d2, 0xc10dc18d, 0xfd1efcc5, 0x55385565, 0x00004526,
+        0x780f7866, 0x7ce331a0, 0x79f479bb, 0x000074f2, 0x52c252f9, 0x0c28ac37, 0xb842b8fa, 0x0000d47a, 0x03410326, 0x1fda093b, 0x7c7e7ccf, 0x000071cc,
+        0x26472624, 0x9069fa33, 0x168216f6, 0x00006435, 0x81e98153, 0x11dd73d0, 0xc047c0b1, 0x000034cf, 0xe4c6e4b5, 0x14d4518d, 0x55cd5583, 0x00002da5,
+        0x5ce95cae, 0x1ade4146, 0x96d39630, 0x0000f1e3, 0x70307033, 0xdc8fad10, 0x10d11021, 0x00009c04, 0x6f296f29, 0x5932aaf4, 0xff3bff75, 0x00004190,
+        0xbc18bcd4, 0xa3c38070, 0x7847785f, 0x000002b2, 0x8ec68efe, 0x31029bad, 0x664966ba, 0x00004d1f, 0x5ef95e0b, 0x33f5edcc, 0x305d3016, 0x000081af,
+        0xb60cb6d2, 0xb9d16097, 0x982598b4, 0x00007aa3, 0x0138017b, 0xd69239fc, 0xea0bea7c, 0x000028a4, 0x3f3c3f58, 0xdf0cd54f, 0x7ea07e37, 0x0000885f,
+        0xf808f866, 0xa0beedc1, 0xa1d9a1cf, 0x0000748e, 0xe73ae708, 0xd52f323c, 0x0350030e, 0x0000feec, 0x8eb18e9f, 0x5c9d3ecc, 0x340f3484, 0x000093d5,
+        0x16ed1650, 0xacd03f33, 0x6d736d6d, 0x0000b47c, 0xe56ce504, 0x9def68b6, 0xc451c4e5, 0x00006b17, 0xa849a8d7, 0x68a0db26, 0xcf95cfea, 0x0000b7b2,
+        0x13f21300, 0xbf1b6698, 0x1721174b, 0x0000f218, 0xb8edb8de, 0x5fdd61ea, 0x2b1c2b78, 0x0000376e, 0x186f1861, 0xbb24081c, 0xd999d90d, 0x000065e1,
+        0xd107d168, 0xecd3fa11, 0xb915b974, 0x000069c0, 0x83028347, 0x49c965a4, 0xfb5bfb37, 0x00007c71, 0xc7d2c7b6, 0xa401c2b7, 0xed0bed01, 0x000094f5,
+        0x4e2d4ef3, 0x12f91aaa, 0xa9b7a92c, 0x0000a11d, 0x632e63f8, 0x3ff57e56, 0x0cda0c3b, 0x0000fe93, 0xfbd3fbe4, 0xfe444e85, 0x48a0486e, 0x0000e7a4,
+        0xcfffcf2e, 0xcca4ffc5, 0x388438b4, 0x00004411, 0x216b2138, 0x604a76d9, 0x00f50055, 0x0000436e, 0xd4d4d470, 0x22f06741, 0x6e596e55, 0x00005379,
+        0x83f58329, 0x4226c48b, 0x403740f4, 0x000063a9, 0x375a3785, 0x904c9fa1, 0x034d037a, 0x0000a194, 0xa2aea20c, 0xd8ba1702, 0x6f1a6f39, 0x0000044d,
+        0xc409c4e1, 0xafde6524, 0xa454a419, 0x0000dd57, 0x312b31c9, 0x0bcba29f, 0xc156c1e3, 0x00002a3a, 0xfce6fce7, 0x771a3fb1, 0x0bf80b4a, 0x00003cd2,
+        0xa4d5a43b, 0xa45163da, 0x45f845b3, 0x00005865, 0x80bf808b, 0x286789ef, 0x8be48baa, 0x0000ab77, 0x6fe46fa0, 0x24eec7d3, 0x13ed13e7, 0x0000564b,
+        0xed71ed40, 0x1391c55e, 0x033903de, 0x0000261e, 0xc358c3e7, 0xc1f514c5, 0xfa1efa91, 0x0000bf4e, 0x94619486, 0x2ba20d25, 0xaa40aaab, 0x000090d4,
+        0xcaa3ca92, 0x60b04d48, 0xe90ee97c, 0x00003d93, 0xa51aa5d3, 0xa7401e21, 0x890d89b8, 0x0000424f, 0x51dc5169, 0x5f6a5473, 0x79b5793e, 0x00000ccd,
+        0xc698c641, 0xb65894c7, 0x41e64116, 0x0000af64, 0xf899f8cc, 0xf3195430, 0xe0d7e05c, 0x0000f61d, 0x43e243f9, 0x33d8c0a1, 0xab0cab60, 0x0000c34d,
+        0x2cf92c78, 0xc5d8b791, 0x9aab9af8, 0x0000de9d, 0x94629429, 0x4af7109e, 0x1a671af0, 0x00002beb, 0x2cad2c88, 0xe958f2ae, 0xdba1db7f, 0x000039ed,
+        0x8bea8b92, 0xbb53e2ec, 0xdff5dfc9, 0x00007edc, 0x9d7f9db8, 0xb12a7a24, 0xc65ec6e2, 0x00007160, 0x92e89225, 0xaac227d7, 0x7d147d84, 0x00001f51,
+        0x0043008f, 0x80285a5c, 0xf8f0f828, 0x0000d96d, 0xec85ec32, 0x4e398df3, 0xdca4dc26, 0x0000f02d, 0x3fc53f6b, 0x77e3d50c, 0x04070488, 0x00006530,
+        0x939c932e, 0xe85c18d0, 0xd39fd3f2, 0x00001f88, 0xb1fab1f6, 0x8c78aaf7, 0xff61ffad, 0x0000e907, 0x57cf5745, 0x7e5edcd7, 0xce7dce4c, 0x00000e0d,
+        0x02a00262, 0x5680a503, 0x4b444bde, 0x00008660, 0x8a788a3f, 0xc962a947, 0x77fc77a1, 0x0000e42c, 0x60ca60df, 0x060eadc0, 0xe77fe768, 0x00009bf6,
+        0x64b0640e, 0x7ea2aa03, 0xe547e5b8, 0x00002d34, 0xc9d4c961, 0x20c04f56, 0x5baf5b6f, 0x0000f170, 0x2da72d00, 0xd76b15c1, 0xf04bf018, 0x00008571,
+        0x31533180, 0x6a8291b1, 0xd179d18f, 0x00002d8c, 0xf36cf372, 0x1cc9b1c7, 0x33f63357, 0x0000dc2d, 0x3a273ad9, 0xe47c0b1e, 0x89b0896a, 0x00002c58,
+        0x79117930, 0x1c9f1541, 0xf4a2f496, 0x0000881b, 0x4abe4a93, 0xc2141d29, 0xeae6eaa1, 0x0000243e, 0x5d245d1c, 0xd2a8c6be, 0xba42ba3b, 0x0000e532,
+        0x3bb33b50, 0x0c2d6fdb, 0x2b932baa, 0x00001ee3, 0xe4c4e45f, 0xcb45d5a0, 0x072e07d0, 0x0000de56, 0xc2b1c280, 0xc5dd93ba, 0x29c029c2, 0x0000703b,
+        0x9ef89e39, 0xc4f47351, 0xc810c8dc, 0x0000aca7, 0x67ce674c, 0x71bcac74, 0x429c4271, 0x00002b0a, 0x62aa622b, 0xcaf546fb, 0xdca0dca7, 0x00005384,
+        0x8fcc8feb, 0x8027560d, 0x8be28b3c, 0x0000a837, 0x39b13911, 0x4a6b1f6b, 0xed6bedc3, 0x0000f652, 0xaabeaa51, 0x8cf820d6, 0x202d2071, 0x00000907,
+        0x40d140e2, 0x430f1edb, 0x0e6a0e41, 0x00005ed8, 0xa865a8e8, 0xcb93e4dc, 0xabdaab95, 0x00008c96, 0x62036246, 0xd22b2a45, 0x0e820e8c, 0x0000a999,
+        0x58e5582c, 0x89eefb59, 0x5eae5ec5, 0x000011e2, 0xbe96bec6, 0xe1ff6ea4, 0xc597c5a4, 0x0000cb95, 0x0527055b, 0xe6a330e0, 0x2d982d85, 0x000046f3,
+        0x96d496d7, 0x68a1c54a, 0x8348839a, 0x0000170a, 0x353835c7, 0x70ea5c98, 0x99c29937, 0x0000db3f, 0x272f27d6, 0x8eb1a6ef, 0x7a0a7a5a, 0x00000fd8,
+        0xa8fba865, 0x59b70be8, 0xf88ef8e8, 0x0000fe73, 0x64da64c3, 0x2cd20ad4, 0x856385bf, 0x00002986, 0x830e8336, 0x51d79338, 0xc216c23a, 0x00007351,
+        0x94a29425, 0x242083fe, 0x488548be, 0x0000ef46, 0xda6eda95, 0x34cf2e8f, 0x74dc7491, 0x0000d09b, 0x0f190fd8, 0x83c86c46, 0x20dc2030, 0x00004c08,
+        0x666b6678, 0x4ca7ed70, 0xda9bdaaa, 0x0000c172, 0x7b037b6c, 0x685054cc, 0x85b58558, 0x000033b0, 0x65b06502, 0x3c89df24, 0xed12ed33, 0x0000b2af,
+        0x274827b1, 0xc4ca7abb, 0x48ba4873, 0x000094e0, 0xcd42cd9e, 0x89eeb555, 0x4bf44bf0, 0x0000b70e, 0xa3ada327, 0x29c05dd3, 0xa598a576, 0x0000bc10,
+        0x20a320ca, 0x203087b4, 0xc963c905, 0x000056c0, 0x728572a5, 0xd177d4b5, 0x771677d9, 0x00001198, 0xb82bb85d, 0xa7393b30, 0xb4b6b4a7, 0x0000ef48,
+        0xd98bd93a, 0x2121e155, 0x316d3193, 0x0000047f, 0x85368560, 0xfe264aa2, 0xd61ed604, 0x0000ad38, 0x14f9149e, 0xad0ce83e, 0x06970610, 0x00009ea6,
+        0x371c3782, 0xb2a32e8e, 0x7a3c7a2c, 0x000039bf, 0xc1e1c159, 0xf5bb96c3, 0x814c81b8, 0x0000d5eb, 0x74e9747f, 0x522222af, 0x17a617e8, 0x0000eae8,
+        0x73d7735d, 0x8fa22262, 0xae5baee7, 0x0000b081, 0x03e20349, 0xf11e92be, 0x375a37b1, 0x000016e3, 0xadf9adcf, 0xe3a12026, 0x860b8607, 0x0000242c,
+        0xaccaac18, 0x33abb787, 0xf0aef0e9, 0x0000915d, 0x9a029aa0, 0x7a021b52, 0x5f425fb0, 0x00003313, 0x098a0967, 0x352aecab, 0xf49bf480, 0x00000de6,
+        0x189b1889, 0xa751096a, 0xdc4adc14, 0x000015d7, 0xf474f411, 0x7a8ba6d1, 0xc5f6c551, 0x0000f2bc, 0xd13ad1d6, 0x013bd9a4, 0xe2c0e220, 0x00003b65,
+        0xd111d120, 0x18ca9b55, 0x13e713e4, 0x0000e8bf, 0xe189e156, 0x26a206e8, 0x43704392, 0x00005f2b, 0x4be04b8c, 0xd5ca1641, 0x357835ff, 0x0000d6d4,
+        0x045404a7, 0x80578c62, 0x8e408e6e, 0x00007f8f, 0x83c183f4, 0x72b5bbe4, 0xb5e8b5b7, 0x00005298, 0x4d544d66, 0xe5a39bd7, 0x5c4f5c05, 0x000094a7,
+        0xcfdfcfee, 0xac0d0e27, 0xff1aff35, 0x000022b6, 0xfc7cfcda, 0x6033b479, 0x0e700e4c, 0x0000de86, 0xf4c4f4cc, 0xf8779163, 0x69046949, 0x0000cb6b,
+        0xa252a237, 0x744e2c4e, 0x128b1290, 0x0000d3f8, 0x692169d4, 0x92cb3ab1, 0x20f12088, 0x0000ef88, 0x89c08997, 0x7a0912fd, 0x74bb74fa, 0x00009714,
+        0x0d610ded, 0x99e5eacc, 0xcf9acfe5, 0x000049fe, 0x4aa14a60, 0x067b9a55, 0xf637f68b, 0x0000cb34, 0x491149e8, 0x124e4280, 0xbb23bbc6, 0x000032f1,
+        0xfa7dfae4, 0xdd825348, 0xf985f92f, 0x0000c62d, 0xdfefdf28, 0x916ca19d, 0x71b2717d, 0x00005677, 0x52cf5243, 0x1d21ce2e, 0x276c2785, 0x0000d49b,
+        0x7a807a4a, 0x7c7f9829, 0xf3a3f31a, 0x00003711, 0x0b8e0be5, 0x3990bbb9, 0xaa76aa60, 0x00000cc8, 0x22f92277, 0xeed3f5de, 0xd98dd965, 0x00003c2c,
+        0xee7eee26, 0x60a56b0a, 0x9277923b, 0x0000703b, 0x6ade6a50, 0x69ddcc89, 0x9e289e0f, 0x00009e26, 0x4d294d16, 0xf801e5a3, 0x50d850ea, 0x0000d2a5,
+        0xdadbda28, 0x0384a70c, 0x333b3314, 0x0000a0b7, 0xd602d638, 0x542dae6b, 0xf8fff8b5, 0x0000137d, 0xb306b30e, 0xf5bb76d9, 0xc0b6c0cd, 0x00002acb,
+        0x1cc81c36, 0x515d8a29, 0x20512089, 0x0000b409, 0x11101118, 0x6f8fbb90, 0x3299328d, 0x0000bf24, 0x076d0787, 0x620daa82, 0xc7b3c741, 0x00001844,
+        0x22592286, 0x1271feb8, 0xf763f7aa, 0x00006684, 0x734b73fc, 0x742d3764, 0x64436474, 0x00005046, 0x6b1c6b93, 0x0d924459, 0x4f794f3b, 0x00007ba3,
+        0x50a45039, 0xf2da297b, 0xa0a4a0af, 0x00004090, 0x1f651f4e, 0x5c904766, 0xf327f332, 0x00002d75, 0x8448844c, 0xfcc2f873, 0xeceeec1b, 0x000037ab,
+        0x2306237b, 0x9d587bc3, 0xbe79bec1, 0x00003a60, 0xc8c9c826, 0x41996105, 0xdebfde1a, 0x0000535b, 0x48d04834, 0x172aa028, 0x4ffc4fe9, 0x0000b86c,
+        0x9f589fe6, 0x9fe60327, 0x1f051fe9, 0x0000d30b, 0xa575a522, 0x88253f31, 0x79527968, 0x0000bfdb, 0x2d8e2d93, 0xf75a1952, 0xad49ad00, 0x000033f4,
+        0x350b35e1, 0x082468d5, 0xddfddda1, 0x00004d00, 0xdca6dce7, 0xc5e826ac, 0x41764104, 0x000016f5, 0xfd0dfdc8, 0xe2434cc3, 0x428c4221, 0x0000bbce,
+        0xc0afc00b, 0x21926e48, 0x597f59ac, 0x0000d59a, 0xa672a645, 0x4279daa5, 0x004300c9, 0x00007943, 0xe188e17e, 0x1dd6a9bb, 0xb289b246, 0x00004850,
+        0x904590ba, 0x581762e9, 0x396d397b, 0x0000115b, 0xd415d443, 0x0565a4db, 0xc62cc611, 0x0000850b, 0x8bab8b6c, 0x721a22eb, 0xd65ed66c, 0x000050d8,
+        0xc1b5c18b, 0xcc27b935, 0x66866658, 0x00005306, 0xd574d5fd, 0x733509d9, 0x188418c3, 0x00007d7d, 0x57e95732, 0x4eb75eee, 0x297529f4, 0x000022b7,
+        0xc9a6c915, 0x4666ed33, 0x1abb1aef, 0x00002f49, 0x0ace0a10, 0x88279993, 0x1ed81e3d, 0x0000d75a, 0xc9e1c956, 0x9583b46e, 0x8b7e8b70, 0x0000a1dc,
+        0xce2ace17, 0xb1a3dc84, 0x141c14be, 0x000089c8, 0x57b85789, 0x05c6a947, 0xb105b197, 0x00009cc8, 0x71fa7132, 0x6a9d71d9, 0x886088b8, 0x0000e17b,
+        0x8f918f2f, 0xae0dae49, 0x4b324bd2, 0x0000412e, 0x5cbd5c37, 0x6610769d, 0x8d448db0, 0x0000bb81, 0xcf80cf57, 0x764e9c61, 0xe12be1a8, 0x0000dfb7,
+        0xdeb2de22, 0x847757b1, 0x663f66b3, 0x0000e689, 0x4e434e99, 0x41ef2b30, 0xa4b7a4b5, 0x000075f3, 0x633763ad, 0xb9cc5740, 0xd19bd1fa, 0x0000e66c,
+        0x569b56bc, 0x085ca44e, 0x915d917f, 0x0000701a, 0x5fb65f6a, 0x71bc5601, 0x9f539f50, 0x0000b742, 0x37d6377f, 0xe8c14711, 0x89078996, 0x00009a90,
+        0xa3aea305, 0x155b0734, 0xfc5efc2f, 0x000080a7, 0x9f959f67, 0x8a794fcf, 0xe830e859, 0x00003b26, 0xbbfcbbac, 0x6e50af0b, 0xc516c5ce, 0x0000c582,
+        0x145214f8, 0x2e63b3e4, 0x37a237e4, 0x0000d264, 0x9461947c, 0x5c176524, 0x26cc263d, 0x000032ce, 0x27c02762, 0x349846bc, 0x5d3c5de3, 0x00008261,
+        0xadf8ad65, 0x6023e832, 0x27ca2791, 0x000095b7, 0x8b998b1b, 0x4064d476, 0xb92fb902, 0x00005768, 0x3842384d, 0x05045770, 0x024702cc, 0x0000b2d3,
+        0x59a6595e, 0x3d57ec52, 0x02ee021d, 0x00007bc0, 0xa796a735, 0xc9a56f35, 0x3b233b9e, 0x00000850, 0x1e071e97, 0xdc05ce51, 0xdf36df3b, 0x00002744,
+        0xace6aca3, 0x6bfd8dfe, 0x5965590c, 0x000072e5, 0xfaecfafd, 0xbd9a1968, 0x73a87337, 0x0000c09c, 0x09100996, 0x7a0586cc, 0x25d325d2, 0x000037e4,
+        0x22aa22bd, 0x72ddc871, 0x143c14b7, 0x0000e345, 0xeac3ea4b, 0x2ff7f3b2, 0x3b4b3bd7, 0x0000ee5f, 0x258d258b, 0xf0b6b1a6, 0xf6a7f658, 0x0000f738,
+        0x5bd55b45, 0xda7812da, 0x0b540b26, 0x0000de1d, 0xa966a9a0, 0x5d68749b, 0x073407e9, 0x000074b0, 0x6eed6e88, 0x52241c0a, 0x1136116b, 0x000056be,
+        0x52f0523b, 0x9716675a, 0x2a6f2a85, 0x0000ddc4, 0x3b223b6f, 0x8ac72805, 0x673a6750, 0x00000433, 0x1f651f2e, 0x01b382cc, 0x65326529, 0x00009ad1,
+        0x91a29144, 0x100da9b8, 0x366836ef, 0x0000f31d, 0x34153443, 0x4cb44718, 0xc4f6c4fa, 0x00005009, 0x247224b2, 0xfedea431, 0x0f600f34, 0x0000a859,
+        0x48c148fd, 0xf5315a63, 0x73ff73d6, 0x000030d4, 0x777a7700, 0x238093c7, 0x3e6c3e97, 0x00003482, 0xdbaadbdb, 0x162e62a3, 0xa964a9dc, 0x00005984,
+        0x921a925b, 0xa5f4a1f2, 0xcbf4cbbe, 0x000026cd, 0x30213080, 0x0744a5d3, 0x733d73c0, 0x00008321, 0xcb3ccb9e, 0x7c8bdd1c, 0xc842c84d, 0x0000e7a4,
+        0x06710684, 0x2bc0ce51, 0x701570d8, 0x000046cf, 0x876b8703, 0x12fccef7, 0xf7b9f751, 0x0000c8ce, 0x5b795b56, 0xfc48ec4c, 0x31143133, 0x0000e107,
+        0xa6ada6a6, 0x13a7441d, 0x644b64a2, 0x0000085d, 0x3f0f3f23, 0x3f873338, 0x93119354, 0x00001416, 0xbf93bf50, 0x4e2733df, 0xad34adf6, 0x0000874a,
+        0x46024635, 0xfd956d45, 0x81dd818f, 0x0000a7d9, 0xf75af701, 0x27d23871, 0x8a1f8a42, 0x00004392, 0x422e4236, 0xaac5854c, 0x08e808f5, 0x000014d6,
+        0xac77aca8, 0x4bf67dfd, 0x4e444e42, 0x0000b704, 0x9606964e, 0x0234fcac, 0xc1fdc1b0, 0x00001f7a, 0xbea1beb5, 0xcf7a7766, 0xd622d6b5, 0x0000e126,
+        0x88a08861, 0x8c1cbdf6, 0x31c031a7, 0x00005cd6, 0xe871e803, 0xe0a36eea, 0xbcb9bc09, 0x00000f1c, 0x0b320b78, 0x63a1aa20, 0x8be38b30, 0x000096d5,
+        0xfd2cfdb3, 0x835e8ea5, 0x7f2c7f28, 0x000077ee, 0x430d4376, 0x9f3baffc, 0xb034b0ef, 0x0000bb35, 0x71a371ba, 0xe80edde9, 0x70547046, 0x00004ba3,
+        0x4b554bc5, 0xe662a94a, 0xeed3ee67, 0x000044b0, 0xb137b10c, 0xae9a688b, 0x9bfa9be7, 0x0000f718, 0x2ddf2d1a, 0xe6bcda3c, 0xaa0daa6f, 0x000094a6,
+        0x2fdc2f5c, 0x15390aab, 0x462e4646, 0x0000b533, 0xf183f1f3, 0x0b344858, 0x79af79c3, 0x00007467, 0x7ce17c12, 0x5bfd45f8, 0x746b7495, 0x00006191,
+        0x36aa366a, 0x1c8aa887, 0x534953e9, 0x00004b9f, 0x4385430d, 0x82f7881f, 0x6b1b6bb2, 0x00003913, 0xf9b4f982, 0xa90d3fb9, 0x67c9673e, 0x00008bc9,
+        0x95c89528, 0x7346fb4e, 0x6625661c, 0x0000a46f, 0x0be30b4e, 0xa8d1acfe, 0x325e3216, 0x0000fd0c, 0x585a586e, 0xb21345b9, 0x96cc9690, 0x0000263e,
+        0xce29ce1c, 0xa8848070, 0x00db00f6, 0x0000916d, 0x46b646fd, 0x8d46d40c, 0xc762c77d, 0x00003833, 0x53f55355, 0x97d7da5d, 0x34a83478, 0x000099aa,
+        0x79d379c0, 0x02fa4d7c, 0xceacce07, 0x0000fde2, 0xf536f5b1, 0x401202e8, 0x5a605a2b, 0x0000d4f9, 0x4c734ccc, 0xbc4bcad1, 0xb9beb93d, 0x00000583,
+        0x1d271d1b, 0x73a8595c, 0x76f97613, 0x0000eb65, 0x66f46604, 0xfddece2e, 0x5a285a7f, 0x0000abe9, 0x331e3374, 0x5e8da2e0, 0x9d919d9a, 0x0000085d,
+        0x6a956ad6, 0xd38191b0, 0xfa7afa80, 0x0000a055, 0x15d915c1, 0xce2d9c61, 0x5735570d, 0x0000b08e, 0x707670f0, 0x99f1c2db, 0xe5c9e534, 0x0000c778,
+        0x5726578a, 0x00a02579, 0xa003a095, 0x00000364, 0xfdf9fd6a, 0x20d2f30a, 0x38f5382e, 0x00005ad9, 0xec7dec6f, 0xb2db996c, 0x5c155cc9, 0x00005360,
+        0x64e0644c, 0x7e29e21b, 0xc26ac2a7, 0x00005f64, 0x9584953d, 0x8c60f357, 0x63b6630e, 0x00006447, 0xc156c154, 0x96b6cd90, 0x44584484, 0x0000b33d,
+        0x3ad53a3a, 0xb601fcfa, 0x1db71d80, 0x0000bd11, 0x23522302, 0x41eee9cc, 0xeb46eb3d, 0x00007673, 0x830d837a, 0x975c8fc1, 0x6ef06e56, 0x000089f2,
+        0xdabeda21, 0x21f30348, 0x53125385, 0x0000fc23, 0x83dc8347, 0xcbebb894, 0x29572901, 0x00008ef2, 0x179217bd, 0x2f1f02f4, 0x3f863ff3, 0x0000be9e,
+        0x894489b0, 0xd25458e3, 0xee53ee88, 0x000022b6, 0xe037e088, 0xfc2f3323, 0x51295119, 0x0000f0ec, 0x223622ce, 0x93c9abf7, 0x15491515, 0x0000b8ee,
+        0xe50ce551, 0xc585e7e1, 0x34513497, 0x0000e958, 0x0f520fed, 0x1383b6ee, 0x316d319e, 0x000092c3, 0xd987d946, 0x27c032e0, 0x5ce95c4e, 0x0000b6a8,
+        0x0313032f, 0x75874033, 0xfc8bfc9f, 0x0000f618, 0x72e8723c, 0x0ad7fc47, 0xfcc1fcdc, 0x00006b2a, 0x6cda6cc7, 0x86d52629, 0xdaefdabe, 0x00000972,
+        0x364936db, 0x4bc97719, 0x734173f9, 0x0000a6af, 0x45514566, 0x5466008e, 0x0b430bfa, 0x0000f71a, 0x1df71d19, 0xaf4c105c, 0x0d660d44, 0x0000ebd6,
+        0x4c3c4c9a, 0xd0db47c9, 0xfcb4fca9, 0x00006790, 0xa93ba983, 0x9b4f0311, 0xd923d928, 0x0000e2a4, 0x31763177, 0x9aa6d8e6, 0xf3b3f386, 0x0000385c,
+        0x4f7c4f55, 0x95b8b6ec, 0xe198e139, 0x0000f1a4, 0x594f591b, 0x77ff1310, 0x920492a0, 0x0000bc6b, 0x6a336a36, 0x8027a3db, 0x4915499f, 0x00008271,
+        0x00d400c2, 0xc284c2ed, 0xc5b6c561, 0x000026a5, 0x6492647e, 0x6d50dc97, 0x26ad269a, 0x0000b4b6, 0x2a082a05, 0x6e02d5ca, 0x2255228c, 0x000035ac,
+        0xe77de73f, 0x4f36ec58, 0x47b94747, 0x000040e7, 0x34083455, 0x321fa82e, 0x3e7d3e67, 0x00008b2d, 0x03e70336, 0xcff4b274, 0x7eb17e8a, 0x0000cd8d,
+        0x5ed55e31, 0x74d29478, 0x102310cf, 0x0000c3d0, 0x1cf91c86, 0xe852a4ab, 0xc845c88c, 0x0000c707, 0x166d1668, 0x6f60b566, 0xc616c63d, 0x0000c7fc,
+        0x62fa62ca, 0x1d4e853c, 0x9adf9abb, 0x000086ff, 0x81028185, 0xe0a37dc1, 0x867b8614, 0x00003d88, 0xa22da2e4, 0x3c9ae1ec, 0xb7bab7f3, 0x000084a2,
+        0x8fd88f3e, 0xfb70494d, 0x901e904d, 0x0000d6a7, 0xb093b083, 0x42c6b3d8, 0x169c16cb, 0x000010fc, 0xe06ae0d8, 0xb5547ec2, 0x66596632, 0x0000312f,
+        0x5de55dc3, 0xcd8ab30b, 0xa26fa203, 0x0000d387, 0x56e156f3, 0xdadbc9e1, 0xd984d9cc, 0x00009bc9, 0x17481708, 0x88bb3c4d, 0x325b3215, 0x00008294,
+        0x150c159f, 0x6d7d0955, 0x502050ef, 0x00002741, 0xc9dbc988, 0xe8315cdd, 0x4cd44cef, 0x0000eeab, 0x602c6071, 0x64157e84, 0xba3ebaf4, 0x000082a2,
+        0xc4b5c4ce, 0x29183eb1, 0x573957e0, 0x0000aeb3, 0x7bac7bb8, 0x275d559e, 0x61c861ca, 0x0000a055, 0xa2a2a23b, 0x76dd8582, 0x8e6f8eed, 0x0000854c,
+        0x5f295f26, 0xf1df2509, 0x2aa42a6b, 0x0000cc13, 0xa342a368, 0x20d01c55, 0xbda9bda9, 0x0000ed5f, 0x865e8682, 0x4f598edc, 0x2b842b30, 0x00003340,
+        0x0ea50e60, 0x5b77e0bd, 0x497749d4, 0x0000908a, 0x8e698e2f, 0xe01e76dd, 0x6f636fce, 0x0000ceaa, 0x3f013f9e, 0xadd32ab2, 0x1d0a1deb, 0x000004cd,
+        0x026702b4, 0x4c36e03e, 0x1383138d, 0x0000201a, 0x05a005f2, 0x7802fd4c, 0x95e395f6, 0x00005598, 0xdca5dc43, 0x416637fe, 0x79c87988, 0x00005d54,
+        0x2d062d8d, 0x145ed06a, 0x97359736, 0x00002e1f, 0x149c1415, 0x5cb25c6c, 0x3cf63ca7, 0x0000bafe, 0x333d33a7, 0x255d5c51, 0xcc37cc5c, 0x00007d3e,
+        0x7a557a98, 0xe35882f0, 0x075e0708, 0x0000dd67, 0x1e8a1e6b, 0x9ee6463b, 0xc754c72e, 0x00005cb0, 0x6dd36d49, 0x07f9f7d4, 0xe34fe302, 0x00008060,
+        0xef85ef5a, 0x0c5a980a, 0xdf33dfe1, 0x0000c5b1, 0xa423a440, 0x249277a6, 0x5b135bca, 0x0000bb8e, 0x47d74736, 0x96886c63, 0x8c538c46, 0x000045e5,
+        0x07c407d3, 0x56fe430d, 0x1b611be7, 0x00003972, 0xce36cec1, 0x6358fab3, 0x78437861, 0x000048a3, 0x81a3815f, 0x51d28506, 0x5ab85a18, 0x00002128,
+        0xdeecde3a, 0x486a5a5f, 0xa6f8a60d, 0x00006c59, 0x94e0943f, 0x33c3ef4e, 0xc84fc886, 0x00003b79, 0x1ffe1fa1, 0xbd6c34ff, 0x6a026a4f, 0x0000dc39,
+        0x72c572cb, 0xb4403b30, 0xf963f9ab, 0x0000ae64, 0xa877a862, 0x7ce1e297, 0x3d643def, 0x0000b0f2, 0xdcd5dcda, 0xca45afdf, 0x91c7911a, 0x0000785e,
+        0x9e439eb9, 0x88a47fc4, 0x1893184c, 0x00001358, 0x1ecb1ec9, 0xa5836b75, 0xc864c89c, 0x0000269c, 0xa7b9a7fc, 0xf16428b4, 0x5df95d04, 0x000012e9,
+        0x6ccb6cf4, 0x45262946, 0xa386a350, 0x0000cbf2, 0x0efa0e12, 0x3ba1ebcc, 0x487948d2, 0x00008f69, 0x8f488f03, 0xfe3d4042, 0x132a13f5, 0x00007960,
+        0xd05ad06e, 0x1ff3cb22, 0x81a18182, 0x00004ef6, 0x392939f7, 0x635b5ba5, 0xcf73cfab, 0x0000a907, 0x24ed246c, 0xf8498636, 0xb9b9b937, 0x00008718,
+        0x88d28849, 0x142f35be, 0x4c9e4cbe, 0x000018ac, 0x3e563e5e, 0x9bfe3aa0, 0x00420020, 0x000018e3, 0x06100655, 0xbf2b57ce, 0xbd9dbd8f, 0x0000da6c,
+        0x143114ba, 0xb61a84f0, 0xcf75cf3f, 0x000048ea, 0xf5e4f5ae, 0x2ad2675a, 0x51515151, 0x000022c5, 0xcfe5cff7, 0x1868b3d8, 0xc0aec0fd, 0x00001a92,
+        0x774877fd, 0x1c099738, 0x671867c3, 0x00003d92, 0x1b191b33, 0xf4b7748d, 0x401e4096, 0x0000a964, 0xd75ad781, 0x37e89a6a, 0xe9f2e986, 0x00008131,
+        0xb52bb59d, 0x12de1355, 0x400140a1, 0x0000bb31, 0x56035653, 0xf3e9810a, 0xed68ed60, 0x0000b7b6, 0x62f562c8, 0x786d3290, 0x9f5e9f43, 0x00005d6e,
+        0x27062790, 0x08ebad3f, 0x97af972d, 0x0000e7c2, 0x6c2f6c8b, 0x220fed4d, 0x98bf9836, 0x0000c54c, 0x512d5171, 0x06f4e423, 0xc985c9f1, 0x00003a8c,
+        0xc130c1c4, 0x8ec4c77a, 0x40ae4000, 0x000036d4, 0xeb67ebe1, 0x3b6ee47d, 0xc359c37c, 0x0000ad38, 0x66c9665a, 0xf45616fe, 0xd509d533, 0x0000fffd,
+        0x6d4c6d61, 0x99b30349, 0x944194a4, 0x00000b53, 0xc931c98d, 0x2a66b429, 0xf5a1f53c, 0x0000ffec, 0xa7f6a774, 0x6700c23c, 0x72ff7216, 0x0000af66,
+        0x071f07b9, 0x2430938c, 0x8a198a35, 0x000015ba, 0x0a190ac1, 0xfb33cbf5, 0x5f845f41, 0x000070ef, 0xcda3cdea, 0x6b1cdfd8, 0x832a8348, 0x00006db5,
+        0xebf6eb19, 0x9f91d292, 0x5a105aac, 0x00006a15, 0x821282a9, 0x118ed149, 0xe4aae494, 0x0000cdf0, 0x24092461, 0x071554b1, 0x8ce18c01, 0x00009c79,
+        0xaea2ae48, 0xc65b1c53, 0xdb88db8e, 0x00008b2f, 0x12ee1238, 0x87a8d0c0, 0x18181876, 0x000000bb, 0xa2b7a2f0, 0x33cfaf7b, 0x8e078eda, 0x00003406,
+        0xd8c7d8a0, 0x7547ea0d, 0x908f90d3, 0x000049a8, 0xfe21fe02, 0x31290329, 0xb3d6b39d, 0x00001014, 0x11f31180, 0xaa33f0aa, 0x1e241e93, 0x0000987b,
+        0x4dff4d30, 0x660c925b, 0x79e679c4, 0x0000efd6, 0xeb49ebd5, 0xfe51b820, 0xa206a2aa, 0x0000f873, 0xa020a0e1, 0xa1c35a2c, 0xaa79aad3, 0x0000802b,
+        0xdc54dc7e, 0xf176ddd4, 0xceb0ce25, 0x0000e7d2, 0xb56eb528, 0x5574d2d4, 0x7b297be2, 0x0000d348, 0x9a1e9a6a, 0xcc7a19d5, 0x3a1a3a88, 0x00009667,
+        0x8a708abb, 0xa183e213, 0x0eb70ef6, 0x0000de64, 0x34f334ba, 0x9373357f, 0xb462b4c0, 0x0000460b, 0x05560540, 0x4116841c, 0x88eb8817, 0x0000ddb3,
+        0x91279156, 0xb4a3af1c, 0xf0e9f068, 0x0000755e, 0x2705274f, 0x2f1fbc49, 0x8251822e, 0x0000a7e4, 0x21192179, 0xffce9035, 0xb150b191, 0x0000be31,
+        0x5fdb5fd7, 0x7fba4c2a, 0x6a8f6a82, 0x00003b4c, 0x81618134, 0xb5cc9228, 0x8c9a8c0c, 0x0000c9aa, 0xdba4dbe0, 0x12189ff5, 0xaa81aa11, 0x00002366,
+        0x323d328e, 0x15e70994, 0x3dbc3d2b, 0x000053fb, 0xef0cef56, 0xd2d4b3da, 0xe74de7ae, 0x000076e0, 0x24792423, 0x158a2026, 0x79b47985, 0x00008980,
+        0xfa55fa13, 0xf457ed6d, 0x173717ae, 0x0000703b, 0xa387a3a3, 0xd23ba021, 0x1e881e9a, 0x00005ae8, 0xd899d838, 0xee137934, 0xbff7bf36, 0x00007b2a,
+        0x923392f4, 0xebf23e4c, 0x73c573da, 0x000038a4, 0xe36ee32d, 0xa1606ea4, 0x4ff14ff7, 0x00005b54, 0x98659850, 0xecffe3a2, 0x3d0d3deb, 0x0000e10d,
+        0xd780d73c, 0x86b81019, 0x8c228c58, 0x0000dabb, 0xaa4caa9a, 0xcc27a0ce, 0x21ea21bf, 0x00001588, 0x1fab1fd7, 0x051bc7ba, 0x1c671c6f, 0x0000ba10,
+        0x11d711f3, 0x728e3bce, 0xb5eab51f, 0x0000dd3f, 0x29e329bf, 0x8f96bcca, 0x424e42b6, 0x0000479f, 0xda0ada1f, 0x71666a42, 0x240c241c, 0x0000e4a9,
+        0x6134617f, 0xac2c5240, 0x60a46028, 0x000009d3, 0x2e132e88, 0xe4e1ab3f, 0x55785504, 0x00009608, 0xe317e327, 0x181f55ce, 0x010a019c, 0x00007660,
+        0x434f4391, 0xeef25aa3, 0x90b290cf, 0x0000a085, 0xfbf5fbea, 0x7eac24eb, 0x05b80561, 0x00008f57, 0x372c3747, 0x92268790, 0xb67eb6b6, 0x000015d6,
+        0x260a2660, 0x939db61c, 0xf6fef6ee, 0x00005dfd, 0xbcaebcb0, 0x4361ca71, 0xa603a697, 0x00002e66, 0x56de56ab, 0x4de92d6d, 0x06e50694, 0x00006684,
+        0x65066598, 0x7dacb201, 0xcc03cc0f, 0x0000e9e3, 0x2e372ec9, 0x4790a31a, 0x260e2626, 0x0000959b, 0x4fbb4fe2, 0x1f3dc9aa, 0x728672a3, 0x00007e9c,
+        0x3bec3b66, 0x1555b5ad, 0xf907f926, 0x0000c844, 0x993599b3, 0x30b0a6d1, 0xfc5ffc74, 0x000049de, 0x982398a8, 0xe4c2e4df, 0x316531f1, 0x0000aee9,
+        0xf23df279, 0x7c1cf89d, 0xfc98fc2f, 0x0000a7c9, 0x0ab50a28, 0xfd82db26, 0xe41be4c9, 0x00003c06, 0x3e893ec7, 0xf4c20ba6, 0xf999f920, 0x00006547,
+        0x9abf9a34, 0x4af6b696, 0x90ae902d, 0x000045a9, 0x597f59db, 0xc34b8e3d, 0x776f77ce, 0x00008aff, 0x4ebf4e32, 0x8604ae98, 0xc817c8e4, 0x0000ae09,
+        0x303530c4, 0xe423504c, 0x7b177ba5, 0x00003cd2, 0xac18ac51, 0x8eb8b7f8, 0xc9acc948, 0x000023ea, 0x0fe50f6d, 0xece19227, 0xddb7dd6b, 0x000092cb,
+        0xc344c337, 0xe0808dba, 0x40024060, 0x0000e145, 0x6d0c6d4c, 0x5e3809eb, 0xd751d703, 0x00002466, 0x21572101, 0x1d1f2428, 0x79d37931, 0x000089be,
+        0xe1c8e1ae, 0x17da1c21, 0xc716c7c2, 0x000033b5, 0x41ac41b1, 0x550d42f5, 0xfb9afb9f, 0x00007672, 0xf042f085, 0x4a8633ff, 0x6f1d6f5e, 0x0000a2b1,
+        0x3667363f, 0x774a15c3, 0x0c2e0ced, 0x000049a9, 0x8be88b7e, 0xce872211, 0x649c6472, 0x000066b0, 0x9aba9a68, 0xb51f9a28, 0x642a6451, 0x0000b934,
+        0x5ee25ec0, 0x8e177151, 0xcea6ce8f, 0x000056db, 0xe2c0e246, 0x2cf04247, 0x9d5a9d99, 0x0000ffa1, 0x1fd81fea, 0xd49299a9, 0xec6eecd9, 0x0000dada,
+        0xa36ea355, 0x9c2975e2, 0x8b388b11, 0x0000fdfc, 0x286a289b, 0x0d4fdfe4, 0x8b8b8bc2, 0x00008673, 0xe657e6a7, 0x4d0a6b4b, 0xb075b020, 0x00005539,
+        0x803f80aa, 0x1815833f, 0xe7b7e70f, 0x0000678b, 0x76ec76d3, 0x768fb73f, 0x974c97b1, 0x0000c112, 0x9e889e6f, 0x45f996c5, 0xdc5edc21, 0x00000564,
+        0xd52cd5c2, 0x9a07c37f, 0x26d326ad, 0x0000307e, 0xfaf1fa9b, 0x570d1355, 0x8133812d, 0x0000d3eb, 0x28f62828, 0xf9ceb4d8, 0x863786c7, 0x0000d5c9,
+        0x137f1340, 0x53cbbd32, 0x851c85bb, 0x0000417b, 0xbacbba3f, 0xa881a7b3, 0x28852880, 0x00002456, 0x395f3917, 0x220f6158, 0xba59baa5, 0x0000a413,
+        0x5fb25f22, 0x5e0f38f2, 0x9b789b2e, 0x000018e3, 0x48d1482e, 0x94a6f824, 0x445b4492, 0x0000fdd2, 0x8d498d43, 0x1271fb1e, 0xdb6adb1a, 0x000069b0,
+        0x0a0b0acb, 0x534e3038, 0xe6e1e6a0, 0x00001c92, 0xba0fba80, 0x1e6af728, 0xcef6ce4c, 0x0000959b, 0xa8a0a832, 0xa441a603, 0xd542d51d, 0x0000afa6,
+        0x82c8825e, 0xed92cc7c, 0xf70bf7cc, 0x000020c5, 0xd803d84a, 0x422972a9, 0x344f3417, 0x0000ddcf, 0x502b5080, 0x2aa22a42, 0x37513796, 0x0000cb95,
+        0xd6fbd620, 0xc724cdee, 0x49b7495c, 0x000063aa, 0x7c387c44, 0xb9735ee3, 0x13f3135c, 0x00002fa4, 0xb54ab564, 0xa033cf6e, 0xfc43fcfc, 0x0000412e,
+        0x973697c7, 0x250fd038, 0xd562d583, 0x0000e532, 0x82ec82f3, 0x93dcc18c, 0x9ab19a13, 0x0000e915, 0xd0ddd05e, 0xe31ee6a0, 0x39a33914, 0x0000aee9,
+        0xeccfeca9, 0x21ed3510, 0x4b394bd8, 0x00006289, 0x46054681, 0x9d069739, 0xc435c454, 0x000049a8, 0x740c7462, 0x00651c1b, 0x326d327a, 0x0000cefd,
+        0xd446d40e, 0x320c8c5e, 0xb93ab915, 0x00009d91, 0xa3e4a339, 0xe2ce495b, 0x24962454, 0x000020ba, 0x89dd894a, 0xcd5b1318, 0xf733f799, 0x00007ea3,
+        0x25ab2521, 0xbacd853a, 0x6ab16ab9, 0x0000fd96, 0xd3ded389, 0xa0fc25ac, 0x30753035, 0x0000b2ae, 0x0fc00f52, 0xba4d388e, 0xb6d0b67e, 0x0000bf79,
+        0x763376fc, 0x6bbf9b33, 0x1fae1fb9, 0x0000213e, 0x417f4102, 0x7b1e120a, 0xf1e0f156, 0x00003007, 0x6a9c6a5a, 0xe663f02b, 0x78ca788c, 0x0000ae76,
+        0x41d14100, 0xe23571a9, 0x1aeb1aa1, 0x00002487, 0x808e8058, 0x18c80284, 0xfdf4fded, 0x000048f3, 0x9380933c, 0x2d438bac, 0x2ac32a68, 0x00005506,
+        0x6db56dd9, 0x8796153e, 0x033a0312, 0x0000d8f4, 0xd47cd4c9, 0xbe62bdcb, 0x529152c2, 0x0000445d, 0x2e342e41, 0x3e0ad867, 0x91eb91a2, 0x00008263,
+        0x0b340b5a, 0x246db7d8, 0xeabdea36, 0x000095b7, 0x692169ff, 0x3410f30a, 0xfb70fbf4, 0x0000b3c7, 0x97e4977c, 0x11aad235, 0x5d805db9, 0x00005ea7,
+        0x3d143d4e, 0x108a12fd, 0xbc89bca0, 0x0000273a, 0xe66de6d8, 0x709b33ce, 0xeb4cebe8, 0x0000644f, 0x33df33cd, 0x92af2756, 0xf0cef008, 0x00000fbd,
+        0xed79edaa, 0x4b86be1f, 0x0d970ddd, 0x00005484, 0x9fc29fda, 0x92cb5d95, 0x636f6332, 0x0000880a, 0x394f39da, 0xb50086cf, 0x62b162e9, 0x0000f1aa,
+        0xe636e6fc, 0x89046090, 0xe2f3e2b4, 0x00006e22, 0xa125a17d, 0xe8333fce, 0xa075a035, 0x00001c3b, 0xecd6ecdd, 0xa77efc26, 0x185d18a0, 0x000098f6,
+        0x0a1a0a57, 0xfbcc0867, 0xfb5afb3b, 0x000070b0, 0x24c92489, 0xd3b06aca, 0x9e649eae, 0x0000459d, 0xb5aab5df, 0x39b7cad8, 0xbf78bf8a, 0x0000a6b1,
+        0x3c6d3cde, 0x37018683, 0x6e056e2d, 0x00002c86, 0x93229356, 0xa9811fef, 0xc754c7a3, 0x000031ab, 0x94a094ff, 0x262146ad, 0x59c159d6, 0x000073ee,
+        0x9da59dff, 0xf757167d, 0xe551e5ee, 0x0000df57, 0x2a6c2ad3, 0x581dc23e, 0x7ece7e08, 0x000004ac, 0x518c51d2, 0x02289c6a, 0x71aa7130, 0x000099c8,
+        0x2bd72be1, 0x002486c7, 0x3a683ac3, 0x000028e7, 0x29ee2929, 0x9d8dac95, 0x8b018bb8, 0x000044a3, 0xe510e596, 0xebef62d5, 0x66a9660d, 0x0000f640,
+        0x98d99850, 0x5ab9cfce, 0x23de23d1, 0x000064ae, 0x65d36509, 0xcf4c11c6, 0xf3b5f3db, 0x00000100, 0x27a427e4, 0x29c14dd5, 0xe23fe26e, 0x000030b6,
+        0x30583076, 0xbd8bdacb, 0x714b71e6, 0x00002556, 0x2a312a26, 0x1f4c1bec, 0x76be76f8, 0x0000092c, 0x50495035, 0xb5f72326, 0x506450f4, 0x00002486,
+        0x54035450, 0x9cce2a8e, 0x5aa65a16, 0x0000729a, 0xd13ad1f7, 0x9c59ee4c, 0x3bbd3b2c, 0x0000fa1d, 0x9c279ce5, 0xab9babaa, 0xda74daf8, 0x00003c6c,
+        0x2e122ecb, 0x43c6bc5a, 0xe6a9e68c, 0x000016f5, 0xea7eea95, 0xae7b00ca, 0xcfe8cffa, 0x00005cae, 0xce0bce97, 0xa51a0734, 0x98cb986a, 0x000048a9,
+        0xc355c32b, 0x650cdea5, 0xe465e470, 0x0000591f, 0x8d208d3d, 0x34191b53, 0x577a57c7, 0x000064c9, 0x22422204, 0xac5ba97b, 0xaf83afbf, 0x0000b2af,
+        0x2cc62cab, 0x495f30df, 0xbe55be16, 0x00008cfa, 0xea05ea0c, 0x2f2dc2c7, 0xfc5afc4c, 0x0000f054, 0xbb03bb54, 0xda54a5a9, 0xce70ce3e, 0x0000c32c,
+        0xcacaca69, 0x7b8591c7, 0x3c8e3c0f, 0x0000dc34, 0xc49ac44d, 0xa9d1e75d, 0x6b646b32, 0x00008fef, 0xd9fbd93a, 0x5cb1ddc4, 0x531153ab, 0x00004d7d,
+        0xfb66fb60, 0xf7510074, 0x2a2c2a59, 0x00008972, 0x971d97de, 0x30ce7132, 0x1f961f90, 0x00005624, 0xfb75fbb0, 0x0fa94545, 0x828e824f, 0x00001eca,
+        0x61c861a1, 0x90681cec, 0x8b328b12, 0x0000de18, 0xaa67aad1, 0xd3a7cc96, 0xcf19cfd8, 0x00007051, 0xa2faa227, 0xc8451366, 0x84a58495, 0x0000e1cb,
+        0x3a913aa0, 0x8f18cf51, 0x3c323cbe, 0x0000bf9c, 0xe9ebe93b, 0x85aab937, 0x4cde4c7b, 0x0000ac3f, 0xc58dc5f9, 0x5307fada, 0x6437646c, 0x00000ff9,
+        0x80c380fc, 0x42292ec9, 0x63ac630d, 0x0000f588, 0x4a614a65, 0xf1032d12, 0x863c86fd, 0x0000ec48, 0x77c47777, 0x28c0dcc4, 0xf414f4e6, 0x0000c4c5,
+        0x14af1435, 0xb57192c7, 0xdb0edb3a, 0x0000bfbb, 0xe270e2af, 0x95ca6525, 0x167f1605, 0x0000d735, 0xb305b3a9, 0xaa5bd084, 0x118f1126, 0x000081a2,
+        0xcd02cdcc, 0xb6006877, 0x755975b0, 0x0000174c, 0xc8e5c843, 0x6683cd51, 0x7e2b7e58, 0x0000abfa, 0x35563512, 0x1d2aef0a, 0xbb7cbbdd, 0x00000100,
+        0xdb99db95, 0x48f77d7e, 0xb211b2c7, 0x0000c6d2, 0xee7eee65, 0xc08a5151, 0x388d3806, 0x0000bf7a, 0xcfe2cf12, 0xb475d22c, 0xded4dee8, 0x00008ab0,
+        0x281028ce, 0xadc5c1fe, 0xa706a7cf, 0x0000da1b, 0xc0a5c0f6, 0xb3904de9, 0x5479541a, 0x00000cbd, 0x20a52035, 0x7ce32ebf, 0xe432e4f7, 0x00005a9a,
+        0x8d818d33, 0xfa19f32a, 0x46a3462d, 0x000088e4, 0x7f3f7fa5, 0x0812d731, 0x91779139, 0x000099a8, 0x48754804, 0xa651d901, 0xf58af59f, 0x0000370f,
+        0x88ac8865, 0xb7cc0795, 0x22532282, 0x00007025, 0x77d97775, 0x0c8bcca7, 0x55a65504, 0x00007619, 0x633563be, 0x791fe83c, 0x091e09bf, 0x0000e093,
+        0xb517b578, 0xa7e294c7, 0xeea8eeb1, 0x000022ea, 0x264b264a, 0xfed10208, 0x068b069a, 0x0000a1dd, 0x8301839e, 0xc627c418, 0x804380a8, 0x00005cd7,
+        0xf903f964, 0xf74447e6, 0x1a8f1a64, 0x0000e920, 0x5d2f5dd7, 0x0a5851cd, 0xa4b8a466, 0x00008a1a, 0x1152115c, 0x334770d3, 0x42a64253, 0x00004a77,
+        0xa850a896, 0x51d87623, 0xd325d3b3, 0x0000f598, 0x773d7739, 0x151c87ec, 0x550e5554, 0x0000f4d8, 0x354735d0, 0xd5cbd8e4, 0x0c2b0c1b, 0x00008c30,
+        0x88dd88d4, 0x9392adc1, 0x005a0051, 0x00003ce6, 0xc053c02a, 0x02a633a5, 0xd082d073, 0x0000e3b2, 0xf066f03d, 0x199956b1, 0xb8e9b8b4, 0x00009615,
+        0x05d10554, 0xe6a33220, 0x9dad9db2, 0x0000d18f, 0xf236f2bc, 0x6a9f9f6a, 0x6fcc6fc7, 0x0000f255, 0x7d037d42, 0x26207869, 0xc0a9c063, 0x0000e303,
+        0xa0eea0aa, 0x71b5c343, 0x2ab92a8a, 0x00007f02, 0xa2e9a207, 0xc32bf7a9, 0x18ac18a1, 0x0000d13b, 0xc4f8c491, 0x5c0fb6ea, 0x91119168, 0x00002a05,
+        0xefc5efc4, 0xed66d336, 0xf172f12a, 0x0000874d, 0x4bd24bb0, 0x8e4742ad, 0xd73fd7c5, 0x00004af3, 0x7d287d3d, 0x5eb2e421, 0xe020e0ff, 0x0000410d,
+        0x5a185a37, 0xf8aa50cd, 0x321f32cc, 0x0000ce10, 0x4d164dc2, 0x3829f873, 0xf6a5f6e4, 0x00000563, 0x5023501b, 0x677a41b9, 0x992c99f8, 0x0000bd62,
+        0xd8a0d81b, 0x660cdb84, 0x818f8146, 0x0000c1f2, 0xe23de2fa, 0x6a7f038e, 0x3b303b70, 0x0000741e, 0xa6fca6da, 0x012c0e5a, 0x98dd9865, 0x00005045,
+        0x37d437c4, 0xe08de9cd, 0x610b6118, 0x0000e66a, 0x196719a1, 0xadccbb58, 0x044a04ee, 0x000045bb, 0xb6b1b647, 0x694e5465, 0x506350c9, 0x0000e10b,
+        0x95399528, 0xf52a8993, 0x493149eb, 0x00004012, 0x88c28845, 0x61edda5d, 0x7ffd7f56, 0x000013e2, 0xa93ba92f, 0x5ad81e1b, 0x9db79d6d, 0x00007423,
+        0x7e407e5f, 0x8f65f6f7, 0xff8cff28, 0x00001dd3, 0x999b9938, 0x9d212dfb, 0x16d516db, 0x00005438, 0xf63df6b8, 0x1c4d3880, 0x19ae19ad, 0x0000b713,
+        0xe314e3f0, 0x9371da5d, 0x06b70680, 0x00003135, 0x6b3a6b6f, 0xe32059dc, 0x82998285, 0x000063f6, 0x1a831ae3, 0xa1adfcc5, 0x3b303b66, 0x000046ef,
+        0xf085f02c, 0x567416ab, 0x080308f0, 0x000014b5, 0x13e61325, 0x41ef7c09, 0x0c290c3b, 0x0000c01b, 0x43d043e0, 0x2ad6322f, 0x74e774ed, 0x0000dfb7,
+        0x2f462f95, 0x6403b795, 0x3ba73ba6, 0x000077d1, 0x02de0283, 0x50acdaa2, 0xb199b1de, 0x00004212, 0xfde1fdff, 0x067b4e82, 0xb1d9b181, 0x00001c33,
+        0x97d29703, 0xb72a6a34, 0x53a153c5, 0x000013a4, 0x4d844d72, 0xb7ccfdc5, 0x02b3022e, 0x0000e89b, 0x040d046e, 0x2b2d841e, 0xefedefa9, 0x0000d5eb,
+        0x63d76302, 0x89c71b53, 0x2b7f2b8b, 0x0000aadb, 0x36aa3675, 0xe71ec800, 0x561f56b0, 0x000064c3, 0xe6b4e6dc, 0x2f8dcdd3, 0xe42ae4bb, 0x00000183,
+        0x96c296d7, 0x6d7e5eaf, 0x1f0b1f1e, 0x0000d667, 0xbedcbeb7, 0x6185f37c, 0x803e802a, 0x000056d9, 0x0802086f, 0xf96cee18, 0x8bef8b29, 0x00007660,
+        0x458b452b, 0x92b8bd4c, 0x7f657f25, 0x0000b77d, 0xcb24cba4, 0x75b18442, 0xe16fe130, 0x000064c9, 0x47ea4796, 0x3e03f840, 0xdf6cdf6d, 0x0000b910,
+        0x062a0629, 0x472e4e7c, 0x880d88be, 0x0000c97c, 0xce97ceb5, 0xdcee2e1f, 0x8abb8ae9, 0x000057c9, 0x23ba237d, 0x4424c0c1, 0x520952fe, 0x00007dc6,
+        0xcc3dcc29, 0xc335d7cb, 0x4e624ef3, 0x00004e43, 0x1dd71dea, 0x9c2f363f, 0x6ec26eaf, 0x0000588b, 0xd86ad810, 0x0ca85292, 0xb0abb0c5, 0x00001e03,
+        0xb015b089, 0x6c613555, 0x6c1c6c71, 0x0000e0e2, 0x69cb69ee, 0xe92d874c, 0x7f2b7f13, 0x00004927, 0xda39dafc, 0x6c6bcc7a, 0xab09abb2, 0x0000d2a4,
+        0x4adb4a6b, 0x333c7948, 0x21b221f4, 0x0000e8f6, 0x82b88254, 0xcc7a46bc, 0x638b6388, 0x0000df3b, 0x5d155d8d, 0x1e84b2d7, 0x8c7e8c3c, 0x00001f53,
+        0x45734525, 0x0dd74f2a, 0x203a20b5, 0x000007c1, 0x26142666, 0x2418e505, 0x39c8397a, 0x00001a0c, 0xd4dfd4c6, 0x6edfdba5, 0x93f19342, 0x00001dc3,
+        0x328132ff, 0xa80d26d4, 0xa8daa897, 0x000006a0, 0x7b2d7bfd, 0x6933be74, 0x0f410fec, 0x00009a6b, 0xadd9ada2, 0x0044f257, 0xa127a1fc, 0x00000589,
+        0x04e2044f, 0x85892a96, 0xab69abfa, 0x0000fd8c, 0xcd71cd6f, 0xd2d5a4aa, 0xf3a3f351, 0x0000695c, 0xf7d9f7ff, 0x74afa05e, 0x33b23397, 0x00003826,
+        0x267d265b, 0xb7d9bbe9, 0x849c8431, 0x0000ea75, 0xa9bea970, 0x37773a52, 0x803e80ff, 0x0000bbb1, 0x9db89d61, 0xd06b47c9, 0x67dc67a5, 0x0000e145,
+        0xb5dcb571, 0xd7698d87, 0x53d0533e, 0x0000aba7, 0x4f2e4f01, 0xbcc99ea3, 0xc751c726, 0x0000b4b7, 0x70f070c3, 0x6bcd5533, 0x616761dc, 0x0000823d,
+        0xef2cef65, 0xebc71dac, 0xecafec76, 0x0000f3b3, 0x625b6225, 0x5c90c5f7, 0xf99af965, 0x00000c1c, 0xbeaabe1e, 0x6e6035eb, 0xb62db6ea, 0x0000d148,
+        0x353035a8, 0x370a0106, 0xd945d921, 0x00003833, 0x97519745, 0x14a5e36d, 0x550f5557, 0x0000cde0, 0x6d936dec, 0x2dc4acc0, 0x01e60181, 0x00002b2c,
+        0x20512006, 0x09e41188, 0x3cfe3cac, 0x00005bc7, 0xa4a6a43c, 0x9f98714b, 0x2ae52a15, 0x0000eb1b, 0x211f2179, 0x984cc911, 0xd4a9d420, 0x000014f7,
+        0x67d167f3, 0xacb3606e, 0x5c475c76, 0x00009782, 0x2adc2a7d, 0x37196ff5, 0x7c0f7c77, 0x00006046, 0x897e892e, 0xc33a8f21, 0xb116b19d, 0x0000638b,
+        0x8788876e, 0x89799c1d, 0x956895d2, 0x0000fdad, 0x467d4609, 0x62b23d80, 0x78737871, 0x00008c73, 0x404e40f8, 0x240fa8ff, 0x36523611, 0x0000de67,
+        0xfa3afac4, 0x326e2b39, 0xcfedcf40, 0x0000c7ec, 0x415e41ee, 0xf6e2cc8e, 0xc253c2e9, 0x00002947, 0xa464a4b1, 0x618527d6, 0xd2c6d23c, 0x000045bd,
+        0x8f498fd7, 0x385bb8d8, 0xc42ec447, 0x00003168, 0x27de2778, 0xf0e91b15, 0x25542584, 0x0000c9b5, 0xe24de26d, 0x128864a4, 0xc964c97e, 0x00000587,
+        0xb890b83c, 0x519df1cb, 0x535f5333, 0x0000d7a8, 0xb3adb391, 0xfeaf6bca, 0x4d524db5, 0x00004611, 0x724872cc, 0xe5829ddf, 0x52fc52cc, 0x0000b5cc,
+        0x4e3a4e06, 0x225958a3, 0xd77ad725, 0x00002900, 0x2db92dde, 0x695a6cf4, 0x2c432c20, 0x000004d3, 0xf052f00f, 0x35890329, 0x674c674a, 0x00005fd7,
+        0x495d4947, 0x57f02b3b, 0xd99dd98f, 0x0000cbaa, 0xe81ce841, 0xf69506ca, 0xf267f29e, 0x00009e4e, 0xf0d3f0f0, 0x9068b15b, 0xaaffaa51, 0x0000a159,
+        0xf817f8dd, 0x16c56989, 0x8b1a8bad, 0x0000b5ba, 0x6b5a6b6b, 0x5152465f, 0xbbb8bb3a, 0x0000e232, 0x9f1f9f21, 0x15f97f4b, 0xc315c33f, 0x00003082,
+        0xe368e35d, 0x8ec588ac, 0xca34ca82, 0x0000a369, 0xb236b20b, 0x2180b617, 0x94e094c4, 0x00004763, 0x1c071c93, 0x594a97c8, 0x445b44b3, 0x0000a907,
+        0xf89ff890, 0xcaa5b4ea, 0x107c10dc, 0x0000cfce, 0x315331c0, 0xfb6ec37a, 0x0965096f, 0x00001c6e, 0x00f70000, 0xd46b4210, 0xc2cec2d2, 0x000073fb,
+        0x44064481, 0xca180fa0, 0xa366a3dd, 0x0000bd67, 0xf624f6b0, 0x8d462063, 0xf5aef51c, 0x0000a394, 0xf75af738, 0x88d0eb8f, 0xf172f1e7, 0x0000f62d,
+        0x43d24335, 0x1cc8e8a5, 0xe947e9a5, 0x0000d2da, 0x26cf2693, 0x41792160, 0xf95cf9d2, 0x0000c6c1, 0x533253e8, 0x921b51a3, 0xa0cba02f, 0x0000eeb4,
+        0xc29dc288, 0xe1a3a4ac, 0x984e9852, 0x0000a577, 0x516e5109, 0x9eec57b1, 0xdcc6dc17, 0x0000d918, 0xe35ae3f3, 0xe9d34041, 0x08e208ba, 0x0000511f,
+        0x883588b8, 0xf4a32d3b, 0x16111656, 0x00008052, 0x0101016e, 0xb8e39238, 0x5ad55a68, 0x00008b52, 0x05df0544, 0xa267d25b, 0x1fc41ff3, 0x00000854,
+        0x4c504c06, 0x027b8f81, 0x8b608b6d, 0x0000535b, 0x99259980, 0xe462ca0e, 0xc24ac204, 0x0000ba31, 0x33c7330e, 0xdfc935d1, 0x953d9507, 0x0000f908,
+        0xcaf5ca11, 0x3c0ab9af, 0x861886ea, 0x000001fd, 0x76b676d1, 0xe683c0fc, 0x3b633b4f, 0x00000433, 0xd5d2d58d, 0xa741250b, 0x57ae573a, 0x0000f1ce,
+        0xf1d4f1f0, 0x0ef50309, 0xa134a112, 0x0000412e, 0x83288371, 0x88c4bea0, 0xe051e045, 0x0000e932, 0x2e362eca, 0x784ba4ae, 0x6f8e6fc3, 0x00000e18,
+        0xb9eeb995, 0x52526c84, 0x8689863e, 0x00005d6e, 0x1dbf1dc7, 0x8437bf7f, 0x6c176c77, 0x000098d1, 0xf4ccf428, 0xc6a482cf, 0xfc21fc19, 0x00005909,
+        0x9e349eb2, 0xb5849c9e, 0x08700896, 0x0000b959, 0x278b2731, 0xb2a32063, 0x7c847c23, 0x0000e1cb, 0xd681d674, 0x5e6f2f3b, 0x918d91a6, 0x00000ab5,
+        0x9e729e9a, 0x25d231e0, 0x82e982e4, 0x0000c0ec, 0xceaece8f, 0x5bb7e2ec, 0x707270ce, 0x000016e8, 0x8dd08d6c, 0xe09dba7f, 0x247e2419, 0x0000a385,
+        0x50fe5038, 0x9c5684ea, 0x9d469da3, 0x00006b15, 0x666466f7, 0x31acde16, 0x45ff45ee, 0x000094a7, 0xaaf9aadc, 0xec0ead20, 0x95c295b7, 0x00002bdb,
+        0xa509a540, 0x26f33c77, 0x5dc35d67, 0x0000e921, 0xb2dab2d0, 0xac5b2d0c, 0x713e71c4, 0x0000b4b5, 0x95a195ac, 0x11552d6d, 0xf918f9a2, 0x00006378,
+        0x92a89263, 0x58d4a87c, 0xeca8ec6c, 0x00005854, 0x9c4a9c60, 0x68c1c33c, 0x7c6b7c22, 0x00005e11, 0xb068b07d, 0x0e04b287, 0xa024a0d3, 0x0000e44d,
+        0xecf0ecd3, 0x38af4a9d, 0x944194a3, 0x00000d72, 0x2ed82e73, 0x9b7785fe, 0xcb16cb97, 0x000020c5, 0x48254864, 0x0bcb56f1, 0x454c45ff, 0x0000de96,
+        0x1bbd1bbd, 0x791b08d7, 0x6bfd6b02, 0x0000c05e, 0x23ba23e7, 0xafa12954, 0x272d27de, 0x000014f7, 0xa833a84d, 0x8dd71f28, 0xc497c433, 0x00005706,
+        0xdd2cddc5, 0xfcde60a3, 0x13bb1322, 0x00009e27, 0x5767573d, 0x48879e53, 0xae1bae85, 0x000010bf, 0x1fc71f1d, 0xaf4d68ca, 0x64196481, 0x0000c26d,
+        0xcfe2cf59, 0xa6516559, 0x1464145d, 0x00008271, 0x0aee0a63, 0x8a32908e, 0xb750b74b, 0x000056ff, 0xb1bab1e3, 0x0e76ad42, 0x16451657, 0x0000d96c,
+        0x319d31d9, 0x06443bf1, 0x749d7425, 0x0000d735, 0x729272f5, 0xc0cadce8, 0xe367e378, 0x00002b3e, 0x4e774e51, 0xfed23878, 0x99819922, 0x00009a6b,
+        0xe56ce560, 0xc4481709, 0x4e704eb7, 0x000071bf, 0x1c8e1c1d, 0x4bd64860, 0x460646d4, 0x0000182a, 0x383238ca, 0x7deb55b2, 0xb457b4a1, 0x0000a907,
+        0x993899dc, 0x36cedb62, 0xf6c2f6cb, 0x0000216d, 0xcbb5cb35, 0x23a230a6, 0xfb1afba5, 0x0000ce78, 0x4c734c25, 0xcc270274, 0x907f90c8, 0x00006d60,
+        0x7aa07a9b, 0x39e19ad4, 0x540d544d, 0x00009ff0, 0x6a3f6ae6, 0x7bf6c420, 0xeaeaea1f, 0x000024c5, 0x3598355a, 0x84c3b203, 0xc887c870, 0x00005506,
+        0x66236629, 0xe23ea1e0, 0xb171b192, 0x00000eda, 0xf112f163, 0xb228c001, 0x318731ef, 0x0000eed6, 0xda6adaa0, 0x44472254, 0xeeb3ee86, 0x00000432,
+        0x4a9d4a2f, 0x132165d9, 0x644c640c, 0x00002d48, 0x40944085, 0x702a57f2, 0x827e8238, 0x000031a1, 0x152d1580, 0xd26b4e29, 0xb331b367, 0x0000ee94,
+        0x4fe54fe9, 0x77fbbfd6, 0x8c588c42, 0x000048ef, 0x9f969f29, 0x33ce1a0f, 0x73dc738b, 0x000036ab, 0xbb19bb25, 0xd2dbb160, 0x4a1a4aa1, 0x00009322,
+        0x71b07199, 0xda544824, 0x9b3d9b7a, 0x00000921, 0x68bc684f, 0x56a761a9, 0xe915e9ca, 0x00001b1a, 0xe4e3e4cb, 0x919ca7af, 0x3107318a, 0x00000589,
+        0x333233fa, 0xba4f7fb6, 0x0c2a0c7c, 0x000094e0, 0xbb6cbb8f, 0x1e7a80f3, 0x77e377ae, 0x0000a836, 0xd794d78d, 0xf9187f41, 0xdd4fdd15, 0x0000467a,
+        0x146e14c4, 0xdf70c819, 0x9f139fca, 0x000001ff, 0xc6cac6d3, 0x72754129, 0x4b0a4b8f, 0x0000783c, 0xf0b5f087, 0xe6a2b3e7, 0x29ba299c, 0x0000fa5c,
+        0x10551066, 0xb03ff66f, 0xd4cbd4c0, 0x0000f221, 0xe391e37f, 0x7335c171, 0x9a429ab0, 0x00009658, 0xfbe0fb2c, 0x17afb6d6, 0x08c90820, 0x0000c3b1,
+        0xcbffcbe6, 0xafa17c0d, 0x3c863cdc, 0x0000aad9, 0x7241720b, 0x88d08ce1, 0xf2fcf2ee, 0x00006e5a, 0x1dfc1da1, 0xd938f760, 0x0a210a7f, 0x0000cbcf,
+        0xb1c6b139, 0xf4ae6ded, 0xc0f5c0b0, 0x0000f808, 0x1a7c1a59, 0xaab3da3d, 0x1a191a3e, 0x00009423, 0x37fd37cf, 0xcbe771a9, 0x3c093cfc, 0x00006323,
+        0x70c17085, 0xda9e12e1, 0x88e58804, 0x0000a998, 0x6f4a6fe2, 0x0a9d01d7, 0x360f368c, 0x00001b85, 0x85a3857b, 0x1eaa3410, 0xaf41aff0, 0x0000d910,
+        0x1ea11e1b, 0x948881e1, 0x98109871, 0x0000c0f2, 0xd531d5fe, 0x2942b4d6, 0xb313b394, 0x00008ee3, 0x9a149ae3, 0x04c7a614, 0x1a701a28, 0x0000ca7f,
+        0xc730c731, 0xacdea26c, 0xe59ee51e, 0x000007fe, 0xf46bf4c3, 0xa8712fc6, 0x49374982, 0x00004342, 0x39933935, 0xe8c1a453, 0xab3fabf4, 0x0000025d,
+        0x4e864e03, 0xc5d584e1, 0x585f58d0, 0x0000405a, 0x8d528d96, 0x442905a6, 0x51475176, 0x0000ce06, 0x41044176, 0xb4076062, 0x0e740e76, 0x00009515,
+        0xfa2efa58, 0x8a4e8de8, 0x7d557d47, 0x0000b84f, 0x9f269f18, 0x5d077ebb, 0x3eed3e85, 0x0000cdcf, 0x1cde1c18, 0xa6413320, 0xad94adb2, 0x0000f49c,
+        0xbb50bb12, 0x695f44a6, 0xef39ef49, 0x00002ca6, 0xa134a175, 0xe1bdd635, 0x9ec69e94, 0x0000ed75, 0xf02bf05a, 0x8e67584a, 0x4a2b4a3e, 0x00004b05,
+        0x444b44f7, 0x4eb4b160, 0xfb60fbf6, 0x0000c14d, 0x72ab7241, 0x0a2bea0c, 0x0e230ed2, 0x00008861, 0x235b2303, 0x3be1427b, 0x504150b8, 0x000067e1,
+        0x55e7552a, 0xa1be70d0, 0x3dbf3d57, 0x0000799d, 0xa871a8f9, 0x172b5067, 0x88e088f9, 0x0000f4f9, 0x7ad27a94, 0xd3cb74af, 0x7c1b7ca0, 0x00006c8b,
+        0x94ef94b8, 0x0c3ae3ec, 0x5e715ec2, 0x0000a09f, 0x21a721b9, 0xaabaf157, 0x2c4f2ca9, 0x0000eae2, 0xc1d5c102, 0xe59cb275, 0x4ead4e7b, 0x0000bb91,
+        0xdad3da77, 0xbc1b36ff, 0x03c203cf, 0x00000892, 0xea9aead3, 0xd762512c, 0x382f38ff, 0x00006935, 0xfa42fa65, 0xa51d1440, 0xf090f077, 0x0000a8c8,
+        0xd0e3d03f, 0x17e5d31b, 0x1d8e1d36, 0x00001f88, 0x107d1051, 0xf1f4d8da, 0x375137b6, 0x00005a38, 0xa0e1a0f6, 0x50190be8, 0x3fea3f57, 0x00002c27,
+        0x6e866e60, 0xaa33a3db, 0x17241796, 0x00008661, 0xfd03fd8c, 0x494aaf14, 0x0d290dbc, 0x0000f453, 0x2af22a97, 0x908d5f96, 0x740a7423, 0x00004ce4,
+        0xa040a055, 0x8a283411, 0x03b203d5, 0x00003b6c, 0xbdfabd19, 0x34d8f1d4, 0x38fc3804, 0x000071c2, 0x55ae55dc, 0x80589a54, 0xf6f6f6a7, 0x0000c9b5,
+        0xc8ecc867, 0x3e0adca8, 0x9976992c, 0x0000ca83, 0xfc7efc33, 0xe4c3de57, 0x9c669cc2, 0x00006ee1, 0xccf9cc64, 0x23825f18, 0xa004a016, 0x00000043,
+        0x6fe96f5c, 0x69f0c343, 0xb114b194, 0x000019b7, 0xf460f47b, 0x8b4787de, 0x93ab938a, 0x00005c54, 0x6b3a6b33, 0x7867f8c4, 0xa418a414, 0x0000bc10,
+        0x38c438a9, 0xf3eb53f2, 0x61a7610d, 0x0000d658, 0xd5edd5a4, 0xe22c7149, 0x5b415b50, 0x0000616a, 0x79e279d8, 0x3d5bbf75, 0x7e857e17, 0x00006cf4,
+        0xb556b59e, 0xe821b8d8, 0x437243da, 0x000077d1, 0xcc02cc67, 0x55f0b9c6, 0xe108e17c, 0x00004230, 0x61dc6125, 0xa9e0b0e7, 0xa21fa211, 0x00001e03,
+        0xf62bf652, 0x3ab8f4a3, 0x61f861ef, 0x0000efbb, 0x0d530d30, 0xea5b643c, 0x18251816, 0x0000d049, 0xe565e5f1, 0x45257a56, 0x03b80368, 0x00002487,
+        0x0a4c0aa1, 0x4f2994d8, 0xbf7bbfc6, 0x0000c132, 0x21ed218c, 0x0b0a9a62, 0x9a739a2d, 0x0000db67, 0x34c93406, 0xc7f4e6a4, 0x32e73259, 0x000000a1,
+        0x2faf2f27, 0x9da81cda, 0xc9e5c96f, 0x0000b063, 0x3e543e1a, 0x514034e0, 0xb816b876, 0x00001b73, 0x6a676ad0, 0x2efcc648, 0xff05ffb6, 0x00002d3a,
+        0x5cd05cfe, 0xd9dbf157, 0x3dc13dd7, 0x0000c193, 0x023102e6, 0x763fa7b5, 0x00e60085, 0x000042d0, 0xff0dff98, 0xba31b0d8, 0xd943d995, 0x0000f842,
+        0x6cc36c9e, 0xa27cc4f1, 0x1969199c, 0x0000ee3c, 0x6fe56fa7, 0x7e55f3a9, 0x5fa75fc7, 0x0000f293, 0x5f8a5f59, 0x9f7acd17, 0xc639c65a, 0x00001aac,
+        0x1d1c1d93, 0x2bdc57fc, 0x208620ea, 0x00002b7b, 0xfdfcfdef, 0x2730456f, 0x505a50b1, 0x0000ee9b, 0x02450227, 0x9ae696be, 0x12af12eb, 0x00004acc,
+        0xe3aae39c, 0x2622ff31, 0x8227829c, 0x00002c27, 0xbc2abc68, 0x6b5027c8, 0x95669573, 0x0000e0ad, 0x05e80501, 0x6c822b30, 0xf181f1ee, 0x000051a6,
+        0x034c03af, 0x89f7371b, 0x68ac680c, 0x000057e8, 0x7afa7aa2, 0x3e88fb7d, 0xa354a3ca, 0x000039d3, 0x37933747, 0x9616f309, 0x465c4629, 0x000097ea,
+        0xc718c7f2, 0xd4ff50cd, 0x19e2194b, 0x0000898b, 0xd9f7d965, 0x84751644, 0x580a5824, 0x00007cc0, 0x6871689e, 0x3bafee93, 0xa066a007, 0x0000ba4e,
+        0x979d9784, 0xa4410ea4, 0xbb18bb5a, 0x0000c3ec, 0xf930f921, 0x3d299447, 0xf9b0f95b, 0x00007aa3, 0x6afe6a90, 0xa17c77a9, 0xf33ef34f, 0x00008ee0,
+        0xefa2ef24, 0xb26c2ee1, 0xc83dc87c, 0x0000155e, 0x92ca92bb, 0xc9c7fe0f, 0x9c629ca6, 0x000014d6, 0x99aa9916, 0xcc452163, 0xee33ee5c, 0x0000968a,
+        0x5c8f5cd7, 0xa5f106c4, 0x342634c9, 0x00001847, 0x3a5a3a32, 0x90dde213, 0xfbe7fb03, 0x00007f8e, 0xb80bb880, 0xa08338ff, 0xe53ae58e, 0x00005318,
+        0xa544a58a, 0xb0ccaee6, 0x024102ee, 0x00006935, 0xe85de89c, 0x7dea6f22, 0x8b188be2, 0x0000c412, 0xed69eda8, 0x63d2d3c8, 0xe04ce011, 0x00005454,
+        0xe311e3a6, 0x4a36242b, 0x2bed2bfb, 0x00004e77, 0xfa59fab7, 0x142fe1fd, 0x31ca3176, 0x00001ea8, 0x8deb8d83, 0xe0c0553d, 0xef9bef4c, 0x0000f2fd,
+        0x4bbb4b90, 0x53372326, 0xf73bf746, 0x00004804, 0x018901ba, 0xe543b615, 0xb6a5b631, 0x0000ac18, 0x7f2f7f5e, 0x36271a12, 0x142714bb, 0x00001873,
+        0x8dee8d70, 0x810b17ba, 0xe16de153, 0x0000587e, 0x3dc63df1, 0xce39743c, 0x74a1744b, 0x00000362, 0x2689268a, 0x33ab0d27, 0xcc46cc50, 0x000031aa,
+        0x1ee01e40, 0x7970c0fe, 0x03bd03d1, 0x0000e102, 0x9b5b9b66, 0x4e563cd5, 0x33b83398, 0x00007f3d, 0x5e1c5e74, 0xc334d4f5, 0x1b201b68, 0x0000acd7,
+        0xe82ee820, 0x2b6337ff, 0x1b611b8d, 0x00006791, 0x6eb66efd, 0xb2d1dfd7, 0x56d0563f, 0x000097f0, 0x977d97cf, 0x33f54860, 0x0a970a59, 0x00007684,
+        0xfb14fbc1, 0xb92cc48b, 0x607460bc, 0x0000e3e2, 0x3d623d63, 0x805fa26d, 0x964096ac, 0x0000e42b, 0x19f61938, 0x3a318635, 0x00b600fd, 0x0000c90b,
+        0x9992999e, 0x3d48d827, 0x8598854e, 0x0000e239, 0x0ff30fad, 0xffb37a67, 0x828a823f, 0x0000f31a, 0x9518952c, 0xc084b9d8, 0x02390237, 0x00006c6a,
+        0x0bed0b10, 0x4b29a19d, 0xcf94cf39, 0x00002a05, 0x3d283dd0, 0xe02ccc34, 0xc842c827, 0x00002aef, 0x507f50a9, 0xe25231ff, 0x2f202f5d, 0x000057a6,
+        0xce0ace66, 0xee10da26, 0xe99de9ec, 0x00003ecc, 0x0bd00b53, 0xd492580b, 0xa50da575, 0x00009fb6, 0x9ff19fd5, 0xd4ff4e0a, 0x3402344b, 0x000087c6,
+        0x6fab6f31, 0x754b9c9a, 0x82918274, 0x0000ffc2, 0x0fbb0f24, 0x55a7988f, 0x1c631c26, 0x0000d2eb, 0x31903174, 0x9f885b23, 0xa7d0a7c8, 0x0000ba13,
+        0xf332f3b8, 0x323ffcbc, 0x3a3f3a71, 0x0000889b, 0x9d4c9dbb, 0xc25d23df, 0x150815d0, 0x000022ff, 0x8ba88b65, 0x1907702d, 0xb6ecb60e, 0x0000805f,
+        0x3a9d3ad8, 0x7e5f0997, 0x974797b9, 0x0000a46e, 0x7c177c7b, 0xccf184bc, 0x556e55e9, 0x000066e1, 0xb832b89b, 0x83f7d921, 0x7df57def, 0x0000d11d,
+        0xd203d24b, 0xcefb7b19, 0x36f1365e, 0x00004ba9, 0x37283763, 0x17ee43f5, 0xe2fde2a7, 0x00001017, 0x001700ca, 0x513f8d5e, 0x49a149e3, 0x00008d1b,
+        0xe63ae6a5, 0x077bbfc9, 0x380c3885, 0x000025dd, 0xc45ec4c3, 0x2ad219a8, 0xce54ceeb, 0x00008def, 0x5c405ca7, 0xb1554861, 0xc015c08c, 0x00008957,
+        0x4950492b, 0xa7f10e5a, 0xbfc6bf12, 0x00002675, 0xe9bfe9d1, 0xcdca6c2b, 0xe975e978, 0x00001eca, 0xa2c5a219, 0x9eede84e, 0x95f49502, 0x000079df,
+        0x398239c1, 0x924fac3e, 0xc555c50c, 0x0000a098, 0x3d8d3d31, 0xcc128bd0, 0x3883382d, 0x00006ea6, 0xe399e353, 0x32873864, 0x384a38fe, 0x0000de3f,
+        0x54605442, 0x137797fe, 0x5fa75fa2, 0x00001fc3, 0x5ead5ed5, 0x109ff0d3, 0x803280ad, 0x000074d1, 0x713871f2, 0x61ed20eb, 0xb16ab1ab, 0x0000aa76,
+        0x509f50cb, 0x68bf7767, 0xd876d860, 0x0000512d, 0x1618162c, 0x9ae6af89, 0x316231f9, 0x0000cff2, 0x85ed8579, 0x5decdba5, 0x3c763c86, 0x00006feb,
+        0x021a0272, 0x3990b454, 0x904a90b4, 0x00001844, 0x3bbc3bdb, 0x215d7942, 0x39a039e1, 0x0000a6d7, 0x685568be, 0xd114b840, 0x559155a8, 0x0000d83b,
+        0x90a69046, 0x918ec9d7, 0x5eee5e02, 0x00002d5a, 0x9022901a, 0xab0d7ce2, 0x556c55c1, 0x00005e50, 0xd47ad47f, 0xae1390b1, 0x4a6b4a87, 0x00008a18,
+        0xdc73dccb, 0x1751004a, 0x74e7743d, 0x0000086b, 0x167e16d5, 0x0b547a3d, 0xe678e692, 0x00006446, 0xdfa8dfb4, 0x4c77fb8c, 0xd670d659, 0x00001dac,
+        0x4aeb4aa5, 0x1375f79a, 0x751b75aa, 0x00005079, 0x0cf80caf, 0x7d284e5d, 0x08a308f6, 0x0000438f, 0x8b048bb1, 0x7eea98ac, 0x61ca61f2, 0x000035ad,
+        0xa204a219, 0x7ebcd236, 0xa848a8b2, 0x00002cc8, 0x317531d0, 0x135554cd, 0xfe5ffe0a, 0x00009615, 0x93689354, 0xe5ffa815, 0x118311f6, 0x000004ed,
+        0x0a950ab5, 0xa5238b51, 0x987a982e, 0x0000b0f3, 0x773877d4, 0xe6e1d258, 0xc4a4c4f6, 0x00007206, 0xfce2fc40, 0xe8509238, 0x6dcd6dc2, 0x00006647,
+        0xa263a2fb, 0xfdf93080, 0x53c25388, 0x00005934, 0xa6d9a6a4, 0x8d272256, 0x838183b9, 0x0000f493, 0x47334760, 0xb461f87c, 0x758d75a5, 0x0000330a,
+        0xe066e01e, 0x32890106, 0x53bb5388, 0x0000a0b1, 0x7b957b53, 0xdca59127, 0x38b73853, 0x00006731, 0x169116d6, 0x21781167, 0x185d1813, 0x00008a1b,
+        0x14491428, 0xfde11586, 0x8a028a86, 0x00003435, 0xcfe1cfd8, 0xbed16cf4, 0xb3efb3b0, 0x0000d2a5, 0x19e01952, 0x84f6ec93, 0x1db41d7d, 0x0000d426,
+        0x402e4058, 0x999cc9d8, 0x7b0b7b5b, 0x0000a751, 0xa7d7a7b2, 0x90cc3df2, 0xb670b624, 0x00008660, 0xf227f2b3, 0x9ccec2c3, 0xb334b3e5, 0x00004767,
+        0x2d1b2dc1, 0x17533220, 0x33cb339e, 0x00008581, 0xa7fba7ce, 0xb4d949d5, 0x0c360c5b, 0x00004711, 0x2df12d39, 0xa261f568, 0x58605896, 0x00007cae,
+        0x2cd22c59, 0x067b2054, 0xe31ce3f8, 0x00000f70, 0x7910797d, 0xf803479c, 0xfeb9fea1, 0x00001614, 0x83438334, 0x14f91259, 0xb456b49a, 0x0000505b,
+        0xbd3fbd07, 0xe47c0448, 0x9a239ade, 0x000035cf, 0x9f8b9f7c, 0x57f26562, 0xcd04cd65, 0x00007f8e, 0x4dd14de6, 0x0444897a, 0x0869084b, 0x00009f31,
+        0x7d197d6c, 0xb2eaddea, 0xb754b7b0, 0x00002aea, 0x368f3640, 0xf5a3ce2d, 0x036203c2, 0x000055fb, 0x77e877b8, 0xc3d6ae8a, 0x5fd65f35, 0x0000b649,
+        0x211221c4, 0x7422f796, 0x7be97b41, 0x00006d7e, 0x018801c0, 0x2d42cb50, 0xbc02bc1e, 0x0000e137, 0xa13da1a3, 0xd7e5e6a4, 0x5db95dfd, 0x00009fb6,
+        0x68e8689d, 0x926912b9, 0x2dba2d6b, 0x0000ccf2, 0x8d198dcb, 0x1badbf84, 0x09a00914, 0x0000bb70, 0x7c6e7c21, 0xebec3085, 0xf1cff185, 0x0000741b,
+        0xa8b9a8d0, 0x3037bc48, 0x5d455d5b, 0x0000dc43, 0x164b162d, 0x731abeb7, 0x30d3300d, 0x0000553d, 0x9aa99a45, 0x88c7e0d2, 0x033f0377, 0x00001b85,
+        0x69356918, 0x6a8f3bf1, 0xa8b3a857, 0x0000d6c7, 0x2f172fcd, 0x1e1a4fd5, 0xa223a2cd, 0x0000cdf0, 0xd707d742, 0xb3e23a4e, 0xeb11eb9e, 0x0000298b,
+        0x704970f1, 0x4a87a820, 0xa267a220, 0x0000d3f2, 0xe213e269, 0x01fb7bb9, 0xc191c198, 0x0000ec94, 0x1be01b9d, 0xe99de26b, 0x10a2101f, 0x000040cf,
+        0xdc0adcea, 0x774af157, 0x6a4f6a7e, 0x0000d9ca, 0xf12cf1e3, 0xa2c09d1f, 0x83aa83d8, 0x0000945d, 0x9a479a24, 0x901c6bcb, 0xa10ba159, 0x0000f747,
+        0x1dce1d42, 0xd48beb73, 0x829082d3, 0x00008171, 0xa6fba6c6, 0x5472d0eb, 0xfc58fcdf, 0x0000f718, 0x462746a1, 0xa401bb3a, 0xa50fa538, 0x00004d7c,
+        0x6477647c, 0xdf0c8167, 0xcd84cda0, 0x00003406, 0xf030f0c2, 0xff86a298, 0xe2f9e2bc, 0x00005f19, 0x7644762c, 0x778edb24, 0x0e390eb7, 0x0000d49b,
+        0x93df9344, 0xd8e54325, 0x118311fb, 0x00007e91, 0xc001c048, 0x1cbb6bca, 0x024a0255, 0x000032b3, 0x9f789fd9, 0x647ebff5, 0xf0c6f00e, 0x00001da5,
+        0x64e46484, 0xd7eb1afe, 0x4e904ebf, 0x00001588, 0x66a26646, 0xc6f553f2, 0x529252f9, 0x0000c7fc, 0xb4e5b438, 0x34709bbe, 0x5b635b06, 0x00008261,
+        0x8d1f8d4b, 0xa9d016c1, 0x827a822d, 0x00008f69, 0xe352e324, 0xabefa4ab, 0x6b1f6bb8, 0x0000df74, 0xf691f6d1, 0xf588471b, 0xfff8ff49, 0x0000fd86,
+        0x629162d0, 0x529b4207, 0x661266a4, 0x0000a008, 0x2b322b9d, 0xcaecb9c9, 0xa190a150, 0x00004ec2, 0x9e0d9eea, 0x0d1475d9, 0xd27ed29f, 0x00008818,
+        0xc5aac572, 0x81c8e5a2, 0x18e5187e, 0x000067af, 0xcae1ca52, 0xbf99e672, 0xe367e341, 0x00001442, 0xa0caa03d, 0xf757d348, 0xf6a9f672, 0x000014d7,
+        0xdee8dede, 0x44418ce2, 0xe604e6d6, 0x0000af07, 0xd4fcd466, 0xe6e53691, 0x3e503e12, 0x0000e02b, 0xd35cd326, 0xb9dcdaa4, 0x53525313, 0x0000f793,
+        0xd76bd769, 0xa74128bf, 0x498e4984, 0x0000ccaa, 0xa4b4a4e0, 0x3ec3f6b2, 0x7c647cc7, 0x00003859, 0x9edc9e57, 0xbe61d819, 0x251325f2, 0x0000eadd,
+        0x33bc3386, 0x7a1d4d29, 0x3efa3e4b, 0x0000ac25, 0x953395ea, 0xb98f9e88, 0x42804232, 0x0000c112, 0x934d9324, 0x97169aae, 0xd2d7d2da, 0x0000a8c8,
+        0x389538fe, 0xa9f19581, 0x0dfe0d42, 0x0000676e, 0x32ee322e, 0x2c4dd413, 0xdeb1de72, 0x00000b71, 0xdca9dc7e, 0x385b960f, 0x78d67833, 0x00004011,
+        0x32ce32a9, 0xe1234b37, 0xe542e5c6, 0x00006c96, 0x59fc5935, 0x2dc14adc, 0x8fa38fc2, 0x0000ec89, 0xe2fce27b, 0xd28ba5ab, 0xe1f9e150, 0x000065f1,
+        0x8dd58d68, 0x0ff5ac3f, 0xf8a5f842, 0x0000f4f9, 0x4a3b4ae1, 0x7d94958e, 0x8f5a8f6f, 0x0000f473, 0xd706d7b8, 0x683df14c, 0x325a3211, 0x000071ee,
+        0x283728c9, 0xd76822b0, 0x3f6e3f4d, 0x0000041c, 0x88ea8893, 0x2bc14c97, 0x777c77ce, 0x0000d0a5, 0x7ae37a23, 0x0ff527f6, 0x61f261ed, 0x00007660,
+        0x54e15477, 0x93765e13, 0x127b1264, 0x00002756, 0x899389d1, 0x5a2737ff, 0xb9b7b91b, 0x000093c5, 0x735e7327, 0x4de8aaff, 0x6b576bf7, 0x000079ae,
+        0x195119f5, 0xec82b881, 0x49b649a7, 0x00005ea7, 0xbd6ebd7b, 0x702bd097, 0xf9a6f99f, 0x000038a0, 0xebe9eb98, 0x004437e6, 0xfd39fd4b, 0x0000c830,
+        0x34bb34d3, 0xc89a5e13, 0x982c98ff, 0x000034d4, 0x5dcc5dad, 0xfdcca0f1, 0xa580a5b2, 0x00001d03, 0x96279616, 0x89f77d42, 0xd8f3d85d, 0x00007c61,
+        0x9ac29ab5, 0x1270e607, 0xd4a6d424, 0x00006646, 0x467e4631, 0x31d1e8cc, 0xa07aa030, 0x0000b13a, 0x758d75de, 0x4199abab, 0xa35fa3ce, 0x00008042,
+        0x570057b2, 0x8fc7b554, 0xfff6ffaf, 0x0000e8b7, 0xb22fb28c, 0xc2ca0f02, 0x9b409b42, 0x00002867, 0xb3ccb33d, 0xb229489f, 0x86018652, 0x0000de67,
+        0x33e4332e, 0x3f0ac640, 0xcb61cbb3, 0x0000e5ac, 0xba7cba98, 0x346d3005, 0xbabdbaa3, 0x0000a11c, 0x80ee80c8, 0xf757ced7, 0x61706165, 0x0000809e,
+        0x38eb385a, 0x2730eb93, 0xa9b6a9ee, 0x000022ea, 0x04670402, 0x6ba04f96, 0x958195f3, 0x000039b3, 0x9e089e85, 0x53fbcb68, 0xceb8ce83, 0x00001322,
+        0x42c04278, 0x2d4cd73b, 0x07850733, 0x00009dae, 0xd3c2d33d, 0x8ef8c916, 0x10f1105d, 0x0000614f, 0x735173f1, 0x02449e35, 0x5a505ae4, 0x0000a9fa,
+        0x5ab85a37, 0x2c2192b9, 0x23f12319, 0x0000fe0c, 0x7c3d7ca7, 0x50f09d70, 0x94d894a0, 0x000042f0, 0x7b257b45, 0xda38de60, 0x375b37ab, 0x0000c113,
+        0xe01fe05a, 0x42dadfa6, 0x50a050c4, 0x00004140, 0x5fd75f7b, 0x05fb4124, 0x04140422, 0x0000712d, 0x39b73940, 0x6ec38ae0, 0xc035c0e4, 0x0000b41c,
+        0x7e1e7ec0, 0xa2c2f5f4, 0x56325636, 0x00007e3c, 0x8fea8f28, 0xc81439f0, 0x0856080d, 0x0000793c, 0x132913aa, 0xef52d730, 0x36373633, 0x00005959,
+        0x3f4e3ff2, 0xb100617b, 0x7e287e24, 0x00000d4f, 0xa130a1f8, 0xa90d8ce1, 0x0875086a, 0x0000a7a7, 0xecffecc2, 0x29d22163, 0x160316de, 0x00004af2,
+        0x47ed47f9, 0x659e2bc0, 0xbab3ba46, 0x0000a8b8, 0x272427d4, 0x955e9183, 0xb861b836, 0x0000e9bf, 0x833f8330, 0xcaed1c65, 0x2f432fe2, 0x000013e2,
+        0x9a359ab9, 0x2ff33c64, 0x551355ae, 0x0000003b, 0xbb57bb93, 0x9d2e88a2, 0xe304e327, 0x0000ff62, 0xea76eace, 0x9e2c65a7, 0x09370912, 0x00003506,
+        0x366036d1, 0x0f8cd9d7, 0x3de43d01, 0x0000bdda, 0x833f8306, 0x3755e7e2, 0xec2dece6, 0x0000b251, 0xbfd0bf1b, 0x217923de, 0xcafecab5, 0x0000843d,
+        0x2dce2dcc, 0x6223e6a2, 0x209720e0, 0x00009df7, 0xb5bab5a4, 0x94ca57ce, 0x09e609e1, 0x0000d84a, 0xd92ad9dc, 0x03a41441, 0x0b610b6d, 0x0000fed2,
+        0x6675662c, 0x96a819c1, 0xc342c30e, 0x0000dbd5, 0x8e848ee9, 0x1d2bbb57, 0x1f1c1f78, 0x0000f97a, 0x9f419f9d, 0xdde47ebb, 0x5a365a49, 0x000031f4,
+        0xa662a6e4, 0xbbbb0e5a, 0xab6fabb1, 0x000012a5, 0x8b4e8bd4, 0x113ace6e, 0x235b230d, 0x000000c4, 0x5d3d5d43, 0xdf8f6d14, 0xbffbbf02, 0x00007f71,
+        0x30233082, 0x6c618fc4, 0x34d03430, 0x00008680, 0x158c155d, 0x038b509d, 0xfcfdfcb4, 0x000076e5, 0xa435a489, 0x56fd5d03, 0xd83bd897, 0x00007c72,
+        0x69916950, 0x1a4e673e, 0x74ff740f, 0x0000039e, 0x240224c1, 0x5782cdee, 0x2154214d, 0x00005bbd, 0xd314d3d3, 0x59cbd58a, 0xfa55fa4e, 0x0000b96f,
+        0x721f72db, 0xfd77cdd2, 0x66836634, 0x0000290d, 0x1ef51e67, 0x9f88722d, 0xb987b96d, 0x0000f32e, 0xea82ea69, 0xf61f51f0, 0x15ec1548, 0x00000e5d,
+        0xc90bc9ed, 0x2d4de352, 0xe18ee1fe, 0x0000ba5b, 0xb5ecb58e, 0xf9464fa8, 0xb0f5b002, 0x0000c012, 0xbf05bf75, 0xee7d2163, 0x752c75e1, 0x00009c79,
+        0xa1eba139, 0x5982af18, 0x3c8e3c0b, 0x00007f5e, 0x51bb510d, 0xe6c17b29, 0xd20fd2ce, 0x0000b4a8, 0x2b7b2b1b, 0x019bc65e, 0x2ffd2f59, 0x00006c19,
+        0xcfc8cf6b, 0xadc3f1d4, 0x973397ec, 0x000003a0, 0x57ab57d5, 0x49368731, 0xaabbaa57, 0x0000ac4b, 0x80f08033, 0xe1c0c003, 0xb575b5e0, 0x00003641,
+        0xe31ae3f0, 0x495f585b, 0x613761b0, 0x0000e8e9, 0xbed0be93, 0xb07fbc38, 0x1ff91f8c, 0x0000f1f9, 0xff74ffdc, 0xa77e27d6, 0x634d63ea, 0x00000433,
+        0x9d9e9db6, 0x66fc1eec, 0xb7f7b70b, 0x00009b8a, 0xafbcaf7a, 0x366f7616, 0x0aa10af6, 0x00007030, 0xfcbefcdb, 0xa42adf07, 0xe8a0e84e, 0x00008a60,
+        0xa31da3a8, 0x25e6e050, 0x411941b0, 0x00009f8a, 0x3ea23eb3, 0x729692d7, 0x32f23254, 0x0000df74, 0xbcc2bce1, 0x304daae9, 0x465a4697, 0x00006915,
+        0x484c483f, 0xc3d6dbcb, 0x516b5143, 0x00009e79, 0xfdfafd6a, 0x4d3660ea, 0xec5decf5, 0x0000c178, 0x4bf14b49, 0xd6ef1bac, 0xe372e37c, 0x00006b8e,
+        0x6eaa6e93, 0x9191fec5, 0x3e8a3e2d, 0x0000b7f2, 0xc88ac813, 0xc3c28d71, 0xce20ce17, 0x00009614, 0x3f963f29, 0x6deb7bbf, 0xcbaecb4a, 0x0000bafe,
+        0x366536d5, 0x4c27512c, 0x95e195f9, 0x00000a63, 0x74577433, 0x104195f9, 0x39ab3956, 0x0000061c, 0xa897a821, 0x8e7b9995, 0xe7b9e750, 0x00008361,
+        0x4a244ada, 0x7193cdd2, 0xa037a055, 0x00001f98, 0xa557a590, 0x1c4ebd36, 0xf02df046, 0x0000a7e7, 0x39c8394a, 0x728a0ca6, 0x392a39ea, 0x0000d175,
+        0x63bf632a, 0x74d2a62d, 0xb0a8b0a2, 0x0000db53, 0x4b2a4b5a, 0xb2dce3bc, 0xc844c886, 0x0000baf2, 0xb7f7b7a5, 0x14ef3fb3, 0x37393794, 0x000074f3,
+        0xe9dde9dd, 0x05c544c7, 0xf944f949, 0x00008fe5, 0xe021e0ac, 0x1f39dfa7, 0x2d4f2d78, 0x000063ae, 0x3df83d0d, 0x76ddce2d, 0x789478a0, 0x000089fa,
+        0xe115e1db, 0x2311a83e, 0x47d6470c, 0x0000a519, 0xd60cd66b, 0xad5f5081, 0x360436ee, 0x00001b44, 0x79df7999, 0x3daa0fbd, 0x353e350a, 0x0000957c,
+        0xebadeb17, 0x28c0ec93, 0x806880be, 0x0000952a, 0xd9b6d984, 0xf1643a4c, 0x63a56363, 0x00006935, 0x6dc46d31, 0x396e8bd3, 0x91c2911f, 0x00005bdc,
+        0xbac5ba1a, 0x952825c0, 0x2729275e, 0x00003a13, 0x0494049a, 0x617a6f2d, 0x27a527b2, 0x0000e345, 0x83b48389, 0x1e3a29d9, 0x08b80897, 0x0000a755,
+        0x09f90948, 0x60d83e31, 0x6a8b6a0e, 0x0000805f, 0x4fc94fe1, 0x24edbbf5, 0xf2cbf23f, 0x00008db1, 0xb112b1d2, 0x31cfc8d8, 0xf8f9f891, 0x00003c0d,
+        0x65e065da, 0xb6a7b3a0, 0xccafcc6c, 0x00008e72, 0x9ff79f23, 0x4ca7c9e3, 0x6e7f6eb7, 0x0000b354, 0x3149310d, 0x9a79d17c, 0x2c9d2c8b, 0x0000e9c2,
+        0x1a471ab9, 0x4a854aa0, 0x6d296df2, 0x0000092c, 0x754a750f, 0xe3ddd8c4, 0xf1bcf1a3, 0x00001d68, 0x6b656b91, 0xf72bf61c, 0x68986810, 0x0000cfaa,
+        0xe918e91a, 0xcaeb3c73, 0x204620f0, 0x00002d0e, 0xdf18dfd4, 0xbd6897c5, 0x4c0b4ca9, 0x00006579, 0x90b5905e, 0x4ff693c2, 0x2494247e, 0x00002353,
+        0x611d6130, 0xfed2fb0e, 0xada8ad4a, 0x0000b94e, 0x71617170, 0x81b575e4, 0x5eac5e48, 0x00005518, 0x6ea56e69, 0xb9ccf397, 0x10a31018, 0x0000fe0c,
+        0x73eb7309, 0xaa02adc0, 0xae01ae95, 0x0000448f, 0x77ac7739, 0xf87765a4, 0x67c967c7, 0x0000ba23, 0xbdc5bde0, 0x9c573b4e, 0xbf6abf0e, 0x0000b543,
+        0xe5cde54d, 0x1cf9e352, 0xdea0de93, 0x00006930, 0x06cc06f9, 0x4007372f, 0x734d7392, 0x000042e5, 0x35913560, 0x2d538fde, 0x17741772, 0x000077cc,
+        0xf484f49f, 0x037b7130, 0x8da68d06, 0x0000b17a, 0x704970f6, 0xc79cbdc8, 0x176e17e8, 0x0000f779, 0xc404c485, 0x5dcbbed4, 0x4940496f, 0x0000b6a8,
+        0x45f44583, 0xf2b6abaa, 0x2e6e2e60, 0x00005ee8, 0x976497fb, 0x085cb7ea, 0xee11ee16, 0x0000bfbb, 0xdd58dd1f, 0x06f43fcd, 0x1ea51e5f, 0x00003241,
+        0xad77ad65, 0xf877b0f8, 0x19501959, 0x00008190, 0xdf24df97, 0x3127e683, 0x8ea08ea5, 0x00007acc, 0xdb0bdb45, 0x02cbc7d3, 0x1d0b1dfe, 0x0000e289,
+        0xf0c9f03f, 0xb73fe3c2, 0xd32dd302, 0x0000de0b, 0xb716b779, 0x99678221, 0x821c82dc, 0x00001416, 0x95a39562, 0x1aaf75e2, 0xeb51eb3a, 0x000002ce,
+        0x393639a0, 0xbb7dc567, 0xd9b8d9e2, 0x00006b96, 0x5ef05e68, 0x07672756, 0x10791005, 0x0000ed74, 0x0ab80a2f, 0x10f28567, 0x4329438e, 0x00008d2f,
+        0x6cb76caa, 0xc4ca31a3, 0x23272330, 0x0000ca83, 0x19f719e0, 0xf4a0992a, 0xad22adf3, 0x000033ab, 0xe1e9e130, 0xc3cbeb73, 0x350f35d3, 0x0000dc57,
+        0x843a84f4, 0xeeec17b9, 0xcc15ccd9, 0x0000aa59, 0xe77de7d1, 0x60cf3dce, 0xdd96ddf6, 0x0000bb70, 0xf7f0f79f, 0x6ec1ff4c, 0xa04ea056, 0x000073ad,
+        0x77d177bb, 0xe47cf328, 0x8e688e1e, 0x00006815, 0xdbf3db63, 0x77cd7622, 0xe6afe60c, 0x00006d6a, 0x92c6925d, 0xbe12a840, 0xa458a44c, 0x000094bc,
+        0xd50ad56b, 0x0724aa02, 0xfb04fb37, 0x00003495, 0x9c349c61, 0x517941fb, 0xb6acb673, 0x00009667, 0xb8bab821, 0xd23e00c8, 0x0b170b14, 0x0000358c,
+        0x89d58996, 0x5407f3aa, 0x5280522f, 0x00006486, 0x6d616db4, 0x7a0d6ba3, 0xca35cab8, 0x0000ec88, 0xc3aac34d, 0xa3630f86, 0xef3cefee, 0x0000976a,
+        0x3c823c4c, 0xad31e873, 0x6131610c, 0x00000a39, 0xd9d4d977, 0xdc8fe9b0, 0xfb95fb0b, 0x000081dd, 0xfdf3fd65, 0xbf3a4dd6, 0x0b170b61, 0x0000e47b,
+        0xd335d306, 0x414616c1, 0x43a743ee, 0x000071ee, 0xc9d4c92a, 0xba4cbff8, 0x4bf94bd2, 0x0000dcb3, 0x3f7e3f9c, 0x0ea3adbd, 0xf8e1f89d, 0x0000b1a8,
+        0xe72ae72f, 0x23a2b15f, 0x0edf0e38, 0x0000c061, 0x0d360d11, 0x1b93f456, 0xe723e705, 0x0000db96, 0xe8bee895, 0x3edfaa9f, 0x6b036b50, 0x00006f6a,
+        0xd03bd03b, 0xe358ef13, 0x9bc99b6e, 0x0000adb4, 0x16d51616, 0x2c20e5d8, 0xddefdd6d, 0x0000ce55, 0xd836d8db, 0xe0622fe5, 0xd2e0d2bc, 0x0000bceb,
+        0xcfa4cfd0, 0xfab654b1, 0x8c628cbc, 0x0000beee, 0x597d59ac, 0x5b07c0c3, 0xdb60db2f, 0x00008dab, 0x71937124, 0x2059be7b, 0x7ce87ce1, 0x0000e552,
+        0xebebeb20, 0xdb385b03, 0x2dcc2d6b, 0x000022b6, 0x17c01772, 0x17da0695, 0x0e520e83, 0x0000fc3e, 0xc6d7c605, 0x9e21dda5, 0x84208405, 0x00009f7b,
+        0xa6c0a6ac, 0xf8f7f42c, 0xf46ff440, 0x0000b697, 0x35cc35f6, 0x31500cbf, 0xb8c0b82b, 0x00003826, 0xc522c521, 0x7f2b2162, 0x2e402e2a, 0x0000daca,
+        0xab05ab2d, 0xe7c1a25c, 0x703670c6, 0x0000eb1a, 0xf5e5f5a0, 0xf755ceec, 0x301e30c6, 0x00007861, 0x3f0f3fb4, 0xd10413e1, 0x9f139f17, 0x00005a45,
+        0x24c52438, 0xc70b2224, 0xc69cc622, 0x0000588a, 0xd9f2d924, 0x2a19f7d7, 0xfb6cfb8e, 0x000018e3, 0x573d57c4, 0x98f026af, 0xe86be812, 0x0000293e,
+        0xd21ed20e, 0x151c9e5a, 0xc5a8c52c, 0x00008c90, 0xc2bec2b6, 0xaa84c0ff, 0xd466d49e, 0x000074e1, 0x1813184e, 0xb4948dfe, 0x76497679, 0x0000cba1,
+        0x1f2d1ffc, 0x2592bcca, 0x206a207e, 0x000053fa, 0xd892d89d, 0x128bde23, 0x64f7640a, 0x00001b0d, 0xfa2cfa51, 0x91680d5a, 0xaad8aa01, 0x00006ca6,
+        0x6754676e, 0x44b07ab7, 0xb00bb097, 0x0000c912, 0xfc31fc2c, 0x74dd8c21, 0xbe16be36, 0x00008860, 0x9c499c62, 0x2f4dbc35, 0x25f12554, 0x0000edf6,
+        0x8ec78eed, 0xcfebfa4e, 0x44064447, 0x00007306, 0x72ab7279, 0xbfef665b, 0xf913f98d, 0x00001eaa, 0xb3cfb3b4, 0x4b7e46f8, 0x53f153e3, 0x0000f95c,
+        0x9c5c9ce4, 0x28b6faf7, 0x1be41ba7, 0x0000896d, 0xa6c0a662, 0x6eacb795, 0x3eec3ee8, 0x0000e937, 0xb018b0be, 0x2d4dc37c, 0xe92ee9d0, 0x0000819c,
+        0xa7d5a74a, 0xf6572944, 0xb779b791, 0x00004fa0, 0x42c8427f, 0xb375a9c7, 0x9a299acf, 0x0000d13f, 0x62816224, 0xb94b9581, 0x25ae259a, 0x0000ee5a,
+        0xe3cde347, 0xa0fce7a2, 0xf54ff5d7, 0x0000e3f4, 0x98719849, 0x359a8230, 0x10a610d1, 0x0000aa47, 0xa0b2a034, 0xfb035823, 0xe56ee5e4, 0x0000e27b,
+        0xe014e0c7, 0xb062b9ce, 0x4a804a5f, 0x000029c2, 0x7a337a3a, 0x3ff6eb72, 0x9d139d00, 0x00000763, 0xac2cac6a, 0xab7ec911, 0xf961f9a1, 0x0000f1e3,
+        0xedc7eda0, 0x086381cc, 0x360f3686, 0x00004823, 0x8611860d, 0x1adff427, 0x47cd47b7, 0x00009c78, 0x6c796c50, 0x95cacd48, 0x7f2b7fbc, 0x00008da3,
+        0x1e8d1ec0, 0x668016bc, 0x2a7e2af6, 0x0000676a, 0xfc7cfc5f, 0x7df62bc6, 0x7f217f5b, 0x00006ff4, 0x2e112e89, 0xe32cf255, 0x2d2d2d5e, 0x0000409d,
+        0x3b203bd9, 0xe1480b59, 0x685e684c, 0x0000ce8f, 0xc5a8c50c, 0x2f639e27, 0x6fc96f80, 0x0000f652, 0xa8f5a844, 0x1914d749, 0xa5eba501, 0x000099eb,
+        0xdfc0df58, 0x0bd7cf5c, 0xd26fd268, 0x00008a45, 0x12cd1245, 0x0c3b6014, 0x0f360fa8, 0x00003f11, 0x1fb91fa3, 0xa77eae87, 0xddc4dd7d, 0x00003457,
+        0x6e786e04, 0xc55dade2, 0xc214c223, 0x0000f4f9, 0x0b6b0b30, 0x2620459c, 0x982a98ba, 0x00000c26, 0xf97cf912, 0x3c9a9e27, 0x08010869, 0x000045a4,
+        0xe203e224, 0x75596739, 0xf7aef713, 0x00001b85, 0xc0cfc071, 0x69dde0d3, 0x330233b8, 0x000010e3, 0xb567b55f, 0xa1806e2d, 0xd81fd880, 0x000033ab,
+        0x28112847, 0x3460e9b0, 0xdf49df5a, 0x0000658b, 0x2c912c8b, 0xfcf4a6d1, 0xb847b84d, 0x00006ac8, 0x65b565d9, 0xb68a87cc, 0x0e9b0e80, 0x0000f0d2,
+        0x0ae30a94, 0xf52905b0, 0x5fb35f96, 0x000013a4, 0x09d40934, 0x1c4a479c, 0xd7b2d7a5, 0x0000f38d, 0x210e217f, 0x3d28a314, 0x05060593, 0x00005564,
+        0xded3de79, 0xa1c2d67c, 0x8e5f8eaf, 0x00003d96, 0x6d8c6d96, 0xc10b2974, 0x17b61761, 0x00003df7, 0x98fc98a0, 0x85159e62, 0x03bd0364, 0x0000b66b,
+        0x7f0a7fd7, 0x49bf7909, 0x3324339f, 0x00004bcf, 0x880c88d2, 0x2f0f550b, 0xb4ffb431, 0x00005209, 0xf1bff1a7, 0x346fe07e, 0x64736415, 0x00001436,
+        0x13f01386, 0x142fc3c3, 0xfb63fbbf, 0x00001d47, 0x58d958a7, 0xfa032fbb, 0x824882a9, 0x0000e4d2, 0x32493238, 0x92a678b7, 0xa964a972, 0x00005b54,
+        0xc75ec7ca, 0x62419dea, 0xc8e6c8d0, 0x0000650f, 0x61a16196, 0xa7a19b4e, 0x915c9102, 0x0000fc81, 0xcfe2cf24, 0x7ab58ede, 0x002000f8, 0x00000632,
+        0xde2cdec1, 0x0e5c648c, 0x397c3960, 0x0000fbcd, 0x22cc2288, 0x76f6e3bd, 0xfac7faee, 0x0000d4a5, 0x207a2068, 0xf13d1ad5, 0x202a207f, 0x000093d5,
+        0x722c724e, 0xfa00f1ec, 0x5b8a5b29, 0x0000e692, 0x512f51d6, 0x581711d1, 0xc3b7c37e, 0x00007613, 0xb983b922, 0x762d980a, 0x606960d3, 0x0000f55f,
+        0xf20df238, 0xacf15f91, 0x58e2583f, 0x0000c702, 0x4b1c4b4a, 0xa21db558, 0x373a3736, 0x00000c63, 0xc584c591, 0xc77a8431, 0xa26da2d6, 0x00003511,
+        0x775d7746, 0xfe44b358, 0x231a2323, 0x0000fcad, 0x3c5a3c13, 0xc6db6514, 0xd023d07f, 0x0000ac2e, 0x76547631, 0x8a37113e, 0x0005002e, 0x0000be79,
+        0x53745370, 0x7b67abb8, 0xfef5feaf, 0x00008f61, 0xa519a5f7, 0xc3c26fc9, 0xeb92eb14, 0x0000e4a9, 0x042c0434, 0x44b92e1d, 0x4659467e, 0x00005e6e,
+        0xb5e8b5f2, 0x85fbb3e7, 0x63586359, 0x000073fb, 0xbcffbca3, 0x8c173f31, 0xcf16cf97, 0x00001af5, 0xd8c5d8b6, 0xd177ec1d, 0xd32fd33c, 0x00003b87,
+        0xa41ba42d, 0x43c62980, 0x90969028, 0x00004000, 0x64dd64c4, 0xed131dd0, 0xfac4fa7f, 0x0000f80c, 0xab48ab68, 0xf72a10ba, 0xad21adf3, 0x00007591,
+        0x569a56f4, 0x6ce160d5, 0x0857080b, 0x000098d1, 0xd8a5d870, 0x342f216d, 0x0eaa0e9e, 0x0000e457, 0x80f980e4, 0x3ace09d7, 0x9aef9a16, 0x00004619,
+        0xb29fb24f, 0xdadb8490, 0x36963603, 0x0000fffd, 0x9873989b, 0x6af03d8e, 0x709b702a, 0x00004763, 0xff75ff1f, 0x655094c1, 0x615661ab, 0x0000ab25,
+        0xe075e00b, 0x931c7623, 0x51aa51f2, 0x00007f4f, 0x1e831e44, 0x8dc4d507, 0x5c105c08, 0x0000b08d, 0xd674d634, 0x6850ba40, 0x4f364f0d, 0x0000fc83,
+        0x5e485ec1, 0xd6e49161, 0x5bfb5b07, 0x0000b667, 0x85818538, 0xe4624b68, 0x897a89ae, 0x000092bd, 0x730a7329, 0x501dfefc, 0x4b7f4bd7, 0x0000eba4,
+        0xedd4ed80, 0xefa82abf, 0x8cb08ca1, 0x0000c2a7, 0x6eb46ee1, 0x286652aa, 0x402440ff, 0x00008bcc, 0xa20da27a, 0x6a605ebc, 0xca45caa9, 0x000047ee,
+        0xa7ada734, 0x88476ebe, 0xe694e663, 0x0000b8b1, 0x813e812a, 0xcf7a43ca, 0xd807d83b, 0x00005799, 0xd717d79c, 0xc0852d33, 0x7fd37f3b, 0x000070b8,
+        0x49d3491a, 0x04251603, 0x8c018cb3, 0x0000ac47, 0x45a245df, 0x9ebf0f02, 0x5e8c5e59, 0x00006d15, 0xf797f7fe, 0xaac54b71, 0xcf74cf75, 0x000086ff,
+        0xe014e09b, 0xd2d4e423, 0xcdaecd3e, 0x00005409, 0x93b393d0, 0xdf1d42c9, 0x52f552c3, 0x0000548a, 0x17041743, 0xfdb6eaf0, 0xe9c8e9df, 0x00001bd6,
+        0x7b177ba1, 0xf9cc6b34, 0x185d1813, 0x000015b6, 0xdc3ddc43, 0xf1182537, 0x111c1165, 0x00000d39, 0x066b068d, 0xae2e98b5, 0xcc83ccf3, 0x0000bf24,
+        0x170717ca, 0x5251c3c3, 0x5e475e60, 0x00006470, 0x19281997, 0xb7263883, 0x76fb7614, 0x0000a155, 0x7c3f7c09, 0x6450e622, 0x3b8f3b09, 0x0000d2a5,
+        0xf052f0f4, 0xe04367e5, 0x791779c1, 0x0000709a, 0x788d7860, 0x113aa71a, 0xd01bd0d8, 0x00001080, 0x1a3d1ae0, 0x778eb327, 0x01ae01fa, 0x0000faa3,
+        0x664566dd, 0x8b28c564, 0xe0e7e07c, 0x0000c98d, 0xceb1ce02, 0xb61b34ee, 0xa61aa6ca, 0x0000ef24, 0x32ac329e, 0x0a9b9407, 0x32ed32ac, 0x00009316,
+        0xe6c2e6fc, 0x12d919b9, 0xde91def3, 0x0000e3f4, 0x532753d5, 0x4e093466, 0x85f485ed, 0x000004a1, 0xee1aee83, 0x998d4046, 0xbed3be39, 0x00003e06,
+        0xa4f5a427, 0xb89758dc, 0x2dc52d01, 0x000046bb, 0x0bb20b12, 0x4debdd1d, 0x09350933, 0x00003e12, 0x35be35fc, 0x1d1ff60c, 0xde0fded2, 0x0000a259,
+        0x4c364c99, 0x31af84ac, 0x16761639, 0x0000e616, 0xa57ea545, 0x3f0a78b6, 0xa14ea119, 0x00007556, 0xbd89bdc0, 0xfd6e4be4, 0xf4e1f4e6, 0x0000cede,
+        0xd840d822, 0x45563b91, 0x352235ca, 0x0000fa7e, 0x07ee07c3, 0xe012c2c5, 0xb933b922, 0x0000cc39, 0xfef1fece, 0x54c8fa4e, 0x1119113a, 0x0000475c,
+        0xd925d91e, 0xa583c4de, 0x15c91582, 0x0000d9da, 0xca49ca2a, 0x1264a7ab, 0x1eb61e1f, 0x00006225, 0x67336737, 0xe6c1e676, 0x69256902, 0x00003a8c,
+        0xfbfffb1d, 0x42b92162, 0xe6dde610, 0x000093d4, 0x98d498d3, 0x101d3ad1, 0x820c82b5, 0x00006217, 0xf87ff869, 0xe32c9183, 0x1ce11cac, 0x00007770,
+        0xe88ee834, 0x79095de3, 0xc86ac890, 0x00005b1c, 0x640a64fd, 0x9fe70b94, 0x71627122, 0x0000b831, 0x341b3440, 0x88c7adc7, 0x598f5945, 0x00009d31,
+        0x117511a0, 0xf8d9fa8d, 0x88a288a3, 0x0000c9b8, 0x36e63653, 0xd16bf3ac, 0x4a454ae8, 0x00001263, 0x51a3510f, 0xfa019243, 0xaa11aa48, 0x0000dd98,
+        0xa65ca68b, 0x80a69bad, 0x624b6248, 0x00002ec6, 0x1dbd1dc7, 0x4026004a, 0x5c315c44, 0x0000d0a5, 0x82558225, 0x8ee831df, 0xb499b4a4, 0x00003df0,
+        0xb4e7b4d0, 0x98765a9f, 0x1a671a49, 0x00003be6, 0x50965087, 0x653222a2, 0x49b7495b, 0x0000ec52, 0x94e694cb, 0xd3cb2c14, 0x3ecf3e72, 0x0000958a,
+        0x68f5688d, 0xc3ad47bf, 0x4f4d4f40, 0x00009515, 0xcc08cc84, 0x718e34d0, 0x700c7077, 0x00002176, 0x47c14779, 0xae8409d9, 0x26862613, 0x00004ef6,
+        0xe6d3e66b, 0x34102d30, 0x714471e0, 0x0000a9ed, 0x0b890b6e, 0xa360e5a7, 0xa1b9a1ce, 0x00007afe, 0x1a6f1ab4, 0x41179e2a, 0x4c074c45, 0x000004f0,
+        0x2ead2e16, 0xe2470629, 0xddc8dd3e, 0x0000825f, 0x979d973b, 0x1e8a84ec, 0x566d5661, 0x0000e285, 0x3f6e3f65, 0x1ddae721, 0xd2e6d20f, 0x0000475d,
+        0xd92ad99d, 0x02a4c343, 0xbdbbbd1b, 0x0000933e, 0x793779a6, 0x923e41bc, 0x056e059b, 0x0000dbeb, 0x30e330d5, 0xa4cc3ccf, 0x041404c0, 0x00003cb3,
+        0x40714076, 0x5b29e127, 0xabddabb9, 0x0000850f, 0xe889e892, 0x726d899b, 0x57d95734, 0x0000e3ca, 0x8228826d, 0x5a3f4b36, 0x096809eb, 0x0000e429,
+        0xcde6cd03, 0xb37cacb8, 0x256d2524, 0x0000f7e7, 0x052505b7, 0xdc8fad9d, 0xa559a5ca, 0x0000bd10, 0x6e066efa, 0xbd017f3d, 0x86978695, 0x00005cb5,
+        0x492649b8, 0xd22094c7, 0x2e132eda, 0x000000fa, 0xbfc0bfe7, 0x107664a5, 0xdad4daaa, 0x000031a1, 0xc5c8c561, 0x7ab5bc78, 0x4ea14e77, 0x000057f9,
+        0x088d0898, 0xd7ebd7f9, 0xf0a1f073, 0x000062ec, 0x840984d0, 0x5e105707, 0x6172611e, 0x0000ae74, 0x956e9521, 0x545f4444, 0xd5add555, 0x0000ff9e,
+        0x1b801b28, 0xb0c04b61, 0x4b404bd2, 0x0000ca91, 0x5f675fc0, 0xe7622f1a, 0x95f89563, 0x000036ab, 0x99399927, 0x5efd88d0, 0xd40ed4da, 0x00002cdb,
+        0xd9a6d9d6, 0x2c201d5f, 0xaa49aa20, 0x0000dfd5, 0xd985d960, 0xc785beb6, 0x7d547d6f, 0x0000111a, 0x1f591f5c, 0x38eabf77, 0x3ee33eec, 0x00000ebc,
+        0xccf9cc93, 0x308d6104, 0x71e3713f, 0x0000493a, 0x232e2384, 0xd9bfc0fb, 0x7e547ea1, 0x000098f7, 0xc320c320, 0x72960ddc, 0xd398d322, 0x0000153d,
+        0x085d082e, 0xa1d0ef16, 0x143e14b3, 0x00007930, 0x6b406b68, 0x77b5544e, 0x93599303, 0x00005a2b, 0xf32ff309, 0xbe8ef6ac, 0x8cc68c72, 0x000099f7,
+        0x0cfb0cdd, 0xcf24e094, 0x668d663b, 0x00001763, 0xaefeaee9, 0x647f91e5, 0x2bce2b65, 0x0000213e, 0xefd9efe9, 0xedc6ebcf, 0xd189d127, 0x0000f719,
+        0x7557759d, 0x9dd9d5d4, 0x1865182e, 0x00008760, 0x781378d8, 0x9e5cfe86, 0x6ca66c1a, 0x0000c62d, 0x93699334, 0x825efc28, 0x9f599f6e, 0x0000f662,
+        0xf8f3f833, 0x926b192e, 0xe54be526, 0x0000fb7e, 0x04c90462, 0x40ba9631, 0x7db47d38, 0x0000cd10, 0x05d10527, 0x6ec0c96e, 0x16e51677, 0x0000d088,
+        0x41fd4187, 0x93e9675a, 0x3d1c3d77, 0x00008880, 0xb7a9b730, 0x40652b3b, 0x2683263a, 0x0000c7f1, 0xb2a7b2ad, 0x4f26479c, 0x8032804c, 0x0000298b,
+        0xa30aa3c4, 0x7d45d356, 0x5114518d, 0x00005fa7, 0x96fe963a, 0x7c02366f, 0x0ddd0d4f, 0x00004b04, 0x29522993, 0x82e9fbfa, 0x9952992b, 0x00009614,
+        0xfa98fabf, 0xd34f8ca1, 0xd2e3d2b2, 0x000030e3, 0x4c594c01, 0xd9c41222, 0xa578a58a, 0x00008ce4, 0xfef8fe17, 0xf2256227, 0x8f258f57, 0x0000e66a,
+        0xd3c7d33c, 0x77b1219b, 0x223822b8, 0x00005da6, 0xfc98fcf9, 0x7de98505, 0xadb0adbe, 0x0000beee, 0xa82da8e4, 0x5e69ade2, 0x6f906f34, 0x00004e04,
+        0x80578072, 0x96cb7410, 0x011d0129, 0x00004a37, 0xd5d6d5b5, 0x7bda2a06, 0x4c274c81, 0x000093d4, 0x901f907a, 0x82c8980a, 0x68226825, 0x0000f45d,
+        0x35243580, 0xe80e1348, 0xde9ede24, 0x000065ca, 0x7de07db2, 0x1b1fb6ea, 0xba3dba29, 0x0000b8ee, 0xcb2bcbb9, 0x692ebcb6, 0xb9aeb9aa, 0x00004ca9,
+        0x6f1a6fa8, 0xb36cede2, 0x559155e3, 0x00006ad4, 0xb354b306, 0x1bda92ba, 0x48c948cd, 0x00008880, 0x5a795aa0, 0xa551cae3, 0x4ed54e24, 0x0000358c,
+        0x89f589e3, 0x2a16f561, 0x4f884fc0, 0x0000d75a, 0x70cc70f0, 0x7c8f98e3, 0x7ab07a82, 0x000026cb, 0xccfacc61, 0x0f2566c5, 0x1ce31ca5, 0x00008861,
+        0xd559d572, 0xb057294b, 0x1f2a1fc1, 0x000097fe, 0x3a053a6a, 0x9549f8e7, 0x7ca47c19, 0x0000bc10, 0x69ab692c, 0x110fe83d, 0x2ba02bfd, 0x000040ef,
+        0x93e593c4, 0x29419127, 0x23dd2341, 0x00002f9a, 0xff26ff09, 0x88f8ac65, 0xb729b7db, 0x00004cf2, 0x3a0b3a42, 0x4a366285, 0xb840b8e0, 0x0000547a,
+        0x0d110d3e, 0xfede1521, 0x32b93273, 0x00004e9d, 0x9dbd9d92, 0x791a0ee7, 0x0e540e0d, 0x0000ba01, 0xf6d3f6f4, 0x7e543c0f, 0x1fea1fec, 0x0000b5b1,
+        0xfe00feb3, 0x7a05fb98, 0x75fb7524, 0x00007219, 0xd5c6d55d, 0xacdb0867, 0xf80df834, 0x0000a177, 0xb54bb51d, 0xb94f7fc4, 0xac0dac90, 0x00004a8f,
+        0xbef8be1a, 0x3ddb4ea8, 0x7db07d18, 0x0000098d, 0xea7dea96, 0x1fca8dba, 0xc668c611, 0x000032cf, 0xe6c8e6ae, 0x6b00957e, 0x06a00666, 0x0000fe0d,
+        0x57b8573a, 0x8d786eca, 0xc177c1b1, 0x0000a1d7, 0x573f57ec, 0x9c58af8a, 0xf345f327, 0x00005984, 0x6fe86f5d, 0x0ae648dd, 0xd369d36d, 0x00003194,
+        0xeda9edb7, 0xc135732d, 0xf233f26e, 0x00008b0e, 0xcca9ccf1, 0x27d264a2, 0x89dd89cd, 0x0000977d, 0x3b8d3b68, 0x0efe8ac1, 0xe93ae959, 0x00009890,
+        0x7257720c, 0x49d3b0f8, 0x3d4b3de5, 0x00002119, 0x282f28f1, 0x35b7c2dc, 0x183f18b7, 0x0000fcd2, 0xcb7ecb57, 0xb5130375, 0xe851e8a6, 0x00002d34,
+        0x81378142, 0xdbedbb59, 0x5988591d, 0x000056bb, 0x06a30658, 0x5bc80ca4, 0x023a0233, 0x00002024, 0xefedefba, 0x9f79c017, 0xe616e64b, 0x00003444,
+        0xa3fca3dc, 0xc00bb984, 0xbdc0bd13, 0x0000412f, 0xa11ea1d0, 0xf09b578a, 0x8da88dfb, 0x000015c9, 0x4d244d0a, 0x4ec9dbdb, 0x34583419, 0x000065e1,
+        0x0104017d, 0x359aaafc, 0x7b697b8f, 0x00004ef4, 0x2b872b97, 0x48959238, 0x4e6f4eab, 0x0000f21d, 0xeb29eb2b, 0x220e5eae, 0x527a5286, 0x0000412e,
+        0xf436f4be, 0xd7f4a0d1, 0xec55ec0f, 0x0000bb11, 0x7a847a19, 0x1042fd42, 0xb5acb5ba, 0x00007f8c, 0x67dd6733, 0x934fa93f, 0x5b1c5bb5, 0x00007efe,
+        0x862d86f8, 0x34653024, 0x2363234f, 0x0000a6b4, 0xcd7dcd12, 0x4c252754, 0x9923999e, 0x00006bd5, 0x460d4677, 0xc86632e0, 0xa969a9b8, 0x0000eefd,
+        0x769c76d2, 0x605043f5, 0xe5f3e5b6, 0x0000c207, 0xa9c3a99c, 0xec02c5ea, 0x765976be, 0x0000ab5a, 0xec59ec63, 0x114c6625, 0x3afc3a04, 0x0000f462,
+        0x6c216ced, 0x536882cf, 0xa35ca3d4, 0x00005a68, 0x9a9f9ae8, 0x8f6e05db, 0x5e535e45, 0x0000800e, 0xc1c7c122, 0xbdea7e84, 0x6068603e, 0x0000dbe8,
+        0x48ff480c, 0xb5b458a3, 0x677d67b4, 0x00007eb8, 0x924c92aa, 0xe7e3da3c, 0x6d066d95, 0x0000bd91, 0xfebffe68, 0x8ab6e680, 0x7bf27bb6, 0x00001717,
+        0x936593f6, 0x13eeee02, 0x40a74022, 0x0000206d, 0xff09ff60, 0xba4dbea0, 0xa922a91f, 0x000013e3, 0x566156b0, 0x5bfdfe0f, 0x48394819, 0x000061af,
+        0x684568e1, 0xc0a63831, 0xe253e247, 0x0000479d, 0xd8e9d861, 0x97c74ced, 0xa8a3a803, 0x0000a964, 0x3cff3cff, 0x27b28790, 0xaaf3aad6, 0x00009ceb,
+        0xb5c9b5ae, 0x9dfa50c2, 0xf66af6a1, 0x00007efe, 0x52a752cf, 0x47261349, 0x6cfd6ce7, 0x0000f011, 0x8eab8e28, 0xdff1db24, 0xb447b414, 0x0000cff0,
+        0x719d718c, 0xfeade11a, 0x6c846cb2, 0x00005f76, 0x48394824, 0x41e444db, 0xf4eef4e6, 0x0000911f, 0x94689442, 0x6edf297a, 0x6cf16cec, 0x00009eab,
+        0x40924057, 0x95af2174, 0xc299c24e, 0x00006f58, 0x77c4773e, 0x9d57d32c, 0x7aad7afd, 0x00004f01, 0x2df02ddb, 0x5e07eef3, 0xb4dbb47b, 0x0000e9e3,
+        0x10f010f8, 0xe4209ad5, 0x1a291a7b, 0x0000c02d, 0x42f342f8, 0x8028b615, 0xf159f1b1, 0x0000df57, 0xb9b6b9c9, 0x706926de, 0x0971099e, 0x00003713,
+        0x15f41501, 0x155a8fe1, 0xba77ba26, 0x0000f120, 0xb4ceb43c, 0x08143fce, 0xc8edc819, 0x0000b608, 0x86e786b2, 0x9e2cc0dc, 0x462f467c, 0x0000adfb,
+        0x6a5d6a2d, 0x7b8e0969, 0xa857a84e, 0x00002c67, 0x63cd634d, 0x1adeb696, 0x298129ef, 0x0000488f, 0x6f806f23, 0xedf18f20, 0xe567e577, 0x000065af,
+        0x6a5a6a97, 0x23828072, 0x0e520ed3, 0x000013e3, 0xa3d0a3ac, 0x5c04fb8c, 0x8ed18e12, 0x0000ae8a, 0xbfdfbfa9, 0x954eadc0, 0xa969a9df, 0x0000a159,
+        0x8c238c95, 0x48f694fa, 0xd85ad85c, 0x00001d98, 0xd9f7d927, 0x32b2bff8, 0x013b0128, 0x0000880e, 0x0ebe0ea5, 0xf07c03eb, 0x9f6f9f35, 0x0000c841,
+        0xdba4db8d, 0x8e79f7e3, 0xbdadbd1b, 0x0000a1c0, 0x46064682, 0xa363eb70, 0xc5fec54d, 0x00001117, 0x959c95a8, 0xa4c2ef93, 0x6aa36a2e, 0x000058b5,
+        0xd1ddd1a2, 0x1cb5ee07, 0xd600d628, 0x0000e20d, 0x1b281b81, 0x50e7ff3b, 0xe251e298, 0x0000dae6, 0x2f402f94, 0x304819b9, 0xd8f9d8e9, 0x000098d1,
+        0x2b3d2b97, 0xacc5dead, 0xc52cc57e, 0x0000449d, 0xe8a8e8b5, 0xcca56cf7, 0xbca8bc3a, 0x0000c7f2, 0xbdeebde4, 0x0aa4bbc4, 0x04690449, 0x00003407,
+        0x688b6860, 0x5fd50d5b, 0xf4b5f48b, 0x00000946, 0xef0eef3c, 0xd3f015c1, 0x35763563, 0x00009bc8, 0x4077400d, 0x92e95130, 0x02c102bc, 0x0000b2a8,
+        0xba3abad9, 0xadc276ad, 0x6695667b, 0x0000fabe, 0xcef6ce55, 0x095aeacc, 0xef64ef79, 0x0000f9fe, 0x0359037b, 0xf557b6f8, 0x3fb33f91, 0x00007fb0,
+        0xddb5ddb0, 0xc71428bf, 0x732073bc, 0x0000e032, 0x7aac7a3b, 0x4378c48b, 0x42774290, 0x0000c90a, 0xf921f910, 0x678dd503, 0x20a220f9, 0x000053c4,
+        0xb323b39d, 0xb61acc0e, 0x2ad42a79, 0x0000aed9, 0xfafbfade, 0x6abfc8e3, 0x0de90d4d, 0x0000d8b7, 0x08de089b, 0x06ea6cea, 0xf686f66b, 0x0000cc07,
+        0x98829861, 0x8c6045c4, 0x1ea11eed, 0x000097fe, 0x754875f5, 0x97ab573d, 0x577f5772, 0x0000e7a4, 0x9108912e, 0xfae08a57, 0x0b7e0b9b, 0x00004ef6,
+        0x732a7348, 0x59075bcc, 0x2f5c2fcd, 0x000055a7, 0x4254424e, 0xf5be71a9, 0x3b6d3b79, 0x0000748f, 0x43e8435b, 0x2b21468f, 0xab90ab3d, 0x000099aa,
+        0x1bbb1b3b, 0x20d5a7db, 0xb2fab20b, 0x000027c5, 0x8aad8a11, 0xa0a18a53, 0xf434f498, 0x00008ada, 0xe0aee08d, 0x8725ed42, 0x3a5f3af3, 0x00001279,
+        0x7ffc7f2b, 0x260fff79, 0xc4a7c4e6, 0x000063f6, 0xea27eaef, 0x17da0a14, 0x86fd861c, 0x000076dc, 0x8b308b10, 0x42ab4d2b, 0xe552e522, 0x00005479,
+        0xa515a522, 0x78595fee, 0x34583432, 0x00003168, 0xf5e3f5f8, 0x024587fe, 0x18e418a6, 0x00007c4e, 0x84f684a3, 0x905c5601, 0x545154e4, 0x0000700f,
+        0xa524a5e0, 0xe2d38758, 0x164816f5, 0x0000449d, 0xeb28eb1f, 0xa6a17250, 0x4b894bbe, 0x0000f5bd, 0x063906b1, 0xcb9a89ef, 0xdc80dcf6, 0x0000829c,
+        0x436f4350, 0xc824bdf6, 0x512c51f6, 0x0000cfde, 0xa11da1b6, 0xe5d34042, 0xe54fe500, 0x0000d13c, 0x16a716d6, 0x159ef228, 0xe3b3e3d0, 0x000038e6,
+        0x9cdc9cf9, 0xbc3aebcc, 0x1e0c1e8c, 0x00009b8a, 0x2b3b2b1e, 0x3cc318a8, 0x6b5d6bf2, 0x0000c8ce, 0x96e59658, 0xbfec4b61, 0xcb2ccb70, 0x0000a51b,
+        0x930b9356, 0x61ec004b, 0x78ed784f, 0x00000ed2, 0x884c8802, 0x95ca5630, 0x1e2b1e39, 0x0000978a, 0xc167c1e0, 0x51eccc0e, 0x3858384d, 0x0000141c,
+        0xae1fae8b, 0xff4ee75e, 0xe65fe605, 0x00002e63, 0x8d3a8d22, 0xbf754910, 0x1f751fb8, 0x000017f7, 0x21192106, 0x4b0b182e, 0xadb6ad2c, 0x0000b9b1,
+        0xf1def1dc, 0xc9a4a130, 0x222f2210, 0x000086ff, 0xa5b0a5f1, 0x7c6d1447, 0x17f217ad, 0x0000f719, 0x876d8708, 0x6c09b494, 0xb152b111, 0x0000880e,
+        0xccf8cc56, 0x6935123b, 0x94879451, 0x0000ca41, 0x9acb9abd, 0xea58bb90, 0x3fe93fb1, 0x0000e289, 0x28bb2869, 0xc8550f27, 0x02f90252, 0x00005484,
+        0x8b0c8bb9, 0x25dc55cf, 0x5a785a08, 0x00002f66, 0xf6edf605, 0xd76bfdda, 0x50b05034, 0x0000086b, 0x5dc45df0, 0x132fc1fe, 0x269126d8, 0x00007a21,
+        0x532553a1, 0x84bf35ad, 0x0c350cb9, 0x0000f662, 0xda6cda90, 0xc6e19f27, 0xace4ac5b, 0x00001229, 0x5602566b, 0x220f5b48, 0x72df726f, 0x00007770,
+        0xe43ee4a0, 0xabc397f0, 0xa05ea0d5, 0x0000e7ad, 0x085a0860, 0x8db88a2e, 0x93f4934f, 0x000097fb, 0x223c223a, 0xac331141, 0x023f0233, 0x0000880a,
+        0xd688d638, 0x4fd4c95e, 0xe179e181, 0x00007dbb, 0x89658938, 0xe5f2e4e2, 0x29fa291d, 0x0000bb93, 0x8e7e8e61, 0x9da673d5, 0xc942c9ba, 0x0000544b,
+        0x28af282d, 0x4d091786, 0x60c9609a, 0x000092d7, 0x0bbf0b98, 0x6b50b0a7, 0x563a5608, 0x00005ee8, 0x03cd03c1, 0x677beaf3, 0xdd3bdd95, 0x000051e8,
+        0x6bea6b69, 0x89676c55, 0xbd1cbde1, 0x000092e1, 0x15f4158a, 0x9e52d984, 0x966d9615, 0x000089d8, 0xd0e1d058, 0xcdca1a0d, 0x2f822f1f, 0x0000f9a0,
+        0xf683f6ac, 0x3bdcf711, 0x34e534ee, 0x0000f7ec, 0xa5eba5d2, 0x3c027e3a, 0x47f647a8, 0x00002766, 0x5709571a, 0xe6a3ffb8, 0x2eaa2ea3, 0x00009aae,
+        0xc8bfc8e4, 0x0144b754, 0x45204538, 0x0000a201, 0x8fec8f83, 0x07d5ca8e, 0xe42ae439, 0x0000d017, 0x0d4a0d33, 0x4a14c2c5, 0xf04bf015, 0x0000f3f1,
+        0xcf4ecf55, 0x5a385a60, 0x6b016b4e, 0x0000dadb, 0x630463a4, 0x1d41fc1c, 0x083608e4, 0x00002175, 0x4490447d, 0xdb387c42, 0x591059a9, 0x000013bf,
+        0xe97ee968, 0x05a786fe, 0xe4bae4bc, 0x000069d6, 0x67a06744, 0x190580b1, 0x453745a2, 0x0000d3da, 0x29f029d5, 0x3347131a, 0x984198f9, 0x00002d34,
+        0x5404545f, 0x7c3f36bf, 0xf558f5fc, 0x0000f2d3, 0x407940f5, 0x0e0ac5cf, 0x35193521, 0x0000748f, 0x18791827, 0x3cf8f309, 0x5d495d74, 0x0000bd10,
+        0x042a04c8, 0xa643f3ac, 0x881a8814, 0x0000e8ab, 0xcbddcbb7, 0xf29bd436, 0x10191029, 0x00005a06, 0xb737b7c9, 0x55079227, 0x39b13965, 0x0000b0f2,
+        0x025b028b, 0x8d47a133, 0xbb3dbb9f, 0x00005cb9, 0x23cc2389, 0x97d4fe83, 0x6c7f6cbc, 0x0000ba10, 0xda08da47, 0xce44ce51, 0x12c81279, 0x0000fb4c,
+        0xe33ae376, 0x326e3cce, 0x3420346d, 0x0000ecf8, 0xf055f083, 0xd8abbd40, 0xffe3ffa4, 0x0000d3eb, 0x1bbb1bc7, 0x8f17a5d3, 0x4bd64b56, 0x00006fd4,
+        0x58c45849, 0xf94948dc, 0x6b186b74, 0x00008503, 0x1f151f4c, 0x8126f128, 0xd223d27d, 0x0000dcde, 0x2ae72ad3, 0xfccf48eb, 0x28822819, 0x00001c14,
+        0x0ed00e60, 0xc2ca2562, 0xe057e0e1, 0x00009ed8, 0x321632ac, 0xa3011bec, 0xc841c80a, 0x000033f5, 0x67ba67c6, 0x69225c26, 0x50a65015, 0x000015b6,
+        0x0b690b5e, 0x8587c8e5, 0xc219c269, 0x0000a2b1, 0x434543d8, 0xd6ccbbea, 0x53555325, 0x000038b9, 0xf1dbf108, 0xc75d09d8, 0x95b99512, 0x00007931,
+        0x81a48179, 0xf66f16fd, 0xb753b744, 0x0000a045, 0x788e78d4, 0x5ad85ae0, 0x29a5296c, 0x00001017, 0xcd3ccdb5, 0x75da9e35, 0x8c288c7d, 0x000041cf,
+        0x950e9546, 0xb4664da8, 0xff91ff74, 0x000033ab, 0xc324c35f, 0x92c98c5d, 0xfc20fc7e, 0x0000b1b5, 0x663e6626, 0xd0c714cd, 0x7f567f7e, 0x000057b9,
+        0x5ab25a7a, 0x5632eabd, 0x76f476f0, 0x0000db3a, 0xf12af153, 0x37d86a4a, 0xf450f485, 0x000061f6, 0x08de083c, 0x76b1dddb, 0xd758d7c0, 0x00003ecc,
+        0x764b76f1, 0xf456bef5, 0xa0a7a0ec, 0x00000a0d, 0x425442f3, 0xd93bb3d8, 0x93309358, 0x00009615, 0xba0dba08, 0x9630cd1a, 0x2c6c2c5f, 0x0000da9b,
+        0xe72ce74a, 0x9d9348e2, 0x571257cd, 0x00007e61, 0x121e1229, 0x97c767d9, 0xf3bcf3e6, 0x0000903b, 0x354e355d, 0x5782d8a5, 0x9693961d, 0x0000ec9b,
+        0x137f1317, 0x4f106ef7, 0xf197f1ce, 0x0000bc18, 0xf81cf8dd, 0xe07f0914, 0xbebbbe02, 0x0000867c, 0xe9ede939, 0x2d4c32a2, 0x94cf946d, 0x0000ca8d,
+        0xdd82dd9f, 0xd55ed9e8, 0xb725b7c7, 0x000037f1, 0x111311b7, 0xb02a756f, 0x7d7c7d05, 0x00005277, 0x0bfa0ba5, 0x65cdc2dc, 0x11f311bc, 0x00005928,
+        0xe87ee8aa, 0x6b32fcc5, 0x71497172, 0x000097bc, 0xce33ce39, 0xb41e834c, 0x813381fe, 0x0000055d, 0xce73cee7, 0x0699b7d8, 0x1920192c, 0x0000b250,
+        0xa1bca174, 0x65baf30c, 0xf538f54d, 0x00008ffa, 0xcff2cf2e, 0x18b2cb68, 0x73457396, 0x00007331, 0xdce9dc94, 0x3346cdd7, 0x40d34092, 0x0000618b,
+        0xe89ee81d, 0xbf99e2ef, 0x22ad22f4, 0x00003081, 0xc33ac37f, 0x57f097be, 0x911a9143, 0x00001728, 0x4ff74f9e, 0xaa3323b0, 0x637263db, 0x0000a7f7,
+        0x8e308e45, 0x46f689ea, 0x556c555a, 0x00003794, 0x80378046, 0xa57ffb39, 0x5c455c37, 0x00006370, 0x89e8892e, 0x490570d3, 0x051a051c, 0x00002af9,
+        0xc2e9c221, 0xf2561e94, 0xa960a9d2, 0x0000b743, 0xf967f9d8, 0x7d98cc41, 0xb976b963, 0x0000fe1a, 0xcd0acd63, 0xf99b85f3, 0xef92ef0e, 0x00008506,
+        0x678267d2, 0xda78901f, 0xb93cb957, 0x0000f362, 0x50fa50c7, 0x32e0c449, 0x195d1989, 0x0000a62a, 0x167f1661, 0xf3cc94c7, 0xbb79bb48, 0x0000f21d,
+        0xacc5ac62, 0xe958beb4, 0x89b7890d, 0x00002d34, 0xf7f9f707, 0x4aabab7c, 0xc0fcc0b0, 0x0000c765, 0x97cc979a, 0xae607567, 0x2355230b, 0x0000505b,
+        0x163b16ac, 0xbaccc100, 0x324232ff, 0x000007cf, 0xfadbfa13, 0xb31dc5f7, 0x9a539aef, 0x00009890, 0x355c3579, 0x728aa6d1, 0x908890eb, 0x000068d5,
+        0xc7d6c734, 0xc99a8d83, 0x16ef1608, 0x00007e02, 0x15c015cb, 0x2c4cb4a9, 0x4161418f, 0x000042ff, 0x9b049bbb, 0x4b088631, 0x0fa90fff, 0x00000971,
+        0x4170417d, 0x50393fcd, 0x568a56af, 0x0000a255, 0x5d665dbb, 0xc32a1ce6, 0x5c065c94, 0x0000c5b3, 0x6e686e78, 0xa2e288d0, 0x86fe8654, 0x00003d13,
+        0x49dd49e5, 0x4b7e9070, 0x935593ef, 0x0000c69d, 0xad20ad48, 0xfd6e13cf, 0x76387638, 0x00000817, 0x39c939e6, 0x0715c866, 0x0774077f, 0x0000c360,
+        0x9f3a9fc8, 0x3abbf2d4, 0x0c2c0c94, 0x00001ed3, 0x1c4e1c2e, 0x1f411165, 0xf802f80f, 0x00001a93, 0x169216d6, 0x48e85467, 0xc6fbc683, 0x000076e0,
+        0x160a16f3, 0x262307f7, 0x5e765ea8, 0x0000ea0d, 0x93fb93be, 0x770e6939, 0xcdf8cdb6, 0x0000684a, 0x24082460, 0x89984efa, 0xc93cc9d6, 0x0000d8b3,
+        0xcc3bcc8e, 0xf11d89d1, 0xc384c3db, 0x0000aec1, 0xa80ca8c7, 0xb7dc4c96, 0x53a153c9, 0x0000b810, 0x53cc5343, 0x7985a3f7, 0xc100c183, 0x00002729,
+        0x1a011a14, 0x926bc7c3, 0x7b847b6d, 0x0000e06f, 0x9c929c9c, 0x0b9b335f, 0xa2c4a276, 0x0000a201, 0x806b80f0, 0xfed15e4d, 0x5d395d73, 0x00002e86,
+        0x44ed4467, 0x571adfa5, 0x358635fa, 0x00008fef, 0xa721a74c, 0x027b4d31, 0x588058b3, 0x00003006, 0x65ca6597, 0xd0bae293, 0x3ba13be3, 0x0000b411,
+        0x5b8d5b9b, 0x8919e831, 0xb8b5b82e, 0x00002f67, 0xdfd5df2f, 0x763ef468, 0xaaf9aa56, 0x0000039f, 0xa9bba967, 0xff36b2d8, 0x80db8094, 0x0000c90a,
+        0x7d237d46, 0x227219f0, 0x753675c0, 0x00006730, 0xe09ae052, 0x8209d898, 0x8add8a8a, 0x0000f873, 0x8ef88eca, 0xa61de832, 0x042104a9, 0x0000e4ab,
+        0x0dfb0db9, 0x289c4a62, 0xe65de6b3, 0x00009714, 0x13d61307, 0x98aebef8, 0x32c2323d, 0x0000e21b, 0x37fb3747, 0xc5ca5ba5, 0xcfa7cf01, 0x00006317,
+        0xb892b8db, 0x153e7f3d, 0x78f878ee, 0x00002756, 0x94ec94ba, 0x8a36d2f6, 0x3aae3a16, 0x0000a51b, 0x2ef02ed3, 0xc8270ed9, 0x544f5452, 0x0000628b,
+        0x1da21dc3, 0x88272cb1, 0x900d90df, 0x00005e18, 0xde36debc, 0x3e042756, 0xaedfaec7, 0x0000f295, 0x79597935, 0x901c502d, 0xfa78fa29, 0x00007c4e,
+        0x11db1142, 0xf39bb8b6, 0xd683d623, 0x0000b94e, 0x73fa7372, 0x1b6ab140, 0xac8cac78, 0x0000fba1, 0xd44ed4f5, 0x27b01541, 0x15821582, 0x0000cf8d,
+        0x8566855a, 0xddb0140f, 0x435243a7, 0x0000d1d9, 0xf1cef159, 0x876ff84c, 0x59085977, 0x000061af, 0xd2cad2bd, 0x77700d27, 0x56a05617, 0x0000ff5c,
+        0x175717f3, 0x667f05b8, 0x864486b0, 0x0000b281, 0xa933a94e, 0x9bce73d6, 0x5b035b58, 0x00006ea1, 0xebbdeb5c, 0x0c35287e, 0xd99cd9f6, 0x0000da37,
+        0x429b42b8, 0x5b3ca15f, 0x0b150b14, 0x00005909, 0x0e210e33, 0xe71e0461, 0x89a289a0, 0x00004b8f, 0x389738a7, 0x88673fcd, 0x0a870a6c, 0x0000b9c7,
+        0x97f39744, 0x11a5b9d8, 0x2065208c, 0x00005f60, 0xd28dd2d5, 0x165b26c9, 0x796a793f, 0x0000701a, 0x4af74a81, 0x875e5ca7, 0x7b027ba6, 0x00000b92,
+        0xe291e207, 0x3627b94a, 0xebcaebcf, 0x00006478, 0x50dc5023, 0xac5fe3bd, 0x07ab07ca, 0x0000863d, 0x372837c6, 0x5ab76db6, 0x5090506f, 0x0000e5f4,
+        0xf913f9bf, 0x6e7eaf89, 0x51945135, 0x0000f502, 0x4a654a62, 0x7fbacb22, 0xe78ce714, 0x00005d18, 0x1b0d1b11, 0x3f0b6625, 0x75e77532, 0x00004430,
+        0x26762626, 0x2efde5a5, 0xc52ac562, 0x000029ba, 0xec29ec20, 0x2e92570d, 0x9a6e9a0f, 0x0000854e, 0xc4c3c4fe, 0x6dc292c7, 0x7ec37eaf, 0x00008f11,
+        0x4a144aee, 0xcf7ac4fd, 0xadd7adb6, 0x00006030, 0x73d773be, 0x88a614bb, 0x75f475b5, 0x00000f65, 0xe47ae496, 0x0bb5d8c4, 0x5328534e, 0x0000a255,
+        0x405340ec, 0x0ca80ca1, 0x4d624d3d, 0x0000bfe5, 0xc538c529, 0x86bbbe09, 0x7ead7ec8, 0x00002766, 0x17fc17ab, 0xe662514f, 0x8331831e, 0x00005364,
+        0x7c527c78, 0xf7287166, 0x1a601a86, 0x00008ce3, 0xf29af2cb, 0x01fa6746, 0xe163e1bd, 0x0000dd45, 0x5046501e, 0xab7b6d39, 0xdfd3dfe1, 0x0000f804,
+        0x572d5786, 0x3f89ea32, 0xa9e1a9db, 0x00004071, 0x78d378e3, 0xfb8d1349, 0x992d99bb, 0x00005e68, 0x53385310, 0x8b395503, 0x3a423afb, 0x0000b00d,
+        0x00fb004e, 0x7a632e62, 0x65fd65a4, 0x00003c21, 0x15db1549, 0x1badd116, 0x45b44540, 0x0000eae2, 0xaa97aa2d, 0xc26945c4, 0xa15ca1f8, 0x0000cd94,
+        0xf2def2df, 0x3ea60cd9, 0x4f0c4f26, 0x000032cf, 0x022b0275, 0x2b7d7be0, 0x83eb83c0, 0x000010f9, 0xd8dad826, 0xbb7463fa, 0x90e79018, 0x0000086a,
+        0xff3fff8f, 0x1abc8172, 0x4aac4aae, 0x000079d1, 0x2db02d3c, 0x6922a098, 0xf452f4f7, 0x000013aa, 0xcebace27, 0xdbed7146, 0x07a707f5, 0x0000289a,
+        0x408040e6, 0xc10b885e, 0x7b1c7b84, 0x0000f3f0, 0x20002088, 0xf99bf604, 0x6e1c6e21, 0x0000b98e, 0xca63ca34, 0x6d6057cd, 0x701a70a8, 0x0000e584,
+        0x8be88b7e, 0x7685de57, 0xf376f356, 0x0000e84b, 0x31fe3193, 0x5d67d8e5, 0x04a30485, 0x0000af67, 0x2e6f2ef3, 0x0b343ab1, 0x9954994c, 0x00005add,
+        0x81d181dc, 0xf2dafd7c, 0xd9cdd9c2, 0x00006b7f, 0x13d21357, 0xd6efa87c, 0x2305235e, 0x0000d8b6, 0x611061e7, 0xc0d61f4f, 0x50725094, 0x00004a8f,
+        0x21eb216e, 0x5b685132, 0xd3d1d334, 0x0000abb8, 0xaa04aa21, 0x0b562bbf, 0x4d0a4d04, 0x0000db67, 0x1fbd1f1d, 0x0425cad8, 0xa915a922, 0x0000141a,
+        0x6b376bbc, 0x34cf9dea, 0xdf0ddfdb, 0x0000e85b, 0xd826d898, 0xafe51bef, 0xb080b023, 0x000039ed, 0xf4eef40d, 0xec52a0df, 0x2eae2ece, 0x00005379,
+        0xf8cbf82f, 0x7ce0b15b, 0xaeeeaeca, 0x000097eb, 0x06310678, 0x9ae79847, 0xa084a053, 0x0000ec15, 0x22cc2243, 0x0e8269c9, 0x26962669, 0x0000de87,
+        0xd48ed4c6, 0x6a8fde44, 0xbbedbb4e, 0x00006000, 0x862886db, 0xbd8b1f12, 0x644864e1, 0x0000b5b1, 0xb526b5b4, 0xba34d54f, 0xfd41fdb7, 0x0000f370,
+        0xdd6fddbc, 0x9216c07f, 0xdf87df20, 0x00004ee4, 0x89c989cc, 0x0044f873, 0x2aea2ab8, 0x0000408e, 0xf7cef747, 0xaa21b35b, 0xcf04cf1c, 0x0000ed07,
+        0x67e767dd, 0xde548720, 0x2bff2b52, 0x0000783c, 0x01d901cb, 0xb03cb024, 0x9f9f9fb3, 0x0000d562, 0xec3cec77, 0x7bddbd37, 0x82ae82bf, 0x0000a665,
+        0x98d898c0, 0x798a94bb, 0x3cb43c5f, 0x0000d51b, 0x22a82265, 0x53bf6dea, 0xdf1cdf89, 0x00005e29, 0x2db92d02, 0x69ea7751, 0x42784230, 0x00000183,
+        0x091b093e, 0xc2e5eae2, 0x22b822c4, 0x0000e4a4, 0x732273a2, 0x78f682cf, 0xbd98bd48, 0x0000f571, 0xcef7ce93, 0x2112b6e9, 0x19a319e9, 0x0000cf8d,
+        0x8efd8e19, 0x3e75a84c, 0xf392f329, 0x00001717, 0x85828552, 0x9afe1ed5, 0x031703d6, 0x000080c0, 0xd660d619, 0x20d01c1b, 0x8d688dd0, 0x0000a423,
+        0x622a62d9, 0x1d25d8a5, 0x5055509b, 0x00003e3d, 0x7aef7a95, 0x0686e03c, 0xa815a84d, 0x0000da18, 0xca38ca94, 0x670044a9, 0xaacaaa9c, 0x00002556,
+        0xaadfaa4c, 0xa09ebd49, 0xd6a5d697, 0x0000488f, 0xa0b0a0cc, 0x0c8b6eb1, 0x20af20c5, 0x0000962b, 0x8faf8f29, 0xb0584ad6, 0x5d455dde, 0x0000f2d3,
+        0x4e974e53, 0x0d14a0a2, 0xf1a6f19c, 0x0000b241, 0xf027f01d, 0x70746328, 0x0fe90f4d, 0x00002b02, 0x3e5d3e16, 0x70b53a4e, 0xf894f88f, 0x0000ad4a,
+        0x08630890, 0xcf34325d, 0x751d7506, 0x00008dd1, 0x870687d2, 0x4ca7c9d8, 0x8c948c53, 0x0000442e, 0x3fa93f16, 0xf69944c0, 0x8a1b8a9d, 0x00002775,
+        0x41504142, 0x3449fe85, 0xefbeef4a, 0x000022a9, 0xa825a8b2, 0x41c6e84c, 0x4f844fc0, 0x000031f1, 0x8a8e8a2b, 0xda5473a9, 0xb335b3bc, 0x00004104,
+        0x8dcd8d3f, 0xb7dc3c64, 0x003b0050, 0x000004cf, 0xbe07be94, 0xbe13f297, 0xf8c4f801, 0x00005a42, 0xef3cef8b, 0x092441c4, 0x744d74a5, 0x0000f11f,
+        0x362436bc, 0x5b70085e, 0x89018969, 0x0000ae85, 0x047004c8, 0xa383aee8, 0x4a6d4ade, 0x0000bb2e, 0xa551a587, 0x61efb7c5, 0x26cd2637, 0x0000b831,
+        0xca56caae, 0xab817749, 0x91819121, 0x00002fdd, 0x3ce43c6f, 0xcbbd3610, 0xd926d934, 0x00003a12, 0x24fc2434, 0x9b5cf055, 0xb006b0e3, 0x000076e3,
+        0xdd30dd82, 0x12f959dc, 0x98779899, 0x00001aac, 0xbf1abf8e, 0x69a3c33c, 0xcd1ecd18, 0x00001ee3, 0xceb3ceb8, 0xa2c370ed, 0x2c182c78, 0x0000affb,
+        0x2ae62a20, 0x275d0be8, 0x408e4004, 0x00000bf6, 0xabc1ab6a, 0xcb5b84e1, 0x79877993, 0x00007b21, 0xc5a2c57b, 0x5c92e9cd, 0x06690669, 0x00008e71,
+        0x7e287e4b, 0x8824e5dc, 0xa937a927, 0x0000c5be, 0xa798a701, 0x4ef61146, 0x8c798c2d, 0x0000b0f3, 0xbc49bc20, 0x9b1ed64f, 0x1201122f, 0x00002b7b,
+        0x96cd96fd, 0xd105abf4, 0x202f2085, 0x00007fcd, 0x72bb721f, 0xd9385672, 0x48eb4813, 0x00003f35, 0xfedffed8, 0xe85343bc, 0x657765a0, 0x0000898f,
+        0x42174276, 0xc4b4cfaa, 0x9b529b54, 0x0000c6f2, 0x9cd49cb9, 0xdc0c2d6b, 0xa77ea7a7, 0x000094a6, 0xe0d3e0c8, 0x262f79b6, 0x67686731, 0x0000fb4d,
+        0xcfcacfa0, 0x3efc26b4, 0x72277237, 0x0000c465, 0xf9cdf99a, 0xab1437a0, 0x03bc0387, 0x0000a141, 0x853c85f5, 0xde4ce5a5, 0x409c40c4, 0x00005539,
+        0x2cf32c3c, 0xf8182b79, 0x79817923, 0x00005b09, 0xa8c1a834, 0xa9f174ef, 0x644a64f7, 0x00001884, 0xbb4ebb4d, 0xaf59fa98, 0x7a097a4b, 0x0000bfc6,
+        0x1d7a1dc9, 0xe9581367, 0xa3c6a39c, 0x0000f513, 0x39b639a6, 0x52e735d1, 0xd4fed4ac, 0x0000e586, 0x8b8b8ba5, 0x186bd984, 0x10a8100d, 0x00005646,
+        0x20eb201c, 0x894793d0, 0x2efd2eb1, 0x00007f0f, 0x44ae4421, 0xad5fe369, 0x0240022d, 0x00008690, 0x14c0144a, 0xed0ebaf5, 0x2a012a2f, 0x000038fc,
+        0x6ac06ae6, 0x305b7d37, 0x32663229, 0x000063aa, 0x724972f0, 0x30cfc553, 0x1efc1e01, 0x00002556, 0x2abb2a45, 0x7e2881cf, 0x9d109dce, 0x00000362,
+        0xc82cc816, 0xbbe4a6ee, 0xc308c33e, 0x000006df, 0x25f725d9, 0x67f10ff3, 0xf24ef2d0, 0x00005e91, 0xa509a54a, 0xccf8e87d, 0x57dc5782, 0x0000acff,
+        0x8fa88fcb, 0x79f60692, 0x201120c5, 0x0000df56, 0xa0b3a0c8, 0x96497e7b, 0x2c332c01, 0x0000ea16, 0x333533ab, 0x6532325c, 0x5e6f5ea5, 0x00002bc2,
+        0xea1bea3f, 0x69220861, 0x3def3d99, 0x0000d03b, 0x98a298b7, 0x6221c18a, 0xe46fe444, 0x00008280, 0x18ee18da, 0x798e1a0d, 0x5abc5af7, 0x0000ca83,
+        0x703270a6, 0x0e0a3e4c, 0xbf74bf92, 0x0000404f, 0xa7c0a73b, 0xc65dcc2f, 0xe4ece442, 0x0000385a, 0x930d9370, 0x782adb5b, 0x58475857, 0x00008a61,
+        0xa45fa4b6, 0xcb4559d8, 0xec13eca4, 0x00001f2a, 0xaa29aad3, 0x54b269f4, 0x77357704, 0x0000f72d, 0xb51fb55b, 0x08f5bcc9, 0x49aa4900, 0x000036c7,
+        0x14391468, 0x78557b40, 0x87d58727, 0x00008961, 0xfee4fec3, 0xbcea74d2, 0x0fb50f86, 0x0000814d, 0x9dfe9dbb, 0x3a90a3e0, 0x4c614cf2, 0x00008def,
+        0xfb27fbc5, 0x44273bf0, 0xf7f4f750, 0x0000d5ca, 0x457e4525, 0xde432b32, 0x161d160d, 0x0000b3f2, 0xdde5dd8f, 0x7b4acfb3, 0xe767e732, 0x000014d6,
+        0x9e419eb2, 0xb77076a9, 0x12b5125e, 0x0000d30b, 0xda00daa1, 0x393c8d04, 0x3e673e28, 0x00009667, 0x600960fc, 0xb6f7b6e9, 0xcdd8cdd9, 0x0000902a,
+        0x671b6776, 0x401b3077, 0x5a635a22, 0x000063c9, 0xbedabee7, 0x3c9aa020, 0x9cca9c31, 0x000006ac, 0x3327339a, 0x0fcbc1fe, 0x7f2a7f26, 0x0000e289,
+        0x8169812a, 0xf3a0161e, 0x9dad9db1, 0x0000479d, 0x90e590ca, 0xaacc8a57, 0x9b079bae, 0x0000c795, 0xf531f54e, 0x95c79032, 0x6787670d, 0x0000bf5e,
+        0x465646f5, 0x0bcb21ee, 0x51ad517b, 0x0000849d, 0x89d789ec, 0x1655e9cd, 0x8e638e10, 0x0000aa36, 0x54745473, 0x78538c21, 0xa337a34d, 0x00000a1c,
+        0x7bf07b44, 0xf928ffb8, 0x60106059, 0x00009201, 0xb151b170, 0xafe604f4, 0x010301f1, 0x00008780, 0xb9e4b911, 0x5ce2fa31, 0x918b9155, 0x000070d0,
+        0xd46ad430, 0xf20b1d59, 0x22952241, 0x00002756, 0x02490283, 0x2d52ef93, 0x40d6400c, 0x00006d2b, 0x71107137, 0x38502aff, 0x25562504, 0x0000c2cf,
+        0x753d75d1, 0x1c48ef69, 0x8b3c8bd0, 0x000060af, 0x81e3817a, 0x862877d9, 0x70327048, 0x0000b3a8, 0x46d446a3, 0x764a40ec, 0x4c6e4c47, 0x0000ac3c,
+        0xe622e6a6, 0xce2a09b8, 0x5165512d, 0x0000867c, 0xf826f84a, 0x47ba8ecf, 0x5aa45adb, 0x00002da9, 0x209a2071, 0xac59a6d0, 0x46244653, 0x00004b9b,
+        0x6bb76be7, 0xb31bdce5, 0xadcbad87, 0x00008b61, 0x4ebe4eca, 0xb58adca5, 0xb3f7b30b, 0x00000048, 0x19231963, 0xf75a09d9, 0xceaaceb9, 0x0000e20d,
+        0x12111278, 0x1055b358, 0x24ac24cd, 0x00006a15, 0xba3abab0, 0x20d0a26e, 0x74dc74d1, 0x00003d73, 0x344a340b, 0xd34b5c67, 0xdcfedce4, 0x0000f993,
+        0xac28ace4, 0x45c7b8cb, 0xef6cef72, 0x000079ff, 0x098f09e7, 0x7f29c1ce, 0xaafdaa1b, 0x0000be11, 0x43c04336, 0x96c7a5d1, 0x49814981, 0x0000f963,
+        0x737b73f9, 0xd9c7759f, 0xdd6cdd88, 0x00009888, 0xb114b143, 0x4747bcb2, 0xddb1ddea, 0x0000e889, 0xe215e2bb, 0x782bcc2d, 0xe199e1df, 0x0000e8a4,
+        0xd331d381, 0x89a72c06, 0xbc48bcab, 0x00007c81, 0xa905a92e, 0xdd65557c, 0x14a514dd, 0x0000c064, 0xb56cb529, 0x4195e4de, 0x2ee12e89, 0x00006935,
+        0x234723a2, 0x09347c70, 0xece5ec83, 0x000083a2, 0x3e193eb6, 0x909e0aeb, 0x0f3f0f3a, 0x00007fdc, 0x70ee700e, 0xb154e0d2, 0xb740b795, 0x0000ff88,
+        0xd609d6d4, 0xdec9a4ac, 0x8d598dc3, 0x00004540, 0x39843947, 0xe37c2b44, 0x3c403ccd, 0x0000cb95, 0xa5eaa5f4, 0xeaec535a, 0xe546e5b6, 0x0000e8e8,
+        0xcb89cb1a, 0x522df1ac, 0xb11fb1cb, 0x00003439, 0x1ee61eb1, 0xd3c71dda, 0x491d491f, 0x00000ccf, 0x85aa8581, 0x7b62a443, 0x5f575fa6, 0x000053fa,
+        0x574d573c, 0xdf54f4c5, 0x06ff068b, 0x00008771, 0xd36ad3a1, 0xaabaf1cb, 0x1c681c7a, 0x00008a1b, 0x66d9669d, 0x4316f053, 0xdb8cdbe1, 0x000077a3,
+        0xd95cd911, 0x40c6da38, 0xbb17bb52, 0x0000f96f, 0x7f9c7f10, 0x5e2de7dc, 0x0d840d84, 0x00007ea3, 0xf639f67b, 0x2a60d348, 0x87728793, 0x00008261,
+        0x5a0a5a1e, 0x2b7e81ff, 0xa35ca39c, 0x0000ceab, 0x8ac48ae8, 0x416680f3, 0xb987b96e, 0x000039d0, 0x3dac3d6f, 0x831f2c14, 0x33a833eb, 0x00008bc8,
+        0xfcdbfc4c, 0xbf4b5eed, 0x367436cf, 0x00009ed1, 0x700b70a0, 0xe47c4e0a, 0x4e0e4e4e, 0x0000fecd, 0xc1cbc1c0, 0x22738f0f, 0x5d015d7b, 0x000064b5,
+        0x3fc23f08, 0x52390ad7, 0x8be18baf, 0x000089fa, 0x61a26102, 0x43586ebe, 0x034a03e5, 0x000086ff, 0xa2c6a2a9, 0x0d160048, 0xea0bea7f, 0x00003cb3,
+        0x383238f5, 0xf0280354, 0x7fd37f2c, 0x0000a299, 0x6a346a34, 0xc425e3fd, 0x2ff22f14, 0x000009f0, 0x90e59074, 0xbeb38fe0, 0x0b630b36, 0x00009585,
+        0x26bc26b6, 0x34cf639c, 0xd227d27d, 0x000049a9, 0x0d860d63, 0xe1dd57b4, 0x09b60992, 0x0000c782, 0x55d3559a, 0xbb45fffb, 0x5d3e5d2e, 0x0000c35e,
+        0x56e156d4, 0x2960a3db, 0x67c4671d, 0x00000a72, 0x1aeb1adc, 0xc05b78b7, 0xcb5ecbe8, 0x00007751, 0x638f6324, 0x13ee1a2c, 0x4ac84a90, 0x00006f8b,
+        0x78f3787c, 0x710931e3, 0x971597ab, 0x00000ce3, 0x11361178, 0xa5c251cd, 0x8ce48c01, 0x000067af, 0xd7bdd7f7, 0xbfeb7622, 0xf9aef919, 0x0000e5ad,
+        0x560256d6, 0x8bb86ab6, 0x2285223a, 0x00002b4b, 0x21ee2104, 0x39df93c4, 0x738b738f, 0x00003a92, 0x6e206e7a, 0x3145609c, 0x160c1682, 0x00005b54,
+        0xada3adf0, 0x626ff7ec, 0x254025e3, 0x000064b6, 0xf68df6f9, 0x0b245603, 0x19d71939, 0x0000ce10, 0xf8e4f8a7, 0x6ba0ea4f, 0xdab5daee, 0x000041bd,
+        0xe02de03d, 0x3850d6b7, 0x45d94522, 0x000068ec, 0x67c867b3, 0x7673f760, 0x251325f1, 0x0000d50b, 0x30dd3085, 0xd3db17f6, 0xf771f79f, 0x00002aa4,
+        0x8b6d8b01, 0xebd37eff, 0xdb43db1c, 0x00009615, 0x23e323b5, 0x99d8a11b, 0x3d793d64, 0x00002af9, 0xc0b9c08c, 0xc945269d, 0x7c437ca6, 0x00005489,
+        0x6eff6e15, 0x7900e9cc, 0xdf38df15, 0x0000f0b3, 0xfce6fce6, 0x217c8cc2, 0x167d168e, 0x0000d4d7, 0xb8d6b822, 0x9b4f6e34, 0x32613288, 0x00002fcb,
+        0x642b64cd, 0x2ff0a98a, 0xc16ac1de, 0x0000df1e, 0xf8b4f866, 0xbc45f256, 0xafdaaf23, 0x0000c907, 0x1eb51ebf, 0x1c8a7130, 0xde6ede3b, 0x00000dd3,
+        0x8feb8f2a, 0x226d8925, 0xe955e928, 0x0000751e, 0x13a813d0, 0xa44190f8, 0x56e75607, 0x0000ac3c, 0x9d149d1d, 0x081dbe0b, 0x503e50b7, 0x0000ad07,
+        0x24cc247b, 0xfb6f55c2, 0x9efc9e0e, 0x00008ab0, 0xc3e9c3f5, 0xd620d6cb, 0x246f2499, 0x0000581c, 0xa4e1a4f0, 0xe1c210ae, 0x5f645f2a, 0x00009ce0,
+        0x8f1a8f07, 0xbbdc8f40, 0xdf74dfaa, 0x0000ddeb, 0x0ef30e09, 0x91034031, 0x28662858, 0x0000253e, 0x7d737dab, 0x1a3d61a4, 0xa62ba614, 0x00000101,
+        0x3caf3c6f, 0x22cff2ab, 0xf64bf613, 0x0000d0da, 0x5a605a43, 0xa21d4a1f, 0x84d68423, 0x00008881, 0xd837d8f9, 0x8cf75a5c, 0xaa47aa1d, 0x0000c0b3,
+        0xf14af181, 0xae2e5eed, 0x31f63151, 0x0000d466, 0x65996586, 0x304d3628, 0x577957cf, 0x00001236, 0x72f172c3, 0xfccf52dc, 0x94b594c9, 0x0000a52a,
+        0x69a969c2, 0x44f6812f, 0xdea1deac, 0x00005cd7, 0xe79ee743, 0x175139f4, 0x1b0b1b2d, 0x00000fbc, 0xc084c055, 0x3b2927d4, 0x25632538, 0x00003d6c,
+        0xa7a5a798, 0x0665b4e7, 0x172b17ea, 0x0000ff02, 0x8ea28eb2, 0xd17b4fae, 0x003c007e, 0x00007370, 0xe530e5a4, 0x49a038d1, 0x0b290b7e, 0x00000064,
+        0x2c7a2c3a, 0xca673ace, 0x64406445, 0x00009271, 0x8898882d, 0xbce52602, 0x663d66a6, 0x000091f5, 0x4b1c4b35, 0x287d6d0b, 0x8447847e, 0x00007bdc,
+        0x58d95866, 0x8f64932d, 0x1aea1aa1, 0x0000e9ab, 0xbdcebdc5, 0xba376268, 0xe7abe74c, 0x000042b0, 0xa135a153, 0x0a5ead5d, 0x546754e7, 0x000036ab,
+        0x20a52072, 0x190f6d45, 0x1d621d24, 0x0000a998, 0x74317434, 0x4b09804f, 0x653e655c, 0x000069b6, 0xc935c908, 0x65ac6857, 0x210121c4, 0x000069f1,
+        0x56d85665, 0xd9597653, 0x1f611f5e, 0x0000448f, 0x6bda6b21, 0x2c30746f, 0xd2f0d2e0, 0x0000bfbb, 0x4be64be5, 0x3baf2d0e, 0x0e9e0e88, 0x00009fae,
+        0x27f127b5, 0xbd0105ce, 0xe36fe333, 0x0000a819, 0x92ff9228, 0xa0618918, 0xee38eeef, 0x00001a73, 0x55245519, 0xe5a3ff7b, 0x878d87e0, 0x00005e90,
+        0x6d8b6d93, 0x85a8b7d6, 0x05ff0515, 0x00007f02, 0x1c021c95, 0x2592f3ae, 0x2ac62a6a, 0x000086bc, 0x7d8f7d8c, 0x0cd626bf, 0x91bd9114, 0x0000e692,
+        0x35093580, 0xc4b67d00, 0x0619061e, 0x0000c6c5, 0x282728f0, 0x4106595c, 0x917b91f7, 0x00003f33, 0x369936db, 0xc7ebee81, 0x647b64d8, 0x00002d35,
+        0xcd35cdd8, 0x2f208bc3, 0xb9bcb935, 0x0000ae07, 0xbee9be78, 0xbecc2c79, 0x863786c2, 0x000095f5, 0xbd59bd45, 0x20bf15fe, 0x90ab9097, 0x00007d0f,
+        0x0e790eca, 0xa0fc5ca2, 0x3b673b2a, 0x00000cf8, 0x9dc99d0e, 0x2d432e8e, 0xb62bb6d0, 0x00000205, 0xd108d1d1, 0x40c6ddeb, 0xdb60db7a, 0x0000b1d4,
+        0xe420e4db, 0x1aa0c13c, 0xa77aa7d5, 0x0000259c, 0xf0dbf059, 0xb3e2baf6, 0x022a0272, 0x000038a1, 0xbe8ebe19, 0xe3a2f157, 0x84478423, 0x0000290a,
+        0x131213f3, 0x2059be54, 0x30b73085, 0x000090d5, 0x082f0882, 0x21e56808, 0x154815d0, 0x0000e424, 0x816181a7, 0x8dc483cf, 0x587b58c6, 0x0000c9c2,
+        0x510e5135, 0xdd049845, 0x1531158d, 0x000099d1, 0x540e546b, 0x845e02fe, 0xe17ee192, 0x0000c3f2, 0x182918ad, 0x189f96e7, 0x18671825, 0x00008d1e,
+        0xa0cfa094, 0xbd035f7c, 0xdb8ddbb7, 0x00004567, 0xe3d3e3de, 0x6b8f9e5a, 0xd28dd2cf, 0x0000e0f1, 0x825182c1, 0xb1a35e6c, 0x4a324a15, 0x000078fe,
+        0x35eb3553, 0x2b63e22d, 0x7ab07a83, 0x000092b4, 0x27352701, 0x265b5ba6, 0x1db21d22, 0x0000cecf, 0x73bc738e, 0x112e1932, 0xad41ad62, 0x0000fbfc,
+        0xc4d6c4b4, 0x8269be4d, 0x02d902fa, 0x0000020d, 0x34df3434, 0x73b42339, 0xd8add895, 0x00009ad1, 0xd25dd20f, 0xc99a8bbf, 0x31743163, 0x0000f31f,
+        0x3d303d88, 0xecaced49, 0x094a09b5, 0x000020b6, 0x9a269ab6, 0x7e51be4e, 0x268526df, 0x00006df4, 0x79117916, 0x4216fd0c, 0x396e3992, 0x000013e2,
+        0xc1ebc1fc, 0x82f72f9b, 0x463f4618, 0x0000bbf1, 0xc1abc1b0, 0xbf1dc6ae, 0x4a374ac0, 0x0000f073, 0xf4baf4f9, 0x8e98b2a0, 0x7fac7f2f, 0x000015c3,
+        0xba35ba57, 0x7add02f9, 0x65666587, 0x000034ab, 0x8a148a66, 0x05e0ac69, 0x6921694c, 0x0000db2b, 0x9bc29b5e, 0x40a5d64a, 0x711571a1, 0x00006898,
+        0x8a7b8aa5, 0x8846897a, 0x72b772fe, 0x0000befe, 0x3aef3a27, 0x7f59e8cc, 0x92ba9210, 0x00001a0c, 0x36a4363f, 0xd92d785d, 0x0d140d2c, 0x000097e0,
+        0xf33ef352, 0x79f8843e, 0x871987dd, 0x000017e6, 0xe9abe9d5, 0xdea432df, 0x677967d3, 0x00009b99, 0x6573652f, 0x1e05fa9d, 0x867f86d1, 0x0000c934,
+        0x66c66627, 0x42c529c4, 0xa914a948, 0x0000b7cd, 0x9e409ed6, 0x684084bc, 0x6faf6f0b, 0x000019e3, 0xa511a551, 0xe6c0a5f1, 0xf036f09f, 0x00000362,
+        0x92c79228, 0xe6efd27c, 0xc2efc24d, 0x00003a11, 0x6ea16e9e, 0xd104cd01, 0x6aa66a24, 0x00009e79, 0xd555d5a9, 0xf1ffc3c3, 0xce35cefe, 0x0000fb4c,
+        0xf524f5b4, 0x7b8d1f21, 0xe2efe242, 0x0000555b, 0x7c2d7c61, 0xe01e9fdd, 0xc769c7de, 0x0000c7f3, 0x78b778d9, 0x630c23d6, 0xbb2fbb87, 0x000044a0,
+        0xe9c4e9a5, 0x66f02e39, 0x3fef3fac, 0x00009ff3, 0x7d867d47, 0x1560ad41, 0x406140de, 0x000018ad, 0xcc62cc6e, 0x8dc601d7, 0xb58cb56e, 0x0000f873,
+        0xab97ab69, 0xa5832ecc, 0x00f500ad, 0x00008462, 0x6b9e6b57, 0x63218630, 0x3220324f, 0x00001e2a, 0x37aa37db, 0x2ec0f155, 0x0bed0b1e, 0x0000e345,
+        0xcce6cc55, 0xe2c742db, 0xf802f80b, 0x000064a7, 0x31d831bd, 0x1e1a3c73, 0x15461546, 0x0000688b, 0x87d587ed, 0xe34cc4f0, 0xe62fe626, 0x0000bdae,
+        0xb052b082, 0x092695f9, 0xb269b2a7, 0x00005339, 0x8efc8e80, 0x709abfb5, 0xa61ea6e1, 0x000005fc, 0x632063cf, 0xc735f525, 0x7ea47e9d, 0x000079d5,
+        0xa34ea359, 0xb9beedaf, 0xa459a48f, 0x00004625, 0x2ece2e49, 0x8025430d, 0xd2b9d2c4, 0x0000f882, 0x22192240, 0x0cb3e35d, 0xf0d7f08b, 0x000087de,
+        0xbe22be58, 0x7b092954, 0x62186224, 0x0000fe62, 0x4c864c59, 0x605e8d9d, 0xabecabcb, 0x00000aed, 0x11721108, 0xd55e0534, 0x269726f8, 0x000052e8,
+        0xea18ea51, 0x4babbd0b, 0x35083537, 0x0000c6d3, 0xee3cee3d, 0x1ef92bc0, 0x6ec36e97, 0x000029fc, 0x561056ab, 0x3519a06b, 0xa2bca25c, 0x0000f11f,
+        0x2ef02ebc, 0xb7cc14aa, 0x9e679eff, 0x00006ebc, 0xa62da6d9, 0x69f0cdd3, 0x3cc13c77, 0x00000064, 0x8c8c8ce3, 0xcf259631, 0x8b3a8bf6, 0x00001b7a,
+        0xa467a45c, 0x6c22a133, 0x97c69732, 0x000086c0, 0xfa36fa22, 0x40b90791, 0x2dae2df6, 0x0000be10, 0x1379134a, 0xd405636e, 0x660d6661, 0x00009116,
+        0xb951b996, 0xe01e3246, 0x2228225c, 0x000003a0, 0x1ef71e3c, 0x3a4023b7, 0x0d420d0d, 0x00008728, 0x239923dc, 0xcefb6403, 0x8b668b05, 0x00001c88,
+        0x0e270ebe, 0x39eff60c, 0xbe85bea0, 0x0000db53, 0xc3e2c3b3, 0x175353b1, 0x45b0450f, 0x00009a01, 0xca2cca9e, 0xbab344c7, 0x61b361b9, 0x0000b6b5,
+        0x4bea4b53, 0xf0f422bf, 0x5ad75a61, 0x0000f219, 0x7a8e7a61, 0x78cd3d80, 0x15191592, 0x000080ff, 0xd1abd1e6, 0xda389f27, 0xacc4ac8f, 0x00005e17,
+        0xff1bffe1, 0xb57f2d1e, 0x697069d8, 0x00008110, 0x1b391b6e, 0xafa00aa6, 0xa55fa544, 0x00006c8b, 0x4dae4dee, 0x376ca550, 0x67b767ea, 0x0000544b,
+        0x66da669e, 0xf63dadaa, 0xf6c5f6ef, 0x000092b9, 0x48164826, 0x543cb984, 0x32bf322b, 0x0000712e, 0x71ed71b6, 0x365bdde8, 0x55ee554f, 0x00000f83,
+        0x4ba14b4b, 0x361011c3, 0xfe4bfe14, 0x0000fa4c, 0x64cb6410, 0xdeb13fff, 0x3c4d3cf4, 0x0000baee, 0xf0aef0f1, 0x4788742f, 0x4ad04a81, 0x00008508,
+        0x43494368, 0x38ea27af, 0x5b0b5b57, 0x000062a5, 0x280a289d, 0x0ff92429, 0x5a4b5abc, 0x0000e4ca, 0x27f62770, 0xf73ec6c1, 0xd8cfd8d1, 0x00001717,
+        0x4aec4aa7, 0x91d637da, 0xc1b8c1be, 0x0000d626, 0x693169d2, 0x48794b9b, 0x394e390f, 0x00003869, 0x27af278b, 0x20d01199, 0x2867283a, 0x00002004,
+        0xd382d377, 0x691ce505, 0xecdeec12, 0x0000cdaa, 0xa612a62d, 0x7451824e, 0x4e1e4ed3, 0x0000738d, 0x845084f8, 0x6f7dae3f, 0xb281b22c, 0x0000f75c,
+        0x8a328a4d, 0xfe2f1686, 0x4a4c4ae9, 0x00001788, 0xd710d747, 0xf6e091d7, 0xa191a157, 0x0000603f, 0x08f70812, 0x5307bc4b, 0x6e1f6e78, 0x0000830e,
+        0xafd9af44, 0x62530e27, 0x012401d5, 0x00004fb6, 0xa1c7a178, 0x03e5f5dd, 0x33713370, 0x0000c060, 0xfed8feb8, 0xa46151b1, 0xbc8cbca3, 0x0000a564,
+        0xd9c3d9c1, 0x32f89ae8, 0xa663a629, 0x0000df78, 0x33d033bc, 0x3a358231, 0xd8d8d856, 0x0000c2b8, 0x6ea46e8b, 0x1075f26e, 0x1ec31e3b, 0x0000709a,
+        0xf331f3be, 0x2f638990, 0xbc64bcca, 0x0000f02d, 0x02010255, 0x282393b0, 0x594b59d6, 0x0000a9e2, 0x725872b9, 0x42c61d52, 0x98959812, 0x0000b9ba,
+        0x0d380d13, 0x59b7ea33, 0xc4afc4f8, 0x0000d666, 0xc0f9c07c, 0xdfe31ba8, 0x6e7a6ed8, 0x00006914, 0x6b1b6bac, 0xcbe7ab03, 0xfa05fa49, 0x00000c3b,
+        0x23402375, 0x24124e30, 0x1a121a3f, 0x0000b696, 0x40ca407e, 0x5d68ba35, 0x98aa98ce, 0x0000f696, 0x8f1c8f70, 0x06544046, 0x42674248, 0x00002056,
+        0x5791573e, 0xb5682e93, 0xeb5eeb5d, 0x0000c227, 0xd1f1d1a2, 0x0376c3ba, 0x364b3614, 0x00007770, 0x7de07de1, 0x0b565fdd, 0xeeb7eed5, 0x00003b4c,
+        0x7b637b95, 0x4b09105e, 0x0a940a28, 0x0000fa49, 0x122b12f6, 0xf8f7cbd8, 0x17481778, 0x00009197, 0x7a6a7a6c, 0x40676d5e, 0x0f990f66, 0x0000858d,
+        0x06bf0634, 0xf928afdd, 0xd2f8d2bb, 0x0000d8b7, 0x43d343f4, 0x3f0aecb7, 0x934793b5, 0x00008420, 0x5c355cde, 0x8657ff78, 0xe6f3e640, 0x0000fcec,
+        0xc4cfc470, 0x5db7143e, 0x4b764baa, 0x0000647e, 0x6651660e, 0x512c5e5c, 0x37813784, 0x0000f3b2, 0x732073ed, 0xc7353943, 0xe312e337, 0x000017d7,
+        0xc249c21c, 0x85f94129, 0xc17fc156, 0x000026ea, 0x33c7330b, 0x9e572974, 0x844a842f, 0x0000f763, 0xe58ae52d, 0xa879e5dc, 0xb381b3de, 0x0000f1d8,
+        0xcb75cb57, 0x6491c342, 0x4001409c, 0x0000ef17, 0xc378c346, 0x427805b4, 0x3932392e, 0x000098a7, 0xd0d6d074, 0x753e778e, 0x3db83d9d, 0x00005442,
+        0x4ebb4e98, 0xb3751cda, 0xb565b526, 0x0000c9aa, 0xff75ff22, 0x82375a5c, 0x760f7677, 0x0000c360, 0xb5fcb5d1, 0x711c86b3, 0x8c288c74, 0x000019ca,
+        0x78ea7850, 0x40ef325f, 0x751d757d, 0x0000737a, 0xeec2ee47, 0xba84bfc9, 0xbd1fbd45, 0x000079a3, 0xe539e50f, 0x47a7dfd4, 0xee46eec4, 0x0000d8b6,
+        0x8bb28b11, 0x829e3d01, 0xb875b824, 0x0000beef, 0x6afa6a16, 0xac23c8e3, 0xe20ee225, 0x0000380f, 0x0f270f8a, 0x08340e27, 0xb31fb35a, 0x00003fe4,
+        0x9a069aea, 0xc7f407d9, 0x0b5c0b04, 0x00002977, 0x88908831, 0x916852ed, 0xeaabea82, 0x0000e744, 0x714071be, 0x2c30c4dc, 0x96a19650, 0x0000272b,
+        0x1b201b62, 0x49057fb6, 0xa1e6a13b, 0x00009f71, 0xa9dea95b, 0xaeba7233, 0xa1bea164, 0x000089d8, 0x93cf9329, 0x362824d4, 0x6216629e, 0x00008a1a,
+        0x7b337b60, 0xa3613fce, 0x7f867f14, 0x00004e08, 0xef52ef9f, 0xc284d509, 0x6b216b03, 0x00009cc8, 0x9ec49e59, 0xccf0f92b, 0x5b915b6e, 0x000019a4,
+        0x45d54529, 0xb213ee7d, 0x3d253df9, 0x0000d8b7, 0xa9e6a945, 0xfe2f5080, 0xe863e871, 0x0000e689, 0x903a9056, 0x78b50ee6, 0x3fa93f7e, 0x00008dd0,
+        0x823d8244, 0xe57fdcd4, 0xb429b403, 0x0000c6b2, 0x0ef40eb3, 0xe59dc189, 0x7cfe7ceb, 0x00008c61, 0x18611860, 0x15f94e8f, 0x89f58936, 0x0000b813,
+        0xd503d563, 0x921c623b, 0x4c184c6a, 0x0000e0ad, 0x9a1e9a69, 0x9f880914, 0xb5c5b53a, 0x000048f4, 0xab70ab4b, 0xe1a38441, 0xc3dac3d8, 0x0000cb8f,
+        0xa2d6a201, 0x96f165fa, 0xe8f8e838, 0x0000ba05, 0xd8a1d8ca, 0x874e8c22, 0x925292e4, 0x0000da1b, 0xb110b1d2, 0x11322d1d, 0x096c097d, 0x000069f4,
+        0x9a059ac0, 0x5d68144a, 0x0f560ff7, 0x0000e745, 0x035403d9, 0x88a7c016, 0x048504a2, 0x0000d846, 0x523352f7, 0x7a8a988e, 0xe9cce927, 0x0000fae2,
+        0x69da6950, 0x9d5334ff, 0x07a707f5, 0x00001502, 0x4d684dd3, 0xd3b4a2e0, 0xf588f57d, 0x00007e0a, 0x88c788ee, 0x03635f13, 0x8d588d73, 0x0000aaaa,
+        0x4b0e4b4d, 0x522522f6, 0x072307e2, 0x0000be91, 0x7a527aee, 0x2520466f, 0xb26fb2a6, 0x00003b6e, 0xb8cbb83e, 0x1975280e, 0xd321d3bb, 0x000098da,
+        0x3def3d55, 0x3048f2e8, 0x7fd77fd2, 0x00007281, 0xf16ff1c5, 0xa083489c, 0x3a393afb, 0x00001d3c, 0x1ee11eb5, 0x286a37e4, 0x9647961b, 0x00001d88,
+        0x6cb26c68, 0x17944a16, 0x492d49a8, 0x0000b7cc, 0xb583b582, 0x9ebe2bbf, 0x5e715ec1, 0x000045c7, 0xd52cd52c, 0x238c3df2, 0x6c1e6cd2, 0x0000424f,
+        0xfe36fe7e, 0x02269254, 0xf1a5f1e5, 0x0000a1dd, 0xc8ecc8f4, 0xa3a1fa9d, 0x092e098a, 0x00002f26, 0x67eb674e, 0x0465a452, 0x68266816, 0x0000e27a,
+        0x5c3d5c10, 0x35e65dd2, 0x0f5a0f0b, 0x00007bae, 0xb55fb5d6, 0x37aa99d5, 0x61c861d3, 0x00007280, 0x7762776f, 0xdaf88630, 0xc3aec33e, 0x00007ca3,
+        0xa6f9a622, 0x8aa4a364, 0xa5a5a5a4, 0x00008e60, 0x43284359, 0x33cead3e, 0x51d351db, 0x0000c832, 0x66616646, 0xb3e371e6, 0x7d0e7d43, 0x00007efe,
+        0x92199220, 0xba4c31e0, 0xd3fdd3a7, 0x00008602, 0x95629521, 0x659b2a40, 0xb7a6b7d0, 0x0000c9aa, 0xc3d2c300, 0xca641ca5, 0x87b387e8, 0x0000ec86,
+        0xe2d3e2fe, 0xa0830139, 0x486348e7, 0x0000eb64, 0xeeebee94, 0xb7b5b901, 0x64d564ea, 0x00003a8c, 0xf444f47b, 0x7296b779, 0xebacebb9, 0x00006118,
+        0xf2d7f24f, 0x7e280ad6, 0x23f023cc, 0x0000f06b, 0x00c300f6, 0x9cbedae6, 0x17a51702, 0x00000039, 0x6eb56eed, 0x3f0ae423, 0x32683251, 0x0000a0e8,
+        0xa400a41a, 0x51edf1ac, 0x82138244, 0x00007553, 0xa57ca540, 0xd8dbd4f6, 0x59e859a1, 0x0000cf21, 0x2b672b4c, 0x97ab1e6a, 0x94e294d2, 0x000014d6,
+        0xdeb5de8f, 0x1dd7c5b6, 0x61f2610a, 0x0000163b, 0xd757d7cb, 0x87e8e8b3, 0x4a4d4ac7, 0x0000696d, 0xd818d892, 0x4a16d3d4, 0x046a0421, 0x00009215,
+        0x42db421d, 0xeb3178e1, 0xc210c2b8, 0x0000ae12, 0x2dd02d70, 0xdb5437a7, 0x9368935c, 0x00004335, 0xff35ffa3, 0x0de4a2e0, 0x82128255, 0x0000ea21,
+        0x3b613b64, 0x81b411fd, 0xddc4dd6a, 0x0000a5b4, 0xfc41fce6, 0xbca90b6f, 0xf97df9da, 0x0000b146, 0xdbefdb5d, 0x01d3bc49, 0x676067a6, 0x0000086b,
+        0xd745d70e, 0xac0d0b16, 0x5c705c84, 0x0000dae6, 0xfb02fbcc, 0x44c6b447, 0x96c69637, 0x000019a5, 0x97a99779, 0xc63a6848, 0xab1eab92, 0x0000c6f2,
+        0x7f0a7fa4, 0xdc089238, 0x20a32000, 0x0000ddc6, 0x78eb78e9, 0xe3dc55ae, 0x8c9c8cc1, 0x00006ff4, 0xb6d9b6d2, 0xd1fd2982, 0xb576b589, 0x0000c02c,
+        0x7fb37f68, 0x1d2ae423, 0x870987de, 0x0000edf6, 0x090c09fa, 0x2ae3d5f6, 0xe95ce971, 0x00006c8b, 0x4d8f4d4e, 0x062b8811, 0x91ba9109, 0x00002cdb,
+        0x37bd37f5, 0xf318d2db, 0x88b78804, 0x00004f43, 0xeb3ceba3, 0x1b93008e, 0xfec0fe0a, 0x00002df5, 0x71c47185, 0xf86e6c7d, 0x3eec3ead, 0x0000b0f2,
+        0xfe8efee6, 0xf2cff557, 0xdf31dfc6, 0x0000cd68, 0x1f111f7a, 0xd54c6064, 0xbc79bccb, 0x000077ee, 0x88188857, 0xec836848, 0xdd48dd13, 0x0000eb99,
+        0x7e317ea7, 0x50a8affc, 0x6d256df2, 0x00001c92, 0x26f726dd, 0x303756f2, 0xd811d846, 0x00003fb3, 0xf6d7f658, 0xfd26ead3, 0x0f6a0f4a, 0x00005d64,
+        0xf3d0f3f5, 0x591dbb13, 0x6f946f5c, 0x0000c5be, 0xdf9fdfa7, 0x2380653d, 0xb835b8bc, 0x00009086, 0x11a61159, 0xceba0206, 0x3faf3fa7, 0x0000dcfe,
+        0xb563b5cf, 0x10aff049, 0x70a97064, 0x0000da53, 0x08da083d, 0x6232d3da, 0x0acd0a9c, 0x0000e958, 0x3fdf3f67, 0x781a59cd, 0x12ab12d6, 0x000039a1,
+        0x403a40d3, 0x031a7da0, 0x7b2f7be1, 0x00003455, 0xb83ab8b9, 0x1915bdcb, 0x5be85bb2, 0x00006ce1, 0x6fd16f65, 0x640d5804, 0xdfccdf2e, 0x0000d62d,
+        0x688368d7, 0xa361bfc9, 0x668566f0, 0x0000be6f, 0xcfdccfed, 0xd14deba2, 0xf5e1f5f9, 0x00008fdd, 0x240b2401, 0x1b5540f3, 0x364f3615, 0x0000c46d,
+        0xf332f353, 0x62b120a4, 0xbb5dbbea, 0x00008a5d, 0xbb89bb5a, 0x41b95292, 0x7bc87b8f, 0x00003826, 0x4b294be5, 0x05c572d0, 0xf9cef9ca, 0x0000574b,
+        0x09ec0993, 0x5fae6b89, 0xd164d140, 0x00001bc5, 0x637c6325, 0x7c594c2b, 0x824b82b3, 0x0000197b, 0xa136a101, 0x48f6143f, 0x005700a5, 0x0000a6ae,
+        0xbbe8bb38, 0xc0859727, 0x249e24ad, 0x0000906b, 0x0eae0e58, 0xa4436d6c, 0x2bca2b6a, 0x000013dc, 0x229222f6, 0xf7aea01a, 0xdd33dd83, 0x00000392,
+        0x1f781fcf, 0xd6046bca, 0x518d5110, 0x00002366, 0x168716f6, 0x964c3bdf, 0xc22ac232, 0x000068d5, 0x15dc15aa, 0x7d5344c6, 0x71b47153, 0x00008a30,
+        0x02770286, 0x3baf0da5, 0x1d031d99, 0x0000968a, 0xa920a919, 0x6ea1170e, 0xb5bab5f5, 0x00003c32, 0x13791353, 0x199ef6d4, 0x01850136, 0x00008060,
+        0xa060a0de, 0x24594ae1, 0x3b4d3b49, 0x0000bd9c, 0x1ed91ee5, 0x2280b9c7, 0x543654b7, 0x0000694a, 0x73ea7327, 0x64909485, 0xba01ba82, 0x0000143d,
+        0x44f84424, 0xbacceaf2, 0x90af9087, 0x0000fe32, 0x4b694b92, 0xc625a5f2, 0x3ce03ce2, 0x00000c53, 0x98609837, 0xff8d8967, 0x9d279d4f, 0x00003824,
+        0x3a1b3a69, 0x7f52f563, 0x2bbf2b46, 0x00005706, 0xc931c95b, 0x0249335e, 0x594859fd, 0x0000e9bb, 0x1a3c1a1e, 0x3d35df64, 0x36ab3614, 0x0000bd9e,
+        0x69ec692a, 0x2aa33ff2, 0xa533a58d, 0x00001ea8, 0x679467d4, 0x834f0299, 0xdd35ddeb, 0x00008a50, 0x3aee3aef, 0x4a8503a1, 0x6a4a6aff, 0x00008b2f,
+        0xb429b486, 0x89962634, 0xe9c7e923, 0x0000bd9c, 0xa550a5d7, 0x1d4a7c6f, 0x4363433e, 0x0000e9a4, 0xd71ad70c, 0xfa496238, 0x4d454dcf, 0x0000fd33,
+        0x507b5016, 0xd93542ad, 0xbc02bca6, 0x0000962b, 0x1a061a41, 0x1076478d, 0x0d2f0dbf, 0x00000963, 0xcd76cded, 0x84a9b0a7, 0xbcbbbc46, 0x00000d62,
+        0x87d6871b, 0xa750d74a, 0xe300e329, 0x000051e8, 0xa94ca98a, 0x8859b70e, 0x2de52db8, 0x00000c43, 0x5db65d18, 0x40466a30, 0x70c2706b, 0x0000f5fd,
+        0x2b782bb4, 0x7470e522, 0x7d137d80, 0x0000035d, 0x074f0732, 0x7e02058e, 0xf411f4c9, 0x0000dd04, 0xc2edc237, 0xe7c13b09, 0xec44ec00, 0x00005e6f,
+        0xb48bb483, 0x6160f946, 0x62016269, 0x00009014, 0xa9bda953, 0x3ccfbcc9, 0xa48da43c, 0x0000a222, 0x3c0e3c7d, 0xc1a8e2ef, 0x128e1204, 0x00006b17,
+        0x992b99b3, 0x8b3ecb5c, 0x8c8b8c3c, 0x00001068, 0xac95acd6, 0x9d53f855, 0x9503956a, 0x00005484, 0x5fb15f50, 0x2c600ddd, 0x8f598f77, 0x00003341,
+        0x5e275e61, 0xfe4434e4, 0x566e569e, 0x00009853, 0x31be310c, 0xf61e468f, 0x0cf90ce3, 0x0000b0e4, 0xf672f656, 0xc8fa0ee5, 0x5e725eca, 0x0000eedb,
+        0x1b351b37, 0x98197efd, 0x2e4e2ee9, 0x000077b1, 0x1e8a1e67, 0xd9543080, 0xc944c9c4, 0x0000eaf6, 0x872d87f7, 0x5fdd1f21, 0xb2c6b212, 0x0000060c,
+        0x0dbb0d69, 0xc454004b, 0x561056f2, 0x00003206, 0x989b98b9, 0x42a68a19, 0x77ba7727, 0x000078bf, 0x0cf10c00, 0x481401fa, 0x02740208, 0x0000769a,
+        0x8cb88c30, 0xf5c2eb70, 0xa125a1ed, 0x0000e20d, 0x95f995c8, 0x46eeb0a5, 0xc2d2c26e, 0x0000b910, 0x13b9130c, 0x9a724ba7, 0x703270b9, 0x00007c7d,
+        0xe3d8e3ba, 0x948302c8, 0xa3fca325, 0x0000a9a7, 0x8383837a, 0x3a3cd85a, 0x2b0a2be3, 0x0000ca80, 0xbd8dbdc5, 0xa4fcaeb7, 0x378a3728, 0x00007523,
+        0x81328141, 0x1f55b5b9, 0x2e4e2e2d, 0x0000d5a5, 0x60b060ee, 0x58225f6c, 0xd2bbd2cd, 0x0000438f, 0x80528070, 0x8f6472af, 0xe738e770, 0x0000fc5c,
+        0x7bce7b40, 0x7798c6e1, 0x1e9f1e4e, 0x00004882, 0x73c07348, 0x946955cd, 0x6fdd6f03, 0x0000dddf, 0xd324d3c7, 0xbd7494ba, 0x598d59fd, 0x0000392d,
+        0x78377899, 0xd34fdcb9, 0x3c853c2d, 0x00003006, 0x055d05eb, 0xc30b6093, 0x6b8e6bcf, 0x0000c62d, 0xc5e6c50c, 0x8c64f8cc, 0x1dc41d82, 0x00009401,
+        0xd59fd584, 0xf53282cf, 0xa19ba13e, 0x0000741f, 0x4a864ad4, 0x4c5de081, 0x58ba58f5, 0x0000072c, 0x8e4d8e3f, 0x48867baf, 0x8672869e, 0x0000e292,
+        0x515a5179, 0xa9d18fc1, 0xfda9fd97, 0x0000b601, 0xfb2bfb58, 0xca241831, 0xad35adfb, 0x0000eb64, 0xcf14cfa7, 0x199d8ade, 0x91fa9162, 0x000032b4,
+        0x0b5f0bef, 0x9729c923, 0x56cc568e, 0x0000b77e, 0x1f381f0e, 0xd24f4fab, 0x867286e7, 0x0000a518, 0xab3fab4b, 0xf4aed866, 0x289a28de, 0x0000b2f2,
+        0x96f6966f, 0xf5cb7256, 0x5f2f5f01, 0x000025ff, 0x2983295d, 0xa160bbe9, 0x7935794f, 0x0000bcee, 0xa4fca426, 0xe3ddd3c4, 0x35223565, 0x00005daa,
+        0x881388f5, 0x69a31fda, 0x5f715f2b, 0x00005646, 0x53e153bf, 0x744add91, 0xd4f7d418, 0x0000dc67, 0x961496d5, 0x20533bb8, 0x7d5b7dc7, 0x0000ca05,
+        0x21ea2157, 0x6b82b1d8, 0xd8c6d82f, 0x00005739, 0x7152719e, 0x6a1c4bae, 0xd221d200, 0x0000e0e2, 0x828182ff, 0x86b6e1d4, 0x3d203d9a, 0x0000db6d,
+        0x286b2858, 0x8e98accd, 0x52ff52f8, 0x0000af65, 0x96a4960f, 0xb9c08a7e, 0xc0cbc063, 0x00009e46, 0xb722b765, 0x74e3222b, 0xa7fca70c, 0x0000081c,
+        0xedeced3d, 0xa3402cec, 0x22d6225a, 0x000086bc, 0xfa0dfa9b, 0x1f4a0c3e, 0x70b470bc, 0x0000a155, 0xb592b5cb, 0x4f3859a2, 0x251225f8, 0x00005484,
+        0x5f035f5a, 0x9c0694c5, 0x5deb5ddf, 0x0000cbaf, 0xceaece5c, 0x2ff31f66, 0xe031e026, 0x0000a1b1, 0xa0bca021, 0x972307f7, 0xa2cca22f, 0x000044f0,
+        0x6c366c17, 0xbc8ba38d, 0xa61aa684, 0x0000e2ad, 0x9c729c9e, 0x7585bff8, 0x05830519, 0x00004178, 0xe119e1f2, 0x68bf1e9e, 0x90459042, 0x0000e52d,
+        0x398f391a, 0xea300ee6, 0x0b090b9f, 0x00007861, 0x54a354ca, 0xfa9b8fde, 0xdd70dd57, 0x00003735, 0x83ed838e, 0xae51a1db, 0xca3fca83, 0x00003d11,
+        0xffa3ff09, 0xd34f937e, 0xf283f2ac, 0x0000a3f7, 0xdad9da8f, 0xc9fb72d2, 0xaea2ae29, 0x000075d0, 0xfb44fbd8, 0x45b91a0d, 0xeadaeae5, 0x0000b222,
+        0x6e5c6e71, 0x369a6234, 0x22d92248, 0x00004904, 0xb73fb707, 0xe1411772, 0x36373686, 0x0000feda, 0x12eb121e, 0x1a2f7a64, 0xd0aed094, 0x0000d910,
+        0x9b1c9b44, 0xe3d7514d, 0x30be3029, 0x00008771, 0xbb72bb90, 0x8f655ee3, 0xc775c78b, 0x0000e4a4, 0xb894b866, 0xb72a89a5, 0x105910b3, 0x000098c0,
+        0xed1eed4a, 0xed039b33, 0x7a547a2b, 0x000016f2, 0x848f8486, 0xc00bbf87, 0x2a132acc, 0x00009fe0, 0xc83cc833, 0x98addca5, 0x27f12718, 0x00008850,
+        0x5a135a26, 0xe7684b60, 0x73fa732e, 0x0000167e, 0x4c294c42, 0xf2282ff8, 0xa13aa156, 0x00001e29, 0x22c222fd, 0xc5d907b4, 0x78d27838, 0x0000cf8d,
+        0x83eb832d, 0x2a9c153f, 0xa611a665, 0x000092d4, 0xff0fff75, 0x45a692e7, 0xc29ec2a9, 0x00004c6a, 0x0e360e7b, 0x41e90449, 0x0102012f, 0x0000dbea,
+        0x619f6105, 0xe1b848b6, 0xdc3fdc4c, 0x00005d18, 0x905390ba, 0x482619af, 0x454d45f7, 0x0000d487, 0x594759df, 0x8ee5eeb6, 0x47584763, 0x00006679,
+        0x49f6498d, 0xb04f0be8, 0x0a0f0abc, 0x00002bc2, 0x3cc33c5d, 0xe57d2755, 0xdd3bdd96, 0x0000b02c, 0x46fb46db, 0xd3f3bd8f, 0xc278c22a, 0x00004611,
+        0x61916151, 0xca97e8b0, 0x713e71c0, 0x0000e335, 0xd03ed0d8, 0xecff6bcb, 0x2d892d3a, 0x0000c05f, 0x9efe9e30, 0xb98539e9, 0x8a258ac7, 0x0000f073,
+        0x2a382a94, 0xd04fb4a7, 0xad5bada8, 0x0000e0d2, 0x34df348b, 0xb9b09edd, 0x65d66582, 0x0000e73c, 0xc014c037, 0xc6e313ec, 0x76297643, 0x0000ade9,
+        0xce5bce3a, 0xe062eed3, 0x75127520, 0x00001e4c, 0xc3cbc3d9, 0x7530c7b6, 0xbdd6bdd5, 0x0000c54d, 0xd80ed841, 0x38b91c67, 0x3bfb3b4a, 0x00005be8,
+        0x1412148a, 0x7ce167a4, 0xf75cf7f4, 0x000051ab, 0x1a2d1aba, 0xcceccd2c, 0xd1eed120, 0x00005a1d, 0xc8d6c869, 0xbbd0b58e, 0xc42ac4a3, 0x0000f4c1,
+        0x3753371d, 0xe4017016, 0xbbdfbba8, 0x0000dd2a, 0x4c0b4c77, 0x11503eb9, 0x98599871, 0x00004011, 0xb910b921, 0xb76cc074, 0x5b065b27, 0x00009a8a,
+        0x9a3b9a29, 0xa07c20eb, 0x7a397abf, 0x0000f573, 0xf9f6f9fa, 0x3797cd53, 0xe61ee6f4, 0x0000f73e, 0x3bc13b09, 0xd5a4454d, 0x5d885d85, 0x0000e61a,
+        0x7bf37b5e, 0x09349f61, 0x9b549bcd, 0x0000d33f, 0xd841d825, 0x46295064, 0x3b103b05, 0x00008ffa, 0x7de77de0, 0x9ccf4cad, 0xd448d419, 0x0000962a,
+        0xa135a189, 0x296dae35, 0x650c6562, 0x00009a6e, 0x18ee189c, 0x4ef6f297, 0x02e6024f, 0x000034ab, 0x027402aa, 0xbac2d11d, 0xc95dc9fe, 0x00003c82,
+        0xd023d004, 0xadb14438, 0xa269a2dd, 0x00003b4c, 0x47724792, 0xe2209644, 0x67436702, 0x0000b700, 0xd660d6b9, 0xa38378e2, 0x7ea97e48, 0x000025b8,
+        0xfd41fdeb, 0x4ff6f59d, 0xb882b8af, 0x0000f4d8, 0x777a77f9, 0x512196be, 0xb62ab6d7, 0x0000a719, 0xe563e558, 0x1cf13e80, 0x3d6b3d71, 0x0000212c,
+        0x47dd4785, 0x1c4ee3e2, 0x60ca607c, 0x0000223e, 0x191f1919, 0x0d1664da, 0x203520fb, 0x00005ab5, 0x42f7428b, 0xfa985c26, 0x252d2531, 0x0000f06e,
+        0x5e495ec6, 0x4a3a6d90, 0x387c386c, 0x00007d43, 0xd13fd14f, 0x4c74b680, 0x932e938f, 0x0000a9fa, 0x395139c1, 0x3c19984c, 0xf3acf30b, 0x0000488f,
+        0x543c548f, 0x0ae91852, 0x27ad2792, 0x0000cf6d, 0xb8bbb865, 0x287d5ba1, 0x2d392d6f, 0x000092d4, 0x40e74024, 0x939c575d, 0xdb60db8f, 0x00000cc0,
+        0x17ae179a, 0xb98fcece, 0x85798543, 0x0000cb6b, 0xb931b996, 0x594d8a2e, 0x963096be, 0x0000ea14, 0x5a035a5b, 0xe3d7349f, 0x687e6832, 0x00002056,
+        0x2ef62e6b, 0xc75da077, 0x674c677b, 0x0000d23b, 0x4fc94f39, 0xcd5b24e9, 0xe01ee0f0, 0x0000100c, 0xd96bd910, 0x99575123, 0x342234a0, 0x00005b54,
+        0x415e4145, 0x3d2810b5, 0xb0c4b0dc, 0x0000ac7f, 0xc12ac1a4, 0x2e228ee1, 0x70e670d7, 0x00005f41, 0x61e56182, 0x5b87c3c3, 0xc006c02a, 0x0000ea29,
+        0xe4e7e487, 0x3d9a9778, 0x6db06d25, 0x0000695c, 0xcd72cdd5, 0xf949a72f, 0x0543058c, 0x0000ebc2, 0xb255b238, 0xc65b680d, 0x854b85b3, 0x0000b13a,
+        0x166f16fb, 0xb504b5f8, 0x786c78f1, 0x00009ac1, 0x6ac26aed, 0x6112d8d9, 0xf9f7f951, 0x0000adba, 0xfae5fa41, 0x81267b12, 0x781478c9, 0x00008342,
+        0xcb20cba5, 0xd6ffbc38, 0xf871f8c1, 0x000038e6, 0xff79ff85, 0x192111c3, 0xbe86bedc, 0x0000a5b5, 0x3ac73abe, 0xbf031ee1, 0xe0d8e094, 0x00005896,
+        0xdfe9df98, 0x493965b6, 0x985598f0, 0x0000703b, 0x31c13128, 0x2192511d, 0x1bc21bec, 0x0000b9b1, 0xeea7eebc, 0x71122d27, 0xd9d0d989, 0x0000ce82,
+        0xdec1de7b, 0x3c02cb31, 0xbaf8ba1f, 0x0000a46e, 0xdd36ddb8, 0xf9492ee6, 0xea87ea93, 0x000082fe, 0x29d829fa, 0x3aba4ecb, 0xc0c7c02b, 0x00002589,
+        0xb20cb288, 0xfcceda02, 0x1678166f, 0x00006ec8, 0x282a2806, 0x78cd1202, 0x1da51dea, 0x00008eef, 0xd6a0d6d7, 0xe59d6ab4, 0x31f43151, 0x00000053,
+        0xc336c3ab, 0xeca3c235, 0x50225097, 0x0000fcbe, 0x3014303b, 0x393c0fa0, 0x6786670d, 0x0000905d, 0x71f67152, 0xd71ba5a9, 0x0ede0ef6, 0x00000500,
+        0xac79acd5, 0xb69932ff, 0x99259983, 0x000030b6, 0xb056b027, 0xc1f85d2b, 0xca30ca08, 0x0000ae1e, 0xc6b5c624, 0xb48ee5a5, 0x772d77e9, 0x00006ede,
+        0xee95eea6, 0xfa88d2d4, 0x0e530ee7, 0x00004524, 0xefd3ef40, 0x4f9084de, 0xa555a54c, 0x0000684a, 0xef47ef5b, 0x28120995, 0xfaa8fa9e, 0x0000ba31,
+        0xb9d9b967, 0x905cbe26, 0xd29cd20f, 0x00005124, 0xb3c6b373, 0xb801e26b, 0xd5cbd58e, 0x0000751f, 0xf0ebf013, 0x60cf29bf, 0xbd03bd69, 0x0000b96f,
+        0x13bf1327, 0x63df88ec, 0x2270227c, 0x00007a0f, 0x90149059, 0x6f90f5d7, 0x94a99479, 0x0000f3b3, 0x6e296e99, 0x09d88ac4, 0x551255a8, 0x0000e9e7,
+        0x4da74dd7, 0x480bce2d, 0xf137f188, 0x00000a55, 0x991f99a0, 0x4905d2ca, 0xdcb8dc85, 0x00000f8d, 0x22ab2281, 0xbb322160, 0xc8e7c811, 0x00001549,
+        0x3486344e, 0x3d355292, 0xd807d82e, 0x000094a7, 0xf97af947, 0x7c96a313, 0xcbdbcb0c, 0x0000d8bb, 0x4bcf4bdb, 0x628239a0, 0x74b57446, 0x00007697,
+        0x26c2262c, 0x199ebcf8, 0x506e503d, 0x0000f373, 0xa6f3a652, 0x6cc2982a, 0x6e7a6e9b, 0x00007660, 0x582858ba, 0xe131cfb3, 0x5ca05c1c, 0x00003933,
+        0xdba9dbe5, 0xb05372ab, 0xe86ce813, 0x00007b9c, 0x9495947b, 0xc75517c1, 0x15b4157a, 0x0000d6a6, 0xac97ac53, 0x9416fcf7, 0x956795dd, 0x000027eb,
+        0xe911e99f, 0x1155a11b, 0x0b400bdd, 0x0000e7c3, 0x18fd18a2, 0x53bdfd46, 0xb7d9b747, 0x0000a251, 0xcf63cfca, 0xb5b4842e, 0x93d7931e, 0x00007270,
+        0x449444cb, 0xa2c2a3ea, 0x77417757, 0x0000897b, 0x2702276c, 0x3e721373, 0x5e785e06, 0x0000805f, 0xffd9ffdf, 0xb87fc3d3, 0xbdccbd65, 0x0000479f,
+        0x25ab2597, 0x764a61d5, 0x0f6f0f35, 0x00009f0f, 0x910391a6, 0xa36131a7, 0x1b241bda, 0x0000389f, 0xcb7ccb10, 0xa733153e, 0x14b914ba, 0x0000d1e7,
+        0x5bd55b5c, 0x02a501b7, 0x6c046c48, 0x000012bf, 0x19d219a0, 0x3a7d83bf, 0xcbeacbf0, 0x00006c19, 0x8bd78b6d, 0x82372126, 0xcf1bcf91, 0x00000272,
+        0x7d987da5, 0xdc040536, 0x64f5640a, 0x00001fac, 0xc357c3ff, 0x3260bcca, 0x5e3c5ed6, 0x000078fe, 0x818a8178, 0x4f094c29, 0xe1dee1ec, 0x00002b3e,
+        0x59485935, 0x22f3ee80, 0x33a033d9, 0x0000175e, 0xa766a70a, 0x109c4f54, 0x454945bd, 0x000060e1, 0xaf92affe, 0xbb2d2bd9, 0xac4dac2a, 0x00000432,
+        0xee37eeb8, 0x59483724, 0xbdf0bd46, 0x000041d2, 0xc0fec08d, 0x5b66c5b8, 0x6c646c4e, 0x0000ef5f, 0x202520f0, 0xa0d088de, 0x85b28514, 0x00000b68,
+        0x31a031f1, 0xc96528f6, 0x32ab32e7, 0x0000f196, 0x2f6f2f74, 0x4ff61e31, 0x73a7731e, 0x0000dcbf, 0x76f47675, 0x9bc9120a, 0x1c111c49, 0x00005599,
+        0xe627e6aa, 0x1f3d4cd4, 0x5d045dbd, 0x0000c225, 0x57b7577a, 0xf1498493, 0xee0fee17, 0x000080dd, 0x5ab05a09, 0x9d524731, 0x4b854b5f, 0x00009890,
+        0x695e6990, 0x9a1f66a7, 0x6af16a36, 0x000071bf, 0xbf21bf59, 0xddd8b8c8, 0xbd01bd87, 0x00007666, 0xbd41bde4, 0xe022f69a, 0x9b6c9be0, 0x0000bdee,
+        0xec41ec6a, 0xe92c9f13, 0x4dc94de6, 0x000090c6, 0x3a263a95, 0x08ea6def, 0xa3a2a33b, 0x0000449d, 0x9d609d18, 0x6cdfb53f, 0x0aca0acb, 0x0000fe62,
+        0xc90dc99c, 0x62c3d749, 0xe543e52c, 0x00007031, 0xf061f03e, 0x5f2dd604, 0xda67dad6, 0x00000920, 0x4a8d4a2b, 0xd03b4924, 0xa44fa483, 0x00000863,
+        0x75557529, 0x21f3e5cc, 0x1487148e, 0x00005e1c, 0xd011d06e, 0x616511bc, 0x05d4059e, 0x00002756, 0x931f931c, 0xbf941bad, 0x34d3347e, 0x00001517,
+        0xc5d4c5ff, 0x543294c5, 0x2d4e2de9, 0x0000d274, 0x1f4a1f29, 0xa9fd69f4, 0x0c290c0d, 0x00006f2a, 0x49ae492a, 0xaef1ea0a, 0x235d23a3, 0x0000a6b4,
+        0x16cf16d7, 0xba5bd1b6, 0x268d2615, 0x0000ec15, 0x880388d2, 0x7af6f9e5, 0x6f9b6f72, 0x0000eafd, 0x593759d5, 0x1fda0ad7, 0x5cf25c04, 0x0000b8ac,
+        0xb53ab5df, 0x744794fa, 0xca50ca32, 0x000045ba, 0xc03bc01d, 0xd0c80de7, 0x5b425b04, 0x0000838a, 0xfc9efc17, 0x6e61d51d, 0xd369d36b, 0x0000aba7,
+        0xa092a0a7, 0x0663c871, 0x05f9058b, 0x00002bc2, 0xe45ce4cb, 0x4eb56ec5, 0x845f84e6, 0x0000a38b, 0x94fb947f, 0xfccf44ae, 0x597659c3, 0x000017f2,
+        0x012b015a, 0xdc766bf4, 0x377a3767, 0x000013e3, 0xd400d434, 0x840853f2, 0x4bdf4bd3, 0x00005a29, 0xb32ab3d2, 0xc7e17e41, 0xdd48dde3, 0x0000ebb7,
+        0xea0bea18, 0xa3fcee02, 0x3bf43b4e, 0x0000aba5, 0x85298528, 0xc7168631, 0x1632162d, 0x00000dd8, 0xade1ad76, 0x05e6b6ef, 0xbfbabf45, 0x00003912,
+        0xe104e1d6, 0x060d7369, 0x85f685c3, 0x00009b1f, 0x470147df, 0x5765b03f, 0x8ade8a81, 0x0000e289, 0xfbe0fbb3, 0xdfe10ee5, 0x2b102b2a, 0x00001436,
+        0xd5acd573, 0x25597f3c, 0xcf17cf3e, 0x0000756c, 0x48bb4890, 0xb7cc86cf, 0x580a5850, 0x00006aa7, 0xd13cd138, 0x81242f9b, 0xb013b08c, 0x00003794,
+        0xb581b576, 0xe6620da7, 0x167516d9, 0x0000e427, 0x4dd84d7e, 0xa181f524, 0xa559a572, 0x00003e4c, 0xfbadfb96, 0x4578bcb9, 0x0b610b3e, 0x0000d38a,
+        0x412941b9, 0x5a685f12, 0x1ec41e8b, 0x0000e145, 0xb5a8b522, 0xa15f1784, 0xeaceea1b, 0x00003695, 0x9a3d9a2f, 0x99f71286, 0x4e764ed7, 0x000034df,
+        0x0b360b1c, 0xc2ca7fc1, 0x272227ea, 0x00003a9f, 0x9ae49a1a, 0xb13e7564, 0xfdd5fda4, 0x00001ed3, 0x7ca77c88, 0x1a4238f2, 0xc648c654, 0x0000460f,
+        0x03da03dc, 0x782add15, 0xc45cc4ed, 0x0000cab0, 0xb875b8dd, 0x0fd72f45, 0x657e65b4, 0x0000039e, 0x303b3085, 0xb6989ce1, 0xc23dc2ec, 0x0000f047,
+        0xd9d1d98f, 0xe59fae98, 0xb7a9b7a1, 0x0000b097, 0x1c101cfb, 0x1e151447, 0x17af17e8, 0x0000c8d4, 0x35663558, 0xfc2d6d1c, 0x11981126, 0x0000dfcc,
+        0x745174bd, 0xf24906c7, 0x81db8129, 0x0000bd10, 0x6d3b6df7, 0xd7148f20, 0x485f48b1, 0x00003482, 0x66466679, 0xc4557d84, 0x557355cf, 0x0000a385,
+        0x425142c3, 0x983b2e9e, 0x436f4392, 0x0000c532, 0xc467c4b3, 0x0bcb8790, 0x49a24914, 0x0000fabe, 0x0a420a2a, 0xd8db219c, 0x618761dc, 0x000035d4,
+        0x9adc9a97, 0xfe6f0859, 0xe16de1b4, 0x00002986, 0xefdaef7e, 0x832401ca, 0x934a9336, 0x0000e550, 0x44304422, 0xe958fd43, 0x2f072ff6, 0x0000dc52,
+        0x80a18079, 0x9772dedb, 0x47f547e2, 0x0000d1b1, 0x37c8377a, 0x5bf899ac, 0x1f2e1f93, 0x0000e489, 0x06940691, 0x4909a165, 0x7135710e, 0x00008ad8,
+        0xa4e1a4f3, 0xf0601f6f, 0x81d5816a, 0x00005f75, 0x88e7888e, 0xd8044790, 0x89a18983, 0x0000a385, 0xefdcefe5, 0x95f34c54, 0x4d544dc2, 0x00005056,
+        0xd2f8d262, 0x4e25e972, 0x88b28807, 0x00002b3e, 0x07bc0702, 0x0e7eca2e, 0xdb0bdb68, 0x0000f579, 0xe934e929, 0xc408e7df, 0x625662bd, 0x0000488f,
+        0xa130a126, 0x8637fffc, 0xbda8bd42, 0x00008020, 0xef2def30, 0x71905dd1, 0x2b4f2bf2, 0x0000ec16, 0x9ec09e96, 0x5141e646, 0x8caa8c5d, 0x0000cce7,
+        0xab36ab26, 0x5f177131, 0x714171df, 0x00001c88, 0xb183b1d0, 0xd04dac41, 0x5d405d04, 0x00009824, 0xc7dcc72c, 0xfed38a61, 0x60a360e4, 0x000012d6,
+        0xeeffee7d, 0x22f3aaf3, 0x9f439fd8, 0x00001298, 0x309c30da, 0xb7dd78d0, 0xa500a5bc, 0x00007553, 0x30983071, 0x33f6de50, 0xf3c6f38f, 0x0000a95a,
+        0x2308234a, 0x20b86f34, 0x75de759f, 0x0000810f, 0xabd5abf1, 0xef214a0d, 0xad4bad92, 0x0000cdce, 0x8e9a8e88, 0xab14d57c, 0x801d8064, 0x0000dee1,
+        0x818f81a0, 0xe1fc1e65, 0xc9b4c9f8, 0x0000b811, 0x5a805a6e, 0x1c3a2806, 0x0453040a, 0x00007691, 0xfe5bfe21, 0x8157feac, 0x456f451e, 0x0000863d,
+        0x6f346fea, 0x5bf9ff46, 0x78a97851, 0x00002c75, 0x434443c6, 0x012c82cf, 0x33ce33c8, 0x00006f8b, 0x1db51dc6, 0xb3e23ed1, 0xa7b2a70d, 0x0000bf27,
+        0x30c130f6, 0xe4bdc6c3, 0x2e3d2e72, 0x0000d587, 0x391d3930, 0xf08873d6, 0x4eb74ee5, 0x000089c8, 0x5c2f5c2a, 0x3ddf49e4, 0x483348d2, 0x0000d757,
+        0x4baf4b9d, 0xf0c20ed9, 0x8261826d, 0x0000c186, 0xacc3acad, 0xddf80429, 0x982a98fa, 0x0000dcde, 0x1fc11f24, 0x1f4d23d7, 0xb0f1b046, 0x0000243e,
+        0xf3d9f359, 0x5f6b9740, 0xfb60fb9d, 0x0000864f, 0x0b490b32, 0xbbd180be, 0xe744e708, 0x00005a2b, 0x16af16ab, 0x6e40dffb, 0x850485b9, 0x00009cc8,
+        0xdff8df5c, 0x66f09338, 0x11ff1141, 0x0000650f, 0xf4bff4fa, 0x35196dba, 0x8225821e, 0x0000338c, 0x760b7626, 0x38502df9, 0x557355cd, 0x00005dfd,
+        0x7a2c7ab2, 0x4fd60141, 0x281a2822, 0x000036ab, 0xcdf2cd1c, 0x4b0b950c, 0xfc5afcfd, 0x0000977e, 0xdb77dbc7, 0xa534851e, 0x2e5e2e59, 0x0000e17a,
+        0xd6a5d68d, 0x3518e873, 0x9d849d97, 0x0000b4a0, 0x916091ec, 0x78cdb94e, 0xe6f2e645, 0x00007dbf, 0x107d1059, 0x09cb9ce1, 0xcc65cc93, 0x0000b250,
+        0xb614b6d7, 0xd024af8a, 0x611061b9, 0x0000bbd1, 0x9fd69fba, 0xaa79aee0, 0xbdc0bd85, 0x000061f7, 0x9fe19f77, 0x7fc901b4, 0xebebeba6, 0x000058b4,
+        0x23962332, 0x7299e558, 0x8e588ede, 0x000076c2, 0xa93ca9c3, 0x5db098af, 0xf58cf581, 0x0000f84d, 0x293f299c, 0x089cc0c3, 0x1a211aa4, 0x00003233,
+        0x13091381, 0xd48f615b, 0x497d49df, 0x0000ec94, 0x2f832fe0, 0xc8c55d3f, 0xd61ed6d0, 0x00007745, 0xaf2eaf41, 0x8c67f056, 0x636e633d, 0x00001688,
+        0x1cd91c5d, 0x4195aafe, 0x407240b8, 0x00003879, 0x75b37581, 0x9371b3cb, 0x9bc39b34, 0x00003fb3, 0x53455384, 0x50e61786, 0xb727b7ed, 0x0000f699,
+        0x5ff75f54, 0xb58a724f, 0xa08ea051, 0x00002976, 0xc7ecc7fe, 0xda8b73f1, 0x3cb23c18, 0x00005108, 0xb1d5b1d5, 0x255a9740, 0xd54fd51c, 0x000060af,
+        0x333e3353, 0x6d7eb0a7, 0xa19ca105, 0x0000f90c, 0x574357b6, 0x791af760, 0x0b6a0b2c, 0x00005ff5, 0x9f5c9fe2, 0x59cace51, 0xd2dad2d7, 0x0000bb8e,
+        0x6bdc6b6a, 0x67782ebf, 0xbfb8bf38, 0x0000c90b, 0xf21af2ac, 0xa20d0ad4, 0xc451c46d, 0x000056a6, 0xa22ca253, 0xa9fdf42c, 0x5b445b57, 0x00001fe3,
+        0x1e8b1ebc, 0x2572f3dd, 0xdccadcb5, 0x0000c065, 0x80ef807a, 0xf9185823, 0x548c5424, 0x00005565, 0x429d428d, 0xe4524956, 0xbdf7bd45, 0x0000f054,
+        0x3f553f88, 0xb36c5cbc, 0x067a06c1, 0x000025b6, 0x62b562c5, 0xaa33fb24, 0xcbe1cbc4, 0x000015c9, 0xe026e0fd, 0xfa6e01cb, 0xe90fe936, 0x0000f963,
+        0xb20bb208, 0x312048a0, 0x2263227e, 0x000091fe, 0x0ab70a59, 0xde549fae, 0x3ff33fa0, 0x0000fe9f, 0x48d04811, 0x16bf5eae, 0x4b4f4bb2, 0x000094e0,
+        0x1b141b47, 0xd4b090ca, 0x1ce11ce7, 0x00002bba, 0x256d25f0, 0xbfce26b0, 0xf919f9a9, 0x000039a3, 0xe8cae81e, 0x964a3e73, 0x7f357fc1, 0x0000bd8e,
+        0xd70ed740, 0xbf03317f, 0x9ea29edd, 0x00002c0a, 0xfa59fa62, 0x37d83123, 0x1a8f1a23, 0x0000d2a4, 0x815881b6, 0xdf0e3ca7, 0xe35ce34b, 0x0000c01e,
+        0xca20ca1e, 0xdb51a7d4, 0xedaced03, 0x0000916b, 0xa5a5a501, 0x9da914c0, 0x0da10d0b, 0x0000c59f, 0x435243e8, 0x0dedf91c, 0x772777b2, 0x0000b121,
+        0xe7a2e788, 0xf1dda567, 0xc594c5e7, 0x0000688b, 0xc4f6c4da, 0x1ebab7b9, 0xf708f7db, 0x0000d2fc, 0x57735764, 0x6840c04a, 0x937f930d, 0x00007dde,
+        0x3c613ca2, 0x33471bd0, 0x4a724abb, 0x0000f02d, 0x745d742d, 0x92671e65, 0xe4fae4b9, 0x0000ec89, 0xa584a584, 0xf24962de, 0xb318b358, 0x00006d96,
+        0xc7acc767, 0xd4047dc2, 0x6b586b6b, 0x000001fd, 0xa3b2a3c0, 0x291ef135, 0xe5bfe5c0, 0x0000f5f7, 0xaaa4aa79, 0x66106fca, 0x308f3035, 0x00003864,
+        0x592e5940, 0xfb9bc59b, 0x54a454b6, 0x0000a3b4, 0xd5cfd5fa, 0x40a6c86e, 0xbab5bac7, 0x0000f97e, 0xa56aa525, 0xac59bb44, 0x74f87425, 0x0000d96c,
+        0x554455dc, 0xc4cac247, 0x992099bc, 0x0000d71d, 0x5f435f1a, 0x44a5b15f, 0x673567d3, 0x0000f63e, 0x7e897ebb, 0xf4e824d2, 0xa864a8b7, 0x0000fe63,
+        0xd4e7d472, 0xc525d7c8, 0x42184255, 0x00003c59, 0x5f8c5f08, 0x0df514bc, 0x99619901, 0x0000fbba, 0xf027f00f, 0x3036dde3, 0xdc4edc96, 0x00004ff2,
+        0x4a2f4a5f, 0x729930a7, 0x5d4c5d89, 0x00005fb4, 0xfd0efd9f, 0x3b55f89d, 0x6c7e6cb6, 0x00008080, 0x270127e3, 0xb4660bd9, 0x05750579, 0x0000cb0b,
+        0x33443370, 0x9793df04, 0xeaa3ea41, 0x00004af3, 0xb6a2b6a5, 0x56a75ea1, 0x7607765b, 0x00004311, 0x7e2e7e62, 0x69229e67, 0x547b548d, 0x0000a0dd,
+        0x01370130, 0x4e56c651, 0x483348aa, 0x00003d92, 0xb9f6b952, 0x74a8722f, 0xc46bc462, 0x00006252, 0xca4eca2b, 0x1581a3da, 0x71437146, 0x00000200,
+        0xe3bee35c, 0xa16188ef, 0x56625683, 0x0000cd93, 0xaaefaa5a, 0xe8a36da9, 0x9c109c17, 0x000068b4, 0x560056b1, 0x6ebf30f6, 0x5eb25e67, 0x00005539,
+        0x3c883c20, 0x52b70dd9, 0x7aa37a1a, 0x0000f170, 0x624b62cc, 0x711455b1, 0x9b729b25, 0x00001738, 0x33aa3373, 0xfe8df763, 0x58be58b3, 0x0000f120,
+        0xe0d8e07b, 0x41662754, 0x776c7796, 0x000007df, 0xb199b172, 0x5692e166, 0x8b188b3e, 0x000057c8, 0x714971f7, 0x84f7375f, 0xe049e098, 0x0000b1a8,
+        0xc87fc81f, 0x7d551778, 0xc7e2c77e, 0x0000f427, 0xc0c6c0c7, 0x0b34b2ec, 0x93c69330, 0x0000065d, 0x276227ba, 0x7c8f31df, 0x1da11d6e, 0x00006e5a,
+        0x84a2845a, 0xba48d225, 0xeddbed6f, 0x0000f38d, 0x44fd44ce, 0xdd89f2ac, 0x53f053fc, 0x00004046, 0x69fc6913, 0xcae4c71e, 0x2a232a5d, 0x00000d18,
+        0xe60ce658, 0x2f821686, 0x6352638f, 0x00005a0e, 0xf344f389, 0xfca6ebfd, 0x2e392e88, 0x000034d1, 0x1dc21d8b, 0xa98ecace, 0x39b13954, 0x000074bf,
+        0x68656897, 0xe832cf2e, 0xab83ab94, 0x00009076, 0x6a5a6a95, 0xf9887c21, 0x9f9a9fb2, 0x00001549, 0xd203d237, 0xdbd1de21, 0xa59da587, 0x0000f7e7,
+        0x4f7e4ff6, 0x602185b4, 0xb112b1c6, 0x0000b243, 0x5d2d5d28, 0xe452c245, 0xa6eca6a1, 0x00001216, 0x9a5d9a11, 0xdf430137, 0xbc91bcdf, 0x000099d1,
+        0x12d9122c, 0x964a1166, 0x8a578ae4, 0x000021b6, 0x96799675, 0xb7dd560e, 0x5c225cd1, 0x00002bfc, 0xcb24cba4, 0x2c29112f, 0x716b71e2, 0x0000ebeb,
+        0xd8d7d89a, 0x8ddb2e4d, 0x17831702, 0x0000d305, 0xeba9ebb7, 0xa0be0f86, 0x0d260dd7, 0x00004d7d, 0xf034f072, 0x522d71af, 0x3220320a, 0x00009ac1,
+        0xc3f6c34a, 0x543cd292, 0x893889ff, 0x000019cb, 0x21eb212c, 0x74af0cae, 0xb120b138, 0x0000c412, 0xc7abc77f, 0x4b850dd9, 0x09700998, 0x0000eb28,
+        0xf262f252, 0x4bd4595c, 0xa7f9a7b9, 0x0000b2d7, 0x5ec25efc, 0x86c982f3, 0x212a218f, 0x00006ea7, 0x64d3643b, 0x0e15edf2, 0x4e524ea5, 0x0000dcbf,
+        0x80e3808a, 0x9b4ccea8, 0x95d89592, 0x0000b5df, 0x82598221, 0x0044e5dc, 0x9855980f, 0x0000e532, 0xeb7eeb14, 0x089d908f, 0xa265a287, 0x00001e02,
+        0x073407e1, 0x86b8a537, 0xd021d093, 0x0000915d, 0xe80ee8b7, 0xc4259800, 0x1c7f1cff, 0x00000be0, 0x36f5369c, 0x8c28bb6d, 0x205520bd, 0x0000bf79,
+        0xd5b5d5e9, 0x186a3dff, 0x86ca860a, 0x00009ea6, 0x212a2107, 0x2b426b42, 0x4f254ffc, 0x00002ca4, 0x4f984f8c, 0x2211d284, 0xff98ff97, 0x00009eb4,
+        0xba35badb, 0x6ac35e6c, 0xe77ee727, 0x0000c012, 0xd502d5fc, 0xae0de7e3, 0x01870100, 0x00009bf7, 0x87cd874b, 0xef930b16, 0x004d00cc, 0x00005409,
+        0xdf12dfd3, 0xcd257e3c, 0xa3b9a3d1, 0x00008b1e, 0xbcacbcb0, 0x4ff64246, 0x4df54d04, 0x000040ef, 0x771777fb, 0xcb945d92, 0x3b353b1d, 0x00006898,
+        0xccffcc66, 0x5af1388d, 0xd37ad39b, 0x000095f5, 0x197219a3, 0x5e2d9631, 0xb069b09c, 0x0000fe0d, 0x4b3d4b99, 0x6110066d, 0xee48eead, 0x00001d6d,
+        0x601960fb, 0x21d0b089, 0x8aa88aea, 0x00004399, 0xf1d3f1f1, 0x49c1a4d1, 0xd5e3d507, 0x000035c4, 0x0c800cb6, 0x41784a92, 0x472947d1, 0x00007660,
+        0x32453258, 0xf6ee73a9, 0x95a99557, 0x0000eab5, 0x1c621cd5, 0x4443007e, 0xac03ac80, 0x00001e2a, 0x079407b2, 0x10fd077e, 0xb0a1b0db, 0x00001616,
+        0x10d210ad, 0x172fe5a2, 0x3682361b, 0x000060d0, 0x9bb99ba1, 0xb7dd9a33, 0xd699d6de, 0x0000a51b, 0x066c065f, 0x1a5e0aa6, 0x700f705f, 0x0000b22c,
+        0xed09ed30, 0xd6727350, 0x484c4865, 0x0000fd7d, 0x0396030b, 0xde2f0a86, 0xba56baea, 0x0000c3ec, 0xdb9bdbbe, 0x2fc09d0f, 0x072807d0, 0x0000cc81,
+        0x7b6b7b70, 0x314536ad, 0x2b782bd9, 0x0000de86, 0x8e3a8ef6, 0x16c554cd, 0x92b09212, 0x000005a0, 0x67be67c6, 0x3ca30beb, 0x10e51009, 0x00009fb2,
+        0x15781557, 0xc17c3bb9, 0x6592653b, 0x000036dc, 0x24cc247a, 0x55f2560d, 0x62ee6234, 0x00007591, 0xc2f2c2f2, 0x3a3c67fb, 0x25e425bf, 0x000096cb,
+        0xfe26feeb, 0x68414d05, 0x1fda1fd1, 0x000009ed, 0x61e36184, 0xab80d599, 0x6ce46c56, 0x0000aa22, 0x9d609db8, 0xbfec58d9, 0x9c709c24, 0x000098c9,
+        0xf1f9f10e, 0xff865633, 0x30743073, 0x0000d777, 0xd34cd308, 0x34e0c07f, 0x8fe78f05, 0x0000765e, 0x980698cf, 0x8687bd76, 0x3dbe3d2a, 0x000059fb,
+        0xbb43bb1f, 0x137b6fc9, 0x484848ff, 0x00000ab2, 0x38c438f0, 0x53593b37, 0xfcb9fc92, 0x0000ab55, 0x890a894e, 0x037b44db, 0x1eac1e17, 0x0000ff23,
+        0x4c774c63, 0x0a9b943a, 0x1849181b, 0x000022ff, 0x11361136, 0x145119b9, 0x73397327, 0x0000e8ad, 0x8cf68c14, 0xc4272e4b, 0xbd36bde0, 0x0000b13b,
+        0xa204a2fb, 0x98a644fb, 0x3614364d, 0x000036ab, 0xcde7cd36, 0x84090d5b, 0x5c4e5cc4, 0x00008030, 0x57f357df, 0x304ea6ef, 0x6b8b6bd0, 0x00001164,
+        0x149d143e, 0x81244072, 0xbfc3bf16, 0x0000eba4, 0x9aa09ac9, 0x6412077e, 0x633b6377, 0x00002487, 0x7e707ef6, 0x3b2a26ac, 0x2e3f2e4e, 0x0000d62d,
+        0xf553f528, 0x42a6260b, 0x8a018a13, 0x0000ef49, 0xa66ea621, 0xbb536ddb, 0xdc31dc83, 0x0000591f, 0x8eeb8ee0, 0x45262d80, 0x80a88077, 0x0000d558,
+        0xd641d689, 0x6551b026, 0xc0a3c0ed, 0x0000f347, 0xa8d7a84b, 0x0ccb554f, 0x4cc84ccd, 0x00008020, 0x242624fe, 0xe4c10469, 0x73a87337, 0x00009fae,
+        0x0ab00ab4, 0x2a636ed1, 0xc596c5a8, 0x0000de3f, 0x679d670d, 0xeaa354b1, 0xb637b60f, 0x00008fdd, 0x86d186dd, 0x1b9354cd, 0xbe17be59, 0x000071c9,
+        0x334e33e0, 0x86d525c9, 0xba74bae1, 0x00005884, 0xfe7afe40, 0x92d45ded, 0xeef2ee10, 0x0000847c, 0xdc4bdc94, 0xb1272455, 0x826f82d5, 0x00001517,
+        0xcc3accac, 0x8bc582cf, 0xacdcacb9, 0x00003868, 0x07670734, 0x84c89739, 0x99ab99ab, 0x0000e346, 0x3aab3a82, 0x48f603f9, 0x380c38d8, 0x0000dcb6,
+        0x8ddf8d2e, 0x0e0aaa82, 0x4f944f5d, 0x00007bdf, 0x4b3d4b9a, 0xe6b7e2ec, 0x936a9377, 0x000025b2, 0x3e603e59, 0x557309a6, 0x459f4572, 0x00003c8c,
+        0x3013309f, 0xae1b222b, 0xff78ff95, 0x000021ac, 0x8faa8f8e, 0x6e42a11a, 0x9729970f, 0x0000399f, 0x66c666f5, 0x5cb21dd9, 0xd406d4d3, 0x0000baee,
+        0xe8bfe8c8, 0x486a35ff, 0xac69acb0, 0x0000fc81, 0xdc31dc08, 0xb1e2534c, 0x2c682c38, 0x00005c92, 0x681668ea, 0xb36d27d4, 0x97d6979d, 0x000038e6,
+        0xb585b523, 0x38507d3f, 0xf1cef184, 0x00003e8c, 0x9cce9c69, 0x871647df, 0x67126713, 0x00000273, 0x29b52966, 0x4a0afb8c, 0x375837fb, 0x0000c6b2,
+        0x8eea8ecb, 0x2aa267a1, 0x04aa04df, 0x00009e3a, 0x4751474f, 0xe5c16293, 0x60b46089, 0x0000a77f, 0x3639362d, 0x9a1fde21, 0x8a348ac8, 0x00006417,
+        0x52a1522b, 0xe6d3512b, 0x11a511a9, 0x0000d1ba, 0x5aaa5a6e, 0x50a94ae4, 0x7c1e7cf3, 0x00006ee1, 0x56dd5622, 0x33405c2c, 0x026d029a, 0x0000ba13,
+        0xc4cfc4c5, 0xaff1d2c8, 0xc2d6c2d9, 0x000024c5, 0x256925b1, 0x4c7552fc, 0xc1fec1ab, 0x0000e8c2, 0xee34ee30, 0xf2dfdae5, 0x6a786ad2, 0x000025a2,
+        0xfe74fe19, 0xa223dde8, 0x0d670d4e, 0x000011ac, 0x6c816c25, 0x25db78ca, 0x621462d5, 0x0000c18d, 0xe6a7e637, 0xd24f5a22, 0xd9a4d95f, 0x0000f618,
+        0x9384935c, 0xff7e24e9, 0xc3f2c3f2, 0x0000ccc5, 0x58e3585e, 0xc90daafe, 0x72717230, 0x000016ca, 0x7bfc7b35, 0x9afa49f5, 0x644b64a0, 0x0000a985,
+        0x592459ae, 0x23e290f9, 0x7849780e, 0x00006b00, 0xc132c1fd, 0x26581eda, 0xa99fa934, 0x000033f5, 0x39c539a1, 0xee6b87ac, 0xb4bcb4cf, 0x00001e21,
+        0xf382f379, 0xa5a08981, 0xb62db6f0, 0x0000ab08, 0x26de2658, 0x0744fefc, 0x1115110d, 0x00003195, 0x9df29d62, 0x0e76086e, 0x0a370aa0, 0x000060c1,
+        0xed95ed32, 0x5429f0e8, 0xfe5ffe0f, 0x000002fc, 0x339033ec, 0x3c1967db, 0x673567fa, 0x0000422e, 0x05400529, 0x4126798b, 0x99b19979, 0x00002fcb,
+        0x9c049c37, 0x5b698ce2, 0x51105187, 0x00004cf0, 0x1b471b39, 0x1caaecd3, 0xb561b5a0, 0x0000f427, 0xfb29fba4, 0x4d080aa6, 0x982c98e4, 0x000008ab,
+        0xa639a6d9, 0xe92093c6, 0xbdd5bd7b, 0x000013f7, 0x34c6340f, 0x24877a40, 0x2d452d47, 0x000066c8, 0x5b9b5b56, 0xc5e12468, 0xd4d9d425, 0x000002ac,
+        0x14a11451, 0x5097db36, 0x4fae4f00, 0x00009714, 0x7a6f7a64, 0x2280f51d, 0x1a591a9c, 0x0000ca32, 0x93b6935b, 0x944ec5e3, 0x7c947cef, 0x0000bc21,
+        0x02b502ff, 0x1dc899d7, 0xd255d205, 0x0000cce7, 0xcb64cb3d, 0x77750e67, 0xc1ffc142, 0x0000f808, 0x078e0767, 0xc44b2e4c, 0x9a479a01, 0x00001b45,
+        0x14fa14cd, 0xf869af40, 0xd3acd372, 0x0000faa3, 0xcdb4cdb2, 0xfb115ed2, 0x4b274b84, 0x0000f293, 0x3a1d3ac5, 0x1fc47e7e, 0x674f677d, 0x000061ee,
+        0xb9fcb9a3, 0x66c29275, 0xb655b6a4, 0x00009d6c, 0x5ed05e6d, 0xcc7aced2, 0x7154711c, 0x00002cea, 0x8b5b8b5e, 0x397780cc, 0x68226813, 0x000062d9,
+        0xb56cb5f2, 0xa58ea2e0, 0x0e2b0e38, 0x00000cbd, 0x41f4417f, 0xc9fa262b, 0x112e1167, 0x0000a19e, 0x4ad74a30, 0x778f2d7f, 0x75657529, 0x0000b44e,
+        0x566656ba, 0x75ce1f9e, 0xa6aba6e9, 0x0000d967, 0xa0cfa0ab, 0x2ad2fae5, 0x180b1853, 0x00000f83, 0x78cf7813, 0x62b2b71e, 0x1df91d00, 0x000036aa,
+        0xab48ab9d, 0x6232d8e6, 0x87aa87e5, 0x000008b5, 0x47964713, 0x06f9d4b5, 0x2ff92fac, 0x0000a1a6, 0xabb4ab9a, 0xc1ca0061, 0x4cde4cd2, 0x0000e104,
+        0x24fa248e, 0x30b73e4c, 0x76337645, 0x0000a084, 0xef23efd7, 0xe7c48ade, 0xe432e48b, 0x00001902, 0x738b73f1, 0x0454f59a, 0x0faf0f14, 0x00008f69,
+        0x1e021e9e, 0xb7b35e5c, 0x9e7a9efd, 0x00007070, 0xe2f3e25f, 0xfa73fa57, 0xe9f2e939, 0x0000ef16, 0xf7e0f73f, 0x4ff6d649, 0x675d67b5, 0x0000ad85,
+        0x3962391d, 0x96c8d55f, 0x464f4625, 0x00007b82, 0x09e3096f, 0xfead4b30, 0x2b7c2ba1, 0x0000e324, 0x999999df, 0x9c5874ec, 0x1b1a1bcd, 0x0000c710,
+        0x6eb36e4c, 0x49091a0f, 0xf4a2f432, 0x0000e4ab, 0xd1cdd177, 0x1bb149ef, 0xf0b9f06f, 0x00006b59, 0x2fb32f57, 0x4759960f, 0xc117c124, 0x000049de,
+        0x1daa1d3f, 0xf7b82bc2, 0x369f36d2, 0x000063e1, 0x930d9306, 0xf744b0c7, 0x44d444be, 0x0000eba4, 0x47eb471f, 0xf918a3db, 0x936f93ae, 0x000050a6,
+        0x61806125, 0xee52d409, 0xa0afa05d, 0x0000512f, 0x9d879db9, 0x40a6ed5e, 0xf94ef91c, 0x0000748f, 0x163d163b, 0x9163e07d, 0x7c2c7c69, 0x0000b4a8,
+        0xeb95eb16, 0x47b9da5d, 0xfa4efa11, 0x0000968a, 0x57bf5734, 0x70095ae0, 0xf4aff41b, 0x0000866d, 0x0d1b0d69, 0xbd6cb617, 0x7b147ba1, 0x00008260,
+        0x622962d2, 0x47b01d20, 0x0e510e09, 0x000007ac, 0x15ab15d1, 0xc17c9a6a, 0x9d119d0f, 0x00009901, 0x97cb970d, 0x6a822db1, 0x0acb0a95, 0x00001417,
+        0x5e4a5e1b, 0x4a0669fa, 0xc111c17a, 0x0000f56e, 0x76cc7678, 0x4361c5ca, 0xc213c26f, 0x00005e6e, 0x84f384f3, 0xa8519b36, 0xd6a5d616, 0x0000ce56,
+        0x1ed01e42, 0xee93ac52, 0x13b41399, 0x00001a2a, 0xdf07df02, 0x47468753, 0x019101d4, 0x0000c1bc, 0xabf9ab27, 0xf6499955, 0x3c703ca9, 0x00003b6c,
+        0x736f73cc, 0xba27aa8e, 0x107210c9, 0x00002ef9, 0xc6ccc673, 0xaf22a213, 0x4123415c, 0x000022b7, 0xe8d8e819, 0x14a5e1dc, 0xc93ac9b4, 0x0000a6aa,
+        0x67b5674c, 0x5575d3b7, 0xc0d4c069, 0x00005566, 0x994399c1, 0x47f908a9, 0x6c546cbc, 0x00001649, 0xbc38bc1d, 0xf5bbb058, 0xd7f1d79b, 0x00006447,
+        0xfe99feea, 0xc9fb9f58, 0x864f86fd, 0x00009853, 0x8d018df7, 0xcbbd5dd1, 0xf7a9f79b, 0x00000f0d, 0x7a017ad2, 0x710263fb, 0x222522f0, 0x000063c0,
+        0xab52ab80, 0x3c6f3cf1, 0xf9a5f91a, 0x00009ca8, 0xcf37cfad, 0xb923d409, 0x73947360, 0x0000c613, 0xd5bdd517, 0x8da7bea0, 0x0fda0f3b, 0x00001da5,
+        0x84ac8432, 0xbd97abf4, 0xd8ecd86e, 0x0000927e, 0x4bb84bb8, 0x847e86fe, 0x4c154c21, 0x0000684b, 0xf822f851, 0x04260a97, 0x657b65df, 0x000033e2,
+        0x88ad8896, 0xe7670cbd, 0xe355e3e2, 0x0000ab38, 0xbd35bd50, 0x67037dc2, 0x6d026de4, 0x0000e3b2, 0x93b6939c, 0x85c8430e, 0x9ccc9c66, 0x000093b4,
+        0x3f2a3fdb, 0xf0b6ebb0, 0x232a2311, 0x000033f5, 0xc0a8c05a, 0x02fa9633, 0x6f9e6f49, 0x00002213, 0x87fa87ff, 0xbecc95fe, 0x8ed48e9c, 0x0000871f,
+        0x5e9a5e44, 0xe242d8e6, 0xa7a4a7cd, 0x000092b9, 0xef5fef29, 0x2e37153e, 0x07000732, 0x00002a9b, 0x172217bb, 0x004d950e, 0x01bf0101, 0x0000f251,
+        0xc54ac51d, 0x42791bd5, 0x8148812e, 0x00005098, 0xef9eefee, 0x7fcd2e42, 0xc149c10c, 0x00007566, 0x56b856ea, 0x99a67ec0, 0xab1cabe2, 0x000037cf,
+        0xf9a8f981, 0xebd1be79, 0x992399ce, 0x0000b2d3, 0xd010d076, 0x4dab38ce, 0xec53ece7, 0x00000743, 0xc9b8c970, 0x40650519, 0x08f40859, 0x0000d54e,
+        0x65e765dc, 0x163a157e, 0x660e6663, 0x0000c532, 0x2e022e46, 0x7e56b5a0, 0x2d3e2d69, 0x00009783, 0x7aac7a18, 0xb475bd8f, 0xb83ab8c5, 0x000049a8,
+        0x0d160dcd, 0x0cbc430a, 0x0a010a92, 0x000091ea, 0xb1bbb1bc, 0x08241daa, 0xd8f3d84c, 0x00003cc4, 0xf022f049, 0x6922fcda, 0x17481730, 0x0000867c,
+        0x386b3842, 0x7901b935, 0xfd2cfdc9, 0x00006c66, 0x26d726a6, 0x6a6a396b, 0x9d329dcc, 0x00000eed, 0x2bb42b4c, 0xe663df38, 0xb7a8b7be, 0x0000f6cb,
+        0x617a61f8, 0x3edf3dff, 0xbddbbda2, 0x000094e0, 0xe03de006, 0x55a7f425, 0xeecfee66, 0x0000a11c, 0x2cdf2c72, 0x393c7a65, 0xa981a9b4, 0x0000fc23,
+        0x86a886e1, 0xa8a13246, 0xf91cf997, 0x0000772e, 0x35e1352f, 0x92188071, 0x64b6643e, 0x000073f3, 0x3d923da4, 0xf4574030, 0x58995824, 0x000055d8,
+        0xd5b6d528, 0x18b5b9e6, 0xf091f012, 0x0000e894, 0x215c21d9, 0xe25338f1, 0x67ec6720, 0x00009853, 0x6660664a, 0x3449e2e3, 0x43c94323, 0x00001aab,
+        0x495549e8, 0x0684505c, 0x745c74fd, 0x0000a277, 0x5fb05f1b, 0x2cddc316, 0x5021509a, 0x0000406e, 0x3ec43e81, 0x4c9b67e4, 0x6c186cd9, 0x0000b8ee,
+        0x7de77d13, 0x611bd284, 0xd407d466, 0x0000850a, 0x91b69131, 0x05c4cfaa, 0x6e886e02, 0x0000c2b8, 0xef0cef73, 0x8aa28081, 0xb437b4e7, 0x0000d3eb,
+        0x90889079, 0x3d65bdc9, 0x2c312ca7, 0x00006f6a, 0x7b057b6c, 0xb4fbd8a4, 0x8ce78c0a, 0x0000e643, 0x53bf532e, 0x3f7f7df6, 0xb5fbb5f4, 0x00006f4a,
+        0x9d359d67, 0xac20d00c, 0x760d761b, 0x00008130, 0xcee4ce59, 0xaf9f7dc0, 0x79fa79c9, 0x0000243e, 0x90479085, 0x2b41a26c, 0x4cdc4c60, 0x000043f0,
+        0x4d6a4db2, 0x930cc13d, 0xa321a310, 0x0000fd2d, 0x69d36964, 0x390185d0, 0xde42de16, 0x0000ebe2, 0x9a229ac2, 0x6cc3f840, 0xa2bda275, 0x00006ede,
+        0xa7e0a731, 0xf0f738ff, 0xdce9dc51, 0x00001b7a, 0x085608cf, 0x746d7864, 0xa145a1a7, 0x0000df87, 0x42ed4217, 0x100049a9, 0x364b3635, 0x0000ba3d,
+        0xe3cde3fc, 0x30873a4f, 0x40b24099, 0x000057b9, 0x566e5610, 0x512d2d74, 0x4d4c4d55, 0x00001e88, 0x19d819ad, 0x004b6ea4, 0x38cb3878, 0x00002948,
+        0x85fe8544, 0x884785f0, 0x15f81543, 0x00005146, 0x83f9838b, 0x701a3163, 0xf706f76c, 0x00006b31, 0x3cf73c0f, 0xb3a3fc05, 0x486a4835, 0x00006948,
+        0x524452b3, 0x4eb51fd0, 0xe532e5f3, 0x0000f579, 0x99479998, 0x28b47750, 0x586e5802, 0x00007cbf, 0x3b143b3e, 0x5b7852c2, 0xa749a7ba, 0x00005b1d,
+        0x999a993d, 0xfcde866e, 0xab66ab0b, 0x0000d048, 0x83608307, 0xd76a3412, 0xfd22fd5d, 0x0000e032, 0x13d813f6, 0x5f4e2163, 0xd1c1d1d2, 0x00009197,
+        0xe732e7a4, 0x1ada02ca, 0x25ed25bb, 0x0000a7f7, 0x14491428, 0x27cf9f6a, 0xa3b6a365, 0x0000a3c6, 0x5492543c, 0x1455c9a7, 0x0415047c, 0x0000805e,
+        0x427e4277, 0x5a2d2ed6, 0x22932243, 0x0000ff63, 0x681f683f, 0x007bb520, 0x6fa06f36, 0x00002756, 0xf76bf7bd, 0x80d56bf5, 0x63796320, 0x0000ee9b,
+        0x71287172, 0x43f68348, 0xd19ed1de, 0x0000d3eb, 0x043004e3, 0x0c1c746f, 0x1df01d02, 0x00001081, 0x3d253d47, 0xce450e5b, 0xb63ab650, 0x0000030c,
+        0xaf40af55, 0xe84f194d, 0x3024309a, 0x00005b1c, 0xc990c9ad, 0xe7e13a52, 0x095d0997, 0x0000df01, 0xe9f5e993, 0x8cf54658, 0x04850452, 0x0000f95c,
+        0x4f044fb7, 0x50b2a4b8, 0x5752571f, 0x00001588, 0x5a325ae8, 0x3cc3e604, 0x8dab8dc7, 0x0000770f, 0x22932292, 0x7a2b5243, 0xc072c08d, 0x0000283a,
+        0x7283720e, 0x38280a3e, 0x4a854a69, 0x00005f18, 0x2ced2cee, 0xfb11d03b, 0x663766a4, 0x0000482d, 0x43044377, 0x9ec142fd, 0x15261543, 0x000073ee,
+        0x63016346, 0xa98146a6, 0xe783e751, 0x0000857c, 0x858c8566, 0x49c19edd, 0xc69ec668, 0x0000b0cd, 0x6b676bb0, 0x5e074dd4, 0x9e6e9e6d, 0x00006326,
+        0x3c5b3c7c, 0x753e10e1, 0x59755991, 0x00005765, 0x9ae59afd, 0x31104a6b, 0x08e9084c, 0x00003241, 0x386f385a, 0xae512ed1, 0xb897b824, 0x0000b376,
+        0x45e845e0, 0x7eb585f1, 0x5c1f5cbc, 0x0000b16f, 0xa50ba5d9, 0x9e33a552, 0xace4ac5a, 0x00006a14, 0xb277b2db, 0xaf4db7a7, 0x7a2c7a02, 0x0000dab8,
+        0x113811d4, 0xc87a9338, 0x050c05bd, 0x000049f3, 0x5e975e84, 0x289c4a90, 0x7f9e7fab, 0x00005994, 0xd6b3d63b, 0x3adfd8a2, 0xd270d29b, 0x00006d8b,
+        0xb897b8dd, 0x3c8dae8a, 0xaa0faa0c, 0x0000f214, 0x07470793, 0x9cc725b4, 0x54825460, 0x0000dffe, 0xaf13afa8, 0x39107a7a, 0x503f5008, 0x00008a60,
+        0xd651d668, 0x50e419ac, 0x0d450d2e, 0x00001417, 0xc862c826, 0xf8765b06, 0x4e5f4e62, 0x0000e4ca, 0x9f919f2f, 0xf4515d5c, 0x2e462e64, 0x00006fca,
+        0x3fdf3f68, 0x5dedc65e, 0x36053641, 0x000017d6, 0xb9eeb963, 0xe9d36156, 0x2e3c2e8f, 0x00004ce4, 0x9d239d8d, 0xfa6afd47, 0xe1b3e1b5, 0x00000bf0,
+        0xc89cc83f, 0xaac604f4, 0xfe58fed1, 0x0000d918, 0xc5f0c5d8, 0xf757c6a8, 0x7a577a92, 0x0000849d, 0xda1fda62, 0x047b3ece, 0x019501d3, 0x0000ef9b,
+        0xf650f6d3, 0xf1f481f0, 0xb62bb649, 0x000018f1, 0x207a2002, 0x3abe9db0, 0xb238b20e, 0x00002cf9, 0x7e857ee5, 0xd0b415c3, 0x7b697b5a, 0x000081a2,
+        0x9bb29b4a, 0x790091e7, 0xd175d13a, 0x0000618b, 0x19c61962, 0xdd1a3764, 0x834e835b, 0x0000370e, 0x6a036a15, 0x5bd8a21a, 0xe4fbe4fb, 0x0000c62d,
+        0x207920a5, 0xd4dffdc5, 0x3b5a3b15, 0x0000790f, 0x0dd70dcb, 0x3b2768fa, 0x2168213a, 0x0000f6c3, 0x78e27811, 0x34ce710e, 0xb352b397, 0x0000bdf1,
+        0xa6fda6c2, 0xe34c396a, 0xdd8eddcc, 0x0000f99e, 0x408640e6, 0x31ef6b95, 0x3da03d77, 0x00000f39, 0xf437f479, 0x1e4d5823, 0x1e8e1e7c, 0x000013e3,
+        0xf31af3f0, 0xa361143f, 0x5421549e, 0x00005b1d, 0x673d677e, 0xcec20745, 0xac1eac4e, 0x0000229c, 0x11401174, 0x7e26e7a2, 0x82b2821e, 0x0000902a,
+        0x14ad1438, 0x8e46702f, 0x487c48bf, 0x00001888, 0x925c925b, 0x84c83b80, 0xb517b580, 0x00006dbd, 0x35e83559, 0x1d3e34ab, 0xa5c6a598, 0x0000f1ce,
+        0x09450952, 0x6d7daa40, 0x0b190b0a, 0x0000f9fa, 0x24812495, 0xc6e534d1, 0x1161117a, 0x00005298, 0x70f17008, 0x4736bcca, 0x6d546dab, 0x000067af,
+        0x2c992cfd, 0xe705258b, 0x8725871d, 0x00000ab3, 0x8b948b32, 0x718e28f9, 0xbf05bfbd, 0x00000292, 0x92a99209, 0x039b82f1, 0xa964a9de, 0x0000b049,
+        0xadccad77, 0x932eb1c3, 0x05f9050b, 0x0000b2cc, 0xc039c08f, 0x59c8d9a3, 0xf0caf08a, 0x00002ef8, 0x3f5c3f2b, 0xf4aee312, 0xaa7faa45, 0x00004ba9,
+        0x43c94314, 0x5507f16e, 0xcf55cfe2, 0x0000df02, 0xd4d4d43c, 0x5ab7f45d, 0xae22ae13, 0x0000c4e7, 0x08640896, 0xae51bb4d, 0x10dc10f1, 0x00006030,
+        0x1c951caf, 0x4a86e5dc, 0xb72db702, 0x00005c2b, 0x79c17966, 0xa46136e0, 0x9183914e, 0x00000a1c, 0x17ed1738, 0xda6ab1a9, 0xb89bb8a4, 0x0000f583,
+        0x5f835f85, 0xd9bb2d71, 0x361d3665, 0x0000ac49, 0x901a90a2, 0x01fb9133, 0x953e9565, 0x0000d993, 0x7c997c79, 0xaf5b65a7, 0x1f041f82, 0x00001aac,
+        0x02d70293, 0x6e7eb5a7, 0x751d75a3, 0x00005eb0, 0x4f7e4f5c, 0xd1ebb550, 0xe69ce665, 0x0000dd46, 0x093009d3, 0x7e8bcad8, 0xd104d1b1, 0x0000d1c2,
+        0x571c5740, 0x82e97908, 0xb6b2b676, 0x000030a0, 0xbbfebbdf, 0x6e820ca7, 0xeeb4eecb, 0x00002e58, 0xd43fd4f9, 0xbc75d4f6, 0x17f01740, 0x0000248b,
+        0x3c573c88, 0xd5cabbec, 0x03d9034d, 0x00003bb8, 0x0cca0c9d, 0x1376efb7, 0x4904496c, 0x00000733, 0x5c745cd9, 0xfa18e36d, 0xfe58fed3, 0x00001d9c,
+        0xcacacae4, 0x51fb8441, 0x1df91d0b, 0x00004e09, 0x2a932a19, 0xab01d8e4, 0xbecdbe3a, 0x00009101, 0x54be5436, 0xc92ad476, 0x23d923dc, 0x0000f88d,
+        0xad87ad32, 0x610c92f8, 0x6e826e32, 0x0000febc, 0x32883230, 0x4c75ffb8, 0xa36aa3dd, 0x00003fd3, 0x72fe7220, 0x47bdd404, 0x1d331d16, 0x0000ae02,
+        0xdc17dc45, 0x952c5cbc, 0xfafafa0d, 0x00009954, 0x785c7817, 0xd3cb8667, 0x4a444a09, 0x00001017, 0x195619d0, 0x7f6d3dff, 0x184f18fe, 0x0000eae2,
+        0x3981394b, 0x487ec643, 0x022e0253, 0x00005624, 0x3cf63cb0, 0x085c66da, 0xb94fb931, 0x000018f1, 0xb1c2b19a, 0x0e0a48e3, 0x12b3121b, 0x000056d9,
+        0x1829189d, 0x047bc735, 0x7c957cea, 0x0000a880, 0x96da9693, 0x81b5df3b, 0x3e343e6a, 0x00001689, 0x333333cc, 0xc7352ec5, 0x8b0b8ba5, 0x00003fb3,
+        0x458045e2, 0xac237df6, 0xdf56dfff, 0x00008e8e, 0xca36ca6e, 0x9369d21b, 0x3e583edb, 0x000062d4, 0xba4dbacc, 0xd21eeab5, 0xd0a9d05d, 0x00004d83,
+        0x06c80678, 0x2230cd50, 0xa739a71b, 0x00008def, 0x0ec20eb1, 0x10f092a5, 0x95319539, 0x00006e58, 0xbe4dbe1f, 0x3f729135, 0x89a3892d, 0x000021ac,
+        0x921e9226, 0xbf75ba75, 0xb793b79f, 0x00003041, 0x7749772d, 0x1b6c7f69, 0x46f24651, 0x00006130, 0xdeacde34, 0x0d7b2a44, 0x49dd4973, 0x0000c6d0,
+        0x0c3d0cd7, 0xb0b8f0ac, 0x290629a2, 0x000057bb, 0x6af86a0e, 0x79ce1bad, 0x67b567eb, 0x00002275, 0xfb1ffbec, 0x61603ace, 0x7fd17f38, 0x000062c9,
+        0xbb32bb49, 0xd46b5130, 0xc806c8da, 0x00006440, 0x35393582, 0x5306461f, 0x18ff18d4, 0x0000fb01, 0xd2d4d2b9, 0x039b3456, 0x36f0366d, 0x0000e3ad,
+        0x6aff6aec, 0x30cdadbd, 0x7f2e7f26, 0x00002ca4, 0xe96ce9c4, 0x2ea2442a, 0x7bd87b8d, 0x0000449f, 0x08fd08b0, 0x19932654, 0x410e414a, 0x0000b443,
+        0x44fa44b5, 0xdbc796c1, 0x545a546f, 0x00007661, 0x38343866, 0xcc2461e9, 0xdd03dd7e, 0x0000a5f7, 0xfa35fac4, 0xdb51f958, 0xda66dad7, 0x00009116,
+        0x276f27f5, 0x81c07d6f, 0x956d953c, 0x00006b35, 0xd72bd7ba, 0x366f7988, 0x9a299a0a, 0x0000b2af, 0xa4eca4cd, 0xf318fcc7, 0x31f83173, 0x0000c703,
+        0x0b520bba, 0x220fc757, 0xbc6dbca7, 0x00007f71, 0xc74cc715, 0x7b09a1cd, 0x913d91fc, 0x00002c75, 0x990899d5, 0xcb7af9c5, 0x69666930, 0x00009619,
+        0x1dd51dcd, 0x677233a3, 0xcb58cb57, 0x00004cf3, 0x9efc9e9c, 0x3d285cd5, 0xf16df171, 0x00000ba8, 0x9d659d19, 0x55a7cd50, 0x1fcf1ff9, 0x000016f4,
+        0x41ad4104, 0x14eccfa9, 0x69d3692e, 0x0000069f, 0xbfc1bfb6, 0x5ba737a0, 0x8bf88bc1, 0x0000f4db, 0x04450426, 0xc2264456, 0x2b182b7b, 0x000021a2,
+        0xaebdaeec, 0x13f99e8e, 0xe886e890, 0x000098d5, 0x33a0338a, 0xae93aee1, 0x68246802, 0x0000dae5, 0x1555155d, 0xb1dfa0a4, 0x451545c4, 0x0000f0d3,
+        0xe3c4e3c7, 0x0b55ef42, 0x4d734db6, 0x000020b7, 0x0a4c0aa7, 0x199e14c6, 0xad25adf5, 0x00005784, 0x701870a0, 0xccec5673, 0xd025d017, 0x00008050,
+        0x69a469b6, 0x5252d06f, 0x7e717e6d, 0x0000bfac, 0x9501958f, 0xcf2af23a, 0x7bfd7bc3, 0x00005276, 0xd2a1d2c2, 0x3787f269, 0x92169277, 0x0000d3bb,
+        0xeeecee16, 0x92cba552, 0x110311db, 0x0000895f, 0xc967c9c9, 0x8c79eb31, 0xd342d31e, 0x00002949, 0x99a09981, 0x7500d0c4, 0xbd44bdba, 0x0000880b,
+        0x93059375, 0x68c2806e, 0x601a60c6, 0x00009714, 0x413641c8, 0x203d6c95, 0x126212fe, 0x00008faa, 0xdfd4df37, 0x69a0f06d, 0x1b261b6d, 0x0000241c,
+        0xdd15dd32, 0x79c8a9df, 0xe232e27c, 0x000014c9, 0xcfb8cf26, 0x791f50f0, 0xe8ede85c, 0x0000a14a, 0xa0b0a064, 0x65a5b937, 0x157f1576, 0x00002752,
+        0x166516d6, 0x2c20756f, 0xc431c481, 0x000095bc, 0xbbc3bbb1, 0x9768e3dc, 0x41a2412e, 0x0000352f, 0x9d7c9d14, 0xfbce7f46, 0xd4f2d482, 0x00002366,
+        0x832d8365, 0x8326b84a, 0x0a6a0a8f, 0x0000874e, 0x83c88354, 0x63dd12fe, 0xf860f8ce, 0x00003e37, 0x8a198a52, 0xfc46aaff, 0xd565d580, 0x0000f221,
+        0x421542c2, 0xf4aee213, 0xa918a93b, 0x0000b8b1, 0xa7cca7db, 0xee98a36c, 0x2a642a81, 0x00000bbf, 0xf80df8c9, 0xd792afb8, 0x14e014a5, 0x00009116,
+        0xf449f4bf, 0x7eddadc2, 0x5a295ae8, 0x00003375, 0x44fb4479, 0x88b88992, 0x659e653e, 0x0000e816, 0xdd6edd5c, 0x2380d5cb, 0xb463b421, 0x00001653,
+        0xb156b106, 0x50b2b4d5, 0xddbfddef, 0x00001321, 0x1bde1b6c, 0x08088c0b, 0xe67ae68c, 0x0000df20, 0xb32bb32d, 0x5bc92fdb, 0x674567ce, 0x0000332f,
+        0x9f049fb9, 0x88f80edd, 0xc6f9c6a6, 0x000051d8, 0x2af72a91, 0x1b95732c, 0xd68ad6f4, 0x0000b4a8, 0x38c53822, 0xe0f2cc51, 0x985598c0, 0x00005b36,
+        0xb607b605, 0x3b97730e, 0x6ce46ccb, 0x0000ae85, 0xc1b0c17a, 0x9870f7de, 0x53f253eb, 0x0000d9f4, 0xd311d381, 0xf5deeed8, 0xab6dab98, 0x0000b22c,
+        0xb635b653, 0xe59d64a5, 0x310531d8, 0x0000f662, 0x1aa01ae3, 0x2efeb238, 0xc673c614, 0x00009698, 0x2bd52baa, 0xd9049f61, 0xe274e260, 0x00006ce1,
+        0xd3bbd3e2, 0x067b9bd6, 0xe72de752, 0x00000163, 0xa960a92f, 0xa98e3b42, 0x81348176, 0x00003cd3, 0xb730b79e, 0x44856487, 0xcec8ce3f, 0x0000f804,
+        0x1c321cd9, 0x55e7ffac, 0x703070eb, 0x0000e364, 0xa4c7a4ab, 0x4aa8fc7e, 0x0ec90e2d, 0x00009f9b, 0xf525f5d0, 0x670cee73, 0x03b60386, 0x0000946b,
+        0x09ee09c6, 0x6f1099d7, 0x2f162f26, 0x0000c49c, 0xb38ab358, 0xb88139ce, 0xae35aeda, 0x000009f0, 0xf4fbf463, 0x26b1abb8, 0x191e193b, 0x0000ba86,
+        0xbef2bea8, 0xd34bb390, 0x0b1a0bb0, 0x00002fa4, 0x95c39529, 0x9ed933df, 0x178c173a, 0x00004b3b, 0x5da45daf, 0x69221931, 0x896e893d, 0x0000bb55,
+        0xc80dc862, 0x7b853ab1, 0x3e9e3e61, 0x0000720f, 0xeb46eb8d, 0xd2d5cf57, 0x294b2977, 0x00002288, 0xc0f5c0c3, 0xc3ca492f, 0x70ab7046, 0x00003c92,
+        0xd0edd030, 0xba8521ab, 0xae32ae49, 0x00004a81, 0xbf2ebf95, 0x9a4f2509, 0xec7dec27, 0x000015ca, 0xf402f4ce, 0xd5c9fd4d, 0xfc27fc55, 0x0000bd9c,
+        0xb598b5f3, 0x5ded9edf, 0x70bd70f8, 0x00008280, 0xfd74fd1e, 0x3596252b, 0x7a377a77, 0x00007444, 0x747974bf, 0x1aa52dbb, 0xb575b527, 0x000015d6,
+        0xee50ee32, 0xc524b09a, 0xec50eceb, 0x0000aa4b, 0x37fb37c1, 0xb608b35b, 0x528d522e, 0x00007ca3, 0x6cd66c60, 0x8847e9b0, 0x366236ad, 0x0000a137,
+        0xa762a7af, 0xfcde36db, 0x00440029, 0x0000e1e2, 0x0a2b0a7c, 0xc9451afe, 0xd222d254, 0x00004f30, 0xb56cb5d2, 0x7eaf1953, 0x60db602b, 0x0000d305,
+        0x74e874b6, 0x00148a53, 0xd191d1f3, 0x00008390, 0x32fa325c, 0x568c28f8, 0xa4c6a482, 0x00008350, 0x27922732, 0xdd6ec6b8, 0xef85ef79, 0x00008d57,
+        0xdce9dc9e, 0x5a66ad3c, 0x7a827a6c, 0x00006926, 0xa36aa347, 0xda385a9e, 0xe687e6ea, 0x00005e90, 0x25d525be, 0x34ceebfd, 0x9c2e9c4e, 0x00003f13,
+        0x9991999d, 0x8298cc2c, 0xb284b2b5, 0x00008460, 0xfdeefd16, 0x8bbff425, 0xb0cdb062, 0x0000128a, 0x86ea861f, 0xb36cc0c0, 0x97a2973d, 0x00000ef8,
+        0x94fe9432, 0x7c9d4cd4, 0xea77ea69, 0x000085ef, 0x36cf36f1, 0x6af36d38, 0x5ad05a68, 0x000044ef, 0xb0b8b01d, 0x8e945738, 0xcaafcabe, 0x0000d51a,
+        0x7a657a6f, 0xf53d2880, 0x8355833a, 0x00008f56, 0x5f595fe6, 0xd6eda2e0, 0x0ef50e58, 0x00005c76, 0x261826dd, 0x3c181c4b, 0x34223417, 0x00003194,
+        0x0d6c0dbe, 0x0ef5c435, 0x0bbe0b44, 0x0000854d, 0x5c405ce1, 0xec810b51, 0xc21cc23e, 0x00006ebd, 0x66716607, 0x2cdc76d9, 0x4e604efa, 0x0000ba05,
+        0x516e5111, 0x9eec6625, 0x101a1078, 0x000011d6, 0x521c528d, 0xd6e18346, 0x053905b6, 0x00002497, 0xa1bea171, 0x83b6ce57, 0x628d62b7, 0x0000fd32,
+        0x04a5044d, 0x5b82ab00, 0x175117b5, 0x000019e3, 0x9326933e, 0xf6ff4edf, 0x0f2a0f71, 0x000047ef, 0x2aa32a1c, 0xd48ea19f, 0x6259621f, 0x0000e615,
+        0x08d80892, 0xd24bbff2, 0x0ffa0fff, 0x0000d2a5, 0x65bc65cf, 0xf36e2b45, 0x5c625c2d, 0x00004290, 0x04a704f3, 0x15e5c148, 0xe3e5e3ac, 0x0000b633,
+        0x3e3d3e45, 0x4f890ad6, 0x2138219d, 0x0000e478, 0x1aa71ac9, 0x4e86af7c, 0xe37ee326, 0x000017c5, 0x68a86814, 0xfa0007f4, 0x9a129a8a, 0x0000d487,
+        0x8a7c8aeb, 0x5fd6d111, 0x5839580a, 0x0000d96c, 0xf78cf76c, 0xf95ad9db, 0xd81fd819, 0x00002747, 0xe0a5e08f, 0x64129164, 0x977a97c8, 0x0000272a,
+        0x88d788d6, 0xc4350559, 0x5f575fea, 0x00006917, 0x20222035, 0xc71dfccb, 0xae64ae53, 0x0000086a, 0xedd2ed31, 0xf5c221d6, 0x5da25d1c, 0x0000cfaa,
+        0xdcd6dcbc, 0x61ef5820, 0x2e542e93, 0x0000905d, 0xbcfabc79, 0x7a09ee66, 0xf8e7f84a, 0x00007039, 0xd18dd156, 0xb90e1778, 0x3fb73fa2, 0x0000fbfe,
+        0x581d5825, 0x6790f257, 0xb614b625, 0x00005555, 0xbbccbbec, 0xdcf8d738, 0xebb2eb3f, 0x00006c67, 0xb992b951, 0x57f089a8, 0x444944f3, 0x00004711,
+        0xba38bad2, 0x2a12f37c, 0xd054d0fc, 0x0000c974, 0xd6e1d67f, 0x6dc2ac37, 0x0464046f, 0x0000616f, 0xa413a4c7, 0x6410047e, 0x6ff26fd8, 0x00002586,
+        0x6f436fe8, 0x13b1904c, 0xf047f01e, 0x00008460, 0xef56ef62, 0x7867f32e, 0x898d890f, 0x0000cdf1, 0x1dac1d8f, 0xbd8b1f59, 0x4218429a, 0x00004ca9,
+        0xb747b714, 0x71cf7a0f, 0x25102521, 0x000061c8, 0x8f368f57, 0x4e591bd3, 0x07290751, 0x00003a1b, 0xb6bcb6d0, 0x86396b4b, 0x94819450, 0x0000eec8,
+        0x577357c6, 0x88228bac, 0xfb19fb5f, 0x000006a1, 0xb628b6d3, 0x647fc811, 0x74ab7431, 0x000085ff, 0xdf55df5b, 0x29c185f0, 0x291a29dd, 0x00004f30,
+        0x7c3c7c29, 0x8c792359, 0x683668ac, 0x0000409d, 0xee75ee61, 0x4eb46014, 0x8f5c8ffb, 0x000036ab, 0x1f991f8e, 0x07d43bb2, 0x286f2839, 0x0000d6a5,
+        0x1d041d07, 0xa4351b2f, 0xdba0db7c, 0x0000cedd, 0x304f300c, 0x5dd70ad7, 0xd0ffd0a0, 0x0000d80b, 0x723b7217, 0xe92e9f9c, 0xfeaffe50, 0x000000b2,
+        0x37ca373b, 0x6ba032a3, 0xcf77cf77, 0x00003f4c, 0x80128082, 0xc17c7eff, 0x8f5c8fa4, 0x0000b349, 0x4ebb4ed8, 0x158a9338, 0xc30ec376, 0x0000b700,
+        0x60386037, 0x6922c043, 0x0b150b09, 0x0000070d, 0x4bff4bde, 0x9aec4cd6, 0x01020199, 0x0000f7e7, 0x048c0461, 0xba3fec93, 0x419541b8, 0x0000d25b,
+        0x185c189d, 0x8214e84e, 0x84b68457, 0x0000475c, 0x19e71956, 0x287d8918, 0xca6fca4f, 0x00001b7a, 0x4629465f, 0x78f64458, 0x49a24958, 0x00009429,
+        0x7d297d47, 0xa541b1dd, 0x813b81f4, 0x00008972, 0x2be92b91, 0x97d4f255, 0x588158ba, 0x00009f0e, 0xe7f4e712, 0x0e973bf1, 0xb668b6c8, 0x000001a0,
+        0xb70bb7c3, 0xeb5b13e6, 0x4a304a30, 0x0000a24c, 0x1eb51e13, 0x5ce2046a, 0x3e063e43, 0x0000a451, 0xf225f251, 0xdd8f8d22, 0x0a6b0a8d, 0x00002ea4,
+        0x28c628c7, 0x25a26a4a, 0x6e366e0e, 0x0000c7ec, 0x5790573d, 0x1805aafe, 0x32dd32ce, 0x00007660, 0x884088d1, 0x7e5c3d8f, 0xbb5fbbe4, 0x000039ed,
+        0x9d8b9de5, 0x04e39a2a, 0x4c6f4c77, 0x0000fe32, 0x83e5838e, 0xd2bd98ac, 0xeb94eb55, 0x0000d7bb, 0xda0bda47, 0x8b98b058, 0x0ea40e1c, 0x000052ca,
+        0x2b112bf3, 0x82bf7fb8, 0xf328f36c, 0x0000ef48, 0xb2e0b271, 0x240fe2b0, 0x12871288, 0x00002ef9, 0x4bd04b6a, 0x52524cad, 0xac48acf2, 0x0000b4e5,
+        0xc9a1c946, 0x0ff5a3d2, 0xb4dbb46b, 0x00007db0, 0x59795953, 0x54cb6bb5, 0xaf21afd2, 0x00005834, 0x0f410fad, 0xa7812099, 0x9cef9cee, 0x00003bed,
+        0x9b229b99, 0xa4417232, 0xd0f2d0e0, 0x00001ef7, 0xfcc1fc2a, 0x3dca0361, 0xb12fb14c, 0x00003f4d, 0x38ee3857, 0xd780396c, 0xd15ad1a7, 0x0000eabe,
+        0xf8ecf81b, 0x3db17d01, 0xf3b8f322, 0x00004804, 0x6c966c7d, 0x98f1ad41, 0xd7b5d75d, 0x0000e7ac, 0x2ced2c82, 0x8ff74241, 0x3da53d65, 0x00005077,
+        0xfd75fd6c, 0x65506e9c, 0x6e0f6ea8, 0x00009619, 0xec7eec7a, 0x5cb23038, 0xe4cee443, 0x00002ff9, 0xd704d74b, 0x4e268add, 0xfd57fdfe, 0x00006ebd,
+        0x7c3f7c9d, 0x4689d335, 0xfcf6fc05, 0x0000ae75, 0x0dc10df1, 0x4746d092, 0x63cc6388, 0x0000fb01, 0xe553e591, 0x05a56400, 0x325c323d, 0x000052a7,
+        0x521f52b5, 0xf86af4a9, 0x8e688ebf, 0x000007e4, 0x06660693, 0x8ee5f69a, 0x30be3099, 0x0000bd62, 0x8bc68bef, 0x33df0e5a, 0xbe45be11, 0x00009b4e,
+        0xf8a5f8a9, 0xae4f7c08, 0x095d0900, 0x00000a2c, 0xaaa3aa11, 0xbd038bd1, 0x1c7c1cfe, 0x00005448, 0xac95ac03, 0x8584c2ba, 0xcab8cabb, 0x00000763,
+        0xac12ac35, 0x2ea3e1d4, 0x3163313a, 0x0000213e, 0x09eb0962, 0x422484ef, 0xbc79bc15, 0x00006de1, 0xcab7cab6, 0x26ae9de9, 0x534053a1, 0x0000ea80,
+        0xa5cea500, 0x67d2ecb3, 0xe7c4e7da, 0x0000ba10, 0x2d062da8, 0x7c1b3223, 0x10ee1097, 0x0000814c, 0x588a5861, 0x6750bc37, 0x092a0928, 0x0000b636,
+        0x8978896c, 0x9237fef4, 0x7b6d7b5d, 0x0000968a, 0x5d295d26, 0x9e2c8e5f, 0x57b1578b, 0x00008acf, 0xbf5abf9f, 0x29e05303, 0x1ba41bea, 0x0000f215,
+        0x93009334, 0xbc4b03f7, 0x37583708, 0x0000372f, 0xb78ab7c2, 0x3b3cc80f, 0xff5fffbd, 0x0000faa0, 0x302930c9, 0x80a677a6, 0x786c78f0, 0x0000ec16,
+        0x40ec40f8, 0x2453863e, 0xaac5aa2a, 0x00008bb5, 0x3e163ec4, 0x75b572a8, 0xfe57fe3e, 0x0000d1d9, 0x95da959d, 0x1b6cded8, 0xce24ce07, 0x00005c4d,
+        0x40fa4051, 0xf1cb3ad1, 0x7108715d, 0x0000e5ad, 0x32563212, 0xe3a3cb58, 0xd5d2d577, 0x00009ce0, 0x7bd67be4, 0x203f8afe, 0x4df54dfc, 0x0000c49c,
+        0x81df8141, 0x3119ded0, 0xe26ee263, 0x00000f1c, 0x0c610c8f, 0x7b1d5366, 0x3428349f, 0x00003ded, 0x767076f5, 0x16558db8, 0xceddcecf, 0x00006af6,
+        0x173d17cf, 0xd5bd3005, 0xb507b562, 0x0000b2a2, 0x5fdc5f2b, 0x31afb617, 0x6a326af2, 0x00004b11, 0x567956d4, 0xfd01dd9d, 0xb00cb0e6, 0x0000f738,
+        0xa733a78c, 0x5577bc3a, 0xc780c7d8, 0x0000252c, 0x3b5e3bc4, 0x64152326, 0x87af8795, 0x00002ca4, 0x482d4843, 0xf0cf479b, 0xb969b90f, 0x00001017,
+        0xe7c9e78a, 0x487a01d9, 0x35f235cc, 0x0000bd6e, 0xc126c158, 0xc4358bfe, 0x3aac3ae3, 0x000003a0, 0x4a154ae8, 0x4ba063e7, 0x34e134ea, 0x0000d71d,
+        0x90829043, 0xc89a03f7, 0x69256939, 0x00000d5d, 0x95c6955e, 0x972867c5, 0x685d685e, 0x00005e10, 0xb6bcb648, 0x57f6d48a, 0x6f106fbe, 0x000070b8,
+        0xd035d057, 0xc6d68f21, 0x0c900cb3, 0x0000b3f2, 0x34a7348f, 0xd16be43c, 0xbfcabf69, 0x0000b1bc, 0x8a0b8a37, 0xe1416d48, 0xb015b081, 0x0000dbb7,
+        0x5b865b25, 0x7b3e2bc0, 0x6df26df9, 0x0000e7ac, 0x88df8823, 0x0b54cc31, 0x4eea4e15, 0x0000e489, 0xbfd8bf62, 0x0a5f4106, 0xb317b397, 0x00001c73,
+        0xa201a288, 0xf9497751, 0x81348150, 0x0000688a, 0x325b3211, 0x2552aa87, 0x85ea85d6, 0x00007fdc, 0x6a616ad3, 0x9e2c669b, 0x92679214, 0x0000af65,
+        0xd9dad979, 0xf96cfa67, 0x1b5d1bd9, 0x00006a30, 0xd83dd8f9, 0xaa0de390, 0xaf3baff6, 0x0000d23a, 0xebf7ebd5, 0xdd896ac9, 0xdfe8df64, 0x000059dc,
+        0x5b335b48, 0x9dd8ff25, 0xd700d701, 0x0000d8f7, 0x59fc5983, 0x74afc23c, 0xed30ed51, 0x000060f9, 0xb5deb556, 0x369a391a, 0xc5abc5d1, 0x0000ea17,
+        0x32743271, 0x891cb7c3, 0x44304470, 0x0000cc06, 0xd63fd69f, 0x8b47034b, 0x33cb333b, 0x00007dbf, 0x00560037, 0xec0e820c, 0x6801686d, 0x000095a7,
+        0xc0c3c075, 0x2f297909, 0x543654b3, 0x00001cad, 0xe33ae300, 0x1ddac108, 0xbd5cbd09, 0x0000d828, 0x003a007d, 0xb31debcd, 0x20442004, 0x00001788,
+        0x4627460b, 0xa9f188e1, 0x0bdb0b28, 0x0000a455, 0xd553d55a, 0x33df1141, 0xc7b4c700, 0x0000f4d2, 0x855185b8, 0x0a5c7a09, 0x36d73632, 0x0000f733,
+        0x7355730a, 0xd954808f, 0xaca8ac4c, 0x00002766, 0x28562871, 0xa341e75d, 0xfd2efdc4, 0x0000bc10, 0x45624597, 0x17eedce5, 0x74a8747e, 0x00000f72,
+        0x930393fd, 0x6ff04835, 0xdc81dc7e, 0x0000c5b8, 0xa8a3a863, 0xe79dc94e, 0x2fab2ff2, 0x00001e7f, 0x30383080, 0xecd185b4, 0xb8c0b82a, 0x0000c612,
+        0x467d465c, 0x805e3891, 0xd69ed6fa, 0x00004311, 0x1ca91c5c, 0xbab3f62b, 0x75dd75d9, 0x0000590d, 0x11ff11c9, 0xa7fc6cc5, 0x61f86109, 0x0000a1b5,
+        0x87188723, 0x9b32f760, 0xf683f6ee, 0x0000b4b6, 0x5be35be7, 0x04e64de9, 0xcf7ecfc3, 0x0000f6b4, 0xb2f3b26f, 0x965ededb, 0xf08ff043, 0x00006300,
+        0xa04da0b3, 0x02d55b06, 0xdb42db97, 0x00006f9c, 0xcdabcdca, 0x54cbc3ba, 0x64d664b5, 0x00003e35, 0x1c691c61, 0x7a09779f, 0xa4aea4e4, 0x00006fb8,
+        0xb68eb65f, 0xe9588f20, 0xb98cb9a1, 0x0000fb01, 0x878987ea, 0x4c5f74d9, 0x222b220e, 0x00009114, 0x3bef3b97, 0x1cc9e366, 0x477f479a, 0x0000b096,
+        0x0c620c2c, 0x98f17050, 0xb9b5b9c2, 0x0000c25c, 0x03180335, 0xa261f5f7, 0x94e394f5, 0x0000d756, 0xc1f1c122, 0x6d212fa9, 0x36df3680, 0x00004f20,
+        0x0e330e77, 0x7f26eccc, 0xe7b2e700, 0x00007960, 0x409f40b1, 0x41467469, 0xadb5adf2, 0x00005e6f, 0xf5d0f5fd, 0x3f3c129e, 0xbf86bf47, 0x000073fb,
+        0xd1ced177, 0x8fc6bdc1, 0xc97fc94e, 0x00003735, 0xb1eab13c, 0xd34c864b, 0x923b92e9, 0x000074b0, 0xd335d3dc, 0xf92b6624, 0xf0a4f073, 0x00004904,
+        0xfb4bfb80, 0x28edc9ed, 0xadc6ad8e, 0x00007e03, 0x09cc0962, 0xb69ab9f5, 0x034f03e3, 0x0000de9b, 0xaf06af16, 0x20d20036, 0xb8d3b8aa, 0x00007cfe,
+        0x8bef8b90, 0x584d1cda, 0x175d171a, 0x00004c77, 0xf6d4f6f4, 0x898575d9, 0x7e0a7e5e, 0x00003c73, 0x931c9319, 0xd2ad5824, 0x9b339b7e, 0x00008380,
+        0x6860683f, 0x9bdea4ee, 0x1e651e25, 0x0000135e, 0x352a35d0, 0x5c9fd6cb, 0x60fc6005, 0x00002867, 0x8f178f62, 0x6250482a, 0x08f60810, 0x000048c4,
+        0x45f64543, 0x7d6dc851, 0x60b460d6, 0x00000132, 0xc067c0ba, 0x8aa4f4a4, 0xb090b07f, 0x000001c2, 0xf68bf62d, 0x4129525c, 0x019401d4, 0x00004fe4,
+        0x935d9372, 0x42c6c29e, 0x6f1d6f50, 0x00000971, 0x95839529, 0xf8aabf7f, 0x385738fd, 0x000042ef, 0x7abc7a1b, 0x6d7d123e, 0x8e2a8e8c, 0x00001f14,
+        0x19041993, 0xc6d466b6, 0x6f506fef, 0x0000d567, 0xe90ee93f, 0xa29cf1ec, 0x9cea9c2a, 0x000012aa, 0xb8deb8ca, 0x2f6363d5, 0x8b098bbb, 0x0000f93e,
+        0xf5b1f5d1, 0x62e11a0d, 0x8c1c8c4b, 0x00002cdb, 0xd47cd4d5, 0x41793f8d, 0xfe5dfe11, 0x0000f726, 0xe08de0b4, 0x62b26a35, 0xad57ad20, 0x000066f7,
+        0x6dca6ddc, 0xa0a119b4, 0x75ec754d, 0x00005e6f, 0xa242a236, 0x8f6604cb, 0x4d6a4d3e, 0x00004a6b, 0xfa24fa51, 0xfc954c54, 0x4de14d16, 0x00005674,
+        0x8ce58c14, 0xa2c2f86e, 0x45e145e5, 0x00007170, 0x7b3a7b44, 0x60e16d48, 0xee70ee8b, 0x0000aa78, 0xcaf4cae1, 0x1dd5182f, 0x24062422, 0x0000a7dc,
+        0x057a057d, 0x48ef5734, 0x6bfc6b52, 0x0000d077, 0xf264f2d8, 0x4a0a0d27, 0x57ab57c9, 0x0000cd69, 0x23a023cf, 0xd0b48290, 0x8a628aa3, 0x00006930,
+        0xea35eab1, 0xa44b0861, 0x143714c6, 0x00004c68, 0x1549152d, 0x7fb94956, 0x1b571b10, 0x00005b54, 0x92bc9228, 0x487f5fd2, 0xcfffcf43, 0x0000bcbf,
+        0xb328b325, 0xfa9bf92a, 0x08680877, 0x0000cdf1, 0xe584e58b, 0x8ad7f625, 0x69f469e5, 0x000025a4, 0xecfdecd1, 0xd64fc9e5, 0x4868487c, 0x00005489,
+        0x40d940b1, 0xde512d8f, 0x04150437, 0x000031ab, 0xc4bdc405, 0xb93e4b48, 0x3f813fea, 0x00000b6b, 0xe04fe06b, 0xb57e5123, 0x76387616, 0x000062d9,
+        0xdd25dd9d, 0x88c18508, 0x3dbe3d2d, 0x000027df, 0x983c98bc, 0xea0eecf2, 0xb372b394, 0x000081a3, 0x3d903da4, 0xd480b671, 0x2de52db6, 0x0000f0ac,
+        0x84f384e2, 0x0ff5f79e, 0xc30ac3c8, 0x0000ca7f, 0xa8d2a823, 0x48a08fde, 0x43774395, 0x0000d99b, 0x64fc64fa, 0x329701fa, 0xd0bad06c, 0x0000ae07,
+        0x833d8351, 0x6840e4e2, 0x9d629d91, 0x00006a8a, 0x9dc69dc4, 0x16f98371, 0x377037b0, 0x0000a8cb, 0x5d345db6, 0x00260f73, 0x6276621b, 0x0000f62d,
+        0x3ddc3d3e, 0x33601dda, 0x40b3409a, 0x00009f43, 0x8bd18bd4, 0xa211abc2, 0x01180108, 0x00008280, 0xbff9bf1a, 0x7e56973d, 0xf247f2a6, 0x0000ab76,
+        0x97419786, 0x130500c8, 0x5c745c94, 0x0000496a, 0xe014e0d8, 0xab7b1488, 0xfdb1fda5, 0x00004fcc, 0xf6e9f6d5, 0x97168965, 0x160416ef, 0x0000564b,
+        0x73f07370, 0x847505c8, 0x4c044c4a, 0x000089be, 0x14f71453, 0x605e082a, 0x3ff43fb0, 0x0000ca01, 0xcf31cfaf, 0xd8e4ec83, 0xe49ee46d, 0x00003ded,
+        0x3cdb3cd2, 0x1ade1355, 0x3e583e5a, 0x00007821, 0x8878882b, 0xd0c48681, 0x326332f1, 0x0000888d, 0x7fe97f7c, 0x99a6325f, 0xe852e8ed, 0x0000081e,
+        0x081b0893, 0x6fa0c23d, 0x591c59bb, 0x0000b7c6, 0xfbd9fb5a, 0x8e676598, 0x49a34914, 0x0000bda6, 0x25de255c, 0x4ed4c3fb, 0x83b583d7, 0x0000a208,
+        0xd5ccd5ec, 0xf75185f3, 0xd7bcd7c3, 0x00003b26, 0x2e162ec5, 0x0425e8d3, 0xeb2bebef, 0x00008660, 0x6b636b0b, 0x79ff96bb, 0x8a378a69, 0x00006530,
+        0x3a763a32, 0x66ade32d, 0x963196ed, 0x00007fcf, 0xead3eac6, 0x4529f8c5, 0x00b9004c, 0x0000b1c4, 0x59465961, 0x9d2cc911, 0x57ab577d, 0x00005d64,
+        0x15cc154b, 0xe4521478, 0xd460d455, 0x000093d5, 0xf3dff35a, 0xf457ec4f, 0x1ce81c1d, 0x0000a628, 0xe31de306, 0x6c61e6dd, 0x0218021f, 0x0000448f,
+        0xe7ebe7b4, 0x2d43f75a, 0x15ea1588, 0x0000ee33, 0x80f08051, 0x832568d5, 0x8abc8a5e, 0x0000a519, 0x20d520f6, 0xd04c14c6, 0xabd6ab3a, 0x0000a11c,
+        0x7b237b41, 0x6bc3177a, 0xb500b580, 0x0000b105, 0x59fa59bb, 0x66ad762b, 0x90e790bd, 0x00007384, 0x33193333, 0x04c6bfb6, 0xb954b952, 0x0000fedd,
+        0xcc39cc29, 0xc4483fe0, 0x11a311e9, 0x0000d7a5, 0xd143d181, 0x4cf60785, 0xb765b705, 0x0000ced3, 0xdf40df27, 0xe99de6a0, 0xed46edec, 0x0000dcbb,
+        0x741d74cf, 0x0ca835ff, 0x823b82fb, 0x0000ad75, 0x4a664af4, 0x97266e2b, 0x4e254e2f, 0x00006323, 0x483f4852, 0xf7468372, 0x59ce59fc, 0x00006c9a,
+        0x58c458a4, 0xfd1e74ac, 0xb519b51b, 0x0000b9ce, 0x18d81832, 0xf5ba254d, 0xa88ca833, 0x0000e0ca, 0xb595b5c3, 0x7663df6a, 0x1ffe1fd7, 0x000026d5,
+        0x23382388, 0x83a64dad, 0x481948bf, 0x00007cfe, 0x98909894, 0xa51df760, 0x0afa0a77, 0x0000f373, 0x4e454e40, 0xf9cfb258, 0xe999e91e, 0x0000819d,
+        0x83a583e1, 0xb5041547, 0x0ea80eca, 0x0000a964, 0xa147a1d4, 0xa4a1793f, 0x4d464d12, 0x0000415f, 0x884e88db, 0xcf27972a, 0x07a00704, 0x00005ac7,
+        0x14f7148e, 0xd82edfad, 0x3c7a3c8e, 0x0000a577, 0x09270917, 0x53a71d20, 0xf1f0f1e0, 0x00008cb1, 0xee39ee6f, 0xf7eb53b1, 0xe883e8ef, 0x00001fac,
+        0x76ca76f0, 0x2f84d02a, 0xf15ef1f1, 0x0000413f, 0x5b775b46, 0x9191efbb, 0x19a719da, 0x0000b6d7, 0xea50ea9c, 0xe92dbea1, 0x73c67379, 0x000027de,
+        0x3f353f84, 0x70699670, 0x1c0a1cdc, 0x0000028c, 0xc320c324, 0x25532d8e, 0x6b036bd3, 0x0000e344, 0xcd5acdd4, 0xe614a6d4, 0x8de68d0d, 0x00007a60,
+        0x286428cc, 0x1e1e22eb, 0x52bc5217, 0x0000ed24, 0xb335b353, 0xaab57f34, 0xda7cdaba, 0x0000a907, 0x3205323d, 0x92e7b84a, 0x90da9085, 0x0000059e,
+        0x0aa00ac6, 0xac0d769d, 0x77687702, 0x0000d9ea, 0xbfa0bfd1, 0x6e509f23, 0x650a6542, 0x00008a32, 0x06cc0622, 0x1c3a0f81, 0xfa7cfad9, 0x00001973,
+        0x6ecd6ef4, 0x5ab967e4, 0xdc08dc3e, 0x0000a719, 0x081c08d7, 0x7a8ba26c, 0x69db692b, 0x000059dc, 0x73ee735f, 0xe50a9bd7, 0x236923d8, 0x00003d11,
+        0xd035d056, 0x039b6d08, 0xa15fa144, 0x00008342, 0x270a2731, 0xb2b82802, 0x4d244d5f, 0x000030a0, 0x80a0806d, 0x0cd5b9cc, 0xf7a7f77e, 0x00009c04,
+        0x4c074cf2, 0x2d464147, 0xa2c1a274, 0x0000b84f, 0xc763c730, 0xcdf8944c, 0xf2ecf2cc, 0x000034dd, 0x34df347c, 0x29a21c32, 0xc0c2c02c, 0x00000d5d,
+        0x1dc51d1c, 0x62cfd184, 0x86ad8690, 0x0000fbde, 0x4cfd4cd8, 0xe79f6eca, 0xdf2fdf83, 0x000019b3, 0x062f0650, 0x17f96dc5, 0x5f225f04, 0x00001168,
+        0xe7c8e78e, 0xe5e9b1e6, 0x015401e4, 0x0000c312, 0x37b837c8, 0x060c1478, 0x1a751a71, 0x0000b5b1, 0x414441f5, 0x1b6a6320, 0xe201e258, 0x0000fa82,
+        0x6a536a93, 0xfce97f09, 0x8b628b0e, 0x0000a9fb, 0x749774e5, 0x0bdb5365, 0x0d450d54, 0x0000e959, 0x923292e2, 0x03f480fe, 0xa9ffa954, 0x00001117,
+        0x23f72340, 0x9ed9d7cb, 0x8a3d8a7e, 0x0000ec16, 0x5bf55b9e, 0x974237ff, 0x479b47bc, 0x00007561, 0xb77ab72b, 0xa1be403b, 0x8c638c8c, 0x0000761d,
+        0x10f41025, 0xc3351222, 0x93bd9347, 0x00004131, 0x423a42fc, 0x7c5826c9, 0x4a434afd, 0x00002aa4, 0x249a2488, 0xe84fd904, 0xf048f013, 0x0000dbeb,
+        0xa3a0a3a1, 0xec0e91be, 0x1f4b1ff2, 0x000038c0, 0x62cc6250, 0x573d6427, 0x15ee15d0, 0x0000f21d, 0x75e9756f, 0xc10430a1, 0x420c42ef, 0x0000b197,
+        0x66b4661d, 0xeeacebfd, 0x304930e6, 0x0000902a, 0xed2eed30, 0xe5f5ee3c, 0xfc1ffc22, 0x00003008, 0x1f0e1f22, 0x4e36938e, 0xfb66fb85, 0x00008d57,
+        0x33f1330d, 0x91f33d8d, 0x91f991cd, 0x00001988, 0x90799055, 0x6a12b7d6, 0xdfa4dfab, 0x0000e2f2, 0x55b25579, 0x4456de21, 0x2f722f72, 0x0000d300,
+        0x8cfe8ce8, 0xc0d51eda, 0x4f2c4f5b, 0x0000fc73, 0x907a90f8, 0x850b0361, 0xab74ab3c, 0x00006f2a, 0xb24fb214, 0x512d51cd, 0x73fe73d7, 0x0000c56f,
+        0xac73ac14, 0x53566a4b, 0x7d7a7d14, 0x0000dcb7, 0xb086b080, 0x16c65c13, 0xd69ed6d9, 0x0000766c, 0xfda2fd43, 0x1cc8ae66, 0x2c722c98, 0x00008e72,
+        0x95d695bb, 0xf79b67c5, 0xe613e69d, 0x00004759, 0xe8fce87e, 0x332e47b1, 0x2354231a, 0x0000d144, 0xe452e433, 0xdc30872f, 0x19311915, 0x0000905d,
+        0xadcaad73, 0x7998e69d, 0x2b152b43, 0x0000eb16, 0x42f84281, 0xab7e1055, 0x4a754a0a, 0x0000014d, 0xbfa7bf9a, 0x652168b6, 0x9d5b9d04, 0x00006791,
+        0x999f99bb, 0x80c8fdda, 0xe178e1e8, 0x00009ce0, 0x77e977f1, 0x108a38f0, 0x14a614ea, 0x0000c05a, 0x048704c5, 0x6414cbd8, 0x5f835f9e, 0x000061a6,
+        0xcacbca2d, 0x5ff2606d, 0x0579059e, 0x00002276, 0x539f530b, 0xa1115f95, 0x10191089, 0x00008742, 0xa93ba939, 0xd85a48df, 0x6c4e6cec, 0x0000fb73,
+        0x734d73d2, 0x037b4dd0, 0xd93fd946, 0x00008c8e, 0x8d3c8d40, 0x80289638, 0xba47ba34, 0x0000723b, 0x145214fe, 0x1e05899a, 0xfbb8fb91, 0x0000ccc5,
+        0x78af78c6, 0xd3c9027e, 0x028f0261, 0x0000d91b, 0x16021629, 0xf7f47f34, 0x482e485b, 0x00002abb, 0xb304b3f6, 0xbc03d3b7, 0x06c806c8, 0x00002f9b,
+        0xc060c08e, 0xff4eec4e, 0xbdc2bd9d, 0x00000a2c, 0x7da27db6, 0x6a500be3, 0x57695799, 0x0000b0cd, 0x10d01055, 0x24ed4438, 0x53005376, 0x000063d4,
+        0xcb3dcb83, 0x40ee2254, 0x632663fa, 0x0000e4a4, 0xfdcdfd0f, 0x6a8247e6, 0x88188849, 0x0000ccaa, 0xa399a377, 0x40051e0c, 0x371637a3, 0x0000c26d,
+        0xc64fc61f, 0xa67e384d, 0x674f677a, 0x0000d952, 0x072f078d, 0x88f85b3b, 0xff6cff62, 0x0000a0e8, 0x4dae4d26, 0xbc6e5533, 0x4b2b4b6c, 0x000042b0,
+        0x7fad7f19, 0xb8b0b366, 0x36e3365c, 0x0000c62c, 0xcc98cc46, 0x7eb25ba3, 0xde7ede98, 0x0000e5ad, 0x5b8c5b98, 0x7fa19545, 0x4d4c4de0, 0x000022b6,
+        0xea63eae8, 0x01864cca, 0x4ba44ba0, 0x00002cb8, 0xac0cac1b, 0xa64f625c, 0x971297e4, 0x000034ab, 0x0518052a, 0x24198730, 0x0a520a0b, 0x00005798,
+        0xb736b7b1, 0xbf74824d, 0xc145c10b, 0x0000b258, 0x4be74bfe, 0xae9b4f54, 0x9c129c23, 0x000062d0, 0xe18de198, 0xbf01f4c9, 0x20ed2055, 0x00005a9b,
+        0x3aa83a96, 0x512f30a0, 0x5ad75a65, 0x00004a12, 0xd63ed6ce, 0x716e67e5, 0x040b045c, 0x00007fc1, 0xfa3ffaf0, 0x682e6b25, 0x2c4e2ca9, 0x00002ef9,
+        0x412a41b4, 0xa4fc9ac8, 0x0f050f9b, 0x0000d9e2, 0xbf26bfd0, 0x753f02c8, 0x6a8b6ab1, 0x00000df8, 0xd8d4d833, 0x0b9b99d6, 0x68216880, 0x00002c66,
+        0xb5abb570, 0x3d505ba5, 0xda8dda63, 0x0000ab08, 0x3c643c5c, 0x3df5706f, 0x8f7a8f39, 0x0000b705, 0xd7bad7ec, 0x24ed94c5, 0xf0cdf0cd, 0x0000b8ce,
+        0x55d85522, 0xa982046a, 0x92129259, 0x00007669, 0x3a5e3a20, 0xa3c2e7df, 0xb95fb909, 0x0000a6f7, 0x81c281fe, 0xf72b5392, 0xcc1bccf1, 0x00006b5c,
+        0xc3b7c331, 0x948e37ff, 0xfc28fc13, 0x00000248, 0x814781b3, 0xeae62508, 0x6d9e6d71, 0x0000e489, 0x11171136, 0xc35df628, 0x9065906c, 0x0000be2e,
+        0x33b033c5, 0x3cf86465, 0x53aa5316, 0x0000a718, 0x884c8822, 0x738ababd, 0x89938991, 0x0000da67, 0xf600f6d1, 0xb5f6f832, 0x620f626a, 0x000041cf,
+        0x712771a7, 0x92887eb9, 0x6f686f35, 0x0000684a, 0xfb5efb6b, 0x0af50df9, 0xc6bbc68c, 0x0000ba91, 0x87db87ca, 0x3aaf3669, 0x4b804bc6, 0x00006aa6,
+        0x13121398, 0x864fe8cc, 0xde36de92, 0x0000fffc, 0xe97fe947, 0x0b540149, 0x4a3c4aac, 0x0000e999, 0x117f11f4, 0x16dade22, 0xdf0fdfda, 0x0000df88,
+        0x53e353a0, 0x1eda1149, 0x225022a9, 0x00006e21, 0x7b9c7b66, 0xcac4a652, 0x8d7b8dcd, 0x0000564b, 0xa19da1ec, 0x16552b38, 0x4b1b4bb1, 0x00000aed,
+        0x4bd54bba, 0x3f0a0ae7, 0xc941c9b1, 0x00009fb3, 0xb4e7b437, 0x29412e3b, 0xc8f9c84e, 0x0000a58b, 0x3bef3b65, 0x2abd98d5, 0x9bed9bbe, 0x00003e45,
+        0x7ff17fd8, 0xe80e1852, 0xd85ad823, 0x00003406, 0x72ab72d9, 0x127c3455, 0x57b85786, 0x000077d0, 0x6ac46a9a, 0x685034d1, 0x89b38920, 0x0000ae08,
+        0xbfebbf7f, 0xc27bee33, 0x824f82b5, 0x000001bd, 0x727a722b, 0x1e05f1d6, 0x3d163ddb, 0x00000f83, 0xa847a8ca, 0x2753280c, 0x6f946f52, 0x00009296,
+        0x8a2e8aee, 0x39e19901, 0x65f06508, 0x00006b00, 0xc5efc5f8, 0xe77f0bd9, 0x6ec06e97, 0x00002d1c, 0x3a583a21, 0x1fc97766, 0xa610a64d, 0x0000f718,
+        0x3565351c, 0x10714d50, 0x75057528, 0x00005f8b, 0x982698e3, 0x46786257, 0xa9a6a9d1, 0x0000c792, 0x1e6f1e4e, 0x38288082, 0xb845b81f, 0x00002b3e,
+        0x1054105a, 0x7a991da5, 0x7500755b, 0x0000a7a7, 0x34fa3444, 0xb92c8df7, 0x53fc5322, 0x0000b357, 0x9a209ac1, 0x84f785f3, 0x4dc24d91, 0x00005cd6,
+        0xffd0ff5c, 0x0ae2d7da, 0x641c6410, 0x0000ef16, 0x8e288e6e, 0xef53a0db, 0x91f69143, 0x0000482d, 0xf5b0f576, 0x1e41c62c, 0x0eb00efb, 0x0000c492,
+        0x22fb2250, 0x227bd6a2, 0x35bd3598, 0x00006bd5, 0x483348b9, 0xf31895fe, 0x510e5154, 0x0000a277, 0x1f691f0c, 0xc7fa8b21, 0xc2eac22b, 0x00009001,
+        0xc91cc95e, 0x9da61289, 0x9645963a, 0x00008cf1, 0x4384430f, 0x3701062f, 0x2b452b18, 0x000094a7, 0x9f4c9fa1, 0x9173093b, 0xbf75bf24, 0x0000a11d,
+        0xa1fca1dd, 0xe95b02f4, 0x8d038da5, 0x0000a7a7, 0x1b921be1, 0x47b938f2, 0x4db04de6, 0x000091fe, 0x2b822b69, 0x8237fe25, 0x4cfe4ca3, 0x000024cd,
+        0xa207a207, 0xd56aab79, 0xec1aec23, 0x00004211, 0x6ed86e9f, 0x2e7d8c21, 0x47ca47bf, 0x0000b636, 0x7dbf7d17, 0x904ccc04, 0x9177910b, 0x00008620,
+        0xf18bf10c, 0x2721f157, 0xce06ce65, 0x00001f02, 0x398439fa, 0xf8961893, 0x07a40764, 0x0000beee, 0x601e60ae, 0x6ed1c044, 0xe1fde143, 0x0000efe8,
+        0x467a46dd, 0x262c35bf, 0x0bfd0b1c, 0x00002ea4, 0x4f434f03, 0x61327eb8, 0x067b06c4, 0x00000a63, 0xbeecbe86, 0xe7b6595c, 0x776a77a7, 0x00002aa4,
+        0xf87ef8a8, 0xcf25bb68, 0x8fce8f27, 0x000038e6, 0xe321e3a8, 0x95b695f7, 0x02720279, 0x0000b66b, 0xc18ac101, 0x4f5f3dcd, 0xe46ee4bd, 0x0000dd37,
+        0xc226c201, 0xffccd5c4, 0x2c452ceb, 0x0000fece, 0xaba2abb5, 0x2aed29ff, 0xf81cf81c, 0x0000ef88, 0xbef9be19, 0x9b88e7e1, 0xbf6bbf35, 0x0000e9be,
+        0xd8d6d8c3, 0x2a0bedc9, 0xd226d265, 0x0000638b, 0x66e166df, 0x8bc0a847, 0x1aa61a88, 0x00008a30, 0x609f6040, 0xc48a828c, 0xb528b54f, 0x00002e67,
+        0xe7dbe70d, 0xb51b3349, 0xe047e09d, 0x00000b71, 0xa44ba411, 0x7e5514aa, 0xa51da541, 0x0000f293, 0x141e14b8, 0xd1b4c768, 0xdef7de5c, 0x00004c2d,
+        0x511a515b, 0xb92dcad2, 0x51ae513a, 0x00000d46, 0x00260007, 0xb9dcc2e8, 0xdb8cdbe3, 0x0000b4f7, 0x8f3c8f42, 0x6dc25ea3, 0xdc17dc85, 0x0000389f,
+        0xdfc1dfec, 0xbccdba84, 0xd666d692, 0x0000cddd, 0x7f537fbf, 0xae9193d7, 0x58055884, 0x00003a9f, 0xe720e770, 0x143debcc, 0xe132e15b, 0x00006f15,
+        0xa93ba9b3, 0x303c67da, 0x195719d6, 0x000096eb, 0x0200026a, 0xc79c2754, 0x8fa08fc8, 0x0000e17a, 0x9e479e68, 0x55ed523f, 0x22712272, 0x0000864f,
+        0x65ba65a4, 0x738e1ba9, 0xc48ac462, 0x000099c0, 0x21d22106, 0x605a22aa, 0x4dcd4d87, 0x00000b1f, 0xe067e051, 0xbf037c7b, 0xcaceca90, 0x000026df,
+        0x3685364c, 0x2b3d1e93, 0x6e6e6e35, 0x00000353, 0x12101212, 0x1c4e15c3, 0x00a3000c, 0x0000e5f4, 0x15aa1538, 0x2372e02d, 0x6ef46ef6, 0x00005ac7,
+        0xc3e7c3b7, 0x65329808, 0x606460fd, 0x00003c12, 0x086c08b1, 0xc105cf2c, 0x725472ed, 0x0000bb8f, 0x33793377, 0x934c33a0, 0x33ce33c9, 0x00004c68,
+        0x741b74c0, 0xc90dc1fd, 0xc607c69f, 0x0000a707, 0xfe41fee4, 0x8f6e1bad, 0x1f611f5a, 0x00008e61, 0xfdfcfd32, 0x46efd64a, 0x99579991, 0x0000eb29,
+        0x712e71a2, 0xd850b2d8, 0x8b4f8bb8, 0x0000e032, 0x2035206f, 0x63225240, 0x2e4d2ea1, 0x0000e5ac, 0xee01eef2, 0x329480f3, 0x195619b5, 0x0000bc1c,
+        0xf5cef5ce, 0x6d010ae7, 0x53a253a1, 0x00001e47, 0xe174e1c4, 0xecf19728, 0x627862de, 0x0000854e, 0x7b637b6b, 0x138ed039, 0x63356329, 0x0000d62e,
+        0x57715789, 0x58227a3d, 0x0f460f0c, 0x00004212, 0xba3ebae2, 0x58400ad7, 0x84598443, 0x0000ddbb, 0x5d7b5dbd, 0xbd1bcbd3, 0x4a7e4ad5, 0x0000ab1e,
+        0x46ef4665, 0x8c65f45a, 0xb68ab6ae, 0x0000c39f, 0x37ce37af, 0x620cb1c9, 0x2bca2b6b, 0x00008780, 0x17d81743, 0x7d9499e9, 0xb8c3b886, 0x0000297b,
+        0xbb4bbb1a, 0xf5c2c072, 0x6f6a6f98, 0x00005e9b, 0xb5c4b50a, 0xae33e605, 0xba42ba34, 0x0000ff63, 0xb922b966, 0xc18433a1, 0x4e1e4e36, 0x00001721,
+        0xbe40be4c, 0x393cbc3b, 0xbb04bba3, 0x0000ba8c, 0x5f365fc2, 0xb61b0ea7, 0xca84ca4e, 0x0000033f, 0x76cf76e8, 0x5251fc45, 0xb7acb725, 0x00009ac1,
+        0xbe94be19, 0xa0627bce, 0x13ff13b9, 0x00002e67, 0xb63fb699, 0x9391b201, 0xaba2ab1c, 0x0000165e, 0xcef6ce50, 0x95429d70, 0x72e47290, 0x00004ca9,
+        0xbeafbeb6, 0x6f82d335, 0xf135f161, 0x00008e67, 0xbbf2bb43, 0xee13b287, 0x91809146, 0x0000e789, 0x987898c3, 0xdf8ff4f7, 0x735f73ad, 0x0000ed4a,
+        0x32b3327c, 0x19ee69f7, 0xcc3bcc77, 0x00003d13, 0x28b9282d, 0xc99a0b9f, 0xc1f7c1a9, 0x00007351, 0x7cab7ce0, 0xba4f6d12, 0x27a327b5, 0x00003cf3,
+        0xe0c8e007, 0x3b6fdbe6, 0xa126a1ca, 0x0000aca6, 0x95279583, 0x6e2259dc, 0x544254be, 0x00006fd4, 0x375237bb, 0x2d3d81c1, 0x4f244ffd, 0x000094e0,
+        0xe6bae6f6, 0x59cb8fa7, 0xb552b5c4, 0x00007c8e, 0x81fe81d7, 0xa67ea452, 0x5194511c, 0x00006f59, 0xcf3dcfdb, 0xdddb56f2, 0x335f33e2, 0x00008f61,
+        0x921292c4, 0xa17ef876, 0xa69ba6a4, 0x00003d33, 0xc89cc847, 0xf07d7850, 0x0eed0ee4, 0x0000e3db, 0x35923558, 0x1e09982e, 0x01fb01ad, 0x00007141,
+        0xfa96fa46, 0x4360c69c, 0x635263a0, 0x00002d49, 0x177317fe, 0xe4202356, 0xee09ee14, 0x0000e14f, 0x3ddd3d64, 0x33b111c3, 0x54fd54c8, 0x00003f4c,
+        0xf977f980, 0x58d87764, 0xa441a4b9, 0x0000b1a8, 0x2ac72ab6, 0xdfbbfa3b, 0x65f26509, 0x00000b46, 0xdb2adb8a, 0xbe6e9a55, 0x8f508f47, 0x0000e9be,
+        0x345e34d6, 0xd52b41f8, 0xd678d6d0, 0x0000b831, 0x4866486c, 0x377760e3, 0xf897f8de, 0x00001eda, 0x445044c3, 0x97d69e35, 0x5ac65a92, 0x0000564b,
+        0xa136a103, 0x0b561daa, 0x41ab4190, 0x00000200, 0x8971892c, 0x06faaf3f, 0xe367e31e, 0x00008731, 0x5b1c5ba0, 0x2f53f847, 0x366236e8, 0x00003c81,
+        0x28bf28db, 0x54da1fe1, 0xc144c10e, 0x00002e9a, 0x395239d8, 0xf17d515a, 0xc6e7c613, 0x00002fca, 0x23802315, 0x304fd06f, 0xff6cffd2, 0x00006246,
+        0x2561252d, 0x39e2eb93, 0xdd5cdd38, 0x0000ec88, 0x6c9b6ccd, 0x701a8101, 0x856285f5, 0x0000d256, 0x1b0c1b65, 0x835e50e3, 0xe741e700, 0x0000d1bb,
+        0x8d298d76, 0x69df3468, 0x632c6352, 0x00009a3e, 0x9b769bed, 0x73cd744c, 0xfc9ffcb9, 0x0000a055, 0x9daf9d7d, 0x67c339ed, 0xda67da1f, 0x0000f473,
+        0x9461948d, 0x97286185, 0x6efa6eda, 0x00009599, 0x05960584, 0x584016fe, 0xce4bce12, 0x0000bcbb, 0x09a5092d, 0x682fb1c3, 0xb06ab0a9, 0x00004611,
+        0x173b17be, 0x85c87664, 0xe1e6e18c, 0x0000c4be, 0x2c822cee, 0xffcc8a56, 0x0a720a78, 0x0000f3f1, 0x280c283c, 0xd82d6cf4, 0x0daf0d0f, 0x00002ca9,
+        0xd1a0d1ca, 0x9aa6d7d4, 0x57805795, 0x000002df, 0x7f9f7f7b, 0x0664417a, 0xfdd4fdad, 0x0000ced2, 0x68b96871, 0x346ff8dc, 0xa8b1a80a, 0x0000f99f,
+        0xe707e7ca, 0xc7484fd4, 0xac63acc1, 0x0000db18, 0xd2b1d26f, 0x9a1e2089, 0x7ac27ad1, 0x0000b743, 0x1a3e1a62, 0xd7142755, 0x813281a1, 0x00002fcb,
+        0xefd2efa2, 0x972388fe, 0x803c8086, 0x0000e189, 0xe6c7e6ab, 0x3f719fdf, 0x72c372d0, 0x0000ee5f, 0x00a200b0, 0x7e85b7d6, 0x8ed38e4f, 0x00006730,
+        0x946394f7, 0xa06102fb, 0x529152a9, 0x00001d7a, 0xe256e28d, 0xa14105b4, 0x6e3d6e2f, 0x00003af3, 0xf5cdf5ce, 0xa24216fd, 0x4007407b, 0x0000cdce,
+        0x36df368e, 0x3348a841, 0xbb73bb20, 0x0000969b, 0x4bfc4be6, 0x77a8139a, 0x4d5a4d03, 0x0000d804, 0xa8dba86c, 0x5d9f9576, 0x515451ab, 0x000047ff,
+        0xa1e2a1b4, 0x99dc2b7f, 0x08970844, 0x000018f7, 0xdc28dc70, 0x985c94f9, 0x527c52d5, 0x00000f99, 0xe6b7e678, 0x7bf6ae87, 0x7c547c9e, 0x000051a5,
+        0x9cfd9cdd, 0x1fc53ab1, 0xaa27aa99, 0x0000283a, 0xb7f6b730, 0xe8229247, 0x81ea81c1, 0x00007451, 0xb5a5b5a6, 0x4909262b, 0x131b136c, 0x0000a691,
+        0xa569a525, 0x499a70af, 0x1c6f1c7f, 0x0000c9ab, 0x65166550, 0x36d83e85, 0x1e181ec9, 0x00000563, 0x62a66271, 0xd38197fe, 0x7cfc7c03, 0x00002c86,
+        0xf3c4f3cc, 0x8dbbf0a8, 0xf199f121, 0x00008e70, 0x22492268, 0xe6680bde, 0xbdeabd42, 0x00009f0e, 0x5a585a13, 0x5f9d96be, 0xc52dc59a, 0x00000dbb,
+        0xda3fda9a, 0x308cc998, 0x2b002b98, 0x00002cc6, 0x24392430, 0x0566fe05, 0x329132e9, 0x00000ff0, 0xe90ce9b6, 0x5307fae7, 0xd537d595, 0x000026b6,
+        0x66746625, 0xf0f43dce, 0x6d1a6dfc, 0x0000ac47, 0xbac7bae6, 0x6b4097c6, 0xd326d3b2, 0x0000815e, 0x27a827ff, 0xc25d8410, 0xcd1fcd61, 0x000064a6,
+        0x4cbb4ce6, 0xb96c9fd8, 0x12f21293, 0x00004a6d, 0x2c4b2c94, 0xcc8af87c, 0x6f586ff7, 0x0000cc45, 0x61dd619c, 0x0b56eb70, 0x44b244e3, 0x00001b7a,
+        0x58ec5898, 0xd61eee2a, 0x5b645b51, 0x0000ff41, 0x6bb16be0, 0xa29028fb, 0xafc4af83, 0x0000c3de, 0xef34ef28, 0x776994b2, 0xd506d562, 0x00003f33,
+        0xa037a07b, 0xd2eb6c3a, 0x550f5552, 0x0000ade9, 0x722f72a3, 0x3b97b468, 0x37bf37e6, 0x000015b6, 0x45cd455e, 0xe852d7c8, 0x157f158e, 0x00003cd1,
+        0x01bd01a4, 0x897b81f0, 0x955f95ce, 0x00009d0e, 0xeaeeea16, 0xbfced06a, 0xaea5ae90, 0x0000650f, 0x9e409eb7, 0x314db429, 0x6d686d98, 0x000021b6,
+        0xba4dba21, 0x3973b837, 0x124a12f1, 0x0000a91e, 0x788d78b7, 0x25d2be06, 0x3a3a3aba, 0x0000317a, 0x02b60281, 0xe60c65e5, 0xc62ac679, 0x00000bb3,
+        0xf659f623, 0x9b56814a, 0xa0bba063, 0x0000ea17, 0xe580e57a, 0x67801ee1, 0x70c570d6, 0x0000168a, 0xb8eeb898, 0xee935ebc, 0xfaa3fa92, 0x0000ba91,
+        0x723c72dd, 0x1e6b38b1, 0xaeb8ae9d, 0x00000972, 0x6f376fa6, 0x236dd7cb, 0x12371282, 0x0000e646, 0x98db9896, 0x2c429081, 0x9cca9c6a, 0x0000fda0,
+        0x5a5c5a9c, 0xd2abb696, 0x51815114, 0x0000a0e9, 0x083f08ab, 0x544f02ca, 0x685a6806, 0x0000b3d3, 0xab23ab9d, 0x00e49bd4, 0xa660a6b1, 0x000081a2,
+        0x2194215f, 0x61edfdb2, 0x32dc32b8, 0x00003f9d, 0x80aa80c3, 0xc0ca9038, 0x31733110, 0x00002219, 0xf0faf00c, 0x13fe014b, 0x2c3d2c63, 0x00009d8a,
+        0x298d295a, 0xdf71e393, 0xfb13fbe7, 0x00005de5, 0x97239718, 0xe41eb9c5, 0xa76ca7df, 0x00004fb4, 0x659f65d8, 0xef58a62e, 0x9f6f9faa, 0x0000e4d7,
+        0xee7dee20, 0x4ce71bee, 0xd257d290, 0x0000af25, 0x80748022, 0x5d172d8d, 0xedefed25, 0x00007c02, 0xfce6fca5, 0x9efaf3fa, 0xf91af9a6, 0x0000f1e0,
+        0xf38cf32c, 0xad338579, 0xd2f2d2e0, 0x0000d3f8, 0x390a39b2, 0xb192dba6, 0xb8d5b83c, 0x0000b831, 0x504750ff, 0x8f6546b6, 0x69a56929, 0x00007731,
+        0x24c62431, 0xac0d8629, 0xf1f7f1a8, 0x0000f070, 0x9efb9e3f, 0x1a41710f, 0xf618f6df, 0x0000d1db, 0xac14ac12, 0x8336b1a7, 0x7e407e65, 0x0000f321,
+        0x1fd81f5f, 0xee7d73d2, 0xb7abb7de, 0x000048dc, 0xfecffe64, 0xcf621141, 0x0b9a0b80, 0x00004d8b, 0x3fc43f09, 0x65505ac0, 0xcd15cdcd, 0x0000c02d,
+        0x4d044d75, 0x9cd392e4, 0x260d26c6, 0x00001216, 0x1f121fb0, 0xc2126b05, 0xcffdcf40, 0x0000c9ef, 0xf82ff8e2, 0x9ca604ca, 0xb001b0a2, 0x00007951,
+        0xcee5ceca, 0xdf9e74e4, 0x96bf96c4, 0x0000f95c, 0xe2d8e214, 0x752683cf, 0xf9e0f90d, 0x0000d62c, 0x87c087f0, 0x5f2fac36, 0x5e205eed, 0x00006790,
+        0xc829c88e, 0x35109c6c, 0xd305d3b4, 0x000030b3, 0x704e707d, 0xdbb0a7e7, 0x0f0a0feb, 0x00009614, 0x881788d8, 0x2edd94f8, 0x76b676fe, 0x0000f6bc,
+        0xcc42cc21, 0x8d47e1fc, 0x2c1e2c0c, 0x0000cf10, 0x4cef4c51, 0x7af6aa35, 0xb721b7c1, 0x0000d138, 0x31d6312e, 0x4c257256, 0xcf62cf73, 0x0000c012,
+        0xfc67fc10, 0x901c84ee, 0xc9b8c9c6, 0x0000e4e2, 0x98e09893, 0x4b36710e, 0xd604d680, 0x000004cf, 0xf0b7f00e, 0x37015aa3, 0x4d064d3a, 0x00000c99,
+        0xc931c9fe, 0x8ec7a907, 0xc434c453, 0x0000f632, 0x496d4938, 0xc6e27716, 0x8f5c8f83, 0x0000201b, 0x11af11f6, 0xb8b0dd6f, 0x458a4526, 0x0000b531,
+        0xd9dcd926, 0x9a9c5fac, 0xd6c8d638, 0x00006157, 0x71987131, 0x0a5e5473, 0x329232eb, 0x000074b0, 0x51785189, 0x7b6786cf, 0x38a238a6, 0x00004210,
+        0x943c94c5, 0xf47cf62a, 0x977197c9, 0x0000b48e, 0x566e56d7, 0x12710abb, 0xf5f4f5a8, 0x00004058, 0x99c4996b, 0x83a6b7e9, 0x13a713dd, 0x000022f4,
+        0xfa59faa4, 0xa6de5f8a, 0x9ab79ad1, 0x00003d72, 0x9cde9cae, 0x22a6a1a4, 0xc364c36e, 0x00002af9, 0x0fa80fa4, 0x0f0af7e7, 0xf421f4bf, 0x00007d72,
+        0x26ed26de, 0xd50e3bd5, 0xc42ac4a0, 0x00008218, 0xffa1ff64, 0xb4b47006, 0xf94ef9ed, 0x0000d8ea, 0x156c159d, 0xc88438f1, 0xfd26fd74, 0x00006047,
+        0x1b981bfd, 0x00a40770, 0x5aa25aac, 0x00006ad6, 0x6f306f35, 0x931cdf58, 0xb941b98d, 0x00006252, 0xefaeef1c, 0x7bf6d576, 0x68226838, 0x00007a60,
+        0xe8efe814, 0x4eb42abf, 0x12641220, 0x0000756c, 0x88e18812, 0xcf2a7f77, 0xd50ad504, 0x000025ea, 0x182b180d, 0x66d28333, 0x0904097e, 0x0000e233,
+        0x752175a3, 0x9a0af336, 0x6ca16c24, 0x0000cf2b, 0x8fdf8f21, 0xec83a454, 0x05fb056a, 0x000091f5, 0x62d562c2, 0x92061f53, 0x7f557f17, 0x0000e5ad,
+        0xbad0bae5, 0xd93cf069, 0x2751270d, 0x000030ed, 0xb63fb62e, 0x8c47b975, 0x8b398bfe, 0x00007557, 0x49e8492b, 0xf8f79955, 0x8f248f86, 0x00007560,
+        0x58e3585f, 0x85389829, 0x457b454b, 0x00004850, 0xc10ec187, 0x18689bd5, 0xbbaabbaf, 0x00003b0e, 0xdf91dfeb, 0xfd19e77d, 0x956e9599, 0x0000041c,
+        0x9bf29bdb, 0x87274feb, 0x54d4541f, 0x0000b94e, 0xeaddeadd, 0x0724a847, 0x81338130, 0x000021b7, 0x65386582, 0x23d0aa03, 0xdb66dba0, 0x00000c63,
+        0x7bf47b93, 0xfdfd83cf, 0x63616383, 0x0000de86, 0xbb04bb87, 0xe77c85d0, 0x8f848fbb, 0x0000ec15, 0x28e128ef, 0x9ae69378, 0xe311e382, 0x0000028c,
+        0x5ed75e48, 0x4de965a4, 0xc852c8e9, 0x00006730, 0xea11ea9d, 0xa7417b51, 0xfc0dfc0b, 0x00007a72, 0x68236894, 0x4936772f, 0x4d254d58, 0x000004a1,
+        0x17cb1781, 0xc6b4e0ec, 0x0316032e, 0x0000bf35, 0xd03dd0fd, 0xa57b103d, 0x53545323, 0x00005a3d, 0xf7cef779, 0x92065b8a, 0xae4dae80, 0x00004714,
+        0xbdfabd35, 0xf18eb7d6, 0xc264c217, 0x0000376c, 0xfb9bfbef, 0x02a51786, 0x2d012dce, 0x0000bdee, 0xba99baef, 0x5fddc9b7, 0xe771e735, 0x0000bd1c,
+        0xdde9ddc7, 0x711a2d71, 0x4b4c4b45, 0x000098d1, 0x8b378b64, 0x025aad2e, 0x9f589f57, 0x00008a9f, 0x43fb43db, 0x8f6ecdd7, 0x5e385ecc, 0x00000100,
+        0x5fb25f96, 0xa7ae08b8, 0x86648661, 0x0000aed9, 0x9e779ec2, 0x48062e67, 0x17c9173b, 0x00008d2c, 0x892e89ae, 0x89f73e37, 0x5f4e5fd5, 0x000049e4,
+        0xb15db175, 0x95c7b849, 0xfe70fe47, 0x0000b6f7, 0x339133ee, 0xc99a0341, 0xe746e71c, 0x00007153, 0x097f0936, 0xd1db7b9f, 0x4dbe4d58, 0x000040ff,
+        0xb32eb3f3, 0xb7b3f9c5, 0x570d5789, 0x0000aa09, 0x1bbd1ba9, 0xb9fb6050, 0x0f140f2b, 0x0000e539, 0xae14aecd, 0x45266985, 0xcae9cac3, 0x00000364,
+        0xd9c3d985, 0xf5e0430a, 0x33643369, 0x00002357, 0xf81ff82e, 0xc4f5824c, 0xb4b6b4ba, 0x0000b470, 0xedefed2e, 0xec833991, 0x45974536, 0x00008dd1,
+        0x789578e3, 0x33ab22a2, 0x621b6288, 0x0000c807, 0xeaadea2e, 0x7b7432e1, 0x455245b4, 0x0000175b, 0xb38fb3b1, 0x60219ede, 0xf94ef91c, 0x000006df,
+        0x67e76773, 0x68c65263, 0xe590e5ab, 0x0000d174, 0x69a9692e, 0x09353b01, 0x771577a0, 0x00009b8a, 0x089b08e9, 0xe567fb8c, 0x3b973bf5, 0x0000e951,
+        0xcca9cc20, 0x884ecbd9, 0x355035a1, 0x0000c934, 0xc302c38c, 0x07c4eab0, 0x8d588d47, 0x00002e5b, 0x63216378, 0xe85295e7, 0x324432f0, 0x0000902a,
+        0xb171b180, 0xbe62443b, 0xef57efe4, 0x0000512f, 0x0219023f, 0x9406be06, 0x155915d8, 0x0000db36, 0x81e2817c, 0xfd77a31b, 0xd98dd9c6, 0x00001aac,
+        0x1cbb1c5c, 0xa29cf0d4, 0x545a54a3, 0x0000b701, 0xdf00df25, 0x217b7ec2, 0x4a9a4ac0, 0x00003fbf, 0x0b330bd2, 0xdffc3f32, 0x5ea95e45, 0x00006ce1,
+        0xaf02afc8, 0x670dabde, 0x6b356b96, 0x000010b6, 0x196d1912, 0x165563c5, 0x013d0139, 0x0000be9c, 0xa79ba766, 0x05a49633, 0x2884283a, 0x0000902a,
+        0x757875aa, 0xb0bb0526, 0x8e2c8ed7, 0x00002589, 0x2a2a2a77, 0xec0094be, 0x8a008a15, 0x0000dbb6, 0x1c551c5e, 0x1efc6be5, 0x890f8961, 0x00007f0f,
+        0x8d308d41, 0x47dafb46, 0x9c539c51, 0x00007c9c, 0x85808529, 0xbb2b92e5, 0x27b02789, 0x0000e9c8, 0x54e0544a, 0xbe62311c, 0x103c102b, 0x0000a41b,
+        0xa1afa127, 0x91d7b554, 0x03360361, 0x00009197, 0x56b4566e, 0xd2a9b431, 0x596d59e8, 0x0000070d, 0x100f10cb, 0x356b88c1, 0x6885683e, 0x00008080,
+        0x1f641f2c, 0x99ec082a, 0xbebabe35, 0x000075da, 0xe1d8e1fd, 0xff36d970, 0xe175e1fc, 0x0000144a, 0x926b9254, 0xefd1c91a, 0x3f643fdb, 0x00003c8c,
+        0x067a06ad, 0xbc6d9955, 0xa611a640, 0x00007219, 0xf9f1f9d2, 0x36aa7567, 0xc5d4c587, 0x0000cd10, 0x17a81730, 0x55ff3e3e, 0x3d173d15, 0x00000ca5,
+        0x293c2957, 0x4af75ea6, 0x3f443ff1, 0x0000e344, 0xad97ad6c, 0xb6990658, 0x7580759f, 0x00007560, 0x62bd6269, 0xda043cff, 0x729b722c, 0x0000e403,
+        0x72a27277, 0xa733affc, 0x26f22662, 0x000088e4, 0xac76ac1b, 0x5acbdc7b, 0xe022e01a, 0x0000e4e2, 0x9ac39a59, 0xd8514446, 0x0e270e96, 0x00006636,
+        0x2d592db0, 0x1d12fa91, 0xe1f8e145, 0x00008142, 0x05980520, 0x6323071b, 0x5cf95c17, 0x0000e8d2, 0xccf3cc2c, 0x7b01464f, 0x8332832c, 0x000092d5,
+        0xd701d749, 0xe1520aab, 0xb8d4b837, 0x000015b6, 0x1766179d, 0xb1e0ab87, 0xb8cab86e, 0x0000423d, 0x953b957b, 0x07d8d7fb, 0x4c094c3e, 0x000028a4,
+        0xc0d6c03f, 0x8c604a62, 0x99bb9912, 0x00005774, 0xe7d0e778, 0xfc3d7ba9, 0xb168b1a4, 0x00001775, 0x55c0555c, 0xb9ccfef4, 0xfb16fb1e, 0x00007260,
+        0xdb44db26, 0x0bb40878, 0x292329c5, 0x00006f2b, 0x5478542a, 0x7afad3d4, 0x6b886b3c, 0x00002429, 0xd903d9a0, 0x013b8a26, 0x96289653, 0x0000b26a,
+        0xce17ce2c, 0xb666fdbe, 0x3e513eb7, 0x000052a7, 0x2df42d6a, 0x0a5c885d, 0xe433e4db, 0x00009290, 0xeb73eb4f, 0x002cf58c, 0xc592c535, 0x00000f78,
+        0x3da63d9b, 0x814736d1, 0xb5bfb570, 0x0000b8cd, 0x0ab70a69, 0xc83a42bc, 0x26612637, 0x0000ba8e, 0xa1e2a1fd, 0x1f4d10de, 0xad4aad44, 0x0000493b,
+        0xd42ed4c7, 0xbba95c7c, 0x05740596, 0x0000f84c, 0x6c096c5c, 0x83de72d6, 0x90d09088, 0x000070da, 0x9721973b, 0x14418987, 0xe929e966, 0x0000f982,
+        0x46f1466e, 0x36d875cf, 0x65e965ab, 0x0000504b, 0x5d175d19, 0x5d072226, 0x211d2156, 0x00006c2a, 0x3e543e57, 0xaf5aa88f, 0x5a585a91, 0x0000eba4,
+        0x2abd2a4c, 0x0ab4ddeb, 0x0d5c0d80, 0x0000c186, 0x297829ab, 0xd4f374e0, 0x733e73b4, 0x00001d98, 0x8bee8b8d, 0x3dc39f26, 0xf34af3de, 0x0000d755,
+        0xa3e5a377, 0xdd8b9a28, 0xafd3afc7, 0x00001c93, 0x6dcc6dba, 0x87bfaf8a, 0x646d6439, 0x0000e5d5, 0xfba4fba8, 0x0c442e21, 0x1318136e, 0x0000ec7d,
+        0xe89de815, 0xae51affc, 0xb4a6b4fe, 0x000080a2, 0x7bbc7b62, 0x35987bd2, 0x583e58b4, 0x000027df, 0x5b125b1b, 0x08133f4d, 0xc314c397, 0x0000de0b,
+        0xecacec53, 0xb41bb3db, 0x29012926, 0x000018b1, 0x991e9957, 0x3f72b707, 0xcb37cb3c, 0x00008925, 0x588e5860, 0x0419fc19, 0xb228b204, 0x000039ed,
+        0x63a1630d, 0x25202a3d, 0x05ff05e0, 0x0000a21d, 0xbf73bfa6, 0x4a17e6bd, 0xa7caa72f, 0x00006f14, 0x4cc54cc5, 0xb0bbdba5, 0x435843af, 0x0000a0e4,
+        0x703f706e, 0x0124c743, 0x1ce31ca0, 0x000094e0, 0x6194617e, 0x2531833f, 0xff5aff4d, 0x0000fe52, 0x7bad7b10, 0x58297a76, 0x0abc0a93, 0x0000a028,
+        0x4fe94fa2, 0x0c0a74d9, 0x5b155b24, 0x0000ea7e, 0xfc71fca8, 0xd8525f1a, 0x8449849d, 0x0000da1a, 0x933f93c3, 0xe0206eb1, 0x167a1664, 0x0000ce07,
+        0x6d366d2e, 0x54207519, 0x535e533f, 0x0000d387, 0xc7aec740, 0x33385ae0, 0x89b689d5, 0x00003768, 0xa116a1d1, 0xa88151c2, 0xae92aebe, 0x00009ac0,
+        0x92ef92f0, 0xf8aac6e1, 0x0aca0a2b, 0x00004caa, 0xf525f5d0, 0xa8c2e45d, 0x3ab53aaf, 0x00003c8c, 0xea0deab9, 0xa63e7cff, 0x11bc1126, 0x0000330b,
+        0x121c1201, 0xb5030e0c, 0x18631826, 0x0000d088, 0xcce6cc54, 0x639e86f0, 0xdb49db92, 0x00004546, 0x91df91b5, 0x4ad59ea5, 0x0d250da6, 0x00004467,
+        0x66936655, 0xa11138b1, 0x1c761c02, 0x00006935, 0xe3b1e3fe, 0xd5ca16b4, 0x1b181b3a, 0x00004012, 0x1c5b1c0e, 0x6326a0f1, 0x76077624, 0x00009a90,
+        0xb6c7b682, 0xf8aa7d7e, 0x293329ad, 0x00004e6a, 0x8bc08b92, 0x45a6023a, 0x03b50364, 0x00002d0a, 0xdc15dc91, 0x7412631c, 0x871a879b, 0x0000a8c8,
+        0x856a85a0, 0xddf50406, 0xf958f9f4, 0x0000da6d, 0x53745373, 0x6d60a4ac, 0xe953e957, 0x0000df89, 0x9bd89b04, 0xf2f4ee81, 0x03d2036a, 0x00004bf0,
+        0x5103517b, 0x15da34df, 0x4dcb4d8b, 0x0000df67, 0x7fa87f15, 0x3d32d509, 0x375937fb, 0x00009197, 0x6938691d, 0x692eac65, 0x5c035cb7, 0x00003b10,
+        0xfe58fe26, 0x7c6dbd4a, 0x231d2309, 0x0000815f, 0xbd47bd18, 0xf457f7d4, 0x77e07701, 0x00002633, 0x3f563fde, 0x9616f373, 0xea82ea44, 0x0000a5b4,
+        0xbe2cbe5a, 0x6e22311f, 0x7ba87b0f, 0x0000ceaa, 0x2270222d, 0x86c82946, 0x86c6867c, 0x00007943, 0xe7e1e79f, 0x2f21f8f9, 0x01c6016e, 0x0000316b,
+        0x458b45c2, 0x799b0850, 0xb8aab8c0, 0x0000819c, 0xb46cb4c3, 0xd97bbc35, 0x4c0a4c87, 0x000099a7, 0x2c7c2c39, 0xb1ad074b, 0x59df594d, 0x00005367,
+        0xbf6bbf5a, 0x866a9d75, 0x144514dd, 0x00001c92, 0x2aad2aa6, 0xbd8bb4d5, 0x56d1561c, 0x00002f19, 0x38b038d0, 0xa3c286cf, 0x8fe28f0c, 0x0000a0e9,
+        0xab40abdb, 0x70e2eed4, 0xbd91bd29, 0x00000f2c, 0x29c12954, 0x3ccd6e17, 0x65e86584, 0x0000748e, 0xbf01bf7c, 0x7e54ddeb, 0xfe93fe7e, 0x0000709a,
+        0xcb2bcb4a, 0x6ec2702c, 0x866e8678, 0x000062f6, 0x80e180ce, 0x98ec4038, 0xe58ee511, 0x00003454, 0x3a5e3a27, 0x5c92bd88, 0xe5f0e5b1, 0x0000c012,
+        0x9e379ecf, 0x6e7daf4b, 0x596d5996, 0x00001c88, 0xc573c5d8, 0x7dad59cd, 0x734273f6, 0x000037cf, 0x95449561, 0x4229dc97, 0x7d667dc7, 0x0000fd23,
+        0x00a40072, 0x87386f84, 0xb830b8e7, 0x00009b16, 0x7fd07fc7, 0xd7e4a4ab, 0x4f6c4f41, 0x0000fb53, 0x897d8992, 0x38dfd136, 0xe7c6e7d3, 0x000057bb,
+        0x43f6437a, 0x3031e98f, 0xd89bd826, 0x00004acd, 0xe576e502, 0x7c019a55, 0x906d9078, 0x00003caf, 0xd34cd3ac, 0xcc7aa72f, 0xd137d1d9, 0x00002289,
+        0xf7daf7fc, 0x2592756f, 0x963996e8, 0x00002988, 0xafd8af67, 0x2052204b, 0x02370211, 0x000037a0, 0xd553d569, 0x6b00f45e, 0x24112460, 0x00006996,
+        0x96de9651, 0x9d918fa0, 0x867b8692, 0x0000a0e9, 0xd20dd241, 0xffcf8ede, 0x4e484edf, 0x000061d0, 0xeabcead6, 0x2116f6eb, 0xb4dab447, 0x00000205,
+        0x985c9822, 0x701ac18a, 0x84cf8498, 0x00004311, 0x9597952d, 0x6a1c3cb9, 0xef55efe1, 0x000058df, 0x545b5440, 0xa85102f6, 0x0abd0a30, 0x0000450d,
+        0x9fca9f6e, 0xe2c14d02, 0x1118112e, 0x00003c56, 0x173f17c0, 0xc2965923, 0xba5cbaad, 0x00002ea4, 0x0c9d0c9a, 0x3c1903ca, 0xa8e8a8de, 0x0000f293,
+        0x76577604, 0x7ee30e8a, 0x76c77699, 0x000074b0, 0xbac2ba11, 0xf877ee7d, 0xf7d1f78f, 0x0000d815, 0xdd4ddd3f, 0x00c4dae5, 0x5705574f, 0x0000eeb4,
+        0xe685e672, 0x1b159bbe, 0x3edd3ece, 0x00007931, 0x8ee88ecb, 0x6d602df8, 0x21682185, 0x0000ede2, 0x13c01359, 0xf757a687, 0x4480443f, 0x00006fea,
+        0x3fb73f79, 0x93b3b3db, 0x10ad1099, 0x0000f654, 0x58675800, 0x0e0a833d, 0x77627729, 0x00002d35, 0x594359f2, 0xe0f15b5c, 0x897e8987, 0x000083cc,
+        0xdd4bdd84, 0x1fb551b2, 0x635d63b9, 0x000080a2, 0x631d633e, 0xd52f585c, 0xbb54bbe1, 0x0000d955, 0x2bdb2bd6, 0x8e78c75a, 0xdb85db93, 0x00006217,
+        0x70fe7068, 0xf10ee6d2, 0xc3b4c3d9, 0x0000180c, 0x87c4874c, 0xfebeca6e, 0x9a539aaa, 0x00009c02, 0x644c64cb, 0x2912992a, 0xcc7bcc32, 0x00007ea3,
+        0x8e5e8ec8, 0xea20fc40, 0x2ae52ad1, 0x00004d0d, 0xe0b8e057, 0x616f4dad, 0x33763362, 0x000084c7, 0x4d354dc9, 0x9391765e, 0xbd47bd20, 0x00005624,
+        0x5ff75f70, 0x4278f157, 0x4ea24e68, 0x00001cf5, 0xa916a91a, 0xb0bdfefc, 0xe289e200, 0x00000ebc, 0xa531a5d3, 0x93b3de6f, 0x174017d2, 0x0000bcbb,
+        0xdba9db7f, 0x2ea3a654, 0x7f2f7f58, 0x0000a2fb, 0x31bc3150, 0x87bfc6c3, 0x591f5975, 0x00002aa4, 0x60e76070, 0xf9cebb56, 0xfc35fcf6, 0x00002c57,
+        0xb75bb769, 0xed7054ce, 0xf319f386, 0x00009886, 0x7bdc7be7, 0x1ab03f4e, 0x0f290fe2, 0x00007770, 0xc2e3c231, 0x8d4413e6, 0xd742d71c, 0x00001c1b,
+        0x3142318e, 0x594db715, 0x794b794c, 0x00007920, 0x102d1077, 0xc9f566db, 0xd958d95f, 0x00000362, 0x81518157, 0x0f045e7c, 0x93559357, 0x000099e0,
+        0xc316c37a, 0x82c80c5e, 0x6e026e4f, 0x0000424f, 0xa7e6a7d7, 0x76a89895, 0xf33ef318, 0x00006b35, 0xde2edec4, 0xd8ab071e, 0xca6acab4, 0x00007f0f,
+        0xf834f825, 0xebee2912, 0xa965a969, 0x00004525, 0x442a44f4, 0x691ccb11, 0xf92ff9ba, 0x0000574a, 0xc1f3c102, 0xcc7a91ef, 0xcb13cbc3, 0x0000ceaa,
+        0x28ec2826, 0xdd8a033b, 0xf91cf989, 0x000018e3, 0xceddce49, 0x12fca44c, 0xa420a46c, 0x00003bed, 0x5b285b62, 0xbd687f45, 0x8967898c, 0x00009782,
+        0x95bd95a1, 0x4726b8a7, 0x3af93a08, 0x0000c8f0, 0x7ada7ac4, 0x4e365fd2, 0xe043e002, 0x000044ee, 0xfb45fb44, 0x97dc0b97, 0xc4fdc4b0, 0x0000eeb4,
+        0x4e364e9b, 0xd03a4c9f, 0x484e48f5, 0x0000fb7e, 0x33de33a4, 0xcefa891b, 0xa128a1a8, 0x00005c50, 0x01c0015d, 0xef0e03c8, 0x0f340f29, 0x0000081c,
+        0xdb2bdb88, 0xe7912c99, 0xb4a7b4df, 0x0000825f, 0x04470431, 0x1c8be802, 0xed40eda7, 0x0000d8b7, 0x833e836e, 0xbda9e5e2, 0x84cc84b1, 0x00000b63,
+        0xfb8bfb0a, 0x012bf4dc, 0x2ff22f1f, 0x00003913, 0xb9e6b9ed, 0x5e6abec9, 0x164616f2, 0x0000e703, 0x03dd0322, 0x02d31ea7, 0x16f21693, 0x00004ea9,
+        0x26db26b9, 0xeadc25a9, 0xf5a5f512, 0x0000cf7f, 0x0ff70f67, 0xb0b849f6, 0xe448e407, 0x000052d4, 0xaa38aac4, 0x53c61a2c, 0x476a475e, 0x0000eb29,
+        0x34c734d3, 0x1a1ff725, 0xef39ef4b, 0x0000ae75, 0x0f100f95, 0x81871f53, 0xc6eac655, 0x000040e6, 0x43e84352, 0xb392c2c3, 0x415541dd, 0x0000a564,
+        0x9b779bba, 0x98ecb7a4, 0xe902e942, 0x0000e184, 0xe0e6e0f1, 0x85372254, 0x01380122, 0x000078a3, 0x57eb57c5, 0x43f6cad7, 0x4e8f4eb4, 0x0000a58b,
+        0x91c6915d, 0x236e9f6a, 0xb78fb743, 0x0000608b, 0xb1bfb12d, 0xc79dbb39, 0x0b930b99, 0x0000e672, 0x22d622fb, 0xb4ebff3b, 0x8f258ff2, 0x0000d8fe,
+        0x12ef128a, 0xdfe4c387, 0x4d4d4dbd, 0x0000722e, 0xcbd8cba4, 0x0ca5b3d8, 0x003e0030, 0x0000c7cf, 0x114e1155, 0x6bc230a4, 0x3b443bfd, 0x0000f8ad,
+        0xffa4ffac, 0xe563f0ce, 0x803980fd, 0x0000dbea, 0x29562968, 0xd0b4e6f5, 0x2d7b2d67, 0x00009e79, 0xf068f0f9, 0x23d2675a, 0x081d08b8, 0x00009daf,
+        0x84288473, 0x09b30136, 0xd9d5d986, 0x000062c9, 0x0d1a0d4e, 0x85a6554f, 0x4e384e1e, 0x00004fb0, 0x6d436def, 0x5e2d8bbe, 0x0a0c0aa1, 0x0000bb91,
+        0x99f09961, 0x72e541fd, 0xaf18af2f, 0x0000d9ad, 0xd3cad30c, 0xefd3ae5f, 0x1c651c5b, 0x0000c8a1, 0x67936745, 0xf4ae0955, 0x0982098d, 0x00008e61,
+        0x84af841c, 0xb92c03c9, 0xf588f5cd, 0x0000b705, 0x8957891e, 0x06fabbea, 0x350735fa, 0x00006aca, 0xeb4febf2, 0x754d8d81, 0x7ff47feb, 0x000002cf,
+        0xb604b6f4, 0x14ef391d, 0x22582204, 0x0000a6b4, 0x37613745, 0x195ed192, 0x4966498f, 0x00005e54, 0x0acb0a12, 0xb67ab619, 0xbf87bfe1, 0x0000f362,
+        0x243624cc, 0xf2aeb1f8, 0x2d4c2d2b, 0x00009c01, 0xddc7dd41, 0x48ee95be, 0xc793c733, 0x00009ed8, 0x91889182, 0x077bbf87, 0x4c314c06, 0x0000c5f7,
+        0x271b27b7, 0x8537c1c3, 0xbb73bb24, 0x0000a277, 0x19161944, 0x5a4fc86e, 0x4f6b4fad, 0x00005798, 0x35ff35f5, 0xd0a467db, 0xf0b0f0ae, 0x000077d1,
+        0xa728a76f, 0xff3cfe46, 0x046b04f3, 0x000004dd, 0x44e8440e, 0xaf514c82, 0x638d638e, 0x000056a6, 0xbd0cbdc5, 0xec6f450d, 0x7f167f83, 0x000086a2,
+        0xef38ef0c, 0x4af6e721, 0x465f4622, 0x000016e8, 0x463646d7, 0xc4554719, 0x05f905a4, 0x0000adfb, 0x9a479ab2, 0xd41ea988, 0x08960858, 0x0000ef24,
+        0x8cfb8cea, 0x980effac, 0x1b651b8e, 0x00000cdd, 0x130c1372, 0x97fc7e3d, 0x041f04c0, 0x000047c7, 0x0fb60f74, 0x9ccaed32, 0x86f786fa, 0x0000b105,
+        0xca87ca46, 0x4316d487, 0x05e905f5, 0x00008f5f, 0x5c385c1d, 0xc2159a33, 0x7d127d82, 0x0000bf6f, 0x21ed21d0, 0xbd53e7c2, 0xa081a035, 0x00002c58,
+        0x4fe44fa7, 0x95cac245, 0x3a3e3af0, 0x000058b0, 0xc2c8c282, 0x8b78121d, 0x60e060b3, 0x00008934, 0xc1cec1c5, 0x095d68ca, 0xf81bf832, 0x0000a7b5,
+        0xcd7dcd45, 0xa561ca33, 0x054a05df, 0x0000d71d, 0x46294624, 0x2e9cba47, 0x274427f0, 0x0000f45c, 0x4c8c4c16, 0x2ec09b33, 0xebdbeb6e, 0x00004eb6,
+        0x515651e8, 0x2db91edb, 0x606c6004, 0x000091f4, 0xe2fae280, 0x8fda08d9, 0x75a2751e, 0x00005c2b, 0x40d24069, 0x2e53c3fc, 0x34753463, 0x00005584,
+        0xeeb0ee74, 0x1c4e3dce, 0x822d821c, 0x00008d71, 0x5da25d6d, 0x262fefb3, 0x979597eb, 0x0000376e, 0xdcbadca9, 0xc3d6858f, 0x3f893fb8, 0x0000dfa5,
+        0xabadabb3, 0x41e4e8cc, 0xde33de95, 0x0000f26a, 0x5db65d5f, 0xcf24118b, 0xc87cc88b, 0x0000a17e, 0xedeced7e, 0xbd7480f0, 0xb628b6d1, 0x000009f8,
+        0xbad1ba68, 0x81aabf94, 0x78a4781b, 0x00006815, 0xcd1ccdd7, 0xa881d51c, 0x82e7826f, 0x00006b00, 0xe43ce4fc, 0x7d2be32d, 0x48dc4860, 0x00004715,
+        0x4ad04ae9, 0x4afae213, 0x10e61098, 0x00000b1e, 0x5ed65ebb, 0x9c06ef93, 0x0180016e, 0x00005d99, 0x55a355de, 0x94aed34a, 0x9e0c9eb7, 0x0000ce8f,
+        0xa4f9a426, 0xd46b1851, 0xc436c4d3, 0x00009e46, 0x6d346d82, 0x138fb61f, 0xfea0fe7f, 0x000070d3, 0x4e974eca, 0xb7bb05b5, 0x4e6d4e3e, 0x00003dfd,
+        0x6a636a63, 0x75486bc5, 0x630d630e, 0x000069b7, 0x37d0373a, 0x00cf785f, 0x6bec6b54, 0x0000abd9, 0x4d5c4de6, 0x609e40ed, 0x87cc8771, 0x00008bbe,
+        0x899d8969, 0x7c8ebc07, 0x3813386b, 0x0000f60d, 0xcfe0cfa6, 0x0f6b19b3, 0x465b46b3, 0x0000d0f8, 0x0c270cd4, 0x383a8edc, 0x5ab35a56, 0x0000faa0,
+        0xa463a426, 0x70cd65e5, 0xf0a4f05a, 0x000098d1, 0x9109912c, 0xc5da8911, 0x6ea36e65, 0x00002d45, 0xf1e3f186, 0x6101f3ae, 0x042d04e3, 0x00004c12,
+        0xdda3ddec, 0xac20dc60, 0x47a347d6, 0x0000d0eb, 0x492049d9, 0x92e39d5f, 0x8c238c23, 0x00001721, 0x51c551a7, 0x2b3d6e2b, 0xbf4cbfba, 0x0000730f,
+        0xc576c544, 0x6ea03adf, 0xfe7efec6, 0x00003445, 0xb483b47c, 0x4e369c63, 0xdce2dcf3, 0x00004ca9, 0xe556e52b, 0xb128f3ad, 0xa13ba155, 0x0000a51e,
+        0x715171be, 0x6845f832, 0x081508f5, 0x000088b0, 0x0923091e, 0x9e567b2f, 0x8c3f8ca2, 0x0000c4cd, 0x8ad48a65, 0xae1af940, 0x4c974cbd, 0x000073cd,
+        0x4c894c83, 0xc15da0a9, 0x392439bd, 0x0000e232, 0x5e5a5e7b, 0x3e604714, 0xf038f0a1, 0x0000dd1f, 0x36ec362b, 0x83b67e86, 0xbb7ebbe8, 0x0000b354,
+        0x3f273fd4, 0xfd830136, 0xcafecab1, 0x0000db67, 0x79107985, 0x180abbea, 0xc6e5c6a9, 0x00000cca, 0x41fc41fc, 0x9eed2a6c, 0x633b6356, 0x00009cf6,
+        0x75fa754f, 0x6af01189, 0x2fc42f67, 0x00005054, 0x151c15ff, 0x18099161, 0x2afa2a45, 0x0000c9f7, 0xd8f0d8e1, 0x0834b5a0, 0x2cad2cf0, 0x00003ed3,
+        0x1ed91e46, 0x69deadac, 0x85e18531, 0x00009f71, 0x54ca5445, 0x9b2c16aa, 0x814e81fc, 0x000037ab, 0x33733375, 0x1877bdd8, 0x46204625, 0x0000ff62,
+        0x57f157db, 0x5f2210bc, 0xdb76db77, 0x0000648b, 0x96a196d1, 0xfd3d3bf2, 0x3af93a46, 0x000021b7, 0x6a596a90, 0x6b4e315f, 0x33763323, 0x0000f4b4,
+        0x6e3b6eec, 0x049662ca, 0xc9b8c9fc, 0x00006d17, 0x902e9038, 0x6e9feccc, 0xbf67bf23, 0x00004012, 0xba5eba31, 0x6251ced8, 0x50b950f7, 0x00008c1c,
+        0xfbc6fb9c, 0x2aa3a052, 0x2bfc2b5a, 0x00000c1c, 0x4679460f, 0x81c9a021, 0x21af21f4, 0x00006c67, 0xb700b7d2, 0x5ece6c34, 0x90ab902c, 0x0000c8b2,
+        0xb1bab15a, 0x3919f8bd, 0x42a742d0, 0x00007331, 0xefc4efa1, 0xf63d2f39, 0x40044057, 0x00005036, 0x87da87cb, 0xcc45ae98, 0x3b7f3b96, 0x0000edd4,
+        0xdf95dfeb, 0x20c60486, 0x8c6f8cf5, 0x00003206, 0x50d050ff, 0xd1048f5c, 0x758575a6, 0x00002b75, 0x83e08339, 0x26a2b2a5, 0x828a8296, 0x000056b8,
+        0x55265594, 0x9cbdef1c, 0x14381460, 0x0000111a, 0xfe03feb3, 0x746d15fe, 0x858785b8, 0x000081d0, 0x271a27f7, 0x218386c1, 0x23162364, 0x0000f290,
+        0xb97ab9bf, 0x9274bb86, 0x35253567, 0x000096d5, 0x47534749, 0x98dd1c32, 0x01aa0144, 0x0000cdf1, 0xc591c52f, 0xc31d2b8c, 0xf826f86d, 0x00003552,
+        0xa803a856, 0x270fd579, 0xe30ee3a7, 0x00007870, 0x936c935d, 0x911c93c7, 0x1d1b1d72, 0x000099a8, 0x94fd94bb, 0x349a18ac, 0x0c830c31, 0x00007fb0,
+        0x6e286e7c, 0x89472054, 0x3263324e, 0x0000b83e, 0x304330dc, 0xa401dcc4, 0xa88aa84c, 0x0000c90a, 0xe992e9ea, 0x918e5fe3, 0xf404f436, 0x00000c63,
+        0x84a0847b, 0xf75a9c63, 0x8a2d8adf, 0x0000813d, 0x9e339e7d, 0x8336917f, 0xb275b299, 0x00006b96, 0x07450714, 0x3210152f, 0xb8c3b83b, 0x00000483,
+        0x13861376, 0x12f99f27, 0x8c188c68, 0x0000e67b, 0x64a76429, 0x30f6be07, 0xff97fffc, 0x00009c0e, 0xc6b5c6e5, 0x3b56908e, 0x525052a5, 0x0000a28b,
+        0x126e1245, 0x256d363f, 0xf234f26b, 0x00004ca8, 0x3dd93d33, 0x0cd79504, 0x827c823f, 0x00006d22, 0x01c701d6, 0x8d57813f, 0xc9b7c9bd, 0x000041e4,
+        0xd734d7fd, 0x9528856f, 0xb651b69a, 0x0000a84e, 0xe6a4e67b, 0x6881e594, 0xdef5de4c, 0x000020e5, 0xa302a351, 0xde543752, 0x739b73d1, 0x000097bd,
+        0xfc98fcfc, 0x2da27a3d, 0x31c43122, 0x00003bfa, 0xaae7aa75, 0x80e8caa7, 0xc4c6c4d6, 0x00009a90, 0x1fd21f87, 0x63dd12fe, 0x03dc0341, 0x0000d30b,
+        0x3e673ee3, 0xbd1b669b, 0x80348044, 0x00005384, 0x0adc0a37, 0x997a4760, 0x96929629, 0x00001e56, 0x89168966, 0xd254af0b, 0x860c86de, 0x0000479f,
+        0x39f43936, 0xa0832d21, 0x04b00487, 0x00009d14, 0xdd73ddbf, 0xc52527a9, 0x104210f8, 0x0000e17b, 0x68736893, 0xe8500434, 0x236c23e6, 0x0000ad4b,
+        0x96de9656, 0x02a5bcc9, 0x918d9142, 0x00002b32, 0xcdddcdf6, 0x512ad8e4, 0xb17ab19d, 0x0000a285, 0xea44ead7, 0x452e05d9, 0xf4c4f4d9, 0x00007051,
+        0x9ee89eac, 0xc99a2a04, 0xc75cc725, 0x0000edd6, 0x620062ae, 0xeb53d74b, 0xc83ec8c3, 0x00008f5f, 0x2e1b2ec1, 0x54a70beb, 0xbe14be2e, 0x0000afe9,
+        0xac47accd, 0xcc7a710f, 0xf458f42f, 0x0000ac2e, 0xd07ad002, 0x78cd9bae, 0xef53efec, 0x000095a2, 0x39cc39a3, 0x0b557418, 0x33f93308, 0x000039ec,
+        0x3b293b63, 0x2f29e7e2, 0xea57eaf2, 0x00003a64, 0x1a661a30, 0x7d28a1d1, 0xfe95fe77, 0x0000eb94, 0xb8a9b890, 0xfb034969, 0xad6dad99, 0x00002a67,
+        0x16cf1648, 0xdfc094f4, 0xf816f81c, 0x00001d03, 0xcdf6cdeb, 0xf7aeaa00, 0x9f259f34, 0x00002b3e, 0xa9e6a9fa, 0x60228b3f, 0x1fa61fd5, 0x0000289b,
+        0x87548716, 0x049bc07d, 0xd10dd13b, 0x00005dfd, 0x04f00435, 0x7bdd9827, 0x8f598f45, 0x00008c67, 0x2b2a2b77, 0x620cae4a, 0xa3e7a309, 0x0000d5eb,
+        0x85fb85e4, 0x890ab1e6, 0x86058629, 0x00006730, 0xacc8ac39, 0xd9353a22, 0xd93bd904, 0x00007160, 0x6c9c6c63, 0xe61ee124, 0x81a281aa, 0x0000d2c3,
+        0x91dc91b4, 0x02c6dbdb, 0xd3d0d377, 0x00000503, 0x46eb46ee, 0xc085d6f5, 0xcda3cd91, 0x00007e03, 0x12dc128d, 0xa8fd27ac, 0x2a132a39, 0x0000948a,
+        0x0f270f2d, 0x7e551e1b, 0x2d122d7e, 0x0000a2c6, 0xd368d32b, 0x4c5fb8b5, 0xf8cef806, 0x0000a419, 0xe8cee8b0, 0x16552c12, 0x41aa41df, 0x0000feec,
+        0x74c37479, 0xf9ab5920, 0xd8e5d851, 0x0000a8cb, 0x344334fd, 0x4b7df0d7, 0x543f5483, 0x000092d5, 0xf049f0a8, 0x1acb3511, 0xc553c5b4, 0x0000aba7,
+        0x830c8305, 0xed86ce90, 0x12f01203, 0x00009aae, 0xcc1bcc1a, 0x4b07a35d, 0x034003e9, 0x0000c4c5, 0x8c238c9e, 0xee1361e9, 0xf049f0d0, 0x00009e46,
+        0x966296d0, 0x2aa29127, 0x627762bd, 0x00005df7, 0x5ae05a43, 0x5acb9433, 0x4a734a1e, 0x0000f718, 0x67a26769, 0xae33a6d4, 0xdcfcdca2, 0x000013c7,
+        0x98099834, 0xc8451851, 0x1ba21b92, 0x0000a84a, 0x2dbc2d69, 0xf2cfcad9, 0x9ca79ca0, 0x00008e60, 0x7650760c, 0x74562359, 0x398e3907, 0x0000b19a,
+        0xaad1aabf, 0x97ab585d, 0x556f5588, 0x00008d2c, 0x744974f3, 0x6603aa47, 0x654b6541, 0x000089f2, 0x2e132e71, 0x11bcc3be, 0xb3bfb3fa, 0x0000ddeb,
+        0x757975ac, 0x38d5de28, 0xc823c8fb, 0x0000c26d, 0x26a3263c, 0xaab8f37d, 0x6c556ced, 0x0000eabf, 0x374337c8, 0xd93c2e42, 0x1be91ba1, 0x0000cb8d,
+        0xbc9cbc5a, 0xd3bb9362, 0x968996e6, 0x0000de5b, 0x013f0138, 0x08f5fdb3, 0x161b163b, 0x00001acb, 0x88ea88f1, 0x64f05805, 0x39293998, 0x0000ed16,
+        0x443744c8, 0xc8455eae, 0x2e5b2ecb, 0x00002c66, 0x10e41025, 0xaccc4f6e, 0x5ee45e31, 0x00007dae, 0xa1aaa1e7, 0xda9461b9, 0x297129c1, 0x000023a4,
+        0xc7eac74d, 0xb003f156, 0x5b845bad, 0x0000bce4, 0x5ade5a65, 0x5bf90148, 0x7ff57fa9, 0x0000fd62, 0x1fc81f8b, 0xcb97a1d9, 0xc30ac357, 0x000039ad,
+        0x2b612b6c, 0x26237bc2, 0x2b4c2be2, 0x0000ad07, 0x18551854, 0x1bf9712f, 0x2f812f30, 0x00005579, 0xb526b5bc, 0xc4577e2f, 0xb294b222, 0x00000f63,
+        0x252d25d7, 0x865e9dea, 0xa05ea059, 0x00000ab3, 0x13cf1374, 0xc7e1ade0, 0xeafeeaa3, 0x00005209, 0x7dd07d42, 0xcfa16bf5, 0x2e382e8a, 0x0000aadf,
+        0x68b3684c, 0x734a42c7, 0x9b679be0, 0x00009615, 0x7db77db0, 0x60eb40f3, 0x626b62db, 0x00007870, 0x902190aa, 0xe718c5e1, 0x4c814cc4, 0x00006ea1,
+        0x5b4c5b61, 0xeef2bcb2, 0x6013602b, 0x000081d1, 0x13f21307, 0xdfd665e7, 0x26f52619, 0x00005f27, 0x102b10f2, 0xf9d39163, 0x2afb2a1d, 0x000019b2,
+        0x8f488f67, 0xf3493591, 0x941f945e, 0x0000ae85, 0x3b073b9d, 0xd3ff7650, 0xffa4ff77, 0x00006168, 0x8f168fd8, 0xfb9b1afc, 0xc631c6ca, 0x00001695,
+        0x0558056d, 0x8639f5b0, 0x600d6066, 0x0000c39c, 0x2ef32ebe, 0xb0bcbef8, 0xf74cf7ad, 0x00001c17, 0x174e172d, 0xef5289ef, 0x1d401da0, 0x000014e3,
+        0x5543551a, 0xbf741955, 0xfaa8fa90, 0x00004804, 0x586758c6, 0x83dc59e3, 0x2a1c2a1e, 0x0000b77d, 0xbdbbbde5, 0x72974dae, 0x672167fb, 0x0000cfe4,
+        0x76c37640, 0xcf3a5ae0, 0x31fe3109, 0x0000352f, 0x36a536c3, 0x0566104d, 0x80a28098, 0x0000ea45, 0x0bed0be1, 0xaf5a153e, 0xb267b2f4, 0x00004b10,
+        0x2956292a, 0x326f2abf, 0x429c4255, 0x000001bc, 0xaddfadf7, 0xdf1d72d1, 0xf0aff01b, 0x0000845f, 0x383038ce, 0x59cb252b, 0xcb52cbee, 0x0000377c,
+        0x09270986, 0x66f0bf77, 0x7dfb7d28, 0x0000e232, 0xbc26bc6d, 0x2b12246e, 0x570e5745, 0x0000bcf2, 0x0bfe0b69, 0x96f1fe03, 0xafc2af9d, 0x000037f0,
+        0x01010156, 0x00c5a0a9, 0x9c119c5a, 0x00003640, 0x52e152a6, 0x5590a4ae, 0xbb03bba9, 0x0000c707, 0xbf23bfd0, 0x024561bb, 0x2dbd2d6d, 0x00001416,
+        0xa637a678, 0x4af7363c, 0xff6effab, 0x00001075, 0xfcbcfcdc, 0x0934d06a, 0x16e416e6, 0x00001c44, 0x94df9496, 0xce083e4c, 0x9bc09bc9, 0x00001333,
+        0x03e40397, 0xc3d60ca5, 0xff37ff43, 0x0000ab08, 0x1d651d65, 0x3c462804, 0x9ef99e18, 0x00006dff, 0xe188e179, 0xc55c650f, 0x3b733b7a, 0x0000f26a,
+        0xc58dc505, 0xf8773876, 0x08f008b8, 0x0000f4f9, 0x1c371c5a, 0xd08bb0d8, 0xcf04cf0e, 0x0000ad98, 0xf2d4f228, 0x6f8f57cd, 0xea46ea06, 0x00004e8f,
+        0x1bbc1b9e, 0xad5e30ee, 0x61b561ea, 0x000019da, 0x72de727d, 0x31d1d824, 0x1aaf1a6c, 0x000062af, 0xbc85bc8d, 0x89473729, 0xead8eacc, 0x00005daf,
+        0x51195156, 0x9ed4a940, 0xa232a2cb, 0x00001e4c, 0x907290f6, 0x74cd3a30, 0x579c5724, 0x00005a54, 0xb1beb1dd, 0xf0f77591, 0xc674c676, 0x0000a13c,
+        0x88cb88ce, 0x255d0f00, 0x0ed80eea, 0x000051d8, 0xf1cff1cf, 0x086b49a6, 0x4867483c, 0x0000ee16, 0x5d505d46, 0x430ef536, 0xa47ca431, 0x0000092c,
+        0xcea3cec8, 0xf42e18d1, 0x9f019f82, 0x00006478, 0x0ab80a5b, 0x9d59a887, 0xcf66cf9d, 0x00008def, 0x69b16945, 0xa31dd6cb, 0x31703122, 0x0000affa,
+        0xfbcbfb35, 0x1e6495fe, 0x79fe79e4, 0x000050a6, 0x602b607b, 0xc017a42f, 0x796779ec, 0x00003523, 0xd333d3fd, 0xab14fe0b, 0xa353a342, 0x0000ecc8,
+        0x00d50037, 0xb2a3f9da, 0x470c476d, 0x0000488f, 0x5e4a5e9f, 0x4fa70c59, 0x3f093f0a, 0x000052ca, 0xbde9bdba, 0x0015911c, 0x5d455d77, 0x0000f73c,
+        0x4f754f56, 0x567492bd, 0xe528e5b2, 0x00000b6a, 0x195019ec, 0x753beaf3, 0xa454a4f5, 0x0000f7d8, 0x55cb55e9, 0xf9f4c084, 0xbd96bd26, 0x000028fd,
+        0xcf6bcf18, 0x0b272163, 0x7b607b59, 0x0000df88, 0xaa33aa45, 0x0cc27bbf, 0x43d24325, 0x00004620, 0x56ce560b, 0xcd4cd2c8, 0xdf4cdf93, 0x00008060,
+        0x094b0921, 0xbc8b578e, 0x8a3f8a59, 0x0000ea37, 0x561156a8, 0x36cf7dc1, 0x18e9187a, 0x00001e87, 0x5ea05e5c, 0xed1034ee, 0xf9f1f9b3, 0x0000e42b,
+        0x486848b3, 0xae0d80e1, 0xc384c3da, 0x00009d31, 0xe17ce13b, 0x61502e32, 0x7e3c7e06, 0x0000180c, 0xe0afe018, 0x88580030, 0xb224b23c, 0x000098d1,
+        0x313431f3, 0x96cb800c, 0x34d6340e, 0x0000003a, 0x5c335c5d, 0xdeb4b8a6, 0x9018908b, 0x00002e9b, 0x6fec6f72, 0x5e4306ca, 0xf14df115, 0x0000fffd,
+        0xb717b77a, 0xaa331d52, 0x985398f3, 0x0000d6a5, 0x39b039c1, 0x76420137, 0x517151c0, 0x0000e137, 0x4c184c73, 0xa5c20375, 0x5a4a5ae2, 0x0000cdb1,
+        0xc49ec446, 0x841c8cde, 0xe892e837, 0x000058bb, 0x94f59442, 0x1539872e, 0x199519e5, 0x00003606, 0x91a8914f, 0x9739315d, 0x1475146f, 0x00002a49,
+        0xb842b8d7, 0x6c10a72b, 0xc0bfc064, 0x00004b46, 0x763976d2, 0x9416aeea, 0x941f945f, 0x00008bbe, 0x4d6d4dd0, 0x148e75d9, 0x15fb1526, 0x00001be3,
+        0xf933f996, 0xba038003, 0xc2ecc2af, 0x0000872c, 0x1a3c1a59, 0xa4236b42, 0xd248d21a, 0x0000a999, 0x49a3493c, 0x4be64256, 0xa3e8a3c7, 0x00002219,
+        0xfc59fc23, 0xce4836ff, 0x270e27dc, 0x0000512c, 0xffa7ff54, 0x738a87cf, 0x0e660e6c, 0x0000ea39, 0xb911b921, 0x75cd222e, 0x6e036e6a, 0x00005fb5,
+        0xe65ee65b, 0xe643cb5c, 0x77a07793, 0x00006c15, 0x575957bb, 0xdb5f19aa, 0x2a002a8e, 0x000011d7, 0x325b32ba, 0x5ad807f6, 0x8dae8d99, 0x0000b6a8,
+        0x54b25436, 0xc3d647db, 0x5b105ba8, 0x00003ecf, 0x26e526df, 0x7a7ea3db, 0x801e8030, 0x000055b8, 0xbfd9bfd7, 0x43646ed3, 0xe36fe35b, 0x00005474,
+        0xced1cea7, 0x4e542754, 0x210c21e7, 0x00000eb5, 0xe932e9ee, 0x45269f55, 0x2df12d55, 0x00006791, 0x0a590ad8, 0x96b67434, 0x7cad7c1f, 0x00006976,
+        0xae5aaeb7, 0xbc68a614, 0xae30aecc, 0x00004012, 0xa1bea1c2, 0x6d7d3070, 0xf878f8d0, 0x0000307e, 0x4daf4d1f, 0x8b29b8d8, 0x1d181d38, 0x00006a44,
+        0xed85eda7, 0xfc9b53b2, 0xc664c6d8, 0x0000b609, 0x34ae342a, 0xd38b1cda, 0x4dd84d36, 0x0000afa6, 0x69306939, 0x9c2c5d03, 0x4eb74eef, 0x0000cd95,
+        0x1445145d, 0x83772d1e, 0x797a7917, 0x00000972, 0x05390552, 0xc03586de, 0x14711403, 0x0000e20d, 0x2aef2a6f, 0x199fd136, 0xdd7cdd27, 0x00009d01,
+        0xce76ce1f, 0x8eee8e58, 0x835c8342, 0x0000eb0b, 0x61756100, 0x05e49445, 0x2d802d3a, 0x000030d4, 0xe59ae5fc, 0xfa6f2ee6, 0x80b38027, 0x0000575b,
+        0x0c5b0cea, 0xd55ec1b7, 0x410d4166, 0x00000aed, 0x8d478d93, 0x0b543942, 0xab24ab3c, 0x00000c33, 0x1bc31bd4, 0xa57c577c, 0xc390c3e1, 0x0000a5b4,
+        0xba2bba92, 0x74da06b8, 0x3c4b3cd3, 0x00009d91, 0x695469ca, 0x3ccd5f68, 0xb7a8b719, 0x0000843e, 0xa1a1a13a, 0x83b6b8a7, 0x51f051fe, 0x0000466d,
+        0x1af51ac3, 0xd54dae12, 0x1c4f1c38, 0x0000ba13, 0x68256896, 0x6a8ac63c, 0xbe09be61, 0x0000d9eb, 0xfdd1fd81, 0xb58b94be, 0x465e467f, 0x0000f032,
+        0x7b3b7b33, 0xe193c185, 0x600660cd, 0x0000b231, 0xa8e3a89c, 0x226db4d6, 0x378b3739, 0x00000522, 0x983c983d, 0xdb52c32e, 0x84ba8495, 0x00009b16,
+        0xebc7eba6, 0x346f91b1, 0xa5c1a57f, 0x0000c9ab, 0x6e606eb0, 0xc2575e13, 0x626a6231, 0x00006251, 0xf75cf7ae, 0xcb7a5034, 0xd030d096, 0x00001f14,
+        0xb3feb340, 0x6bc371a9, 0x512b5157, 0x0000a46f, 0x767876ac, 0x694e5ade, 0x29ec29f8, 0x0000866d, 0x5d075d09, 0xbeec468f, 0xe6e7e6bf, 0x0000de7c,
+        0xe538e503, 0x2bc0420a, 0x935f93b3, 0x00001ea8, 0x32f332d8, 0x716c6c08, 0x3e273e42, 0x0000f763, 0xd2add24f, 0x218e2226, 0x9d5a9d05, 0x00003cd1,
+        0xacccacd5, 0xecd3b4bb, 0xea2aea7a, 0x000072f3, 0x3b883b34, 0x8a4692c5, 0x76327602, 0x0000ea29, 0x34f1343e, 0x4f29833f, 0x275a2790, 0x0000e64d,
+        0xbdcabd3f, 0x66ae11cc, 0xa331a34f, 0x000097bd, 0x6a876a77, 0x7d589e61, 0x796a7923, 0x0000ccaa, 0x65bc6560, 0xfd6edbdb, 0xa41da4ae, 0x0000f02e,
+        0x1e031e35, 0xb7ebcce2, 0x330633c1, 0x0000b84f, 0xd112d1a1, 0x163ac378, 0x1aa41ad3, 0x0000a95a, 0xdd06dd1c, 0x6e22be60, 0xe95ce963, 0x00005476,
+        0xbf11bf04, 0x452633a1, 0xdb01db0c, 0x0000888b, 0x06270671, 0xfed3ac3f, 0xcdaecdc4, 0x0000daad, 0x7edd7edd, 0x4fc965c5, 0x19201964, 0x000003ed,
+        0x144d1452, 0xdec48993, 0x78007889, 0x00008f68, 0xe771e702, 0x661024d6, 0xf09cf028, 0x00007931, 0xbe90bec7, 0xccc5460d, 0x2dd72d66, 0x00009697,
+        0xd808d840, 0x6f114046, 0xe188e1d7, 0x0000bca8, 0x9ba09b2d, 0xc9450030, 0xdea3deea, 0x00004fd2, 0x825082f4, 0x4eb42d39, 0x004000ec, 0x00003d92,
+        0xef72efce, 0xe7220d27, 0x39283998, 0x0000424f, 0x1d001de3, 0x98f1dd1d, 0x77e977b2, 0x00004ea9, 0x06f306f0, 0xaa0d95fb, 0x657465a2, 0x00009ec8,
+        0xd7b9d79d, 0x980e042e, 0x56de5619, 0x0000f88d, 0x71a0718e, 0x1ade2806, 0x71e871b8, 0x0000a58a, 0x1cf71c84, 0x7c6dc6ba, 0x76f876af, 0x0000fc41,
+        0xf14df173, 0x77cd1b15, 0xf6f7f673, 0x0000271e, 0x5d645d36, 0xd27bf103, 0xfd6cfd44, 0x000083f2, 0x6e916e73, 0x05b88b21, 0x27992768, 0x00008bc3,
+        0xfe7bfe47, 0x73cd99ea, 0x8d208d1c, 0x0000e9e2, 0x05890562, 0xec8da428, 0x39ed39a6, 0x00000dd0, 0x06a406f5, 0x9716cd6a, 0x59ef5915, 0x0000c54d,
+        0x8cda8cdb, 0xacdc0274, 0x9d6c9dae, 0x0000c773, 0x942b9441, 0x2863153e, 0x976d9704, 0x000036a0, 0x0e260eca, 0xee9326cb, 0x3ace3ac2, 0x0000c7cd,
+        0x97bb97fa, 0x6fefd6ca, 0x646764f4, 0x0000f11e, 0x42ae4225, 0x944361a9, 0x861e8669, 0x0000df89, 0xa2ada2b2, 0xfa6e0076, 0xe915e9e9, 0x0000dc1e,
+        0x706570a0, 0xdf548d1e, 0x106510cc, 0x000034d1, 0x07da0766, 0x7ced6d45, 0x5ffd5fb2, 0x000008ae, 0xdc79dcd6, 0xd0c498b4, 0x409e4006, 0x0000d60a,
+        0xab1bab5c, 0x39e2bea9, 0xd5a6d500, 0x000079cf, 0x0a410a2b, 0x357714c5, 0xc9efc9e9, 0x000034dd, 0xbedabe29, 0xe663a1e4, 0x75017581, 0x0000c39c,
+        0x9f209f3e, 0x4df6f30a, 0x2bbf2b45, 0x0000cf06, 0x80de8034, 0x01e63518, 0xc427c4e2, 0x0000ebe2, 0xbb29bb5a, 0x1b5144bc, 0xc107c129, 0x0000cf6d,
+        0x300630fb, 0x964ce75d, 0x03490317, 0x0000cdee, 0x517f5188, 0x82378ccf, 0x7b177ba7, 0x00002fa9, 0x60fb608c, 0x6532b203, 0x3e493ef0, 0x00001558,
+        0x660a6618, 0xd60663a5, 0xec57ece6, 0x00002bbb, 0x880f88d2, 0x066463d9, 0x2d422d24, 0x000060c0, 0xa7b4a7c9, 0x625ea7aa, 0x656b6533, 0x00002d45,
+        0xe101e110, 0x7f6de312, 0xc52bc51b, 0x00004905, 0x401c4077, 0x716324eb, 0xdd5edda4, 0x00008d71, 0x5e0a5ec4, 0x067b8081, 0x5d9f5db6, 0x0000a9fa,
+        0xc030c042, 0x54607659, 0xc26cc2c4, 0x0000e2ce, 0xff1bff10, 0x19c8453b, 0x8ccc8c24, 0x0000cd6d, 0x46bf46a6, 0xa3be0fed, 0x067a0685, 0x00005d27,
+        0x014a015d, 0x4bf6d70c, 0x523b5213, 0x0000b0e7, 0x4e544ecb, 0xf4514c54, 0x808180b6, 0x0000c732, 0x12c312d5, 0xe9f260d5, 0x507750c0, 0x000000bf,
+        0xd86dd863, 0xb0cf899d, 0xf2f9f2a6, 0x000043cf, 0x1bbb1b50, 0x988dab7c, 0xd9a9d95b, 0x000060e1, 0xfa30fa32, 0x3a401540, 0x8ee08eaa, 0x00004d7d,
+        0x1d911d34, 0x6e7d1f6a, 0x9d129d0b, 0x00004d9b, 0x9228921f, 0x9549365c, 0xcb88cb14, 0x00008ffe, 0xc2fcc21f, 0x1f3b2509, 0xc54cc554, 0x000046b8,
+        0xda49da58, 0x568cdfa5, 0x813d8182, 0x0000b84f, 0x14d314c9, 0x3a6e3a52, 0x465b465d, 0x0000f7b3, 0xb3e4b350, 0x5c9cb4d6, 0xc9fac9be, 0x00006728,
+        0x02770208, 0xf1ae16b9, 0xcb6bcbc5, 0x00004611, 0xd535d555, 0x62222839, 0x8db48d04, 0x0000fdbc, 0xa647a67b, 0x7a8ceec0, 0x7674762a, 0x0000a8aa,
+        0xf6e0f6d4, 0x904c2880, 0xa293a246, 0x0000a7b9, 0xf57bf58a, 0x287e0861, 0xaffdaf54, 0x00004d7c, 0x222022f8, 0x9eec7936, 0xcd14cd3c, 0x00005054,
+        0x1df31de9, 0x4c2414b2, 0x6a276a30, 0x0000209c, 0x073307e5, 0xdd8936da, 0x0c530c08, 0x0000b036, 0xff9effb9, 0xc65d8730, 0xbcf4bc36, 0x0000dab3,
+        0xe033e0fa, 0x997973d1, 0x00c10042, 0x00004e08, 0xc5abc575, 0xeba36129, 0xa297a28f, 0x00002f75, 0xa2caa28e, 0xedd15b22, 0x931c9343, 0x00001674,
+        0xffa0ff64, 0xa29e9738, 0x53525388, 0x000099ae, 0x916d9158, 0x8db8e6a3, 0xcb23cbce, 0x0000f75c, 0xad16ade3, 0x9f1e6c7d, 0x1b581bd3, 0x00003082,
+        0xf674f680, 0x4e24b61b, 0x0ea20e4a, 0x0000baee, 0x9bd49bb5, 0xa6de69d5, 0xaa2aaa2a, 0x000032a0, 0x11c2118a, 0x081ece50, 0x61366154, 0x00006fa7,
+        0x43de4368, 0xfa9b908f, 0xeb75eb62, 0x00006250, 0x2e292eb1, 0x62213162, 0xed2fedaa, 0x0000e60b, 0x65e56514, 0xcef05cd2, 0xb724b743, 0x0000c92e,
+        0x318531d6, 0x039b7bbb, 0x16a6165c, 0x0000f1b2, 0xb56fb550, 0xb06ca72e, 0xf240f2bc, 0x00006d7f, 0x1bbd1bbf, 0xeaa3f2ac, 0x60b46086, 0x00004467,
+        0x344334ec, 0x6840075c, 0x64ba644a, 0x00005a4d, 0x84348460, 0xb51bcded, 0x59605904, 0x0000d048, 0x1c5a1c2f, 0x1ac837a1, 0xd057d033, 0x0000b8e7,
+        0x7b337b64, 0x0747de6c, 0x9f649f22, 0x00008e1e, 0x472d47b3, 0x3ff5f504, 0x3e6f3e95, 0x0000b3a8, 0x8c688c8e, 0x82d538d1, 0xc940c989, 0x0000a17e,
+        0x52d65216, 0x646ac8e7, 0xe319e325, 0x0000684a, 0x50e45038, 0x9d58f0ac, 0xf696f696, 0x0000a028, 0x2c4a2c96, 0xbd945c65, 0x74927492, 0x00003cd8,
+        0x871e8767, 0xf9ce9cd6, 0xab8fab5b, 0x0000b697, 0x75787550, 0x32875e92, 0x69a9699a, 0x000080ef, 0xbec3be18, 0x0024e21e, 0xbcb3bc58, 0x0000d889,
+        0x2ab82a2b, 0x30477a3d, 0xdf72df98, 0x0000bb10, 0x310b3155, 0x98fa4e4e, 0xea51ea47, 0x00002766, 0x103b107a, 0xfef86a48, 0x27902754, 0x0000b29c,
+        0x324732d0, 0x45da19d1, 0xd7ded776, 0x0000b5b1, 0x46aa46df, 0x50e64cdf, 0x5d345d46, 0x000056a6, 0xc6cbc632, 0x9769b935, 0x78f678d8, 0x00005e00,
+        0x262726fa, 0x68400341, 0x342734ac, 0x0000c5d8, 0x196119a6, 0xc6253410, 0x5d455de0, 0x00000d47, 0xdf0adffa, 0x52a76168, 0xd06fd06a, 0x0000f9a1,
+        0x9ffc9f21, 0xe3d335ef, 0x1aa71ae9, 0x0000599b, 0x82b88206, 0x4eb414a8, 0xf173f1ec, 0x00001721, 0xaff2af9f, 0xedd3d9a6, 0x25ed25fd, 0x00006814,
+        0x1a0e1a99, 0xc4f8e84f, 0xdcafdc96, 0x00003cd1, 0x6bb16b42, 0x073b0646, 0x5f545f07, 0x0000263b, 0x379737e7, 0x7dba4cd4, 0x67cf67c1, 0x00005ccf,
+        0x5df35d7b, 0x86c0d6ca, 0x034003dd, 0x0000c012, 0x207f20bf, 0x2d3a45c3, 0xe946e907, 0x0000d387, 0xa05ba0d2, 0xa1612dac, 0xa5ada521, 0x0000bf5c,
+        0xabd1abf3, 0x5e05c41a, 0x97469702, 0x0000f961, 0xf032f076, 0x0dcbf11f, 0xaaa7aa94, 0x00006c15, 0x2fc82f2d, 0xe55e62ac, 0x05f60517, 0x0000af85,
+        0xbf92bfe8, 0x805951b1, 0xb7a3b7d1, 0x00000dd4, 0x6675662a, 0x25927255, 0xf034f0c3, 0x000092f5, 0xee0cee77, 0xafdc2906, 0xfbe4fb48, 0x00003521,
+        0xe7e5e71e, 0x8fa76b34, 0x8b358b82, 0x00006e4a, 0x660e66e9, 0x91ec1c5b, 0xfa85fa47, 0x00007e61, 0xe450e4cd, 0xa29c3ece, 0xf33cf34d, 0x0000cea1,
+        0x591959c3, 0xabeee7e2, 0xf9aaf95b, 0x00004530, 0x7f7d7f86, 0xb4f0c4a9, 0x00b9008d, 0x0000bab0, 0x48364899, 0xb6753a4c, 0x4d604d87, 0x00001589,
+        0xf819f82c, 0x3789c548, 0x42e84216, 0x00006515, 0x2fea2fcc, 0xc5a40854, 0x212221c2, 0x0000a964, 0x0f830f9f, 0xb7dbdd53, 0xa7c1a777, 0x00005a44,
+        0x67bd674d, 0xa723766f, 0x440e4443, 0x000074b1, 0x6dbe6df5, 0x9bac3ace, 0x3d133d99, 0x0000065d, 0xc086c0f8, 0x8e992b38, 0x212a218d, 0x00009f46,
+        0x7d507d0e, 0x8ad96105, 0x543a548a, 0x0000c3ec, 0x39a339fc, 0x22d1a451, 0x918a9162, 0x0000bcf9, 0x5a0e5a5b, 0xdb54b1d8, 0x27a827f4, 0x0000d0fb,
+        0x5acc5ab6, 0x688f4714, 0x81ed81ed, 0x0000b609, 0xd312d3da, 0xe2c71a7d, 0x860986a8, 0x000058c7, 0xc4d0c477, 0xd46c1686, 0xc114c13e, 0x00000f19,
+        0xe4b8e45c, 0x83362509, 0xb2aab21c, 0x00005e54, 0x2ae22aec, 0x3a5dbf85, 0x56cf568b, 0x00008c9e, 0x332d33d1, 0x47c68bfe, 0x6e676ed1, 0x00001ca5,
+        0x0071007c, 0x9206167d, 0x59ae590f, 0x000078fe, 0x6c496ce1, 0xefa723dc, 0x8edf8e55, 0x00005ae8, 0x5d525de2, 0x88319879, 0xba21ba1b, 0x0000002b,
+        0xf72ff7e6, 0x53c829bf, 0x9832984c, 0x0000da6a, 0xd0e5d073, 0xfa03ffae, 0x2c492c72, 0x0000beff, 0x52c552cb, 0xb58a2756, 0xb96cb98d, 0x0000958a,
+        0xd73dd782, 0x0af578cf, 0xe52fe5be, 0x000018f2, 0x0072008d, 0xb88567d3, 0xbbfabb1d, 0x0000ee0d, 0x4ad24a31, 0xc82a36d2, 0x786678ee, 0x00003912,
+        0x34c93405, 0x20cf0e9a, 0x1f0d1f8c, 0x00009049, 0x5d2a5d4d, 0xc52663a4, 0x9a479a10, 0x00000c42, 0x9183912c, 0x8a2799d7, 0x1c641c3a, 0x00006f2a,
+        0x2a272a7d, 0x0662aa0b, 0x3bb83b90, 0x00009840, 0xf90ff963, 0x115e29f6, 0x4458449d, 0x00007181, 0x0d600d9a, 0xbf95a120, 0xb209b2a4, 0x0000ea2b,
+        0xe697e67f, 0xd46be35e, 0x90e190c1, 0x00005e65, 0xe454e4a7, 0xa9a097be, 0xbbf4bbf7, 0x00007ffe, 0xeab5ea1a, 0x1d1598ad, 0xedf1ed41, 0x0000069f,
+        0xebc8eb4e, 0x57fbd2d2, 0x8d8b8d7d, 0x0000624a, 0x160b166b, 0x376b30d9, 0xac18ac6d, 0x0000dceb, 0x9af19aa0, 0x9de688fe, 0xd326d376, 0x0000ecf8,
+        0x32a032f1, 0x1750af5f, 0xde4ade9e, 0x0000b3cd, 0xc9e8c9fd, 0xef3e5f13, 0x9afe9a25, 0x00001c0b, 0x14b41487, 0x4a17c416, 0xd05fd016, 0x00002da4,
+        0x0c4b0c33, 0x6a88ad2b, 0xb1fbb142, 0x0000f146, 0x80908072, 0x98f1efcc, 0xc379c353, 0x000084a3, 0xf979f9b2, 0xde548bfd, 0xfa7dfada, 0x0000d459,
+        0xfd41fde2, 0xccf5ef72, 0x530a536c, 0x00000cd9, 0xd02cd02f, 0x137b766f, 0xe922e9f4, 0x000031ab, 0xfcb9fcde, 0x522e864f, 0x73ba73df, 0x00001b36,
+        0x0bb20bb4, 0x2efe3e31, 0x9fd59f9c, 0x0000e3f5, 0xb0f7b080, 0xbf745778, 0x2ebc2e43, 0x0000ca83, 0xc7fbc764, 0xfb11c547, 0xf168f1ab, 0x00004158,
+        0xdd28ddc3, 0xa1d0fd32, 0x415541b5, 0x00009116, 0x7a6d7a29, 0x55b8211e, 0xe7ace76d, 0x00009ea7, 0x8fac8fd6, 0x33b222ab, 0xc104c1e4, 0x00006f9b,
+        0x4ec14e7b, 0x9bb62dfb, 0xe20ee237, 0x000029ea, 0x0d670db3, 0xc33a3bce, 0xe050e0ed, 0x00008570, 0xc262c28e, 0x3147582b, 0x9f7c9ff8, 0x000082ff,
+        0x04f304b6, 0xfcaa9778, 0x607460fb, 0x0000376c, 0x559755b8, 0x55e78ce1, 0x1e481e58, 0x00005985, 0xea7cea41, 0xa39fd0e8, 0x6fd86f67, 0x0000afa7,
+        0x6c136cd6, 0x5868463a, 0x0e560ec1, 0x0000ca07, 0x369f36d0, 0x379a86fe, 0x7816788c, 0x000057ba, 0x7c607c9e, 0x91691e9e, 0xd6c3d6d8, 0x00009077,
+        0x40ba4079, 0x57ff5b75, 0x53bc5347, 0x00005037, 0x947d94e9, 0x5c75cfd4, 0x37993740, 0x0000f9a1, 0xaba4ab3c, 0x2bc2e45d, 0xe5b2e545, 0x0000a6e9,
+        0xc5eac59d, 0xdff34533, 0x9f439f45, 0x00003ec4, 0xb470b4db, 0x3ee828ff, 0x25dc25de, 0x0000da6d, 0x72d67223, 0xb6010548, 0xcfdecf1a, 0x00004d43,
+        0x7aa37ab8, 0xe4a3dad8, 0x27f72744, 0x000098f6, 0x95819546, 0x67cd066b, 0x032a0353, 0x00008990, 0x42a942ca, 0x390264f2, 0x140314d5, 0x00003794,
+        0xce4cce83, 0x04edb5f8, 0x64b764c1, 0x0000e60a, 0xbf93bfc5, 0x5b07e683, 0xc741c708, 0x00009c78, 0x7b3d7b42, 0x14ba11bc, 0xe5c7e579, 0x0000f652,
+        0x374c37e9, 0xef000beb, 0x420c42da, 0x00001b0c, 0xb207b23e, 0x7c014626, 0x2f852faf, 0x000000bb, 0x19ba1937, 0x4b76f6ec, 0xbb74bb24, 0x00004004,
+        0x05cc05c9, 0xeb620ad6, 0x3f8b3f28, 0x0000b300, 0xba28ba7d, 0x26a6e832, 0x195d19f1, 0x0000c532, 0x44524435, 0xa1c31fda, 0xfca6fc75, 0x00006b6a,
+        0x50ac50fd, 0x1b936a2b, 0x357d3566, 0x0000e9e2, 0xf57bf525, 0xb46c6edb, 0x731773ca, 0x0000018e, 0xac2bac15, 0xccf52163, 0xef70ef83, 0x0000e817,
+        0xae46ae70, 0xb0d28436, 0x1a061ad4, 0x00000cbc, 0xad24adce, 0x6c60e849, 0xe44ce48a, 0x0000c940, 0xef58ef61, 0xa64f1742, 0xfa03fa16, 0x000097c1,
+        0xeee6ee78, 0xddefe4dd, 0x36b0361c, 0x0000b2ae, 0xc4f1c4f3, 0xf00bab40, 0xf3f2f3ab, 0x0000a364, 0x72ea72fa, 0x9ac95672, 0x90e690e0, 0x0000fe1e,
+        0xed98edb7, 0x7ee35770, 0xd831d882, 0x0000b931, 0x21c221fa, 0x1138560d, 0x650e6560, 0x000078e6, 0xe22ee27a, 0xc3b23596, 0x110f1183, 0x00008950,
+        0x21e92179, 0x8aa62754, 0x44f444f5, 0x0000fc0c, 0xa871a847, 0x0d94dd63, 0x01cb01c9, 0x0000e4ef, 0xea8eeab4, 0xdc018d77, 0x97409738, 0x0000f50c,
+        0xd9a6d985, 0xc5a58c62, 0xdc6ddc8c, 0x00003656, 0x7ee57e14, 0x82096cf4, 0xb8ceb889, 0x000099a7, 0x5b495b9d, 0xdcf85089, 0xb8adb8a1, 0x00004d02,
+        0xfbc3fbc7, 0x1d4e623a, 0xab0bab96, 0x000088f3, 0x64ca64bf, 0x42abbf84, 0xfcdcfc86, 0x0000aa36, 0x66376663, 0xdfe5f457, 0xc67fc69e, 0x00001217,
+        0xe351e306, 0xfab6ba48, 0x732b73ff, 0x00003ecc, 0x4a164aa2, 0x8888d938, 0xfc9bfc2b, 0x0000c5d3, 0x5d035dbb, 0xb9ceb8f5, 0x6f0a6fe1, 0x0000dda3,
+        0x5c0f5ce3, 0x2c1f6cf4, 0x03140329, 0x0000435a, 0x0e6e0ee7, 0x05659e95, 0xcf1ccff2, 0x0000f1f1, 0x1fa81fdb, 0xb84bc9f7, 0x23702370, 0x00002556,
+        0x0a070ae9, 0x30373c01, 0x3eb33e14, 0x000015d7, 0xb9d0b96a, 0xcdc4eb9e, 0xd574d53f, 0x000062d4, 0xa4a6a4fa, 0x07671055, 0x47be4796, 0x00005e9f,
+        0x2aa72a1d, 0xbcdbe5cd, 0x8b7a8b29, 0x0000b697, 0x731a7372, 0xe4c13f31, 0x7417748f, 0x00004711, 0x04ea046c, 0x66f1b147, 0x845b8482, 0x00002b77,
+        0x5f385f37, 0x0049992a, 0x225022f5, 0x000077ee, 0xbf28bf4b, 0x92e61555, 0xee57ee7f, 0x00000eed, 0xd840d87a, 0x17aa2bc6, 0x4263424f, 0x0000ec89,
+        0x110e119b, 0x76dd3c40, 0xa3a4a3ed, 0x00001659, 0x18e5189e, 0xba4c2dfb, 0x0519051d, 0x00006570, 0x75797594, 0x6f80219b, 0xe5b4e5d4, 0x00007f70,
+        0xe2a5e237, 0xdb506322, 0xc3f8c348, 0x00006216, 0xed95edb1, 0x17d5f411, 0x9b239bff, 0x00005cb0, 0x428a42c8, 0xac21ceee, 0x69096968, 0x000008a0,
+        0x9c329ca9, 0x9d067130, 0xba80ba26, 0x00007cdc, 0x5a965a0e, 0x0926c041, 0xcb65cb7f, 0x00006a15, 0x9a209a39, 0x2d2cd484, 0xc5aac564, 0x0000f452,
+        0x1c4e1c09, 0x3bc3d354, 0x3d693d2f, 0x00002af9, 0x85ff85e0, 0x40c64fae, 0xbadbbaa6, 0x0000829c, 0x28e328be, 0x3e941394, 0xb19fb19e, 0x00001fda,
+        0x647364c6, 0x6023fef4, 0xdb46db39, 0x0000f1ec, 0x0f310fe1, 0x1a1f9bd4, 0x84aa84a2, 0x0000a664, 0xa057a0f6, 0xdf547a3d, 0xf2eaf208, 0x00003d06,
+        0x642064cf, 0x5256caf1, 0xd9e9d9ff, 0x000006da, 0xec85ec83, 0xe0c0e8cc, 0x15871526, 0x0000cd03, 0xa4b8a46a, 0xf225e4e2, 0xab69ab1e, 0x00005940,
+        0x9adf9a51, 0xafe4b1c3, 0x664c6609, 0x0000a493, 0x429742d0, 0x18b5f4d0, 0xde32dec5, 0x0000a896, 0x55c0554c, 0x94fa2d8d, 0x01bd0107, 0x0000945d,
+        0x2cd62cdd, 0xc73581fe, 0xd88ed8e2, 0x000016d7, 0x6d366d37, 0x7bfad1b4, 0xaf49af0b, 0x0000248e, 0xc547c52b, 0x6f1a98b5, 0x7f0c7f5e, 0x00001517,
+        0x34f13432, 0x72da585c, 0x21072195, 0x00008a2f, 0x043604e2, 0x9fe6460c, 0x1fdb1fd1, 0x000045a2, 0x6ab16af7, 0x14aa7cf6, 0x6db56d53, 0x0000fd23,
+        0xc055c0fd, 0x1f4dd181, 0xc016c028, 0x0000f02c, 0x65b46588, 0x716d93d9, 0x73dc7395, 0x00004fb0, 0x12ea12d7, 0x9b4575d9, 0x3cf83c49, 0x00003c8c,
+        0x783f789d, 0xda20aeb5, 0x7149717c, 0x0000aa56, 0x9008900e, 0x660c0861, 0x704e70f9, 0x0000259a, 0x368436a7, 0x26590be8, 0xcfafcf83, 0x00007e9c,
+        0xdc9edce6, 0x017b14aa, 0xc164c1b4, 0x0000efd7, 0x365e3692, 0xbc8bedaf, 0x383138dc, 0x0000915d, 0x971e9762, 0x3856a454, 0xbb40bba3, 0x00009667,
+        0xe9f5e990, 0x59f281f2, 0xe86ee869, 0x0000f809, 0x41f34138, 0x2fc1daa6, 0x9e5e9ef6, 0x000036dd, 0xc4eac49f, 0xcc459032, 0x124c12d0, 0x00008c90,
+        0xfaa2fa6a, 0x61f0c1ba, 0x9ee09efe, 0x00001756, 0xaf12afb6, 0x02fa502c, 0x1c861c89, 0x0000b2e5, 0x43cb4353, 0x3ddf7586, 0xf95ff9f0, 0x000017d7,
+        0xa0f4a08e, 0xa27c458f, 0xda10dacd, 0x00008bee, 0xa30ba38b, 0x8679ecef, 0x40c64016, 0x000059f9, 0x7c107cfe, 0xa0e0550b, 0xf8f5f8b6, 0x0000e789,
+        0x03be03a6, 0xf403f92e, 0x1af01afa, 0x00006400, 0x8d448d09, 0xf5298f20, 0xf030f09a, 0x00003f33, 0x6444643f, 0xb57fb0a4, 0x272c2733, 0x00003611,
+        0xd42fd42e, 0x230fc931, 0x79087984, 0x0000676e, 0xa7caa739, 0x95d96ea4, 0xc55dc550, 0x0000785e, 0xa6a8a6a0, 0x512fac98, 0xac5bac82, 0x0000d687,
+        0xc8e2c854, 0xe1f1c23c, 0xd41bd4db, 0x0000f26b, 0x88e38855, 0x99f2ce2d, 0xb806b8a3, 0x0000535b, 0xfc89fc1d, 0x7d1200ca, 0xdf2bdf10, 0x00002556,
+        0x5da05d37, 0xbccca9de, 0x0b420bbe, 0x0000a575, 0x1c6d1c81, 0x8f67aa9d, 0xa6e3a6a7, 0x0000194c, 0x329732f0, 0x4cdded33, 0x05070547, 0x0000d867,
+        0x7b127b3d, 0x71cd4bca, 0x3e263ec9, 0x00002036, 0x43564306, 0x820a47c4, 0x1737174f, 0x000083cf, 0xadd3adaa, 0x9957f89d, 0x5f565f06, 0x0000acb8,
+        0xf5b4f5a8, 0x6e502259, 0xad34ad4f, 0x0000d2eb, 0x185d181f, 0x3d5ba650, 0xdbf3dba4, 0x000054fa, 0x93e693f4, 0x1de519aa, 0x155e151b, 0x0000f6c3,
+        0x6e116eec, 0xbe710ad7, 0x30c5308a, 0x00003b6c, 0xed99edd1, 0x57735d6c, 0xf417f4ae, 0x00009614, 0xb40cb4ac, 0x66fcb960, 0x5b905bd0, 0x0000bb10,
+        0x777877d7, 0x2e301fa8, 0x6c126cc9, 0x00009b91, 0x1d591d79, 0x0025a996, 0x7f087f5b, 0x0000f55c, 0xe146e18d, 0xfd8877f0, 0x04e40485, 0x0000e489,
+        0x86c1867d, 0x560327d6, 0x567856c1, 0x0000b2ac, 0x0d270dc9, 0xbd1b4505, 0x37a33712, 0x0000d9ea, 0x84018498, 0xdfcb2ac6, 0x524252f2, 0x00006897,
+        0xbac0ba55, 0x799862e8, 0x6442640e, 0x0000c09e, 0x91209196, 0x62b149dc, 0x75117534, 0x0000b4f7, 0xe6b6e6df, 0x11603adf, 0xcbc9cb68, 0x00004a96,
+        0xaf27afe6, 0x4a266356, 0x7d277dc3, 0x00003583, 0xfe73fee3, 0x5cdd61da, 0x9eea9ebf, 0x000016c9, 0xbacaba3c, 0xb9b31ac4, 0xc31bc378, 0x0000b313,
+        0x0e810ecc, 0x7a0d2b33, 0xf779f7f6, 0x0000bc7b, 0x373637a6, 0xe59f915b, 0x6dc96d6c, 0x0000c5d2, 0x719a7133, 0xbb3f9339, 0x6c5d6c35, 0x000054b4,
+        0x9683964c, 0x41b338f0, 0x4162413c, 0x0000602d, 0x2b392bbe, 0x153a29f4, 0x07ca07d4, 0x000037f1, 0xa54fa555, 0x68418b5f, 0x89058966, 0x0000eed7,
+        0x7ae77a10, 0x87807c01, 0x5c3b5cca, 0x0000111a, 0x36003600, 0xbbd0b554, 0x49a34928, 0x0000b6a8, 0xb584b52f, 0xc13502b7, 0xf11df153, 0x0000a2de,
+        0x5b1c5b56, 0xccfb48df, 0x9fec9fac, 0x00005609, 0x9fe19f9b, 0x802588bf, 0x0a670a8a, 0x000054e8, 0xefcaefaf, 0xc27a3f4c, 0x032d03d4, 0x0000c49d,
+        0x6bc26b01, 0xc635a265, 0x713d713a, 0x00006a77, 0xeeecee5e, 0x30304b37, 0x7a677a8c, 0x00005bb4, 0x60eb609e, 0xed869a6c, 0x75b2750e, 0x0000f699,
+        0x3848384e, 0xa143e2ec, 0x2e862e23, 0x0000dd67, 0xba0fba09, 0x377f07b5, 0x235b23e3, 0x0000da63, 0x1bd01b46, 0x8137c743, 0xe433e48e, 0x00007231,
+        0xd50dd56b, 0x9b5d038e, 0xd031d0cc, 0x00006b7f, 0x79ea7957, 0xadb3124b, 0xfcfbfca2, 0x0000f02e, 0x501f5070, 0x7d9829b4, 0x40bc40df, 0x0000310a,
+        0x2d3d2d3f, 0x36ce5682, 0xa079a032, 0x00006923, 0x35393555, 0x8e982bbf, 0xee58eef7, 0x0000f6ec, 0x57ac57fc, 0x9bd9222b, 0xa34fa323, 0x0000720f,
+        0xddb3dd16, 0xa041fd9a, 0x68c5681f, 0x0000b506, 0x37b1372b, 0x1655d3b4, 0xfc60fc77, 0x00005a44, 0xb13eb106, 0x731abc4d, 0xdca7dcef, 0x0000be4e,
+        0x9c439c99, 0x16050d27, 0x4c784c7a, 0x00009ee0, 0xd5add5f1, 0x86d2914c, 0x222d22f0, 0x0000e42b, 0x1f171f09, 0x3ac3a1a2, 0x160b16d5, 0x00004e81,
+        0x45f84543, 0xf2b9be77, 0x91c49181, 0x0000ea80, 0x223222d4, 0x60cffb61, 0x72137207, 0x0000908a, 0x3e1d3ea4, 0x22d22b45, 0xe0c0e0af, 0x00000e53,
+        0x805b8081, 0xd1201954, 0xf2b9f2c4, 0x00003f9d, 0x961e96f5, 0xb3e2e932, 0xbc7abc0a, 0x000008ca, 0x29c32948, 0xc8143b80, 0xbe61be8c, 0x00008ab0,
+        0x331733de, 0x4a1400c8, 0x5fce5f03, 0x00004fb5, 0xdff8dfc1, 0x3aa27d70, 0x729a722c, 0x0000cfd5, 0x14ab1479, 0xcbcad5cb, 0x787a781a, 0x00005be8,
+        0x093109e8, 0xc03a72b0, 0x68856831, 0x00004c8f, 0x520752b2, 0x7ca10076, 0x0af40a58, 0x00007ca3, 0xbc2abc5a, 0xf7511686, 0xb516b502, 0x00009fe0,
+        0xd397d39b, 0x936950f2, 0x61f46118, 0x0000fc32, 0x59f159b4, 0x3f0a27d6, 0x9b579bcb, 0x00009f8a, 0x6ea46e99, 0x86552ee4, 0x654a6523, 0x000060af,
+        0x6603664f, 0xfc8732e1, 0x05f00512, 0x000035ae, 0x2dc42dd2, 0xba8f73d2, 0x18671839, 0x000045a2, 0xfc7efc93, 0x0d4d7a97, 0x1be61bee, 0x0000b5cd,
+        0x2f6f2ff6, 0x684195fa, 0xbb9abb25, 0x00005965, 0x46b746fd, 0x47368333, 0xb327b38a, 0x00002129, 0x77a177a4, 0x45269644, 0xb9afb919, 0x0000e0ad,
+        0x67f967c1, 0x43463cb6, 0xd89cd88c, 0x00003e13, 0xc2a3c2de, 0xe27cf128, 0x833283a0, 0x0000081c, 0xe1b8e15f, 0xfd6eabf4, 0x4061400e, 0x000006a0,
+        0x226b22f9, 0x81562ce4, 0x346f345d, 0x0000fb01, 0xf5b1f557, 0xe6d356ce, 0xd221d278, 0x000041b1, 0x9a669a5a, 0xa0d56eca, 0x62fd62d7, 0x0000b5a8,
+        0x6a006aa8, 0x5ab72abc, 0x53cc538a, 0x0000a177, 0xc816c893, 0xb1574b99, 0x43b643e7, 0x0000c268, 0x994199b7, 0x745294be, 0x1f781f64, 0x00001e88,
+        0x2541258e, 0x3c19834c, 0x9e059e9d, 0x00007568, 0x04a8043d, 0xdeabea8c, 0x365b3615, 0x0000e2ad, 0x65986562, 0x71bc0b97, 0x5c8e5cb1, 0x0000988c,
+        0x48cf4863, 0xa5439fa3, 0x19b919e9, 0x00008ab9, 0x35fb3531, 0x791a40df, 0x18c0181c, 0x0000b828, 0x6d826dd6, 0x2bafaf8a, 0x297a298c, 0x00001a93,
+        0x42974256, 0xf949ce2e, 0x4658462f, 0x0000a7d9, 0x920292b8, 0x7aff4031, 0x7dca7d83, 0x0000a384, 0xaf01af70, 0x79774572, 0x9b1d9b33, 0x0000e746,
+        0xa739a7b4, 0xe1c04855, 0x52615228, 0x0000a9fa, 0x67b667c7, 0x26dfd1f6, 0x09d50910, 0x00007ef9, 0xefecef9e, 0x01442cee, 0xaf92afb9, 0x0000ac2e,
+        0xbbdabbdc, 0xe59dd226, 0xa2b6a2e0, 0x00001893, 0x54c054fd, 0x391bc0a8, 0x0564058e, 0x00009e05, 0xaa09aa2f, 0xf11ceb93, 0x62736267, 0x0000c934,
+        0x659e6575, 0x6c6aa3da, 0x02270250, 0x0000f547, 0x117c11e7, 0x9905e7a2, 0x3b8f3b0b, 0x0000976b, 0x4cf24c85, 0x2ab62899, 0x93a993f3, 0x0000f120,
+        0x7249726e, 0x202d02f7, 0xcf94cf35, 0x0000a51e, 0x8bb58b32, 0x6840ef3e, 0xa576a58c, 0x0000505b, 0x93c99399, 0xe423ed49, 0x69ca69cb, 0x0000377c,
+        0x3ae93a2e, 0x0667d8e6, 0x342734e3, 0x00003f33, 0xa33ca38e, 0x23878ba2, 0x50225029, 0x0000ec75, 0x49184911, 0x705b2ce4, 0x9c7b9c97, 0x0000f773,
+        0xb7feb7d1, 0x47a507b4, 0x9c869c25, 0x00005dc7, 0x4cc04c2c, 0xdeb03653, 0xa4f2a41c, 0x00005b38, 0xb1cab1f6, 0xd82b83cf, 0xbab9ba3b, 0x0000eb99,
+        0x2b822b1e, 0x047b8cde, 0xf19bf1ef, 0x00009714, 0xc243c239, 0x6bca2f39, 0x1f7b1f65, 0x0000b442, 0x1fc21fd6, 0x5b90675c, 0xa08ca075, 0x000012c3,
+        0x611e6132, 0x5ce8d73b, 0xba87ba6b, 0x00007513, 0xcc90cc2a, 0xcd2dd858, 0xd16ed172, 0x0000f552, 0x1bee1be9, 0xc346e3fc, 0x16e616ef, 0x000083a2,
+        0x453a45c2, 0x6322fb30, 0xf98af939, 0x00001dd3, 0x52c452a4, 0x3f87b160, 0x25622578, 0x0000cbcf, 0x798f798b, 0x58d7194e, 0x316031a5, 0x00002ba4,
+        0x8242823d, 0x240fa0e9, 0xf3b5f3a8, 0x0000face, 0x66ad66a0, 0x6f825ed2, 0x70d47008, 0x0000e89b, 0x0bab0b86, 0x4446896a, 0xf2bbf2cc, 0x0000b105,
+        0x8893886d, 0xd5bda31b, 0xb197b1a0, 0x00002f48, 0xb205b2a8, 0x8d47fafb, 0x3b833b7f, 0x00002bba, 0xfb7bfb46, 0x8ec7a943, 0x34223422, 0x00000c0d,
+        0x224c22d9, 0x16d09a57, 0x5775578f, 0x00007d0f, 0xaccbac04, 0xa1507f46, 0x8f068f9a, 0x00001607, 0x07e3073a, 0x718f28fb, 0x15fe1502, 0x0000c9aa,
+        0x9861984c, 0xb38f143d, 0xf611f6fa, 0x0000b13b, 0xbd26bdc8, 0x1cc904f6, 0x06f90656, 0x0000829d, 0x8701870e, 0xbcdba70b, 0x97e097fc, 0x00001da5,
+        0xdfdcdf8d, 0xd04f363c, 0x87998738, 0x0000d200, 0xf18ff135, 0x82557976, 0xca67cad5, 0x0000d9ca, 0xbf52bfa4, 0x3856511d, 0xd51bd53b, 0x000073bf,
+        0xfa5efa21, 0xf5bb4f2a, 0xee78eecc, 0x0000a809, 0xf6e3f6d5, 0xbc24bbf7, 0x4ea44ea2, 0x000008dd, 0xa003a018, 0xf4e07dfc, 0xc7f4c7ab, 0x00000500,
+        0xc709c733, 0x2e2241ad, 0x543e54e5, 0x0000b924, 0x28c628e1, 0xbf4b8fa2, 0xeefaeebc, 0x00007f3d, 0xc0e7c079, 0x2459791e, 0x3e853e42, 0x0000dfdc,
+        0x6251624b, 0x482622a2, 0xe7d9e793, 0x000031aa, 0x100c109a, 0xfa00b0e7, 0xc0ebc011, 0x0000c29e, 0x5e6e5eea, 0x4366dc53, 0xd40ad432, 0x00004090,
+        0x9f999fd8, 0x87aab024, 0xb1a8b1aa, 0x00005f2b, 0x5c4b5c9f, 0x19ee8d4b, 0x57f357b9, 0x0000999f, 0x382238c4, 0x63ef1f1a, 0x49e9492b, 0x00006051,
+        0xa874a84c, 0xe15e0beb, 0xf307f379, 0x00006b96, 0xb80fb8e8, 0x33290c5e, 0xd819d880, 0x0000bbb1, 0x48d34830, 0xde1e6676, 0xec4fec14, 0x00005539,
+        0x97b3979d, 0x499954cc, 0x7b2a7be2, 0x0000111b, 0x6e5f6ebc, 0xcc2773d0, 0x484f48af, 0x00000c82, 0xe052e022, 0x70bc2326, 0xc66bc612, 0x000048a3,
+        0xcbd7cb8a, 0xca66554c, 0x20dd20eb, 0x0000eb16, 0x43ea432b, 0xd06b0645, 0x425842a4, 0x00002b45, 0x0a360a5d, 0x47364ba5, 0xdff8dfeb, 0x000050d8,
+        0x12ad12f0, 0xacd27fc4, 0x013a01d4, 0x00008d57, 0x601d6087, 0x089d09d7, 0xef0cef33, 0x0000af08, 0xe36ce3d1, 0xd44bbff5, 0x860c86ba, 0x00002fdb,
+        0x69d1699e, 0x76cddcd4, 0x707570c6, 0x0000be6f, 0x25252506, 0xd1faad41, 0x4a4c4ae6, 0x0000d29a, 0xc2a9c272, 0xbeec7afd, 0x491d49c2, 0x00009aae,
+        0x808f80d8, 0x1cb11119, 0x85c48573, 0x00007a0e, 0x75e07502, 0x657a958e, 0xf58bf58d, 0x0000a19e, 0x800580a9, 0x935c5ae3, 0x292c295d, 0x00009816,
+        0xb156b10c, 0x519018d0, 0x5aa75a15, 0x00001217, 0x147f143a, 0xcdd341c6, 0xb523b581, 0x00000208, 0x87eb8733, 0xda8fa8bd, 0x2c532c5b, 0x00008d71,
+        0x24572400, 0x0144a9f4, 0x89a28981, 0x0000f462, 0x5d8f5d91, 0x142f80cf, 0x32613229, 0x0000a285, 0x66c566b2, 0xb8a995fe, 0x08610885, 0x00008c73,
+        0x5740579b, 0xc65d90be, 0x2bfd2b15, 0x00007460, 0x9bd19b0c, 0x287d13e3, 0x28942868, 0x00007556, 0x732973e4, 0x4cdf849c, 0x4c664c1f, 0x0000c832,
+        0xb75bb7bd, 0x0e6886cf, 0x834e8302, 0x0000c232, 0xd36dd32a, 0xffd9e3d3, 0x50285056, 0x00006ceb, 0x0c360c84, 0x17ee1dd0, 0x7bcb7ba1, 0x00001217,
+        0x1aa71a02, 0xdfef6fda, 0x671167a9, 0x0000b8d0, 0x491b49f7, 0x80601740, 0xc311c394, 0x00002502, 0x8de18d12, 0x570f47b2, 0x352035a0, 0x00000c63,
+        0xe05ee020, 0x02c5b2ea, 0xce3dce92, 0x00007db1, 0xceefceca, 0xc5d6675a, 0x5f3a5f09, 0x0000e532, 0x357735d2, 0xeca3992a, 0xf474f450, 0x0000408e,
+        0x608360a1, 0xf88d6ed5, 0x4c244cfc, 0x00004d8f, 0x19d019a2, 0x7e5114f9, 0x1e331ef0, 0x0000fda3, 0x957d95e9, 0xc99ad77c, 0xccc8cc6a, 0x00009df7,
+        0xa42fa44d, 0x9ccad8e4, 0x410a4164, 0x000012a4, 0xc844c884, 0xc79cb937, 0xc29cc21b, 0x00001e79, 0x20dc2051, 0xe9209581, 0x668366fd, 0x0000678b,
+        0xfdc7fd09, 0xb712b0c1, 0xdae7da5a, 0x00008818, 0x99b49915, 0xbfb49b35, 0xeef0eeb2, 0x0000ddde, 0x4f5d4fdc, 0xa745aaf3, 0xf814f8b0, 0x0000a701,
+        0xdeefde60, 0xbc1b24d7, 0xeaabea88, 0x0000ec16, 0x99659956, 0x5dc8febd, 0xd8a7d855, 0x00001ac4, 0x1bcd1b67, 0xafd0a72c, 0xe74ce781, 0x0000d889,
+        0xea7aea90, 0xac0db43f, 0x1d9a1dab, 0x00002902, 0x5ea15e70, 0x726952b1, 0x103d10b6, 0x0000475d, 0x492f4955, 0x7a859d9a, 0xb19cb19d, 0x00005f76,
+        0x51dd51d7, 0x5822a15f, 0xe956e94f, 0x00000089, 0x0b590b4b, 0x049bc37f, 0xb7e8b7b7, 0x0000031b, 0x3404343e, 0x9bad0449, 0xbf3cbfce, 0x00002475,
+        0x473147ce, 0xe7210ad4, 0x5d9f5d29, 0x00003a2c, 0xe6fce68a, 0x9737b3a5, 0x6f5c6f81, 0x00001495, 0x386b3842, 0x289ca165, 0x39683997, 0x00006dd6,
+        0xe04be0c4, 0xaa2f0a58, 0x94ad94ac, 0x00007803, 0x3ec83eb4, 0xc8c44f07, 0x6b486bed, 0x0000f1ab, 0x44a54441, 0xab4b3d4f, 0x065e0605, 0x0000c232,
+        0x1ac21a42, 0x00a4ad14, 0x12f71243, 0x00006d19, 0xb36fb3d7, 0xd5300cb6, 0xfdb6fda2, 0x0000e28e, 0xa0fba0c4, 0x513f86fe, 0xc9a3c98a, 0x0000307f,
+        0x017501da, 0x2752aace, 0x4f334f22, 0x0000ce07, 0x26f426db, 0xb67619d0, 0xd359d37a, 0x00003c7a, 0x1fc61f27, 0x0b341851, 0x2d6f2d77, 0x000056c1,
+        0xf036f0bd, 0x29633883, 0x5613567d, 0x00005bb0, 0x01dd01d6, 0x60a5167d, 0x5dbe5d4a, 0x00001c0b, 0x7fc57f5f, 0x6c006d2b, 0x92d6924e, 0x0000c791,
+        0x5e345ebb, 0xdbef03c9, 0x38f4384a, 0x0000c97d, 0x034e03d9, 0xdcee9fe7, 0x6f676ffd, 0x0000fa5c, 0x43c94322, 0x229247b2, 0x2ae12aff, 0x00001217,
+        0xdce5dc14, 0x8b42f1d4, 0x6a886a3b, 0x0000d89d, 0x2336237a, 0x26218e20, 0x400a4093, 0x00004904, 0xb357b30d, 0xda6b8ca3, 0x56ed564b, 0x00007170,
+        0x2a2e2ad6, 0x5b86e2fd, 0xda60da1b, 0x0000a518, 0xa190a17c, 0x5d68103e, 0x2b062bcf, 0x00003dcc, 0x688068a9, 0x58ddfefc, 0x88518844, 0x000031b6,
+        0xa6c3a650, 0x78a6c417, 0xe936e9da, 0x00001b7b, 0x9b549b9f, 0xfcf7dba6, 0xcd5dcde8, 0x0000781e, 0x3ea53ec2, 0x2b925241, 0x0b160b1b, 0x0000faa0,
+        0x8a438a9e, 0x41b99fd7, 0x28b82888, 0x0000df33, 0xd471d46a, 0xc3355ea3, 0xf3bef314, 0x0000c841, 0xab0cabc6, 0xb229bc37, 0x02ee0256, 0x0000ab08,
+        0xc614c697, 0xecf24a1f, 0x361f36d7, 0x0000231a, 0x3c0a3c20, 0x999d3a16, 0xd258d24f, 0x0000ae85, 0x454d4568, 0x8537b5d9, 0x7a047ad2, 0x0000e8e8,
+        0x4b2a4b4c, 0x6ec2d1bf, 0x07da0765, 0x0000f5e7, 0x762c7663, 0xc655ce7a, 0xab9eab33, 0x00002586, 0x51e151cb, 0x93719800, 0xe451e495, 0x0000e4ad,
+        0x38ce3890, 0x1c49a4d4, 0x3f0a3fdc, 0x00002466, 0x620b6265, 0xa0a14f96, 0x5ef15e6a, 0x0000b6a8, 0xb722b73e, 0x5d17665b, 0x1de51da7, 0x0000a999,
+        0x12ea12f2, 0x1acb9070, 0x723e7249, 0x000093d1, 0x960896d5, 0x25a23df2, 0x707470c7, 0x0000e589, 0x70307034, 0xb154d54f, 0xd79fd728, 0x00007a5e,
+        0x6b926bf0, 0x1bfcc408, 0x698d690e, 0x0000c657, 0x45b5458d, 0xfd8db280, 0x565c56b3, 0x0000125a, 0xb421b4b9, 0x0bb5c4b8, 0xee7aee83, 0x0000d96d,
+        0xce82ceae, 0x327628fb, 0x266c265b, 0x00009ac1, 0xc309c37d, 0xda381442, 0xc9c2c92f, 0x00008bbe, 0xef79ef3b, 0x57892e47, 0xec50ecec, 0x00004615,
+        0x6a546a6d, 0x877efc7b, 0x9cb49c19, 0x0000735e, 0x018f013e, 0x55bf1cd8, 0x92839281, 0x0000db2e, 0x96a696d0, 0x58c69741, 0x2e102ede, 0x00003679,
+        0x05f605f4, 0x566639c0, 0xe25ce282, 0x0000af0d, 0xabcfab9e, 0xf3c2a3e5, 0x284228e2, 0x00001b44, 0x5fd85fd1, 0x2ec9a366, 0xd053d033, 0x000015e9,
+        0xe666e690, 0xa5f2f8c5, 0xe7c6e7db, 0x0000e5d2, 0x8cc88c11, 0x5ab20c5e, 0x3e303e28, 0x0000d8f4, 0xb4ceb43c, 0xddf95152, 0x6c656c3f, 0x00007623,
+        0xc222c284, 0xd24076a9, 0x4563454e, 0x0000531f, 0x641d6430, 0xa1b4e3ed, 0xfc26fc85, 0x00009615, 0x983198b3, 0x7530e393, 0xe54ee50a, 0x0000039f,
+        0x5860583a, 0x1d6b66d8, 0x9c759c53, 0x00002052, 0x05770551, 0x6c60edb0, 0xcf1dcfc3, 0x000084dd, 0x5f075f51, 0xd8dbdd6c, 0xd337d38d, 0x00000100,
+        0xf538f54f, 0xbe0356ff, 0xa5e7a51c, 0x0000df1f, 0xf897f8b7, 0x9ae62ac6, 0xf04bf010, 0x00002c75, 0x2e002e3f, 0xe4bca72c, 0x829782f0, 0x000020c5,
+        0x2705273d, 0x8644685c, 0xe539e55b, 0x00009d90, 0x510e51a0, 0x0bcb6108, 0xf714f7e1, 0x00004ec0, 0x5a565ae4, 0xed83f460, 0x7cc27ce6, 0x00005db4,
+        0x992499e3, 0xf7ae3807, 0x671b6770, 0x0000ec07, 0x15511546, 0x0e7c9a94, 0x23242382, 0x0000bfe5, 0x5401545d, 0xf3f4f524, 0x72077255, 0x0000030c,
+        0xcc3fccd8, 0x68400146, 0x13701344, 0x00000ad3, 0x4d404d89, 0x1f642dcb, 0x22b4228b, 0x00002f0a, 0xca20ca16, 0xd38b231c, 0x9f659fd6, 0x0000f652,
+        0xf689f69f, 0x41242c1d, 0x463746a5, 0x000074b0, 0x4ce74cfe, 0x7b1da9b4, 0xec12ecc3, 0x0000e42b, 0xdf4ddf58, 0x33abfe08, 0x00c200d0, 0x0000a0bb,
+        0x1382135e, 0xba4f44e9, 0x4863482c, 0x0000a95a, 0xf1b6f17e, 0x080ae7e2, 0x3656364b, 0x000048f0, 0xb515b560, 0xf3a09bbe, 0xe9fce9ba, 0x00002520,
+        0x62f56256, 0xa98ecfa9, 0xe716e7c8, 0x0000e703, 0xc3efc301, 0x2a82aae2, 0x5b815bac, 0x00004d30, 0xba0aba03, 0x51ee0556, 0x4e6d4e44, 0x0000aba7,
+        0x4fe04fd0, 0xbf13a62f, 0xf2e2f2b0, 0x0000f26b, 0xf7e4f76d, 0xb73ca823, 0xde48def3, 0x00008031, 0xedb6edd3, 0x1d40c88e, 0xc0c2c02b, 0x000047ee,
+        0x75857580, 0x2d433b37, 0xb6e9b6b8, 0x00009698, 0x456d45d6, 0xec81e84f, 0x934a934c, 0x0000d7a4, 0x452045b1, 0x5817fb4e, 0x9db09dd0, 0x00000e6f,
+        0x790c791a, 0xe7e3b7e9, 0xd735d7c1, 0x00002353, 0x018e01be, 0x53592c3a, 0x38e93893, 0x00000272, 0xa874a836, 0xd1feddfb, 0xc370c3f2, 0x00005dae,
+        0xcc6fcc6d, 0x54c8900d, 0xd4eed440, 0x0000376c, 0x330d3355, 0x1e052629, 0x76c576e0, 0x0000ef48, 0x921c927d, 0xe4626166, 0xc0bfc040, 0x0000dae4,
+        0xd3c0d377, 0x5bcb0f39, 0xbbffbb0a, 0x00002f0a, 0xa1a5a1b8, 0x036ef1d6, 0xd524d5f8, 0x0000135e, 0x465246de, 0x113414c1, 0xd497d413, 0x000076f3,
+        0x8a968a69, 0xb38e5b06, 0x49a749c5, 0x00001c92, 0x03d70346, 0xd7c8d0be, 0x95e095c3, 0x00006f2a, 0xb4e6b43f, 0x509cf057, 0x52395209, 0x0000acb9,
+        0xa9a1a91b, 0x5068c6de, 0x828a825e, 0x00008e2f, 0x8c0b8c60, 0x9207af54, 0x44df4463, 0x0000bcce, 0xdbaedb19, 0x44429bb4, 0x7cd17c3a, 0x00006b15,
+        0xd847d821, 0x829f2629, 0x1b0a1bf7, 0x00001e22, 0xd06bd01d, 0x2623fd76, 0xa912a996, 0x00001017, 0x6bf96bee, 0x0dcb4a9d, 0x2b8d2b1b, 0x00005d19,
+        0xc7d1c70a, 0xfb6e403a, 0xa8e1a8a5, 0x000013e3, 0xbf53bf25, 0x0e8a3bce, 0x75fa75e8, 0x00000f00, 0x540a540a, 0xdaabf946, 0x547054c2, 0x00008b30,
+        0xdceadc9d, 0x89887d01, 0xbf85bf28, 0x00005b1c, 0xaa37aa6d, 0xd7ebfd3b, 0x127012aa, 0x00003541, 0xa586a55c, 0x9f180ae6, 0x1f441ff9, 0x0000fb01,
+        0x3f273f21, 0x6358c5e7, 0xed90eda3, 0x0000f627, 0xc71bc7fe, 0xb68b3764, 0x920a9227, 0x00005844, 0xa202a22c, 0xd3cb0d24, 0xcbe7cbf8, 0x00002635,
+        0x243924c3, 0xc9667b9d, 0x713e713a, 0x0000bbc1, 0xb44cb40d, 0xd10826af, 0x600c6083, 0x00002780, 0xdcd3dc8a, 0x41f608a2, 0x483448a8, 0x00005958,
+        0xa125a151, 0x6b206d3a, 0x52215220, 0x000062d0, 0x5a6c5a47, 0xe32ca052, 0x9bb19b79, 0x00005046, 0x26ac26fe, 0x48c94adf, 0x852d852e, 0x0000c37a,
+        0x41a9418a, 0x210f5772, 0xe7dde70b, 0x000000bf, 0x4cb34cb9, 0x2411b15f, 0x119b1172, 0x0000a519, 0x66996625, 0x4ef64638, 0x04e70483, 0x00002af9,
+        0x80ee801d, 0x2aa2e575, 0x7fa47fc4, 0x0000b35f, 0x8aca8a18, 0xa5c238ff, 0x9daa9d54, 0x000081a3, 0xbc4dbcb4, 0xd6e16b2b, 0x6658666c, 0x0000751f,
+        0x167e169e, 0xd47222aa, 0xc0c2c02d, 0x00009667, 0x3a7b3a33, 0xa27ef5dd, 0xa708a7b6, 0x0000d10d, 0x649a64ce, 0xe9a33a30, 0xe0d5e046, 0x00004af3,
+        0x282b2860, 0xddf858e3, 0x3e1c3e71, 0x0000a0b5, 0x14691499, 0x17958be1, 0xb4c2b43d, 0x000077d0, 0xb2a1b289, 0xdf1af0cb, 0xaf66afc2, 0x0000afff,
+        0xfbbafb3d, 0x08829d61, 0xe16de136, 0x0000cfaf, 0x4a3b4a98, 0xc43ad643, 0x0ff80f51, 0x0000ddea, 0x532653a0, 0x013882ce, 0xcb44cb04, 0x0000dae5,
+        0x4c6e4c9b, 0x71122771, 0x13011380, 0x00007470, 0x626c625d, 0xd0ac6063, 0xb9f6b9cf, 0x00000072, 0x8c038cd2, 0x24195303, 0x3b4c3b4e, 0x0000e672,
+        0x19af19aa, 0x84071355, 0x4002407b, 0x000092c0, 0xcab2ca7d, 0xaa4f0074, 0x829b828e, 0x000037cf, 0x483048b8, 0xddae2b30, 0x77d7773f, 0x0000194c,
+        0x62146225, 0x2aedb4e7, 0x1f191fcb, 0x0000ea17, 0xde96de9b, 0x88a714c6, 0x481e4838, 0x00005fb4, 0xb709b701, 0xdf6117b2, 0x6d1f6dc7, 0x0000a055,
+        0xdd17ddd6, 0xe9d37819, 0xe2fce261, 0x0000ab85, 0xc4d6c405, 0xe958968e, 0xf393f379, 0x000050c9, 0x26032602, 0xde302334, 0xe7b3e7f5, 0x000068e1,
+        0xb5e5b528, 0xe0e3e125, 0x11be11a2, 0x0000dcb7, 0x8f878fa5, 0xc0d64f29, 0x790f797e, 0x00007ca3, 0x0ab10aaf, 0xae5b41b9, 0x35d23522, 0x0000c4cd,
+        0x81a3815f, 0x128a1a78, 0x69586975, 0x000087ba, 0xdb44db98, 0x53072e80, 0x3f733f0e, 0x000086dd, 0xc0cac089, 0xac8130a6, 0x19ab1913, 0x00004610,
+        0xb28ab258, 0x829fdf5d, 0x5944595a, 0x00002c8e, 0x57145770, 0x98885681, 0xb7a4b7db, 0x00004ef7, 0x3177312b, 0xa5724fd7, 0x37ab37af, 0x00005597,
+        0xaf5faf1c, 0x4ad6adc0, 0x500d5064, 0x0000261f, 0x82578220, 0x01fa201e, 0x636c6338, 0x0000348d, 0xd2d5d2be, 0x632270d6, 0x56b456a2, 0x0000be9c,
+        0x8b978b93, 0x92ea9e2a, 0x2c8e2ceb, 0x00003c4d, 0x07e70706, 0xefc5ee93, 0x3cc73c70, 0x0000864e, 0x33a2335b, 0xb01ca652, 0x306e3031, 0x00007e29,
+        0x24492448, 0xbe6dfa17, 0xfb76fb44, 0x0000be6f, 0x662166e2, 0x0f0a96be, 0x1d641d9c, 0x0000a045, 0x5edc5e36, 0x0049ceee, 0x8c668cf5, 0x0000e335,
+        0x96b396a0, 0x127124d4, 0x84a0848b, 0x0000a377, 0x2ebd2e3c, 0xad0d5dae, 0x35e535eb, 0x00002675, 0x2ef42ed9, 0x99f1956a, 0xd9a3d99b, 0x00001498,
+        0xd0b4d0c3, 0x9beda5ab, 0x04660435, 0x00006848, 0xa0b0a0d0, 0xa61d8a69, 0x995299e5, 0x000008ed, 0x31f731f0, 0x9fa637dc, 0x16a216ef, 0x0000e816,
+        0x1e881e5f, 0xbb947252, 0x2110214f, 0x0000448f, 0x54765451, 0x1593fa63, 0x8f098f69, 0x0000c02c, 0xeb2beb20, 0x711aa25f, 0xff95fffc, 0x0000727a,
+        0xcfc8cf96, 0xa94da8b8, 0x05990580, 0x00003b6f, 0x4ca64ce8, 0x9a81fecb, 0x663066c4, 0x000040cd, 0x71cc718d, 0xdd7003c8, 0x27202726, 0x000075d1,
+        0x6eb26e44, 0x8947bdc3, 0xb4a4b40a, 0x0000f293, 0x5fb25f7e, 0xc209d0da, 0x6a306a2f, 0x00007e9c, 0xefc0ef53, 0x3acb7050, 0x3f633f91, 0x000042f0,
+        0xdec1de18, 0x2282c763, 0xbcd7bc4b, 0x00007752, 0xbc6cbca5, 0x0eb0b059, 0xdd9bdd26, 0x00006b41, 0x90619086, 0x3b538081, 0xeb6ceb8d, 0x0000771f,
+        0x59a959fe, 0x38af9238, 0x6b576bf6, 0x00000acf, 0x08a20837, 0xd8ef166a, 0xd564d5cf, 0x0000028e, 0x7b337b64, 0x332fdeed, 0xd5edd5ae, 0x00002af9,
+        0x8939894d, 0x3202c184, 0xdd6add6b, 0x00009b19, 0x1c271c18, 0x50a70425, 0xf675f65a, 0x00005084, 0x4c5d4c2f, 0xfc3d2a39, 0xa68fa675, 0x00008850,
+        0xc431c47f, 0x8d061646, 0x1319136a, 0x00009b86, 0x9b729b4d, 0x973efdb8, 0xb910b9c1, 0x00002ddb, 0x6caa6cdd, 0x28eb9ce0, 0x7d7f7dc4, 0x00009aae,
+        0x501a50cd, 0xc2c21cd8, 0x4d294d5e, 0x000010f7, 0xe774e791, 0x39e16b49, 0xcaffcab7, 0x00005554, 0x58535817, 0x35488da1, 0x751e75bd, 0x0000b149,
+        0x61a661a9, 0x4b08a1d1, 0x3f5b3faa, 0x000072be, 0x41494100, 0x0d6c12b4, 0x13a513b9, 0x00005484, 0xf264f28a, 0x8157b2a1, 0xc8fac842, 0x000055fe,
+        0x55c855e9, 0x9a887a44, 0xddffdde3, 0x00006d17, 0xcd38cd3d, 0xdd89693a, 0x256f2578, 0x00009e46, 0x9c219ce4, 0xfdfc70af, 0xb217b285, 0x000052c8,
+        0x0a480a29, 0x5578e721, 0xcc12ccc2, 0x00003c9d, 0x4a304a54, 0x4ec928bf, 0x974997b0, 0x00002c75, 0xe7b0e73a, 0xd0db7dfd, 0xff39ffcf, 0x00005b1d,
+        0xa0cfa060, 0x2492c933, 0x871d8726, 0x0000638b, 0x86c086ff, 0x90421eac, 0xed0fed97, 0x00005e68, 0x67926742, 0x42b9b85b, 0xd799d79d, 0x0000d3eb,
+        0x0b360b7a, 0xda18f1d1, 0x6caa6cda, 0x0000c17d, 0x3a4b3a59, 0x53b88b53, 0x05170523, 0x0000d777, 0x31e231b4, 0x0a1cb13f, 0xa32da3fe, 0x00004e08,
+        0xa0cfa0d2, 0x6bcd61b9, 0x0af00a77, 0x0000c4cd, 0x6d236d25, 0x75edda01, 0x52285236, 0x00005009, 0x58cb58b5, 0x11bc7551, 0x728072bb, 0x00007556,
+        0x7edc7e79, 0x55563492, 0x699869f8, 0x00003869, 0xd508d56b, 0x2df276da, 0x9c879c2f, 0x0000701b, 0xca00ca2c, 0x1daac9b7, 0x2dd52dcb, 0x0000bc24,
+        0xd893d86a, 0x22c702ca, 0xb6d3b632, 0x0000e06c, 0x5e6e5e14, 0x76756fca, 0xe7f9e740, 0x00001c88, 0xa5f9a5a9, 0x25a2f4a9, 0x20932057, 0x0000be2f,
+        0xb31fb37f, 0x1755b3d8, 0x329132ea, 0x00003364, 0x54d354fe, 0x02fa18f3, 0xcfffcf42, 0x0000ca40, 0xa583a5d6, 0x1dd60f70, 0xe54ce59a, 0x00009b8a,
+        0xefd3efb5, 0x9c53d735, 0x545c546e, 0x0000c4cd, 0x13ea1300, 0xba473f0d, 0xcc86cc9d, 0x00004070, 0x48a7484a, 0x58d8723e, 0xbd5fbdbc, 0x000034dc,
+        0xc50ac57a, 0xc865b894, 0x0ccb0c06, 0x000052a7, 0xfd70fd8c, 0x29624033, 0xfe68fe61, 0x00003454, 0xc4b2c44e, 0x3ddfc9e3, 0xfc26fc64, 0x00008c57,
+        0xe15de17c, 0x64cd5ae0, 0x26062698, 0x0000c593, 0xa875a8c5, 0x43991778, 0xcde9cd52, 0x000027b9, 0xfad8fae5, 0xb47589ee, 0xdd6add3c, 0x0000a864,
+        0x89f28952, 0x6922affe, 0xd49ad4fb, 0x00005f3d, 0xea22ea22, 0x115568f4, 0x6bfe6bca, 0x0000f963, 0xc3b7c381, 0x50e48da1, 0x87ee87ed, 0x0000e969,
+        0x74317435, 0xc1f421de, 0x036b030c, 0x0000a847, 0x6b366b6f, 0x8af5bc62, 0xc2e9c24d, 0x000017d5, 0x918491d5, 0x744a84a3, 0x4f784f90, 0x0000cc98,
+        0xd03ed054, 0x8dd701ca, 0xbf18bff7, 0x0000466e, 0x6056608a, 0x5fb24dd6, 0x1dc61d36, 0x0000db57, 0x9e909e2c, 0x419987cf, 0xc5eac517, 0x000038b8,
+        0xcd73cd42, 0xd7bb693a, 0x7c877c2f, 0x00001888, 0xa074a0f8, 0xd6dff2eb, 0x587b58c6, 0x00002986, 0xbf36bf07, 0xc62562d6, 0x60ae60c7, 0x000063a6,
+        0x5afb5ab8, 0x71e28fc1, 0x944594e9, 0x00001bf4, 0x40724068, 0xcdfb74d0, 0x4eaa4e00, 0x00007eac, 0xb668b653, 0x7e51c5b6, 0xc55ec5e3, 0x000004cd,
+        0xc7bac720, 0x13835cd5, 0x4d5d4dc2, 0x0000c2e7, 0x265f262b, 0x336e27ab, 0x39a63945, 0x0000c9f2, 0xbb54bb13, 0xa4a18f2e, 0xbdbdbd11, 0x0000b905,
+        0xf9f3f924, 0x512c53bc, 0x850b8573, 0x0000f6bd, 0x67756784, 0xbe71c78b, 0xc683c672, 0x00001117, 0x2e4b2e9f, 0xc82ad2c6, 0xb189b105, 0x00009369,
+        0xe014e0da, 0x88a73221, 0x91f1914d, 0x00002ef8, 0x3ba33b2e, 0xd0cb779d, 0x4d0d4d32, 0x00008f97, 0xe341e3c3, 0xc4b6de18, 0x2d302daa, 0x00007e0a,
+        0x2fdc2f52, 0x2182698b, 0xfebbfe95, 0x000063c9, 0xf767f73b, 0x43667fc6, 0x1435141c, 0x0000a5f6, 0xc21dc2f8, 0x944c6fca, 0xd21ed201, 0x00009b6b,
+        0x8eef8e75, 0x2c224d48, 0xbdcbbd8d, 0x00006fea, 0x8fed8f89, 0x52522756, 0xb527b537, 0x00003d06, 0x37aa37ae, 0x660335df, 0xd74ad765, 0x00007351,
+        0x41484106, 0xf88846db, 0x93009348, 0x00006826, 0x0648068d, 0x53a728f9, 0x2141217d, 0x000006a0, 0xb4ebb44f, 0x2dc12c60, 0x08710868, 0x0000c782,
+        0x15d0155d, 0x9f3b29c4, 0xcc48cc50, 0x0000b743, 0x8c648c53, 0x3472e685, 0x2449240f, 0x00000b71, 0x6d326d25, 0xf751a90b, 0xca6bca44, 0x0000ec74,
+        0x9a629a59, 0x101c7f42, 0x1c9e1ce5, 0x00000ef1, 0x584458ea, 0xac5a7ebb, 0x84168435, 0x00004e08, 0x20102041, 0x9216f7cb, 0xe4bde490, 0x0000cd1f,
+        0xc35cc3fd, 0xbbd1ca00, 0xfd29fdc5, 0x0000b811, 0x05a605c1, 0xe986d64a, 0xfd4bfd10, 0x000009d3, 0x29782938, 0xafe04bb2, 0x1732179f, 0x0000f7d8,
+        0x3509352d, 0x5b4d1a8f, 0x3a773a36, 0x0000cdce, 0x26cf2618, 0xf4211043, 0x0e5c0eca, 0x0000a555, 0x916b9154, 0xf12596be, 0x296f29b3, 0x0000608b,
+        0x00cf0089, 0xffb619d3, 0x37a03714, 0x0000439f, 0x3bdb3bd3, 0xde544848, 0xb194b1bd, 0x00003824, 0x54b15434, 0xab138336, 0xd0bdd0b3, 0x00001ee3,
+        0x5bfc5b3c, 0x5256a39d, 0x955e95e7, 0x000082a2, 0x9a239a3b, 0x614f44e9, 0xdddadd74, 0x00009c34, 0xed1eed04, 0x45c62efb, 0xfec2fe31, 0x00001ea5,
+        0xada6ad52, 0xf4c261fa, 0x764576ab, 0x0000b6e5, 0x4e214e3c, 0x8b43bbfb, 0x508f504d, 0x0000bea2, 0x6fdf6fd4, 0xf103a840, 0x8bfe8b12, 0x00005008,
+        0x78217833, 0x3448675a, 0x2de02d6d, 0x0000cfaf, 0x5ad85a68, 0xa0f5a09b, 0x86f6862a, 0x0000fab8, 0xb3e1b375, 0xdf75e760, 0xfe0ffe31, 0x0000d992,
+        0x823d8250, 0x84877da8, 0x2bf82bb9, 0x00000a72, 0x32c0320b, 0x188c0ad9, 0x57ad5756, 0x00006b17, 0xa0e3a00d, 0xfb0bc89c, 0x6bc36b2b, 0x0000d96c,
+        0xdf8ddf14, 0xe583252b, 0xb114b170, 0x00009b16, 0xd93ad9f9, 0x2178d487, 0x50fa50d3, 0x0000ae08, 0x3d7c3db5, 0x6033ba87, 0xb7a7b7b9, 0x00002867,
+        0x5a625aa4, 0x5a4e8c0b, 0x069b06d5, 0x00005ae8, 0xf83bf8c4, 0x8bbfa15f, 0x356335e9, 0x0000ad85, 0x47494791, 0x12d0b8c9, 0xafa8af68, 0x000093a8,
+        0x87f9871e, 0x8326c423, 0x30f13052, 0x00002486, 0x99e699ba, 0xc5f48100, 0xf501f5b2, 0x00005bb0, 0x67186770, 0x66116062, 0x72d872cd, 0x00002909,
+        0xaa6baa60, 0x245a89e5, 0x8e288e23, 0x000073fb, 0x772a7740, 0x16be8ce2, 0x9c789c04, 0x000083be, 0xc219c2a5, 0xcdeb9a95, 0x2b6e2b61, 0x00001cf5,
+        0x20d22046, 0x3c18c418, 0x2f402f73, 0x0000c512, 0x59875972, 0xd41ea7aa, 0x0eb20e82, 0x0000bf5c, 0xade2ad68, 0x399acdaa, 0x9d159d0f, 0x0000735f,
+        0xca45ca1a, 0x2183eef1, 0x1d601dde, 0x00004a0d, 0xd155d1ae, 0x0f68964f, 0x493e4976, 0x0000eb89, 0xae84ae9b, 0x0b243763, 0x735f73c1, 0x0000d675,
+        0x65e465d3, 0xf5eeeef2, 0xb082b02e, 0x0000a165, 0x8584858a, 0x3fe867fa, 0x143e14b2, 0x000055fe, 0x3b073b43, 0x5d6854b1, 0xedf1eda4, 0x0000908a,
+        0x7a6a7a94, 0x0dcbbf75, 0x80508063, 0x00005ae8, 0x1f7a1ff9, 0xe562d675, 0xfc4dfcfb, 0x000022ff, 0x994099e8, 0x57663fcf, 0x77ea7747, 0x00001dac,
+        0x438c4347, 0xe82250cd, 0x77ec77b8, 0x000099b7, 0x259e2581, 0x81f7cf2e, 0x2b032b35, 0x00001617, 0xc25ac2d8, 0x0726bf7f, 0x50525002, 0x00005cb0,
+        0x5c375cc5, 0xd34856b2, 0x281328e9, 0x0000da24, 0x8cf88c2f, 0x310aaa03, 0xd51cd581, 0x0000d81b, 0x04110448, 0xb94971d9, 0xbd4abd35, 0x0000f405,
+        0x3e213ee6, 0x4266b0da, 0xe831e827, 0x00003b26, 0x243224ce, 0x57af3df9, 0xfa0afa22, 0x0000f9a1, 0xce34cec2, 0xe1cf55b1, 0x450d4534, 0x0000f901,
+        0x5065504e, 0x8fc494be, 0x465b46ca, 0x00002f24, 0x53be5355, 0x436fecef, 0x46fa4618, 0x0000ae88, 0x744274bd, 0x66af3c71, 0xa36fa33a, 0x0000fca0,
+        0x734f73fb, 0x89478bde, 0xe0d3e0ed, 0x0000378c, 0x0b320be4, 0x24663e80, 0x67756726, 0x00007a31, 0xa2c5a235, 0xb1a31b53, 0xcd7dcdaf, 0x0000436e,
+        0xfe5efe33, 0x1c4efa4e, 0x07b107ea, 0x00004943, 0x456f452a, 0xd08a31df, 0x96c79668, 0x00000ed9, 0x44684442, 0x706d74d9, 0x45614519, 0x00006470,
+        0xd89ed827, 0x18caf2ac, 0x96459684, 0x0000f7ba, 0x446d44d1, 0xf9d92360, 0xc8ffc843, 0x000021ad, 0x94209443, 0xce3a55ce, 0xe38be37a, 0x0000b7cd,
+        0x41ae417e, 0x88f60bd9, 0x0b660b66, 0x0000c8aa, 0x74ae74b7, 0xc3d62b39, 0x0f150fdf, 0x000026ff, 0x2b2e2b17, 0xb7c87943, 0xdd3fdd4e, 0x00007e61,
+        0x6b256bd7, 0xd7e46508, 0xbf9dbf9d, 0x0000c5b2, 0xe0dbe05d, 0xb584b9c7, 0x7869788a, 0x0000cc69, 0xe268e2c4, 0x15959edf, 0x20a320f9, 0x0000e8f6,
+        0x533253f5, 0xcc18d643, 0x69916933, 0x00009e5d, 0xb9ddb9b3, 0xd404d8a5, 0x5bcd5b87, 0x0000af77, 0x9c1c9cae, 0xbd68f9bd, 0x6a3d6a19, 0x00002c66,
+        0xb1f7b152, 0x346fc41f, 0xd179d182, 0x0000e99b, 0x361d3683, 0xf5299aef, 0x2e472e2d, 0x0000beef, 0xd927d969, 0x8ee0b8d7, 0xac35acf5, 0x00008994,
+        0x5a675a5b, 0x48f7e91b, 0x6f1e6f58, 0x0000ff63, 0x1f2b1f0d, 0x313ce75f, 0x398d3900, 0x0000dd47, 0x4b3a4b60, 0xa143da5b, 0x2bd52bdc, 0x000069c9,
+        0xdc4adc0c, 0xaad2a946, 0x270f2798, 0x00002675, 0x18ad1899, 0x48a8ebcf, 0x3ccf3c71, 0x00005c29, 0xa1d4a1d8, 0x2153534f, 0x089508e3, 0x0000d666,
+        0x79a87999, 0x31a86095, 0x630e6346, 0x0000b18e, 0xa459a411, 0x86283bf0, 0x64296454, 0x0000540d, 0x15a01549, 0x711296c1, 0xfa95faf0, 0x0000936a,
+        0x633563b9, 0xec6c6b5a, 0x4c1b4cbb, 0x00009be8, 0x310c3173, 0x41f99def, 0xe0a0e00a, 0x000047b0, 0x0a850ac6, 0xdb5bab7c, 0xdaf2da5d, 0x000071ee,
+        0x3bbc3b83, 0x6b1c8e3d, 0xd74ad7ec, 0x0000748e, 0xebd3ebda, 0xf2b602b4, 0x17331723, 0x0000e103, 0x883e88ac, 0xf89b8ce1, 0xb575b506, 0x0000aa5a,
+        0x5fa35f21, 0x5691d8da, 0x4c194c67, 0x0000297b, 0x982798e2, 0xb5cc4382, 0x083e089d, 0x0000689e, 0xade8ad42, 0x6fead2f6, 0x661f66b4, 0x000098d8,
+        0x67786714, 0x558dcae3, 0xdb31dbc7, 0x000089d0, 0x6fd56f4b, 0x0ff949af, 0x0e200ebe, 0x00001228, 0xcbbacb66, 0x4e45c23d, 0xcb28cbbd, 0x000007d3,
+        0x36d53636, 0x5b78616b, 0x25992584, 0x00003cb8, 0x0c920c02, 0x8604e0ef, 0x355d35d2, 0x00004af3, 0x5d215d36, 0xd81bfa91, 0x252e2515, 0x00004685,
+        0xade5adc9, 0x3a01327e, 0x891c896c, 0x00002df8, 0xae60aece, 0xae9aaf89, 0x019301a1, 0x0000be6f, 0x5c315ce3, 0x82171bec, 0x33a133d1, 0x0000af66,
+        0x863a8607, 0xb0bba11a, 0x7501752a, 0x00004b3a, 0xe9f0e95a, 0x0b3431a0, 0x73e5738c, 0x0000dcde, 0x472047bc, 0x98f369f4, 0xc9aec98c, 0x00007db1,
+        0x02010268, 0x7312a22a, 0x995399c4, 0x0000c532, 0xcc0dcc94, 0xbbdba614, 0x0aa80ac8, 0x0000384c, 0x697c6999, 0x00f97517, 0x884c88b9, 0x00004004,
+        0x45f5458f, 0x4a089cee, 0xdb59db92, 0x000029db, 0xa68aa632, 0x4439f657, 0x120a128d, 0x0000014d, 0xc6b0c67f, 0x78c144db, 0xceb5ceff, 0x00004266,
+        0xb0e5b019, 0x83e0ce30, 0x64ca6498, 0x0000fb82, 0xd256d273, 0x611bb218, 0x465946ad, 0x00006a44, 0xd507d569, 0xff4cab3e, 0xa1dea1df, 0x0000274a,
+        0x9784974f, 0xf75136d0, 0x9a629a23, 0x00000d3c, 0x28bd28e2, 0x3adf9744, 0x5606563a, 0x00003a9e, 0xe02de0c4, 0xa391f0af, 0xccf5cc4e, 0x0000fffd,
+        0xdd7ddd91, 0x29b69d9a, 0x3425349f, 0x00009214, 0x33ca3308, 0x65cd7349, 0x61a76168, 0x0000027f, 0x4eba4e89, 0x1f3a5e11, 0x86088602, 0x0000ba11,
+        0x00410015, 0x5f20111b, 0x131a1369, 0x0000a838, 0x960d96d4, 0x079b675a, 0x26f82647, 0x0000d75b, 0x6e076efe, 0xf0f54db6, 0xe2c3e2aa, 0x00001c93,
+        0xb99db9a3, 0x8488f0ac, 0x483148d3, 0x0000d17a, 0x33083353, 0x9efa601e, 0x77dd7760, 0x00008d90, 0x8780877d, 0x230fbc37, 0x56095652, 0x00002b49,
+        0xbe25be58, 0x78d843f5, 0x2879286e, 0x00001ea8, 0x0483046a, 0xc3c2fff0, 0xf40bf473, 0x00000ff5, 0x92679274, 0x4b098f5d, 0x2d6c2d87, 0x00000eca,
+        0x410d4135, 0xa6236296, 0xbdd2bd37, 0x00005854, 0x2be32bbf, 0x953945f8, 0x9e769e91, 0x00003e4c, 0x8dc78def, 0x8f6e0486, 0xd4bbd470, 0x00009c30,
+        0x51cf5180, 0x8ee76a2b, 0x667f66b5, 0x0000d874, 0xbe80be5e, 0x112f0714, 0xd74ad7e6, 0x0000e17b, 0x064a06ff, 0x9206f5e8, 0x33733334, 0x000054fb,
+        0xc82fc819, 0x28223c4b, 0x6575656c, 0x00004ba3, 0x6cca6c1c, 0x861f6cf7, 0x81538163, 0x000087df, 0xfd0afd47, 0x145028ff, 0x638f6380, 0x0000ee74,
+        0x2eb82ec5, 0x65c3f83a, 0x0f9b0f1f, 0x000083a2, 0xfc99fc7e, 0xb734e0dc, 0x034003fc, 0x0000a0e9, 0x5e905eb8, 0x5f534bca, 0xbb41bba2, 0x00004851,
+        0xe7d3e770, 0xd9bce84e, 0xda97daf0, 0x00004190, 0xa6fea609, 0x901cf790, 0x11ed119f, 0x0000b13a, 0x1ca11cf1, 0xf35ab61b, 0xae34aec8, 0x0000fd0d,
+        0xba0dbaa8, 0x44c164a4, 0xb56fb5a2, 0x00003a13, 0x0bea0bc3, 0x79673dff, 0xb91bb959, 0x0000fa17, 0x90ac90d9, 0x3b56817b, 0xc9eec9d3, 0x0000d005,
+        0xef4def71, 0xca668d1c, 0x9c6f9c7e, 0x0000cece, 0x0f280f53, 0xc9fb26cb, 0xa65ba604, 0x0000d6ca, 0x2cd72c74, 0xce2afc05, 0xfa06fa6a, 0x00001cd3,
+        0x22932287, 0x9023a2db, 0xf304f336, 0x00004b3a, 0x196c19b0, 0x86d5bdb6, 0x222a220e, 0x00009716, 0xb23eb22f, 0x95c82b38, 0xacf2ac50, 0x00001c88,
+        0x005800cd, 0x863b480d, 0xd732d797, 0x00002b3a, 0xf459f483, 0x7c9811ff, 0xc30fc31b, 0x00002976, 0xed3eeda7, 0x97424ef8, 0xfb61fbf1, 0x0000e145,
+        0x9466940b, 0x98f3246d, 0x3aba3ac1, 0x00003bed, 0xf0eaf008, 0xd81ac818, 0xbad8ba69, 0x00005f69, 0x2b022b60, 0x8fdbe4dc, 0x63756331, 0x0000f073,
+        0x11e9119c, 0xe420bbe9, 0x535e5320, 0x00002fea, 0x6d036df6, 0x670dd348, 0xba25baeb, 0x0000eae9, 0x51535193, 0xb0bc80f1, 0xacb0ac03, 0x0000d667,
+        0x9ea59ec5, 0xea497e3c, 0xe9abe98d, 0x0000007f, 0xa6b9a6fd, 0xd69ec2ba, 0x88618830, 0x0000cef0, 0xa7dba7af, 0xbe8f17fe, 0xf87df89e, 0x0000f2fd,
+        0x07c107f0, 0xab512789, 0xc6fdc633, 0x0000a907, 0x004400fe, 0xd9c42326, 0xfe0ffe3f, 0x00006584, 0x31ec315d, 0x9b69a431, 0x7c577c80, 0x0000be2c,
+        0x417341c3, 0xa6a605d9, 0x070a07cf, 0x00004c08, 0x2fe42f1e, 0x382aa9bd, 0x31a231e3, 0x00000fe6, 0x55a45529, 0x068bf3ae, 0x9fab9ff0, 0x00002875,
+        0x912391d8, 0xca7affac, 0x3a563aa6, 0x0000d918, 0x4e2d4e52, 0xbcceba7f, 0x12dc12fa, 0x00000a72, 0x723e72f0, 0xf5a1717d, 0x566e56db, 0x0000106a,
+        0x1aac1a57, 0xe1a215c1, 0xa7c4a770, 0x000064c9, 0x7a2e7a49, 0xfed16b34, 0xcef8ceb0, 0x00008f17, 0xf67cf680, 0x5cecfa4e, 0x1d0c1d98, 0x0000e5a4,
+        0x594559b1, 0x3e5bf1ae, 0x533d530b, 0x0000e60b, 0x4a434a3c, 0xaee68c20, 0x2b432bcc, 0x000043e4, 0x737d73f4, 0x162d20eb, 0xdd3bdded, 0x0000f4b4,
+        0xfa06fa1c, 0x7c1dbdc9, 0xe100e1cf, 0x0000a907, 0xd131d18f, 0x4af6d236, 0x02a40234, 0x0000baee, 0x7cf17c73, 0xff5a8f9c, 0xc791c72c, 0x0000ace9,
+        0x139f1373, 0x4c27014f, 0xb173b1ea, 0x00001aac, 0x1b2e1b1d, 0x0515bc01, 0x949f9440, 0x0000c0d2, 0x831b8357, 0x7295ea71, 0xf23ef24d, 0x000019b7,
+        0x4ca94ce0, 0x5d1740ad, 0x5b015b56, 0x00005258, 0xdc09dcd1, 0xd3bb9ac8, 0x4163419f, 0x0000d8b6, 0x0592052d, 0xdd123b82, 0x1d581d18, 0x00003a13,
+        0x6c336c37, 0xed0f095e, 0x4eb34ec6, 0x00001ee3, 0xb40db4cf, 0x5db76cd3, 0xa8fba819, 0x00007f4e, 0xb20cb208, 0x8ff71315, 0xb671b65e, 0x00007623,
+        0x10db1082, 0x78090fd8, 0xfce3fca4, 0x0000d9eb, 0x8a068a01, 0x173a10aa, 0xabe0ab48, 0x00009f0e, 0xa8a6a8e5, 0xc8247fbb, 0xd7d7d723, 0x0000beeb,
+        0xba53ba63, 0x7e51b18d, 0x1535158f, 0x00004090, 0x44944453, 0x7c744bd5, 0x095409b3, 0x0000c186, 0x32e332f3, 0x21ed94ba, 0xa30fa397, 0x00003041,
+        0x9fb39f05, 0xa7a1074b, 0xe34ee303, 0x0000192a, 0xea0fea51, 0x519f31ff, 0x16671626, 0x0000310a, 0x4a944a50, 0xcebda637, 0x37593797, 0x00006ab4,
+        0x6c666c2f, 0x47460618, 0x94c79434, 0x0000d6bb, 0x9d149dd5, 0x4f9edf52, 0x28672881, 0x00009de0, 0xaaf8aa57, 0xdea44925, 0x8dee8dd7, 0x00003bb8,
+        0x88d188d9, 0xc3c21dcc, 0xdb51dbc7, 0x00009fe0, 0x4e734eb3, 0xff37e70c, 0x8f268f59, 0x0000dbfe, 0xc1d3c1a4, 0xe01e53f0, 0x3b823b76, 0x00005c51,
+        0xfd65fd6c, 0xf2288fde, 0x0ba20bf9, 0x00002ba4, 0x8b928b21, 0xafe5b238, 0x3d713d35, 0x0000294f, 0x18c81817, 0xcda51476, 0x7b657b8a, 0x0000d0da,
+        0xd999d938, 0x2c92be0b, 0x26ae26a1, 0x00004ea8, 0x57365742, 0x5153960e, 0x6dde6d0e, 0x0000d404, 0x591e591a, 0x5339de2c, 0x1a651a8f, 0x0000d266,
+        0xa5c9a5fd, 0x2383b1a0, 0x6ec36ec2, 0x00000f50, 0x967e9656, 0x5ac894ac, 0xfdbcfd12, 0x00008060, 0x31d3317e, 0xc2f58490, 0x73b87347, 0x0000324a,
+        0xbb31bb51, 0x98ffff3a, 0x254d25f3, 0x0000a8e5, 0x5abb5ade, 0xa8fd7934, 0x90139051, 0x00002152, 0x7a017a3b, 0xc7f51277, 0xf37ef3d7, 0x000074ee,
+        0x7ce17c1a, 0x32ce2334, 0xbeaabe23, 0x00009b6b, 0x601d60ad, 0x80251778, 0x821a82f3, 0x0000a6b4, 0xc3a5c3c0, 0x6840c708, 0x622d6216, 0x000069b6,
+        0xe4cbe406, 0xf795a103, 0x28f9285b, 0x000019ca, 0x70ad703d, 0x7ce0bec9, 0xdf4edf97, 0x0000988a, 0xf3c7f309, 0xfe267d00, 0x1a0e1a8d, 0x00001853,
+        0xa2eba2d7, 0x8b57b1d8, 0x4abc4a9c, 0x0000d03a, 0x6927698c, 0xbd1b1852, 0xe4c4e49f, 0x0000b891, 0x7c387c58, 0x6c60606e, 0xb876b824, 0x00009831,
+        0xfdd6fd4c, 0x21a251a3, 0x6ac16ab5, 0x00009ff0, 0xe305e3be, 0x97d4ed33, 0x318c310e, 0x0000ccaa, 0x0c950cae, 0x77ff3f8d, 0xb1e9b1a7, 0x00004684,
+        0x2308234b, 0x6ca1cded, 0xad53ad72, 0x00002024, 0x9b2b9bb0, 0xcc82a0d1, 0xf78ff7d1, 0x0000c6cd, 0xc59dc53b, 0x83a15dd3, 0xaf36af47, 0x0000d405,
+        0x738673a4, 0xb57ee5dd, 0x85158557, 0x0000c265, 0x0b270b29, 0x50e6ba35, 0xaf6fafdd, 0x0000a25a, 0x0fe20fdd, 0x9f3be832, 0x5ad45ade, 0x00002486,
+        0xe3b8e35e, 0x91934cf5, 0x7d2b7d1a, 0x00007b51, 0xf0a3f086, 0xb88f3316, 0x67b8674c, 0x00005905, 0xe3fee3ba, 0xe4c14e2c, 0x9cdf9c64, 0x00001416,
+        0x2ff22f20, 0xfa49ed4d, 0x98c39830, 0x000017d7, 0xa9daa9ea, 0x346f83fe, 0x5ae55a30, 0x000064d1, 0x8cc78c69, 0xb27cef5b, 0x158115f7, 0x0000e17a,
+        0x19a91945, 0x9ae6e15c, 0xc217c2ec, 0x00005898, 0x84c48443, 0x9173febd, 0x1b5e1ba1, 0x0000a526, 0xa524a5b5, 0x245a4445, 0xe4b3e4cb, 0x000053d8,
+        0xc9ddc92e, 0x3f29742f, 0x36163601, 0x0000f9e2, 0x2b632b48, 0x981bc4b6, 0x180018eb, 0x00003833, 0xac40acd2, 0x31bde5b0, 0x7ceb7cff, 0x000033b6,
+        0xfa1afa25, 0x59fa4fea, 0x3c4a3cf4, 0x00003fd2, 0x132913a8, 0xa3a01f64, 0x5f465fe4, 0x0000f26b, 0xb1bab173, 0xa14156fc, 0x6d6b6d34, 0x00006c19,
+        0x225022a2, 0x356f7633, 0xe242e227, 0x000008bd, 0x916391f4, 0xbd62c63c, 0xf616f6ee, 0x0000b60d, 0x465e46ae, 0xab816f58, 0x2c4f2cbc, 0x0000c365,
+        0xc51dc55f, 0xabf1d530, 0x35e235a9, 0x00003e13, 0xbed3be29, 0xb67536d1, 0x7249725e, 0x0000c1ec, 0x9fce9f4a, 0x27b275e2, 0x2e602ed0, 0x0000ea81,
+        0x3f283fdb, 0xcdfafc44, 0xfedefea9, 0x000007cf, 0x5fb35f20, 0xfa18e023, 0xfaa2fa20, 0x000049a8, 0x186b18b6, 0x0df91d59, 0xe200e2b2, 0x0000b3dd,
+        0x6e0a6eb0, 0x175b6ec8, 0x286c285d, 0x00009a8a, 0x7c4d7c5a, 0xd0aded4c, 0x8c278c72, 0x00000c83, 0x2ed82e7e, 0x50e61e15, 0xb1edb1b0, 0x00000aab,
+        0xbfcbbfec, 0x75b17566, 0x88628834, 0x00007591, 0xc15ac1fe, 0xa292e98c, 0x23dd2330, 0x00004957, 0x26932678, 0xbbdbdd97, 0xd33dd37d, 0x000004df,
+        0xa419a407, 0x97588070, 0x966d9679, 0x0000f0d0, 0xfb94fb44, 0x211691b2, 0x09a109fd, 0x0000f738, 0xa1eba1aa, 0xd69d552b, 0xbb86bbe9, 0x0000c14d,
+        0xeb43ebb4, 0x3988febc, 0x319d31c2, 0x00001188, 0xb332b349, 0x56a72b30, 0xc551c5c6, 0x0000a364, 0x75fd755d, 0xbbae93d7, 0x3eb03e1d, 0x000011f7,
+        0x982b9860, 0xac23523c, 0xde17dec1, 0x000036aa, 0xa848a895, 0x7f018fe0, 0x890889f4, 0x0000b2ac, 0x844a840a, 0x8d252a44, 0xa225a2b7, 0x0000ac3c,
+        0xdd93dd9e, 0x3dda66a6, 0xa4cda42c, 0x00009c71, 0x03700385, 0x7ae105f9, 0x291b2915, 0x0000b911, 0x366e36f0, 0x9889468f, 0x3cb43c5f, 0x0000f5be,
+        0x7e787eaa, 0xbb2be8ce, 0x8dd38d64, 0x0000003b, 0x17e71788, 0x2630b084, 0x8b188beb, 0x00005ce8, 0xee04ee32, 0xe6621a92, 0x22ef224c, 0x00005d68,
+        0xb6beb6d1, 0x964f30df, 0x0f760fdf, 0x0000aa36, 0x9820986d, 0x2b403e7a, 0x7f287fa1, 0x000042b1, 0x3b293bc8, 0x5e07d004, 0xb506b5a0, 0x000068e1,
+        0x323132f7, 0x1da92d60, 0x973c9728, 0x00008d61, 0x4b394b9d, 0x069b7767, 0x3f0b3f26, 0x0000f51d, 0x4fd94f29, 0xb71b9138, 0xdbf0dba1, 0x00009d6f,
+        0x677b6757, 0xfc445a60, 0xb167b10e, 0x00009c79, 0xcb43cb17, 0xacf11acf, 0x94ee94e1, 0x0000805f, 0xc053c051, 0x7012e26b, 0x835683f8, 0x00009e58,
+        0x358135a4, 0xfed24dad, 0x0be80b46, 0x00007b43, 0x35c93573, 0x9afcf6dc, 0xce57ceef, 0x0000ec96, 0xecdfec8a, 0x5cb378e2, 0x695a693f, 0x00008e61,
+        0x706570f2, 0x8784fe3a, 0xfc79fc2e, 0x0000afc1, 0xecf8ecb8, 0x1e8936d0, 0x48324838, 0x00001165, 0x291429a9, 0x72f5967f, 0x067d066a, 0x0000544b,
+        0x3b053be2, 0xc339701b, 0x9bee9b6b, 0x00008c9b, 0x450845dc, 0x533b2993, 0x9310932a, 0x0000678b, 0x9f029f5e, 0x522e6dc2, 0xbddebd81, 0x0000a5b4,
+        0xcaccca6a, 0x4526a0a2, 0x152315bb, 0x00007c81, 0x539853fe, 0x1b6a7129, 0x5c8a5c3a, 0x00006b89, 0xb408b473, 0x338d10cc, 0x34653496, 0x0000e7e2,
+        0x4afb4ae2, 0xf7c21e1a, 0xbb85bb55, 0x00003d73, 0x5a8f5a29, 0x00a069f5, 0xc3fec300, 0x00009f79, 0xa133a102, 0x2c427827, 0xac4eac27, 0x0000684a,
+        0x46164682, 0x327698f9, 0x73347307, 0x0000ab2e, 0x6b466b4e, 0xa741568e, 0xdb00db3b, 0x0000650e, 0x5e365eb1, 0x4b95b615, 0xc2bbc2ee, 0x000026df,
+        0xddc3ddeb, 0x7b6d10bc, 0xbba6bb5b, 0x00000813, 0xce33cec5, 0xbb2c3bce, 0xf1cdf10f, 0x0000491e, 0x01d0015d, 0x90b3f4f4, 0xe327e303, 0x00009420,
+        0xc5efc555, 0x004cdaa6, 0xa45ea4ee, 0x00005f17, 0xaa20aac9, 0x7c009ede, 0x4495443a, 0x00002c58, 0xdf1fdfa3, 0x78ba3ed1, 0x1ed81e38, 0x000055fe,
+        0xe5cbe5a2, 0xd9be67a2, 0x13d21380, 0x0000e7c2, 0xd0d7d0b5, 0x3c18a29d, 0x24f924e2, 0x00009f3f, 0x28c4282f, 0x9183f9c5, 0x6d0c6d58, 0x00003082,
+        0x7c387c79, 0x99750785, 0xcf7ccf89, 0x00002456, 0xcc9ccc88, 0x617aeeb0, 0xc8a6c800, 0x000068c0, 0xb880b8ef, 0xc03a5d51, 0x796e794f, 0x0000fcfc,
+        0xc415c464, 0x30cffcfd, 0xe203e263, 0x0000e35a, 0xc31ec358, 0xba378617, 0x03e803b0, 0x0000ead6, 0x540454be, 0x647a86f0, 0x8aaf8a62, 0x00007219,
+        0x99a3994a, 0xe32c80f3, 0x963b965b, 0x0000303f, 0x107d1058, 0xb4faf38f, 0x3db43df9, 0x00007a5e, 0x883088f0, 0x3ddbf1d6, 0x327232cf, 0x0000eaf6,
+        0x9fc99f13, 0x8c7902b8, 0xeb2aeb54, 0x00000ab3, 0x2cc52ca9, 0x1e05810f, 0x756b750a, 0x00007a43, 0x13f81310, 0xc1e4a454, 0x53a0531e, 0x0000ed16,
+        0x990a9904, 0xb699eccc, 0x5eb15edc, 0x0000b6f2, 0x74ab74be, 0xec8386f3, 0xef60ef62, 0x0000ab18, 0xf904f9c4, 0xdf8b99d4, 0x687868d8, 0x00004ef6,
+        0x51425185, 0x8e6ea22d, 0xa699a60f, 0x000087b0, 0x4dfb4d88, 0x32488abe, 0x803780d5, 0x000094e0, 0xda3eda0a, 0x6f10d825, 0x9b809b1d, 0x0000a564,
+        0x98fc9892, 0x8998c0a8, 0x3e5e3e15, 0x0000ab9b, 0x88a388ab, 0x522400b4, 0xe80de80a, 0x0000baee, 0xd204d204, 0x500789fe, 0xae7aaee2, 0x00009114,
+        0x68ac683a, 0x7f2d9a56, 0x8c5c8cf1, 0x00001ff5, 0x0b350bad, 0xb15049af, 0xc1e9c14a, 0x0000f573, 0xb40bb45a, 0xfacb3a30, 0x0b870b6a, 0x00004b04,
+        0x1a431ab9, 0x54779c9c, 0x66d466e0, 0x00006c15, 0x81dd817c, 0xa871a5d0, 0x4af34afe, 0x00004956, 0x21cb21b6, 0x81c41043, 0xd023d0b5, 0x00004a8f,
+        0x329232a7, 0x7444ba87, 0x68596873, 0x0000f31d, 0x901b9054, 0x376b2f39, 0xca38cace, 0x0000fb7e, 0x467c4608, 0x64bbb7e9, 0xa339a3f4, 0x00007e5e,
+        0x39c0392a, 0xf1c2e9cf, 0xa547a51a, 0x0000bc79, 0x4d704db2, 0xc845ed32, 0xc034c052, 0x000063d0, 0xf8aaf8ab, 0x0f7b9ad7, 0x8b138b4a, 0x0000fd23,
+        0x90e49078, 0xb38fa614, 0x30bd309a, 0x0000a069, 0x5dea5d6b, 0xe2212636, 0x04490454, 0x0000d594, 0x371b37c6, 0x6bc346ad, 0xee6feed9, 0x00002c0a,
+        0x3ad43ac3, 0xe59db4d6, 0xed54ede7, 0x00007efe, 0xaefdaecd, 0xab5b6251, 0x570f57be, 0x0000dbd4, 0xfba3fb21, 0x7c6da2e0, 0x9f319f6a, 0x00008220,
+        0xf5b0f568, 0x5f2f252c, 0xbdfbbdc4, 0x0000be5d, 0x3f5e3fb8, 0x03e6d9f1, 0xf7cbf7ff, 0x0000a416, 0xf287f2f3, 0xe85809a4, 0x17f61792, 0x0000e4ab,
+        0x574557df, 0xee7dd5cb, 0x3c803c09, 0x0000a0eb, 0x75ad75ba, 0xfeaa732f, 0x545654b4, 0x000056e4, 0x49b6492d, 0x245d0549, 0x37b7373c, 0x00009f46,
+        0xb4abb43c, 0x05c46400, 0x450545e7, 0x0000c2e6, 0x9e419e18, 0xd714a153, 0x0e650e4e, 0x0000498c, 0xfb84fb0a, 0x8a781f64, 0xe3b8e369, 0x0000c0ec,
+        0x796c7920, 0xe668b1dd, 0x97d5979c, 0x00001088, 0x76e87626, 0x3f0238b1, 0xf699f6f5, 0x0000dfb7, 0x15661588, 0x58373d71, 0x821882ef, 0x0000be11,
+        0xb451b496, 0x5f4c0aeb, 0x47a84746, 0x0000ff5c, 0x72357267, 0xb9e31489, 0xd04ed097, 0x0000cbe7, 0xdf17df9f, 0xfab670d3, 0xe2dde226, 0x0000fda3,
+        0x341d348b, 0x5e92d485, 0x542d549f, 0x0000e752, 0x46c1467a, 0x64d04948, 0x80758039, 0x00002866, 0x8658865c, 0x4d105034, 0x45ac452e, 0x000004cf,
+        0xbe89be29, 0xd2dfc867, 0xa6a5a6ad, 0x000049a9, 0x80eb8078, 0x97414d05, 0x1c1a1c6a, 0x0000b22c, 0x8bac8bec, 0xbd756251, 0x2f9d2f1f, 0x0000036f,
+        0x603460aa, 0x4c248bde, 0xf860f820, 0x0000092c, 0xa684a681, 0xce4b0511, 0xdab8daee, 0x00008def, 0x186c182b, 0x57ded17c, 0x6dfa6d54, 0x0000544a,
+        0xe8bee891, 0x6fff8671, 0x3011303d, 0x000060e1, 0x96329623, 0x6af1631e, 0x51f251c6, 0x00003ecc, 0x51415138, 0x19932c60, 0x330a33b0, 0x0000d767,
+        0xb5f7b5bc, 0xae0d9cdf, 0x668f66b6, 0x000038b9, 0x890d89d3, 0x02bc1bee, 0xe1a8e161, 0x0000ea37, 0xc338c3c0, 0xa59e63fa, 0x5ae35a31, 0x0000799d,
+        0x899c895c, 0xefc1799f, 0xfc27fc0f, 0x000003a0, 0x3340338e, 0x9d2ce3d3, 0x9f6a9fa2, 0x0000f8ba, 0xb6a3b6ac, 0xa5f1063a, 0x9e789e24, 0x000009c0,
+        0x67da6756, 0xf8aa5caa, 0xabf1abfa, 0x000094e0, 0xcfc2cf61, 0x6f64ecab, 0x2b182b79, 0x000041d0, 0x2c252cd0, 0x784b35ee, 0x8f648ff7, 0x00006bc8,
+        0x3a0b3ae4, 0x69dfa52f, 0xe102e155, 0x00004cf2, 0x1e561e84, 0x22d2f529, 0x81998139, 0x00002466, 0xbc12bc9c, 0x9dd8023b, 0x292a2954, 0x0000ccc5,
+        0x18ec18df, 0xc65eadab, 0x4b7c4bd1, 0x00006815, 0x966096f4, 0x8fef35e0, 0x9bf69bb8, 0x0000aee9, 0x9fff9f9b, 0xf7aeabc0, 0x3fa03fdc, 0x000088be,
+        0x4bf94bda, 0x022534ef, 0x507e5002, 0x0000b3b2, 0xafc3afad, 0x63cd6238, 0x94a09453, 0x0000e486, 0x9bf49b6c, 0x758e1b6a, 0x6496647a, 0x0000bd6f,
+        0xe5d1e58c, 0xd22066db, 0xea71ea88, 0x00001c88, 0x48a2484e, 0x28b4bff4, 0x54b254a3, 0x0000280c, 0xba74bad4, 0x1eca4650, 0x60fc6024, 0x0000c97f,
+        0xa862a8d2, 0x38afed4e, 0xc047c0b0, 0x0000a635, 0x1bc61b6b, 0xd46a9c6a, 0x6325637e, 0x00000362, 0xd321d33b, 0xfde03544, 0xfbe7fb17, 0x0000fc9e,
+        0xf1fef19b, 0xb1ebd3db, 0xe7bce799, 0x0000db91, 0xa44aa480, 0x6f09375e, 0xdbdbdb7f, 0x0000f882, 0x88ce88e0, 0x1973a6ed, 0x366d367d, 0x0000b547,
+        0x51cb51d7, 0xf5cd182f, 0x17361797, 0x00004f8f, 0xf616f667, 0x825ca9f4, 0xa108a1d5, 0x0000d41d, 0xea9aead2, 0xc7350a61, 0x29f32914, 0x0000e829,
+        0xe89ce8cb, 0x1d215c2c, 0xdb0edb7a, 0x0000c2d8, 0xede8edc0, 0x0e1c4305, 0xc885c876, 0x0000700f, 0xc01dc059, 0x578aaa41, 0xae62ae4d, 0x000043cf,
+        0xa0caa0d3, 0x0f24fdc2, 0xf956f9a9, 0x00000ed8, 0x241824f1, 0x4805d175, 0xc3abc32c, 0x000099c8, 0x96aa96d0, 0x27307866, 0x8ebe8e56, 0x000027cb,
+        0xd7c7d749, 0x4bbee7e1, 0xa310a345, 0x000019cb, 0x227b225e, 0x0664c0fb, 0x24ff24a4, 0x0000d477, 0x3fd13fab, 0xa6535ba3, 0x9f149f25, 0x0000880e,
+        0x64df6464, 0x17513220, 0x6af16ad7, 0x00004c04, 0xb354b376, 0x87b6c1fd, 0x3d603dd4, 0x0000a7d9, 0x51e05155, 0x067b9cdc, 0xc7dac7ca, 0x0000d8f4,
+        0xa4c3a461, 0xde1e585c, 0x560f565f, 0x0000fab3, 0x4bd04b14, 0x68bfdc69, 0x3de03d10, 0x00001ef5, 0x3e803e78, 0x509dc1f7, 0x80938000, 0x00005236,
+        0x80538034, 0x929e6988, 0x96ed96be, 0x0000ff01, 0x90f290a6, 0xc21531df, 0x403640f7, 0x00005465, 0x1989195b, 0x29a20149, 0xb179b1b0, 0x00003b4c,
+        0xaafaaa61, 0xb0344c29, 0x03ea0310, 0x00000a71, 0xa8a5a865, 0x1a4e4c4f, 0x1d771dc4, 0x0000d157, 0x2e112e72, 0x85f62b7e, 0xf12bf154, 0x0000eb94,
+        0xe474e4cc, 0x5099163d, 0x6568659d, 0x00005fb4, 0xcef7ce9f, 0xd59235a0, 0xe87ee859, 0x0000ceaa, 0xbff3bf6f, 0x6ca1e7e1, 0xdc27dcae, 0x00007d2a,
+        0xb928b994, 0x7b72fb4c, 0xbce8bce3, 0x000062da, 0x03e40384, 0x6070e55f, 0x9e959e91, 0x0000c168, 0xc549c5d4, 0x219203f6, 0x00580029, 0x0000ed89,
+        0xb893b8cf, 0xb5f7a846, 0xd6fad6e5, 0x0000ce82, 0x9f629f25, 0x821f0ee5, 0x9e619e69, 0x0000e489, 0xcc95cc67, 0x64cda233, 0x4a494ae0, 0x00009a9f,
+        0x13fc13da, 0x7fa26b34, 0x741f7466, 0x0000cd94, 0xf28ff2f9, 0xaa23c427, 0x66ca6645, 0x00001298, 0xcf17cf2f, 0x8827929a, 0xea0aeaac, 0x000053fa,
+        0x77e97719, 0xab7b61e5, 0xd27dd29e, 0x000095ea, 0xa4c8a494, 0xb58a96c3, 0x496949cc, 0x00000282, 0xfce3fc09, 0x346f5f16, 0xb803b883, 0x00008571,
+        0x48184811, 0x276d521e, 0xfb5bfbd7, 0x000012a7, 0xfa27fa56, 0x07c6d3eb, 0xbe6abe88, 0x0000825e, 0x632e630e, 0xcb451e65, 0x3d3f3dbc, 0x0000c169,
+        0x3108311a, 0x1b2ffe86, 0x81e88130, 0x0000ccaa, 0x88248868, 0x3e199253, 0xc2efc218, 0x0000cfcf, 0x2f802f81, 0x118ec82e, 0x9e9f9e98, 0x0000e7f8,
+        0xf83df87d, 0x6bfde441, 0x0a850a35, 0x00009116, 0xfa96fa5b, 0xdc545673, 0x4cbf4cb4, 0x0000b19a, 0xc3f7c3fa, 0x89bb33a5, 0xc52ac56f, 0x000024f5,
+        0xac39acd3, 0x78d97731, 0x4f4c4feb, 0x0000bd9e, 0xa847a863, 0x5ac67fbb, 0x3d1e3d45, 0x0000a138, 0xe392e351, 0x6322b51f, 0xa252a2e0, 0x000048c4,
+        0xe4f8e4b1, 0x1594fa61, 0x4d324d1a, 0x00005400, 0x40c84058, 0x63d36108, 0xf868f8af, 0x000041b0, 0x13f0132d, 0x31b92226, 0xf0f3f0ac, 0x0000e6b6,
+        0x496a49d4, 0x30f55d3f, 0x281c2827, 0x0000b94e, 0xd103d148, 0x07d7faaf, 0x96129651, 0x0000d1f4, 0xddf8dd40, 0x33cecf35, 0xd01dd0d6, 0x0000cbaa,
+        0x2f692f7b, 0xd6eb7810, 0x893b89f5, 0x0000254f, 0xbc80bcdb, 0x0f3b2fc6, 0xbe12bed5, 0x0000c107, 0xed28ed38, 0xefc0faf7, 0xc75cc7eb, 0x00004ca9,
+        0xec5eec5c, 0x4387e1a4, 0x42014240, 0x0000ac48, 0x2856282a, 0x101c36dd, 0xebdeebc2, 0x00000fbd, 0xa66ea6da, 0x0a9b2fbf, 0x2c922c7c, 0x0000f8c5,
+        0xfdbdfd61, 0x81b48dba, 0x9b859baa, 0x0000faec, 0x0ca50c29, 0xe82d84cf, 0x81b881d8, 0x000033ab, 0xf967f9e4, 0xa891b9b5, 0x562d56ee, 0x00004ca9,
+        0xea04eace, 0x9e2c2754, 0x1ce31c5d, 0x00005f8a, 0x943594c2, 0x6e22f596, 0x83be83a6, 0x0000f6ed, 0xff54ffa2, 0xc6b435bf, 0x90819053, 0x00000362,
+        0xfde0fd42, 0xe4bec8e8, 0xce3ece8c, 0x00003d11, 0x5446541a, 0xba4fbbd6, 0x1d651de2, 0x00000ebc, 0x0bcb0bb3, 0xe9cea014, 0xeba5eb87, 0x0000dae5,
+        0x0e610e35, 0x68bfe973, 0x4dba4d47, 0x000025a4, 0xc2e3c27e, 0x2f8cc618, 0xda85daa4, 0x00005a2b, 0xfb06fbd3, 0xf90b2535, 0xe51ae524, 0x0000ffe7,
+        0x3ee73e5e, 0xa9f151cd, 0x15e515ee, 0x00003b11, 0x29822949, 0xa90c944c, 0xb5a4b5e2, 0x0000658b, 0xc9cac96b, 0x5b68d977, 0xde4aded8, 0x0000fc0c,
+        0x584858dd, 0xb79995b7, 0x4cea4c24, 0x0000330a, 0x92cb920c, 0x0a9d1286, 0xb7b5b747, 0x00002989, 0xb2a8b23e, 0xce3a113e, 0xf88ff8fb, 0x00002904,
+        0x1bf41b61, 0xe8b1b31f, 0x77137782, 0x00001295, 0x6b366b19, 0xd2543bce, 0x04830452, 0x0000baee, 0xadfbadc9, 0x2487e0d2, 0x2ffd2f15, 0x0000ddb8,
+        0x26272658, 0x9a9cda8d, 0x728f7226, 0x0000072b, 0x37973744, 0xbbaedac4, 0x9b6f9bdc, 0x00003735, 0x84d98488, 0x4746a060, 0x62186266, 0x00005184,
+        0x945794c6, 0x63dfd06f, 0x3262325e, 0x0000a84c, 0xda2dda60, 0x6b7d246d, 0x528f522c, 0x0000727a, 0x120f128f, 0xbf4add15, 0x2b6c2b21, 0x00004cad,
+        0x706070d0, 0xbd03dae5, 0xe0c7e0ca, 0x0000e64d, 0x0050008e, 0x28e22ac6, 0x592259ef, 0x0000195b, 0x3ea93ebf, 0x81b76239, 0x275c2702, 0x0000728e,
+        0x5776573d, 0x2a82ae49, 0x8ee38ea7, 0x0000964b, 0x1eed1ec2, 0xe7c105b2, 0x59eb5905, 0x0000498c, 0xfed3fe95, 0x89471e15, 0x182c1891, 0x00009104,
+        0x913491d7, 0x12fc9131, 0x6d786ddc, 0x0000b5b1, 0x5b2a5b52, 0xc2c2f0d4, 0xcd6ccdfd, 0x00003101, 0x82b88239, 0xa62f1d53, 0x88dc8882, 0x00002d1c,
+        0xd5f0d503, 0x19b1fd7d, 0x3c503c13, 0x0000075d, 0x731e73c3, 0x8037c32e, 0xaaa2aab4, 0x00003913, 0x7cac7c1e, 0x0b24cfad, 0xd3aed380, 0x0000ae8b,
+        0x79c37922, 0xa58a4302, 0x2a842aa7, 0x000019e6, 0xfd0afd31, 0x4cf68270, 0x34a4341a, 0x00005c29, 0x49564988, 0xad51df38, 0x551555da, 0x0000d910,
+        0x3e1e3e40, 0x87946196, 0xad30adfa, 0x0000a52a, 0x68a2680d, 0x6680b8d6, 0x7ad87a88, 0x0000aa49, 0x4f0c4f9e, 0x1970cf4a, 0x01b8010f, 0x0000fecd,
+        0xb5e4b5cd, 0xa1d06b35, 0x5c665c2d, 0x0000fb5c, 0xed70ed60, 0x0a9b2df9, 0x1c971cee, 0x00007d55, 0x52335259, 0x127a5403, 0x760676e1, 0x0000b609,
+        0xc6f1c663, 0xdf0e07d9, 0x3381332f, 0x0000de9a, 0x04cb044f, 0xe7528f30, 0x0c560cb7, 0x0000bd11, 0x291229e2, 0xa8135c7c, 0xd3fed3a7, 0x0000af98,
+        0x00cf00ff, 0x42c52212, 0xcd8bcdf1, 0x00006301, 0x6b0d6b6a, 0x9b33be7f, 0x70f770b0, 0x0000dd45, 0xbb39bb19, 0x2cf3027b, 0x4a4d4ae3, 0x0000b408,
+        0x7dfa7d7f, 0x0e7ceb4d, 0x63046316, 0x0000829d, 0xc7ccc735, 0xec710008, 0xc30cc32e, 0x0000c4ce, 0xc6b1c6a3, 0x23f3f309, 0x85648593, 0x00000362,
+        0x5f095fc4, 0x0754a600, 0x4f8e4fc7, 0x0000069f, 0xc522c516, 0xd7040df9, 0xb7a4b7d2, 0x00000563, 0x3e0a3e06, 0xa7befbb3, 0x36e13654, 0x00008518,
+        0x3c263c78, 0x49aa1136, 0x2f462f55, 0x00009d8a, 0xa15da18a, 0x189d3e4c, 0x0cd10c97, 0x00008b1e, 0xccb1cc5c, 0x4bf6e5df, 0x28a928cd, 0x00000d46,
+        0xe417e426, 0x4f5c3fce, 0xdc35dc69, 0x0000a039, 0x30e430cc, 0x984e90b0, 0x5978592b, 0x0000e816, 0x96ce96d4, 0x18caad14, 0xee13ee2c, 0x00001944,
+        0xa7b6a732, 0xbe62aafe, 0x9ed09e92, 0x00003c50, 0x69d96993, 0x89f78e48, 0xc871c88f, 0x00001dac, 0xf747f77a, 0x934cebcc, 0x5dbc5dd2, 0x0000d634,
+        0xf326f3a3, 0xefce8ede, 0xad2fadf7, 0x0000ce8f, 0x286d28b0, 0xc71d649b, 0xbc49bc48, 0x0000b89c, 0x5b305bde, 0x6822b9da, 0xed6bed6d, 0x00002557,
+        0x20fc2021, 0xcdfbd1f4, 0x0d9d0ddf, 0x00002c45, 0xf1f3f1d1, 0x24926559, 0xc596c59d, 0x00001833, 0xbdebbde7, 0xfc3ddc04, 0x1a681a54, 0x0000f804,
+        0xc57ec547, 0x396f9bbe, 0xe0bce046, 0x0000475c, 0xe997e953, 0x4e054fd0, 0xa61da6a5, 0x0000f4f1, 0x05c8055c, 0x158175b1, 0xecd7ec28, 0x000027c5,
+        0xf5c7f5c3, 0xed0e8bbe, 0xc5eac51a, 0x00006b0d, 0x325f32b7, 0xcb9ad8e5, 0x6c6f6c6c, 0x0000aa58, 0x23a823fb, 0xe1526ea6, 0x44a844be, 0x00009434,
+        0x431743c1, 0x611bb274, 0x8b1b8b44, 0x00007efb, 0xef93ef6d, 0xde5f583b, 0x24b72488, 0x0000f88d, 0xc935c949, 0x635e8581, 0xa5e4a530, 0x0000f62d,
+        0x67ca6792, 0x81573a98, 0x2a072a24, 0x00009d91, 0xa3eea3ca, 0x9e2e534f, 0xeeccee81, 0x00008bc8, 0x0a8d0ab9, 0x0e346323, 0xdf0fdf75, 0x00000f99,
+        0x112b1126, 0xb04706ca, 0x9b2f9bd1, 0x00008f68, 0x119c1188, 0xbf019abe, 0x6dcd6d2f, 0x0000742a, 0xe7ede7b5, 0x926b52a3, 0xde6adec8, 0x00006814,
+        0xb553b59c, 0x9d6735ed, 0xff4aff15, 0x00006bb8, 0x92d49212, 0x57f256ce, 0xa77aa732, 0x0000e53d, 0x0360033b, 0xdbbc4687, 0x1c641c21, 0x000019cb,
+        0x531753f8, 0xca7ab2f0, 0x4fa34f50, 0x000077b1, 0x30d83028, 0x89f7bc33, 0x27a527b0, 0x0000ae85, 0xe0d6e040, 0x691cc3a8, 0x236f2347, 0x00008a3a,
+        0x103810ac, 0x594d6977, 0x7797776f, 0x00009500, 0x152e155b, 0xc1357c04, 0x6a9a6ab2, 0x0000f1de, 0x9cdb9c97, 0x06a58fde, 0xa96ea9d9, 0x00000763,
+        0xc7fdc796, 0xf3619d88, 0x4a644ad5, 0x0000f619, 0x22cc2270, 0x389a4458, 0xe2fee2ad, 0x00003a17, 0x75aa75d3, 0x3f03655a, 0xd71fd7c2, 0x00001717,
+        0x96a296c8, 0xe0123320, 0xc30dc32d, 0x0000060d, 0x2b4f2b88, 0x05263b7b, 0x7c6a7c23, 0x0000f452, 0x26ed26df, 0x558cced7, 0x95439534, 0x0000d1d7,
+        0x2b6d2bfe, 0xb57ffc05, 0x0cee0cf4, 0x0000c4c1, 0x259d25f1, 0x25e04c56, 0xc5b2c5c5, 0x00008cfa, 0x285028a6, 0x9ed9799f, 0x9fad9f16, 0x00006c1b,
+        0x757975ac, 0x6ebfaeb4, 0x8c5e8cdc, 0x0000da1a, 0xd37bd3fe, 0x0e7e841e, 0xbfadbfa0, 0x000078ee, 0x8dd08d3d, 0xfcaad235, 0x4f9c4f59, 0x00001c85,
+        0x776a7709, 0xd04d43fb, 0x8e308eac, 0x00004a1c, 0x9ae49ac7, 0x4a6977a6, 0x1da61de9, 0x00005f27, 0x06490610, 0x9457d926, 0x5bea5b47, 0x0000d9df,
+        0xec4fec25, 0xadb01c4a, 0xffe3ff09, 0x000021d5, 0x21482133, 0x7802a7c0, 0x599459e9, 0x00000be2, 0x6ac26a9a, 0x60a0d358, 0xe04ee01c, 0x000000bd,
+        0x634363f9, 0xad4dc818, 0x14331444, 0x00006678, 0xf37bf3bc, 0xd107bcf2, 0x484c484b, 0x0000cf8d, 0xf949f961, 0x0515db47, 0x7934798f, 0x000044a1,
+        0x8a2d8a25, 0x2960abb8, 0xc3adc389, 0x0000a925, 0x79537914, 0x89855eee, 0x1c211cc5, 0x00009214, 0x7ceb7c52, 0xe0660d26, 0x67ca677a, 0x0000ddc4,
+        0xf249f28b, 0xa7be0e99, 0x83eb83c3, 0x00007cc2, 0xd002d043, 0x51ed024b, 0x67246722, 0x0000479f, 0x374a375c, 0x40c68d5c, 0x3f0a3f76, 0x00003d06,
+        0xc331c3cd, 0x71ed7d7c, 0x494249dd, 0x00004848, 0x2a522ac3, 0xc527e21a, 0xc669c679, 0x0000ceaa, 0x52c3526a, 0x2a8279df, 0x9731979a, 0x0000ca46,
+        0x822a82d7, 0x67858628, 0xd81bd882, 0x00001902, 0x49c649bd, 0xe4a3304a, 0xbd4dbd1f, 0x0000693a, 0x3e8e3e18, 0xda3be8fc, 0xb657b67e, 0x0000e937,
+        0x305d3080, 0x74d00855, 0x02ca023d, 0x00009aae, 0x18d8182c, 0xf4575923, 0x595e59be, 0x0000dc57, 0x6e936e64, 0x378952c7, 0xfcfafc07, 0x0000ee75,
+        0x6ccd6ca0, 0x998c1da5, 0x39a739b2, 0x0000b250, 0x2549255f, 0x37629161, 0x63a8630f, 0x00000d62, 0x099b091c, 0x430c772f, 0x472a476f, 0x0000ff82,
+        0xd4a1d4cb, 0x3d483941, 0xf335f343, 0x00003c2d, 0x94449494, 0x44563084, 0x46254604, 0x0000ac2e, 0x7b557bae, 0x17da50c8, 0xc82bc80f, 0x00003082,
+        0x4f554f4b, 0x6fd4201e, 0x63f0633d, 0x0000a764, 0xa7a4a7ba, 0x404770d6, 0x2ee52e10, 0x0000823c, 0x55c655c6, 0x7802a7ab, 0xa36da335, 0x00007251,
+        0x2b012b27, 0x3c9f46b2, 0xa468a433, 0x0000fa38, 0x11ed1153, 0x0d686b8b, 0xdb82dbeb, 0x00009234, 0xb08ab021, 0xb01cb30f, 0x591b5974, 0x00003fb8,
+        0x2438248e, 0x4546125e, 0x45604582, 0x000033f4, 0xd418d4fc, 0x2f1f40bc, 0xb215b25c, 0x0000b47c, 0x5b625bbc, 0xcec5a9ab, 0x376e3737, 0x00006428,
+        0xfb70fb24, 0x275db8b5, 0x71b771ab, 0x00000a55, 0xaef4ae62, 0x142d54cc, 0x400f4046, 0x00001ef7, 0x3dfc3d09, 0x7c12a9de, 0x9ea29e7e, 0x0000748f,
+        0x6d376d2f, 0x65bcc416, 0x0f950f54, 0x0000fd84, 0x7db87dfb, 0x3b55a4d1, 0x89fe8916, 0x0000e5d2, 0x091509cd, 0x76a93346, 0xb841b835, 0x0000075d,
+        0xf7c8f7ce, 0x7dea1d8c, 0x8c688ccd, 0x0000086a, 0x0d260d62, 0xe47fa587, 0x168f168d, 0x00007960, 0xb9e8b9c6, 0xd0a48ecf, 0x975797e5, 0x000065a6,
+        0x7d687d92, 0x704ab173, 0xb202b27b, 0x00001b02, 0xef0eef3b, 0x988debcd, 0xb628b6ff, 0x000070b6, 0x724b7228, 0xc8c557ef, 0xe06ee0dd, 0x0000c831,
+        0x5f2a5fd7, 0xf8ab0a64, 0x086a08f7, 0x0000789c, 0x3f533f5e, 0x73cdd8e5, 0x3c6d3c2c, 0x000027cd, 0xc64dc61c, 0x522ea4cd, 0x1dec1de7, 0x0000c060,
+        0x28bf28d7, 0x14aaa93f, 0x8e0e8edc, 0x0000d562, 0x8f2d8f6d, 0x289d6524, 0x815f81f2, 0x0000f63d, 0x17fe1713, 0x01c54d50, 0x48bb48d9, 0x0000df20,
+        0xab51ab97, 0xed0eac89, 0x97ce976a, 0x000017e3, 0x9c5e9cc5, 0x5c321541, 0x3dc63d79, 0x00000b1f, 0x7f507f0a, 0x334eb3a0, 0xf8c2f879, 0x0000e703,
+        0x14c11486, 0xa1615cd5, 0x52105284, 0x0000b7f1, 0xf6a0f63b, 0x67704cd6, 0x3aca3aaa, 0x0000f73d, 0xe8b2e814, 0xee939740, 0xb6aab6d0, 0x00003795,
+        0x45c6455e, 0x670cdca5, 0x634863e4, 0x00008fb7, 0xa746a74c, 0x427991ef, 0x8d538dff, 0x0000f26b, 0xf7f6f7ba, 0xb8843d73, 0xe616e66a, 0x00007e62,
+        0xd2f3d2af, 0x5b6b007e, 0x1d611d3d, 0x0000c836, 0xa94ca994, 0x8b4747cc, 0x41e44110, 0x0000eabf, 0xfc3efc8f, 0xcb65f63a, 0x4d7b4d3c, 0x0000a33c,
+        0x496b49b3, 0xbb246bca, 0x7a0e7a75, 0x0000b313, 0xd5b4d584, 0xba36af8a, 0x8b188beb, 0x00008b30, 0x7c477cfc, 0x29a2d7bb, 0xde7dde27, 0x000025ff,
+        0x20102041, 0x5a479781, 0xcb49cbe1, 0x0000742e, 0x99f19960, 0x9fe63eb1, 0xd11dd116, 0x0000825f, 0x3662361f, 0x6a1c1a29, 0xabf1ab26, 0x00008e8e,
+        0x39c1392c, 0x20bf24e9, 0x80c48021, 0x00003f4c, 0xc460c40c, 0x085ca251, 0xb958b97a, 0x00003c90, 0x874b873a, 0x92d47623, 0x6c046c5a, 0x00009dc8,
+        0x0d550d45, 0xb96881cf, 0x7edb7e86, 0x0000ba05, 0xd813d8d4, 0x6b40334a, 0x840684c3, 0x0000854a, 0x6bda6b6f, 0xef3156b2, 0x2803281b, 0x0000bfbb,
+        0x2c922c7d, 0xcf24a668, 0x716971fa, 0x0000b321, 0xa27ea247, 0xefb8f0b6, 0xa397a39e, 0x00009d91, 0xca44ca1b, 0x6f4036d3, 0x25ea25be, 0x0000debb,
+        0x317531c2, 0x8c660c27, 0x484148a0, 0x0000ea69, 0x6dbc6d75, 0x0684c89c, 0xe971e983, 0x0000a628, 0x5312530e, 0xe59d950e, 0x5e4c5e88, 0x00002e63,
+        0x805b8000, 0xaf4a252d, 0x6ea66e25, 0x00000162, 0x161b16ff, 0xb7d9dd95, 0xd188d187, 0x00009a8a, 0x5a185a1e, 0xfcaa7566, 0x86a386bf, 0x000052e8,
+        0xc066c008, 0x291261d9, 0x3b323b7e, 0x0000340a, 0xa827a8e3, 0x11059a57, 0xfa08fadc, 0x00007b31, 0x87c987e5, 0x58aaacc2, 0x2cb82c82, 0x000038b9,
+        0x046f048a, 0x1990bdc9, 0x44404441, 0x0000fdfd, 0xfbbbfbc1, 0x6ce43bff, 0x9c349ced, 0x0000f99e, 0x416f4123, 0x5ad8728b, 0x89538947, 0x00000763,
+        0x467f46a2, 0xaac42fbb, 0xf2adf2fc, 0x0000b1c7, 0xfdcafdcd, 0x19046808, 0x216c215c, 0x0000e6e3, 0x6ea86e90, 0x44464031, 0xde2aded5, 0x00001536,
+        0x5128510f, 0x4af6bfc9, 0x2df22d39, 0x0000dc7c, 0xe85ae863, 0x7d97d926, 0x524152a1, 0x00007661, 0x27152743, 0x4fe0df2c, 0x7e527eed, 0x0000e95f,
+        0xe38ee3cc, 0x3acfa6ef, 0x5515558b, 0x0000dbd4, 0x862b86d8, 0x4eb7b13e, 0x81c6817c, 0x0000a7ae, 0x1b2d1b80, 0x6d508ba1, 0x388738f2, 0x0000aac5,
+        0x1b481b29, 0xb4a3d409, 0xea62eab5, 0x00003735, 0xfe5bfef2, 0x50689744, 0x8158815d, 0x00008c61, 0x273527cb, 0x0724c86e, 0x0edc0ef7, 0x00001495,
+        0xe616e620, 0x191fe022, 0xa85da844, 0x0000d6a5, 0x3d5d3d33, 0x430e58de, 0x3422344f, 0x00006dbd, 0x1bbd1b23, 0xb05e525c, 0x7b147bda, 0x0000dfa5,
+        0xd522d59d, 0x01b8ac3f, 0xb29fb21b, 0x0000bd6f, 0x6018608f, 0xc1f57a7b, 0xc556c55b, 0x00005506, 0x94e6947c, 0xb12f37ff, 0x393f39bf, 0x000013bf,
+        0xde0ade4c, 0xf8fb87de, 0x46dd4635, 0x00000039, 0x1a4d1a3a, 0x840481ce, 0xdb09db7a, 0x0000c5b2, 0x4bb14b2e, 0xb155e054, 0x0b540b0c, 0x00005c76,
+        0x13d713f4, 0xb1ad7e16, 0xfdb0fda3, 0x0000a755, 0x50a450fc, 0x175ab4d6, 0x4a9b4a58, 0x00009c71, 0x73ab733e, 0x2ea2756f, 0x7896782f, 0x00004611,
+        0xddf5dde6, 0x66afaf1f, 0x69f269f2, 0x0000abe5, 0xd62dd688, 0x3e0ae2e3, 0x737c7329, 0x0000ce41, 0x2ddf2dd3, 0x20b8f2ac, 0x9cf09c38, 0x000070ba,
+        0x8deb8d33, 0x6321f5d4, 0x65fb6570, 0x0000ab08, 0x762c764e, 0x0d0bfbde, 0x444e44ba, 0x00002c66, 0x12ec12da, 0x35ef9d61, 0xd543d51c, 0x00004912,
+        0x213e2156, 0xd61ebecb, 0xb577b522, 0x00003107, 0x610c61e5, 0x762af8fa, 0x5356538b, 0x000015cb, 0x8f6b8fdc, 0x186488d0, 0xda69dad1, 0x00000d53,
+        0xc591c519, 0x92a677d9, 0x544c542d, 0x000046c7, 0x44544407, 0xc27c49d5, 0x768576dd, 0x000093cb, 0x52cf52a7, 0xc00718d5, 0xb018b09e, 0x000093bc,
+        0x62176223, 0xf6e20823, 0xc1acc102, 0x0000e64d, 0xaf34afd9, 0x908e2363, 0x0e170ede, 0x00001d02, 0xe1f7e131, 0xfdf9b554, 0x735473e5, 0x00003135,
+        0x7f607fd0, 0x71722155, 0x578b57ab, 0x0000a0f7, 0xe137e10d, 0x5d9f50f2, 0x2f0e2f91, 0x0000efd6, 0x8e3e8e48, 0xb16c8330, 0x0eaf0eff, 0x00004ef7,
+        0x04ec0404, 0xe18dc866, 0x776977e3, 0x000019ca, 0x64ab6491, 0xb3e20700, 0xb163b10c, 0x00009296, 0x4b124bc6, 0x7fb99f65, 0x63976333, 0x00009d0e,
+        0x3a2e3a66, 0xb3b44a9b, 0x66806602, 0x00009c79, 0xa137a16d, 0x876d55b1, 0xa8f0a80a, 0x000025b6, 0xc26bc293, 0xe61edbda, 0x0475047f, 0x0000175e,
+        0xec31ec01, 0x3e8d18aa, 0x8f9e8fb9, 0x000060b5, 0x6f216fe7, 0xaeedadbd, 0x646264d9, 0x0000ade9, 0x134a13a4, 0x5b828df5, 0xea53eae7, 0x000049f2,
+        0x3337331f, 0x8c882255, 0x0a0b0a22, 0x00001c88, 0x4eb94ee9, 0x77e23620, 0x1a4d1adb, 0x0000a296, 0x14d9140b, 0x43b0ba4a, 0x793679e8, 0x0000464f,
+        0x488e48b4, 0xa5a131e0, 0x4447448c, 0x0000c29e, 0x67ce6734, 0x0c0a5ded, 0x803080a0, 0x0000300a, 0x8e048ec9, 0xffce95be, 0x685f68b5, 0x00007cbf,
+        0x3a5b3a2c, 0xdc046bca, 0x5fb55f86, 0x0000e324, 0xa60da61f, 0x43f9d824, 0x8d588d41, 0x0000da57, 0xcb9dcb47, 0xec6ccc0e, 0xc368c314, 0x0000dcb3,
+        0x2ac52a1a, 0x74d3c33a, 0x24072494, 0x0000fa5c, 0x9c4c9cdd, 0xf05a85f3, 0x6e736eda, 0x0000a865, 0x5cd05c0d, 0xa223698b, 0x2a932afb, 0x0000603f,
+        0x8fd68fd6, 0xe088082a, 0x068a06e5, 0x0000cf53, 0x103010bb, 0x851608d9, 0x69f06919, 0x0000e5d2, 0x4ba74bb0, 0x822817fd, 0x0d8b0df8, 0x00004a11,
+        0x94bc94ba, 0x8b45294d, 0x0f560f49, 0x0000df59, 0x457d45ff, 0x34198fa1, 0x5c105c09, 0x00006c19, 0x1a3c1ac5, 0x70b5ec53, 0xad36ad69, 0x0000024c,
+        0xeddfedfd, 0x9c069b29, 0xcc05ccd0, 0x0000ebd6, 0x053e057e, 0x3aced44a, 0x698169b3, 0x00000360, 0xa961a9d2, 0xe958f854, 0x90ff9014, 0x00000ad3,
+        0x0c0f0c13, 0x4a17cf35, 0xeb50eb18, 0x000032b2, 0xac81ac6d, 0x73da9b57, 0xa427a415, 0x00000733, 0x826d8283, 0x8bae554e, 0xfb5dfbd4, 0x0000772e,
+        0x57a55761, 0x06846bc8, 0x1ca91ce2, 0x00006300, 0x3d203d8e, 0x00d803f3, 0xc3f2c30a, 0x00003639, 0x84c084b4, 0x8eb2288e, 0x909390ab, 0x0000b4f7,
+        0x8f688f93, 0x2ff3e0bc, 0x851a8547, 0x00003241, 0x4d3a4d52, 0x9e536ac8, 0xdab2da39, 0x00001198, 0xc80bc8b1, 0xb823dac4, 0xf109f1d7, 0x0000e9e2,
+        0x57f85711, 0xac5a884f, 0x4f884fbf, 0x0000d70b, 0x3b5a3b89, 0xa4b0d5a2, 0xdd1bdd88, 0x00008dd1, 0x91f591d4, 0xb1b4dd15, 0x24b0248d, 0x0000d5eb,
+        0xb309b33e, 0x9af176a0, 0x79087997, 0x00006815, 0x5d875d41, 0xb154c6c0, 0xc5cac5c7, 0x0000e8e9, 0x2bb22bcc, 0xa06159e2, 0xcf71cf33, 0x0000f451,
+        0xc1e6c1db, 0x500768f4, 0x35683592, 0x0000ff62, 0xff65ffc4, 0x9fc7eae2, 0x31ae31be, 0x0000dd04, 0x823a826e, 0x791ac33b, 0x74a37443, 0x00008c61,
+        0x5c4a5c86, 0x3d5b4dc0, 0x6d956d07, 0x00007a2a, 0x93b893a2, 0x0a988a18, 0xd29bd29b, 0x0000f573, 0xb0d0b03f, 0x5fa74561, 0x1262126a, 0x0000f3d2,
+        0x16da16a4, 0x1815479c, 0x05fb055e, 0x0000935f, 0xd57bd5b5, 0x497f557b, 0x90429005, 0x00008eb1, 0xde1fdec0, 0x73ad8c5d, 0xd456d4fe, 0x000007c3,
+        0xebaceb15, 0xec8ce9a4, 0xcbb4cbda, 0x00001549, 0x45b04572, 0x376b3df2, 0x22172221, 0x00008881, 0xbdadbd8b, 0x20305ae0, 0x39a9391c, 0x00006717,
+        0x92c59296, 0xe55ce421, 0x4ae94a25, 0x00006200, 0x84cf84b3, 0xe72368b6, 0x24fc2463, 0x00007930, 0x7b387bb3, 0x44561786, 0xdebfde65, 0x0000081c,
+        0x708f7086, 0x57fbdceb, 0xb50ab535, 0x0000b2f2, 0x06e20655, 0xde04daa7, 0xced2ce95, 0x0000cbaa, 0xba36baee, 0xf96ab058, 0x782f78df, 0x00001688,
+        0xc948c92a, 0x40d6c6c1, 0xe7b0e711, 0x000028e2, 0xa388a385, 0x33c3f128, 0xb7c6b73a, 0x00008720, 0x980698d6, 0x4eb48f5c, 0x19a119a1, 0x00009115,
+        0x29962936, 0xe0ffbefa, 0xc46cc46e, 0x000077d0, 0xac5eac16, 0xcf275467, 0x29be2908, 0x0000e00b, 0xc8ccc867, 0xbba93b70, 0x786178ca, 0x00003824,
+        0x60c36020, 0xd1cb9539, 0xde4fde1e, 0x0000b77c, 0xd8d4d87b, 0x1f75c8e6, 0xce36cefe, 0x00004d04, 0x1fcf1fd2, 0x35b70813, 0x9da69d2d, 0x0000240f,
+        0xe1fee15e, 0xe343e47d, 0x3e493e68, 0x0000908a, 0xf4aaf43f, 0xd7d69f59, 0x85b8855e, 0x0000a575, 0x2e0d2edd, 0x95e78aa2, 0xbb26bb82, 0x00008a61,
+        0x2d312dc9, 0x0155aee0, 0xec97ec77, 0x0000688b, 0x0fa30f58, 0x3b28d85b, 0xa918a976, 0x00001d93, 0xc1ccc1a6, 0x543bebb0, 0x66da6648, 0x00003d33,
+        0xfb87fb11, 0x1751b2b9, 0x0a170a2d, 0x000003a0, 0x10c010d7, 0xc715a779, 0xb8b2b860, 0x0000adc6, 0x7c3e7ca3, 0xfdce2fbb, 0x469846b9, 0x0000a7e6,
+        0x6f016fad, 0xcdca24e9, 0x184418f3, 0x0000f251, 0x9db69d00, 0xe32d1aaa, 0x12861201, 0x00001353, 0xbc4ebc17, 0x3edff61d, 0x346134fc, 0x00005058,
+        0x5bf05b82, 0x02ed568d, 0x3db83d2f, 0x0000187b, 0x4dfa4de9, 0x35efecec, 0x1fe01fe9, 0x00008d71, 0x801b8084, 0x29d28bef, 0x7e437e70, 0x00001dac,
+        0xe85be8b2, 0xd48be3dc, 0x814581b3, 0x0000129a, 0x2f622fd2, 0x5b840714, 0xf937f95d, 0x00008bde, 0x132913a9, 0x23d265e5, 0xfa03faae, 0x00004030,
+        0x04a504f1, 0x3e50e5dc, 0x7ae87a47, 0x0000d5a5, 0x4cc34c2d, 0xeeec59e3, 0x4b8b4b3f, 0x0000a165, 0x10de10c8, 0x901618cf, 0x7c0c7c5b, 0x00001616,
+        0x9b2a9bb4, 0x0c6b427b, 0x512c51f6, 0x00002390, 0x1cf11c25, 0x647f1de9, 0x3cf33c84, 0x000015c9, 0x715f7142, 0x3f7c0939, 0xdf61dfd0, 0x0000c3ef,
+        0x593159df, 0x49d7eab0, 0x2cc62cb9, 0x0000b87d, 0x89d58916, 0x8894a62f, 0x2e3a2e74, 0x0000dd36, 0x78d478c5, 0x514db831, 0x95a19552, 0x0000a385,
+        0xd3ebd3ed, 0x1750bff6, 0x3f753f70, 0x0000d148, 0x48ae486f, 0x5ab973a9, 0x7a5e7aad, 0x0000f80a, 0xfcbbfcdf, 0xd46d3510, 0x30ea3055, 0x0000453f,
+        0xbf95bf1b, 0x2cb63cb9, 0xdb41db1e, 0x0000e457, 0x383138ae, 0x55dc03f4, 0x704c70e3, 0x00001884, 0x479e472b, 0x5097f30e, 0x2aef2abf, 0x00000ccf,
+        0x7b257b22, 0xdf8fb947, 0x09a009bc, 0x0000c8b2, 0x112e110f, 0xf9489527, 0x69556926, 0x0000720f, 0x37153783, 0x487d9339, 0x0674064d, 0x0000a301,
+        0xe3a2e3f7, 0x1ea5b2a7, 0xfb36fbd4, 0x0000ab64, 0xb683b671, 0x0024bd48, 0x40cf4066, 0x00004212, 0x39cc3995, 0x0b441c67, 0x70e9708c, 0x00005409,
+        0x76387647, 0xecf203f4, 0x8c068c12, 0x000079cc, 0xcda3cd60, 0x542cd8d9, 0xb23fb243, 0x00002aa9, 0x17c8178b, 0xa20db2f1, 0x627162d1, 0x00004763,
+        0x550955a9, 0xb81a33e0, 0x100c10f1, 0x00008871, 0xff76ffa5, 0x79855922, 0x2ad92a61, 0x00009c87, 0x294f29da, 0xa6412942, 0x84cd84bf, 0x00005738,
+        0x19fb1934, 0xfd03f155, 0x090d09ef, 0x0000edf6, 0x6492641a, 0xfb18759f, 0x455a45b6, 0x0000d91f, 0xf746f781, 0x598968f4, 0x523052af, 0x0000bc4e,
+        0x76fd76f1, 0xffcf0a06, 0xe119e1c8, 0x0000819c, 0x014401a7, 0x706db2a7, 0xdccedc6d, 0x00005399, 0x23d72386, 0xc99acb6e, 0x76ba76b6, 0x00004d7c,
+        0xe14ee100, 0xf5baf416, 0x7da97dfb, 0x00007efe, 0xba0dba2a, 0x58dd44a8, 0x6f596fbf, 0x000084a3, 0xbaceba9a, 0x6d1c6d93, 0x396439ab, 0x0000fd23,
+        0x8f488f0b, 0x954f2299, 0xb263b2c0, 0x0000dd28, 0xdb9ddb53, 0xc2ebfae5, 0xb01fb05c, 0x00003a60, 0xf264f253, 0x3d0ad858, 0xcb16cb2d, 0x0000e958,
+        0xeebcee3f, 0x3c48b454, 0xa009a015, 0x0000c012, 0x3cc23ca2, 0x6232d7fc, 0xe45ce483, 0x0000ef03, 0x31a43152, 0x9c573a5f, 0x84df8402, 0x00002486,
+        0xbc80bca7, 0xf13df7d4, 0x4b964bbe, 0x00007973, 0x950295ea, 0x2fe947e6, 0x9f7e9f22, 0x0000bc10, 0xaaceaaa2, 0x87c83f70, 0x8a628ab3, 0x0000d8fe,
+        0x9cab9c25, 0x971c7897, 0x30b43016, 0x0000aefe, 0xecbcecd0, 0x2078833e, 0x081408ce, 0x0000e20d, 0x2e8c2ec7, 0x5239b4e7, 0x441e449c, 0x0000d03b,
+        0x0359038a, 0xeb0e641b, 0x9d6f9d2b, 0x0000bba8, 0x3e1e3eb8, 0x26d23d3c, 0xc86ec8ff, 0x00003dfc, 0x975297a2, 0x9b188ffe, 0xdcabdc96, 0x00007b80,
+        0xc698c64d, 0x4807574f, 0x5d8c5d46, 0x00005884, 0x62286233, 0xdae411ff, 0x53555329, 0x00001a2a, 0xd12fd19b, 0xc82a5fdd, 0xc84ac826, 0x00004d43,
+        0x719d7144, 0x077b824d, 0x7e557e9e, 0x00000633, 0xc15cc1fc, 0x4c36aa03, 0xee8dee68, 0x0000261e, 0xa9e1a91a, 0x4164bbc9, 0x64cd646b, 0x0000060d,
+        0x38a638d2, 0x84fa5248, 0x5efe5eef, 0x00000272, 0x66016604, 0x8ef7f63a, 0x8d9b8dc2, 0x000065af, 0xc330c34f, 0xedb157fc, 0x756b7522, 0x000012e8,
+        0x1c291caf, 0x3f728d5d, 0x84c48492, 0x00000278, 0xcc73cc3c, 0xadf11541, 0x433a431c, 0x0000ee15, 0x36c13659, 0x5de8fcc6, 0x818281f1, 0x0000bde4,
+        0xcb9dcbc8, 0x981b6ab4, 0xabdfabb3, 0x00000c9b, 0xb896b889, 0x2969717b, 0x238623e6, 0x0000c9aa, 0xe936e9bf, 0x8dc4776f, 0x30683051, 0x00008571,
+        0x2b2e2b16, 0xae5b42f1, 0x8a148a46, 0x0000c510, 0x704a7009, 0x76751189, 0xbf5dbf08, 0x000095a6, 0xcd7ccd6c, 0x6e1cb7e7, 0x26592607, 0x0000b0cd,
+        0x7c9d7c8f, 0x578225a9, 0xa56ea592, 0x000030f1, 0x8dfd8de9, 0xe6c1f7dd, 0xac99ac0e, 0x0000c26d, 0xf9a2f990, 0xa0f193ef, 0x726b72b1, 0x00007861,
+        0xd13dd1f2, 0x3596aecd, 0xb8bcb832, 0x00009c71, 0xbe5bbe99, 0xadb03b83, 0x49c3491a, 0x00008ee4, 0x82c182a8, 0x0df95533, 0x4f8c4fa3, 0x0000d03b,
+        0x961f961f, 0xf118c343, 0x4f014f45, 0x0000b47d, 0x28da28e3, 0x16c6a065, 0x05fb0557, 0x00007380, 0x0a570aec, 0x9b4f7e7c, 0xf348f31b, 0x00006117,
+        0xf6adf6ab, 0xe0a2a947, 0xacd3acbe, 0x0000b9c6, 0x27ac27ca, 0x630c2fbb, 0x0bed0b1e, 0x0000a6e9, 0x788878b6, 0x562db221, 0x113f11bf, 0x0000d3b9,
+        0xd046d07a, 0x0ef53623, 0x0f6f0f4a, 0x0000db74, 0x5c125c1f, 0x54df0c46, 0xea68ea0c, 0x0000d952, 0x601f60ab, 0xf7eb77d9, 0x906f9014, 0x000092b9,
+        0x623762a6, 0x06fbb6d8, 0x8479843b, 0x00005484, 0x201a2048, 0x014490f8, 0x17f317ba, 0x000018a5, 0x6b306b2a, 0xe352b566, 0x642c641c, 0x000004cf,
+        0x89c089ea, 0xd7ebf5a4, 0x53515370, 0x0000581d, 0xc7a3c74d, 0xbb4be639, 0x441c4494, 0x00009ce0, 0x829c82cf, 0x0dcb97c4, 0xc373c316, 0x0000d876,
+        0xe464e4f3, 0x82e8fe8d, 0x4b7b4bd2, 0x0000ba05, 0x794979a5, 0x2d466156, 0x4453447b, 0x0000175e, 0xb06ab07c, 0x5acb7ec2, 0x399a39c0, 0x0000eca4,
+        0x97ba97f8, 0x6250e31e, 0xd8fed82d, 0x00000ecf, 0xe8eee8d0, 0xc55d87a7, 0xb078b0fd, 0x0000b98e, 0x71f971eb, 0xa6330f72, 0x7f357f0e, 0x00003c4c,
+        0x6bc96b17, 0xbab3ccfc, 0x757e75a0, 0x00007151, 0x82c182a6, 0x0d84f824, 0x664d66d5, 0x00007db1, 0x2c172c47, 0x2c42d4fb, 0xa1d8a131, 0x0000d6a6,
+        0xfe8bfe0f, 0x4e09a6ed, 0x6af36aff, 0x00005809, 0x64d964ce, 0x3048ac96, 0x5fcc5f71, 0x00002e3a, 0x56e75605, 0x2623a77c, 0x9bca9b6b, 0x00003913,
+        0x8658865d, 0xc31d1434, 0xc690c68b, 0x0000f2ec, 0x1fb81f1c, 0x6f4005c8, 0xa8c0a802, 0x00003031, 0xf1c1f1ce, 0xae325c65, 0x664a66ca, 0x000056e8,
+        0xbeefbe3a, 0x0de9d449, 0x4a524aa5, 0x00005add, 0x67706750, 0xda042c5b, 0x0fb80ff1, 0x000048a0, 0xbfd9bfcc, 0x706ebb90, 0x5065502e, 0x00000563,
+        0xa51ba50e, 0xb93a83cc, 0x8a5a8a5e, 0x0000c732, 0x7ab37adb, 0x13da9808, 0x6a5c6af5, 0x0000650f, 0x1e6f1e11, 0x6e22e87d, 0x02e302b7, 0x00008e61,
+        0x207920d8, 0xae4f4996, 0x44f3446b, 0x000013a3, 0x8b118b21, 0x2ca11189, 0x2d9d2d89, 0x00005f18, 0xa480a497, 0x4a0518d0, 0x957c9550, 0x0000f6bc,
+        0xaad1aa45, 0x11aa6293, 0xb94ab9bd, 0x0000a0c9, 0x0cc00c5e, 0x1e6acc31, 0x4c0b4c6d, 0x0000be10, 0xeeb9ee55, 0x9068143e, 0x43374396, 0x00002af9,
+        0x9048909f, 0x936c3510, 0xb852b8c6, 0x0000ed4b, 0xad07ad16, 0xdf619507, 0x2c182ccf, 0x000010f7, 0xa180a183, 0x5ba7d3d6, 0x6388633e, 0x0000fab3,
+        0x15d21557, 0x326e7916, 0x74477450, 0x00001b88, 0x932993ab, 0xbcceabb8, 0xacf3ac7b, 0x000019cb, 0x0f860f65, 0x166afd30, 0x61f061d1, 0x0000ec15,
+        0x0d0f0dba, 0x6ac318d2, 0xf09af02c, 0x00001425, 0x51dc51ad, 0x8c651e65, 0xe0aee0b6, 0x0000d266, 0xc247c27d, 0x43e798ac, 0x47d0479b, 0x0000e9bf,
+        0x37f1373f, 0xa88c4104, 0xa91aa930, 0x00009a01, 0x2dfc2d83, 0x716ca86b, 0xf0bff013, 0x00002e04, 0x91019134, 0x8dd638d1, 0x3d8d3de2, 0x0000fd32,
+        0xd8aed874, 0xddf0dd94, 0x7f577f4e, 0x0000a1b1, 0x6eb26eb0, 0x2ff0ed49, 0x81fa815f, 0x000023ea, 0xf0d1f0ac, 0x8bc099d3, 0xd7b3d7a4, 0x0000e1b7,
+        0xa388a3f6, 0xaa51b6d6, 0x38df3877, 0x0000039e, 0x48f6484a, 0x5cece2dc, 0xc05dc0e5, 0x0000ab47, 0x845d8442, 0x4a6ae9cf, 0x858c85f1, 0x00001da5,
+        0x9806980a, 0x76cd06bc, 0xb6afb66a, 0x000055fa, 0x1cac1cde, 0xdd8a9483, 0xca96cae3, 0x0000e08a, 0xa36ba345, 0xd9db59dd, 0x4471446b, 0x000007ac,
+        0x75ee75b3, 0x934f4a62, 0x39a439bc, 0x00007ca3, 0x13c81341, 0xc9a52026, 0xfb74fb94, 0x00008925, 0xc4aac448, 0x08e9bda0, 0x1bd91b6f, 0x00005398,
+        0x5cd15c63, 0x4127413b, 0x16f016ba, 0x0000ad16, 0xc814c826, 0x09cb72a9, 0x416241e6, 0x00001a02, 0x6793670f, 0x9e2c3596, 0xbc2ebc01, 0x0000a469,
+        0xdd48ddf0, 0x10aa1e12, 0x7cb37c5d, 0x0000195e, 0xd4ead4c7, 0x6ac35bbf, 0x016b0133, 0x00001b7a, 0x68a468ab, 0x78258913, 0x6f946f79, 0x0000714d,
+        0xc81ec8bf, 0x8627a9c7, 0x9577952c, 0x0000b905, 0x8057807f, 0xf69bead3, 0x19bf1994, 0x000061f6, 0xbfc6bf9e, 0xba4fec6b, 0x80368082, 0x000058e0,
+        0x57865727, 0xf39baa87, 0xbf17bf5b, 0x0000a0dc, 0x5e925e1f, 0x46f47652, 0xe814e8c8, 0x0000a9fa, 0x16f716d3, 0xe8530522, 0x0cf80c49, 0x0000352f,
+        0xd6e2d65a, 0xc677e339, 0x49b8499e, 0x0000ca7f, 0xbc2bbcdb, 0x1f3a18aa, 0xa9e5a9af, 0x00005ee8, 0x6858682a, 0xbbaeaa76, 0xb4d6b489, 0x00000ad2,
+        0x0a910aa4, 0x0026c6d3, 0xf258f216, 0x0000f2dd, 0x45a245ad, 0x28c0ed98, 0x146a1465, 0x0000fc33, 0x2ad62aec, 0x515d38bf, 0x314c31f6, 0x0000f5f1,
+        0xd9bad928, 0x73448ce2, 0x359235ec, 0x0000b28e, 0xb516b566, 0xc0aae37d, 0x4b8c4b09, 0x00001888, 0x83b983ab, 0xe999c33d, 0x232123f9, 0x0000d9de,
+        0x57dc5735, 0xa5612d8d, 0x417941d0, 0x00002275, 0x83028398, 0x775c3eb1, 0xecaaec41, 0x00002aea, 0x3f903fa7, 0xcb6416bc, 0x12ac12a2, 0x0000236b,
+        0xf493f428, 0xc28a4e7d, 0xd799d79d, 0x0000789d, 0x282a28d1, 0x2a67e16a, 0x6b276b37, 0x000099a8, 0xb6e9b60f, 0x0ccbe7e2, 0xa52ea5d3, 0x0000d03b,
+        0x82c58284, 0x83d550cd, 0x34aa34e2, 0x0000895f, 0x08120857, 0x81243adf, 0x0d2d0d00, 0x00007fb0, 0xc5ccc5dc, 0x6e207b42, 0x580b585d, 0x0000c613,
+        0x3ef33e30, 0x236da31b, 0x86a08697, 0x0000f0d3, 0x662966b6, 0x9f97fc47, 0xc924c915, 0x000007ac, 0x01710113, 0x644e645b, 0xbaffbaba, 0x00001263,
+        0x021b027c, 0x2d429baa, 0xfc93fcf1, 0x00007cfe, 0x21de215e, 0xfb6ef59d, 0xf549f531, 0x0000f250, 0xc5e5c5f6, 0x38504b05, 0x45914536, 0x0000c85c,
+        0x825282de, 0xe669b5af, 0xd7acd7d9, 0x00000282, 0x43c2437f, 0x2a92219b, 0xf822f828, 0x0000e9bf, 0x40c04078, 0x916989e1, 0x1a631a23, 0x00002da4,
+        0xd0acd0c6, 0x4065ea64, 0x10a7101f, 0x0000a8c9, 0xf727f7df, 0x2e41b56d, 0x9b509b14, 0x00000db8, 0xe188e178, 0xc8a49de5, 0x3f883fdc, 0x00002c2f,
+        0xd38dd353, 0xb9a35f91, 0x50b350af, 0x0000bf24, 0x2a182a43, 0x635a4f68, 0x612361a4, 0x00002bd8, 0x3e893e3b, 0xf7c214de, 0x8fa38fc4, 0x0000020d,
+        0x8be98b23, 0xc5eba8c3, 0x8d8e8da9, 0x00006b35, 0x884588e1, 0x88475981, 0x5d395dd0, 0x0000f640, 0x29472947, 0x01490d27, 0x3b8e3b07, 0x0000f60c,
+        0x344334c3, 0xd44f908c, 0xfa08fa6c, 0x00002ef9, 0xe6f7e62d, 0xfd115151, 0x74b674ff, 0x0000bfee, 0x53dd53a9, 0x254e76f2, 0x714471c1, 0x0000e5db,
+        0x27d127b3, 0xdf1aa9c7, 0x7e027e72, 0x0000eef6, 0x68ab6896, 0x0f6a3dff, 0x17b5171e, 0x00005c29, 0x66cd6651, 0xcf7bd8a5, 0x5b645b2b, 0x000051ab,
+        0x56e656c2, 0x4c277766, 0xba22bace, 0x00003f35, 0x18f51861, 0x54b2537c, 0x2d7b2d65, 0x0000ba10, 0xd9f3d9e5, 0x33abd136, 0xd155d1bd, 0x0000412f,
+        0x49674993, 0x9cc7cea8, 0xbcc9bc89, 0x00009699, 0x8dde8d23, 0x6a40bb6d, 0x716b71e7, 0x0000c3dc, 0xaf18afdd, 0x16dace53, 0xac93ac3d, 0x00009ad1,
+        0xe03ee0b3, 0x002652cd, 0x7f287ffa, 0x000051c8, 0x2f202ff3, 0x4366f4a1, 0x3c5d3cd0, 0x00008930, 0xc027c003, 0x5b75ad54, 0xb9eab923, 0x0000bc4e,
+        0x350635df, 0xd7141e59, 0xa27ea234, 0x00005999, 0xf148f1a8, 0x4a7f469b, 0xc52cc570, 0x0000bcba, 0x0057007d, 0xa7fe2756, 0x7a8d7a21, 0x000047ef,
+        0xa945a966, 0xe5b88cfe, 0x87b487d9, 0x00000d1b, 0x5782576f, 0xd17bae94, 0x4c7a4cd4, 0x0000ad07, 0x80cf801a, 0x694f8fdf, 0xd03ad03d, 0x000057c5,
+        0xc5ebc526, 0x1121fe8d, 0x1fc11f8b, 0x00004e8f, 0x3f863f07, 0xdbbfd9a5, 0x8a558a16, 0x0000a123, 0x4ff64f9a, 0xb38ebe60, 0x1c5f1c1e, 0x0000a5e4,
+        0x6df96d31, 0xad33dea5, 0x194a1918, 0x0000f38d, 0x3f533f2f, 0xce3eab52, 0xd3a6d37f, 0x000028a4, 0x7f067fd7, 0xf45425ac, 0x861b8654, 0x0000b097,
+        0x7c3a7c43, 0x2a16595c, 0x050505c1, 0x000042bd, 0xca74ca4d, 0x1518182f, 0xabd3ab69, 0x000033b3, 0x6f656fbc, 0x71cc4ba5, 0x890c891e, 0x00001d53,
+        0x93cd932a, 0xc9871701, 0x5e235e4e, 0x00002b3e, 0xc5d1c53d, 0x89475cdd, 0x5f855faf, 0x0000ef9b, 0xcf71cf6b, 0xd2cb82fe, 0x7acc7a87, 0x00009bc8,
+        0xc956c914, 0xb2a989ef, 0x4c864c32, 0x0000a564, 0xd8a9d80e, 0xdeb0bc37, 0xcb20cb5b, 0x0000e4cb, 0xfe73fe1d, 0x4d9f3882, 0x46a1466f, 0x0000b1c7,
+        0x29a529f8, 0xa0415ded, 0x3afb3a4f, 0x00007fee, 0x09050994, 0xc6256362, 0x4b764b11, 0x000023a2, 0x73687370, 0x3db6e444, 0xa334a38f, 0x00005c23,
+        0x4a554a4e, 0x8e987943, 0x60126068, 0x000035dc, 0xb9e1b92b, 0x66ae281d, 0x8baa8be1, 0x00009009, 0xce99ce5a, 0x31efd136, 0xf94af90f, 0x00006fea,
+        0xc81ec8d8, 0xd5691ed3, 0x39fb394d, 0x0000b06c, 0x0cc90c72, 0x1a5d8c0f, 0xb141b1dc, 0x00003441, 0x937f9356, 0x9e2eaf8a, 0x2d142dd6, 0x0000482d,
+        0x763376d5, 0x802864da, 0x222522d9, 0x00000bad, 0x3d3b3da5, 0x5f5d8bd1, 0x97b8971a, 0x00000172, 0x70217055, 0x393c25af, 0x95419545, 0x0000ce10,
+        0x4dec4d75, 0x1e4d94f3, 0x20ab20f7, 0x0000e6ca, 0x80518065, 0x12f995be, 0x8f7a8f3b, 0x00004234, 0xadc8ad3b, 0x3850ae95, 0xb3d3b36f, 0x0000129a,
+        0xa2cea23b, 0x2f92edcc, 0xe851e8e8, 0x000013bf, 0xe8c1e8d2, 0xc455dfd4, 0x62636248, 0x00000c2c, 0x78527814, 0x1b058530, 0xfff1ffa9, 0x0000c45d,
+        0x75af753c, 0x0d7b8e5b, 0xaa11aa48, 0x00009d30, 0xb232b23b, 0x68bb0cdc, 0xe93fe944, 0x0000d187, 0x1a811a16, 0x560a6cf4, 0x180e1839, 0x0000739c,
+        0xec7eecd8, 0x6e7e7a7e, 0xc167c17f, 0x0000c68d, 0x54205448, 0xb61b8071, 0x484c48e2, 0x00007b5f, 0x45d6452a, 0x58438a65, 0x14481458, 0x000067e1,
+        0x49294914, 0x7112fa9a, 0xa834a8a4, 0x00002587, 0xb42eb4fa, 0xdcef0629, 0x8b768bed, 0x0000bd62, 0x10451079, 0x9e593557, 0x9e659ec8, 0x0000505b,
+        0x54c454b5, 0xba485043, 0xca48ca10, 0x00009a8a, 0xa01ca02f, 0xfd49f002, 0x4721472e, 0x0000b27e, 0x38e13867, 0x0515f45c, 0x5281522e, 0x00008980,
+        0x1cef1ce2, 0x70126fca, 0x79de793b, 0x00003ec4, 0x5f675fd6, 0x7c1cf598, 0x53db5364, 0x0000024c, 0x791a7951, 0xda8a69ca, 0xbd96bd20, 0x000042b0,
+        0x353635ca, 0x0a5aa0a4, 0xa80da826, 0x0000cc40, 0xea2fea65, 0x3f8d2026, 0x0b7b0bfd, 0x00000e26, 0xd0d3d084, 0xbeccb7a7, 0x7a7f7acd, 0x0000cae7,
+        0x6c766cd1, 0x32e00af0, 0x7e807ec8, 0x000055e3, 0x4e9f4eeb, 0xd14fc385, 0x080b0893, 0x00005576, 0x81b78187, 0x1dd4c8d8, 0xbf78bfd4, 0x00000ed9,
+        0x93899374, 0xaeecbcd6, 0xf233f2cf, 0x000013a4, 0x3e543e59, 0x02be258c, 0xad30adde, 0x0000d5ca, 0x6421640d, 0x99fa75a6, 0xb370b39b, 0x0000e17b,
+        0xb85db844, 0xd34bf168, 0x43aa4353, 0x00003168, 0xe329e33e, 0x442600c8, 0x2bf72bcd, 0x0000b910, 0x38eb381c, 0xfa002654, 0x4c0c4c5f, 0x00001c14,
+        0xde91decd, 0x5178df56, 0x337f332b, 0x0000bd8e, 0x845e8422, 0xf45c8301, 0xa51da5fe, 0x0000366d, 0x851585ad, 0x9f06ac45, 0xd75dd733, 0x0000201b,
+        0x5cc35c5e, 0xab6e6a3a, 0x21be210b, 0x0000d3f8, 0xdd15ddd3, 0xb475cf57, 0xf907f91c, 0x0000598d, 0x2e812e14, 0x35018490, 0x01f90130, 0x00001fa5,
+        0x6f636f56, 0x7e3e874d, 0x61916133, 0x0000a01d, 0xce72cee5, 0x6d9f89a1, 0xfc09fcd3, 0x00001353, 0xb4e7b4d3, 0x7fcd7a3d, 0xf2aef279, 0x00005b54,
+        0xf13ff169, 0x265dcc2e, 0xd3add359, 0x00002f8d, 0x5d215d16, 0xbddb372f, 0x74b17459, 0x00007d39, 0x2c092c9d, 0x615045c5, 0x86fe865e, 0x000082a2,
+        0xf84df831, 0xa51d2ce6, 0x2a762aa6, 0x00001014, 0xc19ec13f, 0x4699824d, 0x267926d4, 0x0000e2f3, 0x3f513f7d, 0x63a1f456, 0xd8a1d87e, 0x00000e5d,
+        0x0022007c, 0x4311c236, 0x8b658b94, 0x00002ca6, 0x30f030f2, 0xa268a7ce, 0x57ab5778, 0x00000989, 0xd6f1d616, 0x3b284c2b, 0x9e0c9e7c, 0x00008b2f,
+        0x341834c7, 0x5156750e, 0xe82ae865, 0x0000d91e, 0xceb6ceb2, 0x75b22d60, 0xb217b290, 0x0000424e, 0xe628e6db, 0x8f06f1ac, 0x4a4d4ad5, 0x00003c2d,
+        0xfe6afeb5, 0x9ff72a80, 0x39b13955, 0x00000c33, 0x7e317e66, 0x0ff533df, 0xe5cde547, 0x0000014d, 0x985498db, 0x764455cd, 0x95d39530, 0x00008a90,
+        0xe3afe37b, 0x26983641, 0x00810031, 0x00007d60, 0x37c837be, 0x677a44c4, 0xcbefcb4f, 0x0000239c, 0xa0a3a0a9, 0x0d5a5cdd, 0xec1fec21, 0x00009c16,
+        0x134e133b, 0x2fe282cc, 0x685e6848, 0x00006d7a, 0xdaffda50, 0x3857bbc6, 0xe58de58d, 0x0000c413, 0x5bfc5b6c, 0xdd046bb6, 0xbae7badc, 0x00007c81,
+        0xb941b91b, 0x45055cf9, 0x8f248ff5, 0x00005e50, 0xb590b5eb, 0x7b77a1da, 0xd020d09a, 0x0000e1b3, 0x1c351c46, 0xd8915380, 0x6f0a6f68, 0x00005f18,
+        0x6dff6dec, 0x32fdc967, 0x01750193, 0x0000ddca, 0xbd78bd60, 0x9310a9df, 0x47f547d9, 0x00007bfd, 0xf638f66e, 0x76cd99d7, 0x4d094d95, 0x00009fc1,
+        0x7ae27a24, 0x4146e84f, 0x274c27e2, 0x00009150, 0x64e264db, 0x344df5dc, 0xadb4ad20, 0x0000b9f1, 0x6f896f29, 0xd54fb857, 0xc9f8c942, 0x00006f14,
+        0x4a2f4ab0, 0x4526b76b, 0x9217927b, 0x0000f963, 0x651f656d, 0xb4f75b3f, 0xf8f9f8a9, 0x0000c332, 0xfa76fa57, 0xa223eee2, 0x1111110e, 0x00004fb6,
+        0x41074173, 0x1594330e, 0xddcbdd56, 0x00003e4c, 0x724272ce, 0x5cc87564, 0x63c8636f, 0x000070e5, 0x59ae5961, 0x0de2f456, 0xb077b049, 0x0000ef89,
+        0x8b7e8bdf, 0x23a2c07f, 0xb30db394, 0x00000ccf, 0x8edf8e22, 0xf5ccc5b7, 0xa159a1d4, 0x00005ee8, 0xc947c929, 0x8a27cfd0, 0x50df5040, 0x00009384,
+        0xd8e9d8b1, 0x950b2756, 0x27cc2791, 0x00000362, 0x30c430f6, 0x195ef596, 0x294f29e0, 0x00008261, 0x24ba24f9, 0xe8ece12d, 0x375037a4, 0x00001b7b,
+        0xd9ccd954, 0x4fd64210, 0x0b950bde, 0x000032b0, 0x62a462c5, 0x4256c741, 0xf562f589, 0x0000ed89, 0x931393d4, 0x62b200c8, 0x663266d2, 0x0000efd0,
+        0xd201d249, 0xfbbf0491, 0x4cfd4ce6, 0x0000059f, 0x9dcf9d5d, 0xc5cac7fe, 0x5155518b, 0x00004e11, 0xd1d4d12a, 0x0d16ba12, 0xa4b9a4d1, 0x00001cac,
+        0x85df85da, 0x20c7e522, 0x15e11501, 0x0000d004, 0xdc27dc29, 0xf07c80fe, 0x4a2c4af5, 0x0000003a, 0x34e734f1, 0x348c31a0, 0x860186da, 0x000092e0,
+        0xbbcebb63, 0x245a29c4, 0x4d6b4df0, 0x00006df4, 0xda41da23, 0xafe0609d, 0x38363844, 0x0000840e, 0x05a60534, 0xdf76b5b4, 0x1c5d1c13, 0x000051a7,
+        0x531d5341, 0xf2ce5bd8, 0xb9a4b9ac, 0x0000b549, 0xb285b2cf, 0x3589ffdb, 0xb27cb227, 0x00009c0f, 0xfb46fb61, 0x049bb1c9, 0x882e8808, 0x00002407,
+        0x0722078d, 0x210103ca, 0xe444e4b6, 0x000047c2, 0x0cd20cd1, 0x0515a6ed, 0xd086d0e2, 0x000081dd, 0x5a675a0e, 0x49b9f255, 0x734373e6, 0x0000c9b4,
+        0x5445541a, 0xbd1316df, 0x588558b5, 0x0000bf1d, 0xa651a689, 0x29d270c5, 0x9e139e86, 0x0000ca41, 0x26092667, 0x0f8504c8, 0xf977f996, 0x00007d4c,
+        0x396a3999, 0xee9603c9, 0x689368ba, 0x00009c0e, 0x833e835c, 0x90cb0f01, 0x380e389c, 0x00006e35, 0xd19ad19d, 0x48891d55, 0x291d2912, 0x00006280,
+        0xb549b508, 0x54b25132, 0x21f621f1, 0x00002a48, 0x726972d0, 0x3c657c85, 0x324432f1, 0x00003c0f, 0x30d5305b, 0x1bde5e2c, 0x55045558, 0x0000df88,
+        0x6dc36d95, 0x77824e0b, 0x24592407, 0x0000c98d, 0x1f9a1f34, 0x31d0eaf8, 0xb5a6b5b8, 0x0000c632, 0x2445245c, 0x4812226b, 0xbe1bbe34, 0x00008750,
+        0x1135112c, 0x90dceb70, 0x64ea649c, 0x00000cec, 0x47a54747, 0x22784834, 0x1de51de1, 0x00005ce9, 0x450c4553, 0x5822db24, 0x37c2371e, 0x00005706,
+        0xa2b2a2c0, 0x068446fb, 0x2db02d65, 0x0000702e, 0x757275a1, 0x532d8842, 0x44894403, 0x0000ac4b, 0x2e312e6a, 0x2411a153, 0x144a1499, 0x0000a248,
+        0x40a5404a, 0xb871fe7c, 0xcc57cce0, 0x00005b36, 0x0ac30ad2, 0x2c4ca32e, 0x46224695, 0x0000a564, 0x48da4811, 0x805c8371, 0x9fef9f11, 0x000051c9,
+        0x7a807a32, 0x9e56b455, 0x76bc76fe, 0x0000a847, 0xe7afe714, 0x86087e7e, 0x30f83070, 0x0000d840, 0x67dc6734, 0xf6ae5095, 0x51b05184, 0x000033ab,
+        0x70e2705b, 0xba455f13, 0x982f98fa, 0x0000ba91, 0x89708978, 0x363c1c53, 0x00410070, 0x0000426f, 0x71077109, 0xa6de252b, 0xaf41af77, 0x000057a7,
+        0x3a3d3a44, 0x85a66bcb, 0xa001a016, 0x0000c3ef, 0x295529ee, 0x53a72e71, 0x241b2420, 0x0000f431, 0x22f4227b, 0x6d001f21, 0x1e0a1e8c, 0x000092b9,
+        0x833583ac, 0x7855f7e9, 0xbb75bb93, 0x0000f02d, 0xd9c5d995, 0xf0a868f4, 0xdb87db86, 0x0000045d, 0x48e548e8, 0xb44b0e26, 0xe1a8e148, 0x0000eb64,
+        0xc4d1c42a, 0x710283ce, 0x398c393f, 0x0000902b, 0x459245fd, 0xaefcf456, 0x33ff330f, 0x0000e703, 0x6d716dee, 0xb9cc3220, 0x5c815cac, 0x0000274f,
+        0x35b33552, 0x92dcf17b, 0x944494a5, 0x00006035, 0x233a2327, 0x805e3e4d, 0xd96ad96d, 0x0000a8aa, 0x17b417bb, 0x3519fe87, 0x928d92c8, 0x0000fecd,
+        0x771777ca, 0xdb4f430e, 0x74a674db, 0x00000722, 0x0a150ad7, 0x8f6463a5, 0x02a502f7, 0x0000cbaa, 0xce46ce18, 0x66acfbac, 0x65f365ed, 0x000002b2,
+        0x229622da, 0xfd111313, 0xc0b1c08b, 0x0000a847, 0x90f590d5, 0xf318ec2a, 0xd93fd947, 0x00003d66, 0xb24fb2f0, 0x8fc7be74, 0x09ca0931, 0x0000a46f,
+        0xd794d7c9, 0xc65d1ee7, 0xc4dec49a, 0x0000b013, 0x69f7699d, 0x545d99e8, 0x6c376cf2, 0x00005406, 0xdb14db40, 0xdff3f313, 0xc641c6ae, 0x0000c713,
+        0xdad1da4d, 0x5228443b, 0x33f7336a, 0x0000c490, 0xad3cadda, 0xdae4ddeb, 0x7aa37a8a, 0x0000d6f8, 0x0719073d, 0x64f05d5c, 0x5f3b5f3d, 0x00004a97,
+        0xac1aac9b, 0x58e838fc, 0x52dd5261, 0x0000f91a, 0x9ea59e33, 0x3aafd635, 0x3c1c3c35, 0x00004cad, 0xecf4ec13, 0x0b54b848, 0xaf32af27, 0x00008462,
+        0xc01bc0a8, 0xeb93e05e, 0xc1f0c1f7, 0x0000137d, 0x8e628e38, 0xd1e4a98a, 0xf6d9f6ed, 0x0000df7d, 0x2ef42ec4, 0x653fd8a5, 0x2a1b2a1d, 0x0000c98d,
+        0x9ebf9e98, 0x1455fd40, 0xf0e9f064, 0x0000ec92, 0xe539e550, 0xca86904f, 0x53bc53c5, 0x00008028, 0x171517b8, 0x0f84e213, 0x51f051f8, 0x00005b1d,
+        0x76de7689, 0xd704e5bb, 0x10191063, 0x0000bc7a, 0xfce5fcf8, 0x9191366f, 0x934393ba, 0x0000e337, 0x4c854c87, 0x28e0cb51, 0x65806500, 0x000014c3,
+        0xb58fb55c, 0xbe4af9b8, 0x7696766e, 0x00002311, 0x903890db, 0xaeecb7d7, 0x2ad82a6f, 0x00000ef8, 0x20d6201c, 0x13ee468c, 0x559655d8, 0x0000413f,
+        0x830f83f7, 0xa8d0f5d4, 0x1ffe1fd7, 0x00005ac7, 0xd415d445, 0x095cb459, 0x5352538b, 0x0000b52c, 0x090a091a, 0xab8e2b8e, 0x607f60b6, 0x0000d1bb,
+        0xd20fd214, 0x2bc243bc, 0xb977b923, 0x00008e72, 0xff98ffbc, 0xcbed5f12, 0xd977d93f, 0x0000fb01, 0xecd3ecde, 0x17da5a3d, 0xa23fa256, 0x0000bd2f,
+        0x273727d9, 0x068497fa, 0x321832e7, 0x0000a2c6, 0x5ccb5c4a, 0x8ce0e52a, 0x9a529abb, 0x0000d10b, 0x5986590f, 0xd23892c7, 0xc590c5a8, 0x00005e10,
+        0x28f2282e, 0x558c7599, 0x906e9018, 0x000046ef, 0xbad3bae7, 0x6d9318ec, 0xa120a158, 0x00006e22, 0x9ec09e40, 0x78da6cc0, 0xa772a737, 0x00008dcd,
+        0x5e045ebe, 0xad3255fc, 0x199f19c0, 0x00001788, 0x093e09f1, 0x049b315f, 0x3426349d, 0x0000f162, 0xb8eeb8bb, 0xda660823, 0xf72ef782, 0x0000061c,
+        0x298a2935, 0x07156f48, 0x225322b3, 0x00004410, 0x36a6362d, 0xd34fbef8, 0xe498e479, 0x0000c3d3, 0x113611cb, 0x68c3f1ab, 0xe9d6e96e, 0x0000e52c,
+        0x620a6264, 0x7801201e, 0x78697852, 0x00005646, 0x532853f5, 0xd9047251, 0x228c2284, 0x00001592, 0x420d42b6, 0xafe43c49, 0x91ff9103, 0x00006cfb,
+        0x51a75169, 0xf6c2c596, 0x6318639b, 0x00000200, 0xe1c5e15d, 0x2a635e6f, 0xcf59cffc, 0x00000e5d, 0xbfc6bfef, 0xa6a67efa, 0xc3fbc3a7, 0x000039b3,
+        0x49a0494d, 0xf1f9a2b8, 0xfaa9fa3b, 0x0000df74, 0xbdf8bdb1, 0x2f4122a2, 0x22562281, 0x00005ce9, 0x08e9089a, 0x9923d4f5, 0x6e026e5b, 0x00002cea,
+        0x462246b3, 0x88f82f47, 0xda0bda6a, 0x0000748f, 0x807b80c6, 0x9fe6d26a, 0x16641632, 0x00005854, 0x5cdd5ca4, 0x670c4ce9, 0xf471f4f6, 0x0000e345,
+        0x1f771fa2, 0xd1809e63, 0xe310e39a, 0x000084ff, 0xb9cab93e, 0xe6e132df, 0x01a30148, 0x0000d687, 0xc13fc1e0, 0x38c3b696, 0xe4bce49b, 0x000013a4,
+        0xb44fb449, 0xf07398aa, 0x0aaf0af1, 0x0000881f, 0x3e203e78, 0x8ff78c5c, 0xe14ee159, 0x00008871, 0x63a263a2, 0xa4015132, 0x374c371b, 0x0000d6da,
+        0x2ca82c64, 0x3bafa5aa, 0x3c523c12, 0x0000cecf, 0xc54dc52a, 0x346dd549, 0xed11ed93, 0x00005909, 0x755f759d, 0x85133bce, 0x6b7a6bdd, 0x0000df03,
+        0x6a386a14, 0x0834eca5, 0x727772cb, 0x0000368c, 0x02e4027c, 0x126b1cec, 0xe843e8f7, 0x0000d30a, 0xf1bcf1ca, 0x897946fb, 0x416941d8, 0x0000d49a,
+        0x58e758d8, 0x635acbae, 0x5c125ca1, 0x0000773c, 0xb684b67f, 0x0b54c628, 0x2786278c, 0x0000e3ca, 0xb286b28b, 0x144136e0, 0xb723b759, 0x0000c112,
+        0xf285f23d, 0xa87b5a09, 0xf1e7f176, 0x00009c46, 0x42b44202, 0x4d368d06, 0x5456543f, 0x0000f1e0, 0xf9f3f92f, 0x6182964f, 0x20872039, 0x0000c132,
+        0x3c233c8f, 0xe853ab02, 0x88e4888f, 0x00005bb0, 0xee1cee10, 0x27e2288e, 0x8e4f8e16, 0x00008faa, 0x26db26e2, 0x21f360d5, 0x70d27067, 0x0000a9d9,
+        0x28be2863, 0xa4b42162, 0xf54df510, 0x000018ad, 0x932593e6, 0x9a714041, 0xf37df3c2, 0x0000c8b2, 0x2d172dcc, 0x6050c8d8, 0xd878d8bb, 0x0000a46f,
+        0xdd07dd16, 0xee0fce51, 0x12b11253, 0x0000c3ed, 0xc6e4c601, 0x44baafd9, 0x4a214afd, 0x00003c69, 0xbc17bcd4, 0xa25159a2, 0x971b977b, 0x0000145e,
+        0x7c9e7c78, 0xd03b16ab, 0xd116d1e2, 0x00000362, 0xfaaefa42, 0x5e68cd1a, 0xed79ed83, 0x00005227, 0x73cc73a6, 0x09cbe155, 0x01a20168, 0x0000a018,
+        0x146d149e, 0x96ca7718, 0x5cb05c54, 0x0000260a, 0x36dc363f, 0x7fa29894, 0xb6e6b6a5, 0x0000cdf5, 0x0858083a, 0xa0bea298, 0xab6dabb0, 0x00001607,
+        0x941494d4, 0x50e743fd, 0xa7d7a77c, 0x0000b376, 0x9f849f5c, 0xf00b1349, 0xa2e3a2a0, 0x00004071, 0xe1cce1f8, 0xd0de06c2, 0x80be80bc, 0x000063a9,
+        0x92ee92c9, 0x240f5e6c, 0x8ab28a02, 0x00005477, 0x092e09e8, 0xce3d0ed9, 0xa71ba785, 0x0000f052, 0x4d9f4d81, 0xad238271, 0xf030f0db, 0x0000d4f8,
+        0x3e1c3ecf, 0x0725e3ec, 0xaf34af61, 0x0000a2b4, 0x49e849a6, 0xb139df24, 0xebbbebbc, 0x000042b0, 0x22b52279, 0xd76a315d, 0xd832d8c5, 0x0000acb9,
+        0x77a3771e, 0x0f5aa3db, 0x1d1f1d8d, 0x000054e8, 0x3a3f3a42, 0xd15ecd2d, 0xfd70fd57, 0x000015cb, 0xb9eeb987, 0xb4610cd9, 0x61896113, 0x00002b3e,
+        0xa728a7e0, 0xdbd19745, 0xb5e1b5c8, 0x0000686a, 0xb46cb475, 0xe9213411, 0xba43ba2e, 0x000030cf, 0x27f6270c, 0x6af444c5, 0x32423251, 0x00008dd0,
+        0x5975593c, 0xf7e970af, 0xf9a5f912, 0x0000dd57, 0x815581f6, 0x3a3c4283, 0x996e99b7, 0x0000c05e, 0x8f4c8f50, 0x03871dde, 0xb069b0af, 0x00006beb,
+        0xd0d6d05f, 0xdd5fb3a5, 0x09c409b0, 0x00009bc8, 0x028e02ca, 0xccf54daf, 0x0331036f, 0x0000e103, 0x453a4561, 0xd62eeafd, 0x24be24bc, 0x0000a5b4,
+        0xde97de19, 0xf229eef1, 0x26632657, 0x0000fd5c, 0xd475d428, 0x1ff337ff, 0x82618220, 0x00008a18, 0xedeeed4a, 0xd5ca153f, 0x9fd19fd8, 0x0000eb99,
+        0x590d5956, 0x66039344, 0x44a544d1, 0x00004611, 0xfd16fd89, 0x4d176470, 0x86628658, 0x00000763, 0xa0b6a003, 0x79cd9d39, 0x17a21793, 0x0000dad8,
+        0x61156121, 0xe0f1d8db, 0x5ea95e15, 0x0000290b, 0x20b32039, 0x9efa232b, 0x2da52d4e, 0x0000df59, 0x0dd70d66, 0x20928fe0, 0x4ff84fab, 0x00004290,
+        0x0a2e0a24, 0x805942b9, 0x088a089b, 0x0000dcc4, 0x248424b0, 0x90f1442e, 0x256c254f, 0x000063a9, 0xb0d7b0d8, 0x0db551e3, 0x5f3b5f81, 0x000093e0,
+        0x3b623b6c, 0x75af74a8, 0x5b065b94, 0x0000c227, 0x873e876e, 0x2f8a39ff, 0x818281b8, 0x0000dbb7, 0x470b4767, 0x7dc062bb, 0x59b959a0, 0x0000e00d,
+        0x7b3e7ba1, 0x6e9ffa17, 0x12b012b1, 0x0000b6a8, 0xca1eca65, 0x61912326, 0x3b6b3bc0, 0x0000f41d, 0x77cd77c4, 0xf604a7aa, 0x37ee37ac, 0x0000829d,
+        0x7f537f32, 0xeaa3458f, 0xfc20fc6c, 0x00006996, 0xf2d5f20e, 0xe77ddce8, 0x4e6e4ea6, 0x0000cd53, 0x3d663d60, 0x5baed3da, 0x56915654, 0x00001188,
+        0x80278067, 0x1e77f0ab, 0xebafeba4, 0x00009f47, 0xfbc3fb63, 0xba5b0ba6, 0xf1f8f1a8, 0x0000a4dc, 0xdc09dc5c, 0x71961cd8, 0x695869a6, 0x00007b51,
+        0xd10ad1d1, 0xbd6ccfd7, 0xce24ce88, 0x000011f7, 0x6d1b6d71, 0x91dc0b91, 0xca9cca31, 0x00000272, 0xe62fe6dd, 0xa2028df5, 0xe460e470, 0x0000e7c2,
+        0x6554658b, 0xdb54e50c, 0x421e429c, 0x000041f8, 0x79d379c6, 0xcf4a506c, 0x799979a2, 0x0000385f, 0xb1f6b1ab, 0x805f0d67, 0xa64da65b, 0x0000cb8d,
+        0x4e904efe, 0x8a79cf38, 0x725e72fa, 0x0000574a, 0xb2d9b248, 0x8fc632c0, 0x5313537f, 0x00009197, 0x9baf9b1f, 0x6950923a, 0x044504fb, 0x0000d6eb,
+        0xce0fcec6, 0xc52b6403, 0x17331724, 0x0000273e, 0x6698662e, 0xa981ad43, 0xf4f0f470, 0x00002d80, 0xa0c5a019, 0x40c51786, 0xfe1afedc, 0x0000dbeb,
+        0x568e5646, 0x1921a83f, 0x31f831a2, 0x00007b71, 0x795479d3, 0x95816cf7, 0xaaa4aa9c, 0x000033a0, 0x46464642, 0x09259969, 0xb0c8b0f9, 0x0000b301,
+        0x853c8500, 0xef531886, 0x9db99dda, 0x0000f26b, 0x5f445fae, 0x78bad902, 0xc00bc0a8, 0x0000ee75, 0x4df64d8d, 0x3153b691, 0x3f4c3fd6, 0x0000a045,
+        0x270a2796, 0x697e5ba2, 0xd3f1d3a0, 0x00008bdb, 0xc846c828, 0x86d5f2ea, 0x6752675d, 0x00003439, 0xa34da349, 0xd9547cf1, 0x29cd2935, 0x000036c7,
+        0x7fef7f1c, 0x143df0ad, 0xb726b7c3, 0x0000e9be, 0xcb03cb69, 0xe37fb0d8, 0x2964298c, 0x0000bacc, 0x7110718f, 0xa29f7c78, 0x19c21925, 0x0000398c,
+        0xf0d0f0ce, 0xab10c8d7, 0x6c1e6cb4, 0x0000299c, 0xc083c074, 0xc17c62d5, 0xfb07fb29, 0x00003483, 0xbf03bf6a, 0xb0ce6ae3, 0x2b622b04, 0x00009cc8,
+        0xfc3afc6d, 0xf75714c7, 0xcd43cd0e, 0x00006dbd, 0xa4dea4f1, 0xe95b55b2, 0xf539f5e1, 0x0000905d, 0xec3aec8b, 0xcd7a1a7d, 0x8aa48a40, 0x0000f4a1,
+        0xe702e7f0, 0x3d29167d, 0xc660c61e, 0x00009397, 0x3c873c4f, 0x5a89df68, 0x5c155c2b, 0x000012a2, 0xfee7fea5, 0x12fd3754, 0xef92ef82, 0x00001d68,
+        0x940e9448, 0x8b84c9ad, 0x29ea2910, 0x0000ccc6, 0x7f157ffe, 0x24edaf15, 0x7e777e95, 0x00007481, 0x58bb5812, 0x6dc23ebf, 0x209e2095, 0x00008c72,
+        0xab5fab13, 0x36386f6b, 0xd8f3d850, 0x00007d50, 0x4947493f, 0x23010076, 0x5c575c15, 0x0000a76f, 0x5fcd5f0d, 0xb7dc8e88, 0x23e323ba, 0x00001116,
+        0xa5dfa5fa, 0xa801b7e9, 0xecf6ecfc, 0x00002f3a, 0x63d76376, 0x376fed81, 0x68686836, 0x0000d466, 0xe0b8e05d, 0xafde520c, 0xe10fe125, 0x0000d7da,
+        0xb97db9bd, 0x29c1526f, 0x57a7573e, 0x000034ab, 0xe921e9cf, 0xe37cebfe, 0x14a51455, 0x0000c5a1, 0x3c013cd9, 0x5b0a26d4, 0x688b688a, 0x0000e889,
+        0x368936d3, 0x9957fae4, 0x656665e3, 0x0000fac4, 0xbc3bbc09, 0xcf270234, 0x30763076, 0x00001323, 0x9fcc9f8f, 0x95d41d21, 0x876787de, 0x00005f76,
+        0x2123217c, 0xca6d68fa, 0xfe90fe08, 0x0000c111, 0x04440415, 0x30ceef80, 0xd327d303, 0x00003f6e, 0x9ca19c22, 0x396f6f48, 0x7051704e, 0x000065f0,
+        0x663a66a6, 0xf3ce31ff, 0xcbe3cbd3, 0x000086a2, 0xbf6cbf5f, 0xb4dcf1ec, 0x9bfd9b0c, 0x000048d1, 0x50785086, 0x2ca01ce1, 0x041b0470, 0x00002487,
+        0xca79caad, 0xa6d554b1, 0xc010c0bb, 0x0000d888, 0x56e656c3, 0x28b63f70, 0x81578162, 0x0000e9a5, 0x42d8428c, 0xbc4b3f30, 0x9955994b, 0x00000362,
+        0x28042839, 0x095aebdd, 0x55745574, 0x00008602, 0x5c965ca9, 0x8a7894c7, 0x66426633, 0x00003eb3, 0xf654f6f2, 0xf828d092, 0x05f70511, 0x00007861,
+        0xe83ee81c, 0x6f64ed8c, 0x4e174e9e, 0x0000893f, 0x5ce25c5f, 0xd9c411d1, 0xdfd8df37, 0x00001017, 0x0f360f56, 0xa20f205e, 0xfb61fbff, 0x0000dd46,
+        0x293d2955, 0x8fa74ae4, 0x2ffe2f5f, 0x00003f11, 0xd040d07e, 0x90dc257a, 0x7fc87f6c, 0x0000ee37, 0x5536555e, 0xab140a27, 0x69c069c3, 0x00008142,
+        0xf26af27f, 0x12f9e75d, 0x0fd60f9c, 0x00006940, 0xfe94feb3, 0xcb2a10bc, 0xf2b5f2db, 0x000091d5, 0x100e10dd, 0x52904e0a, 0x5d2a5de8, 0x0000f55c,
+        0x62016246, 0x8c9898af, 0xc443c43d, 0x00008e2b, 0x0aca0aed, 0x3327c4ba, 0x24782438, 0x00005fe8, 0xb907b973, 0x766d91f9, 0x9441941d, 0x000042bd,
+        0xf549f581, 0x0ae308fc, 0xaeb2ae2a, 0x00009e47, 0xe687e6f8, 0x9cbca70c, 0x236c2345, 0x00007151, 0xda34dab9, 0xf7965d95, 0xf8e0f89c, 0x0000c8f0,
+        0xfc1cfced, 0x1e057bc0, 0x09170911, 0x0000af07, 0xf079f021, 0xc40b01b4, 0x59ee5918, 0x00005884, 0x1f3e1f7b, 0x27c18992, 0x93b593cf, 0x00001cf5,
+        0x6d9e6d6a, 0x2c366624, 0x7607765a, 0x00001dc9, 0x8bd78bdd, 0xc2e85c19, 0xd360d358, 0x00003a13, 0x51a3517f, 0x42462dbf, 0xd4dbd422, 0x00007f70,
+        0x2c8b2c83, 0x9bc7ff79, 0x09aa09f9, 0x0000c9aa, 0x865286fc, 0x15bade59, 0xb7b5b772, 0x00003eb3, 0x4fdb4fa8, 0xff9b8500, 0xca4fca81, 0x00001844,
+        0x722f7248, 0x1d41a1db, 0xafc4af75, 0x00008d71, 0xef4bef04, 0x8da547b2, 0x0e520e0a, 0x00003e8c, 0x3f403fea, 0x9bde3bd1, 0x3fde3fd4, 0x0000a0c6,
+        0xa44ea4cc, 0x314d7c08, 0x219f2181, 0x0000ea16, 0x16111631, 0x4446b4d6, 0x477a4732, 0x0000c7b2, 0x0bb20b2d, 0xdc04b4e7, 0xde5cde1c, 0x00006aca,
+        0xc7dfc72e, 0x603efbb3, 0x20b320c3, 0x0000b704, 0x0e390e13, 0xc1d60ca3, 0x08c708bb, 0x00003a61, 0xc61ec6f6, 0x964a88a0, 0x78d3786a, 0x00003c8d,
+        0x31583113, 0xa0be5a9e, 0xed6cedcc, 0x00006685, 0x496d49b3, 0x2fc1a26b, 0x02870211, 0x00005d18, 0x6b886b62, 0x1acbf2e8, 0xb977b969, 0x0000cbf5,
+        0x98da98e8, 0x3c8a2ce4, 0x02290243, 0x0000885f, 0xffe0ffa7, 0x93736508, 0x69666930, 0x0000e86f, 0x94399438, 0x8f4762ac, 0x4936498a, 0x0000d75b,
+        0xca24cada, 0x6dfd1bec, 0xab07ab70, 0x00007afe, 0xa3e5a335, 0xb501fa9d, 0xca3bca3c, 0x0000488f, 0x99af9963, 0xcefb28b1, 0x734b735e, 0x00004b96,
+        0xd420d438, 0x42c61686, 0x61766135, 0x0000180d, 0xdd1ddd61, 0xfa1724d2, 0xef47ef09, 0x0000fdbd, 0x5cd75c5e, 0x6f60d3d2, 0xe80ae87f, 0x0000c5f2,
+        0x32c232f0, 0xc99a5eed, 0x3d1f3d11, 0x00009447, 0xc8f9c864, 0x2166b988, 0x145714f4, 0x0000b77d, 0xcbdccb28, 0x9cd93dcf, 0xf034f068, 0x0000c881,
+        0x495d49ee, 0xe79d2c14, 0xd593d59d, 0x0000660e, 0x78397828, 0x9a939d55, 0x33a133d8, 0x000058fd, 0xb2d9b2f0, 0x6150e523, 0x1da71d3d, 0x00001d93,
+        0x69756937, 0xc0a8b2f0, 0x199819c9, 0x0000bcbf, 0xe8eae823, 0xe4622a47, 0xc077c031, 0x00001517, 0x4c5d4cec, 0xab1134ff, 0x9bc19b33, 0x0000cc5e,
+        0x67d36764, 0x7dd72508, 0xe16ae104, 0x00001617, 0x3d3a3dbe, 0xb76347e6, 0xb14cb1bd, 0x00004aea, 0xe652e620, 0x904ff598, 0x100b108d, 0x0000512c,
+        0x532753db, 0xdeda5fec, 0xb19fb1e2, 0x000052e8, 0x2c222cd5, 0x2eced8df, 0xe817e832, 0x00001f14, 0x07e10738, 0x2a16982a, 0x1df71de9, 0x000049dc,
+        0x42fc4243, 0xcdfbf38f, 0x462d4645, 0x0000adc9, 0x74e874b7, 0x0026e4e3, 0xc20bc273, 0x0000a2b5, 0x45ed452b, 0x62d09081, 0x84a18401, 0x0000c01c,
+        0xbd58bda4, 0x36cfab75, 0x82618266, 0x00001d3d, 0x52a4525f, 0x655065e4, 0x44d74476, 0x00006436, 0x424a428a, 0x3db768b0, 0x169a1695, 0x00007db0,
+        0xac27ac15, 0x62309c61, 0xfd2afd61, 0x0000fb5c, 0xaadfaa4a, 0x5c1d6ba2, 0x24652485, 0x0000e89b, 0x9c309cea, 0xfb11e94f, 0x49cb496c, 0x00009ec8,
+        0x6546656b, 0x62b259c2, 0xdf7bdf98, 0x0000b7f3, 0xd1d7d1bc, 0x11a55eb1, 0x569e5644, 0x00006000, 0xe4b9e4ce, 0x1123fe0e, 0xc16bc139, 0x000062d9,
+        0xe6b4e6da, 0x0b240274, 0x2f1c2fb2, 0x00008660, 0xcda6cdbb, 0xe1a397c7, 0xc0c2c02a, 0x0000ec16, 0x5fed5f7a, 0x5f68fefa, 0xd329d3ff, 0x0000555b,
+        0x353635aa, 0xb50319a8, 0x5c065c53, 0x00001eab, 0x642b64c2, 0xa8a46aca, 0x30703046, 0x0000a237, 0x9a589aeb, 0x5307b554, 0x2f3b2f7d, 0x0000540a,
+        0x90589059, 0x7d2b34ee, 0x9b769b2f, 0x00000ced, 0xad7dad35, 0x16cd2d8d, 0xc0f7c0b0, 0x0000858d, 0xcdc3cd35, 0x3e942aff, 0x9eb59e6c, 0x00004fcd,
+        0x71547130, 0xae14922d, 0xb9d7b92c, 0x0000b6a8, 0x94aa946a, 0x9172d9a5, 0xb655b65c, 0x0000c2a0, 0x12b0121c, 0x289ca1a2, 0xbb84bbd3, 0x0000d918,
+        0x07d407d2, 0x155567e5, 0x32943296, 0x0000880e, 0x5e345eb7, 0xfedeebf1, 0x5dff5d14, 0x00000f5d, 0x50cb50a1, 0xb6c0d4cb, 0x8f268fee, 0x00006730,
+        0xd28fd2d5, 0x56a76f45, 0x8d618d09, 0x0000d89d, 0xab76ab97, 0x8daacf51, 0xbe6bbe73, 0x0000d8fe, 0x48ca482d, 0x1bde06d0, 0xab57ab68, 0x000084a3,
+        0x12c4121e, 0x3ac16bca, 0xd731d7c5, 0x00001531, 0x0ccd0cfb, 0x15557e34, 0x534553ae, 0x0000a628, 0x4ce04ca6, 0xe5f205c8, 0x5bb75bac, 0x0000bdec,
+        0x23bf23e6, 0xbecdf32a, 0xa0ada052, 0x000095ea, 0xf0ddf0fd, 0xc20b03f9, 0x15361579, 0x0000f6bd, 0x5ec05eec, 0x3e1cb23f, 0x9b759b3d, 0x000042cc,
+        0x9401943d, 0x14f9061b, 0xdff0dfe0, 0x000018ac, 0x81d58181, 0xcdb390be, 0x8e248e73, 0x00001ccb, 0x071a0731, 0xe1ffc043, 0x24f02452, 0x0000f26b,
+        0xdc95dc9f, 0x62ecb440, 0x70b57073, 0x0000a985, 0xbdf8bd14, 0x89c766da, 0x78a87843, 0x0000bcba, 0xd5d4d576, 0xaa518081, 0x03c303da, 0x00000632,
+        0x7f517f36, 0x09e0a066, 0xb384b3a6, 0x00004030, 0x665866dc, 0x6485da34, 0x7e247e05, 0x00009c47, 0x8d298dac, 0x19dea6ef, 0x78a0781a, 0x00003f4c,
+        0x3f843fa6, 0x9fc786ce, 0x18901819, 0x00000ef8, 0x6f236f64, 0xb813a887, 0xad48ad54, 0x000060d0, 0x44384403, 0xeae351b1, 0xdb84dbcc, 0x00002c58,
+        0xb73cb740, 0x709b0955, 0x974d978a, 0x0000f02d, 0x5087507b, 0xd3db813d, 0x0d360dc6, 0x00009001, 0x945e9487, 0x0714c274, 0xa54ba5c3, 0x0000e2f0,
+        0xc4b2c4fb, 0xe085e3e2, 0xc0b7c001, 0x00005cb5, 0xd8dad826, 0xfb03b8b2, 0xd05dd015, 0x000052e4, 0x4b6c4bd0, 0x6c60252a, 0x577a5707, 0x00004d00,
+        0x9ce79ce0, 0x98a60430, 0x87888738, 0x0000fda1, 0x090c09bb, 0x45051ea7, 0x2bca2b69, 0x00005d74, 0x1eed1ec3, 0x291f88dd, 0x7c857c91, 0x000001ed,
+        0x592659d7, 0x5e6f7452, 0xa654a6f6, 0x00009044, 0xb836b8b0, 0x1c82f2d4, 0x621562ae, 0x0000f0d3, 0x887b8863, 0xcd27e2ef, 0x91c19178, 0x000062d0,
+        0x4d9e4d82, 0xde54b026, 0x816b81cf, 0x0000d657, 0x020e02a5, 0x1e09d488, 0x1fb71f54, 0x00006fb7, 0xe43ce42c, 0xf3fd2337, 0x0cc80cc3, 0x00004b6e,
+        0xc24fc21b, 0x1cc803f7, 0x72647221, 0x0000638b, 0x7b547b0a, 0x4e0b1289, 0x232f2370, 0x00004f40, 0x0318033a, 0xdc0c7e01, 0x707170c2, 0x00009d91,
+        0x3c033c46, 0xf79b2236, 0x76c376d1, 0x00001436, 0xcb52cb11, 0x060d0ea1, 0x4c0a4c85, 0x0000a5c8, 0x0e290ec8, 0x189dca65, 0x8c1f8c88, 0x000093b9,
+        0xd4b8d405, 0xaaaf525c, 0x261e2657, 0x00000c72, 0x3e373ebd, 0xb73f8081, 0x4c754c9a, 0x0000c360, 0x221e223e, 0x8408e55d, 0xa418a481, 0x00008e85,
+        0x88dd88b0, 0x559df84c, 0xaf9daf3f, 0x000011e3, 0xdcc4dca5, 0x3acd7c70, 0x1a2f1ad2, 0x0000d076, 0x3b293b63, 0x58aaf663, 0x1c1e1c12, 0x0000d8b6,
+        0x0f590fe5, 0xc37cfd47, 0xd7b4d7d5, 0x00009bae, 0xeccbec8a, 0xa6420867, 0xf5fdf5e7, 0x0000a6d7, 0x14f31413, 0xa301a653, 0x9aac9aa8, 0x00005e11,
+        0xf55ef5ad, 0x1060e6d4, 0x634563a3, 0x000099c0, 0xd500d5de, 0xa0a09ed7, 0x78e8780f, 0x0000077e, 0xffa1ff66, 0x74756bb4, 0xca08ca62, 0x0000531b,
+        0x303d3051, 0x3faf416f, 0x47b84795, 0x00003bf8, 0xfd29fdb2, 0x291f580b, 0x4623463a, 0x000000bf, 0xc220c285, 0x6232ddeb, 0xe2f5e2f8, 0x00009ea7,
+        0x23022385, 0xfb6eba87, 0x942f94b3, 0x00000f03, 0x519551f5, 0x9218fcc5, 0x7e597ebe, 0x0000ac55, 0x3099305d, 0xa8718fde, 0x5501554a, 0x00001717,
+        0xff62ff61, 0x0d683b71, 0x941a9450, 0x00002b74, 0x2791271a, 0xa801fbf9, 0x384d384d, 0x0000bc79, 0x3de73daa, 0x1c8a92c4, 0x31ab31ed, 0x0000ebc8,
+        0x58e2582f, 0x6ca19db0, 0x743474a3, 0x0000e74d, 0x53275347, 0x7e1cd688, 0x2e862e18, 0x00005768, 0x220622d0, 0x546819cd, 0x6a9d6a72, 0x0000e5ac,
+        0x712071b1, 0x39c356cd, 0x057b0580, 0x000073d9, 0x7c3c7cd3, 0xc694da5b, 0x221222c1, 0x00004db0, 0xe3bde3f8, 0x069bf64c, 0x4ecc4ec3, 0x000061e0,
+        0xbcafbc98, 0xcc05c8d8, 0x465a4698, 0x00000963, 0xb8edb8d1, 0x4646ee42, 0xa0c2a054, 0x00000c83, 0xefd0ef90, 0xdbef0d5b, 0x16891627, 0x00007c81,
+        0xbb62bb67, 0x365bd90d, 0xd366d368, 0x0000f22e, 0x33f033b9, 0x6415c0c3, 0xe282e2de, 0x000052ca, 0x51f351dd, 0x93ec113d, 0x36163643, 0x000094e1,
+        0xe115e121, 0xd220d6ca, 0x683f68f3, 0x00007281, 0x7c537cd9, 0x60a03fb2, 0x064006e6, 0x00005e6e, 0x30e6303f, 0xc0f59d06, 0xbac7baa9, 0x00002b45,
+        0x586c58a2, 0xb7a71953, 0x3edc3ecd, 0x0000e489, 0x6d8c6d95, 0xe6c08072, 0xe5b0e5d7, 0x0000039e, 0x3cc43caf, 0x6d9f0855, 0x36143644, 0x00006de1,
+        0x8848887d, 0x72da1c67, 0x9cb39c48, 0x0000721f, 0x549a54f5, 0x3e9a4ec3, 0xe000e0da, 0x0000f3ce, 0x8dc58dec, 0xf1188370, 0x1f671fe1, 0x0000af38,
+        0x88c6889b, 0x16a5ee6e, 0xdbcedb6e, 0x0000e00d, 0x592259c4, 0x5039c6ae, 0x0b6a0b42, 0x0000cbed, 0xca93ca22, 0x74a8b9c9, 0xb45ab4c9, 0x0000be10,
+        0x899b898a, 0x8587b928, 0x2cd62c71, 0x0000597f, 0x339b3353, 0xf9d9dde8, 0xb0c2b028, 0x00000d99, 0x37ca373d, 0x0182b77a, 0xf228f26c, 0x00007261,
+        0x1d4e1d67, 0x1f4c2db0, 0x8b2d8b1d, 0x0000086a, 0xa9b9a975, 0xce34e041, 0xa4b3a40b, 0x00000563, 0x6b256bd2, 0xb053b0a5, 0x101310cc, 0x00002542,
+        0x082d0892, 0x59303cff, 0x6b126b93, 0x000041e4, 0x8af18a74, 0x784aefbd, 0xbac6ba8b, 0x00008def, 0x6a1f6a97, 0xd04d54cd, 0x512751c7, 0x00001fd3,
+        0x685c6829, 0x82e99328, 0x9e719e64, 0x00005b9f, 0x4c1f4c8b, 0x48c97eb9, 0xde1fded3, 0x0000dd28, 0x018401ce, 0xf00bccc6, 0xf648f62e, 0x0000a410,
+        0x916891bc, 0xbf033be0, 0x85a385dc, 0x00009438, 0x67ae674a, 0x0155a15e, 0x225022c8, 0x00006d82, 0xd956d967, 0xedd0093b, 0xa125a15c, 0x00007b30,
+        0xeb04ebb3, 0x954c6322, 0x4c0c4c87, 0x0000a808, 0x4cab4ceb, 0x8128028a, 0x8dc28dc7, 0x0000e894, 0x6d306dd6, 0x974698b5, 0x49e449a1, 0x0000676f,
+        0x4bf24b73, 0xd2ab834e, 0xc9a5c9f6, 0x00000d5f, 0x16d2165c, 0x3f9a3c36, 0xb36db3a3, 0x0000e9e2, 0xbdc5bd1a, 0x90233b3f, 0xc0aac067, 0x0000eed7,
+        0x91a691ff, 0xdb2eb696, 0x229722d0, 0x000041f0, 0x24f224b6, 0xfcaa2db3, 0x36b8369d, 0x0000e85a, 0x67726788, 0xcbb06cf7, 0xba9bbacc, 0x0000ed46,
+        0x16af166d, 0x3210cf2e, 0xffadff5d, 0x0000f2a0, 0x6fb96f63, 0xcf454837, 0xc667c697, 0x00002a04, 0xfe0afe12, 0x2b92c59e, 0x133e13b6, 0x00000d62,
+        0x5af25a73, 0x78cd7752, 0x24ee24bf, 0x00000e36, 0x48ab484b, 0xe085b147, 0xf802f80c, 0x000033a0, 0xc8a7c850, 0x58af35d0, 0x3834388e, 0x0000b3d0,
+        0xbaa9ba96, 0xd8514f29, 0xf7a0f795, 0x00007622, 0x2bfb2b53, 0xf7dc2df9, 0xf7caf7c9, 0x0000befe, 0x2cde2c52, 0x16343871, 0xa355a3f3, 0x0000f4d2,
+        0xf78df7c5, 0x1267d0e8, 0xe5e7e57c, 0x000025b7, 0xb97bb9d4, 0xa260ba7f, 0x767a76a6, 0x00001a00, 0xf7c9f728, 0xe5437bbf, 0xec90ecc0, 0x00003444,
+        0x8b928b65, 0x1647b4d5, 0x9b459ba6, 0x000002df, 0x2b2f2b16, 0x8bf8d2eb, 0xa623a629, 0x0000c54c, 0x66216687, 0xf1de4135, 0x75557509, 0x0000ee37,
+        0x3df03d13, 0x52520b1e, 0x794f79e6, 0x0000279a, 0x89f289b9, 0x1b6afae7, 0x29a129f0, 0x0000855f, 0x28582898, 0x2eb6ced0, 0x89fe895d, 0x0000d59a,
+        0x30ab3002, 0xd3db8d9e, 0xeb96eb3f, 0x0000d977, 0xf1eef177, 0x328d59fd, 0xd867d82d, 0x0000f4d8, 0xf7fff79b, 0x60b2732c, 0xbce6bcd5, 0x0000d49b,
+        0xefd8ef2e, 0x60e46179, 0x52835297, 0x00008bbf, 0x63a563db, 0x70ea65e5, 0x684c68fa, 0x0000d562, 0xfe59fe1a, 0x5e05fc43, 0xadd6adbe, 0x0000faba,
+        0x4c324c98, 0x5340074b, 0xc56ac517, 0x00009699, 0x117711d0, 0x05a4b439, 0xda17da3e, 0x0000081c, 0xd8e0d890, 0x0bf59cea, 0xd702d71d, 0x0000c8c2,
+        0x4a464a0a, 0xa9015022, 0x7a097ac4, 0x00002f5b, 0x61b461e4, 0xb8e3c23d, 0x12b51273, 0x00005fe9, 0x20d120d0, 0x6bd43943, 0x8e5c8edf, 0x00009879,
+        0xacbfac6b, 0xcac46d1a, 0xa378a331, 0x0000ec62, 0x553c5503, 0x825eab0b, 0xa9b4a9d3, 0x000080af, 0xdff3dfe3, 0x24b94b72, 0x1735172d, 0x00009eb1,
+        0xe716e7b0, 0xaed1bbc3, 0x004a0013, 0x0000fdeb, 0xe04de033, 0x936ea7b5, 0x53de5370, 0x00006090, 0xb427b432, 0x5f6835bf, 0x100a10a1, 0x00002ea4,
+        0x1916193c, 0x753f8bac, 0x491949ca, 0x00004a6e, 0x0b330bc4, 0x9ea641c4, 0xb0c9b06e, 0x0000b6ad, 0x26b72625, 0x4d0be5c1, 0xa558a5e3, 0x000071ef,
+        0xe4f0e431, 0x3419f4dc, 0xe280e221, 0x0000f662, 0xaf04af28, 0x36ced705, 0x4522451c, 0x0000bd10, 0xfeb8fec8, 0x8a2f5765, 0x319f31d6, 0x000073bf,
+        0x3e623e3e, 0x07a4dfdb, 0xb27eb224, 0x0000bf6f, 0x16d516d6, 0x18e4c10c, 0x06a7061a, 0x00003bb9, 0x811081fc, 0xd9bf7c70, 0x8dc78d7c, 0x0000e2ad,
+        0x76e8768a, 0x039b1aa9, 0x19621960, 0x00006790, 0x0d0a0d45, 0xcebdf30a, 0x1465149d, 0x0000d70b, 0x87bb8794, 0x99887418, 0x49df4977, 0x0000ac08,
+        0xdf7adf70, 0x1378e6f4, 0x0f110fcb, 0x000015b6, 0x25af25a3, 0x8d67eafd, 0x42ab4207, 0x00000563, 0xa260a2c3, 0xd8266d3b, 0xb95ab9c7, 0x0000f373,
+        0x551a55c4, 0x62219508, 0x6d0c6d5a, 0x00006328, 0x6d316db4, 0x11ded1f5, 0x797379cd, 0x0000cfaf, 0xbc95bc19, 0x6c6210e3, 0xa964a953, 0x00007f4e,
+        0x609460d5, 0x8c790c59, 0xca38caee, 0x00009d0e, 0x754b75f9, 0x1c4ed824, 0xf1f8f154, 0x0000f6ec, 0x22e32258, 0xb5bd9483, 0xea40ea03, 0x0000e792,
+        0x26e426dd, 0x218763d3, 0x26ef26bb, 0x0000ece8, 0x02db028d, 0x72842cee, 0x80648086, 0x0000d50a, 0x579c57bc, 0x40f6a94b, 0x7ecf7ed2, 0x00001517,
+        0x3d1f3d98, 0x419800ca, 0xf165f1ac, 0x00005800, 0x365d3696, 0x791afc43, 0x3400344d, 0x0000b013, 0x901d9071, 0xbacdd736, 0xeb55eb48, 0x0000fde2,
+        0xa6d3a668, 0xc424cfa9, 0x98b6983b, 0x0000b941, 0x8d268d98, 0xcb7abb48, 0xa118a12f, 0x00004c08, 0x4c524c1f, 0x33c385f0, 0xe5c0e59c, 0x00000f0d,
+        0x423642cb, 0x36cfb5d8, 0xf67ff66d, 0x00004bcd, 0xfef0fe28, 0x41105533, 0xaeb2ae2f, 0x000087be, 0xde90de8d, 0x049a7dfc, 0xeb2deb7c, 0x00002274,
+        0xca72ca4b, 0x88259a81, 0xb166b12d, 0x000061f6, 0xfd2ffd4d, 0x8236a7fd, 0xbf04bf6d, 0x00002e9a, 0xd063d042, 0x8c637bbb, 0x50565028, 0x00000de6,
+        0x98609896, 0xe9799638, 0x394339b6, 0x0000f4db, 0x1d0b1db3, 0xa44384ec, 0x596a59bc, 0x0000e189, 0x4d6b4d1c, 0x2ca14fd4, 0x8019806b, 0x0000f216,
+        0xe605e65b, 0x6d22675a, 0x377637ed, 0x0000acd8, 0xc30cc37a, 0xc1966af9, 0x4d1b4dbe, 0x00000aa9, 0x92c2923f, 0xacee0434, 0x00e40084, 0x0000328c,
+        0x82fd8259, 0x8825dde8, 0x5f475f60, 0x0000e232, 0x56e5562f, 0x4b7f454f, 0xa987a95e, 0x0000201b, 0x9d299d3b, 0x75cd0853, 0xde4bdeb3, 0x00008267,
+        0xace8ac0d, 0x6415b2c9, 0x116e1194, 0x0000f3b3, 0xb287b282, 0xab81ac87, 0xb5cbb560, 0x0000273e, 0x7cf87ca0, 0xbd1bc567, 0x881988eb, 0x0000d915,
+        0x92229239, 0xe3621b2c, 0xeb56eb63, 0x00007860, 0x4339430d, 0xddf3d1c4, 0x48374824, 0x0000cd95, 0x7ff57fca, 0x797020d7, 0x3de13d57, 0x0000dae4,
+        0xbda1bd8c, 0xc4b73d33, 0x8710872d, 0x000099d1, 0xc817c87d, 0x69e301f9, 0x6f566f3e, 0x0000896d, 0x62926273, 0x8216775c, 0x7d0d7d59, 0x00008a9b,
+        0xd03cd0f3, 0x80a67f46, 0xeb8ceba3, 0x00002456, 0x3729373f, 0xfed10526, 0x5c435c50, 0x0000688b, 0x2d762d52, 0x5569e5de, 0xe0bae068, 0x0000de28,
+        0x16db161e, 0x2d42b56d, 0xf477f497, 0x00009e16, 0x70f67081, 0x0c3410bc, 0x29662981, 0x000027ea, 0x768876bd, 0xad53c347, 0xb213b27c, 0x00003040,
+        0x446b44f8, 0xc83ad06f, 0x69f069ed, 0x0000e97c, 0xbe82be0b, 0xb40c2054, 0x5ec35e08, 0x0000d911, 0xd6f0d6d4, 0xc97a12ff, 0xe80de809, 0x00008042,
+        0xcfe6cff4, 0x0dea2729, 0xaccdac62, 0x00008830, 0x2fe92fe7, 0xbe332f39, 0x295b2905, 0x00004c96, 0x628e628c, 0xda07af19, 0xc653c6e3, 0x00000b63,
+        0x4c564ce6, 0xb37ce12a, 0x41da4126, 0x0000e458, 0xd482d4c6, 0xd2db9507, 0x03bd0384, 0x00000362, 0xb987b9d1, 0x79ebc17a, 0x2f5c2f5f, 0x0000e9bb,
+        0x64e364db, 0x47a7ab3c, 0xdf8cdf65, 0x0000289b, 0x9ca09c12, 0x97d427d7, 0x747d740c, 0x00007dbb, 0xbc28bc6e, 0xe958b7a7, 0x3c063c85, 0x00001be3,
+        0x0a440a18, 0x68801488, 0x09530993, 0x0000da6b, 0xb6fdb6ab, 0xb2adf79a, 0x5f575f43, 0x0000488f, 0x97e297b3, 0x594eb254, 0x8c8e8c36, 0x0000febd,
+        0xdf2cdfbb, 0xd3ba4c56, 0x63f263ec, 0x00003003, 0x6f856f1f, 0x716e712d, 0xa394a3ab, 0x0000b5cd, 0x29b029fc, 0x2cd6e350, 0x22d2228b, 0x00005478,
+        0xb0bbb0eb, 0xe8b05a5c, 0x4e164ed7, 0x00003f4c, 0x88f88891, 0xda8be390, 0x617a6139, 0x00000ebc, 0x1ade1a1c, 0x36195ce6, 0x6770671d, 0x000094e0,
+        0xe53be573, 0x1b5d55ce, 0x60166083, 0x0000dc0b, 0x04e104ef, 0x25df7ac0, 0x89bf896d, 0x0000daf4, 0x9e0a9e85, 0x953b42b9, 0x093d0929, 0x0000c34d,
+        0x8ae68aeb, 0xdd808da1, 0x3f873fdc, 0x00008c1e, 0x70317013, 0x2b2100c8, 0x5156518e, 0x000027ea, 0x155d157f, 0x9b41fbb1, 0x934e93ee, 0x0000cf8d,
+        0x9820984d, 0x3347f156, 0x375837fa, 0x0000ec52, 0xc547c51d, 0x20876f37, 0xdd72dd8f, 0x00007a73, 0x77b777c1, 0xf175b203, 0x7f2f7f5f, 0x00006feb,
+        0x51e8510e, 0x158e9a4c, 0x0714071e, 0x00002da4, 0xa1d1a178, 0x3d29f863, 0x9678962d, 0x0000ca40, 0xd073d070, 0x8986b6e7, 0x648d64ab, 0x00009597,
+        0x71a77183, 0x1b8ff469, 0x20ab2073, 0x0000b2d7, 0x89d08993, 0x05150ca7, 0xbcd1bc94, 0x000050a7, 0x4f834f54, 0xbd3a4efa, 0x1cd01c82, 0x0000ec15,
+        0x8aae8ada, 0xb46627d5, 0x6d6a6d30, 0x000009cf, 0xa264a268, 0x423b246d, 0x3f603f4d, 0x0000cb95, 0xfe8cfed3, 0xc5359c11, 0x78577862, 0x000057b8,
+        0x35093583, 0xda94ff57, 0xb26fb2dd, 0x0000bb8e, 0xa751a796, 0x7b5599d5, 0xada9ad36, 0x0000df57, 0x2ed72ebc, 0x20d2a29f, 0xe925e9d5, 0x0000dc42,
+        0x4d844d1d, 0x89673a30, 0x1adb1a7c, 0x0000f6ce, 0x0b900b8e, 0x84f7b386, 0x12c01272, 0x00000272, 0x3c9c3ca4, 0xd0644c56, 0xcc62ccb7, 0x00004b6e,
+        0x42fa4200, 0xbcdb4861, 0xf819f800, 0x0000b2c1, 0xb894b821, 0x9f0638f1, 0x78587880, 0x00001c88, 0xb4d5b4c5, 0xffc3f947, 0x300930da, 0x0000c14c,
+        0x27db27f5, 0x089db147, 0x57d05760, 0x00005654, 0x925d92cf, 0x346f2cb2, 0x1110110b, 0x0000acb9, 0xb704b7a8, 0x0935a027, 0x28092881, 0x0000bbf1,
+        0xb52ab553, 0xdff39f13, 0xac09acb1, 0x0000f901, 0x099c091f, 0x78c8c13e, 0xb252b2d3, 0x0000a0c6, 0x2b2d2b58, 0x9cbce294, 0x260a26d7, 0x0000eabd,
+        0xece6ecea, 0xc765c78b, 0xec2deceb, 0x00000a54, 0xf1fff1a5, 0x6b40e2fd, 0x587f581b, 0x000005c2, 0xdcaedce7, 0xd7046e1a, 0x074a0776, 0x000001a0,
+        0x00a7001d, 0x5fd5554d, 0x4c144cc0, 0x00005d65, 0xbe3fbe0e, 0x8f6e239b, 0xdd77dd40, 0x00007b66, 0x784e78cc, 0x683c1853, 0x331d3377, 0x000004ed,
+        0xbcfcbca3, 0x33ab4e2f, 0xd184d1bd, 0x000060a6, 0x0cfd0c76, 0x647a5ba1, 0xbd9abd30, 0x00005059, 0xcb08cbc5, 0x706cbcca, 0x6f216ff5, 0x00008f1b,
+        0x997699c6, 0x87f86d57, 0xd3fbd3ba, 0x0000498d, 0xa3b6a379, 0xa5f19f58, 0x64ec64bc, 0x000092d5, 0xb4acb490, 0x4afacad0, 0x3f633ffa, 0x00003106,
+        0xced3ce9b, 0xd540f89d, 0x1f731f6c, 0x000071b0, 0xc369c38b, 0x7e6d4c2a, 0x3fa23fab, 0x0000f163, 0xacc9acbd, 0x060c6ea6, 0x246e2446, 0x0000410d,
+        0x747574f9, 0x1cc8e7df, 0xdaf3daa9, 0x0000139b, 0x01de01c8, 0xac0dffc5, 0x1a6a1a50, 0x0000a1b4, 0x7fb57fc7, 0xd854dc40, 0x3d163d8c, 0x000020af,
+        0xe316e323, 0x79e22e38, 0x07eb071c, 0x0000a718, 0xbd7dbd98, 0x406446fa, 0x453545fd, 0x000042b2, 0xd33cd3f8, 0xc335a9b5, 0xfc05fc00, 0x000037d4,
+        0x023b02b9, 0xf006b8c9, 0x13e513e3, 0x0000a30c, 0x67d267c9, 0xb9ccc77f, 0xa9c2a977, 0x0000290b, 0xc6a5c6f0, 0xe4c1cb51, 0xb3d7b357, 0x0000be9c,
+        0x1b0b1b24, 0x3a03c33d, 0x6188618a, 0x0000ab25, 0xa5d0a5db, 0x7744395c, 0x004200de, 0x00004a93, 0xef93ef7d, 0x6b40967f, 0x7a5b7a74, 0x0000c593,
+        0x1ce31c19, 0x007ba7af, 0xfa4bfa10, 0x00003aed, 0x03060354, 0x914c1c52, 0xe18de1f2, 0x00000d18, 0x48084810, 0xaf5b8df3, 0x25ed25f2, 0x0000f426,
+        0x6ab06acc, 0x056c5032, 0x6b346bf5, 0x0000a907, 0x664f66d9, 0xef0efe76, 0x5b055b39, 0x0000d83b, 0x4d764ded, 0xbd8b5f11, 0xf6f7f638, 0x000094e0,
+        0x9a1e9a65, 0xb58ffc47, 0x3ea03e5f, 0x0000f0d2, 0x13101356, 0x17da5734, 0x04e10450, 0x0000fea1, 0x562d560f, 0xa3901fe1, 0x21dd210e, 0x00005dfd,
+        0xe33fe399, 0x8eeed3b6, 0x36b536a5, 0x0000a8bf, 0x64f464ff, 0x3db875db, 0xcbe0cbc1, 0x0000d918, 0xf3c6f375, 0x6e21a015, 0x627762c9, 0x0000ad65,
+        0x177817d0, 0xe95c3805, 0xe282e2f8, 0x000035c7, 0xca41ca96, 0x6d7f2796, 0x556d55c4, 0x000042b0, 0xc467c4b3, 0xb7b48f22, 0x8c958c7f, 0x00009a3e,
+        0x26d7267d, 0xec82c13d, 0x301e3074, 0x0000231e, 0xe4dae47b, 0x54a721eb, 0xd692d6f3, 0x0000c27a, 0x0caf0c85, 0xa7513c49, 0xce19cefd, 0x00001e29,
+        0xd520d52b, 0xc5346b75, 0x2f632fce, 0x000069b4, 0xc45dc4fc, 0x64cd12d0, 0x9d6f9d91, 0x00006678, 0x168116a3, 0x2027c387, 0x54f854a5, 0x0000de67,
+        0x08fc08b1, 0xc55e69c9, 0x552f55ee, 0x0000ceaa, 0x1dd61dbc, 0x522b2b09, 0x755975bc, 0x00003106, 0x22082205, 0xed790f02, 0xec18ec7e, 0x0000a155,
+        0xd71ad7c7, 0xb72bb9fb, 0x5f8e5fd4, 0x00006d86, 0xafb9af67, 0x8b84e3ef, 0xb768b7c9, 0x0000761e, 0x0676067f, 0x7b8fba12, 0xb193b1bb, 0x00000e99,
+        0xebd3eb3d, 0x5e6f3a4d, 0xd17ad18c, 0x0000af65, 0xb54cb512, 0xc855cd7a, 0x7c427c5d, 0x0000c27a, 0xde1fde9f, 0x522c7e84, 0x703e7069, 0x0000e489,
+        0xd52bd59f, 0x2330c512, 0x7a817a25, 0x0000f583, 0x3a6b3aa0, 0x4ce00541, 0x52f252ef, 0x0000f363, 0x8d478d4f, 0x85d569c8, 0x1a0b1a89, 0x00009101,
+        0x4b394b8c, 0xf3cef662, 0x75e175bb, 0x0000ddb7, 0x1337137d, 0xfdb35c2f, 0x797979a2, 0x0000e7e2, 0x1c1b1c5d, 0x0c57ba15, 0xbaa2ba18, 0x0000acd6,
+        0x42c442db, 0x4f407f44, 0x628d6239, 0x0000959b, 0xb23cb21b, 0x29a292c6, 0xe27ce218, 0x0000098d, 0x12af12f7, 0x5692655a, 0x521652e4, 0x0000b6a8,
+        0xf829f8e7, 0x1bac3a4e, 0x7092702a, 0x00002588, 0x022502be, 0x19156876, 0x99db9983, 0x0000fca1, 0xa912a9b6, 0x5a397e2d, 0xd78dd7c3, 0x0000755e,
+        0x7929791a, 0x15067a84, 0x57805717, 0x00007e19, 0x6e586e33, 0x677a5151, 0xb0feb049, 0x0000b531, 0x82c58247, 0x43f61b53, 0x4cd44c50, 0x00003395,
+        0x52185272, 0x615af5d4, 0x695169a2, 0x000022f5, 0xec2cec8f, 0xd1ffbe60, 0xd2dbd2dc, 0x0000aaa6, 0x72f37213, 0x1805dabf, 0xe16de172, 0x0000b5cd,
+        0x652a65f8, 0x9b4fabc0, 0x658565ae, 0x0000f32d, 0x52125273, 0x9972102f, 0x3f0b3f5a, 0x00001c88, 0x9a259a6c, 0x7d5583b2, 0x481c48b9, 0x0000eee2,
+        0x82318205, 0xf6e358dd, 0xa665a6b4, 0x0000ea69, 0xd854d8d9, 0xfb113544, 0x8cff8caf, 0x000023ea, 0x37563748, 0x6d60b3e7, 0xa030a0ec, 0x0000fe32,
+        0x721072f1, 0x85d56c7d, 0xab82ab58, 0x000073d1, 0x00c40035, 0xa214abf4, 0x5c3e5cc3, 0x0000cc8d, 0xfd9dfd3b, 0x3bdffac8, 0x9d3f9d4c, 0x00000d46,
+        0x9bd99bde, 0xb1aecbdc, 0x848f8475, 0x0000f02e, 0x07fb074b, 0x1c081cd5, 0xb9bdb9ce, 0x0000cda1, 0x85b8855e, 0x78dd5cac, 0xb10ab18d, 0x0000e9e2,
+        0xc0c4c08c, 0x2c3034eb, 0xd569d5a1, 0x0000ae4b, 0xfe00feb6, 0xe613d5e6, 0x795579a5, 0x0000beee, 0x76cf76d0, 0x56cb2509, 0x5c415c57, 0x00008d61,
+        0x3fd13f68, 0x17d51c52, 0x48a34824, 0x00001944, 0xf027f00f, 0x6650d8a5, 0xfdc7fd5e, 0x00008131, 0x79d77916, 0xe9e3f854, 0x095109ac, 0x000074d9,
+        0x213c2159, 0xc50b6a4b, 0x22ee2241, 0x0000449d, 0x78ae783b, 0x10da82f3, 0x2e472e2f, 0x0000e6f4, 0x6bc16b9a, 0x496f8bac, 0x83b283fa, 0x0000a359,
+        0x8a048ab0, 0x6350cd6c, 0x41d9410d, 0x0000aca7, 0xb374b3a2, 0xe052e7e1, 0xe284e2aa, 0x000004a1, 0x9a599a15, 0xadf1f557, 0x330e33b6, 0x0000a46f,
+        0xd909d9b7, 0x734a11e6, 0xeecfeece, 0x000035e9, 0x32fe3232, 0xf00bac88, 0x48b94813, 0x00009d16, 0x1cb91cfa, 0x8b5728f6, 0x7efe7ef2, 0x00000d3d,
+        0xc38ec31e, 0x8127abd1, 0x45fd456b, 0x0000e07c, 0x9de29de2, 0x5f40140a, 0x4b754b0b, 0x000072e5, 0x90e99061, 0xfa9b77a8, 0xa975a99c, 0x00007770,
+        0x309f30df, 0x2b63a19f, 0x22ab22fa, 0x000003e9, 0x5eb15e76, 0x7b8f7f3d, 0x35eb3559, 0x0000c08d, 0x1c571c99, 0xb5f7004a, 0xaf6dafdc, 0x000048f2,
+        0x8e508e3c, 0x17da1110, 0x54bc5482, 0x0000907e, 0x6fe26fd4, 0xe3627c0d, 0xf69ef687, 0x0000f652, 0xcb31cb86, 0xfacfe55d, 0x16d1163b, 0x000065af,
+        0x5fa15f73, 0x13f9d1f6, 0x84508445, 0x0000a258, 0x117b1187, 0x0b542748, 0x50ae50c0, 0x0000d27a, 0x386b3818, 0x4df6c9a0, 0x114811fd, 0x0000293e,
+        0xe12ee128, 0xf5c2495c, 0x1a5a1a15, 0x00006e0a, 0x91d991b4, 0x4198163d, 0x659d6556, 0x0000cfaf, 0x3a2a3a9b, 0x8b474f09, 0xb168b117, 0x0000eb17,
+        0xb887b813, 0xbca920a4, 0x9a3e9abd, 0x00007dbf, 0x50745085, 0x02c775d9, 0xe16ce15c, 0x0000ee94, 0x49b1499a, 0x7685c1b7, 0xaf8eaf7a, 0x000004a0,
+        0x254025a4, 0xd03cb6ea, 0x39173917, 0x00007920, 0x2e772e2a, 0xd34903f9, 0x87ed87d3, 0x000048ae, 0x67d3670f, 0xd58fda5b, 0x069e06e6, 0x00000be9,
+        0x5fb15f9a, 0xe2c34b60, 0x1ffe1f46, 0x00006bb4, 0x0de50d98, 0xd1665067, 0x91f591e9, 0x0000bb33, 0x52e05278, 0x004ab6e7, 0x99a099f2, 0x0000a5f7,
+        0x97259710, 0x3b2868c8, 0xf16df135, 0x000033d4, 0x2c6b2c52, 0x6b50c911, 0x7e097e77, 0x0000fed2, 0x9bd49bb8, 0xbaced094, 0xafbeaf9b, 0x00001c92,
+        0xffb6ff5d, 0x077badbd, 0x116111cd, 0x0000705e, 0x82328244, 0xa78e521e, 0x33263342, 0x00004dbd, 0x414e4104, 0x417846df, 0x62776272, 0x0000564a,
+        0x9b089b3c, 0x9f7158dc, 0x08d10897, 0x0000c7fb, 0x18f418de, 0xf4bed43b, 0x751775a5, 0x000030f1, 0x70e87056, 0x3ddf1c53, 0x40a14000, 0x0000cb95,
+        0xadcbad69, 0x3150d135, 0x416c413c, 0x00000308, 0x2c122ca8, 0x28ce4ae6, 0xa527a5f7, 0x0000cdf1, 0x4e794e67, 0x156b1a32, 0x48324839, 0x0000a91e,
+        0x26142694, 0xc4850a16, 0xadefadca, 0x000095b6, 0x64746471, 0xcc27f0d3, 0xc9c5c925, 0x00003bed, 0x25862550, 0xafb3846b, 0xe73de779, 0x0000fa33,
+        0xaaa8aa92, 0x6dffbd36, 0x6f036fe5, 0x00003912, 0x75ab7523, 0x86377bc0, 0x8cae8ca8, 0x0000310a, 0x50d6502d, 0x3f72ce34, 0xf3aef357, 0x000035cf,
+        0x41af416c, 0xc0d511b9, 0x0e8f0e35, 0x00002496, 0x5c395c41, 0x4a36fe0d, 0x34d4349c, 0x00002ba4, 0xbe81be89, 0x4e76e5dc, 0x45124561, 0x00008136,
+        0x380f3898, 0xd34f8467, 0x73b5738a, 0x00002b45, 0xa342a39f, 0x1b9039c1, 0x4c4e4c43, 0x00007e61, 0x709e70a4, 0xecafafba, 0x16f41639, 0x00000f83,
+        0xf463f444, 0x6223957e, 0x336d3392, 0x0000f232, 0xafa2afd7, 0x91af1a2c, 0xeb92ebe9, 0x0000d59a, 0xf8e7f844, 0xd1b4aec0, 0x7e537ea9, 0x0000d5ca,
+        0xa608a6a5, 0xcc8a0ee5, 0xa61da661, 0x000088fc, 0xfa61fa12, 0x0f5a5a5c, 0x910191df, 0x000032b6, 0x540a54da, 0x1f25e7fd, 0x342634bc, 0x00004a7d,
+        0x675f6749, 0xe8b105b4, 0x788a7820, 0x00008c1c, 0xc697c604, 0xa7ba914c, 0xba4eba10, 0x0000c712, 0xeb29eb14, 0xe6c100c8, 0x30203067, 0x0000498d,
+        0x422c420e, 0xb0ce7590, 0xaaa7aa9e, 0x00001b84, 0x27ab2751, 0x6d0ed49a, 0xc084c08c, 0x000046f0, 0x371d3764, 0xd2ebef17, 0xab98ab31, 0x00008e8f,
+        0xa6b7a65a, 0x44853dff, 0x71637128, 0x00003ec5, 0x2f672f28, 0x0141fe7d, 0x5562552c, 0x00009d6f, 0x0b490b67, 0x7967ec33, 0x0b4a0bb3, 0x0000da67,
+        0xc68fc6a2, 0x6932f004, 0x92949208, 0x000093c1, 0x8e0b8e00, 0xf2519bc8, 0x86988630, 0x000000c5, 0x0cc90cf0, 0x7bf5a22d, 0x6962693c, 0x00002986,
+        0x61b46106, 0x94fd3bce, 0x5fdf5f45, 0x000074b1, 0x313e3189, 0xa1518afc, 0x14c614a4, 0x0000bcce, 0x57c65769, 0xca07c279, 0x1318132b, 0x000017e3,
+        0xbff6bf27, 0x31566c74, 0x6e766e9e, 0x000034b6, 0x16fe1676, 0xf8885b73, 0x0e070ec5, 0x000066c8, 0x48f5484b, 0x90b36064, 0x74b1740a, 0x00001c0c,
+        0xb33fb3bc, 0xe1364e8f, 0x51ad513b, 0x00007960, 0x5e305ed8, 0xbc6f05a6, 0xe104e10e, 0x0000374a, 0x5f0c5fa0, 0x327d3c4d, 0x291f2916, 0x00001e24,
+        0x45ec451c, 0xc2145dbf, 0xefecef19, 0x00008d2e, 0x8dcd8d10, 0xb000a6a9, 0xa80da808, 0x00005136, 0x96879650, 0x163a992a, 0x175e1741, 0x0000e2ad,
+        0x13a01375, 0xe1ff034c, 0x114a1113, 0x00007e3c, 0x559b55df, 0xd03bdc3a, 0xef6eef88, 0x00003526, 0x97919784, 0xb2540e25, 0x2c1c2c18, 0x0000adfb,
+        0x4be54be0, 0x7b6d86ce, 0xd89cd888, 0x0000e817, 0x39b6393e, 0x7a7f15bc, 0x25ad2590, 0x0000abf7, 0x5a015a5d, 0x97d76695, 0x5e5a5ecb, 0x0000014c,
+        0xe207e227, 0xd5df3494, 0x1c171c0d, 0x00003964, 0x3fd83f9d, 0xb31327d6, 0x369f36fc, 0x000047ef, 0x72c37282, 0xda04aff8, 0x7a0e7a79, 0x0000e345,
+        0xa31fa3d1, 0x17c59405, 0x5d695ded, 0x0000b5b1, 0x980f9834, 0x2ff7b1a6, 0xd35dd3f5, 0x0000d2fd, 0xadfaad6d, 0xc5e31bee, 0xd61bd6d8, 0x00000363,
+        0xf5c6f505, 0x2cdd0b16, 0x3a8b3a28, 0x00004d33, 0xae0bae46, 0xac23391e, 0x6a1f6a5a, 0x0000a1e3, 0x19981934, 0x2e435c92, 0x761e7686, 0x00003f5f,
+        0xbdc9bdbb, 0xb7cc83a6, 0x28932835, 0x0000eaf7, 0xfdc0fdc0, 0x2752128b, 0xda66da12, 0x0000ab08, 0x63d4630a, 0xd0b0293b, 0x5c975c67, 0x000057c4,
+        0x2717271d, 0x08f5f156, 0x926e9203, 0x00004cf6, 0xe200e23a, 0x6dcaee02, 0xf3bcf3e3, 0x0000ca7e, 0xc3ffc37c, 0xa620eec3, 0x94979420, 0x00000ba8,
+        0xb08db05f, 0x022bbf0a, 0xb884b8de, 0x00001a2a, 0xeb32eb07, 0x5d66f5ac, 0xbc98bc25, 0x000011a5, 0xbc39bcad, 0x8d46e127, 0x3f873f90, 0x00007d70,
+        0x0e950e3f, 0xffceaa8a, 0xca49ca13, 0x0000d2a5, 0x4193413a, 0x6a225a5e, 0x26702671, 0x0000f098, 0x22d322bf, 0xa871ee87, 0x00b9007f, 0x0000f493,
+        0xf701f7c1, 0xe2d31955, 0x23582300, 0x00000d18, 0x2cd62cde, 0x6840d0bb, 0xaea5ae96, 0x00008fab, 0xb8e7b818, 0x6d7e766f, 0x23df232c, 0x00007361,
+        0x26872609, 0xee13665b, 0x6bf86b54, 0x00002176, 0xdf37df0a, 0xf35a4e29, 0x4aa44a3e, 0x00000204, 0x53ea535d, 0xf2cb65df, 0x84df848e, 0x0000d867,
+        0x69fe6981, 0x4788c81a, 0x96809661, 0x0000352a, 0xb039b077, 0x798b6d3a, 0x4d034d85, 0x0000c412, 0x3bfb3bb5, 0xa4c29fca, 0x6c6f6c27, 0x0000af77,
+        0x424a4252, 0x36d836df, 0x14a714aa, 0x0000cb6a, 0x473f471c, 0xa1c2ed6b, 0x81ed817e, 0x0000eb28, 0x57df57ff, 0xe55cb358, 0x43d14370, 0x0000d674,
+        0xd316d3eb, 0x90dc938e, 0x13951305, 0x0000466e, 0x0e5d0e19, 0x4b7fd1f5, 0x8773870e, 0x0000ae0b, 0x1c521c9e, 0x52c809ba, 0x63b063b7, 0x00003aae,
+        0x9f469fc0, 0x5e90b46a, 0x07de0740, 0x00005e6f, 0x5a245a56, 0x6cbfc275, 0xa473a434, 0x00000500, 0xb515b56d, 0xed0033bf, 0x7acd7aa3, 0x0000e345,
+        0xac6eacd7, 0x0f8428f8, 0xa406a41e, 0x00001302, 0x26d6265a, 0xadc3f84c, 0xaa64aad4, 0x00002c2f, 0xdafddac1, 0xfa11f9b8, 0xddedddd2, 0x0000c727,
+        0xef44ef51, 0x3edf45d5, 0xce0dce18, 0x00000aed, 0x14311441, 0x88c6de2b, 0xb484b464, 0x0000be4e, 0xf172f180, 0x89817d41, 0x013f0170, 0x00001888,
+        0x26dc2658, 0x38376ea4, 0xcd57cdfe, 0x0000261e, 0xec7cec93, 0x87f6b8cb, 0xbe00bedd, 0x00007fbf, 0x7af17adb, 0x41e45e7c, 0xffc5ffeb, 0x0000ba6f,
+        0x0302039a, 0xae9bb0e7, 0xc936c95d, 0x0000e589, 0xe0c7e0a9, 0x9104b69f, 0xd4e5d45b, 0x00004881, 0x8c818cd4, 0x0a5f74a9, 0x53015374, 0x00005854,
+        0x07b00787, 0x9c0623d6, 0xae79ae3f, 0x0000ae77, 0xc593c503, 0xf3189580, 0xdd3fdd4e, 0x00006c59, 0x450c45d2, 0xb362aba9, 0x6148611b, 0x000026ff,
+        0x272c27f0, 0xc8eba533, 0xdf69dfdd, 0x00004d04, 0x3b203b40, 0x231260ea, 0x52c85235, 0x00006446, 0xef21efd0, 0x2492a32d, 0xf8f9f894, 0x0000ab47,
+        0xfee1fefd, 0x8a271cdb, 0x4193415a, 0x0000c398, 0xfe11fed2, 0xabf0c1fe, 0x69d2692f, 0x0000049e, 0x24f5247b, 0x11a544fa, 0xe03ae08c, 0x00002ef9,
+        0xf926f9fe, 0x8a484a10, 0x1d0a1de2, 0x0000edd7, 0x9852981c, 0xd469f302, 0x41d4418a, 0x00006a08, 0x0182013c, 0x4e09779f, 0x9872982f, 0x0000bfbc,
+        0x9ae49ae1, 0x528c0b97, 0x0460044d, 0x0000d049, 0x303b3082, 0x7a8b42da, 0x963b964e, 0x0000c5b2, 0x04a004d9, 0xc0d6e94f, 0x6f176f2d, 0x00000a2c,
+        0xb309b3cc, 0x64f08583, 0xe392e380, 0x000011e3, 0xaeb4aef7, 0x615a95be, 0xb3cab366, 0x00008bb3, 0x80518067, 0x6ff0c237, 0xcd1ccd27, 0x0000d005,
+        0xe985e93a, 0xfc3d24ab, 0xd601d609, 0x0000e7ac, 0x341c3402, 0x80a6beaa, 0x7c637cc6, 0x00006470, 0x5adc5a94, 0x8d0694f7, 0x4e1f4e8e, 0x00004a37,
+        0xd8a8d8ec, 0xe1a1dc6a, 0x755f7599, 0x0000b9ce, 0xfa8bfa0c, 0x7e553411, 0x325f32d2, 0x000051c8, 0x50d250a7, 0x3ace9bb5, 0xd4c8d476, 0x0000b3a9,
+        0x2d002d51, 0x56b2a78b, 0x97c29777, 0x000079df, 0xd933d9ba, 0x3c03d8fb, 0x8506859a, 0x0000a41b, 0xe409e421, 0xb98bcc66, 0x98d198d1, 0x0000e689,
+        0x69ea699d, 0x62b2e17d, 0x33f4335e, 0x0000fc1d, 0x4e554ece, 0x69d12529, 0x2e572e93, 0x0000829c, 0xda36dab8, 0xc435288d, 0x52d35237, 0x0000a577,
+        0x96769602, 0x9e2e325f, 0xd82ad8ac, 0x000077f2, 0xd8c2d859, 0xdc7bb7d6, 0x7fee7f46, 0x0000b2ae, 0x00e200dd, 0x86d550d0, 0x93a5938e, 0x00008a1b,
+        0x6de86db3, 0x1e6a6014, 0x1ba11b52, 0x00003aaa, 0x84f08451, 0x3d3b5ea3, 0xa41ca44c, 0x00005b54, 0x94a894e0, 0x3a2cf669, 0x9a7f9ab7, 0x00003eb2,
+        0xef92ef53, 0x93e9ce65, 0xb06db09e, 0x0000b28e, 0x3bf43b09, 0xc755e3e2, 0x941694e0, 0x0000c573, 0xb032b03f, 0x20b98070, 0xdf97df70, 0x00005c92,
+        0x603b6032, 0x3c19a066, 0x31143172, 0x00000b1f, 0xc85bc81c, 0x3087655a, 0x42c44258, 0x0000c0ec, 0xbf6fbf57, 0x6d6b426f, 0xa25ba24c, 0x000057d8,
+        0xa2c6a260, 0xdd8f95fa, 0xad37adaf, 0x000070b7, 0x3c2e3ca6, 0x05ba41c4, 0xeedcee4f, 0x00001ed3, 0xc732c748, 0xd8e4b754, 0xabe8abdb, 0x0000b442,
+        0xacfbac60, 0x0aa493d8, 0xe36ee3dc, 0x0000aa58, 0x61da6157, 0x60a01852, 0xf807f80d, 0x000008f8, 0x611f61ab, 0xf318dde5, 0x7c677ce4, 0x00007f0f,
+        0x38933842, 0x580a0dd9, 0x2f752f76, 0x0000af66, 0xc5e5c572, 0x1c8afef9, 0x65ab65d9, 0x00009a8a, 0xb247b2ce, 0x58aa7256, 0xfb53fbf9, 0x0000c79e,
+        0x3ae63a29, 0x176bc7c7, 0x408840bf, 0x0000b19a, 0xc4dbc4d0, 0x88b63a91, 0x2a9d2a12, 0x000058d7, 0xbe3abe08, 0x90f1ac37, 0xd522d515, 0x000081a2,
+        0x86c18688, 0x77ff00c9, 0x4c084c91, 0x0000115b, 0x56495652, 0xc33ad9a6, 0x785178ab, 0x00000e63, 0xf31bf32d, 0x76e216b9, 0x3cfd3c0e, 0x0000968a,
+        0x85f285d6, 0xd5b0d8d9, 0xae3eaef5, 0x0000591f, 0x38213830, 0x2192be77, 0x6d586d95, 0x0000f651, 0xf78ef7df, 0xf803834d, 0x182418e1, 0x0000fba1,
+        0xc81ec84e, 0x74bae831, 0x0c760c74, 0x0000fb93, 0x72a472b1, 0x75ed1322, 0x629c62f8, 0x00007cee, 0xe771e7cf, 0xe3311c2c, 0xf282f251, 0x00003ded,
+        0x5d6c5d1d, 0xbbd1f840, 0x1f071f05, 0x00008a1a, 0x55ca55a5, 0x08341bad, 0x68f268e5, 0x000020cb, 0x4e624e0c, 0x558d0ce7, 0x845684ab, 0x0000a455,
+        0x3f0b3f19, 0xc10b0277, 0x1da41d6d, 0x0000ba13, 0x5d7d5de0, 0x0ae96ed5, 0xdf8fdf67, 0x0000f163, 0x548654d4, 0x14efc747, 0x844a848f, 0x0000b409,
+        0x858485f8, 0x1c310946, 0x01fe01b0, 0x0000d7a5, 0xa02ea06d, 0x90cb1602, 0x03bb0369, 0x00001ba5, 0xaf29af1b, 0x41ef8f9e, 0x3c443cd6, 0x00005fdc,
+        0xf4e5f4d4, 0xf510bef8, 0xd0d1d0e6, 0x0000f3b3, 0x3e523e88, 0x40e9de6d, 0x00330011, 0x00004f22, 0x70ad703f, 0x061c697d, 0x4b6d4b63, 0x0000070d,
+        0x3e2a3e26, 0x120defec, 0x7ac67ad4, 0x00007051, 0x3c353ca8, 0x9ed79e55, 0x494a4971, 0x00005799, 0x9118912b, 0xc26fc9ce, 0x657b65d8, 0x00009de0,
+        0x6cc86cfe, 0xc015fd8d, 0x56d25634, 0x00005479, 0x27a92765, 0x12811b50, 0x9e0d9e89, 0x00000897, 0x9403940c, 0x9bbecae3, 0x018f0134, 0x00005306,
+        0xc8dbc8b3, 0xe95bd435, 0x294629e5, 0x00002d3a, 0xf14af1a9, 0xc1f592a5, 0x8c9c8c27, 0x00006f01, 0xa896a823, 0x6af0420a, 0x8bc58b7b, 0x0000368c,
+        0xf366f3c2, 0xad5fe4b0, 0x5fec5f4e, 0x00006117, 0x61ef6174, 0xa2909b2a, 0x15981545, 0x000064c9, 0x0568058c, 0x95d4f2a8, 0x2e382e4f, 0x0000cb69,
+        0x8b278b3e, 0x56f0fb3b, 0x2f042f30, 0x0000644f, 0xf1b4f10c, 0x2d325c2c, 0x25a825e2, 0x00007e5e, 0x85138592, 0x05f5c817, 0xb09ab0a0, 0x00002f25,
+        0x9c9c9cde, 0xaa9124bf, 0xa589a5f3, 0x0000bc7a, 0xfa5ffae8, 0x6ca1bd48, 0x1f7d1f39, 0x0000472e, 0x3d1d3d91, 0x22f0d3cb, 0x6f9a6fb2, 0x00009782,
+        0xf84bf8cd, 0x1705b201, 0xeb53eb60, 0x000009fa, 0x8e8b8e8f, 0x83264f4d, 0xf948f9b6, 0x0000a222, 0x0a5d0ad5, 0xa0611ce1, 0x5af15afc, 0x00001322,
+        0xebecebd0, 0xfb030da6, 0xb8afb8c1, 0x0000b8b1, 0xb438b4bf, 0x783e84c1, 0x54be5483, 0x0000e446, 0xe9c6e9a2, 0xb2ad225b, 0xd024d06f, 0x00007861,
+        0xbdecbdca, 0x0927a266, 0xefc3ef24, 0x00006028, 0x5c375c59, 0xcf7ab9cc, 0x186218fe, 0x00007260, 0xe74fe771, 0x3f72ae8a, 0x86cf8624, 0x0000f9a1,
+        0xfed9febd, 0x598043f5, 0x92029261, 0x000066c8, 0xd1f2d196, 0xb36c958f, 0xea55ead9, 0x000078fe, 0xd543d558, 0x1f09469b, 0x2ff92f1e, 0x0000953a,
+        0x4ac04a7c, 0x385730a1, 0x2f432fed, 0x00000763, 0x0ff80f42, 0x08342637, 0x5e735ecc, 0x0000d484, 0x2f6f2ff4, 0xa78ea589, 0xb724b7b9, 0x000066c8,
+        0xe895e8e8, 0x2752ed50, 0x6ca36c28, 0x0000098c, 0xbdc3bd1d, 0x9469e4e2, 0xdd10ddd2, 0x00003833, 0xe386e38c, 0x7d55fe8e, 0x1b2b1bf2, 0x00001707,
+        0x963e9674, 0x38dfe686, 0xc4b5c4fb, 0x00009cf6, 0xd6ced6b0, 0xd4042fbd, 0xa79ca731, 0x00007651, 0x1f161fbe, 0x301908d9, 0x60ac60db, 0x0000dc1f,
+        0xf7ebf716, 0x3abb65e5, 0xd6f1d6a6, 0x00001873, 0x7b0c7b66, 0x83db6356, 0xdcc9dc2e, 0x0000df16, 0xb06cb078, 0xe77feb73, 0xd676d643, 0x0000df3b,
+        0x8be88b6b, 0x94fad8a5, 0x01ba0149, 0x000020b2, 0xe1ffe15b, 0x1ca5eff3, 0x99949903, 0x00008ce1, 0x433f43c3, 0x4c36a64b, 0xe4ace46c, 0x0000962b,
+        0x3fda3fd3, 0x76f7f55d, 0x6ec06e2f, 0x0000664d, 0x723972f2, 0xad0df8c5, 0x84d98420, 0x00007251, 0x872c8767, 0x004442ad, 0x4d084d1f, 0x0000770f,
+        0x479247b3, 0x36aa08b8, 0xf923f9bb, 0x0000a876, 0x552455b8, 0x47a741c4, 0x92949295, 0x0000cf6d, 0x7bdc7bc1, 0xe7525b9f, 0x76787631, 0x0000f31e,
+        0x21d621d1, 0xac2299d7, 0xf4d2f480, 0x000006d9, 0xa669a6da, 0x52a7acce, 0x67836734, 0x00005bdd, 0xc257c2a8, 0x76605433, 0xa064a0b1, 0x000052c8,
+        0x227b22bc, 0x1375abf1, 0x426242f1, 0x00003c8c, 0x0dcd0d5d, 0x95d97e7e, 0xbbc0bbf5, 0x0000aaa7, 0x4ce74ced, 0x62f0ac41, 0xbf68bf78, 0x00002f34,
+        0x03f60342, 0xe34d42db, 0x40f04052, 0x00007a51, 0x7c877c00, 0xbed20ad7, 0x3ca33cd4, 0x00001265, 0xfd31fdc6, 0xce5510ad, 0x3f943fcd, 0x00008d61,
+        0xb4b2b421, 0x1555b817, 0xe85ae8ac, 0x0000316a, 0x5317530f, 0x555dcdd3, 0x764276de, 0x00002a6a, 0xd38dd33a, 0xf895327e, 0x5c055c5a, 0x000062af,
+        0xa9a5a913, 0x4a899f5e, 0x03c80334, 0x0000b605, 0x6ec76e04, 0x20317948, 0x42f642e0, 0x00002176, 0x4e804e1d, 0xf22180cc, 0xe67de649, 0x0000d376,
+        0x6bd96bde, 0x965c1aaa, 0xfc4bfc13, 0x000027eb, 0x3d233d3e, 0x6f104937, 0xb9b7b91a, 0x0000b5cc, 0xb712b7fb, 0x8408d93f, 0x377b3762, 0x000035d4,
+        0x61e06149, 0xa290e4c3, 0x05fb0548, 0x00009850, 0xbbc7bbe2, 0xdc2e317e, 0xc3e3c351, 0x0000cd79, 0xac1bac2c, 0x07444aad, 0x28ae284e, 0x000055a7,
+        0xcbf6cb62, 0xd1dbcf53, 0x64616412, 0x00008f2a, 0xc2d6c28a, 0x39fd9c9c, 0x97b8975c, 0x0000b531, 0x06b406d2, 0x7a0f87de, 0xa7f0a72d, 0x000000c5,
+        0xa938a9df, 0x0ca3da09, 0xfb62fb64, 0x000032b7, 0x71b371fd, 0x50077ab4, 0x1123114b, 0x0000d5d7, 0xdcecdc34, 0x01415fed, 0x4ca74cd9, 0x0000f0d2,
+        0xb557b527, 0x91b66977, 0x68aa6850, 0x000004a1, 0xb46bb4f5, 0xc4cabf89, 0x69a769db, 0x0000ee69, 0x9de59dc9, 0x655ac33c, 0xb810b82f, 0x000018c7,
+        0x82fe8255, 0x5ed72d74, 0x03080380, 0x000058b0, 0x7ad27aec, 0x419969c8, 0xa588a5cc, 0x00001aad, 0x2e752e05, 0x7aaca1a2, 0xf576f5c4, 0x0000c5d2,
+        0x253c2523, 0x1f8a7a86, 0xa8f1a87b, 0x00002827, 0xfce1fc81, 0xe7e115c3, 0xf1f6f1aa, 0x000025f4, 0x825382a4, 0x9eec72ac, 0x1b5c1bd0, 0x000043c7,
+        0xbefcbe04, 0xdaf808b8, 0xbc64bcd9, 0x0000a235, 0x0d570d3a, 0x7e51f7e5, 0x9579953d, 0x00009ff1, 0xff34ffe2, 0x0fcb8bd1, 0xeaf5eabd, 0x0000e7ad,
+        0x611d6181, 0x5af24207, 0xa41fa4ab, 0x0000f26b, 0xa7d5a744, 0x56780cc6, 0xd4fed4cb, 0x0000e407, 0x18be1826, 0x5f40cbdb, 0x838e8342, 0x00006fa6,
+        0x496d49c6, 0x262f7b16, 0x37d73727, 0x00005539, 0x5f595fe0, 0xe3d38fa0, 0xf636f6a7, 0x000010be, 0x53e453c2, 0x5fdd00b6, 0x178a1707, 0x00003f2d,
+        0x0cd00ce8, 0xa0659675, 0xa071a037, 0x0000ca7e, 0xd3c3d33c, 0xc1690938, 0x6cae6c5a, 0x000069d5, 0x22c622cd, 0x683d916c, 0x2bc62b3c, 0x00005cae,
+        0x16ac1609, 0x3ac34d29, 0xd564d5e2, 0x0000925d, 0xa2b8a2f9, 0x59c8fdc2, 0x409b40be, 0x0000e7ac, 0xf90df966, 0x6c61c7ba, 0x62a162ad, 0x0000086a,
+        0xac39acd9, 0xe8ff593f, 0x896989d1, 0x000098c8, 0x10481056, 0x95cb3816, 0xe70ae726, 0x00001df0, 0x2aac2a28, 0x6450e0a2, 0x6855682b, 0x0000c907,
+        0xba0dba9a, 0xde5465db, 0xff96ff79, 0x00008880, 0x43b24338, 0x6f61ab47, 0x1200122d, 0x00000a50, 0x3e5b3e33, 0xeec0af89, 0x17f4175e, 0x000041d0,
+        0x267a2607, 0x4f2947e4, 0x393339c4, 0x0000240d, 0x4a554ae1, 0x0adcc811, 0x071e072b, 0x0000015d, 0xd8a1d8d6, 0xbba9ac78, 0x5aaf5a2d, 0x000066c8,
+        0x51405161, 0xf18c7f70, 0x6c696c9f, 0x00005cb4, 0xe32fe385, 0xfe2602f9, 0xbc1cbc4b, 0x00008f69, 0x2e2d2ee3, 0xf428b03a, 0x59d45934, 0x0000be62,
+        0x188718b4, 0x0726a987, 0xbe3dbee5, 0x00001af4, 0x2a1a2a13, 0x1753e533, 0x707c7000, 0x0000c9b5, 0x91e09109, 0x24ee97c7, 0x08500854, 0x000015ba,
+        0x65006515, 0x2b43315d, 0x41f241d8, 0x00002725, 0xb3ffb3df, 0xc17cdec4, 0xce4acead, 0x0000249c, 0xf0f9f08f, 0xe6bc1d24, 0x47cf4770, 0x00006ee1,
+        0x97c2975c, 0x0663560d, 0x0a710a28, 0x0000b036, 0xe072e044, 0x0726635a, 0x673367c5, 0x00005a09, 0xc871c81d, 0x0566df25, 0x1c011c83, 0x00006ec0,
+        0xd7ffd764, 0xf895cc31, 0x85678596, 0x00000272, 0x62da625c, 0x69a06ec5, 0x2b5c2b05, 0x00005046, 0xd21bd2f6, 0x240d54cc, 0x30873081, 0x0000bead,
+        0x465a4600, 0x991e6db8, 0x0007009a, 0x0000d91a, 0xf9b5f974, 0x76a849dd, 0x579c57a1, 0x000026b6, 0xeeeaeec8, 0x2c426677, 0x3f6b3fd1, 0x000079bf,
+        0x031d03f8, 0xdab1d6f4, 0xf46ef4d7, 0x00003e4c, 0xd063d041, 0x0bb4efe2, 0x80e880ef, 0x00008671, 0x758475a4, 0x0786e180, 0xe8d8e8c7, 0x000033b6,
+        0x1e091e58, 0x9fe753b1, 0x124c12fb, 0x0000cbaa, 0x1cd31caf, 0x97d90853, 0x1dc01d17, 0x0000c8a2, 0xc2d9c20d, 0x5b352754, 0xaa54aa37, 0x00003552,
+        0x868586d5, 0x495f8683, 0x34a4346c, 0x000013a5, 0x256e25fa, 0xc069681d, 0x7c527cb5, 0x00003992, 0xe0dae0ab, 0x4d480ba6, 0x679c67da, 0x00003f4c,
+        0x81dc812e, 0x9406f761, 0xe8a4e842, 0x000021b6, 0x152015f0, 0xdebc10d8, 0xb16db177, 0x00005506, 0xe068e0aa, 0xf87707f7, 0x293c293d, 0x00007673,
+        0xb059b05d, 0x69420a16, 0xb628b6f9, 0x00004ea9, 0xd4d8d480, 0x7dd07d2f, 0xe8e0e840, 0x000026ff, 0xa4d1a447, 0x823722f5, 0x7b6d7b50, 0x00001475,
+        0xa374a311, 0x385006f6, 0xe63ce68d, 0x000078e1, 0xb569b5d0, 0x0a24538d, 0xeadceadf, 0x00007f8f, 0xeac6eaa6, 0xeb3152dc, 0xc09dc031, 0x00006000,
+        0x6c136c3e, 0xe01e75d9, 0x19571995, 0x00005dd8, 0x4b8f4bfa, 0x328684b0, 0x5b9f5b4f, 0x00002dfa, 0x4aee4a2a, 0x68a096c3, 0x5a3a5a4b, 0x00001e81,
+        0x6edc6e9f, 0x3e0a07ba, 0xf9a3f953, 0x0000ab36, 0xd30cd358, 0x48544458, 0x7e9f7e69, 0x00004411, 0x5926599c, 0x52d7f5dc, 0xd2f0d2e1, 0x0000c08d,
+        0x0d340d78, 0xe79349e9, 0x375c37d8, 0x00007c70, 0x18b51834, 0xd04dcdd3, 0x826d82bb, 0x00008142, 0xb3edb38e, 0x9f3b866d, 0xea20eaf2, 0x00007281,
+        0xad8ead39, 0xe8ce77d8, 0xa3bda356, 0x0000e285, 0x62486217, 0x9107706f, 0x48cb4871, 0x00007ab1, 0x94ea94f1, 0xed00ecf3, 0xe2a0e20a, 0x000086fd,
+        0x10ef10b7, 0x6d9183fe, 0x66556602, 0x0000b104, 0xd2e2d2c6, 0x99f1f5dd, 0x92829260, 0x0000cc7d, 0x692869d2, 0x671532df, 0xb5d9b569, 0x0000e74d,
+        0xa888a8a3, 0xac5f423a, 0x53e65339, 0x00003b4c, 0xb18eb1a4, 0xf29b974a, 0xba3dbaec, 0x00003bfa, 0x91e2910d, 0x5af0fd3d, 0x85a08503, 0x0000729a,
+        0x2eca2e60, 0xe002b615, 0x33e2337b, 0x0000805f, 0x95b6952d, 0x04ec0f6f, 0x242b2455, 0x00001c68, 0xc145c134, 0x376f6625, 0x0dab0dfd, 0x000002bd,
+        0x9e1e9e10, 0x2311daa4, 0x93419388, 0x0000f2ec, 0x42f64289, 0x67cdcad9, 0x468a468a, 0x0000a41c, 0xf2c7f283, 0x45f6d981, 0xa592a50c, 0x0000ab64,
+        0x8cf68c29, 0xbee454fc, 0x23112327, 0x0000da67, 0xebaaeb93, 0x6cbf6195, 0xc676c63e, 0x00007e61, 0x04c10465, 0x5e68438c, 0xe693e654, 0x00009590,
+        0xe34ae34b, 0x7b1adfc4, 0xe319e320, 0x0000dbd5, 0xedeeedca, 0xc0f55430, 0xc303c360, 0x00006a8b, 0xf496f46d, 0x74aea5d4, 0xd61ad635, 0x0000cdce,
+        0x38333810, 0x74d2a454, 0x7db67dab, 0x0000bf27, 0xfef5feae, 0xc6e351b3, 0x602d6000, 0x000068b8, 0x2d8a2d1c, 0xe322d577, 0xf1f2f1ae, 0x0000cc38,
+        0x8a138a61, 0xdf6743f8, 0x301e3083, 0x000026be, 0x6624662c, 0x6b806eb0, 0x84a9840e, 0x00007f02, 0xb8ecb839, 0xbfb4abc0, 0x4eb64eec, 0x0000e74a,
+        0x9a2e9a3b, 0xbc8b02c8, 0x55025558, 0x0000f963, 0x2a092a64, 0xa09deebd, 0xbd97bd97, 0x0000e42d, 0x375637b0, 0x28c04fea, 0x845f84e7, 0x0000edd4,
+        0x95c49524, 0x57739038, 0x8adb8ae7, 0x0000998a, 0xf4fbf498, 0x4deb89e5, 0xea60eab1, 0x000036aa, 0xeee6ee81, 0xeb127256, 0xc90ac91e, 0x000032e6,
+        0x2fd12f59, 0x9d25746f, 0x833b83f4, 0x00001988, 0x3b5f3b92, 0x304f9db0, 0x7b087b58, 0x00008754, 0xf765f7c5, 0x3a9154ae, 0x2a812a12, 0x00001a6e,
+        0xbfd3bfe4, 0x80d5d826, 0x066406c6, 0x00002d75, 0x0b050b2e, 0xf757f2d1, 0x362b36d3, 0x0000bf4e, 0x032f0353, 0x2c5d0e0b, 0x4e274efc, 0x000080be,
+        0x4dc94d5d, 0x47a54961, 0x08a80895, 0x00004e48, 0x39e139e8, 0x0ccb5079, 0x5dfa5d4e, 0x00004d42, 0xc906c9c6, 0x5f432026, 0x22b62237, 0x0000185e,
+        0x6b606b4b, 0xe66982e1, 0x9a5c9afb, 0x0000f591, 0xf065f073, 0x2b7dfc7e, 0xf0b3f00e, 0x0000f88c, 0x5ab85abd, 0xbece6627, 0xad42ad60, 0x00005bdd,
+        0x693a69bb, 0xd82ebdc9, 0x2ab92ab3, 0x00008630, 0xac8dac54, 0x6bcd90ad, 0x6f676ff8, 0x0000bc10, 0x17ab1734, 0x2223db3f, 0xd3a9d376, 0x00002c08,
+        0xbe68bec0, 0xb2eb6dc1, 0x0df60d5d, 0x00006446, 0x68a1680d, 0xbecc0f59, 0x78eb7815, 0x0000d8eb, 0x1c2f1c5b, 0x8858a9c0, 0x97c79737, 0x0000f0b4,
+        0xf86ef8e9, 0x5f2cb3a0, 0x256f25f6, 0x00001bba, 0xd1d9d15f, 0x8587564c, 0x5b195b7b, 0x0000a5f7, 0xd6d4d677, 0x328c85d7, 0x50075050, 0x00001a02,
+        0xb484b488, 0xf29bcc0e, 0x83378330, 0x0000fcdb, 0x0904092c, 0xcc93f4f7, 0xa918a99f, 0x0000d96c, 0x24eb2468, 0xe643d3ca, 0xe30fe396, 0x000032b6,
+        0x5c3c5c40, 0x91f19b2a, 0x843f848c, 0x0000f808, 0x613761bc, 0x48795faa, 0x50715026, 0x0000789d, 0x37863741, 0xa6df8919, 0x0769079a, 0x00001944,
+        0xe3a0e3b0, 0x747581e1, 0xee53eee2, 0x000052e8, 0xb7f6b7e6, 0x356b376f, 0x1786177d, 0x00000300, 0x4959492a, 0x4f27be60, 0x314a3139, 0x0000cc07,
+        0xd12ad1ca, 0x5b6872a9, 0x093d0927, 0x00004981, 0xc614c686, 0x52d9e7e1, 0xe1f2e1f0, 0x000057fa, 0x84ac84ce, 0xaac3c343, 0x79cf793e, 0x000026b2,
+        0x9c429cb3, 0x6ff32e38, 0xc33cc3e7, 0x0000e24d, 0x13a113cf, 0xfbe97e17, 0x817c813b, 0x0000f162, 0x46ae4620, 0xc294854f, 0xbaa4baff, 0x00002d1c,
+        0x803f8006, 0xa63359a3, 0x2e392ea2, 0x0000ad07, 0x482b4835, 0x319a95c7, 0x695369aa, 0x000052c9, 0x4da04dee, 0x28921893, 0xc752c7e9, 0x0000fd28,
+        0xa587a581, 0x43f6ba01, 0x594259ba, 0x00007ea3, 0x161816f7, 0x85a948d5, 0xd4f2d49c, 0x0000d0eb, 0xafacaf94, 0x89f7c8da, 0x75f075f3, 0x00007d4b,
+        0x78d078e3, 0x13fedee4, 0xa8f3a8a6, 0x0000e389, 0x4139410b, 0x668079fc, 0x8bfb8b36, 0x0000ae74, 0x9c149cd5, 0x60cf4f6f, 0x4d604d3c, 0x0000243e,
+        0x6d4c6d6d, 0x2b7ee55d, 0xb86bb836, 0x0000fcd2, 0x5b2f5b26, 0x7859b522, 0x89c08974, 0x00007568, 0x36ff36bc, 0x53a792d8, 0xba25bac2, 0x0000dd2c,
+        0xfbb7fbcd, 0xd82e7751, 0x529252fa, 0x00006b96, 0xf7e6f747, 0x12da5d13, 0x6cc16cb2, 0x00009d8a, 0x70d270ef, 0x55ff23d6, 0x004b00e6, 0x0000a62a,
+        0x7b687bf8, 0x5cbf275e, 0x28392879, 0x0000a5e9, 0x10d01058, 0x55e05381, 0xe02be03a, 0x00006899, 0xe330e308, 0x5b89af3c, 0xc1f7c1ab, 0x00006446,
+        0xe158e1f6, 0x24a27e45, 0x8c9f8c02, 0x0000a099, 0xeb7febe5, 0xa6236424, 0xbebabe74, 0x000007f0, 0x8c1c8cd5, 0xce45fcf4, 0x3cf03c10, 0x000028a4,
+        0xcb4acbcc, 0x0cbbd01b, 0x96b19664, 0x0000b83a, 0xe310e325, 0x96730469, 0x2c602cdc, 0x0000839d, 0xa5c2a5d2, 0x9aa61837, 0xe076e035, 0x00008a1b,
+        0x6702674e, 0xe8d1ef17, 0x0469040a, 0x00007adc, 0xed38ed94, 0x54a07b3d, 0x631363b1, 0x000048cd, 0x672e67cf, 0x316dd0e9, 0xaa28aa85, 0x0000e0e2,
+        0xda2dda2f, 0x741aae52, 0x8b678bf0, 0x00005b5b, 0x5d5a5d41, 0xd1cdaf79, 0xc01fc0eb, 0x00009727, 0xd762d719, 0x9ef143bc, 0x7a4f7a2a, 0x00009d90,
+        0xa2c8a239, 0x03848711, 0xcd1ccd24, 0x0000d3eb, 0x70a070a7, 0x48164b9c, 0xb375b326, 0x0000d2a5, 0x6fb66fde, 0xd2541b53, 0x6d096dff, 0x00008980,
+        0xb039b0d2, 0x72951d64, 0x26ed2643, 0x0000f4c1, 0xefdeef8a, 0xcad9affc, 0xc3ecc30b, 0x000073a6, 0xa828a84d, 0x17defacf, 0x700b705a, 0x0000dd40,
+        0x2f332f66, 0xeb0e4924, 0xcc84cc9c, 0x0000aa37, 0x90e2900c, 0x83f7438c, 0xc166c17f, 0x000037ab, 0x207e20ee, 0x472478a9, 0x566f56a1, 0x00005299,
+        0x609b6070, 0x69cde090, 0x2413246f, 0x0000ab64, 0x48414809, 0x65cd11c6, 0x014a01e1, 0x000062da, 0x8b358bb5, 0xc1a68adb, 0xc218c299, 0x0000c607,
+        0xb92ab994, 0xa4a0ff0e, 0xe545e58c, 0x0000a965, 0xa8dda81a, 0xe3a0548e, 0x97c19733, 0x0000024e, 0xe9aee9de, 0xb1548b21, 0xc5dfc591, 0x0000fcce,
+        0xfb2efbd9, 0x9bdfec4e, 0x0e880e9a, 0x0000af6a, 0xfbf7fbea, 0x68feb9d6, 0x7f797f31, 0x00003f2c, 0x74c4748a, 0x7cdda8c2, 0x0d000d9d, 0x0000ba4e,
+        0xca54cac1, 0xf928cda8, 0x2f482fa0, 0x0000fa38, 0xe20ee238, 0x13ee3d71, 0x81ee81b5, 0x00000dd2, 0x9d149dd9, 0x27d00669, 0xb16bb137, 0x0000a84c,
+        0x04640483, 0x9ae6fd7d, 0xa30da377, 0x000051e8, 0xd094d003, 0x06a5c01c, 0xcd8bcda2, 0x0000b7cc, 0x17f217ce, 0x54cb4b1d, 0x38ab381b, 0x0000dcc4,
+        0x20e32070, 0xd5b0cd2e, 0x59d059d4, 0x000071ee, 0x4f3a4f8c, 0x5eff4e56, 0xc1f6c183, 0x00007cfe, 0x1383134b, 0x1b6e9181, 0x26cc26ea, 0x0000e4cb,
+        0xa03aa0d9, 0x5b4d36ad, 0x49b349e3, 0x0000933e, 0xd617d60a, 0xb7ea163d, 0xf18af1cc, 0x000034ab, 0x826d8274, 0x571b9670, 0xaf83afbb, 0x000089c8,
+        0xdc98dc27, 0xb9ccd635, 0x3ab03abe, 0x000038a4, 0x6f696fa8, 0x87c8f757, 0x32623261, 0x00006a96, 0xa254a2ae, 0xe1a3f6db, 0xd20dd2d9, 0x0000b4a8,
+        0x18ba1827, 0xb89a2cf4, 0x070f0759, 0x000008cf, 0x17c517bf, 0x972d019c, 0x93c393a8, 0x00005f65, 0xf5cff571, 0x8b981b2e, 0x6f126f5f, 0x00004b37,
+        0x0fa00f73, 0xe562c643, 0x5ef75eb9, 0x000083a2, 0xc8f5c83d, 0x619cb61f, 0x61506188, 0x0000d0b9, 0xee14ee98, 0xd0b4cfa9, 0xf0baf086, 0x0000f4db,
+        0xd2f1d252, 0x97be24d4, 0x5dbb5d9b, 0x0000bc6f, 0x840984fb, 0x68a0c64e, 0xc653c652, 0x000067af, 0xc937c9f8, 0x5e1dafa2, 0x4e184e30, 0x00000e6f,
+        0x0f640f02, 0x406fab02, 0x5312536a, 0x0000c9f4, 0x9f629f8b, 0xd8b05472, 0x7898782d, 0x000062af, 0x4a3b4a52, 0x1e059ad4, 0x528d524e, 0x00006a9f,
+        0x4353434b, 0x88277616, 0xce07cef1, 0x0000ad99, 0xf511f562, 0x12354633, 0xbeacbe59, 0x00003009, 0x03be0300, 0x73f4eacc, 0x585f58b1, 0x0000b77c,
+        0xd9b2d985, 0x610ccaaf, 0x3f623ffd, 0x00007a0f, 0x777d7747, 0x281f1aaa, 0x6bda6b28, 0x0000be10, 0x7d2e7d03, 0xaca13652, 0xee6feecc, 0x000029ba,
+        0x1a051ab5, 0x75495f13, 0xb1b2b175, 0x00003a1e, 0x8b2f8bb2, 0x41296cf4, 0xaa0baafd, 0x00004f40, 0x3a233ae7, 0xb57f0bd7, 0xd5b7d59d, 0x0000869d,
+        0x8642863d, 0xf600ff06, 0xd66ad640, 0x0000bac6, 0xfcf9fc9f, 0xb7588070, 0x963896de, 0x0000b549, 0xdf31df0e, 0x1b73f157, 0x08f80866, 0x0000a914,
+        0xc294c2f5, 0x032b53e3, 0x58bd58f5, 0x0000d3eb, 0xdd2bdd70, 0x3676a12d, 0xa26fa2db, 0x0000c36d, 0xdaa4dae2, 0x9d2c7cc4, 0x43b44357, 0x0000b4ca,
+        0x8c838c28, 0x8aa41447, 0xdc65dca4, 0x000098c8, 0xbd2fbdce, 0x036cb522, 0x0a020a9d, 0x00007b72, 0x3db03dc3, 0x165530a3, 0x47d74774, 0x0000e6f5,
+        0x48c748ec, 0x6b222e44, 0x05280553, 0x0000d066, 0xf33bf346, 0x4a39f6d4, 0x32e13271, 0x0000455a, 0x9b0e9b3d, 0xa811e831, 0x34703478, 0x0000ba91,
+        0xbdacbdc7, 0x05e6ab03, 0x9be99bbe, 0x00002357, 0xe0b7e043, 0xae2e74e4, 0xf10af1d7, 0x00004011, 0xc6eec699, 0x366e0741, 0x94a894c4, 0x00009708,
+        0xdcf2dcea, 0xbc2a40c2, 0x2af02a1a, 0x000018e3, 0xd90ad981, 0x255a7051, 0x30a930e3, 0x0000fe1d, 0x2e122ef1, 0x3c1827eb, 0x97b09780, 0x0000cb34,
+        0x7cae7c1f, 0x6a1cbaf6, 0xb09ab0a3, 0x000081dd, 0xc12bc100, 0x4a8693c1, 0x45244534, 0x0000bcff, 0x973c97cb, 0xe4c158a2, 0xfd99fd20, 0x00001c14,
+        0xfee5fec4, 0xef314aa9, 0x434843f6, 0x0000a455, 0xd2acd270, 0xb03836ad, 0x5fc55f87, 0x0000968a, 0x71c57126, 0x20acdd6d, 0x36133688, 0x000001a0,
+        0x496949d2, 0x4a68c5a8, 0xdab1dadd, 0x00002797, 0xad1ead72, 0x6dc03cf0, 0xbbe7bbfd, 0x0000b0cd, 0xa2e2a28f, 0x05f56545, 0x028102af, 0x0000ec94,
+        0x06a206de, 0x1b0576a9, 0x8a4e8a39, 0x00000a2c, 0x64326430, 0xbf4b27d4, 0x484e484c, 0x0000413f, 0x3c153c3c, 0xa7c227ee, 0x878b8755, 0x00006736,
+        0x2a862a95, 0xd66eab7c, 0xe175e198, 0x0000e2e2, 0xe8b3e8ef, 0x4886e0bc, 0x3a3d3a5d, 0x00001317, 0xc795c762, 0x3f0234df, 0xd0d2d0db, 0x00004b9b,
+        0x41f54184, 0x3e63dba5, 0x3d143d47, 0x0000b891, 0xe1f7e133, 0x0ad6ca18, 0xbf9dbfda, 0x00006bf0, 0xee13ee55, 0x1a4e6e57, 0x1c4d1ccd, 0x0000d1c3,
+        0xf5d0f583, 0x1a2fc074, 0xcd1dcd29, 0x0000e692, 0xcdc4cd32, 0xc91db9f7, 0xe4b5e440, 0x000034dc, 0x1d1a1d5c, 0x024487cf, 0xc4a6c440, 0x00001f51,
+        0x5afc5a1f, 0xce85b815, 0xa4a6a455, 0x0000d153, 0xebeceb4e, 0x71708697, 0x1b5a1bdf, 0x00000e5d, 0x522a522d, 0x0b0a21f4, 0x1a2c1a67, 0x00008171,
+        0x9fd69f5e, 0x3c6590ca, 0x5f985fe8, 0x0000b66b, 0xd95dd922, 0x5677ffb5, 0xe1ade17d, 0x000035ad, 0x09e209e6, 0x4ef6e53b, 0xdb95db20, 0x00004711,
+        0xadfbad3f, 0x77121e9c, 0x7247725e, 0x0000a465, 0xd9add945, 0x4e0b4daf, 0x2e502e5d, 0x0000fdec, 0x436a4335, 0x5ea7d69e, 0x5f975f64, 0x00008060,
+        0xa8a2a864, 0xcbecc6df, 0x5d3a5dbb, 0x000057a7, 0xcec3ce4b, 0x9da6957e, 0x86a0868c, 0x0000b213, 0x9b099b3c, 0x2c221852, 0x6711673b, 0x000095a9,
+        0x1bfd1b68, 0xb257d2c8, 0x7a297a24, 0x00005de5, 0x73b573c1, 0x24784b25, 0xe23ce27a, 0x000042e7, 0x66bb6602, 0xdae49c1d, 0xf1acf1e2, 0x0000f963,
+        0x5f0f5fa0, 0x9ecad504, 0x66e266a3, 0x00009f0e, 0xaee1aeb9, 0xe6c03f30, 0xd937d92f, 0x00007ffe, 0xf92af9c4, 0x78d9b23f, 0xf78ff7c7, 0x00006730,
+        0x8ec58eee, 0x4bc9bee2, 0x5ec65e79, 0x0000b741, 0xc3bdc3aa, 0xd55f1edb, 0x71a471c7, 0x000069b6, 0x1b471b20, 0x1dd400f7, 0x319d31f7, 0x0000df88,
+        0x401b408b, 0x3619c4fb, 0xdd9add20, 0x0000b4d7, 0x122d1286, 0x10da65da, 0x0dee0dfe, 0x00001c0c, 0x1c551c5b, 0x2bc0a9ce, 0xeb8debe4, 0x0000e552,
+        0xf5cef529, 0x1d39e5cc, 0x5eba5ef5, 0x00006ebd, 0x310031ed, 0xde31d624, 0x3c173c68, 0x0000d74b, 0xd522d59f, 0x3d19d5fb, 0xce6ace79, 0x0000c5f2,
+        0xe0d3e0fb, 0x3f024b63, 0xd03ed047, 0x00003912, 0x5bc45b32, 0x1a4e0c27, 0x415c4150, 0x0000e7ef, 0x5f5f5f7d, 0xb3f0e002, 0xb9e4b9f6, 0x00007513,
+        0xc5b7c565, 0xf96f78a0, 0x558055ac, 0x00001eac, 0xb409b4f7, 0xc7966a30, 0xc647c6c8, 0x00007444, 0xe0cbe001, 0xd33c20eb, 0x282d288b, 0x0000ed89,
+        0xf58df51c, 0xcce5464d, 0x40544028, 0x0000b783, 0xaa0daa90, 0x1d4585d0, 0x017e0199, 0x00007c7d, 0xeea2ee19, 0xb3133418, 0x82ac8297, 0x0000c01f,
+        0x88aa88ec, 0x96ca0ad4, 0xfebbfe00, 0x00003552, 0xcbf9cb96, 0x3548de53, 0x6ca76cef, 0x0000810e, 0xb214b2bc, 0x4319c2dc, 0x0e3b0e9e, 0x00009e8a,
+        0xde91de99, 0x998ce4dd, 0x0df70dc3, 0x0000c013, 0x812d813b, 0x2e5d5770, 0x1b8b1b0a, 0x0000e6f4, 0xd600d633, 0xf4c2824c, 0xc2efc21b, 0x00001755,
+        0xbfe7bf29, 0xb264d32c, 0xf6eff65d, 0x0000fbec, 0xec14ec26, 0xf118adbb, 0x685e6880, 0x0000a808, 0xa825a8bd, 0x7eeb216f, 0x7a547aa4, 0x0000a66e,
+        0x19f41923, 0x32ffb715, 0xa227a2fd, 0x0000f51d, 0x3cd13c82, 0x6a50adc3, 0x66cd666f, 0x0000c9ab, 0x5ec25ec5, 0x40649707, 0xeb6ceb1d, 0x00000ec0,
+        0xb938b9df, 0x3d9a392f, 0xedb2ed6c, 0x00001c88, 0x5aef5a6e, 0x86284956, 0x0cfe0cd5, 0x00001188, 0xbbd9bb3c, 0xbb2472ae, 0x8b1e8b47, 0x000044ed,
+        0xa1b4a107, 0x00d8bb96, 0xa41ca40a, 0x000043cf, 0x93d793d5, 0x25203460, 0xfd2bfd29, 0x0000031b, 0x53ff530f, 0x304e95be, 0xc914c92d, 0x0000d7bb,
+        0xe076e04b, 0xa90dc1fd, 0x1f861fc8, 0x00007860, 0x3f8f3f40, 0xd69ea260, 0xe5e6e57a, 0x000003fa, 0xc28fc269, 0xb6714e35, 0x69ae6930, 0x00000392,
+        0xf3a5f3af, 0xfcb626ac, 0xc16cc164, 0x0000c16d, 0x842e8493, 0xc4b548df, 0x3fa83f93, 0x00007ea2, 0x749774be, 0xb3036600, 0x4e754e84, 0x0000be2f,
+        0x8f1e8fd3, 0x48893dce, 0x203320ad, 0x0000b701, 0x41fb4120, 0x9cbe143e, 0xef12efce, 0x0000065d, 0x6bcc6bb7, 0x86c139ed, 0xbee5be90, 0x0000d1c3,
+        0x03e4036e, 0x5daf2df9, 0x9f2f9f4e, 0x0000d967, 0x48ab48ed, 0x54a7a3db, 0x5f3f5f34, 0x00006a8b, 0x50485087, 0xdec4a05f, 0xd2a7d23b, 0x0000cd34,
+        0x1a031a5c, 0xef8135ad, 0x95ae95c1, 0x000084ff, 0xe8bfe890, 0xdae6e7a2, 0x040304c3, 0x0000e9d4, 0x5bf25bb7, 0xe3a24533, 0xba83ba69, 0x000022b7,
+        0xcbdccbfb, 0x731a6d1b, 0x7c527c30, 0x00000633, 0xb099b056, 0xa87a2874, 0xa431a4a2, 0x00006c96, 0xd47dd4e6, 0x21f3fcbd, 0x61f2612d, 0x0000b743,
+        0x201b204b, 0x6fbf39ff, 0xa08ea032, 0x0000459d, 0x4e4d4e38, 0x6842c5e7, 0x0e140ed1, 0x00003552, 0x429b4285, 0xe052ee4f, 0xbc7ebc26, 0x0000c78f,
+        0x06cf060c, 0x5192dfd8, 0xe85ee8d8, 0x0000ff5c, 0xb823b858, 0x495f9033, 0x1c641c08, 0x0000e54d, 0x1eb71ec7, 0x5b867917, 0xc95dc9c9, 0x00000562,
+        0x49d24917, 0x0a2b515c, 0x491a4959, 0x0000c4e4, 0x0ad40ad1, 0xb1dc4aa0, 0xb570b5b7, 0x0000cf8d, 0x76a976d8, 0x7ca2b358, 0x4c7d4cd4, 0x00001d14,
+        0x68ac6867, 0x655a5ba8, 0x876287d0, 0x000050d8, 0x517651d5, 0x1f4c3cd1, 0xe6cde60e, 0x00006435, 0x4c6d4ca4, 0x81c80ed9, 0xd119d1d4, 0x0000424f,
+        0x02700253, 0x5a3f98ff, 0xe1f8e141, 0x0000f7c1, 0x1fa71fe4, 0x5878ac0b, 0xec5fecbe, 0x000093e0, 0x803c8018, 0xdb2e5111, 0xca1bca50, 0x000042b2,
+        0x85178573, 0x7114140a, 0xa8f2a81d, 0x00006a5c, 0xb269b27c, 0x7e2d7e2e, 0x9ace9a77, 0x00006687, 0x66176682, 0xa0a1fa57, 0xdc58dc1e, 0x0000bd2e,
+        0x1725173e, 0x80a49b2a, 0xf57df57a, 0x00003b4c, 0x8dff8de5, 0x9d5a9eca, 0xb367b325, 0x000015e9, 0xf8c9f83d, 0x8c88b6ea, 0xf67cf6b7, 0x0000a808,
+        0x5c035c17, 0x7fb9ff3f, 0x0aac0acb, 0x00007a72, 0xb1e4b181, 0xe581e4dd, 0x4e104ef1, 0x0000a377, 0xce42ce39, 0xd711b56d, 0x7d2f7d02, 0x000022b6,
+        0x4bad4bfc, 0xae0f808c, 0x68b96898, 0x00007cae, 0x8c248c90, 0xf036c0dc, 0xe58fe5b7, 0x00002895, 0x8fe88f15, 0x52a9dde3, 0x259325ae, 0x0000fc7e,
+        0xdac1da56, 0xd08d38ce, 0x087408d0, 0x000057c4, 0x13b01382, 0x4eb74c22, 0x56a55657, 0x0000f21d, 0xdeebdeea, 0x6dcdb1a4, 0xad33ada9, 0x00002313,
+        0x549654bd, 0x69dfac98, 0x49474942, 0x0000b632, 0x1b021b68, 0x57a7710e, 0x70be70da, 0x000093b7, 0xd6b2d613, 0x3d9a07b8, 0xa327a3c7, 0x00002f9b,
+        0xdff9df1c, 0xe2c188e5, 0x4ec94eca, 0x000094bd, 0x66ca660d, 0xe41340d2, 0x8b098b35, 0x00005f1f, 0x2bd52ba5, 0x4f26eb80, 0xa8e2a8a0, 0x000053d8,
+        0x3b623b5a, 0x97283ff1, 0x96499668, 0x000041b9, 0x173d17d5, 0x6dcd14c6, 0xd61ed602, 0x00006ea1, 0x97b397a3, 0xe24391b1, 0x622962f1, 0x00005965,
+        0xaf30af22, 0xa2927518, 0x7d477da1, 0x0000c512, 0xfecafe62, 0x3c988999, 0xd37dd398, 0x00001670, 0x8f328f5f, 0xc0f5b286, 0x66376617, 0x0000bbf1,
+        0xad9ead74, 0x2531e212, 0x34ae34a7, 0x00001f3c, 0xd454d457, 0x8088d734, 0x993e997d, 0x00001a32, 0x6f376f6d, 0x0c4d325e, 0x6591653c, 0x00005f75,
+        0x712671e8, 0xe61e8c5e, 0x00640089, 0x0000049e, 0x5b1c5bb6, 0xff4ce5a2, 0x2edb2ead, 0x0000aad4, 0x0c850cf2, 0xd03a7e43, 0x5b225bef, 0x0000790f,
+        0x3a5a3a24, 0xa9110eca, 0xf480f453, 0x0000da67, 0x2a582a9f, 0x94d9fdb8, 0x420e4294, 0x00006430, 0x65d265d3, 0x238261d5, 0x66af66c8, 0x0000c112,
+        0xa615a67a, 0xd5695680, 0x5e925ed4, 0x000093b6, 0x8e048e93, 0x78a2aeb4, 0x126a12e1, 0x0000a4e9, 0xb95cb962, 0x42c5bcb6, 0x22072294, 0x0000d3d7,
+        0x0e2e0e3f, 0x97d94baa, 0x5c685ca8, 0x000001fd, 0x113811aa, 0x7d985533, 0x822c82ab, 0x0000998a, 0xb63bb651, 0xbf6c91e5, 0x73ad7364, 0x0000aca7,
+        0xc538c5fc, 0x87139ead, 0x4580453a, 0x0000ace9, 0x3bcc3b17, 0xf3f41436, 0xd0acd0a8, 0x0000cc6d, 0x3072303c, 0xef79cbd1, 0x616f61a7, 0x00000de6,
+        0xd10fd171, 0xba4f9778, 0xc8efc8fc, 0x0000475d, 0x8beb8b12, 0xdbefa944, 0x9f139f23, 0x00000ec0, 0xa6baa65b, 0xda6b7d19, 0x87a087b8, 0x00005c76,
+        0xa5faa5d8, 0x5150f93a, 0x10d41075, 0x00003a64, 0xefeaef2d, 0x5356d5f5, 0x3f833f00, 0x00009043, 0x20102095, 0x8c0fc1e8, 0x76bc76ff, 0x0000d5e7,
+        0xbd6dbd64, 0x8fa7ced1, 0xa41aa430, 0x0000cea1, 0x60f0606f, 0xd82be213, 0x2aef2ad0, 0x0000d6a5, 0x08c20863, 0x260f710e, 0xf7dcf79d, 0x0000f5f0,
+        0x3af93a7e, 0xdc8eb69d, 0x4a4f4aeb, 0x0000d8f4, 0x054a050a, 0x23f38fda, 0xbad8ba2c, 0x000084a3, 0x5418548f, 0xe831417a, 0xeed9ee6d, 0x00004ff3,
+        0xa488a4a3, 0xf8281778, 0x8e548e38, 0x0000488f, 0xaa0baa11, 0x9ad3f45a, 0xaeadaee9, 0x00000cec, 0xfcbafcd2, 0xc71dcf2d, 0x673f67c6, 0x0000b700,
+        0xa1e3a18c, 0x43785fae, 0x6b936b76, 0x00004912, 0xe786e7bc, 0x8b451642, 0x8d8a8d5d, 0x0000899b, 0xd39ed337, 0xf8aaf0e8, 0x36b53614, 0x000092d4,
+        0xbe3abe57, 0x7970b935, 0xb6fcb6b5, 0x00005ce9, 0x85578575, 0x0868f6de, 0xb1a8b1a3, 0x00006046, 0xd13ed14d, 0x4905834c, 0xa797a7a4, 0x0000cd10,
+        0xc126c143, 0xec4225aa, 0x2c2b2c59, 0x00000600, 0x24152419, 0xf400467a, 0xe5b8e568, 0x00003f11, 0x93b5933e, 0x00341bd0, 0xb268b232, 0x000063aa,
+        0x5ce55cd8, 0xc7141893, 0x51945125, 0x000052c8, 0xb2dbb20a, 0x289cfe0e, 0xa7ffa756, 0x0000f5c1, 0xeac9ea51, 0x7f01d9a5, 0xef3fef35, 0x00008967,
+        0x51ab51f3, 0x708a924a, 0x3f6b3f99, 0x00007930, 0xb6b4b6d3, 0xb9cc7453, 0x5000502c, 0x0000de8f, 0x3c833c09, 0x37764a9f, 0xa700a799, 0x000056a6,
+        0x032c038e, 0x453740c3, 0xe7b3e701, 0x0000c841, 0xd202d2fb, 0xed00b0a5, 0x665666bc, 0x0000c3ec, 0x3a7b3a95, 0xe7c1cca8, 0x154015b1, 0x00005484,
+        0x75387520, 0x411b0edb, 0x38f638b0, 0x0000e58a, 0xa11da1b6, 0x1593b364, 0xdae2da38, 0x0000f588, 0x597e59ac, 0x172d4dad, 0x27a22705, 0x0000d659,
+        0xe8ece89b, 0xb9d2fe7c, 0x15e21504, 0x00006108, 0x6c526c6d, 0x3460ee42, 0xa869a8bc, 0x000025ea, 0x836f832e, 0x61ef7253, 0x7b4a7b5e, 0x0000ac4b,
+        0xa78ea731, 0xcfdd88ef, 0x4a1a4a9d, 0x0000ca81, 0x562556d0, 0x80a10349, 0x2fac2f40, 0x00006a36, 0xf8fbf86d, 0x954f6d6b, 0xc369c38a, 0x0000ca0e,
+        0x07c607d1, 0x281f85f0, 0x1bfa1bed, 0x0000be11, 0xd311d301, 0x4f2e2262, 0xedf1edfa, 0x0000c5b8, 0xf4aef4be, 0x004a7068, 0x916f9109, 0x00004847,
+        0xc4bbc491, 0xf8183123, 0xe4bae4f7, 0x0000a355, 0x146d1412, 0xe162a5d4, 0x53b25355, 0x00003a61, 0xf0a3f06c, 0x5c752657, 0xeb03eb20, 0x0000a095,
+        0xe878e815, 0x1ca5c6be, 0x3265326d, 0x00006000, 0x5e375e36, 0x11b13a31, 0xbff8bf6a, 0x0000a411, 0x34a4348f, 0xafa0c6f7, 0x640d6484, 0x0000d77a,
+        0x1eba1e42, 0xf30b7fdd, 0x8b618bbc, 0x000050a7, 0x29dd2975, 0xe1c0d70c, 0x0345032d, 0x00003f13, 0x47964710, 0xe852a1a2, 0xd8a4d89f, 0x0000e8e9,
+        0x333633b5, 0xa80d9e27, 0x663e66b7, 0x000013ab, 0x67d9679f, 0x2f8c548d, 0xd0fcd0a1, 0x0000ca83, 0x16ec16a7, 0xb1ae7ac0, 0xefafef02, 0x0000e8b7,
+        0xd89bd823, 0x8f65843e, 0xe208e262, 0x00007b21, 0x5ecb5e4a, 0x4b071bae, 0x19e919a0, 0x00005539, 0x9f659f7a, 0x66d0c8e3, 0x2a532a03, 0x000074b0,
+        0x30e2307e, 0x44c47830, 0x63a7636a, 0x00000f80, 0x350d3557, 0x815713e7, 0x42e2425b, 0x000021d4, 0x3ccb3ce6, 0x5a8230ce, 0xccf4ccf4, 0x00006b15,
+        0x8d9b8db6, 0xaa0271a8, 0x0a6b0aee, 0x000073fb, 0xbb40bbe4, 0x3848e039, 0x6aa36a25, 0x00008a3e, 0xea06eac7, 0x904ce16a, 0x2a612a94, 0x00006914,
+        0x9c1b9caf, 0x36b7ab00, 0x7ef97ef4, 0x000071bf, 0xd80ad81f, 0xb86c67db, 0x211d2172, 0x0000aa08, 0xfd72fd3c, 0x0834bb18, 0x56a65616, 0x000079cf,
+        0x593f5913, 0xc3b07e45, 0x5b4c5b51, 0x0000eadc, 0xeb81eb3c, 0x75123419, 0x43524365, 0x0000ee5d, 0x111211a2, 0x704a9339, 0x30c5308a, 0x00000500,
+        0xf8ccf8d8, 0xca125c5c, 0x12fd12a9, 0x0000735e, 0xec2aec2a, 0x2f1f25ab, 0x1b991b40, 0x000024b9, 0xfd3ffdd9, 0x9f571390, 0xfd5dfd7c, 0x0000201a,
+        0x75db75a6, 0xe252d8a5, 0x310f31e8, 0x0000687f, 0xf31af3f4, 0xc90d47e6, 0x0c2d0cd7, 0x0000e552, 0x31b63171, 0x0995fd47, 0x724272e0, 0x0000e693,
+        0x23312330, 0x9c46b5ba, 0x0b120b75, 0x0000a491, 0x0570058f, 0x635a0929, 0x10c71088, 0x000063e1, 0x0c2c0c8e, 0x0ae22b3d, 0xc175c1cc, 0x000087b9,
+        0x15c815c0, 0x366bc63e, 0xcb52cb2e, 0x00006b8b, 0x1c511c9d, 0x3daf19d0, 0x2f7b2f19, 0x00005194, 0x42cc4209, 0xed795bcd, 0xaebeaeda, 0x00001b45,
+        0xe304e3bc, 0x33cc1b52, 0x166916c5, 0x00007360, 0x61786157, 0x03f42494, 0xc177c1e3, 0x0000eec3, 0xe5a5e52f, 0xa6de4386, 0xc556c56a, 0x0000f5f1,
+        0x5ed75e33, 0x5bf8f8da, 0x06d00618, 0x0000874f, 0xcfabcf50, 0x59ddbb3a, 0x1ebe1e94, 0x0000054d, 0x1a171a5d, 0xf2aee866, 0x7c167c8e, 0x00008f1e,
+        0x99a8994f, 0x687fe5ab, 0x3e023e09, 0x0000f88c, 0xc43fc484, 0x50e7d1f6, 0xa46fa430, 0x0000cf29, 0x421342ce, 0x6a40712f, 0xd97fd9dc, 0x0000442d,
+        0x380b386a, 0x10551dae, 0x2c3f2c3a, 0x00007d4e, 0x7853789f, 0x1a4c0b30, 0xcd94cd9d, 0x0000dee0, 0x196e1949, 0xca645cd6, 0x81dc818b, 0x0000e2ad,
+        0x59f859c3, 0xd405b398, 0x914d9136, 0x0000a46e, 0xaee8aebe, 0xf56e0d59, 0x547854aa, 0x00001d3d, 0xcd7ccdd6, 0xf5a25e5c, 0x02c2028c, 0x00000f83,
+        0x8769878f, 0xa3a1824e, 0x9cce9c6b, 0x00004410, 0x6ad86a56, 0xd824f6b2, 0x84ad84a1, 0x0000cd8d, 0xfe44fee7, 0x2863cf2d, 0xa71fa767, 0x0000131a,
+        0x427442dc, 0x4609fec5, 0xaa4daa31, 0x0000b891, 0xd3a9d387, 0x88a440b9, 0x39af396e, 0x00002bc2, 0x4ce64cee, 0x017dcd6e, 0x8f228fe0, 0x00001b85,
+        0xd729d7c2, 0x91dc9ed7, 0x7df47dcb, 0x0000c4b2, 0x880688bc, 0x8c863a10, 0xcb37cbfd, 0x0000fffd, 0xd4fcd460, 0x8e38eb4c, 0x27242732, 0x000012e9,
+        0xad33ad84, 0x42c50361, 0x4dda4deb, 0x00007bdf, 0xefafef54, 0xa0f185f3, 0xf044f0cc, 0x00007672, 0x32f5321f, 0xe6e1b7d6, 0x20fe205a, 0x000015ba,
+        0x670367ce, 0xa883186a, 0x4c0b4ca8, 0x0000cdf0, 0x9e349e77, 0x69eaf8c2, 0x9954999b, 0x00006c15, 0x1a3d1ae7, 0x1fc893b1, 0x6a4a6abc, 0x0000c490,
+        0xad38ad61, 0x43b99db1, 0x6efc6e18, 0x000045bb, 0xa342a38a, 0x00eaa93e, 0xbe67bea7, 0x000037f0, 0x574e5771, 0x44851222, 0x73487386, 0x000058cd,
+        0xd701d740, 0x918e363f, 0x7caf7c1d, 0x00009008, 0x991e99fd, 0x66d21d2f, 0x7da57dcb, 0x00006c21, 0xd8a2d8e5, 0x0a344c29, 0xe781e7d2, 0x00008872,
+        0x93f79372, 0x2ec3828d, 0x111111a7, 0x0000c532, 0xf1d5f1fb, 0x716297c5, 0x834c8322, 0x00005208, 0x14ac1407, 0xb154f26e, 0x5a035a82, 0x00008460,
+        0x31fa3141, 0x38ab365f, 0x2e402e7a, 0x0000b0f2, 0xdee9de9d, 0x6cc27f79, 0x04620430, 0x0000c74d, 0x085308ed, 0x4ef6c6b5, 0x0081002b, 0x00006faf,
+        0x93009374, 0x3cc65aa3, 0x74767420, 0x0000de18, 0xaa97aa64, 0x346f81f0, 0x394c3933, 0x00001f2f, 0xa060a0a3, 0x3e481502, 0x124e12d2, 0x0000e032,
+        0x4ae64a39, 0xe8d3f5dd, 0x870d879b, 0x000077b1, 0xd963d911, 0x3ffb7cbb, 0xe593e5eb, 0x00001549, 0xa7d7a792, 0x716f523c, 0x76a67671, 0x00001614,
+        0x16691669, 0xf7461740, 0x31e331a2, 0x00001e2a, 0xe53be526, 0x3ff4a614, 0x02cd02cf, 0x00001d28, 0x8a978a28, 0x3f711135, 0x0de00db4, 0x0000004c,
+        0x6c346c1f, 0x68407d84, 0x014701ed, 0x0000eb16, 0x89c7893f, 0x7712e180, 0xde1eded0, 0x00007c60, 0x322a32cf, 0x94e942fd, 0xdaa7da2a, 0x0000fe9f,
+        0x76f07672, 0x218279a8, 0x1d041d2e, 0x000086be, 0x3d623db1, 0xa6ded136, 0xb9cbb9f0, 0x0000fb7e, 0xd2d1d288, 0x32196d10, 0x4cf64c07, 0x0000d996,
+        0x90099087, 0x1815aefc, 0xb7b4b78b, 0x0000d62d, 0x83e883ce, 0xf01826d2, 0x6e066e48, 0x00009ce0, 0xf6eff659, 0x6ce3521d, 0xca6bcab3, 0x00000292,
+        0x01600183, 0xaa33b8d8, 0xa76aa718, 0x00002f4b, 0x3962391c, 0x2380d2cb, 0x58fa58f9, 0x00009d90, 0xf11bf192, 0x012b3d80, 0x66cc66d9, 0x0000ba4e,
+        0x430743c4, 0x805a7622, 0xf53ef58a, 0x00004b3b, 0xb688b612, 0xc967601f, 0x7c787c74, 0x0000541f, 0x33f4331f, 0xcac46cf5, 0xc744c7ae, 0x00006dff,
+        0x90179086, 0x3aa29038, 0xa37ba330, 0x0000e5ad, 0xceeace09, 0xf45689e0, 0xb427b4b6, 0x0000362c, 0x618161d6, 0x5142a82f, 0x997d99b5, 0x0000d176,
+        0x21752126, 0xadc29bf8, 0x906e90ab, 0x0000d23a, 0x6a906a7d, 0xf5bf77d9, 0x9d109d2e, 0x00009ae0, 0xad4ead9d, 0x52a70ed9, 0x562956ee, 0x0000f254,
+        0x21942159, 0x20d0af88, 0x182a18ae, 0x0000b84e, 0x4fca4feb, 0x1dd5103d, 0x3722374b, 0x0000e015, 0x6aca6ad4, 0x9977a52d, 0xd718d7a9, 0x00003283,
+        0xcc2ccc72, 0x9a074de9, 0xfa34fab2, 0x0000c907, 0x893a89f3, 0x5c2dd7a3, 0x1817180e, 0x0000bdee, 0x239c2336, 0xf3cff64c, 0x6b5f6ba6, 0x00003ed3,
+        0x0635065a, 0x5e1d5b51, 0x216821df, 0x0000e545, 0x68366817, 0x366f09d9, 0x72657225, 0x0000454f, 0x265026bd, 0xd9bcea93, 0x81498170, 0x00006fa6,
+        0x43f9437a, 0xa1415e13, 0x89f5895d, 0x00006f35, 0x232423c0, 0x116a8fa1, 0xae38ae8e, 0x0000d7f8, 0x3f5f3fea, 0x74aacd17, 0x767b7630, 0x000015c1,
+        0x7f537f58, 0xb31df9d4, 0x5c065c7e, 0x0000d5ca, 0xeea2ee72, 0x8e67eee2, 0xad4fad25, 0x0000895f, 0xa79aa7c3, 0xd1dbaa87, 0xc5b1c5dd, 0x000017c9,
+        0xdeeede37, 0xf66e5c55, 0x5f705f25, 0x0000e284, 0x428342f1, 0x60ddc068, 0xb5c7b538, 0x000034df, 0x07ce07a0, 0xf364a8c0, 0x18e718ee, 0x00003e13,
+        0x02700289, 0x33ab51cd, 0x1d0b1dd5, 0x0000f6ef, 0x129112c9, 0x40a5f2e8, 0x38623805, 0x00006e5b, 0x182a18f4, 0x825e50d2, 0x32683292, 0x000032b6,
+        0xe3fde330, 0x513ad17c, 0x037203bf, 0x00001c0c, 0x5c665c7c, 0xeef211c4, 0xf0b2f07d, 0x00001f3d, 0xfcd5fcf9, 0x56196195, 0xc59ac56f, 0x0000b5cc,
+        0xa617a634, 0xe661c1f7, 0x98929805, 0x0000ec59, 0xc35bc37b, 0x8a28d67c, 0x3f8f3f0d, 0x0000ee3b, 0x9b619b5d, 0x877e3123, 0x796a7980, 0x0000c68c,
+        0xab18ab9a, 0xd405cc8d, 0x772d770a, 0x00003f11, 0x5b355b4d, 0x077be9b3, 0xd034d0e4, 0x0000a19e, 0x62d062f2, 0x3656758e, 0xff3fff6b, 0x0000289b,
+        0xe011e025, 0x90425953, 0x84be8406, 0x0000bfa0, 0x0a240a7d, 0xaca0d5c4, 0x456f459c, 0x0000aee9, 0x36f036ec, 0x632f5392, 0xb989b95e, 0x0000c98d,
+        0x9c049c7c, 0xaad65ae0, 0x4a324a19, 0x0000b70e, 0xe01de0c5, 0xf94c77d2, 0x7f977fe3, 0x00005b54, 0x3ea23e0c, 0xc4b60e59, 0x4b294b82, 0x0000a1e9,
+        0x0c6b0cc4, 0x3e1f2abf, 0x7d437def, 0x00005d34, 0x2297225b, 0x3e4bc6e3, 0x6b136bfb, 0x000093d5, 0x59a959f5, 0x9e2cbcca, 0xf89ff885, 0x0000206d,
+        0xba33ba90, 0x1dda6cb6, 0xd48ad444, 0x00004d05, 0xd406d407, 0x73daeacc, 0x7fb27f82, 0x00003b6c, 0xd613d67b, 0x1fca44d5, 0xb545b536, 0x00001617,
+        0xe3c3e3a6, 0x4b89d104, 0xf8e1f801, 0x00007360, 0xd127d139, 0x5c9dffb8, 0xf616f677, 0x00005bbd, 0x21e82152, 0xf1a193be, 0xeb0deb12, 0x0000c39e,
+        0x96639658, 0x9b4ea5ed, 0x48dd4872, 0x00008ac3, 0x4c1b4c9b, 0x4ad46948, 0x658765f0, 0x0000cf40, 0xda3bda1f, 0x27304d54, 0xa694a68c, 0x00008d71,
+        0xfcbffcd3, 0xa8810136, 0xf6f3f6a8, 0x0000d4c7, 0x0b1a0b6f, 0xd3363d70, 0x928b9245, 0x0000798a, 0x75c8759c, 0x7325ec32, 0x952095cc, 0x00001aac,
+        0x3faf3fa8, 0x8ff730a5, 0xa3c2a352, 0x0000b3d7, 0x689368d6, 0x73db99e8, 0x2fed2fbf, 0x0000a464, 0x014401ad, 0xb6f7a2db, 0x682268d5, 0x0000dcb7,
+        0x9d989d39, 0x62c3d74b, 0x88518847, 0x0000c60a, 0x3f5d3f26, 0x814935c0, 0x89058989, 0x000070da, 0x5b265b1c, 0x660ccdd3, 0x5ef35ebc, 0x0000f808,
+        0xdba1dbc2, 0xaaccebcd, 0x2ce72c58, 0x0000ce12, 0x170d17f6, 0xfe2198ae, 0x6ee16e84, 0x0000cfac, 0x97199787, 0x4cf6fc3a, 0x1d1e1dbd, 0x0000d4eb,
+        0xf296f28d, 0x0465c344, 0x9204926f, 0x00001e88, 0xee3eee9f, 0xf003f9e7, 0xbf90bf20, 0x00007c02, 0x8b508b66, 0x1d2f8179, 0x6de76dfb, 0x00001ba5,
+        0x52965226, 0xe85217fd, 0xa58da5c9, 0x00006cf4, 0xa3b1a3c0, 0x38c153fc, 0x76b076fe, 0x0000b140, 0x928b924a, 0x82870d5b, 0xddbbdd8a, 0x0000e8be,
+        0xc532c543, 0x86d52fc5, 0x4888485d, 0x0000466e, 0x25182563, 0xb0ce4030, 0x02570202, 0x000044ef, 0xf295f2b2, 0x6651e522, 0x8e728e84, 0x0000c265,
+        0xf5e6f5a7, 0x691c38f2, 0x10da10c2, 0x0000e632, 0xeeabee53, 0x53e785b2, 0x3338334c, 0x0000a1e9, 0xb934b951, 0x1e4eb9c7, 0xf58cf58e, 0x0000f747,
+        0x4f3a4f58, 0xce447369, 0xca48ca86, 0x00006c67, 0x5c065c3b, 0x6a86e022, 0x35c035b6, 0x0000dfdc, 0x509950ff, 0x28169aac, 0x3b5a3bd0, 0x00000d39,
+        0xaf05afca, 0xc4551955, 0xf316f3dd, 0x000066c0, 0x9090908a, 0x835ef031, 0x8e5b8e48, 0x0000c940, 0x42c14282, 0x96833eff, 0x96ea96eb, 0x000058c7,
+        0x17c11773, 0x97d98f20, 0x588858e0, 0x0000a677, 0x7afb7a23, 0x7e5588d0, 0xf4b5f458, 0x00000da0, 0x99ab9948, 0xdeab1367, 0xd55ad56d, 0x0000e469,
+        0x8aa68a6a, 0x8e660e5b, 0x94ac9414, 0x0000c932, 0x099409a5, 0x732a8246, 0x3b313b04, 0x0000608b, 0xeea3eecc, 0x220f77cf, 0xf3ccf388, 0x0000478f,
+        0x5e695ebc, 0xe6c13fb2, 0x2c8e2c48, 0x0000dd1e, 0x1d071d42, 0x6f106e34, 0xee68ee1b, 0x000086ff, 0x223222cf, 0x1d556d9f, 0x03a803b0, 0x00005484,
+        0x91fe91a4, 0x99752754, 0x43374397, 0x0000b937, 0x579a5702, 0xbbd3b0dc, 0x7ba97b45, 0x0000455a, 0x20042006, 0x9bc93df2, 0x133d13b0, 0x00008a45,
+        0x5f7d5f22, 0xae51ce90, 0x12941299, 0x00009c00, 0x99209983, 0xe7bd6ba3, 0xd94dd9f1, 0x0000c9e7, 0xc263c2ca, 0x348d454f, 0x36503613, 0x00003913,
+        0x8ddc8d88, 0x17dad0c0, 0x5901597e, 0x000076aa, 0x46004681, 0xa9fc7949, 0x33a433e1, 0x00000b63, 0x23dc2353, 0xea5bc171, 0xe2e6e27d, 0x0000d62d,
+        0xd80bd81b, 0xd692e722, 0xf0a7f076, 0x000091d4, 0xebddebfb, 0xa0fc925a, 0x868e863d, 0x000020f4, 0x8b098b10, 0x303c124a, 0x9dbb9d12, 0x00007a43,
+        0x112911a8, 0xe1213ccd, 0x4b7e4bd6, 0x00001588, 0xfa39fabc, 0x52e78d07, 0x6fab6f0d, 0x00003c6c, 0x5b5e5baf, 0xc8b959dc, 0xdc4ddc8a, 0x000032b4,
+        0x11f0113a, 0x2bc02060, 0x9efe9e22, 0x0000479d, 0x8fde8fc9, 0x34aaf0c2, 0xf417f431, 0x0000606a, 0xabd6ab21, 0x4df60669, 0x3e0a3e36, 0x000096de,
+        0x48224800, 0xf160e65d, 0x9647961a, 0x000014bf, 0x05e40509, 0x6f8fe8fc, 0x39593911, 0x0000cb10, 0x4b194b12, 0xedf18921, 0x743d74c0, 0x0000b1c5,
+        0x0f470f2a, 0x36aae26b, 0x4d074d44, 0x0000106b, 0x33d7332e, 0xb72a9007, 0x8f568f05, 0x0000ab2c, 0x5ba55b5f, 0xb258c1f5, 0xc674c6eb, 0x0000d5c9,
+        0xc3f8c397, 0x716dfd3b, 0xf807f836, 0x00003240, 0xbfe9bf94, 0x2e304db7, 0x84ac8408, 0x0000d758, 0x781678fe, 0x97263411, 0xf247f2b5, 0x00008a50,
+        0x60f46076, 0x45f741bd, 0x677a671b, 0x00002f3a, 0x95af9513, 0x238c783d, 0xb47cb426, 0x000060d0, 0x858585d7, 0x02261614, 0xcd84cdfd, 0x0000ff63,
+        0xd0e0d068, 0x620c0106, 0x11e411e6, 0x0000c63c, 0x3a853ad5, 0x48e6af54, 0x508250ad, 0x00000364, 0x2b152bbc, 0x911c06c2, 0x24ad248f, 0x00004611,
+        0x4c294c13, 0x6d1ce423, 0xa14ca1ad, 0x0000b37c, 0x938c935d, 0x012c9fca, 0x06bb0606, 0x0000438f, 0x84f5841d, 0xc8c768c8, 0x668c668a, 0x000057a6,
+        0x21452170, 0xc5e27866, 0xe67ae648, 0x00008c69, 0x315f3183, 0x95d9adc3, 0x3d163d81, 0x000036d4, 0xe913e9b6, 0x9f90cb68, 0x956895a4, 0x00007dc6,
+        0xbe50be96, 0x8fc6e02d, 0x43be43a3, 0x00005cb0, 0xe792e746, 0x3a5bcd53, 0xdf49dfef, 0x000095a7, 0x54525457, 0x93063269, 0xeaa6ea68, 0x00000be2,
+        0xf0a3f0f9, 0x5c56bc37, 0xfd2efd67, 0x000020c5, 0x0206026e, 0x8788442a, 0x37d537c8, 0x0000f0ec, 0xa040a08c, 0x1be0e71c, 0x5c765cc6, 0x0000eccb,
+        0x027102cf, 0xa1bedfe5, 0x202c20da, 0x0000742e, 0x47324797, 0xdc7d00b4, 0x25ec25b8, 0x0000889b, 0x6d8a6d6e, 0x2ebdd9f1, 0x37a03746, 0x000001ff,
+        0xff53ff26, 0xafb33780, 0x407140b9, 0x00002f21, 0xbeafbe4e, 0x5c756598, 0xc6b5c6db, 0x00002556, 0xd9b5d98e, 0x12f92199, 0x1ac01a18, 0x000004e0,
+        0x03e50338, 0x2178e2fd, 0x707e70b1, 0x00009b6b, 0xbf4abfec, 0x867563aa, 0xaeb9ae72, 0x0000cbab, 0x8dcf8d4e, 0x5d889232, 0x50455078, 0x00009cd1,
+        0x1e381efd, 0x1f3afdc2, 0x94ad94ca, 0x0000f26b, 0x8a3f8a29, 0x4b26a365, 0x713971b4, 0x0000de86, 0x18e118d9, 0xe6c1eeb3, 0x5905599d, 0x0000bc10,
+        0x08b30829, 0x12fc9dae, 0x654e65e2, 0x0000d348, 0x037c0335, 0x5f6bcf05, 0x3b823b0a, 0x0000e926, 0x8a178a62, 0xa019cd2e, 0xc9c4c94e, 0x00005e91,
+        0x56e556c7, 0x31e68000, 0xc0fec0aa, 0x0000cd7d, 0x85fe85de, 0x847e362f, 0xf475f46e, 0x0000a5e9, 0x728a7246, 0xc43a46f8, 0x93c4939e, 0x0000faad,
+        0x28e028be, 0x2cdd80b1, 0x004000e8, 0x0000965b, 0x083e0817, 0xefd1c27f, 0xcad0ca39, 0x0000d0fb, 0xcae1ca3c, 0xc8275b73, 0xe4f1e4be, 0x00009bd1,
+        0x245a24b1, 0x776d4a60, 0xdd94dd77, 0x000028a4, 0x0b0f0bce, 0xda14f89d, 0x19b819ef, 0x00008c9e, 0x210221c2, 0x9d52f617, 0x9cde9ca3, 0x00001164,
+        0x11fb1184, 0xc05bdeda, 0xedf1edea, 0x00007a61, 0xa2c9a2c6, 0x1efb5ade, 0x30b83000, 0x000005a1, 0xfe94fe02, 0x8337dae4, 0x36623656, 0x000090db,
+        0x948b9472, 0x1218e8ce, 0xc5eac5af, 0x0000298b, 0xb356b324, 0x67809443, 0x09a30961, 0x00009349, 0x7e667e37, 0xe31ec567, 0x2b742b9b, 0x0000925d,
+        0x3bfc3b51, 0xe5ec22ab, 0x79fe7940, 0x00009df5, 0xc4b7c4f7, 0xed0f9f6a, 0xd05fd032, 0x000044a3, 0x63e4638f, 0x024a15fe, 0xa35ea344, 0x0000eebe,
+        0x0b320b7f, 0xa64d47b1, 0xbd45bd22, 0x0000bfda, 0xcf2fcf74, 0x312ff76f, 0x076d0789, 0x00001020, 0xde81de7b, 0x0495fb3b, 0x11641122, 0x00000272,
+        0xca1fcabf, 0xd54d66da, 0x1b271b12, 0x00006d0f, 0xdf0edf41, 0xa44b8e48, 0x9bde9b70, 0x00009514, 0x12961205, 0x95a66588, 0x42f4422c, 0x0000bdf1,
+        0x050f055d, 0x4436c5cf, 0x8c858cbd, 0x000074b0, 0x85688581, 0x8ca664e9, 0xff27ff8f, 0x0000c6f0, 0xc3e7c3d3, 0xf086b026, 0xebfaeb17, 0x00005239,
+        0x39583921, 0xa69f6357, 0x025a0255, 0x0000a5e9, 0x1bbd1bde, 0x38afe29a, 0x16631666, 0x0000de1d, 0x723c72ac, 0x6bc36395, 0x9a569a8d, 0x00004b48,
+        0xfd54fdf1, 0x3287f82a, 0xed58ede4, 0x00009436, 0x76fa76d0, 0xd1b48afe, 0xd076d0cd, 0x00004310, 0xc0fbc025, 0x8f98ec15, 0x14eb14af, 0x000032cf,
+        0xaa9caac2, 0xd6cdef93, 0x04bf0481, 0x0000959a, 0x4c344cd2, 0xf66f05b2, 0xfb23fbac, 0x0000c112, 0x4ccd4c58, 0x82e9ce50, 0x7e517ea3, 0x0000b6cc,
+        0x3f313f81, 0x289cd6cb, 0x4a374a18, 0x0000a05c, 0xaffbaf76, 0x17584eed, 0x8c808c74, 0x0000485e, 0x4999492a, 0x6d22f456, 0x19e01978, 0x0000d005,
+        0x58555892, 0x3eda8a18, 0x17321793, 0x00004a60, 0xb858b804, 0x810b4d34, 0x7b9e7ba2, 0x0000ec94, 0x864986a4, 0xe1c10ee6, 0x3100318b, 0x0000ba13,
+        0x971b9773, 0xa7417bc2, 0x5c125c0a, 0x0000f8c5, 0xf5c8f5c8, 0x4929cb23, 0xdbf0dba4, 0x00001117, 0x48f5483a, 0xb4dc864f, 0x1da71d02, 0x000068b5,
+        0xc85fc8e3, 0xbe68dce5, 0x30bf3057, 0x00007444, 0x266226da, 0x5e1dcd6a, 0x8abf8a68, 0x0000fe5c, 0xf3e2f3d4, 0x3e4812dc, 0x2d8b2db1, 0x00004822,
+        0xd0d8d025, 0x0ecb0149, 0xba35baef, 0x0000c8b3, 0xad7dad30, 0xd8364387, 0x5e005e14, 0x0000024d, 0x053605b3, 0xd3a469f4, 0xc3fec34e, 0x000073fb,
+        0x3c373c79, 0x1c8b864f, 0x72797203, 0x000081de, 0xb0edb0b4, 0xde4d15c1, 0x466c463d, 0x0000e06f, 0x04180475, 0xa290996d, 0xec0fec2d, 0x00006a8b,
+        0x695069e1, 0x153abcf6, 0xb165b1cb, 0x00008930, 0x21272105, 0x07d86b4e, 0xd3fad3ad, 0x0000262c, 0xc220c225, 0x2a426127, 0x12fd1247, 0x0000a285,
+        0x659b6591, 0xa8c2bf76, 0xb768b70a, 0x00009f26, 0x18eb1861, 0xc1f5a652, 0x7aac7a1e, 0x0000e402, 0xe5cae51e, 0x64153e46, 0xef3aef7d, 0x00004827,
+        0x1d231d92, 0x88a4cc0e, 0xfe63feac, 0x00007569, 0xf807f896, 0xd8db0e0b, 0x6a476a6a, 0x00005bdc, 0x7dbd7ddc, 0x2cd658dd, 0xe856e867, 0x000008a3,
+        0x0311034e, 0x4813b143, 0x6eba6e2e, 0x000074d1, 0xf44af4eb, 0x672fa844, 0x96079688, 0x0000086a, 0x9f5f9fe6, 0xa6a76108, 0xef3eef74, 0x00002729,
+        0xa867a8e2, 0xb07f6c2d, 0x673f6711, 0x000034d4, 0xff31ff8a, 0x63223cce, 0xb516b5c0, 0x0000ceaa, 0x577c57af, 0x396fac1a, 0xaa0daa61, 0x0000f893,
+        0x69db69b5, 0xd8dba5ab, 0x124312fb, 0x00003bbd, 0xd67dd6d6, 0x45561fcf, 0xc641c6e1, 0x00003e13, 0xbf77bfdf, 0x3c88c496, 0x3a423ac1, 0x0000241c,
+        0xc182c1ff, 0x32025ba3, 0x93ae9345, 0x00001e7a, 0x35c935f3, 0xfed2eb4c, 0x77027797, 0x00008e61, 0xe3bbe3f8, 0xb7b9dfe5, 0xd36cd36b, 0x00005b2b,
+        0x9b709b54, 0x0df4e36d, 0x355a3512, 0x0000da91, 0x4d814dcd, 0xae5190be, 0x1f531f16, 0x00009ed8, 0xb981b9dd, 0x2f1f9645, 0xc836c8f3, 0x00006cd5,
+        0x137a13ac, 0xf00875a6, 0xb949b99a, 0x000000bf, 0x82e082db, 0xc63546f8, 0xdb84dbe7, 0x00006e98, 0x7bda7bda, 0xb5f77bae, 0x0a090ac7, 0x0000ecf8,
+        0xa9e4a95c, 0x06673f4d, 0xc87dc847, 0x0000b8bc, 0x1437147a, 0x37e84625, 0x8c5f8c6e, 0x0000e948, 0x71c471d9, 0x2630d1cb, 0xb3a9b312, 0x00002289,
+        0xa58fa55c, 0xc2cad171, 0xdbefdb6d, 0x0000d587, 0xf2f0f20f, 0xa6234de9, 0x67c067c2, 0x0000555b, 0x48d04819, 0xaf59b84c, 0x7816780f, 0x00003483,
+        0xb028b02a, 0x9e3ee36d, 0xa029a0a9, 0x00009a4e, 0x44fe4442, 0x0644b6d8, 0x429f4274, 0x00006ee1, 0x58b6586a, 0x694e40bc, 0x7cec7c42, 0x0000fb9f,
+        0x312231a7, 0x51d853b6, 0xcce9cc14, 0x0000650f, 0xe948e9f6, 0x80ded038, 0xfefffeb6, 0x0000f262, 0xb31cb37f, 0xf5b97f42, 0xd14dd1a6, 0x0000055d,
+        0x393f3950, 0x0c3ba5db, 0x0b6a0b27, 0x0000408e, 0xa9e4a916, 0x431ed4f4, 0x4e104e61, 0x00008c90, 0x6e4d6e4d, 0xbb13938f, 0x100e1028, 0x000085c7,
+        0x629062c9, 0x9407fe91, 0x1f061f0c, 0x000068a9, 0x34f93434, 0x5de70d59, 0xc757c70a, 0x00002ea4, 0x6cb46c8b, 0xe24785ac, 0x2ff32f58, 0x0000b811,
+        0x7ae87abf, 0x9e53dba7, 0xa36ca3df, 0x0000edd4, 0x5a0f5ae3, 0xead3d062, 0x76857691, 0x00003c0f, 0x5a795a65, 0x1cb6cae6, 0x431c43c3, 0x00007860,
+        0x2a502a03, 0xd1ff5c2c, 0xe313e325, 0x00003ce7, 0xb261b2b3, 0x8d46ab03, 0x2b8b2b45, 0x0000b5eb, 0x6b226b6a, 0x0dc3c41a, 0xe80ae819, 0x000050d8,
+        0xe0fae020, 0x1ccf61a7, 0x9a009a97, 0x0000c12d, 0x0b350b55, 0x92a6834c, 0x400d408e, 0x00000aec, 0x8ff68f01, 0xf186d2da, 0xdc06dc2f, 0x0000751f,
+        0xd8e6d897, 0xb7b474a9, 0x136d1326, 0x0000b911, 0x6c796c54, 0x36270fa7, 0x65086562, 0x0000c60e, 0xfc42fce4, 0x3f562eb2, 0x8b6b8b93, 0x0000928a,
+        0x54975444, 0xc2c7efa2, 0x49de4926, 0x00002a9b, 0x49154934, 0x275dadbd, 0xb853b896, 0x00008ef2, 0x48d24816, 0xae5182de, 0x7204729e, 0x0000b4eb,
+        0xa832a828, 0xadd1297a, 0xd1dbd17c, 0x000025e3, 0xdc08dca5, 0x4ee68ec1, 0x057b0596, 0x00002e66, 0x978a97b6, 0x2fe042f8, 0xff28ff4d, 0x0000bd62,
+        0x0c970caf, 0xf426f181, 0x69596932, 0x00003c73, 0x4bfe4b98, 0xca9a4ef8, 0x18571839, 0x00000083, 0xde2adec4, 0x20533a2f, 0xc374c380, 0x00001a0c,
+        0x78d178e6, 0x82f70ed9, 0x1665168d, 0x0000d7a5, 0xdb22dba4, 0xfed346b2, 0x9fed9fbc, 0x00007770, 0x05d805dc, 0xcf2d2c8f, 0xb840b814, 0x0000bed2,
+        0xfb8afb0a, 0x5896f9ac, 0x4da84dc1, 0x0000c127, 0xed33ed6c, 0xb05f39bf, 0xbb1bbb59, 0x00009ee0, 0x5598558d, 0x238d0ca7, 0x057b05c4, 0x00003d92,
+        0x37f73745, 0xdae46e25, 0x547f54c1, 0x000062c9, 0xf1dbf1dc, 0xc0698c63, 0xfdf9fd9e, 0x000048d3, 0x972b97b4, 0x8fc402f7, 0x13141395, 0x00005ab0,
+        0xf051f006, 0xe3ff2162, 0x822d82da, 0x0000d10b, 0x575c5740, 0x138ca840, 0xfd71fd2c, 0x0000164a, 0x10f51047, 0x5ab4574f, 0x28182805, 0x0000e552,
+        0xa7dca7f7, 0xb2957bb8, 0xc15fc1ff, 0x000086bc, 0x43d64330, 0x74afb61e, 0x359335b5, 0x0000d266, 0x54945433, 0x4b362d79, 0xf8d7f8ef, 0x000021a8,
+        0xd91fd91c, 0x8b389d55, 0x8f278f1e, 0x000095b6, 0xdd4fdd77, 0x52d85ae0, 0x55045513, 0x0000ec15, 0x69fe69ec, 0xc80642c6, 0x104c10fb, 0x0000308c,
+        0x3ac53aa9, 0x7101568e, 0x429542b3, 0x0000ce07, 0xc5b2c521, 0x9a2ca98a, 0x171f173f, 0x0000d676, 0xe77fe738, 0x95c7b840, 0x6c146c93, 0x00008ef3,
+        0x75367558, 0x19ee9115, 0x3c093c09, 0x0000fa57, 0x92c392f2, 0xb7c8e5d3, 0xe20ce215, 0x00001268, 0x151c15b0, 0x0a5a0e26, 0xa42aa4c3, 0x00005077,
+        0x39fc3930, 0xcef57a88, 0x643564ce, 0x00006731, 0xf2dff2f0, 0x43662cec, 0x21022132, 0x0000a251, 0x993199c3, 0xeef27afd, 0x982e9898, 0x000035ce,
+        0x991c9945, 0x8e984033, 0x918791d5, 0x0000f1e3, 0x15751526, 0x8127a52e, 0x7f517fe5, 0x00007e63, 0xbb3abbdc, 0x3b3cac78, 0x230623ca, 0x000010c3,
+        0x901a900b, 0xe2bc9544, 0x334433f1, 0x00005ff6, 0xea0eea32, 0x9306cfaf, 0x502050dd, 0x00004dc1, 0x60ab60af, 0xf6c2c6c0, 0x1c7e1ca9, 0x00005abb,
+        0x08970824, 0x9e539c12, 0xc4fec4b0, 0x00009149, 0xae7baeb4, 0xb9d19638, 0x1d0f1d31, 0x00003f12, 0x05d00525, 0x67030755, 0xdd48dda4, 0x00006b26,
+        0x4e144e6b, 0x27b10b16, 0xcc39cc78, 0x00001fac, 0xe3fee3bd, 0x24efb0d8, 0x023f0231, 0x00009cc9, 0x341334bc, 0xfbe176dd, 0xe240e298, 0x00003035,
+        0x31c731f2, 0xbacff930, 0xc473c489, 0x0000e9f6, 0x5eaa5efa, 0xa9230da6, 0x9c909c93, 0x0000b3a8, 0xf31df30f, 0x594d47e3, 0xd840d81e, 0x0000f808,
+        0xd8aad812, 0x59b43510, 0x2464248f, 0x0000f9a1, 0xeb6debf3, 0x5589c65e, 0x6bc36b2d, 0x0000b4f5, 0x89bd891e, 0xf5d4fef9, 0x74547419, 0x0000de57,
+        0xf85ff827, 0x5b860e99, 0x0689068e, 0x000034f1, 0xed18edd1, 0xa38130f6, 0x9f6e9f07, 0x0000eb89, 0xfb7dfb9a, 0xbb13a11a, 0x69c169b0, 0x0000b321,
+        0x72d672a7, 0x7cbfbdc9, 0x05b8056f, 0x00008961, 0x188b185b, 0x512287d7, 0xff1fff77, 0x0000b9d0, 0x7208728d, 0x2966c78a, 0x7e6a7efb, 0x0000a1b5,
+        0x7a847a05, 0x8c67b4a0, 0x34dc348d, 0x0000806d, 0x4ce74ce1, 0x8c97e16a, 0xa7a5a7cb, 0x0000a574, 0xa763a70c, 0x52d96906, 0x12c3127d, 0x000013ca,
+        0x08dd08ce, 0xd3bbf0af, 0xb56ab5a5, 0x00005f3d, 0xd950d9fc, 0xd23fb9c8, 0x9d109d5d, 0x000098ae, 0x579f579c, 0x3e87bcf8, 0x73dd73cd, 0x0000660f,
+        0x4d824dfb, 0x17551395, 0xfd34fd0e, 0x00008c9b, 0xaee0aecc, 0x0b9b901c, 0x14b01469, 0x00005679, 0xff55ffa6, 0x58d642c4, 0x81a181e3, 0x00002a77,
+        0x2bf92b58, 0x7bf66f1b, 0x42774292, 0x0000a51b, 0x870987fd, 0xa1c2b23f, 0x7e527e8a, 0x00007da2, 0x2a2f2ab5, 0xf619dceb, 0x6a276a70, 0x000093b9,
+        0x63be6351, 0x3de88729, 0x83ab8327, 0x0000df57, 0x7b297b4e, 0x8028b52a, 0x01fb01a9, 0x0000db2b, 0x054605fb, 0xac59f3fb, 0x2fee2f15, 0x00005fb5,
+        0x97aa9716, 0x650cdca5, 0xd3dbd3af, 0x0000e337, 0xc40bc4cf, 0xbd68c2e0, 0xaf86af15, 0x0000ed89, 0x757875a1, 0xb1966b77, 0x504550d7, 0x00005cb0,
+        0xd192d1a3, 0xdc7a2780, 0xcf15cf3c, 0x00009614, 0xeca8eccd, 0x660ffd40, 0x5e235e4f, 0x0000d474, 0x527b5287, 0xfbcfe5b0, 0xaf3caff1, 0x0000f763,
+        0x3c023c55, 0x4578cd2e, 0xd36cd33b, 0x000051e8, 0xca1fca6d, 0x02fa6ac9, 0x20382019, 0x0000a427, 0x3702379f, 0xe71709d7, 0x361d36c3, 0x00003f94,
+        0xe26de2d2, 0xd04003f3, 0x1b7e1b8a, 0x0000838b, 0x43324326, 0x964cfdda, 0x164216ba, 0x0000dc1f, 0x4e554efd, 0x98f11fd0, 0x1768179d, 0x00008a2c,
+        0x3b113b83, 0xebd1d48a, 0x8cfc8c24, 0x00001c88, 0x49e4491b, 0xdb52973a, 0x3ee33eae, 0x0000bc13, 0x32333283, 0xd9be9b4f, 0x268726f2, 0x000000bd,
+        0xdb39db5e, 0x5b43cf34, 0x47744761, 0x000011d7, 0xd6afd66a, 0xe6a3a2e7, 0x4652462c, 0x0000ee5f, 0x6cca6c5c, 0xa64dc235, 0x8ef08ecf, 0x00008e72,
+        0xcf49cf72, 0x65cdba75, 0x46f846ea, 0x000095b6, 0x06f406d5, 0x0a2b84c7, 0x5e9d5e75, 0x000074cd, 0xa82da8ed, 0xec10a8bb, 0xa3b5a3e1, 0x00008d2f,
+        0x7b877b8c, 0xd9be92d8, 0xc096c01f, 0x0000e2a4, 0x7b0a7b3d, 0xd62eacc2, 0xfe79fe93, 0x0000f747, 0xcc0dcc95, 0x33ef60e9, 0x612661f6, 0x00009114,
+        0xf9fbf941, 0x57897b3f, 0x1bbd1be8, 0x00004fbf, 0xb144b120, 0x45290d59, 0x8ae18aa6, 0x00003840, 0xc1b1c17a, 0xe2468961, 0x4db34dcd, 0x000053c4,
+        0x247124b4, 0xfed9a987, 0x23562319, 0x0000143d, 0x935b93cd, 0x716df69a, 0x04ba04bc, 0x00002c0a, 0xd656d6d6, 0x22a642f8, 0x329932cb, 0x00003669,
+        0x08a008d0, 0x4399baa0, 0x0ffe0f4f, 0x00004c08, 0xa7dca742, 0x512df560, 0xa489a4cd, 0x00004912, 0xf11bf14b, 0x2a53a8c0, 0xa68ea635, 0x0000aac1,
+        0x0ef00ecb, 0xa8d21eab, 0xf049f033, 0x0000c05f, 0x89e089b2, 0x81f78da3, 0xb6cab669, 0x00007594, 0x99df99b8, 0x7d94ce2d, 0x494a4943, 0x0000187b,
+        0x06130653, 0x6bea2d06, 0x63cb6341, 0x000003a0, 0x2a2f2a07, 0x963d2502, 0x9f2b9f8f, 0x0000a5e9, 0xbcb6bcc2, 0x8b8a2254, 0x68f46845, 0x0000031b,
+        0x2c4a2cdc, 0xa43401ca, 0x62f36207, 0x0000a195, 0x0b1e0b93, 0xa2e241f5, 0x503a500a, 0x0000049f, 0xb15db136, 0x1a5c6b77, 0x002f0080, 0x00008ab9,
+        0xf76bf787, 0x561ecaa1, 0x009a0010, 0x0000ba9e, 0x1f6c1fc1, 0x5822ca2e, 0x742e74b5, 0x00005958, 0x3ca83c24, 0x5d90c020, 0x589a5866, 0x0000de18,
+        0x8d3a8df0, 0xf011e9b0, 0x6303634a, 0x0000d387, 0x60b06000, 0x98fac17a, 0x3eae3ed7, 0x0000d33f, 0x0e820e9a, 0x444611a6, 0xf163f1c8, 0x0000b2dd,
+        0x1db51dc2, 0xb67144a9, 0x1ba21bdf, 0x00002ff5, 0x6edb6e61, 0x1dde1b68, 0xa877a8d8, 0x00000e5d, 0xf39cf3fd, 0xaeed311e, 0xa029a097, 0x00008580,
+        0x058705ba, 0x728a5d53, 0xd6f0d6b3, 0x00000039, 0xbadfbacb, 0xfc77c487, 0x1f731f7d, 0x0000cf2e, 0x26c426a4, 0x04c47dfa, 0xc30dc323, 0x0000741e,
+        0x24742425, 0x791a7ec2, 0xfb63fb8d, 0x000056b4, 0x28b8282d, 0x71cca847, 0x703670d0, 0x00005409, 0xbd2ebdd0, 0x9f882f39, 0x642c64aa, 0x00005ce8,
+        0x44fe44c0, 0x8e980b6f, 0x61c96186, 0x00009b8a, 0x673667fe, 0xbf756546, 0x09e80963, 0x00004325, 0x8e288e6b, 0x8cf7824d, 0x0c2d0c51, 0x0000dd47,
+        0xdfa4df7e, 0x82966403, 0x913291e1, 0x00009c85, 0x898489a1, 0x037baace, 0x622962f1, 0x00000bf8, 0x5925599a, 0x929cc743, 0x6f1b6f70, 0x00000433,
+        0x5fb65fa1, 0xfbbc9438, 0x3443345c, 0x00002c0a, 0x0a5a0ae5, 0xec313580, 0x9efa9e62, 0x0000c312, 0xe560e56a, 0x095a996f, 0x3c073c8f, 0x000043c6,
+        0xdcc3dc5f, 0x18122354, 0xc94cc9a3, 0x0000d875, 0xbd4cbdcf, 0x351900ca, 0x9647968e, 0x0000348e, 0xaaa9aad1, 0xc825df26, 0x14fe1446, 0x00007fc6,
+        0x26a526a9, 0xee4f70ec, 0xdebcdeeb, 0x000045db, 0x5cfe5c31, 0x215db894, 0xdd17dd8a, 0x00000d18, 0x750e75a4, 0x5b4f496f, 0xad16ad49, 0x00002036,
+        0x80e1808c, 0x2a19ca67, 0x5e285ee8, 0x00007b9c, 0xfce4fce5, 0x5ad811c2, 0xaa26aa12, 0x0000ff62, 0xe7e2e7bf, 0x908e2f57, 0xed58ede4, 0x0000702e,
+        0x0a5a0ad8, 0x5f427b70, 0x4b8a4b5a, 0x0000e04d, 0x37a837a7, 0xd69f55cd, 0x217a21d2, 0x0000f9fa, 0x80aa8011, 0xa9acb1d6, 0xecaeec1a, 0x000077ee,
+        0x7c3c7c30, 0x220f70ac, 0xf2edf266, 0x00004210, 0xecbaecd1, 0xa2235a5c, 0x535e5331, 0x00003454, 0xbc00bc0c, 0xf4ee50ae, 0x1aa71aef, 0x0000b22c,
+        0x8ab78aa5, 0xeb93ae66, 0xd082d077, 0x0000ac76, 0x71c47181, 0xd675e3dc, 0xb312b320, 0x0000688b, 0x1b721bdc, 0x9168d5f5, 0x3d6b3dbb, 0x0000e337,
+        0x0e200e36, 0x47072a38, 0x513e51e4, 0x0000307c, 0x3f6c3fd4, 0x47476c45, 0x8907892b, 0x0000a719, 0x6b2a6bd6, 0xd93b05c7, 0x77bd7792, 0x000006df,
+        0xd5fbd563, 0x5cb1f0e8, 0xaff8affd, 0x0000a6e9, 0xa876a81d, 0x86575eae, 0xde2ede03, 0x000046fa, 0xccc8cc28, 0xfdaa33ce, 0x7bbc7b8e, 0x0000498e,
+        0x62646219, 0xa64fb05b, 0xec6becd3, 0x000032cf, 0xea25ea6e, 0x0142333a, 0x6822683e, 0x0000cb34, 0xa15ea17c, 0x7bb5abb8, 0x521e52ac, 0x0000f9a1,
+        0xe8c9e88e, 0xcbc592e4, 0xe6bae680, 0x000033d4, 0xe71be74a, 0x8cd7c657, 0x41a74151, 0x00005b36, 0x714c71f4, 0x6b8f67e5, 0x388f38b8, 0x0000f763,
+        0x87638736, 0x7c6f6afa, 0xf6b4f6e6, 0x0000a19e, 0x538353d3, 0x63a13719, 0x526352ce, 0x00005539, 0x027102c8, 0x7c93bb90, 0x44a644d2, 0x0000c187,
+        0x0a470a29, 0x2c7e2406, 0xa6a7a6a4, 0x0000439d, 0x65366579, 0x0e8b4c96, 0xa4c1a47c, 0x00002319, 0x90099014, 0xf5b992db, 0xfa7afa93, 0x00006436,
+        0xef79efcf, 0x240d15c3, 0x152f15b2, 0x000096f5, 0xa788a78d, 0x20a2a5ef, 0x2e3c2e66, 0x00004f42, 0xd5d5d59b, 0x5ce23cff, 0x58e25839, 0x00005eaa,
+        0x1c281ca6, 0x8255702f, 0x0f0f0f90, 0x0000184c, 0xa5bca5db, 0x0e8bb1f8, 0x0f470f28, 0x000038f3, 0xd2e5d278, 0x95cbad3c, 0xbe14be35, 0x00004c33,
+        0xb250b2a4, 0xdd19209b, 0x0c5e0c03, 0x00005599, 0x50765087, 0x6b007eb8, 0x17ae1761, 0x0000f0ad, 0x00c000f6, 0x41ef7197, 0x71617193, 0x00006af7,
+        0x088708b5, 0x84868230, 0xe53be58f, 0x0000236c, 0xbbc4bb66, 0x8636134a, 0xb428b4c6, 0x0000f8fd, 0x2ec72e27, 0xeb5872ab, 0xf130f18c, 0x0000d55b,
+        0xa5c2a560, 0x90c9e9cc, 0xe123e1a8, 0x000029db, 0x3e893e60, 0x73e50e25, 0x072807e2, 0x0000e692, 0xa7a6a718, 0xcffb1bd0, 0xd88dd870, 0x000065f1,
+        0x19fc199d, 0xaabbe022, 0x1cee1cf4, 0x00001d3c, 0xff9dff27, 0xe4c3bdcb, 0x80f9809c, 0x0000119b, 0xe8a1e8b0, 0x9a9e393f, 0x80b28093, 0x000009b2,
+        0xa3d4a3ce, 0xd3cb0785, 0xc43ec480, 0x00001dd3, 0x22ec22a1, 0x5fb2f0a8, 0x851d8588, 0x0000fd62, 0x9a1f9a60, 0xd95a63ac, 0x40a540de, 0x00000892,
+        0x26ea26dc, 0xaaccfc3c, 0xe0e1e07d, 0x000089db, 0xb7f2b7e3, 0x91aeb3e7, 0x78977844, 0x000094df, 0x89588969, 0x6a1c464d, 0x2d702d70, 0x00001fac,
+        0x2810284b, 0x68f091cb, 0x024b02a5, 0x00001288, 0xa7f1a772, 0xc2147d00, 0xc634c6c9, 0x000014c9, 0xe022e0af, 0x8a2750cc, 0x327c3283, 0x000086c3,
+        0x9e959e0b, 0x138f8dde, 0x8f258f2e, 0x00002ef9, 0xa9c8a9d8, 0xd404dea5, 0xd7fad7be, 0x00007d4e, 0x32d532c7, 0x62f3be8b, 0x5f565fdb, 0x00008a42,
+        0xac2aac4d, 0xcf641e13, 0x013c01b4, 0x0000fc41, 0x62a762aa, 0xf75a99e8, 0xc528c5f7, 0x0000fbbc, 0x54385439, 0x5d6a921c, 0xc117c121, 0x0000ad4b,
+        0x95c5950a, 0xc1125b25, 0x301b305b, 0x00005f76, 0x0f590f48, 0xc29a4082, 0x0ce90cb7, 0x0000330a, 0x1e271eac, 0xf551c7fe, 0x4658467b, 0x0000c6be,
+        0xafa5af10, 0xfbce0d27, 0xf1a1f1af, 0x00004411, 0xfc10fc12, 0xfd1ecdd7, 0x121f1262, 0x00003b2d, 0x8cae8cc5, 0xd5a57ac4, 0xd8d7d82a, 0x00005eaf,
+        0xf1c4f1cc, 0xfdeee1af, 0xa8b7a80b, 0x0000289a, 0xd223d28e, 0xa9f0e94d, 0x7fd47f9a, 0x0000d5ca, 0xb4d5b4c9, 0xb5732ca9, 0x93a69332, 0x0000d1a4,
+        0xdc70dcbe, 0xa7c29455, 0x2e552e36, 0x00000dbb, 0x22922287, 0x48163b4e, 0x41634193, 0x000087c6, 0x99bb99a1, 0x9d53d5a2, 0x5803582f, 0x000010e3,
+        0x5ecb5e4b, 0x6bbf0da7, 0x4e4c4e47, 0x00004b04, 0x24b224ca, 0xd66abcca, 0xfc27fc6d, 0x00001b88, 0x44434490, 0x829627eb, 0x96ab96af, 0x00009e46,
+        0x0d8d0d91, 0x4e544bae, 0x8f7c8fdd, 0x0000e17b, 0x3f7f3fc5, 0x4005f424, 0xbf55bf5a, 0x0000e10b, 0x61ed61f8, 0xcc7aa84b, 0xf192f17c, 0x00006a96,
+        0xd153d1cc, 0x145fabc0, 0xf895f895, 0x0000d0eb, 0xa174a12c, 0x9addb617, 0xadbcadd2, 0x00003302, 0xaf2dafeb, 0xae1333a0, 0x663466df, 0x000062af,
+        0x55a455f2, 0x65d72ce6, 0x15611502, 0x0000018c, 0xfb40fbe0, 0xdbabebb0, 0xadfeadb3, 0x0000c9d0, 0xdaddda78, 0x5e685b3f, 0xad8cad37, 0x000069b7,
+        0xc921c93a, 0x8df96eb6, 0xe02ae03a, 0x0000ac85, 0x7c6d7c7b, 0x17946ac9, 0x451c459c, 0x0000160c, 0x002a005a, 0x577ead2d, 0x02370269, 0x000098af,
+        0x8ffe8f28, 0x220f7150, 0xc29fc231, 0x00002f9a, 0x69a16962, 0xf3643fce, 0xf318f3db, 0x00007160, 0x4a8c4ae9, 0xc84b3691, 0x56805695, 0x0000e529,
+        0x313031c4, 0x28633c4d, 0x4038401b, 0x000020db, 0x5e4d5e9e, 0x38486fca, 0xf670f659, 0x000062a5, 0xfe8afe0f, 0x82379405, 0xb219b29c, 0x0000a9c8,
+        0x484f481a, 0x822817cc, 0xc03bc0d4, 0x000087bc, 0x2e392e05, 0x520609d7, 0x31d63114, 0x0000e489, 0x47924717, 0x4a877909, 0xcdddcd97, 0x0000a26a,
+        0xf91bf990, 0xce455f91, 0xde96de20, 0x00006dbd, 0x6340637a, 0x2a9d6425, 0xa1dea187, 0x0000bd1d, 0xfb2cfb53, 0xef3eef5d, 0x033a0332, 0x000091fa,
+        0xf93af9db, 0x36cecca8, 0xb653b60f, 0x000054c8, 0x856985d3, 0x21ed8553, 0x462f4642, 0x00008060, 0xa7a8a731, 0x4389722f, 0x2a762aa6, 0x000066c8,
+        0x4b6d4b99, 0x236ddba7, 0x5773573c, 0x0000b6a8, 0x0e650e92, 0x1f818918, 0x3a893a29, 0x00001502, 0x3b5f3b90, 0x6960636e, 0x5bad5bf6, 0x000064aa,
+        0xc2d9c22e, 0x2d53e932, 0x79f779ea, 0x0000818e, 0xd358d33f, 0x21a6da5b, 0xb41db491, 0x0000b94e, 0xd021d039, 0x785a4833, 0x21302122, 0x0000a8c8,
+        0x6c376c15, 0x455910bd, 0x512f51e2, 0x0000857c, 0xe414e49c, 0x15f9814c, 0xe0a4e044, 0x00003168, 0xdd6ddd06, 0x9f571bae, 0x03130376, 0x0000ebfd,
+        0x644964cd, 0xd5407f36, 0x790e7975, 0x000086ef, 0x7ba47b83, 0x1c4c4b55, 0xe764e793, 0x00002c76, 0x06940699, 0xc3690534, 0x6b826b34, 0x00007031,
+        0x65e765a9, 0xd1cb19c6, 0xf97ef991, 0x0000da3f, 0x77cf7747, 0xf6e266db, 0x1015101a, 0x000025a2, 0xe4cae48c, 0x50a7fc3a, 0x261726e9, 0x0000f80d,
+        0xd1c4d1d9, 0x27599163, 0xab05ab95, 0x0000c25e, 0xf6e2f6d7, 0x964cb835, 0x054605d8, 0x00006a8b, 0x5e6b5e4b, 0x457884e1, 0x3f6b3f99, 0x00002420,
+        0x50da50db, 0x946916b9, 0x80dc8095, 0x0000a2ce, 0xda9bda9a, 0x44468b6c, 0xfc98fca6, 0x000053a7, 0xbdbfbd32, 0xbc34fff4, 0xff58ff77, 0x00006fd5,
+        0x09280953, 0xf94868cb, 0x66ac6666, 0x0000c832, 0x633663b8, 0x2c63a93c, 0x768876e6, 0x0000e1e2, 0xfa41fa78, 0x53fb201e, 0x8ffe8fae, 0x00000814,
+        0xd4a8d4c6, 0x3202504e, 0x10df1082, 0x0000581c, 0x03310324, 0x7d2b0957, 0xe781e7d0, 0x0000d956, 0x1c371cd7, 0x7fce71ad, 0x23a82307, 0x00009514,
+        0xb66cb6f1, 0xeb58120a, 0x4c5b4c04, 0x000085be, 0x4daa4de7, 0x9468e4c5, 0x8a618a3f, 0x00006217, 0xf21ff25d, 0x7f4e07f4, 0x59b959f5, 0x0000761c,
+        0x43d04335, 0xdecc4610, 0x1fb41f98, 0x0000f483, 0x7dec7d7b, 0x5ad51142, 0x53ca5388, 0x00007e5e, 0xc4b1c466, 0x570b3221, 0x644264ce, 0x000064a6,
+        0xa5eba5cc, 0x0f3475e2, 0xc3a0c34d, 0x000061c9, 0xc1ddc106, 0x9fe508f9, 0xc6e0c6aa, 0x0000838a, 0xaaa6aa7d, 0x8a2f35e0, 0x7a0d7a77, 0x00004aae,
+        0xee7cee9b, 0xc5a22c1e, 0x427b4236, 0x00005566, 0x039d0389, 0x7c128733, 0x277a2774, 0x00007afe, 0x2ce82c68, 0x401391e7, 0x597659c4, 0x0000fad2,
+        0x1d6a1d3c, 0x52e6e6a4, 0x127712a1, 0x00001a02, 0xfbe0fb1c, 0x101dcb51, 0xda0bda7f, 0x00006917, 0xd277d218, 0xc27cebd3, 0x22f322f4, 0x0000684a,
+        0xe404e4b8, 0x5ab75530, 0xd660d60f, 0x0000a7b5, 0x88a088ec, 0x9dd96c2d, 0x044204ed, 0x0000e446, 0x337733b5, 0x72eae70f, 0x7c927cc5, 0x0000a8d5,
+        0xdf31dffb, 0x19934d2b, 0x7db67d97, 0x00005165, 0x65e06559, 0x2d3c18aa, 0x5e4c5e01, 0x0000bc10, 0x8aaa8a18, 0x45262e45, 0xb1acb1eb, 0x00005d6f,
+        0x0cde0cd7, 0x027bb440, 0x7cb77c52, 0x00004012, 0x75ee75b4, 0x24534a29, 0xc997c934, 0x000070b6, 0x67366781, 0x93c865e5, 0xf05af0fc, 0x00008950,
+        0x828e82a7, 0x2c423e4c, 0xe003e04b, 0x000063c9, 0xfcb3fc5c, 0xbd1bc6c3, 0x154a1536, 0x000030b4, 0xa5aea52d, 0xe3dcc728, 0x230a2395, 0x000092e0,
+        0xea27ea06, 0x0b341f6a, 0xd107d1aa, 0x0000b5d3, 0xb9b1b917, 0x0cd77450, 0x766b76aa, 0x000027b2, 0xf6bbf6a3, 0x323c1d67, 0x7b427bfb, 0x0000a999,
+        0x0f480f0f, 0x69d13f4c, 0xf9bbf9d2, 0x0000f3f0, 0xeb8deb3a, 0x39fcc171, 0x0b940b20, 0x00008e71, 0xbd3cbdb3, 0x78b210bc, 0x713a7143, 0x000004cf,
+        0x92bf923e, 0x0144f7e3, 0xc009c01d, 0x00004bcc, 0x531053aa, 0xcb25ce2d, 0x5a2a5a4f, 0x0000a95a, 0x98b998a2, 0x452e6fc9, 0x1cdf1c84, 0x00007660,
+        0x6dca6d50, 0x5f3fa3ac, 0x820f825c, 0x00005184, 0x9ee39e19, 0xf5c2a052, 0x43ba4301, 0x000094e0, 0x009b0022, 0xfe476ee9, 0xe702e723, 0x0000f7cb,
+        0x85148597, 0x2cddc977, 0xaf3caf4c, 0x00002719, 0x0cdf0ca5, 0x240fd21c, 0x79c9790c, 0x00002f0a, 0x8b438bd4, 0x41e4c001, 0x39183969, 0x00008980,
+        0x24fd244a, 0x1b912838, 0xb83db8c0, 0x00006fa7, 0x813b814c, 0xaca0b554, 0x48a34850, 0x000060ae, 0x80698001, 0x3d3c90f3, 0x4d334d5c, 0x00008571,
+        0xfe4ffe33, 0x5e92ae98, 0x3b383b03, 0x0000bdce, 0x042604b5, 0xb0eb8897, 0xa215a24b, 0x00006546, 0xef18ef20, 0x660cbdb5, 0x1f0e1f7b, 0x0000a58a,
+        0x73df734c, 0x8c630b9a, 0xad9dad30, 0x00001017, 0x332c33d2, 0x8ee885cf, 0xc7b9c713, 0x0000959b, 0x550455bb, 0x2431c2c4, 0xdc35dc66, 0x0000fabc,
+        0x31e131f2, 0x34ef38f0, 0xbde7bdcf, 0x00006241, 0x60d16064, 0x86b83df0, 0x2e782eb8, 0x0000c01d, 0x597c59ae, 0x18156fb6, 0x9db19d4c, 0x00005a64,
+        0xce16ceed, 0xa64e6168, 0xf95ef910, 0x00008ffa, 0x06ef06a9, 0x75cd7dc2, 0x429842bf, 0x00007a3f, 0x527852f5, 0x92d4120b, 0x1e6d1e2c, 0x0000e144,
+        0xcaf1ca1d, 0xb600544e, 0xa319a33b, 0x000064bd, 0x210a2179, 0xd838fb4e, 0xc062c082, 0x000018f1, 0x52c85249, 0x0a9b9aae, 0xe433e48a, 0x0000ce8d,
+        0x89f889d7, 0xa441985f, 0xf99af928, 0x00002c3e, 0x881f8864, 0xc56483b7, 0x1ad31a77, 0x0000bfe4, 0x42ae4253, 0x29607622, 0xc875c8dd, 0x0000d8bb,
+        0x50c85081, 0x00342360, 0xf031f067, 0x00009e8a, 0x5163514b, 0xcb7aeab0, 0x0283021d, 0x0000e194, 0xbcfbbc44, 0x6a605ce0, 0x0dd80d21, 0x00003b79,
+        0xf43ef419, 0xbbdbfbfa, 0x7fa47f19, 0x0000e6ad, 0xfbe2fb40, 0xa4bac418, 0xa21ba264, 0x00001cee, 0x093709d4, 0x65c39e95, 0x80bf8043, 0x000093cb,
+        0xdc82dc3a, 0xb3bdb398, 0x22d6227c, 0x0000c6dd, 0xe87de868, 0xd2208ea5, 0x348a3471, 0x00003d13, 0x4bf54b49, 0xd18235ff, 0xf72cf7bb, 0x00002066,
+        0x5fa05f2b, 0xae0df560, 0xe203e2d5, 0x000009bf, 0x15a515d2, 0x09bc47d6, 0xcdfccd44, 0x0000e999, 0x65de6595, 0x0f157d75, 0x1ea71eef, 0x0000d548,
+        0xe4b8e454, 0x90cb73d2, 0x2c032cc5, 0x0000fa4c, 0x22ab22fc, 0x901c4aef, 0x0f1a0f04, 0x0000f88d, 0xb1f4b1a9, 0xf1ff7d7c, 0x6a7e6abe, 0x0000f718,
+        0xc6f5c621, 0x0b269332, 0x396d3928, 0x0000c58d, 0x866b8685, 0x78b5b3e6, 0x133c13e6, 0x00005298, 0x71ef712b, 0xf3e9375c, 0x52615244, 0x0000071b,
+        0x357235c3, 0xf5c2d084, 0x9dee9d05, 0x00003a5f, 0x0cf80ccb, 0x85684bf5, 0xdb8bdb93, 0x00008f68, 0x9ddc9d97, 0x5a90cc2b, 0x2b572b1c, 0x00009b69,
+        0x5e355ee1, 0xe4bd34e1, 0x75f8752e, 0x0000fabd, 0x6471647a, 0x05e65d5c, 0x0cd00c62, 0x00004ef6, 0xbe20be58, 0x8708b747, 0xc4f8c4b1, 0x0000459f,
+        0xe1f0e1fa, 0xf171a166, 0x88dd88c4, 0x0000e73d, 0x7c3d7cec, 0x0664e84e, 0xd6d0d6db, 0x0000a764, 0xd9c9d97a, 0xac6b901c, 0xf50ff57a, 0x00001617,
+        0xd127d13a, 0x6ba0315d, 0xa3f8a3cd, 0x00001588, 0x0b350b64, 0xb409b084, 0x09b50981, 0x0000741d, 0x5b255b2c, 0x2dc23696, 0x8cdc8cc4, 0x0000261f,
+        0x69dd699e, 0x732b3cff, 0xf26af280, 0x000083af, 0xaa0caa1f, 0x443cf3a9, 0x486348bf, 0x0000a0b1, 0x3e513edb, 0x9aec86cf, 0x9874982e, 0x000079a3,
+        0xd6b4d6bf, 0xf9b6980a, 0x433643f4, 0x00004be4, 0xaa47aa45, 0x4b74a251, 0x2dfb2db7, 0x00005cb0, 0x5bcd5b2f, 0xf9ab7909, 0x25be2564, 0x000044ef,
+        0x1f201f0f, 0x7ec06b48, 0x83aa83ea, 0x000095fa, 0xe276e2f2, 0x53a70277, 0xd764d702, 0x0000f9fb, 0xcde5cd3f, 0x998d52c3, 0x4b9c4b72, 0x000000be,
+        0x305c3017, 0x93e93df0, 0xf887f82c, 0x00001188, 0x8ec48efe, 0xdf19ccd3, 0xee0feeb1, 0x00002ec7, 0x49fd49d1, 0xa77fd6c4, 0x27cc27ba, 0x0000f963,
+        0x480e489e, 0x31470e64, 0xab7fabf8, 0x0000a0dc, 0x729572f5, 0xd6ef20b1, 0xcdbecd7d, 0x0000d21d, 0x7a697aa0, 0xbe6caae2, 0x15341519, 0x00009f0e,
+        0xa1c4a160, 0xfe7781fe, 0xa0a7a0cc, 0x00009e46, 0x358e3514, 0xe2434de9, 0x559d5521, 0x00002ddb, 0x60b3604c, 0x1b6a39e9, 0x1da51d3c, 0x0000afd9,
+        0x1fbe1f5b, 0xbe995922, 0x4d0a4d1f, 0x00001f03, 0x8a998a1a, 0x4cb7e8cc, 0x93f09349, 0x0000f02d, 0x242e24f3, 0xe3d38e48, 0x1f751f16, 0x00001017,
+        0x7ae37a0b, 0x46995448, 0x204420df, 0x0000ef46, 0x873f8739, 0x700346db, 0xbd2abd83, 0x0000461c, 0xa7dca7f7, 0xeee8dfd8, 0x42054249, 0x0000bf25,
+        0x64c16478, 0x2bc1e75f, 0xa3d7a36a, 0x0000a385, 0x586c5810, 0xfe512ed6, 0xf36af383, 0x000032b4, 0x2aad2aaa, 0xe0f204b3, 0x93a493f1, 0x0000ea15,
+        0x9b2f9b88, 0x06357bdd, 0xb0b7b0c3, 0x0000fa62, 0x46404643, 0xcbc48f3a, 0x36f2365a, 0x00003f64, 0xb017b083, 0x61ed5ba2, 0xf27bf2d6, 0x00003ec4,
+        0x02570207, 0x31acb366, 0x512f517b, 0x000090b4, 0x8b918b4b, 0xe80e2e50, 0xe9f8e984, 0x00003082, 0x7ee57e11, 0x23832ddb, 0x2bce2b2a, 0x0000fed2,
+        0x19e419f4, 0xc99ad17c, 0xa1a7a11c, 0x0000e74d, 0x11f7118b, 0x999e6e15, 0xc576c58f, 0x0000c16d, 0x1e2f1ef7, 0x070492d8, 0x4b324b81, 0x00003a2c,
+        0x54ff5438, 0xa1be6e37, 0x5da55d4a, 0x0000384c, 0x805280cd, 0x0644938f, 0x9dcd9d66, 0x00003002, 0xb5c2b524, 0xcb14d64a, 0x8928891d, 0x0000a46e,
+        0x16c4161f, 0x7e54c9f3, 0x22b32288, 0x00005bb4, 0x069006fe, 0xa2f100ca, 0x61cd61e0, 0x00007b86, 0x5807581e, 0x452599d6, 0x562f56ee, 0x00006687,
+        0xa368a3cc, 0xf17343bf, 0x6ef16eb5, 0x0000be10, 0x22d522f0, 0xf036c179, 0xdabadad4, 0x0000ac4a, 0x46024687, 0xd26b7988, 0x5d4f5dd1, 0x0000fcec,
+        0x300430f6, 0x16f94143, 0xae4aae2a, 0x0000c612, 0x33b1333f, 0x89477f34, 0x240a249b, 0x000075a3, 0x4be94ba6, 0x78cdbdf6, 0x2fe82f11, 0x00008e71,
+        0xbeabbe7b, 0x080add96, 0xcb3bcbbd, 0x00004e83, 0x523a525c, 0xe2d318d5, 0x796d7912, 0x0000446e, 0x5c345ce4, 0x30bd9338, 0xbc86bcdb, 0x0000c3ec,
+        0x6fb46feb, 0x66a109eb, 0x37e9376e, 0x0000abd9, 0x188418b8, 0x4578883a, 0x15351544, 0x00003f11, 0x5a075a96, 0x8dc58590, 0x643f6412, 0x0000e95f,
+        0x842684dc, 0x37fe5f1f, 0x17bf1790, 0x00000aed, 0x128412f7, 0x45453ece, 0x2c392c63, 0x0000a01d, 0xdce9dc9f, 0x6022c549, 0x7d2e7d14, 0x00002675,
+        0xc3e6c3bc, 0xd1688bde, 0xf0a2f0a1, 0x000069ca, 0x928592d5, 0xd89cf257, 0xb455b45d, 0x0000f73c, 0x16ed169d, 0xc97a91e6, 0xc61ac6ad, 0x00008818,
+        0xbe28be77, 0x5a908158, 0xea03ea23, 0x00008bbe, 0x96d896b8, 0x59b8f728, 0x29a329b4, 0x00005706, 0xb9deb9a8, 0x847e6977, 0xd39bd3f9, 0x00008b71,
+        0x68ba684e, 0x902e11b9, 0x35df3588, 0x000069d4, 0x48f4488e, 0xc55527d6, 0x3ece3e34, 0x00003d7b, 0xd021d03a, 0x544d60ac, 0x402140fd, 0x000073c2,
+        0x97ec97bd, 0x0444f9c5, 0xd71fd7d2, 0x0000cc98, 0xa136a12d, 0xf7e8afd4, 0x44744484, 0x00004412, 0x98599846, 0x8fe68fe1, 0xa7a7a7ec, 0x0000f21d,
+        0x56e3566e, 0xec53710e, 0x7c977cca, 0x0000c840, 0xa384a304, 0xc0ca34df, 0x76157680, 0x00008060, 0x61316193, 0x2ca13b97, 0x479547b7, 0x0000b00e,
+        0x7a377aa3, 0x946779ff, 0xdcf1dca7, 0x0000f5fd, 0xd0aad084, 0xd02bebf0, 0x6b6c6b26, 0x0000803f, 0xfdfafd36, 0x23129243, 0xa69ba6a7, 0x0000684a,
+        0xdd3bddca, 0xec31be89, 0x83aa835d, 0x0000f3ec, 0x96d79676, 0x22728fe0, 0xb84bb8e3, 0x0000175e, 0xb10cb108, 0xd4516239, 0x6c5e6ca9, 0x0000e06d,
+        0x17661730, 0x2bd298af, 0x3d2e3d0b, 0x00001117, 0x3f213fe8, 0xce2a47d5, 0xf581f599, 0x0000efb6, 0xeb25eb68, 0x36ce772f, 0x0126012d, 0x00009b31,
+        0xcce0cc1c, 0xb154d922, 0xd029d003, 0x0000fbad, 0x594559dd, 0x80f7d3b0, 0x4574452a, 0x00001048, 0x92a092c8, 0xcdeb9e9a, 0xc887c877, 0x0000890a,
+        0x10ef1063, 0x53568f21, 0x159715b0, 0x0000ee37, 0x0b1a0bf9, 0x90d603c8, 0x844984af, 0x00004210, 0x7f017fdf, 0x3fbb1ca3, 0x31683129, 0x000091cb,
+        0x141014b5, 0x2d5226bf, 0xf681f604, 0x000066c9, 0x94a3940b, 0x74a8f130, 0x3872388a, 0x0000b531, 0x37ca3704, 0xf944693a, 0xe700e72d, 0x00004e08,
+        0x482f4802, 0x85c89d07, 0xd076d044, 0x0000952a, 0xec11ec68, 0x7102854c, 0xfcddfcd6, 0x00008460, 0xe5f5e52b, 0x625149f6, 0x1e471ef8, 0x0000fa73,
+        0xc231c252, 0x069bc9cc, 0x3c843c55, 0x0000a155, 0x7d167d16, 0x81253a91, 0x15941593, 0x00004ba9, 0x792d7962, 0x7fb957fd, 0x7309739e, 0x0000a938,
+        0xafe2af63, 0xbacf463a, 0xb5e4b5ce, 0x0000bbae, 0x824182b9, 0x43f996c1, 0xc443c4fc, 0x0000ada7, 0x1e9f1e34, 0xab7fb272, 0x1d001dc1, 0x0000bf6a,
+        0xed3ded6c, 0x2259900d, 0xf51ff5d9, 0x00006570, 0x039f03d8, 0xc99aa7b2, 0xe62ae6a1, 0x0000dd1a, 0x29412951, 0xc455fd6e, 0x54f554c4, 0x00000e83,
+        0x068506f6, 0xac9e04b7, 0x913a91f4, 0x0000a3dd, 0xbbdabbdf, 0x93cf0a14, 0x39cf39c2, 0x00005365, 0x7794774e, 0xc2f595fa, 0x15a415d2, 0x00007c61,
+        0x9ea99ec6, 0x3d27b280, 0x176b179d, 0x00005e6e, 0x2a152a0c, 0xa391818f, 0xa24ca220, 0x0000d867, 0x9bb89b15, 0x2cdc3f47, 0x8ce98cac, 0x0000e003,
+        0x2bea2b2f, 0xe3a5e9cc, 0xcd69cdd9, 0x00002f9a, 0x91da9130, 0xabf08e4a, 0x819a8132, 0x00005555, 0x727c728b, 0xf1dc918f, 0x69ad6942, 0x00008321,
+        0xb263b2d9, 0x45a1814b, 0x120f1287, 0x00003490, 0x988598fd, 0x060c0aa6, 0xc4a2c48b, 0x000080ff, 0x57b857ca, 0x904f9164, 0xc9fcc96d, 0x00007aa0,
+        0xee56eecb, 0x595d6eb1, 0x9202923f, 0x00007170, 0x17201709, 0xcbbbb3d8, 0x826c82c9, 0x00004610, 0x7820784c, 0xa0a1f93a, 0x804780bc, 0x0000e2e2,
+        0x8f158f66, 0x90cb7f8a, 0x3520351f, 0x000062f6, 0x0971096a, 0x7e558fa2, 0x6e066e5a, 0x0000ccdd, 0x2d3b2d96, 0x5acbaa79, 0xcf78cfeb, 0x00008b3a,
+        0x825a82f5, 0x0e1c3fb1, 0x951795e1, 0x000019a5, 0xae1faecc, 0x2db985b5, 0x53b7531c, 0x0000a896, 0x93db934e, 0x25a2e7e1, 0x31483137, 0x0000bad1,
+        0xf1dcf10c, 0x67efb6a7, 0xe432e459, 0x000095ea, 0x94d2940c, 0x50e6df87, 0x0c520cba, 0x00009ed7, 0x30ce30d3, 0xe4ffbdcb, 0xfb70fb4f, 0x00003a13,
+        0x0f4f0fac, 0x304cd3b6, 0xdc9edc9d, 0x00001f6e, 0xd135d109, 0x0cc656f3, 0x0a0f0af8, 0x00003a92, 0x4fca4f2b, 0xfa6e6145, 0x1850189a, 0x0000f9a1,
+        0x8964892f, 0x0747a6d4, 0xc62dc698, 0x0000a085, 0xedebede9, 0xad91a653, 0x99679990, 0x00007769, 0x6a5c6a2c, 0x9c5888d3, 0xa25aa20e, 0x0000ea86,
+        0x5ad35a31, 0xb03ee5e2, 0xa504a55b, 0x0000f4ec, 0xcd38cd4a, 0x6a2320f6, 0x612461a5, 0x0000c18d, 0x1bc91bc1, 0x1f3a1bb7, 0x2550259c, 0x00005284,
+        0x7ffa7f81, 0x07543eb1, 0x4b3f4b55, 0x0000ef49, 0x47ed47fc, 0xf86e7ec2, 0x63346363, 0x0000535b, 0xeec6eea0, 0x6bc29ca3, 0x456e453c, 0x00005784,
+        0xc05dc0d9, 0xda790685, 0xd64cd6d6, 0x000089be, 0xfb42fbe1, 0x697d71ab, 0x3ebc3ef8, 0x00008c60, 0x4697462a, 0x726ba687, 0x969596e4, 0x000051e8,
+        0x014601cc, 0xbedb2754, 0xd61fd63b, 0x00004a00, 0x628e6289, 0x4e39e94d, 0x144314d4, 0x00000172, 0x1bbe1bc4, 0x08d5d5cb, 0x55ac55fc, 0x00002859,
+        0x9a109a11, 0x6f7d89ef, 0x007d007d, 0x00005adc, 0x6ef06ea4, 0x30f566a4, 0x842b842f, 0x0000eeb4, 0x8a398ae8, 0x34b1ee8f, 0x2c5e2c5a, 0x0000412f,
+        0x6836686b, 0xac0d5f91, 0x55b7553e, 0x0000c840, 0x44b944e2, 0x80f781f3, 0xaa47aa22, 0x0000b701, 0x7b387b46, 0x3aba8a68, 0xf36ff365, 0x0000ec94,
+        0xfaa4fa95, 0xb8628f6e, 0x12f71243, 0x00005774, 0x02940256, 0x420728c1, 0xb554b55d, 0x0000426e, 0x8c298c6d, 0x38471df0, 0x13da1322, 0x00001dd3,
+        0x98be9896, 0x40b030a6, 0x8e278eef, 0x0000849d, 0x1b311bc9, 0x8998ab7c, 0xba40ba62, 0x000070b8, 0xd9c5d9f9, 0x01fbb986, 0x5cdb5cc8, 0x00000ab3,
+        0xc2adc275, 0x1f80c3a8, 0xbebabe42, 0x00002643, 0x9b1d9be8, 0xadceac40, 0x4ac14a70, 0x0000d687, 0xa327a3c6, 0x7f38e7dd, 0x043704ea, 0x0000f682,
+        0x19691942, 0x5cb953b1, 0xb000b090, 0x0000ba6a, 0xc5b7c5f7, 0x5e688529, 0x2b302b01, 0x000021b6, 0x2743274d, 0xfae7abc2, 0x6aff6a45, 0x000042d1,
+        0x4182415a, 0x80d91a0c, 0x627562b3, 0x0000f10f, 0xf9cdf9cd, 0xf45ccae3, 0x2169213f, 0x0000fdce, 0x80d88089, 0xba857ac2, 0x0c6f0ced, 0x0000ef48,
+        0x9a759a49, 0xe137b5fa, 0x24fe245d, 0x0000cf8d, 0xd3f7d3f5, 0x1655dc3c, 0xdb8ddb8d, 0x0000b4b2, 0x8a458a98, 0x61f33719, 0xcbc8cb56, 0x0000d549,
+        0xa6c2a62c, 0x7f59a2ce, 0xc3ecc30a, 0x0000c0e2, 0xab06ab49, 0x0d109cea, 0xe36de3eb, 0x0000fa38, 0xa4cba4fc, 0x91f147c4, 0xbe67bec9, 0x00000720,
+        0x1ded1d4f, 0x81c838f1, 0x66246650, 0x0000fe62, 0xf034f055, 0x45a2c40a, 0xd102d11f, 0x0000550c, 0x0d5f0def, 0xd24b3df2, 0x78d7782d, 0x0000a58a,
+        0x5863589d, 0xe08f20d6, 0xcc06ccde, 0x0000d1bb, 0x9794970b, 0x1cb16625, 0x586d58da, 0x0000bc6b, 0x64b864c3, 0x9f6976dc, 0x8f5e8ff4, 0x00008c1d,
+        0x7b607b65, 0x5b8ff88c, 0xfd62fd32, 0x0000e5d5, 0x2c2e2c9d, 0x8f98f1eb, 0x0f690f2d, 0x0000ac08, 0xf7e8f7b8, 0x84176f4b, 0xf588f5f6, 0x0000a718,
+        0x357b35a4, 0xbeecbb1a, 0x83a78344, 0x000078a3, 0x0d5e0dd4, 0x8c471851, 0xa616a64d, 0x0000f363, 0x5fc45f69, 0x635eddd4, 0x9dc19d35, 0x00004e66,
+        0x431043f2, 0x5a80697d, 0x26d62675, 0x00003082, 0x8be88bfc, 0x6250b1d8, 0xbf7abff5, 0x000053a7, 0x4dec4d12, 0xf45cccd8, 0xaf97afbe, 0x00008a60,
+        0x7cdf7c5c, 0xd82c3a4c, 0xd3b4d375, 0x0000b66b, 0xb8ebb831, 0x0d84b3a5, 0x982b988a, 0x00000c1c, 0xb5fdb511, 0x1dd638f1, 0xff4cffe4, 0x000000a1,
+        0xeed2ee86, 0xaa51ff43, 0x93199342, 0x0000d755, 0x68a268af, 0xafb06f32, 0xc4b5c43b, 0x0000da67, 0xddd2ddc5, 0xd9c833ce, 0x4c934c55, 0x00001016,
+        0xc322c3f9, 0x734ac5fd, 0x319c316f, 0x0000eeb6, 0x07d607d2, 0x28c03880, 0x696d6933, 0x0000d1bb, 0x4c004c9a, 0x9ae654cd, 0x43c54398, 0x00003607,
+        0xe5a6e52f, 0x950b9e08, 0xde8ddecc, 0x000012d7, 0x6c1e6c31, 0xdb2dcaa9, 0xb602b6a2, 0x0000e9cb, 0x7ce17ce4, 0xf2b836d1, 0x9e539e5c, 0x00003338,
+        0x1dc71d03, 0xbc8b7916, 0xef0eef00, 0x0000c412, 0x2b692b99, 0xd204f6dc, 0xc260c2f4, 0x0000b449, 0x55455554, 0xd9bf8158, 0x803b80f5, 0x00008390,
+        0xd00bd06a, 0x62e19783, 0x9e059e2c, 0x0000308c, 0x0acc0a99, 0x59b71d5c, 0xfaa9fa9d, 0x0000be10, 0xc694c640, 0x32fcbe4a, 0x3a4b3a94, 0x00002b3c,
+        0x4ed44ee2, 0xb474fa32, 0x7d8c7da1, 0x0000bc81, 0x5fb35fa3, 0xedfb1ed3, 0x146e14db, 0x00001602, 0x91029178, 0x02a54cf5, 0xcf84cffe, 0x000066e1,
+        0x0a4b0a04, 0x153ab140, 0x4da04de8, 0x000074b0, 0x31fd3154, 0xc9acb43f, 0xc6a5c641, 0x0000c532, 0x334b33f7, 0xb5a00669, 0x9dab9dac, 0x0000e6f5,
+        0xa714a730, 0xee7cf554, 0x0a970aef, 0x00002bbc, 0x47ec47a9, 0xa36a2509, 0x7a867a23, 0x0000bb47, 0x8a2c8aaf, 0x3da0d973, 0x6202624a, 0x000041f0,
+        0x7d5c7d47, 0x7dba3f71, 0xf736f79a, 0x0000970e, 0xf846f818, 0x3f11a014, 0x0c280cb0, 0x0000aba4, 0xa6fca6c9, 0x0ecbbb9d, 0x856685d1, 0x00002353,
+        0x479647cd, 0xf877675a, 0xc94fc980, 0x00006937, 0x14f51492, 0xa4c17f3f, 0x0c370c04, 0x00005854, 0xda4ada86, 0xed7965d9, 0xd37cd320, 0x0000c39f,
+        0x5ee85e4d, 0x9979e672, 0x256f25e0, 0x0000b9ce, 0xd0e4d016, 0xb1cc5e92, 0xe343e303, 0x0000958a, 0xcb02cb6c, 0x6dbf0761, 0x1be31ba0, 0x00005984,
+        0x49db496a, 0x28c0d548, 0x01fe01bc, 0x0000dd63, 0x0b180bb8, 0x7dc082cc, 0x5f845f96, 0x00005ad7, 0x082c0828, 0xf00d6bf5, 0x4e1d4ebc, 0x0000b141,
+        0x8d268d75, 0x88370a26, 0x251525c1, 0x000054b8, 0x594a5986, 0x2cd29675, 0x8c968c5b, 0x000016d7, 0x0a860ab6, 0xde2eed2a, 0xa0a6a0a8, 0x000024ba,
+        0xf554f54a, 0xf52b0ef9, 0xd773d78e, 0x0000f26b, 0xf99df9ee, 0x0ca3bc01, 0x0bd40bac, 0x00007673, 0x6d1e6da2, 0x28978990, 0x902390e0, 0x0000bd5d,
+        0xb202b278, 0x4d953882, 0x8eb88ec2, 0x00003582, 0xbb9dbbdb, 0xf96ecd2e, 0x1f7b1fc2, 0x0000eaf6, 0x476b47d0, 0xcbec0ab4, 0xace8ac0c, 0x00002aa5,
+        0xa386a32a, 0x8e988733, 0x877a873d, 0x000061f6, 0x35083525, 0x47262635, 0x1182119b, 0x0000fc73, 0x8aff8a59, 0xa2e16624, 0xb16fb1a0, 0x00004b48,
+        0x7aaf7a15, 0xa9025fed, 0xe757e7e7, 0x000098af, 0x44c84434, 0xb0041ba8, 0x951f9555, 0x0000b580, 0xaa30aa20, 0x744b5303, 0xe782e750, 0x00001c4c,
+        0x683768cf, 0xbdea41bd, 0x168b1625, 0x0000d96c, 0xfcc7fc29, 0x0c7da8c0, 0xe879e827, 0x0000d0da, 0xbeaebe3e, 0x6790eb80, 0xe4f2e4f0, 0x00001728,
+        0x270b2735, 0xfd473ead, 0xb248b2a9, 0x00001aeb, 0xa6d3a662, 0x8f98f92b, 0xcbaecb62, 0x0000860e, 0x30483083, 0xbc8a9453, 0xe312e3b3, 0x00002ccb,
+        0xacf2ac46, 0x60a1e03d, 0x7e587eda, 0x0000da66, 0xe338e305, 0x62500e59, 0xa247a2a6, 0x0000fa0c, 0x7aa27ab1, 0x8a272979, 0xc4a9c469, 0x00009f18,
+        0x7cda7c5b, 0xaaac3eff, 0x0cb40c3b, 0x00006f8b, 0x40484038, 0x7596a72d, 0x23c0230a, 0x0000a7f6, 0x8a788a62, 0xd82b3dc0, 0x943394dd, 0x0000a878,
+        0x965d962d, 0x5edd4fd6, 0xb8c1b8c2, 0x0000fac4, 0x99c499d7, 0x2aed9e2a, 0x1a8c1a7d, 0x000059d5, 0x18ac18a5, 0x724a8aa8, 0xc67bc62b, 0x000035cf,
+        0x4f534ff3, 0xfbce039c, 0xfc0efc08, 0x00003ec5, 0x4be74b15, 0xa59e88ac, 0x62f56236, 0x0000a140, 0x40ea4059, 0xeb0e201e, 0x6371630c, 0x0000fed2,
+        0x726872d2, 0xe8b1ec93, 0x72ef72b8, 0x00001b0d, 0xd970d993, 0xbd4bafed, 0x8f208f1c, 0x000070db, 0x5dc95d03, 0xfc86ebf3, 0xb522b56d, 0x0000be9e,
+        0x6cea6cd7, 0x4986f2d5, 0x4ecd4ec3, 0x000087c7, 0x37073745, 0xcb274f57, 0x921e9258, 0x0000a861, 0x64b36405, 0x9ce6b044, 0xbfbdbf12, 0x0000f51a,
+        0x5fb65fbb, 0xf45c1e21, 0xcd47cdf0, 0x0000695c, 0x4099408b, 0x85f7b61f, 0x836d83bb, 0x000010f7, 0x31f431f5, 0xb484e261, 0x7e547ecf, 0x0000cab0,
+        0x2dee2d1c, 0x0f069b57, 0xf27bf2eb, 0x000049d6, 0x63a1630b, 0x48065f98, 0x77d2773c, 0x00007931, 0xa37fa3bc, 0xf7574e01, 0x294329c6, 0x0000065d,
+        0x0df00d31, 0xa951c48b, 0x50bc5054, 0x0000b910, 0xdf25df99, 0xf5c2be8b, 0xe1aee164, 0x000088ca, 0xb3efb3b5, 0x34893620, 0x09a80915, 0x0000baf9,
+        0x7ef07e47, 0x57d894b1, 0x65fc65a4, 0x00001975, 0x395e3926, 0x22783331, 0xb702b7ca, 0x00001b7a, 0x90b39030, 0xf6e07350, 0xfe6bfe63, 0x0000b2c5,
+        0x8ad18a91, 0xb31b46f8, 0x75927528, 0x000024ea, 0x31df31d4, 0x90a6b1db, 0x311831aa, 0x00003e13, 0xac92ac73, 0x8928e0af, 0xd8f2d859, 0x0000d1eb,
+        0x1516156b, 0x49c68ce2, 0xf76df770, 0x0000ed99, 0x1aad1ab8, 0x4e376d4b, 0xbe40be14, 0x000088be, 0x35cd3505, 0x7fbcb098, 0xf62ff683, 0x000073b6,
+        0xf8d5f8d2, 0xcc6c3f99, 0x5e4d5ebc, 0x00000b30, 0x9b2d9be4, 0x8f64f9bd, 0x868e86bc, 0x00002fba, 0x2bde2b7b, 0xfb9b15c3, 0xbe07be8a, 0x0000f93e,
+        0xf514f579, 0x2ec0dc15, 0xaca5acaa, 0x00005474, 0x104b103a, 0x01f40139, 0xe47ae443, 0x000094ae, 0xb3f6b350, 0xe020ba44, 0x5774577b, 0x000092b4,
+        0xe25ce27c, 0x014409a6, 0x915e917b, 0x0000b77d, 0x5bdc5ba3, 0x91ecfcc5, 0xfc27fc29, 0x0000290a, 0x6418648a, 0x74edf4ec, 0x6fdc6f00, 0x000020cb,
+        0x09e009d9, 0x4a36d175, 0x223422b0, 0x0000cfee, 0xd658d6aa, 0xe6fcf0b7, 0xcfffcfb4, 0x00009bf6, 0xfde0fdc4, 0x7fc07622, 0x6d166d65, 0x00004820,
+        0x7433746d, 0xe6a34041, 0xa618a615, 0x00006200, 0x883b88f5, 0x29025bf6, 0x3dd63d9f, 0x0000f582, 0x5330535a, 0xe31e4d2a, 0x1ebe1e0e, 0x00009bae,
+        0x7ff57f84, 0x7c8f5d03, 0x274c27ab, 0x00000ee6, 0xc24fc252, 0x0ccbf2af, 0x2aa42a66, 0x0000a52a, 0x703070de, 0x1f8a365c, 0x86cd869d, 0x000003a1,
+        0x81008119, 0x32b25e5c, 0x72787233, 0x0000d77a, 0xdaf0da92, 0x6ba08e58, 0x15451502, 0x0000bcf1, 0xadc8adbf, 0xed586204, 0x99409942, 0x0000d462,
+        0x67546770, 0xe2313512, 0x3c093cb5, 0x00004cf2, 0xc98fc9e4, 0x5dc818a8, 0x97c19734, 0x00003ae6, 0xfbcffbd8, 0x754d1c32, 0xab66ab1f, 0x00000cbd,
+        0x82c382a8, 0xf55edb08, 0x60f960ef, 0x0000ba6f, 0x737a73bd, 0x1a40014b, 0x843d848d, 0x00006048, 0xdef8debc, 0xc3d4ffb8, 0xbb18bb25, 0x000069e1,
+        0xe712e768, 0x7358ab40, 0x8e8e8ea6, 0x0000cfc2, 0x35ae358d, 0xb2573542, 0x0e930e2e, 0x00009783, 0xb9afb9e5, 0x649ad925, 0xb837b873, 0x00003d06,
+        0x62d56271, 0xa06045d5, 0x118c1124, 0x00006fab, 0xe505e5db, 0xf8f756f0, 0xc706c7df, 0x0000dcfe, 0x0c4a0c2b, 0x2bc04183, 0x6a756a66, 0x0000d29a,
+        0x0d220d30, 0x46398230, 0x4ee34e5a, 0x0000c520, 0x771a77aa, 0x1aca1955, 0x0c540cb8, 0x0000165e, 0x63a96331, 0xa90d3e4f, 0x39ea399c, 0x0000f11e,
+        0x90209018, 0x1655dd15, 0x5164512a, 0x0000658b, 0xcd73cd3d, 0xb2380ff9, 0x48634882, 0x0000702e, 0xc2f1c2c1, 0x265879dd, 0x2f7b2fa4, 0x0000b249,
+        0x4b8b4bc3, 0x230e3e7b, 0xa3a7a3ec, 0x00001fd2, 0xa22da251, 0x835e61ea, 0x4ccb4c62, 0x0000fbfc, 0xa6a1a63d, 0x2f1fe1dc, 0x906c90af, 0x00003669,
+        0xe435e4fa, 0x6cc2f8d4, 0xab91ab8d, 0x00001c88, 0x53185376, 0x22707cfc, 0xda9dda8d, 0x00004c03, 0x791079cc, 0x66ad4f72, 0xf4a0f424, 0x00000c53,
+        0x61616179, 0xfe46e5dd, 0xe8d3e867, 0x00004711, 0x3ae53ae4, 0x0a24f37d, 0xb83eb8ce, 0x000013a5, 0xe821e820, 0x06fab660, 0xda4adae2, 0x00003553,
+        0x03bb03a5, 0xfd96e1d4, 0x99fd9927, 0x00009aa7, 0xa6dea6ad, 0x58170f46, 0x5f465fa5, 0x00003a13, 0x4cee4c2b, 0x118e9ce7, 0x186f18cc, 0x00007dbf,
+        0x286528e4, 0xe14c0ee6, 0x328332cf, 0x0000a8b9, 0x805180c9, 0xc17c72a9, 0x316e312f, 0x00006e98, 0xe268e246, 0x3f29eaf3, 0x979097a9, 0x0000c02d,
+        0xe641e6da, 0x0bcb79ff, 0xff7bff2d, 0x000095a7, 0xf69ff622, 0x48080074, 0x260226c5, 0x00003553, 0x91309124, 0x14aaaaf5, 0x6ca46c18, 0x0000711b,
+        0x25a82512, 0x30ceef4f, 0xb0b5b018, 0x0000af38, 0x7de87dc2, 0x8b260734, 0x95c29530, 0x0000b250, 0x444c4405, 0x68459478, 0x70b1705f, 0x00004f40,
+        0x09ae097b, 0x6c609e33, 0x704b7079, 0x0000c8a1, 0x8e3f8ee7, 0xf11845b2, 0x7468749c, 0x0000e632, 0xf720f7b8, 0xb5f78593, 0x83fa8322, 0x0000006f,
+        0xab5fab81, 0x0c1cea66, 0xccf5cc4b, 0x0000f4cb, 0x7803789b, 0x2d2dfac8, 0x4e574ea1, 0x0000d96c, 0x74eb7453, 0x326e9132, 0xa295a28c, 0x0000b28e,
+        0x1c4d1c92, 0x5a389738, 0x2531252a, 0x0000eb1b, 0x379137a4, 0x1e051189, 0x36973631, 0x0000f11f, 0x3c653c1c, 0xe663ed33, 0xdd20ddb0, 0x0000b8b1,
+        0x2f6d2fc2, 0xd4df2ce4, 0x5412540b, 0x00008d61, 0x506550c4, 0xf9493878, 0x48cc4888, 0x000003a0, 0xc8edc899, 0x2b631bd3, 0x08f70854, 0x0000a904,
+        0x2f3c2fd4, 0x51ed85f3, 0x857b85c2, 0x00002357, 0x055e05e5, 0x805e541a, 0xf46ef4c9, 0x000020a4, 0x71c5710f, 0x240f64a2, 0x1a7e1a86, 0x00008afa,
+        0xd380d33a, 0x6750dce5, 0x91b991f1, 0x00007e5e, 0xecc9ec55, 0x17dae6ed, 0x559b554e, 0x000019e3, 0xfa59fab7, 0x58ab2980, 0x614d6174, 0x000087c7,
+        0x79817900, 0x40da0048, 0xc641c6ae, 0x0000b313, 0x65c8655b, 0xf6e3b1d8, 0x37f43777, 0x00006c08, 0xbe1abe81, 0xb37f4c54, 0xc3f7c3aa, 0x00003e4c,
+        0x381e3821, 0x4746d1d4, 0x27362724, 0x0000f215, 0x383538b1, 0x5253dc57, 0x9e0e9e74, 0x0000d83b, 0x7ad07ac5, 0xb44bf14e, 0x837a833f, 0x000019cb,
+        0xeec2ee88, 0x2521d68a, 0x1ec21e8e, 0x00003822, 0x3cca3c71, 0x0684a70d, 0x637463b2, 0x0000c841, 0xc5ffc523, 0x69dcbe79, 0xfa04fa68, 0x00004d01,
+        0xf066f0a1, 0x6f7d1c67, 0x9d239d65, 0x00006190, 0xda3eda51, 0xfe57a2aa, 0xcba5cbcb, 0x0000eef6, 0xd000d0a3, 0x548c88ec, 0x0a020a9a, 0x00008c0e,
+        0xbc44bcfa, 0xfc3d54cc, 0xa763a78e, 0x0000bad1, 0xd47bd4ca, 0x6e7fb5b9, 0x6016606b, 0x00003824, 0xaf76af8f, 0xdc2f62db, 0xbe6bbec0, 0x00005277,
+        0xe94de938, 0x47465d91, 0xe8e6e88f, 0x0000f752, 0x8f258f55, 0x27b0643e, 0x6281623e, 0x0000be9c, 0xf459f43b, 0x2d80fb7b, 0x16861612, 0x0000a25d,
+        0xd270d271, 0xe4d3a8c0, 0x073f0705, 0x000082ef, 0x65b265ed, 0xd3cba2ed, 0x51775150, 0x0000af07, 0x83438327, 0xe1400a55, 0xdf20df3b, 0x0000f6ed,
+        0x591c592f, 0xf4c2ca67, 0xb75bb75e, 0x0000f61d, 0xafbbaf65, 0xc962ef3e, 0xd641d6c0, 0x0000cf8d, 0xcfdecfa9, 0x7debc071, 0xc947c908, 0x00008bef,
+        0x7eae7ecf, 0xe7e3f55d, 0x37b237ab, 0x0000d9eb, 0x5b2e5b2a, 0x8a2f766f, 0x0dac0d4f, 0x0000dada, 0x0d8c0df0, 0x5f538ea4, 0x9ed19e91, 0x0000e589,
+        0x8e838ece, 0xb4d96d6e, 0x1b6a1b9a, 0x00007efe, 0xeca9ec22, 0x55e6b696, 0x6d646d32, 0x0000599a, 0xca39ca97, 0xe11e2074, 0xd227d27a, 0x00008a9b,
+        0xb2a8b228, 0x21038aef, 0xf798f7d6, 0x0000c612, 0x82c082e7, 0x8cee2e8f, 0x95a09585, 0x0000bfba, 0xb3feb309, 0xa7becd2e, 0xf321f3b9, 0x0000fad2,
+        0x341d3476, 0x30ce1c52, 0x08ab0882, 0x00007ca3, 0xf5cbf551, 0xebf244b9, 0x9aa19af9, 0x000039a1, 0x724c7275, 0x5edd1ab3, 0x796879c3, 0x00005098,
+        0x0859087d, 0x92c9738f, 0x0f460f0e, 0x00007731, 0x23682345, 0x6780247f, 0x1b0b1b8f, 0x0000d587, 0x2a892a68, 0xe0f35ba3, 0xa4b0a409, 0x000014bf,
+        0xe602e65f, 0x366ea4ce, 0x435343b4, 0x00003282, 0x0130015b, 0xf5b84f2b, 0xa864a8bb, 0x0000a285, 0xcd9fcd15, 0x43853f4c, 0x683a6802, 0x00000970,
+        0xdb4bdb96, 0x4e363509, 0x8ee98eae, 0x0000e2f2, 0x1520150a, 0xbfea34ee, 0x4cd04ce9, 0x000004ed, 0xc160c18c, 0x988136ff, 0x4e7e4ed5, 0x000049d6,
+        0x5dde5d36, 0x0b244828, 0x280128ff, 0x00006251, 0x8df58d13, 0x1eb52271, 0xd927d9b1, 0x00006e35, 0x060e068f, 0x30f8a3e6, 0x788f7827, 0x000034dc,
+        0xd47ad46a, 0xc4ca8f5d, 0x692f6951, 0x000069b8, 0xf282f22e, 0xbf7560d6, 0xe537e507, 0x0000486e, 0xfb32fbc1, 0x1055f228, 0xff1eff25, 0x0000310a,
+        0xc1ebc1fa, 0x2bc2996c, 0x1da41dde, 0x0000a715, 0xdbf0db26, 0x4600b137, 0xa4d9a4ce, 0x000028ea, 0xc190c100, 0xd714bff2, 0x58115886, 0x00008ae4,
+        0x10b41038, 0x152f459c, 0x39f739b0, 0x00008128, 0x685c6896, 0xb7d8aa8a, 0x804b80ad, 0x0000ddc4, 0xfaa5fa22, 0x29dcadc3, 0x5ced5cbe, 0x0000455d,
+        0xe94fe93f, 0xdcf82c63, 0xd4fad4e1, 0x0000a514, 0xfe9afe6d, 0xb61b8517, 0xa0faa01d, 0x00002fca, 0x813381a1, 0xa981014b, 0xfef0fead, 0x0000422e,
+        0x0ed40eec, 0x6d7e32e0, 0x7f317fd2, 0x0000294a, 0x3680364f, 0xcda47a3c, 0xd25bd251, 0x0000e4ab, 0x778d7738, 0x80a171e7, 0x05fa0533, 0x0000aa47,
+        0x8eb38e9a, 0x22fe0fa6, 0x003a0077, 0x00009d90, 0x36cd3600, 0x934fed2a, 0x39f639b1, 0x00005f06, 0xff36ff5d, 0xf2493910, 0xcf6fcf0c, 0x0000b7b1,
+        0x46904643, 0xffb1b284, 0xbb38bb14, 0x00001fa5, 0x9fe79faf, 0x1bac1d6d, 0xe95de91f, 0x000035f3, 0x76d57605, 0x5c923563, 0xa969a9d9, 0x00006190,
+        0x1e8e1e5d, 0x4384b550, 0x26872665, 0x00006944, 0x874487b4, 0xbf03c4fe, 0x060206e1, 0x0000bf3e, 0x120f12c8, 0xfc0d3071, 0x9bcc9bf4, 0x00008f56,
+        0xdc2bdcc5, 0x772a41ad, 0xe5b0e5cd, 0x00002c3a, 0x56e0567f, 0x5f9f54fc, 0x3b183bb7, 0x00002863, 0x92b19246, 0x78736bca, 0x30f23052, 0x00000633,
+        0x37c9377f, 0x3ea6c48b, 0x66396650, 0x000045ba, 0x1d071dc5, 0xa7be95f2, 0x532853e6, 0x00000a2f, 0xf0c3f0c1, 0x35588bfe, 0x47cf4790, 0x00004acd,
+        0xf93bf922, 0x1377a433, 0x013501eb, 0x0000e5d5, 0x44ab4481, 0xf9d94f56, 0xbb84bb2d, 0x0000c78d, 0xb6ebb6f2, 0xf53dbd49, 0xaebcaede, 0x0000618b,
+        0x43dd430a, 0x0df483d0, 0x0d280da7, 0x0000abc1, 0x4d874d2b, 0xa9fdea0c, 0xc802c8a4, 0x0000bb10, 0xaba3ab53, 0x7c70a70c, 0x5d315dd2, 0x0000acb9,
+        0x5218525f, 0x891aa652, 0x6c926c59, 0x00003233, 0x67dc6724, 0x7c9311cf, 0xc11fc1b5, 0x00007d4e, 0x5b265baf, 0x7d6d6bcb, 0x6747676d, 0x00006791,
+        0xbc0fbcce, 0x244d9fa9, 0x53835325, 0x0000c3fd, 0x32c8320f, 0xe77fcfaf, 0x23de23c5, 0x00008331, 0xfa31fa36, 0x62d35533, 0x99bb9930, 0x0000f4bd,
+        0xddcadd7a, 0x7b74d0bb, 0x91f69148, 0x0000b1e5, 0xc7d4c78e, 0x6f1ab707, 0x445b446f, 0x0000e7a4, 0xfd4ffda8, 0x23edd609, 0xe081e0c5, 0x0000987e,
+        0x5a595a6c, 0x583a3ca7, 0x4ec14ec0, 0x00005abb, 0xeb3ceb8c, 0x87c850cd, 0x58d75867, 0x00002a04, 0x309e30dc, 0x4ca70745, 0x98c298c6, 0x00001a93,
+        0xafacaff2, 0x8a37feb8, 0xefbeef6c, 0x000095eb, 0x0ee00ee1, 0x83f7a9ab, 0x8c3d8cbe, 0x00007a61, 0xfd73fd1f, 0xe4ddf42e, 0x3181312f, 0x00000bb3,
+        0x4abe4aca, 0xbda9fa8d, 0xdeacdeed, 0x00000e0d, 0x0ef40eeb, 0xf8ec759d, 0x7b637bdf, 0x0000064e, 0x14111444, 0xd4140e0b, 0xb7dbb70e, 0x00006f2a,
+        0x8a218a6c, 0xf25a5032, 0xe39ce363, 0x0000e1ca, 0xfa78faee, 0x3202514f, 0x5d805da5, 0x0000a577, 0xe33ce3a0, 0x6790d7c8, 0xdb87dbf3, 0x0000beee,
+        0x713071a6, 0x12f91f98, 0xd726d7c1, 0x00004b6a, 0x55995572, 0xbf4b39ce, 0x342234ee, 0x0000bac6, 0x7ffd7fe9, 0x8dd6c3ba, 0xf31bf386, 0x0000bf9e,
+        0x0c600c8e, 0xb303b3e7, 0x8c7d8c3f, 0x000087be, 0x9fc89f6f, 0x74da3760, 0x0c2a0cd7, 0x000009b3, 0x8ffb8faa, 0x7f469e55, 0xce62ce7d, 0x00002aea,
+        0x0ab40a2d, 0x3ddff9c8, 0x9644966c, 0x00003004, 0x9a5d9a6c, 0x0124d9bc, 0x366836e9, 0x0000fafb, 0x2de02d40, 0x0bb5ec33, 0xfa7bfa97, 0x0000a861,
+        0x3a6c3a59, 0x34b1796f, 0x689a683f, 0x0000c02c, 0x4fde4f29, 0x4b365838, 0x5d4e5dfe, 0x0000eb9b, 0xdf24df29, 0x88c7463a, 0x524152e3, 0x00007d5e,
+        0x18ed187c, 0x684e4ead, 0x8037805c, 0x0000b4f1, 0xcbd7cb6c, 0xb39c7253, 0xba00ba60, 0x0000d1ba, 0x7b7d7bbc, 0x0bcbec12, 0x772c7740, 0x0000460b,
+        0x95fa9533, 0x2bc2f6c8, 0x796d79c1, 0x0000289a, 0x9f239fa1, 0x1370315d, 0x3669364a, 0x00006586, 0x4cf34ce8, 0xff49cc7c, 0xb693b6bf, 0x0000e5d2,
+        0xfe58fe15, 0xd2d70d46, 0xfa06fa52, 0x00003a9f, 0xf7f1f7d5, 0xe0f23410, 0x327c3254, 0x00000e5d, 0x70f37085, 0x06e4d5b5, 0xd316d3e5, 0x0000f6cb,
+        0x76f27671, 0x2b9c2fe5, 0x37603732, 0x0000bed1, 0xec78ec8d, 0x390273d2, 0xfa74fa96, 0x0000c0ec, 0x86448627, 0xad317848, 0x576d5759, 0x0000da67,
+        0x7e737e17, 0xb2d08d9e, 0xfac6fa71, 0x0000d993, 0xde0dde1e, 0x45d65759, 0x6c746c0c, 0x00000ff9, 0x1c971ce2, 0xbc2778ab, 0x8b0b8bbb, 0x00006435,
+        0xd042d07d, 0xbc1bfd3b, 0x48a6482c, 0x00002275, 0x241d2439, 0x452608a6, 0xe239e258, 0x0000e6d2, 0x9ea19eef, 0x55754e7c, 0x80a280ab, 0x00003aed,
+        0xfe97fe54, 0x77cf585c, 0x08c308f4, 0x00005484, 0xeb19eb9e, 0x162ac599, 0x33dc3335, 0x00006030, 0x46eb46ed, 0xc3c20955, 0xd3dbd371, 0x000099a8,
+        0x4af34a6f, 0x1c810711, 0xc109c119, 0x0000d818, 0xd337d3f9, 0x2e41fbd4, 0xe562e574, 0x0000cc52, 0xefc2efab, 0xab9434e4, 0x701f7086, 0x00006e7f,
+        0xc95ec959, 0x8e475f20, 0xe47ce443, 0x0000e7e2, 0x2da02db6, 0x20cf6f6b, 0x472247a8, 0x0000a965, 0xcf15cf16, 0x6f80e150, 0x75af75a5, 0x00002ef8,
+        0x38363875, 0x8ff778b7, 0xc3b7c30a, 0x0000d0bb, 0xcbe2cb39, 0xa361283b, 0xe990e935, 0x00008880, 0x1c6f1ce1, 0x7a0bf197, 0xc35dc3e8, 0x0000b4a8,
+        0xca5ecae2, 0xb2286989, 0xac99accf, 0x00009c78, 0x20c42046, 0xc3559e9a, 0x9761975d, 0x0000c5b2, 0x26a02613, 0x544e581a, 0xa779a73d, 0x0000c5f2,
+        0xeb01ebec, 0x62b30ef9, 0xe946e903, 0x0000936c, 0xaa77aa46, 0x61504cdf, 0xaa4daa29, 0x00000a72, 0x1c0e1c6b, 0x5f1d096f, 0x8e5f8ee2, 0x00009ec9,
+        0xdfd3df2f, 0x09248fda, 0xd529d517, 0x00004f48, 0x6d606de6, 0xdd8acc31, 0xb205b253, 0x00005399, 0x814481b7, 0xe0f2f83a, 0xf4d0f434, 0x0000b901,
+        0x4f164fab, 0x5d9f82ce, 0x4c3e4c54, 0x00002fea, 0x8067802d, 0x4d70a903, 0xac09ac77, 0x00002735, 0xf7e2f740, 0x038bdea4, 0x92e89202, 0x00004d12,
+        0x1cab1c58, 0x7afa474f, 0x9ad89a64, 0x0000616b, 0x77e1771b, 0x51e7e198, 0xdc40dc95, 0x0000977b, 0x616d615e, 0xd7ab5ae0, 0xf91ef954, 0x0000fac4,
+        0x4cb44c51, 0xc0d6c07a, 0xb82db86b, 0x000048a0, 0x501350a4, 0x9cbce4da, 0xd2a3d2a4, 0x00005479, 0x28872894, 0x62cd9227, 0x89008942, 0x000068d5,
+        0x9b219b3b, 0x5ab7e45d, 0xdef0de9c, 0x00001080, 0x898589d4, 0xff4e4bd5, 0xe946e9ce, 0x00004d01, 0x23eb236a, 0xd9088300, 0x33a03312, 0x0000c25e,
+        0xcb91cb39, 0x508c11fd, 0x058d0517, 0x00008c61, 0x9fdb9f42, 0x072613cc, 0xd6a4d613, 0x0000817c, 0x38fb3858, 0xdb386320, 0xb4c9b465, 0x000032cf,
+        0x845a8484, 0xfff99153, 0xb840b8af, 0x00001fca, 0x4687461d, 0xa1a1cfa5, 0x4e1c4ec2, 0x00006646, 0x62af6245, 0x0b9b5e13, 0x5db95d86, 0x00000f1c,
+        0x7ba47bb8, 0xcc27ad40, 0x867e86d5, 0x0000f0d3, 0x339c338b, 0xfd0199aa, 0xb396b3d3, 0x00005c50, 0x4fd94f17, 0x974ca053, 0x92d49299, 0x0000ba71,
+        0x42904256, 0x67c3cad8, 0xbb8abbae, 0x00005c2b, 0x05ca051e, 0x487b4a24, 0xd4e6d43d, 0x0000f73c, 0x2b2f2bf0, 0x56f0ba15, 0x8e2c8e25, 0x0000a49e,
+        0x49b9494d, 0x1c4ad476, 0x0cb60c85, 0x0000a628, 0xe899e86a, 0xab7b570d, 0x7e927ec5, 0x00009dae, 0x7c557cd3, 0x57071165, 0x985c98fb, 0x0000ea75,
+        0x3a1f3a33, 0xf948fcbc, 0x8b178b43, 0x00005e29, 0x25d62551, 0xc65dfd3a, 0xd4f9d4bf, 0x0000cf4b, 0xabf0ab15, 0x3d9a70b6, 0xce70ce3f, 0x0000928a,
+        0x041a04c6, 0x67ba1e65, 0xff70ff4d, 0x000092b9, 0xe5a8e52f, 0xdb543580, 0x0a750a57, 0x0000ac65, 0xc4e4c400, 0xdb3c0ca2, 0xf21df2db, 0x00003f33,
+        0x96a096d0, 0x85f7f057, 0x67666732, 0x0000051c, 0x3f303fa3, 0x4de8875f, 0x1197112b, 0x00008e2f, 0x22ac22ff, 0xd04f38f0, 0x7c3d7cc0, 0x000071ee,
+        0x931993d5, 0x53c6a77f, 0xa4d6a4b8, 0x0000d8b7, 0x041e04e9, 0x9269f84e, 0x0677064e, 0x0000ea69, 0x4649464a, 0x00fb6975, 0x40884005, 0x0000ad4b,
+        0x1a6c1ac1, 0x9a41b1d0, 0xd2cfd266, 0x000038af, 0x77517731, 0x4c5fe127, 0x2951295d, 0x0000f373, 0x7c107c81, 0x83c80691, 0x95009542, 0x00001c4c,
+        0x22d62206, 0xae835132, 0x6c5a6c62, 0x0000e345, 0xf971f98f, 0x81274b5c, 0x964a9606, 0x00006aca, 0x1edd1e84, 0x4c5f1b53, 0xeb2beb95, 0x00000e5d,
+        0x3c043ce6, 0x61155ce2, 0x6aa36ad5, 0x0000bea0, 0x06f806dc, 0xd71e02d7, 0x1c661c4b, 0x0000f404, 0xecfceca1, 0x865e6de3, 0x704270ff, 0x0000067f,
+        0xc5e7c5f5, 0x647fd8e6, 0x864486b1, 0x0000f1d2, 0x87df8735, 0xd826b76a, 0xeaa2eac1, 0x00004411, 0x98bb9801, 0x63d114b9, 0xde94de32, 0x00002b3a,
+        0x99bf99fd, 0x7173e37d, 0xbcf4bc0d, 0x0000bc2f, 0xb150b1cc, 0x399a97c5, 0xb3b1b37a, 0x0000f652, 0x0fa70fde, 0xd4b04bca, 0xbf6bbf64, 0x00008f56,
+        0xe81ae8e4, 0x9eefded2, 0x09c80930, 0x0000db29, 0xc159c156, 0x12d811c2, 0x3b813b7f, 0x00005484, 0x48cb4864, 0x359a4b29, 0xd66ad6d9, 0x00000d3e,
+        0xdaa2dac0, 0x5b079fd7, 0x49344977, 0x0000fad2, 0x082d082d, 0x6410a25d, 0x5dd95d4b, 0x0000b95b, 0x7c417cf5, 0xc71550cd, 0x0c320c5d, 0x00006a15,
+        0x85688571, 0x38506c45, 0x8a5f8ac4, 0x00006832, 0x79c47940, 0x8324d285, 0xfa03fa0c, 0x000034f1, 0x9d589d11, 0xdd38fc47, 0xb1a3b1fb, 0x0000a7d8,
+        0x3df03d09, 0xd8e45b06, 0xa7d9a78f, 0x0000475c, 0xbf1bbf5a, 0x067beeb3, 0x6aff6ad6, 0x0000a7b9, 0x5cfc5c11, 0x8f980ca5, 0x8b0a8b9b, 0x0000ed4b,
+        0x68b568ed, 0x1dd6143e, 0x3a363a30, 0x00006731, 0x7fea7f57, 0x95ca5b23, 0x1c941ce7, 0x0000a4e9, 0xff7dffaf, 0x5c93de59, 0x3c493cde, 0x000089fa,
+        0xae48ae73, 0xdab0463a, 0xeac8ea1d, 0x0000f3f1, 0x868b8625, 0x4eb5c1fd, 0xaf84af4a, 0x000002b3, 0xe43ce4c1, 0x3bc39243, 0xc30ac31a, 0x00004b8f,
+        0xcfe6cf5c, 0x76cd66ca, 0xf0aff018, 0x00008073, 0x4b134b79, 0x5b296320, 0xe890e839, 0x0000d734, 0xe6bde665, 0x4b3681cc, 0x19c219ee, 0x0000bc85,
+        0x137f13ff, 0xe0f22c6b, 0x914a9145, 0x000082e1, 0x57f157c6, 0x558ccc89, 0x5bb75bb1, 0x0000330a, 0x5eae5ec0, 0xd91499aa, 0x5dda5d4a, 0x00007141,
+        0xb75cb79e, 0x101c0d58, 0x979197ab, 0x00001dd3, 0x0d610dbd, 0x2e53c344, 0x8d288d72, 0x00006a96, 0x6a0a6a48, 0x0b26d734, 0x7f557f5f, 0x00008d11,
+        0x11c211f0, 0xe6dc9cd7, 0x108c102d, 0x0000c710, 0x5a085ae1, 0x024412de, 0x83cd83e9, 0x0000b609, 0xc8e2c8c9, 0x983b50cd, 0x7c9f7c6a, 0x000073f3,
+        0xcd2acdbe, 0x7c122c16, 0x2b302bab, 0x0000c62d, 0xefc9ef8f, 0x1c30f0a9, 0x9b329b7d, 0x0000b935, 0x40f54089, 0xbd0306f4, 0xf166f1a8, 0x000040f4,
+        0xb134b136, 0x84f78270, 0xf941f94c, 0x00002aa9, 0x5d655dbc, 0x4ef6cea9, 0xc837c892, 0x0000f3b3, 0xe22ee272, 0xa1412bbf, 0xe0f3e0fb, 0x000090e1,
+        0xe4bbe4f1, 0x3ff8a5ed, 0x96bc9632, 0x0000b305, 0xd4a2d4e0, 0x05b3dfd9, 0xebeeeba4, 0x00005e23, 0x7d7e7d9b, 0xaaba76cd, 0xe31be3fc, 0x0000870e,
+        0x195219da, 0x14b1a42d, 0x92ee92ef, 0x00009619, 0x450d4560, 0x029bd13b, 0xab4dabbe, 0x00004fcc, 0xcb17cb10, 0xcf05e2d3, 0x04de0482, 0x0000472f,
+        0x2b822b5d, 0x1d2f24e9, 0x27e027ef, 0x000060af, 0x3fd63fa3, 0x57f047a6, 0x195619a7, 0x00005aba, 0xae7faeb7, 0x4e250ba6, 0x068d068c, 0x0000ccc6,
+        0x6c366c2e, 0x61d18070, 0x03f1035c, 0x000057b8, 0x774b7702, 0x376b43f5, 0x6ef96ef2, 0x00001cca, 0x059b0515, 0x39e0a454, 0x3d9d3dc0, 0x0000f50c,
+        0x3d233dc4, 0x8e677817, 0x041504d7, 0x0000b2f1, 0xa41ca48b, 0x1555a313, 0xbf95bf19, 0x00004eb7, 0xe42ee4c1, 0xf011fd47, 0x8f9d8f85, 0x00008f1e,
+        0xde33de09, 0x8c796eb6, 0xb59cb5b7, 0x0000cefc, 0x78d278ed, 0x16da853d, 0x5a3d5ae5, 0x0000ba58, 0x2a522a03, 0xae1acad0, 0xde8edecc, 0x0000cbab,
+        0x1fc21f10, 0xbddb39ce, 0x5cfa5c17, 0x00001416, 0x55a05550, 0x9d3b2dba, 0x2e002ecb, 0x0000a008, 0xfba9fbbc, 0x5078af88, 0xf4c6f4c4, 0x00005599,
+        0x6d4c6d6a, 0x4f5dc767, 0x77997767, 0x0000f61d, 0x0e260e36, 0x68c3114a, 0xf509f515, 0x00000ff0, 0xdc57dc9c, 0x939ed8d8, 0x53fc5322, 0x0000d3a5,
+        0x18a1184b, 0xa07c49dd, 0xda69da4c, 0x00009619, 0xa3b4a3f3, 0x57731336, 0xc7d9c7cc, 0x000077ee, 0xa2cea21a, 0x63e17ddd, 0xae33ae7c, 0x0000358c,
+        0xcdf4cd9a, 0xea5c0939, 0x714071ba, 0x0000c4cd, 0x4eff4ee9, 0xfd1e461d, 0x696e6935, 0x0000464f, 0x171e1741, 0x5878e2ed, 0xadcead7e, 0x00007423,
+        0xf85af8a8, 0x4a7fee81, 0xf330f39b, 0x00005fd8, 0xe516e59f, 0xdc043f20, 0xeaf9ea90, 0x000022e7, 0x07f50765, 0x0ea92bfb, 0x51f25157, 0x000030b5,
+        0xbba5bb11, 0x56326a7a, 0x0a690aab, 0x0000182a, 0xde0ddee5, 0xb9c27d62, 0xf2f5f2a9, 0x000014b5, 0x8c7d8c93, 0x1f4d01d6, 0xff8fff25, 0x00003a12,
+        0x66cf6696, 0x6600a52f, 0xd2f4d20c, 0x000039ed, 0x647064b7, 0xe958b3a4, 0x3e2e3e75, 0x00006591, 0x8d568d7c, 0x4af680a7, 0xf230f2c9, 0x000061ec,
+        0xcee4ceb8, 0x501dd674, 0x190319d6, 0x000026de, 0x972a9763, 0xdc2efd46, 0x3b1a3bc4, 0x00002ef9, 0xb7d7b7cd, 0x8f6e1686, 0x827782d8, 0x00006a5c,
+        0x53015336, 0xc624b287, 0x02560283, 0x0000af98, 0xe294e216, 0x283d98aa, 0xd1a5d17e, 0x00000733, 0x05fe05aa, 0xb8a9a752, 0xf748f786, 0x0000f501,
+        0x00e60003, 0x3c9a16fd, 0xed66ed3d, 0x000033f4, 0xcaf3ca03, 0xfa49639f, 0x32a232e7, 0x00003423, 0x171c17fc, 0x54b29545, 0x3f913ff8, 0x00002556,
+        0x166d1643, 0x27509ad0, 0x489748fb, 0x00009801, 0xe102e1fc, 0x220f5048, 0xf9b4f959, 0x00009c85, 0xb642b66d, 0x1b056400, 0xeb90eb3b, 0x00006db4,
+        0xfb94fbdf, 0xf7f46ab4, 0x232c23f2, 0x00003bf9, 0xa419a451, 0xae9a5509, 0x8cce8c27, 0x00008c22, 0x444e4493, 0x16c5f84e, 0x726772e2, 0x0000d5a5,
+        0x7a397a67, 0xe2c1fbc5, 0x493c49de, 0x0000713e, 0x45a44545, 0xbc2a288e, 0x7d407da4, 0x00001128, 0xcebdcecb, 0x8717c687, 0x025b0251, 0x0000a677,
+        0x9161915c, 0x58ad7ff4, 0x20742077, 0x00003c32, 0xddbbdd3e, 0xd7e5f2d7, 0x057105c7, 0x00005774, 0xe57ce5ae, 0x62b10061, 0x7eac7e99, 0x00004290,
+        0xf579f508, 0x94f15de9, 0xc730c7ff, 0x00001b7b, 0xae32ae22, 0x9d9352ba, 0xd954d9fd, 0x0000e0ca, 0xbc6fbce3, 0xb68affc6, 0x33e633ed, 0x0000f26e,
+        0xa10ca1ab, 0xa5f23dce, 0x518551c8, 0x0000a01c, 0x7fe17f0d, 0x0f68b958, 0x1c5c1c19, 0x000031e2, 0xd88cd86f, 0xb0cc304a, 0x7b1a7bdb, 0x0000338c,
+        0xfcdafc80, 0xf07c1b53, 0x61ae6107, 0x00001f51, 0xe603e625, 0x36cf0a5b, 0x1e291e2c, 0x00001f3c, 0xad3cadb5, 0xe9a47d68, 0x673b6714, 0x00008880,
+        0xc0f5c049, 0x30cf3bf0, 0x1dbb1d92, 0x0000b636, 0x3193310a, 0xb0bbd787, 0xadccad8d, 0x00003960, 0x84c68440, 0x230d4d3e, 0x7ce47c44, 0x0000b105,
+        0x8cb38cea, 0x17ba1df3, 0x352035af, 0x000063d0, 0xc4b1c4fe, 0xf073d149, 0xd846d81e, 0x0000d1bb, 0xd781d78a, 0x8e1703b3, 0x789e7842, 0x0000beef,
+        0x5b8a5bd6, 0x6f1a7bb9, 0x57f557b8, 0x00008690, 0x783578a7, 0xee9332e3, 0x8fd98f94, 0x0000f638, 0xafcdaf2d, 0xb2eb0437, 0x27dc27f1, 0x0000a58b,
+        0x22fd222a, 0x76cf853e, 0xf1e5f10b, 0x0000f3b3, 0x3eec3ed2, 0xbfe3710e, 0x974797b9, 0x0000c012, 0x07300728, 0xc50bf525, 0x6e366e12, 0x0000a6ea,
+        0x8082808a, 0x3f878bfe, 0xfea1fe10, 0x0000ca10, 0x6b086b46, 0xe3202b45, 0x06ff06ae, 0x0000c5b1, 0xccf4cc6d, 0x7add3728, 0xf41af4ea, 0x0000c90b,
+        0xbe16be3f, 0xc085f3ac, 0xb859b8aa, 0x0000d049, 0xace7ac1f, 0xd94480cf, 0xa1c1a1ec, 0x0000404f, 0x7f9a7f2a, 0xd08bef58, 0xc354c309, 0x0000bd1a,
+        0x00ff0044, 0x004a92c7, 0xa527a513, 0x0000858e, 0x68cc689f, 0xfb1685f3, 0xef9fefec, 0x000033b6, 0xee9eee4e, 0x47c636bf, 0xef19efc8, 0x000016cb,
+        0x99c7995f, 0x2ea37dc2, 0xb86ab87a, 0x0000c3d0, 0x507750a1, 0x2ff6b84a, 0x14301423, 0x0000d005, 0x295429ed, 0xb124cd68, 0x3e6e3e95, 0x00008361,
+        0x272727f7, 0xb8719f27, 0x21ee21bf, 0x00004b9f, 0x8411841b, 0x6033702d, 0x721f72a6, 0x0000dc43, 0xf801f89e, 0xda3b99d4, 0xb84ab888, 0x00002cf9,
+        0xfdbffd80, 0x44f9262b, 0x314b31f6, 0x0000dc21, 0x0b090b9a, 0x7a7e7719, 0xefb8ef6c, 0x00004fb4, 0x438343eb, 0x0566e9cc, 0x8f428fa4, 0x0000d23b,
+        0x33e333fd, 0xbf0361d4, 0xb94ab9ed, 0x0000fe4c, 0x647164df, 0xb0bdf206, 0xce18cec2, 0x00002ec6, 0x3e203e31, 0xc8a56a0d, 0x7e697e22, 0x000000c4,
+        0xd6aed664, 0x26a26d7d, 0x91f2914d, 0x0000d049, 0xebd2eb47, 0x8bc4ed3c, 0x99ad99a9, 0x00001165, 0x80fa8052, 0x487d9913, 0x936a9380, 0x0000bd9e,
+        0x53f9533b, 0x4814d405, 0x57cf57a7, 0x00007030, 0x4cd24c30, 0x87a98fa0, 0xc50ec51e, 0x0000a375, 0x6e6d6ecd, 0x98f7817d, 0x4888480a, 0x0000d888,
+        0x580158a4, 0x10cba66c, 0x659265b2, 0x0000fe4d, 0x4f804fef, 0xb3934748, 0x618361a1, 0x00002da5, 0xad6baddd, 0x4f36f588, 0xa22da22f, 0x0000610f,
+        0xc0d2c036, 0x60b2c317, 0x1435147d, 0x00001436, 0xcf51cf1f, 0x406533df, 0x689968c9, 0x00002f66, 0xa531a5d8, 0x085c99e8, 0x9c399ce8, 0x00001dac,
+        0x7aac7ace, 0x32e09862, 0x4a464ad4, 0x0000b013, 0x4a2f4a92, 0x921082fe, 0x412341b2, 0x00006823, 0xbb36bb08, 0x8df8d901, 0xd16dd11e, 0x0000f5fb,
+        0xc0a2c08b, 0x6672a164, 0x91139183, 0x00000ccf, 0x59975985, 0xd3b4fe06, 0x339e3342, 0x00003e13, 0xdf9ddf25, 0x42c57c83, 0x279227e2, 0x0000afee,
+        0x32263288, 0x52e7b1c3, 0xeb27eb05, 0x00001095, 0xecf6ec13, 0x371715bc, 0x29132911, 0x00007930, 0x137d1344, 0xf09bf93b, 0x01e801b7, 0x00004914,
+        0xe4d1e489, 0x40c617c1, 0x32ec323e, 0x0000ca7e, 0xb2e3b20c, 0xf7eb7567, 0x70f070f3, 0x0000a966, 0x983b98a3, 0x49e1ced7, 0x896289d0, 0x000000bd,
+        0xa619a607, 0x200f5922, 0xbbfcbb6a, 0x0000731b, 0xf020f0b7, 0x0cc6b30f, 0x483448a9, 0x000062d0, 0x78ef7857, 0x49c98a53, 0xae39ae36, 0x0000c593,
+        0x0eed0edc, 0x7dbabf87, 0x33b8339c, 0x0000ddcc, 0x24fd24e0, 0x62b387cc, 0x5365532d, 0x0000d59a, 0x8cbb8c92, 0xb9f781a5, 0x9f8f9f5d, 0x00004977,
+        0xd581d576, 0xd4544d37, 0x37a5379b, 0x00004a42, 0xed9dedcb, 0x1fda0336, 0xb72eb748, 0x000020db, 0x9348930b, 0x3598b126, 0xe6b3e6b6, 0x000031ab,
+        0xea0cea7a, 0x36198954, 0x227422b4, 0x0000b542, 0x01c60122, 0x0ecb1115, 0x616761b4, 0x0000b701, 0xf842f83a, 0x03f4a9c1, 0xce48ce17, 0x00002936,
+        0x2d192df6, 0xd69208f9, 0x6dd26d98, 0x0000e817, 0x85858526, 0x6d7e396c, 0x4e8c4ebc, 0x0000ab25, 0xfb95fbe9, 0xb362a9fc, 0x2e6f2e66, 0x00002d49,
+        0xd662d6ab, 0xe830e931, 0x62a362e6, 0x0000a11c, 0x424f42f7, 0x2120766f, 0x45324518, 0x000010bf, 0x84d1846e, 0xdc8f73d0, 0x23fa2340, 0x0000b2af,
+        0x52df52a1, 0xfa4999e8, 0xc737c7e6, 0x00005598, 0x39b73954, 0x8c1b9ce7, 0x756a75ac, 0x0000a139, 0xaa37aa97, 0xcda5d5a3, 0x79f579b6, 0x0000dfc4,
+        0xb078b03f, 0x05679de1, 0xa84ea894, 0x00005054, 0x8a398aed, 0x731227bf, 0xd95ad9af, 0x0000f4d2, 0x473447f6, 0x3edae7e1, 0x076907ee, 0x0000ba91,
+        0x42a8426d, 0x62cd42ed, 0x47b2479b, 0x0000df74, 0xa289a2fb, 0x240f76a8, 0xb274b288, 0x000067d4, 0xb2d8b2bf, 0xedf9a652, 0xf668f630, 0x000007ac,
+        0x4cfc4cde, 0xc5257c8a, 0x5ddf5da9, 0x0000bc2e, 0x0325037d, 0x7d2b0da7, 0x942e940e, 0x0000fb72, 0xcae5ca64, 0x9268732c, 0xc4fcc4b7, 0x0000d953,
+        0xadf6ad8f, 0x2480a1a4, 0x047104cf, 0x0000289b, 0xce2bce4c, 0x0c5c8bd0, 0x6ab46aea, 0x000005fc, 0x6bb16b1d, 0x0144d235, 0x394d39b5, 0x000033b2,
+        0x9c239c19, 0xfdf9dba5, 0xbeb7bec3, 0x0000d7c7, 0xdb0edbba, 0x9c3bae35, 0x86c4862b, 0x0000b476, 0x6b1c6b69, 0x25a2d50a, 0xd8a0d8e8, 0x00004a6e,
+        0x889c8877, 0x6c0abdc9, 0x66256650, 0x00002738, 0x68cd6805, 0xda76335f, 0x8ac58a7c, 0x00004acc, 0x1c581c0e, 0xa6e54625, 0xd5e1d56a, 0x00008925,
+        0xeb00eb51, 0xef584c96, 0x3bdf3b64, 0x00002da9, 0xb53db500, 0x5c0df9ac, 0xd367d31f, 0x00005046, 0x9e1f9e23, 0xa6a1b110, 0x887488ab, 0x00003bfd,
+        0xb728b79d, 0x4246296d, 0xe31be32f, 0x0000b2ac, 0x07460796, 0x45d100f4, 0xe946e906, 0x0000aedb, 0xbf24bf5c, 0x47a63410, 0x8ba18bb0, 0x00007fb0,
+        0xb5e7b54b, 0xf8195383, 0xb8c4b83b, 0x000012bf, 0x536b5306, 0xe247726f, 0x44274434, 0x0000c513, 0xefd5ef88, 0x1d419c98, 0x2b532b06, 0x00008e90,
+        0x37fa3747, 0x2812ee17, 0x322c324b, 0x0000cff1, 0x70df7099, 0x9bcfc8d8, 0x03eb0311, 0x00003e6c, 0xbdc3bdb1, 0x40864204, 0xf9fff9e8, 0x0000e00c,
+        0x02da02c8, 0x077b9ce3, 0xf084f0d7, 0x0000cc06, 0xa81ba8bb, 0x6170f1e8, 0xcf16cf93, 0x000044ef, 0x66e76684, 0x0e7c67da, 0x0fb80f06, 0x0000f073,
+        0x772f77c3, 0x19158517, 0xb513b546, 0x000070fe, 0x982998c2, 0x79e5b6e7, 0x0110012f, 0x00008462, 0xec7fecda, 0x83e354b1, 0x562956ea, 0x000084e0,
+        0x252025fc, 0xdc7c6403, 0x733c73de, 0x000023ac, 0x57f657d8, 0xb92c2c94, 0x211321fe, 0x0000a81e, 0x31c03122, 0xf68d8582, 0xe312e3f1, 0x0000ff63,
+        0xe682e672, 0x270f502b, 0xda6cda6d, 0x00003f38, 0x05dd05d1, 0x4b0508d7, 0x950c95ae, 0x0000242c, 0x4ff24f8e, 0x694cd0e8, 0xe826e822, 0x00002b38,
+        0x36263683, 0x2903649b, 0xd501d567, 0x0000a03c, 0x797f7983, 0x4a86fcbe, 0xa35aa3f8, 0x00001253, 0x3f393fa7, 0x3d59e83e, 0x1c9c1cfa, 0x000034ab,
+        0xd550d534, 0xa6a19ff7, 0xe04ae033, 0x000011a8, 0x3c613c1c, 0x5dc9cdec, 0xd677d6d8, 0x00001216, 0x85cc85ba, 0x9f070985, 0xe827e833, 0x0000cd94,
+        0xff33ff5b, 0xdcf98aac, 0x0d850d77, 0x000079e1, 0xc53ec589, 0xa1413d80, 0x136d139b, 0x000093b7, 0x6a906ad6, 0x485673d2, 0xd094d031, 0x0000a5b5,
+        0xa669a66d, 0x1c329dbe, 0x2fe72f5e, 0x0000a055, 0x6b636b1f, 0x940b732c, 0x958995a7, 0x00003a13, 0x0c8d0c60, 0x852829f9, 0x00be00a6, 0x0000dfb9,
+        0x330b3354, 0x57b24ce9, 0x84158441, 0x0000d7a5, 0x069506af, 0x2af30bd7, 0x7c7d7cd4, 0x0000c510, 0x3377338c, 0x1e9341c7, 0x484748c3, 0x0000ce83,
+        0x7d8d7d8b, 0x875e680d, 0x4dc84dcd, 0x000051ba, 0x19a8191c, 0xa543aa87, 0x663666c8, 0x0000d3da, 0xeafdea7e, 0x7e55fa59, 0x8f278f52, 0x00005265,
+        0x67386782, 0x01f94eac, 0x84108441, 0x000057c8, 0x08780811, 0x27b1a5d2, 0x1921191d, 0x0000be11, 0x52af5200, 0x6bcd096b, 0xb515b575, 0x0000c413,
+        0x74e874ee, 0xab0d1dda, 0x0876081d, 0x0000d087, 0xe17ce195, 0x4df6a430, 0x9c129c99, 0x00007d31, 0x91ed9144, 0x6a906e57, 0xb141b1dc, 0x0000a84a,
+        0x325732b8, 0x78d9702f, 0x1ea41e53, 0x000007e8, 0xc319c334, 0x6650d8c4, 0x39a639e2, 0x0000438f, 0xb9fbb9e3, 0xc8c6de5b, 0xb1edb1e3, 0x00003b87,
+        0x7aa37ab8, 0xf07c852f, 0xff18ffa1, 0x000001ac, 0x9f899f57, 0xd7044f68, 0xd362d300, 0x00008a1a, 0x1e021eb5, 0x468026b4, 0xf8a7f811, 0x0000ec7c,
+        0x2695267d, 0xaa0dfefb, 0x6f626f8b, 0x000098d8, 0x524652b6, 0xd22ed7fb, 0x5ebf5ed7, 0x00003241, 0xd12dd12e, 0xf9d9c568, 0x8c1a8cdb, 0x0000746d,
+        0x5393533c, 0xec00112f, 0x27a42706, 0x00009f71, 0xf32ef322, 0xc4c6dbe5, 0xa1c1a1c9, 0x000094bc, 0xa452a437, 0xd6e15c54, 0xbe8cbe5f, 0x00000421,
+        0x137f135c, 0x8fdba614, 0x375a3720, 0x0000de1f, 0xf882f890, 0x5ad8e8b3, 0x628162af, 0x00007a81, 0xbd32bd9e, 0x74da3220, 0x7704772c, 0x000010e9,
+        0x9f709f1c, 0x4b7f7bc0, 0x28072823, 0x00004c2d, 0xefc6efa7, 0x1a2c6ddb, 0xc69fc613, 0x0000467c, 0x863d86f0, 0xf79b39e0, 0x5a975a49, 0x0000fe9e,
+        0x4ad44aba, 0x4deb1bee, 0x98889825, 0x00006e15, 0x584c5865, 0x4a367f7b, 0x195e194d, 0x0000ba9c, 0x7d407d47, 0x64f08490, 0x37c937ce, 0x00007251,
+        0xeeafeeb6, 0x2b5d2b80, 0xc97ac94d, 0x00004ca8, 0xce4cce79, 0x09277a8b, 0x14bd14ed, 0x0000e07c, 0x935c934f, 0xbb4bd5f5, 0x20aa209a, 0x0000e186,
+        0x08a50876, 0xeeebdaa2, 0x465f4659, 0x0000b0f2, 0x76ba7676, 0xb695e0dc, 0xf54ef512, 0x00000b71, 0x81ef811d, 0x7535aaf4, 0xca8aca1b, 0x00009254,
+        0xa0c2a038, 0x90d7e312, 0x814f8195, 0x0000a794, 0xc863c8b2, 0x76da206b, 0x5911596f, 0x00003641, 0x1c6e1c5f, 0x165a8a65, 0x6d936d5b, 0x0000a777,
+        0x379937dc, 0x9dd95d6c, 0x9eac9e9e, 0x00000854, 0xbdfcbdc4, 0x6ebf57f2, 0x34b5345e, 0x0000f652, 0x154b150a, 0x0d84a0db, 0x61b861af, 0x00008e2f,
+        0xe704e748, 0xd46d675c, 0xea67eabe, 0x0000ff9e, 0x9ca79c63, 0xfa180d59, 0xf03af0a4, 0x00009956, 0xf6e9f694, 0xb1554caf, 0xd727d7f9, 0x0000f338,
+        0x953f9521, 0x738ac07e, 0x34a634e2, 0x00008f2c, 0x941e9447, 0x992c6e9d, 0x7f287fdb, 0x00000722, 0x063c06bd, 0x746db98b, 0x580f582a, 0x00007b5a,
+        0x232b23fc, 0x615e3492, 0xa988a9fd, 0x00000eca, 0x58f55873, 0x921295fa, 0xb6f9b685, 0x00007372, 0x6d8b6d6f, 0xc9664446, 0x627f62d2, 0x0000e8bb,
+        0x5f335fc3, 0xacd567a4, 0xf955f9e2, 0x00009a3e, 0x26c12676, 0x663e3ccd, 0x10b91014, 0x00006d15, 0xfce0fc40, 0x8e600cc6, 0x8ac48a7f, 0x0000bd62,
+        0xf9a2f9a6, 0xaf5b2abf, 0x6f656f40, 0x000093b6, 0x9c019c14, 0x91b33489, 0x4b984bd6, 0x000027ff, 0x414741dc, 0xc0481447, 0x5b6c5bef, 0x00005476,
+        0xa378a33d, 0x36ce7d81, 0x74bb74d8, 0x0000b531, 0x3399335b, 0x754d900f, 0xa1d9a16b, 0x00000763, 0xb833b84a, 0x8ec79ad7, 0xd10ad168, 0x0000638b,
+        0x67bd67cb, 0x9c588b53, 0x397b3962, 0x00006670, 0xcabbcaca, 0x720259c2, 0x12b41279, 0x00009c86, 0xaf4eaf8a, 0xdd401cdb, 0x488a4888, 0x00005364,
+        0x140e14f0, 0xb78a69c5, 0xd605d6d0, 0x0000f198, 0x3704373f, 0x3f249252, 0xa463a435, 0x0000a719, 0x86548616, 0xf4625f99, 0x5610564e, 0x0000b649,
+        0xd3d1d332, 0x43870c59, 0x9bef9b19, 0x000090b9, 0x6c8f6c96, 0x7d2b461d, 0x5fcf5f35, 0x0000c127, 0xb74db741, 0x5477e422, 0x6cc36cb2, 0x0000dc97,
+        0x6b8b6bb4, 0xd704ad20, 0xe605e611, 0x0000bb82, 0x61a86122, 0xc7855332, 0x65cb654e, 0x00007dc6, 0x3cca3c44, 0x4c5ff59a, 0xeb2aeb23, 0x0000670f,
+        0xff29ff7c, 0x05ed1e93, 0xa13da151, 0x00007ea3, 0x8fdf8fd9, 0x2b2da21a, 0x39ed399b, 0x0000e2a4, 0x665e668d, 0xe66fb2a0, 0xc87dc888, 0x00009cb7,
+        0x2de12ddb, 0x1f3d828c, 0x2dbf2d0f, 0x0000e9e2, 0x267f26a3, 0x18ad4910, 0x771e7794, 0x0000479d, 0x01e80178, 0xe9314925, 0xfef8fee8, 0x0000a28a,
+        0xfa80fa5f, 0xdfcb58a4, 0xca86cadb, 0x00003003, 0x9d559d66, 0xef79ee79, 0xaf83afb7, 0x00007391, 0x9c069c7f, 0x8aa416c3, 0x2efb2e5a, 0x00005dc7,
+        0x704f7078, 0xa48ff3c1, 0x330f33e2, 0x000001fd, 0xf926f9e5, 0xab7f8ddc, 0x0185018d, 0x00002c63, 0x98a09896, 0xa4c3db26, 0x09260928, 0x0000ade9,
+        0x205420a8, 0x181545c4, 0x4a434aaf, 0x00001fa5, 0x82e08276, 0x5ad8ea79, 0x1a601aa7, 0x00006b15, 0xb09cb0fe, 0x228d9070, 0x880f887a, 0x0000174a,
+        0x0bd20b99, 0x5d68ba54, 0xfe06fe6d, 0x000052d8, 0x05650501, 0x044455b3, 0xc45ac4e7, 0x0000c278, 0x870787d0, 0xf5c266da, 0x75797576, 0x0000c532,
+        0xc108c1c6, 0x3d314925, 0x890d89b9, 0x00007370, 0x41464107, 0xcb7a57cd, 0xc16bc181, 0x0000104a, 0x4cff4ce8, 0x209239bf, 0x657565b6, 0x0000f121,
+        0xa618a654, 0x987fb769, 0x443544d8, 0x0000ef25, 0x6edf6e51, 0x320daa83, 0x689868fd, 0x0000c911, 0xd8d6d88f, 0x94887e42, 0xf36cf329, 0x0000af0c,
+        0x6e556e72, 0xabbe43f0, 0xab1aabe4, 0x0000070d, 0xe7fde77e, 0x9972f197, 0x5d9e5df7, 0x00002d9b, 0xebdfebff, 0x4885fa4c, 0x8d7e8d30, 0x00009334,
+        0x37c73709, 0x78ddce19, 0x75947525, 0x000024f9, 0xab43abd6, 0x0e7d702f, 0xd3a2d3a1, 0x00000100, 0xd804d814, 0xc2e8ac87, 0x426342e8, 0x000077b0,
+        0xd753d7d7, 0xab7bf51e, 0x933e933c, 0x00006d35, 0x8f488f46, 0x559d77d9, 0x88a088e2, 0x0000086e, 0x866b8674, 0x6af5edcd, 0x8c6b8cc9, 0x0000a764,
+        0x17381783, 0x11f0d4c9, 0x97a89731, 0x000028a5, 0x7530752c, 0x609e0c59, 0xa351a39e, 0x0000a369, 0x116d119c, 0xcdba3bff, 0x5c395c34, 0x00008e61,
+        0x855e85a3, 0xcbed28f9, 0xd7d2d729, 0x0000025d, 0x70fe7074, 0x5b226196, 0xaa66aa69, 0x00004d81, 0x2530257d, 0x5f69967e, 0xa3b9a3d1, 0x00004148,
+        0x98d198b9, 0x796778c9, 0x982c984f, 0x00000dd8, 0x47d34735, 0xd0c4ae54, 0x2a332aa9, 0x00002c77, 0x53a553c2, 0x0ef548ca, 0x15fb154b, 0x0000e344,
+        0x5bf85b6a, 0xd82ea4aa, 0x123e12f2, 0x00006dde, 0xe0afe08b, 0x7aa222dd, 0x15351589, 0x000090f5, 0x9d189d43, 0xa5e26599, 0x771777b5, 0x00005ee9,
+        0xab52abd1, 0xd241ec4d, 0x8bf78b28, 0x00006700, 0xf538f553, 0x6b5e3160, 0xf0b5f0ab, 0x00004a08, 0x0d320d79, 0x9aece638, 0x8362830b, 0x000049de,
+        0x0319033d, 0x02341252, 0x8e328eaa, 0x0000432e, 0x732873ec, 0xe3407f3d, 0x742174db, 0x0000358c, 0x777c7784, 0x85aa453b, 0xb5f5b502, 0x0000075d,
+        0x920d92b8, 0xd672a458, 0xcdd9cd06, 0x0000f62d, 0x519b51ae, 0xa08178ef, 0x8e578e75, 0x000053eb, 0x48da4812, 0x4b099bae, 0xef16ef47, 0x000095f5,
+        0xe5e8e509, 0x05c567c5, 0x70f670f3, 0x0000033b, 0x788d789b, 0x4debe4f2, 0x96cc9682, 0x0000d30f, 0x122c125b, 0x6a7f0927, 0x345d34fb, 0x0000ef88,
+        0x8c6f8c5b, 0xf54116fd, 0x30393033, 0x000030f1, 0xf8d6f8f9, 0x32fcb84a, 0x8797873e, 0x00005306, 0xa134a122, 0x9f63c0c3, 0xe4bde498, 0x0000834f,
+        0xcdb5cd94, 0xd76b996c, 0xe6e1e642, 0x000014c3, 0xb17db12b, 0xaeee5dbc, 0x2a002acd, 0x0000618b, 0xd02bd036, 0x0e13bbd5, 0x86928685, 0x0000d96c,
+        0xd8acd865, 0x7422cfa8, 0x118b11f0, 0x00003aed, 0x51ce5146, 0xc455e16b, 0x818e8144, 0x00005738, 0x938a9362, 0xc9fa6948, 0xd744d747, 0x0000dbcc,
+        0xe620e631, 0xd851a21a, 0x20f22058, 0x00001dd3, 0x7918799f, 0x397fd735, 0x955d95a3, 0x0000ccaa, 0x112c11ad, 0xf3e7b254, 0xa4f3a41b, 0x0000263e,
+        0x8dfb8db2, 0xa97e8ce2, 0x82f682f4, 0x0000b3a8, 0x63fd63a0, 0x742501bc, 0xa7a4a732, 0x000052ca, 0xd8acd844, 0x05669bac, 0x70e77032, 0x0000c9d5,
+        0xdde3dd3b, 0xcb968a62, 0xa18da1ff, 0x0000f982, 0x9de49dc9, 0xc8390034, 0xf80df8d6, 0x00003a13, 0x7ed47e42, 0xc3b2133e, 0xb0feb01b, 0x0000bdec,
+        0x07dd07cb, 0xac5aeef1, 0x66ed663f, 0x00000a2c, 0x96679623, 0xde75dc38, 0x93e193fc, 0x00007594, 0x82c182a7, 0x82f7ad43, 0x9b609bd8, 0x00004acd,
+        0x9a679a5d, 0xa08e85fe, 0x65a8650f, 0x0000a2d4, 0xedafedc8, 0x3dde10b3, 0x08e308b3, 0x0000a674, 0x96af9645, 0xd168eb4f, 0xd0d1d0c8, 0x0000d345,
+        0xbb23bb47, 0x3f02dbd8, 0x1c8c1c7b, 0x00000200, 0xa669a6aa, 0x14d0c9a8, 0x8da28d9a, 0x0000c3ec, 0x7db97db3, 0xa1fc89ec, 0x240a24b2, 0x00000e63,
+        0x2d582d9c, 0xcf94625c, 0x3d683d3e, 0x0000b48e, 0x23b5237d, 0x85f7b69e, 0xae51ae37, 0x000049a9, 0xe24ee272, 0x677883cd, 0x8d5c8df3, 0x00006dde,
+        0xa01aa05f, 0x98d98441, 0x209720d5, 0x00000cca, 0x51ea5155, 0x75f77866, 0xfef5fea9, 0x0000ea17, 0x8c178c20, 0x55736dea, 0x5f3d5fa4, 0x0000c39e,
+        0xe768e749, 0x2fc07b56, 0xb397b3df, 0x0000839d, 0x79df7965, 0xd1f8d0b9, 0x5ffb5f00, 0x0000cc10, 0x8a498ab1, 0x16da128b, 0x4bbb4b0f, 0x00000c3d,
+        0xa606a650, 0x7ab5c953, 0xe832e8f5, 0x00004b04, 0xd77bd7b6, 0x7e2b95f8, 0x897e8931, 0x00006b79, 0x41d04136, 0x39e2d0e8, 0xa05aa08a, 0x0000c54d,
+        0x8dab8d6f, 0xb80323df, 0x240f24d4, 0x0000df57, 0xeb41eb98, 0x0444ecb0, 0x520f525c, 0x000064c8, 0x722b7249, 0x58d73bc0, 0xb9f5b946, 0x0000cfad,
+        0xb5c9b5be, 0xed799c6a, 0xaf56af2c, 0x000028a4, 0xee39ee77, 0xeadbbd48, 0xdc49dc1f, 0x00007fbf, 0x31fd31e9, 0x974ff7f7, 0x83b283d4, 0x0000e532,
+        0x7ff97f18, 0xef5385f0, 0x173c1762, 0x00008eb1, 0x295629b0, 0x62b318d3, 0x29482919, 0x00006c96, 0x936393e8, 0xc65c4c56, 0xfc2cfc74, 0x00002fa4,
+        0xdb8ddb6e, 0xc9f553ae, 0x975e9773, 0x0000b0cd, 0x5ade5a29, 0xefff6a33, 0x0fe70fb4, 0x0000e2f2, 0x293c2963, 0x04eab746, 0xa5d9a5e5, 0x0000789c,
+        0x9722971f, 0x49ac7569, 0x197f196e, 0x00004ca9, 0xfafbfa98, 0xfce1ea73, 0x682368f2, 0x0000be2f, 0x65446552, 0xa0f2e55d, 0x153c1535, 0x00006d30,
+        0x78a478b6, 0x3ef507f4, 0x43374399, 0x00000500, 0x0faa0fa3, 0xe3d7ab7c, 0xf471f45b, 0x0000ee17, 0x9a8a9a73, 0xa161682b, 0x5f9f5f24, 0x00009220,
+        0xc954c956, 0xf03665a4, 0x27162763, 0x00002b86, 0xc5d0c5c5, 0xaa51c440, 0x910291e0, 0x0000f6b2, 0xa3b1a3c0, 0xb4007c79, 0x8d348df1, 0x00008395,
+        0xcfe5cf57, 0xd46d1aaf, 0xeb91ebb3, 0x0000c7ec, 0xbb02bb4b, 0x2c21ed41, 0xb3b3b3d3, 0x00009d90, 0xcb77cbc9, 0x6ba01d64, 0xf936f96a, 0x0000c4b2,
+        0x4c544c51, 0x4f5e8fde, 0x9f8e9f27, 0x000020b3, 0x14561466, 0x14eee2ef, 0x3e8a3e28, 0x0000ff3e, 0x272927f3, 0x62c3e6bc, 0x5c835cae, 0x000088e4,
+        0x2b702bbd, 0x64605c24, 0x6c806c31, 0x0000a877, 0xfb2dfbdd, 0x4ca0fc2a, 0xe54de50d, 0x000078ee, 0xfad6fa43, 0xa201cae7, 0x7e507eb2, 0x0000cc07,
+        0x3d3d3d4f, 0x29815378, 0xb264b2c9, 0x00000ed8, 0xac90acc4, 0xbc35a9c7, 0xcbabcb64, 0x0000a9a7, 0xefedefea, 0x33b2a52e, 0x8d038d69, 0x0000cd91,
+        0x79147916, 0x66af459c, 0xd1ffd1a0, 0x000035ad, 0x207b2003, 0x6e60ce51, 0xf219f231, 0x00007b0e, 0x85ef858e, 0x833767b4, 0xa835a8e9, 0x0000da1b,
+        0x0fce0f5a, 0xcb1840bc, 0x7dd17d3e, 0x000090d7, 0x5b275b18, 0xd69fd2ca, 0x01e50185, 0x000064c8, 0x74927453, 0x7e6c6ffa, 0xae35aea7, 0x000044ef,
+        0x691a698a, 0x4cdac37f, 0x6771671e, 0x0000aba5, 0x718b7109, 0x105585f0, 0x42924253, 0x00001b0a, 0x9a299ab4, 0xa4a13410, 0x321a32c3, 0x00008b1a,
+        0x343434ce, 0x3baf7a98, 0xfda1fdaa, 0x0000c232, 0xd464d4f0, 0x18659808, 0x7edc7e61, 0x0000343e, 0xe2c7e247, 0xe567292c, 0x5c055c5f, 0x0000d2a5,
+        0xbbadbb33, 0x8057fbbe, 0x7e2e7e58, 0x0000fa71, 0xb25db2b1, 0x3c196987, 0x003d0083, 0x0000e90d, 0xf3fdf374, 0xb0008fa3, 0x6cf16c74, 0x000037dc,
+        0xf0dff059, 0x19b15ebf, 0x7a147a6f, 0x00001217, 0xd1cbd170, 0xfd86c925, 0x66c9666d, 0x0000b06e, 0xc18ac1e4, 0x049bc5d6, 0x8cc28c77, 0x0000c302,
+        0x3d213d83, 0xbccc453b, 0x451245e5, 0x00005298, 0xb2f9b2d0, 0x8d796974, 0xb83cb856, 0x00001c88, 0x9109914b, 0xfd858ffe, 0x477f47de, 0x00006c8b,
+        0xf15ef1b9, 0x05658036, 0xd1e9d1b8, 0x00008ef2, 0xff9fffbe, 0xf389391e, 0xf957f97d, 0x0000dffe, 0x12321223, 0xd6ca5ba5, 0xd132d166, 0x0000370e,
+        0x322e32a5, 0x01955efc, 0x9bd09b43, 0x00007151, 0x3b093b98, 0xff369445, 0xda10daed, 0x00001662, 0x38363844, 0xc5caf71a, 0xf71ef784, 0x0000d967,
+        0x2b1a2ba8, 0x738adfdb, 0xaf33af79, 0x0000ddde, 0x764976d1, 0x50e7ced3, 0xaa1daaf7, 0x00003737, 0xc85fc867, 0xc60bf549, 0xb28bb2a4, 0x0000e103,
+        0x8c108c20, 0xc2f8d349, 0xe611e64a, 0x0000d996, 0xb03db021, 0x4f26ed19, 0x602260fb, 0x0000263e, 0xc5a7c557, 0x4366ac27, 0x40d44071, 0x00006e22,
+        0x80af80c9, 0x5a2d4dad, 0x9dac9db1, 0x00005984, 0xccbbcc67, 0x37d83a91, 0xb4cab464, 0x0000eed2, 0x5d275d15, 0xefd1759d, 0x9aa39af1, 0x000082a2,
+        0x76c17680, 0x8cf72cb1, 0x6c066c49, 0x00002ca4, 0x893b89f7, 0xa2fcabb2, 0x182f18f2, 0x0000c23f, 0xc828c81a, 0xaeeeabf4, 0xfcc1fc0e, 0x00008480,
+        0xb724b7ce, 0xc069655a, 0x815a8115, 0x00003d8c, 0xe503e527, 0xb600b2a7, 0x8cec8c5c, 0x0000add9, 0xf971f9da, 0x97579781, 0x001000df, 0x00008c1d,
+        0x94509418, 0x95912729, 0xa024a0d1, 0x0000a155, 0x3c603ce9, 0x726db358, 0x719e7169, 0x00002566, 0x7c3e7c9f, 0x20d20706, 0x3369339b, 0x000061e5,
+        0x7f217fe8, 0x70952906, 0xa02ea092, 0x00007570, 0xa4d8a446, 0xb50380f3, 0x8d5b8d06, 0x0000a651, 0xcfc2cf61, 0x94420c5e, 0xdab3dadb, 0x0000fffd,
+        0xe094e053, 0x7ee1864f, 0x711671a5, 0x0000bf91, 0xf21bf259, 0x03874561, 0x930693cc, 0x0000a2de, 0x424942f6, 0xc11dead3, 0xe338e35a, 0x0000e9bf,
+        0x3ea63ec3, 0x2659a02a, 0xe43ee435, 0x00002bc2, 0x36453659, 0x2fc00734, 0xc2dec261, 0x0000c53a, 0xaff5afd5, 0x10c82ec7, 0xc58ac51b, 0x00007f8e,
+        0x44164402, 0x1fda7a8b, 0x3da13da7, 0x00000e92, 0xba7abaaa, 0x514013e1, 0x883b88fe, 0x00003843, 0xf080f0c3, 0x995e73ab, 0x177c1768, 0x000064e1,
+        0x4fec4faa, 0x8fa7c767, 0xca83cade, 0x000026b7, 0x5f2d5f5b, 0x08bc5313, 0xcc6fccd9, 0x0000f21d, 0x878c876b, 0xdbf87fbb, 0x19611964, 0x00000d99,
+        0xa497a4dd, 0x7e1200c8, 0x11fe1144, 0x0000c44c, 0x5d1d5d1c, 0xcda4722f, 0x167f166d, 0x0000e10b, 0x9800981c, 0xa7be10d0, 0x9d359d65, 0x000007bd,
+        0xf2eaf26a, 0xd04c1dcf, 0xbe72be95, 0x0000a38a, 0x1e691e1e, 0x4af69cdc, 0x5d645def, 0x0000b547, 0x157f15f4, 0x87aa8def, 0xc36bc315, 0x0000efd6,
+        0xcf21cf54, 0x53fba642, 0x84d58461, 0x000009b0, 0xd787d73b, 0x2c33dc2c, 0x2f142f7b, 0x000086ff, 0xf92ef9d8, 0xe3a1595e, 0x842e84dc, 0x0000584d,
+        0xb994b91b, 0x9b3de80a, 0x7f2c7f34, 0x0000b408, 0x22532278, 0xa45100ca, 0xc648c618, 0x0000dd9a, 0x20f220cc, 0xf4eea2b7, 0x850c85cf, 0x00001617,
+        0x44d9447d, 0xac0d6584, 0xdc19dcd3, 0x00005565, 0x6ef66e15, 0x7b637766, 0x6ac46a45, 0x0000f25c, 0xeccaeca8, 0xc2853ecc, 0xfb78fb2c, 0x00001cac,
+        0xaa94aa65, 0x1f3e236c, 0x21dd2137, 0x00004ea9, 0x725872b8, 0xdd72f83a, 0x8daf8d93, 0x0000def0, 0x34df3484, 0x6048a437, 0x8aac8ab7, 0x00008da8,
+        0xe7dbe7e1, 0x40660534, 0x1ad11a76, 0x00007280, 0x5d8c5da4, 0xe822ecd4, 0x12b41258, 0x00005058, 0x7eab7e3e, 0x8926fae7, 0xd2f9d20c, 0x0000a03a,
+        0xd8e9d899, 0x835eb5af, 0xeaa9ea40, 0x0000be6f, 0x4f654f21, 0xd3ca04ca, 0xcb36cb5c, 0x00001c33, 0x1b2e1b84, 0x5aa7f5dc, 0x181b18c7, 0x0000d349,
+        0x45a14556, 0xf55c2654, 0xaafcaa50, 0x000066c8, 0x12c6124b, 0x71708681, 0x2b362bab, 0x0000ccd5, 0x50a950f3, 0xaa5138f2, 0x1f7b1f64, 0x000023ea,
+        0xa97fa935, 0xf4575fec, 0x75e77532, 0x0000e922, 0x5ad95aa2, 0x79c1bc77, 0x84d88427, 0x0000850e, 0x28d6285b, 0x570a7409, 0x5c035c81, 0x0000b25e,
+        0x6d336d8b, 0x9f0609eb, 0x832883de, 0x0000f85c, 0xe1cde1fb, 0x312740b2, 0x2bc82b68, 0x0000263e, 0x83b38334, 0x01fa9116, 0x0cf70c14, 0x00000a2f,
+        0x543d54bb, 0x60a1e3a0, 0x47d04787, 0x00004b12, 0x35a335a9, 0xb897d64a, 0x91349151, 0x0000b931, 0xe12be1da, 0x92e61826, 0x1f7e1ff0, 0x0000bd9e,
+        0xfde0fd41, 0x8b47c815, 0xf949f910, 0x0000c76d, 0x0f810ff5, 0x3c870485, 0x9eea9eb5, 0x00001523, 0xf26df28b, 0xa95134e1, 0x0c900c5a, 0x0000b3d7,
+        0x11be1124, 0xefa704f4, 0xf375f354, 0x00000b94, 0x489d48b3, 0x5a82798a, 0xa38fa351, 0x00006e6a, 0x1bbe1b86, 0x8787e1e5, 0xcaeeca19, 0x00005b06,
+        0x9ace9ab4, 0x551d3df2, 0x1959199d, 0x0000e2f3, 0x142a14f3, 0xbacc4b16, 0x263d265d, 0x00007881, 0xf7c8f7c3, 0x5f4d305f, 0xa580a5a1, 0x00002f66,
+        0x961396d6, 0x2523d9e8, 0x667c66df, 0x0000cc12, 0x123d120f, 0x902c9404, 0x31e731ec, 0x0000ccaa, 0xf818f8b4, 0x1d39d405, 0xadd1ad9e, 0x0000a925,
+        0xb5d0b577, 0x9979aaf8, 0xe739e78c, 0x00000209, 0x09a709e0, 0x15e51288, 0xf772f726, 0x0000cd7d, 0x2583252a, 0x1d2a7baa, 0xc9a2c984, 0x00001cf4,
+        0xe016e023, 0xf9495ea2, 0x19e81994, 0x0000e17b, 0xaad1aaaa, 0x97429d14, 0xac9aac8a, 0x0000283a, 0x8afd8a19, 0x78c86c37, 0xc0f6c085, 0x0000446e,
+        0x8182818f, 0x013ef02b, 0xcf68cf7a, 0x00003406, 0x84708493, 0x33dffe76, 0x58455855, 0x00009baf, 0x449644dd, 0x4446c7fc, 0x89e189af, 0x00006252,
+        0x88488841, 0xa58125f2, 0xb944b9bf, 0x00000f1b, 0x14d51410, 0x12662c14, 0x369f36c3, 0x0000794c, 0xd122d152, 0x77ff932d, 0x3f0b3f3c, 0x00008f1d,
+        0xdf3cdf55, 0x42242c4d, 0x072107d5, 0x00007280, 0xc0d7c000, 0x9ebe8afe, 0xc6d9c6c9, 0x00007cb8, 0x169316d4, 0x2302d973, 0x99d199d0, 0x00001268,
+        0x94a094c4, 0x9649bc40, 0xe34ce300, 0x00004070, 0x5ced5c7a, 0x12716b74, 0x0ea40e62, 0x00001dd3, 0x6366638c, 0xe1233eb3, 0xe080e0fe, 0x0000f451,
+        0x7a027ad9, 0xc97a4eaf, 0x77eb77ac, 0x0000cb34, 0x3d303df5, 0xe85c66e5, 0x087008c6, 0x00008fd0, 0xd6b1d66b, 0x3419dd6c, 0xd35cd3f0, 0x00005d6f,
+        0x19281920, 0xa2500cc6, 0xc4dac425, 0x0000850e, 0xc5e8c5f4, 0xd051b0a7, 0xf030f090, 0x0000cfd5, 0x8d498db5, 0x5843b46b, 0x689268ba, 0x0000a244,
+        0x9f659f25, 0x93cbaab2, 0xc52ec5af, 0x0000f269, 0x9f369fb7, 0xd620153e, 0x41aa41a4, 0x0000cac2, 0x1fcf1f79, 0x9cbc4459, 0xacfeac52, 0x0000a384,
+        0xc233c2a2, 0x4d996ab0, 0x78937824, 0x00007331, 0x4dea4dea, 0x1fe5de52, 0xd520d566, 0x0000ad85, 0x012a0172, 0xaac6d116, 0x9e0b9ec4, 0x000021b6,
+        0x5f115f80, 0xcf25e94f, 0x0f2d0f82, 0x000097f5, 0xb0c5b000, 0x346cba35, 0x5f465f61, 0x0000a978, 0xf99ff9de, 0x3cf57ec0, 0x0aaa0a78, 0x0000d10b,
+        0x057c057d, 0x66d10695, 0xb189b124, 0x00008f1e, 0x0f0f0fe5, 0x68df987e, 0x44bb44d4, 0x0000be6f, 0x37c737f0, 0x173963a7, 0x445b4488, 0x00004a0d,
+        0xaae3aaf1, 0xa7c29fd8, 0x345e349d, 0x0000cfaa, 0x8afe8a56, 0x7344341d, 0x857e8539, 0x00000a33, 0x29a92917, 0x9cfa31e1, 0x83a383be, 0x0000297b,
+        0x07cc07d0, 0x964c4dad, 0x7c0f7c5e, 0x000060a6, 0xd59dd527, 0x710d2a45, 0x850b8599, 0x00002bdc, 0x215421a3, 0x3baffa9c, 0x94629495, 0x00008bcc,
+        0xdcdbdcdd, 0x085d7e3c, 0x84f58416, 0x00006f15, 0xe695e6f1, 0x1c4c31df, 0xb59bb548, 0x000029c2, 0xc19cc107, 0x2c4de918, 0x2df12d18, 0x0000f26a,
+        0x931e93a0, 0x7c6cc1c1, 0x475647a5, 0x000062d9, 0x33313329, 0x78c9c17a, 0x4aaa4a04, 0x0000f62d, 0xe655e69c, 0x0ddc14c4, 0x17a21719, 0x0000c802,
+        0xde9adea8, 0xe830bbb5, 0x43fd43ea, 0x0000dfd5, 0x472c474b, 0x14519904, 0x64b76456, 0x00002cd6, 0x73e17331, 0xe3584a16, 0x686c683a, 0x0000729a,
+        0x60b06096, 0xa20c2980, 0x8686860e, 0x00004f22, 0x07f507f2, 0xe683c2dc, 0x9b779bba, 0x00001b7a, 0x49c649dc, 0x4c3641d4, 0x1d601de5, 0x00003439,
+        0x5e355eea, 0x1aaa03f4, 0xaaa8aaec, 0x0000eabf, 0x977097d3, 0xa3e0f768, 0x318c3106, 0x00004f30, 0xb03bb0d2, 0x18c8dfba, 0x4ffd4f3c, 0x00003b33,
+        0x568e565b, 0x54c64c2b, 0xb430b4e5, 0x0000fffd, 0xb855b890, 0xb8712ebf, 0xa570a537, 0x00008eef, 0xc8efc8e7, 0x52d8c32d, 0x1a701a04, 0x000039ec,
+        0x33123380, 0x97d9fcc6, 0x657865de, 0x0000fca1, 0x7dc37d62, 0xf751466f, 0xade7ad39, 0x00001014, 0x7f567fa9, 0x53b9e0ef, 0xdb95db7f, 0x00002e9b,
+        0x2d192d70, 0x438741cb, 0x85a2850e, 0x00000562, 0x24392438, 0xfbe063e5, 0x786378ec, 0x00002fea, 0x9fe19fe6, 0xd69e0214, 0x7270728e, 0x0000bfad,
+        0xdbb9db61, 0x8d47c33c, 0x56c356d7, 0x00002f63, 0x893c89f6, 0x47f800ca, 0xa6daa6d2, 0x000025b2, 0xf7eaf764, 0x36ef1cb2, 0xca33ca8e, 0x0000e3b4,
+        0x842684db, 0x688f1541, 0x44a04407, 0x0000cb94, 0x48c748b8, 0x20d01d67, 0xff5eff72, 0x0000f073, 0x98379864, 0x657a60eb, 0x8ae18a3b, 0x00009801,
+        0xc0ccc0df, 0x7fc07e85, 0x9e099ede, 0x0000dbeb, 0xb204b22b, 0xad2e0852, 0xa2eaa2dc, 0x000038c0, 0x685c684e, 0x8dd644c8, 0x30f43050, 0x00007f21,
+        0x5c0e5c88, 0xc17d7c00, 0x72ec7241, 0x00008e61, 0x0fdf0f9b, 0x6221bdb5, 0xd224d264, 0x00008db0, 0x8e9e8e90, 0xd5b089ee, 0x7b1d7ba6, 0x000080ff,
+        0xb140b14d, 0xdd1be27d, 0x5811589f, 0x00008eb0, 0x34313450, 0x7aa0b13d, 0xc796c731, 0x00000a50, 0xcf02cfeb, 0x085c0a86, 0xbb88bbac, 0x00006ad5,
+        0x7aeb7a53, 0x80a6bd4b, 0x425342b7, 0x000056e8, 0x78e978a5, 0x94ec216b, 0xb3c8b367, 0x0000bfda, 0x276527b3, 0x972c9dea, 0x63bb63e0, 0x0000abd9,
+        0x402e40a7, 0xdae5b617, 0x1ceb1ca7, 0x000093bc, 0xbc11bc9a, 0x287e6090, 0x804780b4, 0x0000d96d, 0x7fe07fe5, 0xb947a42d, 0xc866c8f7, 0x0000ec94,
+        0xe5a4e510, 0x82a15ade, 0x3a3b3ab8, 0x0000d70b, 0x041a04eb, 0x1eeac243, 0xdc1edcd7, 0x000077ee, 0x91c591da, 0x018b9995, 0x517251c5, 0x0000e4f6,
+        0x18fd189d, 0xd1fba15f, 0x55ea5548, 0x000012ac, 0x4b8b4b12, 0x9b690cd8, 0xb5fbb508, 0x00006ebc, 0x49974957, 0x21f3cccf, 0x08a108af, 0x00003769,
+        0xb901b945, 0x3865b9ea, 0xec14ec72, 0x00000e06, 0x621c6201, 0x8cf9272b, 0x42704299, 0x0000cb34, 0xb284b279, 0x6bfd4fd0, 0x9b569b57, 0x0000b5b1,
+        0xa3f1a34a, 0xc00bfd47, 0xa35fa38e, 0x0000955d, 0xa8d4a83d, 0x5982c060, 0xe80fe81e, 0x00008460, 0x1df51d18, 0xd774be74, 0x186b18b7, 0x0000410d,
+        0x7d2e7d62, 0x5989d3f4, 0xfb6efb82, 0x000089c8, 0x2aaf2abd, 0xe493b695, 0xbee7bec3, 0x00009176, 0x89b989bb, 0x1b053320, 0xf5f6f5ef, 0x00004e14,
+        0x0ae90a54, 0x6550153e, 0x723872ce, 0x0000b911, 0x30c830ab, 0xb1a31aa8, 0x35bd359a, 0x00005e11, 0x6bfc6b4c, 0x4d8054ae, 0x571157dc, 0x000086bd,
+        0xb28eb2bb, 0xedd1495d, 0xb00db097, 0x0000f682, 0x1f141fb5, 0x30326105, 0x6a5c6af3, 0x00002ca4, 0xac62acdb, 0x72f9597c, 0x0b1b0b0f, 0x0000a5b5,
+        0x2d6a2dca, 0x5e4d5d28, 0x2b572b92, 0x0000e746, 0x6b5c6b47, 0x0fcbbdc8, 0xb45fb498, 0x00000bf8, 0xb0ffb0a3, 0xcc3318d3, 0xb09ab0a0, 0x00003439,
+        0x812f8166, 0x4eb79013, 0x6ed36e05, 0x00008ab6, 0xc990c99b, 0x87163469, 0x9abd9aac, 0x00004af3, 0xc663c68c, 0xf9102fbf, 0x5f405f05, 0x00001fc2,
+        0x7f677f92, 0x8f86f5a1, 0x86808655, 0x00001d93, 0xa546a55a, 0xbe6f89ac, 0x7a557ab5, 0x0000794d, 0x8d4e8d0c, 0x226dbc37, 0xa889a87f, 0x0000eb17,
+        0x9fa69f67, 0xa041f0d6, 0x4bab4ba5, 0x00006ac7, 0x85aa858f, 0xefd1b6af, 0x1771176d, 0x00004b3b, 0x366b36d5, 0x6958418c, 0x5de05d21, 0x00009661,
+        0xc11ac1ae, 0xa5beba07, 0x78077888, 0x00008cdf, 0x7fa47fb3, 0xb601e832, 0x1c681c66, 0x00001b02, 0x39f239bb, 0x7712f958, 0xe0a5e08e, 0x0000424f,
+        0xed11ed20, 0x53a78c65, 0xdebfdea5, 0x00004611, 0xab3dab91, 0x72daa1db, 0xcb39cb73, 0x0000f738, 0x15ea15fd, 0x79709d28, 0x10bc1087, 0x000063a9,
+        0x2d5d2d4b, 0xfcf4123e, 0xa7f2a737, 0x0000488f, 0x419741d5, 0xa3c25dae, 0x666e6638, 0x0000ed39, 0x935e93b8, 0x58d87f37, 0xf938f9e4, 0x00004ef0,
+        0x0e670e67, 0x7a2a43bd, 0x51525176, 0x0000ed28, 0xedeced24, 0x0c3401ba, 0x472f4700, 0x00007c4f, 0xd422d4c9, 0xe66851cd, 0x2d392d24, 0x0000368c,
+        0x9e8b9e6e, 0x487d5dbc, 0x015801a5, 0x00002cba, 0xcf98cf0d, 0x784b8ee1, 0xe051e092, 0x0000708e, 0x53cf534d, 0x2f21f757, 0xd2d0d2de, 0x0000b113,
+        0x8247823d, 0x3f7dd275, 0x6c6f6c30, 0x0000b32c, 0x6526657b, 0x61a5f128, 0x61b461c0, 0x00000f05, 0x47ed47ac, 0x51d881b8, 0x4ab34a10, 0x000098e0,
+        0x4ee54e86, 0x6e6081f1, 0xf0b4f0a8, 0x0000ea16, 0x81ba810d, 0x8126c6be, 0xb892b886, 0x00008c08, 0x7c807c33, 0xd2c49fdc, 0x0d040de2, 0x0000fc41,
+        0x3f9c3fa5, 0x595bbdcb, 0xb83ab827, 0x00000671, 0xae55ae91, 0x5fa0c74b, 0x722672cf, 0x00001549, 0x0704076d, 0xd38be63e, 0xdd7fdd70, 0x0000e6f4,
+        0x5ba65bc1, 0x85a71a40, 0x921f9215, 0x00007651, 0x30773084, 0x41e68be1, 0x4000402a, 0x0000fda3, 0x1fea1f1c, 0x697d48dc, 0x1eae1ee3, 0x0000b6a9,
+        0x164e16a9, 0x55b208da, 0xb840b887, 0x000089ff, 0xfb94fb56, 0x02079d5b, 0x0d7d0d63, 0x00003c0f, 0x713e71e3, 0x6cc37b56, 0xc645c6b7, 0x00002fd6,
+        0x6db46d6c, 0x9cc466d9, 0x764476d9, 0x00003e21, 0x5ec35ec2, 0x8bb8b7d6, 0xe73ee749, 0x000063af, 0x88c4884e, 0xcc6d5c55, 0x92fe922f, 0x0000ef03,
+        0x042b04b3, 0x142cf69d, 0x8dc58d76, 0x00003e6c, 0xf788f7c0, 0x571aa229, 0xc174c1e1, 0x0000b605, 0x2f422fa2, 0x1dd7fe8d, 0xa46ca437, 0x000038e6,
+        0x6d4d6d6b, 0x406480f3, 0x842084a3, 0x0000c538, 0x3b203b6e, 0x109ea6ac, 0x93d09342, 0x0000ae75, 0xa999a9ec, 0x86d55671, 0x1d231d4b, 0x0000065d,
+        0xe578e524, 0xfe26b4aa, 0x1a241a47, 0x000032b3, 0xe158e1f3, 0xae333691, 0x34553416, 0x0000c55c, 0x4e0c4eca, 0xe37cd8e5, 0xa35ca340, 0x00006a6a,
+        0x70427022, 0xb57963fa, 0x956195c5, 0x0000f055, 0x457945dc, 0x694e982a, 0xd229d210, 0x0000f1a3, 0x89e88953, 0xbdf85fee, 0x6a216a2d, 0x00003792,
+        0x9f959f1a, 0x5ce21a92, 0xf724f72f, 0x000098d1, 0xcdd3cda6, 0x2a9ce4dd, 0x83b28325, 0x0000dde0, 0x67c367b0, 0x240d15c1, 0xf030f0a4, 0x0000e337,
+        0xc45fc44b, 0xbacc036e, 0x30c43039, 0x000052e8, 0x9720973a, 0x36487615, 0x06ed0619, 0x000035d2, 0x0fa40fde, 0x8477ba4a, 0x088a0898, 0x0000df7d,
+        0xac8bac89, 0xab142e29, 0xed1eed99, 0x000023e4, 0xadc7ada8, 0x0e063cb2, 0xcdd6cd81, 0x0000249c, 0x279d27fb, 0xe87d9544, 0x5de05d3b, 0x000022cb,
+        0x19371935, 0x3248b5e6, 0x0a0b0a6a, 0x00001c1b, 0x4fca4f28, 0x904c66fa, 0xaac2aa7e, 0x0000c393, 0xfa2cfa52, 0x4199ee72, 0x45b145d7, 0x00000b1e,
+        0x8064804c, 0x04e6b7e9, 0xd14dd1fe, 0x00008c23, 0x9ec79e5e, 0x3f5be8fd, 0x3b303bed, 0x0000810e, 0xb275b22f, 0xb6966f85, 0xd6c3d6fb, 0x000088da,
+        0xaf86af2a, 0x66831c59, 0xa59ba5f3, 0x000045bb, 0x05060551, 0x92164bdf, 0xa658a6ca, 0x00003e59, 0xa915a916, 0xd954a430, 0x23552329, 0x00002c2e,
+        0xe936e9fc, 0xef532374, 0x5eb05efc, 0x00008c61, 0x64ba6406, 0x6c6c6b37, 0xdcffdca4, 0x00005f1a, 0xea80ea98, 0xeb99814f, 0xf51df5da, 0x00005981,
+        0xe3e2e381, 0x716ee7a0, 0x51c85181, 0x00008131, 0x5b3f5b36, 0xaa335280, 0xbce4bcc7, 0x00004090, 0x25012595, 0x3dca491b, 0x014401e9, 0x000073bd,
+        0xe715e732, 0xfd612e4e, 0x797379e3, 0x0000b4f7, 0xfb1afb20, 0x5773edcc, 0xf128f19d, 0x0000edc8, 0x186d184a, 0x76a8742f, 0xad69ad3a, 0x00004710,
+        0x642b647e, 0x1bed9644, 0x0f530f8e, 0x00003824, 0xbaacba9a, 0xe14232df, 0x16d31600, 0x0000e093, 0x962296eb, 0x7fc131a0, 0xd553d5f1, 0x000044d0,
+        0x545454c6, 0x45a2ac97, 0x82148238, 0x000052c9, 0x2a1b2a46, 0x83b60746, 0x58af586b, 0x00002166, 0x271827b4, 0x34b20037, 0xc0c0c02b, 0x00009614,
+        0x22ff2282, 0x2a638ce2, 0xe2f9e2fa, 0x00002fdb, 0x106e104b, 0xb2a3f6eb, 0x7dca7d57, 0x0000c62d, 0x5bc45b1e, 0x7098ce51, 0x5266522f, 0x00002275,
+        0x3b083b43, 0xcc9aa6d1, 0xf8f7f881, 0x0000c9ab, 0xa1a6a13a, 0x07256f72, 0x975397bc, 0x0000af99, 0x293e2913, 0x8979d903, 0x483e4857, 0x0000a4a1,
+        0x817f8188, 0x694f3f4c, 0x4e6a4e72, 0x0000e5f4, 0xf061f03f, 0x01449cd7, 0xbe83be4e, 0x00009330, 0xae78ae4b, 0x0bd60b60, 0x225d228d, 0x0000b2d7,
+        0x2bd32bb4, 0xa261c417, 0xe256e2ed, 0x00002a04, 0x140114d4, 0xc79c2d38, 0xadd4ad45, 0x000003fa, 0x332a3374, 0xd68d2754, 0xa755a74e, 0x00004004,
+        0x54385400, 0xf0ceb1d8, 0x0902099a, 0x00004ba9, 0xade9ad63, 0x939d39ed, 0xe3e3e370, 0x0000fcd8, 0x334333f3, 0x617a20ad, 0x325f3210, 0x0000998a,
+        0x06420626, 0x290188fe, 0xb1e8b1a2, 0x0000c9b8, 0xea0aea7c, 0x0de90248, 0x829d823c, 0x00004bb0, 0x67f7672f, 0x1993dea0, 0xcf63cf94, 0x00002747,
+        0xcb0ecba5, 0xa621202b, 0xc457c478, 0x0000d566, 0x7a077a9d, 0x2e413320, 0x8f5a8f97, 0x0000eb64, 0x989e985f, 0x63a59903, 0xa8cca800, 0x0000ec94,
+        0x39003980, 0xd1db2e39, 0x60ac60c8, 0x000092c2, 0xf4d1f44a, 0x6f608333, 0x44a944d2, 0x00004b96, 0xf6e4f6d7, 0x0e7c9b34, 0x4c674c81, 0x0000aa45,
+        0xc94dc92a, 0x44c68d3f, 0x51955125, 0x00009ec9, 0x1af51a36, 0x964c0d67, 0x380f38d3, 0x0000a039, 0xf5dff500, 0x948edcd4, 0xc4b3c40f, 0x0000bc85,
+        0xa33da380, 0x12f9391e, 0x1f051f8b, 0x0000f4f9, 0x8f3f8f28, 0x326f8ca6, 0xd4e1d407, 0x00000300, 0x8e1f8e05, 0x8c0f6a34, 0xa8a6a882, 0x0000d4a5,
+        0xc5e9c5f9, 0x66d7287e, 0x20622080, 0x0000355c, 0xea20ea66, 0x847e225d, 0x85a18525, 0x00000471, 0xa911a911, 0x6c4236df, 0x4a204aab, 0x00008680,
+        0xaa5caa11, 0x3bc3dd9a, 0xa967a904, 0x0000488f, 0x47ed47fa, 0x101c5348, 0xc176c13f, 0x00007f70, 0x23ee2378, 0x393c39ed, 0x270227ed, 0x0000b356,
+        0xa22fa251, 0x5cb22168, 0x37f437b6, 0x00007019, 0x8424841f, 0x2730bed7, 0xb079b0f7, 0x0000c060, 0x9cff9c2e, 0xe4c1eafe, 0xf449f415, 0x0000aed6,
+        0xca6cca39, 0x7eebcb6e, 0x689468b4, 0x00002fea, 0x98219845, 0x31d0b8d5, 0x79357906, 0x0000711f, 0x694169ce, 0x782bc182, 0xbd97bd25, 0x0000e403,
+        0x961c96da, 0x0e7d0be6, 0xd24ed21c, 0x00007a9f, 0x788d78e2, 0x9a63e837, 0x103b10c4, 0x00003455, 0x688a689f, 0x1b6a8d20, 0x94c6949c, 0x00009fe0,
+        0x961e9610, 0x80f7fdc2, 0xf09ff02c, 0x00008f69, 0x541f5485, 0xffc21585, 0x0c2d0c83, 0x0000159a, 0x245f24c1, 0xbfcb0e5a, 0xc384c34f, 0x0000d20f,
+        0x8c5a8c59, 0xd54df558, 0x17c01726, 0x0000e5ad, 0xb700b73f, 0xb03e99d7, 0x9e2a9e08, 0x0000fc0d, 0x2d092d76, 0x02c3fc05, 0xe112e1c9, 0x00004b40,
+        0xe664e6d9, 0xecd36a4b, 0xd9b1d9e9, 0x00005584, 0x41d1415a, 0x88f820c9, 0xc3b0c38a, 0x00003245, 0x1af41a65, 0xf6aeaab2, 0x240b24e4, 0x000032ce,
+        0xd918d962, 0xb122407d, 0x290229b3, 0x000017d8, 0x4366437a, 0x2b63d52a, 0x0b180b95, 0x00003439, 0xed6ced5f, 0x964c5673, 0xf40ef4c3, 0x000019b2,
+        0x1ab41ae7, 0xfb6e19d5, 0x3d653d83, 0x0000656f, 0x462a465f, 0x47c1abbd, 0x93b393b6, 0x0000f552, 0x95589558, 0x265ae193, 0x9eac9e1e, 0x00009850,
+        0x3157315d, 0xee86c867, 0x66af660d, 0x0000a7b1, 0xcf8acfde, 0x7fc01957, 0x5cc45cdf, 0x00008e9e, 0x7a407a3c, 0xa9614b99, 0x9c129cee, 0x00006c19,
+        0xc91fc953, 0x014625ab, 0x92109289, 0x00007b51, 0xc190c108, 0x8a37ff7a, 0xc661c67e, 0x00005399, 0x96ae9609, 0xfc865f2c, 0x08c708f4, 0x0000f9a1,
+        0xbec5bee7, 0x545c4b58, 0x4d974d32, 0x000045e4, 0xbe35be0d, 0xfa9b58d9, 0x98529881, 0x0000d048, 0x0301037d, 0x14c68630, 0x1b201beb, 0x0000cb94,
+        0xd770d7bc, 0x94e68d04, 0x89078966, 0x0000fea1, 0x3acf3aaf, 0x27ee9078, 0xa154a146, 0x000022c5, 0xd4d8d47f, 0x1d71da5b, 0x17fc174e, 0x00001736,
+        0xd754d7ca, 0x776de187, 0x68d3682f, 0x00006730, 0xd161d1d7, 0xc67c5ce4, 0x009a00e4, 0x0000d174, 0xfe2dfe78, 0x96ca3221, 0x582f58e5, 0x0000bbce,
+        0xfa5cfa25, 0xec8ef798, 0x45e94558, 0x000022f5, 0x178217bb, 0x46998c5d, 0x4d204d7e, 0x00002b56, 0x047504ca, 0x56d9779f, 0x44c44497, 0x00005984,
+        0x7dc17dd8, 0xca1c97be, 0xfa1bfa81, 0x00009397, 0x25d52554, 0x004a849b, 0x158c1521, 0x000087bd, 0x9e479e3b, 0x7ce37f3d, 0xa960a940, 0x00007bae,
+        0x0e850e5b, 0x53bf2ce6, 0xc657c6ee, 0x00008ef5, 0x50ae50f8, 0xf3e5e33e, 0x4c654cde, 0x0000a6b5, 0x7507757f, 0x4549252b, 0x00e900b0, 0x00002a3a,
+        0x2ad72a73, 0x7899b9ca, 0x246e24d5, 0x000056bf, 0xf2b5f205, 0xfd0d9627, 0xb940b9d8, 0x0000d5ca, 0xc019c08d, 0x5b896727, 0x6b766b26, 0x0000f00c,
+        0xb0e0b02e, 0x5c07f69a, 0xe201e26e, 0x0000df88, 0x464046ae, 0x0384315c, 0x124212f9, 0x0000b1a8, 0xc180c12b, 0x9405af29, 0x854a853a, 0x00003041,
+        0xfa20fab4, 0xe3d30036, 0x66876659, 0x0000f05c, 0x861186a1, 0x27b2128b, 0x86cc869c, 0x0000d8b7, 0x55e755a7, 0x40c71aaa, 0xc904c982, 0x00002317,
+        0x6cc86cf1, 0xac11ebcc, 0x14601423, 0x00007581, 0xd047d084, 0x0a5caa02, 0x664a66b9, 0x00007f81, 0x3ff03fbd, 0x2863027e, 0xd5a1d57f, 0x0000327e,
+        0x21a521a7, 0x791b288e, 0xe039e09a, 0x000000bd, 0x23fb2316, 0x91cf8ec1, 0xca3bcafe, 0x00008a45, 0x80048009, 0xb0b846ad, 0x6ea66e62, 0x00003241,
+        0x2057208d, 0x5eed7f47, 0x8ce68ca8, 0x0000ed29, 0x212421d9, 0x42ab6bca, 0xae65ae10, 0x0000e178, 0xcf98cf8d, 0x8c98af8a, 0xb888b8e3, 0x0000fdad,
+        0x0ab10a00, 0x91f0dbc4, 0xa298a230, 0x0000e4f4, 0x024802f9, 0x69dfb05a, 0x6c1d6cbf, 0x00001c0a, 0x94849441, 0x49aae5d8, 0xcc09cc19, 0x00009dae,
+        0xeb98eb3a, 0x393c70ab, 0x9fb89f7f, 0x000050a7, 0x3ddb3d99, 0x9bbe8bd3, 0x5a435ae4, 0x00009c0e, 0x0cc10cf5, 0x821fa752, 0x6c146c81, 0x00002fa4,
+        0x6bec6b2b, 0x6772384d, 0xeba9eb77, 0x00003f33, 0xc532c5dd, 0x180576d2, 0x61956152, 0x0000603e, 0xf846f86f, 0xda0532c0, 0xe960e990, 0x00004c0d,
+        0xb28eb25e, 0x9191ac19, 0x5a9f5a2d, 0x0000610f, 0xb52fb52f, 0xff9bae6b, 0x5ab65a50, 0x0000fb3e, 0xdd22ddc1, 0x9919bdc9, 0x6b5f6b21, 0x00002bc2,
+        0x4a3a4a57, 0x8e17444d, 0xd34dd324, 0x00005dff, 0x1d6e1d3d, 0x094c1fe1, 0xef7cefed, 0x00008142, 0xb344b340, 0x2092ded1, 0xb97db9ec, 0x0000cb94,
+        0x32e232ff, 0xb31d2e8d, 0xd5acd59d, 0x00007b4e, 0x05a70580, 0x27238ebe, 0xc6f5c61b, 0x0000a401, 0xac3cac26, 0xc6f41277, 0x5bb85ba1, 0x00009dae,
+        0x60af6064, 0x8998d5a8, 0xe276e236, 0x0000f871, 0x69c76912, 0xd3242fbb, 0xda18da3b, 0x0000f93a, 0xcc3accac, 0xc20beb0c, 0x018301ed, 0x000042c2,
+        0x0d390d7d, 0x48c80f06, 0x831b8340, 0x00008a1b, 0x842a8475, 0x25238f61, 0x88e08805, 0x00009083, 0xddd0ddc9, 0x166ab468, 0x6f606fd5, 0x0000027f,
+        0x62c96279, 0x8f18554e, 0x4160413c, 0x0000e7e2, 0xbbe9bb79, 0x351978cf, 0xf24ef2e4, 0x00005984, 0x6472644d, 0x8f66cdaa, 0xf549f514, 0x0000e707,
+        0x6547651b, 0x0804157d, 0x9c669ccb, 0x0000f198, 0x84f08494, 0x85f794bc, 0xa320a3d2, 0x00008c61, 0xab05abf6, 0xdea4dc38, 0xc18ac13a, 0x00008f1e,
+        0xaed2ae44, 0x087d56cd, 0xf3a2f3a2, 0x00002af9, 0x701c7079, 0x0976cf57, 0x70507099, 0x00007770, 0xf11bf1a4, 0x56b28e30, 0x2e472e17, 0x0000a22a,
+        0x745074bd, 0x7970632b, 0x17a91777, 0x00006c96, 0x6c156c71, 0xc43bfae5, 0x8a678a80, 0x00001788, 0xdf33df53, 0x06840d70, 0x21aa2103, 0x00008cf3,
+        0xae0daee9, 0x4de840bc, 0x1f6b1f21, 0x00006579, 0xe726e737, 0xcc7ae16a, 0xc05ec034, 0x00004578, 0xe03ae077, 0xe927f7d4, 0xcdeecdfe, 0x0000cb94,
+        0x356335d1, 0x9af1a6ac, 0x30c430b2, 0x0000d937, 0x878e8778, 0xa64f2a38, 0x8b688b3b, 0x00004aae, 0xdf7bdf8d, 0x3e97cad8, 0xc414c4c1, 0x000053fa,
+        0x8c8e8cdf, 0x34e1d675, 0x0fba0f4e, 0x00005a54, 0x960096d7, 0xa47ebccb, 0x940694d9, 0x000041cf, 0xb8ecb8dc, 0x48f6fef2, 0xdf70df9b, 0x00001780,
+        0x62826295, 0x1234fdda, 0xd32dd36e, 0x00004a0d, 0x0f860fb4, 0xe3d30ee6, 0x426d423e, 0x0000b28e, 0x91c89128, 0xd7ca5fed, 0x799879a9, 0x0000b8b1,
+        0x8dd78d51, 0x02a47650, 0x25ed25b8, 0x0000307f, 0x02740282, 0x52a7defb, 0x29d329dd, 0x0000be47, 0x0d1c0d98, 0x52207bd2, 0x5eb35eb0, 0x0000c7d3,
+        0xeb64eb6e, 0x9b3e9a55, 0x80d38017, 0x00004a0c, 0x3f263fd7, 0x7c6dc909, 0xb925b96b, 0x0000c012, 0x1dd81d87, 0x092658d9, 0x5e4f5e0d, 0x00008261,
+        0x96d29628, 0xedefad4b, 0xa35da367, 0x0000f450, 0xf9fff943, 0x68bfb1c7, 0x4b2b4ba7, 0x0000a55a, 0x440744b6, 0x74754cdf, 0x4c0f4cec, 0x0000024c,
+        0x8729873b, 0x60809a55, 0xe36fe338, 0x00000361, 0x4e964e57, 0x1dd50d86, 0x2d292d5f, 0x0000f3c1, 0xd5ccd549, 0x265dda3e, 0x51f75148, 0x00001fac,
+        0xf62cf654, 0x84b68115, 0xb3d6b39e, 0x00009558, 0x2009201b, 0x850af46e, 0x7909794d, 0x00007b31, 0x61176121, 0x138ea7d4, 0x118211f4, 0x00002e67,
+        0xcbadcb70, 0x5d06625a, 0x0020000c, 0x0000a638, 0x74ea74ff, 0xf25ad918, 0xa7a7a7a5, 0x0000ebf6, 0x6c586cc9, 0x3abec950, 0x97b097a3, 0x000015d6,
+        0xf473f4ba, 0x84f70d59, 0x0da60dc0, 0x0000307e, 0x175e17d5, 0x68bf9c1d, 0x1b271b60, 0x000017f7, 0xb32bb3de, 0x2aa2a5d4, 0x64f6642b, 0x000084a2,
+        0xb32eb39f, 0x25db0d06, 0x172817b9, 0x00000d18, 0x1ad31a5c, 0x7e3d4525, 0x888e8835, 0x00000072, 0xa99ea92a, 0x5e078a81, 0x3e213e9a, 0x00001068,
+        0x5403545e, 0x4d1f66d8, 0xda78da8e, 0x000086ff, 0x23c223a1, 0xdae568ba, 0xe280e2ab, 0x00000ab2, 0x34453401, 0xb48400c8, 0x52ef52f8, 0x0000d387,
+        0x2f3d2f23, 0x0a2a9130, 0x4a6b4a36, 0x00006a8b, 0x6e5f6e9a, 0xb48daafc, 0x87df8792, 0x0000068c, 0xb0b2b04f, 0x5fc9ccfe, 0x76367677, 0x0000f504,
+        0xa563a581, 0x191f4d56, 0x80378018, 0x0000f719, 0xd49ed49d, 0xfbce4c30, 0xb9b9b9c5, 0x000031ab, 0x1f831fa4, 0x327d7fc5, 0x08220881, 0x0000ef5f,
+        0x76497675, 0x0e79d5fb, 0x41e7415a, 0x0000751a, 0x0b040b2f, 0x515d0706, 0xfa81fac6, 0x0000fa41, 0x29e6299e, 0x752686f0, 0x0c2a0cd5, 0x00008b1e,
+        0x1bbc1bc1, 0x11550d25, 0x962796e1, 0x00001b7b, 0xc2d9c201, 0x0b272326, 0xb576b527, 0x00007d4e, 0x15a6157b, 0x4726765d, 0x287b2868, 0x0000e20d,
+        0xa2bea252, 0x9b799fed, 0xa280a2b2, 0x0000c8af, 0xa167a17d, 0x99a659fd, 0xd4b7d468, 0x0000f254, 0x473b47b2, 0x03bbfa9d, 0x9aa89ab9, 0x0000a8c8,
+        0x8ea38e42, 0x6bcd400a, 0x4c624cb4, 0x0000f62d, 0x51be51bb, 0xf6e207f4, 0xbd57bdb1, 0x0000eb16, 0xcdfccd54, 0xa07e0978, 0x713b7121, 0x0000f2ce,
+        0x833a8372, 0x1d419f27, 0x7b0c7bf4, 0x0000a677, 0x7d187d57, 0x0bcbcf51, 0xdca8dc23, 0x00000784, 0x4f064ffa, 0xd542396c, 0x0a540aca, 0x0000a1b1,
+        0xa7cca772, 0xcb9aa39d, 0xbb45bb34, 0x00003dfd, 0x15aa1554, 0xabdef1cb, 0x35c4352c, 0x00003394, 0x871a87d5, 0x8aa70b0b, 0x80b280eb, 0x0000fb4c,
+        0xbb72bb5a, 0x08ea5533, 0x69f269e3, 0x00003f50, 0xfd70fd12, 0x639e9fd7, 0x32673227, 0x0000bf24, 0xd980d96c, 0xe852e504, 0x35593558, 0x00001588,
+        0x6de76d37, 0xff8974e2, 0x483248d9, 0x00001ea9, 0xa84ca891, 0x5acbf30b, 0x8dc98d21, 0x0000c0ec, 0x57c9579c, 0xfeae37ff, 0x8d428da0, 0x00007d82,
+        0xd584d554, 0x2f883ece, 0x69af6905, 0x00005058, 0xb8edb88b, 0xedcecb74, 0x366b3693, 0x0000ef17, 0x0fc00fd3, 0xcaec26bf, 0x1c751c73, 0x00005564,
+        0x64bd6463, 0x8b47d8e6, 0x04eb04f2, 0x0000d959, 0xe13be127, 0x255933e0, 0x795f7939, 0x000018ac, 0x7927796e, 0xbf1b1502, 0x9f119f55, 0x00004cf0,
+        0xaaa7aa19, 0x1655eb02, 0xcd26cd04, 0x000047cf, 0xff3dff22, 0xbc245332, 0xf9b8f9ed, 0x0000ea81, 0x24c624d9, 0xcfd222df, 0xc340c30d, 0x0000d066,
+        0x6db96ddb, 0xdfdadebb, 0x6cf16cf6, 0x000048af, 0x22f92269, 0xcfa54306, 0xe2b9e2b1, 0x0000ae85, 0x47284736, 0x5f5d4fd4, 0x591d5954, 0x0000221a,
+        0x78aa78b9, 0xe57ff945, 0xd738d7cf, 0x0000688b, 0x8fce8fce, 0x36cefebc, 0x474b47e2, 0x0000f01d, 0x62f5626e, 0x9e53688b, 0x88d48888, 0x000031aa,
+        0x89d889ce, 0x6e7fc0a8, 0x35c435d7, 0x00005008, 0x4a1d4a6a, 0x5d07a3a4, 0x9bbe9b3e, 0x0000449e, 0xa7c8a767, 0x8a793320, 0xf5fbf5ed, 0x000082ff,
+        0x93b5935c, 0xbc6c0e59, 0x20322001, 0x000058cf, 0x26d726dd, 0x5e1dacc0, 0xe8b0e8fd, 0x0000551f, 0x15a515ec, 0xb4ffc95e, 0x0a7a0aae, 0x0000f21e,
+        0x7f337f6c, 0xe7520867, 0x4f0f4f68, 0x00002d76, 0x0c2e0cd6, 0x039b0288, 0x43c34320, 0x00003cf3, 0x7a857aef, 0x7d3947f8, 0xf33ff3a4, 0x0000bcf1,
+        0xefd3efdf, 0x79ce105c, 0xbf79bfd4, 0x0000b746, 0x96d69653, 0x6920f5ae, 0x4680469c, 0x000007c2, 0x3bc13b09, 0x610c02f9, 0x0f920f58, 0x000045a3,
+        0x423642ff, 0xb229f228, 0x26fc2646, 0x0000055d, 0x16d41616, 0x06a57969, 0x6bd06b3e, 0x0000e937, 0x3175318b, 0x47a5cb23, 0xea1ceaff, 0x0000f80d,
+        0x908990f8, 0xef6ce5ab, 0xaac0aa9c, 0x0000dc96, 0x065306df, 0xaf716403, 0xc3f4c3f1, 0x0000c187, 0x32973260, 0xaabdb560, 0x4ce84cfc, 0x00002a58,
+        0xb611b684, 0x937371ff, 0x3f653f87, 0x000066c0, 0xf971f957, 0x6022d136, 0x4d3d4d1a, 0x0000658b, 0x417f4104, 0x1f15b7b9, 0xf233f290, 0x0000f9a0,
+        0xce21ce49, 0x69508c62, 0xd465d498, 0x0000f642, 0xe121e1c6, 0x6cb55cf9, 0x226c22f5, 0x0000aefe, 0xcee5ceb6, 0xea20eeaf, 0x11e711e6, 0x000007e5,
+        0x6dd36dcb, 0x20a6dde8, 0x33143331, 0x00006c15, 0x43e84358, 0xcd0666da, 0xc1aec16c, 0x000095a6, 0xaffeafde, 0x42c68c0e, 0x360036e1, 0x00005609,
+        0x062c0661, 0x018b6727, 0x35783567, 0x00005774, 0x272a27f3, 0x34cdfef9, 0xfea4fe3a, 0x0000703b, 0x7db77db6, 0xedfc5532, 0x1e4b1efd, 0x00004d88,
+        0xa2a1a2a8, 0x85174666, 0x004d00c8, 0x000046bb, 0x8ded8d12, 0x513a2f99, 0x10a510ab, 0x00003411, 0x1f341fd6, 0x7535bf77, 0xf50cf572, 0x00008331,
+        0xb517b503, 0x78d82b32, 0x0b050be3, 0x0000869d, 0xc8d9c86f, 0x1fad8228, 0x577c57cc, 0x00000b55, 0x04f604f5, 0x8dd9b6d6, 0x02f802a9, 0x0000f75c,
+        0x13f2130c, 0x99f154cd, 0x0d540d85, 0x0000fa32, 0x374637f5, 0xe03093c6, 0x625f62fa, 0x00006a8b, 0xe70ae77a, 0xb1a3746f, 0xe460e471, 0x000041ee,
+        0x33f6331d, 0xba4f83ff, 0xc0acc08e, 0x000013c1, 0x714671cd, 0xc626148b, 0x0dea0db3, 0x0000ccc5, 0xaa9faa92, 0x61a088e1, 0x3580359b, 0x0000b105,
+        0xe0e9e08a, 0x62b18b93, 0x3fde3fd5, 0x0000e263, 0xb3edb39e, 0x3c8df051, 0xd58cd596, 0x00001c33, 0x06f30643, 0xfcf4acc9, 0x3115316e, 0x0000d50a,
+        0xeceeec2c, 0x7bd750b1, 0x22ae22ce, 0x00004d43, 0xd2d7d2bf, 0x77e2c535, 0x57515742, 0x00006c96, 0x57b95734, 0xa7d057f2, 0x33a133f6, 0x000043b0,
+        0x3f513f5e, 0xee108d5d, 0xef13ef21, 0x000095b4, 0x959b95a0, 0x23d2d4d4, 0xcddfcd07, 0x0000de74, 0x532a5386, 0x71d37188, 0xae86ae7e, 0x00004463,
+        0x56a3566e, 0x093507b5, 0x8227829e, 0x0000ee3e, 0x226a223b, 0xf6e2d348, 0x3ea03e6b, 0x00008dd1, 0x1a401ac7, 0xfa116dc7, 0xce36ce85, 0x0000962b,
+        0x121b12f7, 0x24229d1f, 0x8509857b, 0x00002352, 0xe1ace1b1, 0xeb111faf, 0x09c709d7, 0x0000971e, 0x6b556b4d, 0x47267204, 0x39203998, 0x00008950,
+        0x73c173bc, 0x8c794897, 0xbf78bff4, 0x000021cb, 0x7c8f7c10, 0x1e4c15c1, 0x2f712f11, 0x0000be8e, 0x6e276ec2, 0xb9235ea1, 0x67ec6757, 0x0000eebb,
+        0x6473647f, 0x069b3755, 0x06ac060a, 0x0000695c, 0x816c8172, 0x42f94a9b, 0x85108540, 0x000032ce, 0x2e9e2ee8, 0x0bcbf3e7, 0xec50ecc4, 0x00002746,
+        0x4aec4aac, 0xa29f7192, 0x1074107d, 0x00002489, 0x426d422b, 0x66ff71d2, 0x72037271, 0x0000ad98, 0x5fee5f6d, 0x95d9f1f4, 0x60c9607c, 0x00000503,
+        0x6d6e6de0, 0x270f885c, 0x8aa08ae1, 0x0000812b, 0x992399b3, 0x694c8070, 0xbb26bbc5, 0x00006a2b, 0x8d808d3b, 0xc27aa0a5, 0x996299b8, 0x0000bc4e,
+        0x33df338b, 0x4689baf5, 0x4e0c4e34, 0x0000f162, 0x45d045e3, 0xbece15f9, 0x2fda2f1e, 0x00000e72, 0x496d498f, 0xdc2e95be, 0xaed2ae7e, 0x000034d7,
+        0x657c6551, 0x10ee02f7, 0xfeb9fee7, 0x0000d4f8, 0xf75af7b6, 0xf551cc2d, 0x61766160, 0x00002a79, 0xec83ec91, 0xbcce2ffb, 0x992a9944, 0x0000704a,
+        0xfdccfdc0, 0x86b8b554, 0x635f63b6, 0x00004ea8, 0x8fb48f1c, 0x964a2c26, 0xcb3fcbeb, 0x0000ced5, 0x134e1328, 0xf05a4f56, 0x1b9f1b06, 0x000083a2,
+        0x5192513e, 0xcdf81b15, 0x711471a6, 0x00008280, 0x5ea25e7f, 0x9cbebc3b, 0x315d3112, 0x00008bb7, 0x4624465b, 0x80c883fe, 0x41e74118, 0x0000864c,
+        0x44064481, 0x35483221, 0x9adc9a66, 0x00001a32, 0xd810d893, 0x44f9808f, 0x158b1505, 0x0000f38c, 0x58cc5836, 0x0234c567, 0xb193b1b2, 0x0000ca09,
+        0xb742b7bc, 0xb033c3ba, 0x45774595, 0x0000f2f9, 0x0b360b8e, 0xa0de4899, 0x541454ee, 0x0000aa58, 0x7fdf7f47, 0xabfd85f1, 0x69c56993, 0x0000fbad,
+        0x4b024bc4, 0x0cc3a39b, 0x124c1233, 0x00007757, 0x67c06768, 0x3db6468c, 0xbea0be26, 0x00004b00, 0x450e45d5, 0xc9f4fcf9, 0x4f0a4f17, 0x00009084,
+        0x2b102b9c, 0x56fb3d4e, 0x5f4e5fbb, 0x000049a9, 0xcd60cdbb, 0xcb7a82b8, 0x5c155c04, 0x000019b6, 0xc001c08b, 0x8294393f, 0xe20de2c2, 0x00008360,
+        0x0f1a0f90, 0x51ed2a80, 0xe80ee800, 0x0000fecd, 0x66cb6613, 0x6fc266a4, 0xf21ff2d6, 0x0000b96f, 0xebd0eb67, 0x6f604538, 0x2a3b2a71, 0x00009cc8,
+        0xa25aa29a, 0x1005d0e8, 0x9b029bae, 0x0000be5c, 0x253725da, 0x3e1c2904, 0xc5f5c5ab, 0x0000456b, 0x27e82743, 0x6c60ba4a, 0xda65daa3, 0x00000c43,
+        0x411041b2, 0x1c4a3880, 0x704e7099, 0x0000f923, 0x69b5696d, 0x16c8fe87, 0xf779f725, 0x0000fc4c, 0x35a835a2, 0x68c39227, 0x084208ec, 0x0000d8b7,
+        0x27c127b1, 0xb675f203, 0xcd82cdf2, 0x00000f83, 0xdb3edbd9, 0x4c27044b, 0x782478b7, 0x000039ed, 0xc043c03e, 0xfcaa7c01, 0x8b1f8b89, 0x00008260,
+        0xbde9bd82, 0x48a0a5aa, 0x886288bd, 0x00007a5e, 0xd1ccd107, 0xceb9f7d7, 0x18181852, 0x00006191, 0x33d433c4, 0x4b0bc867, 0xdbc9dbcc, 0x0000c1b9,
+        0x4bf64b4b, 0x16e4775c, 0x5b9a5bb7, 0x0000f216, 0x60cd600f, 0xa21d8fa0, 0x6f006f61, 0x00004a48, 0x63cc6306, 0x7fc1bfb6, 0x69806936, 0x0000e503,
+        0x4a8f4a37, 0x5d682f47, 0xda4dda86, 0x00003ea2, 0xf95cf927, 0x3ed86c62, 0x252a25d9, 0x00009659, 0xd080d044, 0x96ca69f7, 0xaeefaed1, 0x0000881e,
+        0x2df22d69, 0xf9d96352, 0xd05ad010, 0x0000e789, 0x94229454, 0xd33c6f93, 0x81158199, 0x0000020c, 0x3eb83e6f, 0x22879bc8, 0x251225f9, 0x00002fc8,
+        0x1a151ab8, 0x5aa75372, 0x9dc59d80, 0x000086c0, 0x9eb89ea2, 0x2a6391ef, 0xa878a8c2, 0x00000a51, 0x6fea6f6c, 0xf396572b, 0x85a285e7, 0x0000e58a,
+        0x1efa1e4d, 0xdecdc0c1, 0xfdabfd5b, 0x0000ab64, 0xad36ad17, 0x7af6ced2, 0x6b596b55, 0x0000c4c1, 0xe0c5e0aa, 0x783d32a3, 0x8a638a0c, 0x00001945,
+        0xe49fe442, 0x6335479f, 0x682068f1, 0x0000599f, 0xdc15dc93, 0x346fb69f, 0x4b904b2e, 0x00000ebc, 0x0f400f8e, 0xdcf30c36, 0x66c6669e, 0x0000dfdc,
+        0xb4f4b454, 0x0c3a485f, 0xaadfaa69, 0x00002b67, 0xe393e340, 0x1fb5812f, 0x70a07072, 0x0000e272, 0xfe47fe17, 0x4d363ab0, 0x24b5242e, 0x0000dbea,
+        0x767d76f1, 0xcbb0d977, 0x1da91de9, 0x000048ae, 0x76f67612, 0x9ec7e5a3, 0xc83fc862, 0x00005136, 0x43324324, 0x86b6c725, 0x0b480bee, 0x00000740,
+        0xb644b60e, 0x9a1eb8c8, 0xea26eae0, 0x00008bef, 0xc2a9c2b0, 0xfd44b426, 0xcf7acfa3, 0x00009ef6, 0x24c524cf, 0xd34b7a9d, 0x834f83ab, 0x0000ce80,
+        0x4bcf4b91, 0xb7dc246d, 0x0702079a, 0x00002bbe, 0x02e70283, 0x1fb56b74, 0xe753e7ec, 0x0000be9e, 0x3e603ea2, 0xbf6cdd1d, 0x824d82ba, 0x000093b5,
+        0x332f338c, 0x4f5efcda, 0xc8f3c8b0, 0x0000e32b, 0x1c681c61, 0xc25d824c, 0xca3fcad1, 0x00003f50, 0x653b6562, 0xcf45b98b, 0x031403aa, 0x0000129a,
+        0xc230c243, 0x69a0b8c9, 0xd182d120, 0x00006f17, 0xadfbadb7, 0xb05dc557, 0xb97cb927, 0x0000d377, 0x023002ff, 0x65d39ea1, 0x8a4a8a03, 0x0000e34d,
+        0xde15de83, 0xc55fc5a1, 0xf6f6f650, 0x0000cf7a, 0x9f179fe5, 0x32efe69f, 0x8c968caf, 0x0000a7a7, 0x8d888dac, 0x9806e5a1, 0xc553c568, 0x00005cb0,
+        0x1b0e1b9f, 0x2ff31a5e, 0x982e9860, 0x0000fe9f, 0x526452ce, 0x87eb0d3a, 0x8a1b8a33, 0x000098d8, 0x3f1e3fde, 0xff3d5691, 0xf9aef912, 0x0000829f,
+        0xf104f1f1, 0x2c29dfd4, 0x2aec2a4a, 0x00005208, 0x2fd42f74, 0x11552bbf, 0x24ff2462, 0x0000ed5f, 0xad22ade8, 0x12e57dc1, 0xe02ae039, 0x000031ae,
+        0xa08ea08f, 0xacde00c8, 0xc29dc231, 0x000081a2, 0xdc2adcdc, 0x9863f944, 0xf60af6c2, 0x0000da0a, 0xafa2afb7, 0x2e29e1a1, 0x19821989, 0x0000a8c9,
+        0x40bf40b5, 0x5222fdda, 0xe97ae981, 0x00001b7a, 0xf21cf28c, 0xeb99c489, 0x80518063, 0x00004e08, 0x3da83dbf, 0xfb6e2657, 0x6ea76e25, 0x000090bc,
+        0x55525526, 0x81565dae, 0xf50ff5d5, 0x0000a0c8, 0x19f91950, 0x0aea0537, 0xc36bc3c7, 0x0000db2b, 0x40424025, 0x10cb34ee, 0x2d642dcc, 0x000042b2,
+        0x97a497ea, 0x9e5338d1, 0xfcc6fc0b, 0x000019b2, 0xe8c5e809, 0xa57bdaa5, 0xcaf5cafb, 0x00000353, 0x157c15d5, 0xb8097fbb, 0xe995e93e, 0x00002729,
+        0x160516f9, 0x7e552162, 0xe428e4b4, 0x00008671, 0x96489600, 0x26234146, 0x965496c4, 0x00006d2a, 0xd8e4d896, 0x76b5a1d9, 0x90eb9089, 0x00007c7d,
+        0x47924715, 0xf07fe2a3, 0x2bfa2bb2, 0x00009338, 0xaa79aa1b, 0xe71ea70e, 0x47214725, 0x00001d14, 0xa977a967, 0x891617fc, 0xad31add6, 0x000030c3,
+        0x464946e4, 0x5f32effc, 0xae63aeb5, 0x0000f31d, 0x47ef47ea, 0x4814ac3f, 0x2f572fe8, 0x0000f6c1, 0xd99fd942, 0x48a9cfa8, 0xa1f9a158, 0x00008130,
+        0xdcf7dc65, 0xc2e400ca, 0xb9acb969, 0x0000f4ad, 0xae2dae17, 0x4f3689ee, 0x567d561f, 0x0000f255, 0x95859503, 0x5c6b67a7, 0x6c7e6cb6, 0x00006108,
+        0x69b2694d, 0xc55bca08, 0xf936f940, 0x00000583, 0x824782b0, 0x9ace8968, 0x7e517eb0, 0x00008571, 0xeba8ebec, 0x48f99d5f, 0x80c880e3, 0x0000e7d2,
+        0x00e200df, 0x158a07f7, 0x93fa93e3, 0x0000b922, 0x714f71f0, 0x1171ad3f, 0x2ea32e1e, 0x0000c442, 0x39a4392f, 0x7638573d, 0x294629f7, 0x0000c412,
+        0x117811ac, 0x788aa437, 0xa61fa64b, 0x00003240, 0xed5eed64, 0xa74158a4, 0xfea4fea4, 0x000014a5, 0xafcaaf39, 0xb6994a90, 0x7d9c7d45, 0x000057f9,
+        0x7f087fa7, 0x4199a8bf, 0xcf18cfc2, 0x000028fc, 0xfcf7fcdf, 0x98f17bc0, 0xf99af92e, 0x000056b9, 0xfed8fe0e, 0x666e6c86, 0xa83aa8f7, 0x00007991,
+        0xd035d08f, 0xa6f24580, 0xe2b3e2b6, 0x0000c413, 0xf834f822, 0x48abe21b, 0xea00ea27, 0x00009fe0, 0x8ec58e9f, 0xe643f1ac, 0x663166d7, 0x0000adba,
+        0x58b3580b, 0x88a687ec, 0xd3add371, 0x0000d967, 0x02ae0201, 0x86d5cbf1, 0x59c159d6, 0x00004cf6, 0xc874c81e, 0x3abe9ac8, 0xe7e4e777, 0x0000206c,
+        0xd3b3d32d, 0x9479f80d, 0x2c562c01, 0x000026ea, 0x010601eb, 0x01c35534, 0x10bd1091, 0x0000da91, 0xae5faee1, 0x05159bbe, 0xd0add017, 0x0000e82b,
+        0x4fe74f2d, 0xf0a03dce, 0x37fc374f, 0x0000ed89, 0x9b479b66, 0x1c4a7ad5, 0xdaf2daa7, 0x0000a1b5, 0xe2abe27d, 0x57ff216b, 0xd29fd22a, 0x0000283a,
+        0x75d8755d, 0xbaccf3ac, 0xe434e483, 0x00009ff1, 0x99cc9959, 0x34d86cf4, 0x1f661fbe, 0x00008e1b, 0xe2d5e2fc, 0xc10b63d3, 0x6e236ef2, 0x0000209c,
+        0x6fd36fac, 0x23039038, 0x4f724f6d, 0x00003913, 0x7b597b1a, 0xcf2a31df, 0xef7aeffc, 0x00000894, 0x58ec589e, 0x80269d5c, 0x8b708b30, 0x000000dd,
+        0x6d2a6db2, 0xf24ac0f7, 0x41fa41df, 0x0000b1a8, 0x0bc20b12, 0xb053f46e, 0x4cde4caf, 0x0000585e, 0xbeb2beee, 0x025a9f63, 0x7d867d3a, 0x0000f79c,
+        0x18311825, 0xe923c922, 0x472847a8, 0x000032ce, 0xb8cfb83d, 0x4a8bccfb, 0x8bc58b22, 0x0000880e, 0x056f0529, 0x81679741, 0xb7bdb776, 0x00006325,
+        0x27ef270c, 0x6ebfb147, 0x5f475f7c, 0x0000c227, 0x780e78e1, 0x62506603, 0x735e7357, 0x00005706, 0x2edc2e7d, 0xdf54988a, 0x992599be, 0x00002621,
+        0xa085a0f7, 0x6412cfd1, 0x26a226f7, 0x000087b9, 0xc5eec523, 0x44f6c23d, 0x3f1a3fd0, 0x000040f0, 0xf55ef559, 0x1a9310df, 0x0341038f, 0x000055fa,
+        0x75347566, 0x41241255, 0xc752c752, 0x0000cfcf, 0x291029ad, 0x1b117731, 0x3b6e3b90, 0x0000cb69, 0xffd7ff6d, 0xb81dc7c6, 0xe257e246, 0x00009f7b,
+        0x394f395d, 0x145e7ba0, 0x502c5040, 0x000082ff, 0xbb3bbb1f, 0xb50865a3, 0x4bda4bdb, 0x0000c803, 0x02700216, 0x649be83c, 0x30763009, 0x00000fd3,
+        0x0dc20d65, 0x6ec1df28, 0x964e9611, 0x0000fab9, 0xca19cad4, 0xd1926cb4, 0x188818f1, 0x000043d1, 0x1bbb1b1d, 0xf7be47e9, 0xd631d697, 0x0000fc9e,
+        0xaf0baf74, 0xd1078300, 0x53c45325, 0x00001fa5, 0x679e677b, 0xa41dd5f4, 0x5e3d5ea5, 0x00006de1, 0x2c092c0f, 0x45451cda, 0xd05ed033, 0x00005059,
+        0x36ca36f3, 0x112a1259, 0x7e827e1e, 0x0000be6f, 0xfaaffab8, 0x12f0c9ee, 0xd29fd298, 0x0000cda1, 0x122e12a8, 0xe5a3e2ef, 0xdbb2dba4, 0x0000898a,
+        0x3aa43a3c, 0x4814f157, 0xf0acf01a, 0x0000ea7e, 0xe233e204, 0xf39b958f, 0x3b4d3b49, 0x00003d4c, 0xe0dfe08b, 0x3728f6e7, 0xc1f3c1f0, 0x000081a2,
+        0x655665f9, 0xf89beea4, 0x32dc32b5, 0x0000a7c7, 0x29e229b7, 0xa4337ff6, 0x42f5420e, 0x00009f0e, 0x95e9955b, 0x5dc8b287, 0xf361f3f5, 0x00003a12,
+        0xe639e60f, 0x3bc31855, 0x917f9181, 0x00009ea7, 0xe1bee193, 0x809f15c2, 0x7ff57f6c, 0x00004678, 0x24122494, 0x4b7fffac, 0x86c6860a, 0x0000729a,
+        0x6541657c, 0x7bdd861f, 0xae47ae77, 0x00002e67, 0xace6ac74, 0x45788ca1, 0xc4aec482, 0x0000cb94, 0x5be25b6b, 0x3c02dc97, 0x5ed45e63, 0x00006051,
+        0x02c60223, 0x203d6e4b, 0xe877e892, 0x0000d177, 0x1888185b, 0xd69d7813, 0xde35de9c, 0x0000dfd7, 0xaa56aa9a, 0x71cdb715, 0x4b3e4b56, 0x0000d208,
+        0x6bc96bda, 0xac5b1141, 0xd359d34c, 0x000012f7, 0x464946dd, 0x72758fcf, 0xeb4eeb59, 0x0000cb94, 0x51745175, 0x6ff06ac9, 0x676d6731, 0x0000962a,
+        0xb5e9b5d1, 0x8827866e, 0x87628717, 0x0000574a, 0x2f572f8b, 0xc52563aa, 0xc646c60c, 0x00000d46, 0xd448d4b3, 0x4b89c4fc, 0xf50af571, 0x000028f9,
+        0x74d374ec, 0x49d41361, 0xf571f5f0, 0x00003d0f, 0x184418bb, 0xa09ead3c, 0xbab7bac3, 0x000044b0, 0xbe6abeb3, 0x2d52fa8e, 0x2875283e, 0x0000acb9,
+        0x6ac46aa1, 0xee686196, 0x05f00512, 0x0000bb91, 0xd443d40c, 0x452612da, 0x814981b3, 0x00006d70, 0xd2c9d2f2, 0x79cf77da, 0xdb54dbae, 0x0000591f,
+        0x211121b2, 0x086ac4ce, 0x8a6f8ad0, 0x00001788, 0xa6dca657, 0x44a628b4, 0x9d2b9d3b, 0x00002865, 0xf635f653, 0x768ec465, 0x5453542c, 0x00004610,
+        0x9d2b9d3b, 0x55e71d50, 0x6e766ed2, 0x000006dc, 0xf7cff74a, 0x0a25a0ea, 0xf90cf906, 0x00004a9d, 0x47134700, 0x1e4d2602, 0x005b00a7, 0x000051d8,
+        0xacaaacd7, 0x101c72d2, 0x7f0d7f58, 0x00008a25, 0xa8eda89c, 0x09cb40c3, 0xc443c4ff, 0x0000125b, 0x6cbf6cc6, 0x545d607a, 0x7d5b7d1b, 0x0000a809,
+        0x4b024b8c, 0x98f1f157, 0x926f92c2, 0x0000d267, 0xc530c5d1, 0xe20ade1d, 0x7f547f35, 0x00004b9b, 0x95a895a4, 0x9aeceff0, 0xec97ec77, 0x00002066,
+        0xc58ac5f4, 0xb48d3a4f, 0xd158d1f9, 0x00002025, 0x5f2f5f24, 0xd48df69a, 0x61886198, 0x00006426, 0x47ee47ae, 0x4e54e3e7, 0xf2a7f27d, 0x0000bff1,
+        0x188f18e0, 0xe45c0714, 0x67da672e, 0x0000af38, 0x37e3372f, 0x1c4857ce, 0x9b6e9b0f, 0x00005f8a, 0x0a3b0a47, 0x6fc238ff, 0x11191164, 0x0000a919,
+        0x5b185b5e, 0x4366182c, 0xf034f090, 0x0000d867, 0x2ede2e14, 0xcf7a5748, 0xd16ad16b, 0x00003fed, 0x4aea4a2a, 0xa981dfa4, 0xbd6ebdc5, 0x000097e0,
+        0x1bd61b16, 0x01fbadac, 0x6dbf6d9a, 0x00001336, 0xd3f3d340, 0x8d387767, 0x704a70c3, 0x0000f719, 0xe36ae379, 0xb0ba814c, 0xa987a94e, 0x000066d0,
+        0xac7aac55, 0xbd4fc4ce, 0xa4ffa41b, 0x000050a7, 0xdd90dd44, 0xbc4b7a56, 0x1b231ba0, 0x0000483c, 0x42e44243, 0x9157e5dc, 0x888d8836, 0x0000e592,
+        0x29de29b6, 0xf229479c, 0x958d95af, 0x00009a01, 0xb249b20e, 0xf6518231, 0x475f477d, 0x0000e3a4, 0x4ae04aa6, 0xdf04f2bc, 0x6c1e6cb7, 0x0000007f,
+        0x570d571b, 0xf8496527, 0x8d688d3a, 0x000067af, 0x19c01917, 0x0cbcf92e, 0x21f3215e, 0x00008961, 0xdaeada37, 0xf7b65216, 0x8d388dfe, 0x00005b54,
+        0x93b693cc, 0x4ac96a77, 0x53a153c4, 0x0000ae8b, 0x2f232fff, 0x5f6a25d6, 0x7c127cea, 0x00003c9f, 0xfbcafb14, 0xd3ba55b1, 0x941f944b, 0x00003d13,
+        0x8f578f7f, 0xff76d8a6, 0x720272c6, 0x0000f221, 0xa7cba7cd, 0x58d876f0, 0xb214b237, 0x00008b40, 0xe3a3e331, 0xd1928071, 0x13f11300, 0x0000231e,
+        0x7fc87f8c, 0x364d61e9, 0x232723dd, 0x00004392, 0x8b528b6e, 0x7d53b1b8, 0x4c264c81, 0x00001f73, 0xc2d8c27d, 0x5856bbe6, 0xcda1cd86, 0x00003a2d,
+        0x4eed4e43, 0xbb13f54c, 0x32df32ca, 0x0000a9a6, 0x299f29c5, 0xd33257fc, 0xae3aaea7, 0x00006b6a, 0x7ea17ea6, 0x46666224, 0xbe73bee8, 0x0000395c,
+        0xbd9ebdc2, 0xc5cad97b, 0xe195e139, 0x00003bb9, 0x46d8467f, 0xb4fb6708, 0x21e02140, 0x0000fc5c, 0x410d4173, 0xfb6e2980, 0x91049114, 0x00000205,
+        0xe3c2e35d, 0x393ceaf2, 0x51245178, 0x00005856, 0x27832791, 0x5f4f875c, 0xc37bc38d, 0x00006a15, 0xa2e6a268, 0x0e688df3, 0x5b6f5bf8, 0x0000d7da,
+        0xd8cfd85d, 0x38b8dfd4, 0x5e445e37, 0x0000e5f4, 0xd742d709, 0x840ad984, 0x7d9b7da0, 0x0000d0a5, 0x1a631ad6, 0x610c211f, 0xd10ed1c6, 0x00008c23,
+        0x4f164fd0, 0x6ec1bb12, 0x6f076f49, 0x000025ff, 0x562c5687, 0xe1a34f2a, 0x54355441, 0x000013bf, 0xd652d65a, 0xd53c72ab, 0xcb4ccbbb, 0x0000eafd,
+        0x02940227, 0xbbece164, 0xe4a8e4f6, 0x00001298, 0xad1badbb, 0x06e11ee1, 0xb476b421, 0x0000d674, 0x13c71371, 0xdb51b058, 0x2be32b8a, 0x0000a33c,
+        0xd1d1d157, 0xe19d00f7, 0x1f661fb1, 0x00003d13, 0xf067f0a3, 0x75375212, 0x0be80bbf, 0x00007331, 0xe79ee742, 0x87046b34, 0x0517052b, 0x00004ed6,
+        0x966b963b, 0x4d36edcc, 0xa876a892, 0x0000f251, 0x5ef55ec5, 0x784ae5a1, 0x200e2023, 0x0000e816, 0xd73dd7fd, 0xa981e213, 0x890489dc, 0x00000962,
+        0xdb11dbfd, 0x75b29245, 0x355e35e8, 0x00002f59, 0xb3cfb39a, 0xc79d5a23, 0xc487c4d2, 0x00003c06, 0x7a4b7a5b, 0x1d6a662d, 0x84bc842c, 0x0000bd9e,
+        0xf89bf851, 0xdc7a9157, 0x0cab0c4a, 0x0000deb7, 0x412c41b4, 0xe7c15922, 0xeb4eeb0e, 0x00009cb6, 0x94289411, 0xc03bd6b7, 0x4a8f4abf, 0x0000b105,
+        0x1ecd1ec4, 0x0b54affc, 0xef82ef08, 0x0000021b, 0x9a3c9a34, 0xdf712590, 0x5e4f5e58, 0x0000dd28, 0x35b335a0, 0x08eadde5, 0x139513c9, 0x0000d9a5,
+        0xd73ed702, 0xef0e9ec8, 0x84ed84d4, 0x00002977, 0xc8a9c864, 0xd56bd0f7, 0xf582f5c4, 0x00006abd, 0x5d515d97, 0x3d50cd6e, 0x591a59e7, 0x0000dd2a,
+        0x6c246c36, 0x07d4b0a6, 0x37643729, 0x00008941, 0x41ac4113, 0x6391532b, 0xc059c0d6, 0x0000ca40, 0x62d6627b, 0x15bede5d, 0x97c097d3, 0x0000fc0d,
+        0x342c3477, 0x27b182f5, 0x6f6d6fdb, 0x00008f61, 0xdd56ddc7, 0x2078073a, 0x918791db, 0x0000a2c6, 0xaf65af5d, 0x6a236e34, 0x447344cc, 0x00005484,
+        0x8cf98c03, 0xb3003e4d, 0x0fb40f84, 0x0000b06e, 0x8dd28d3c, 0xb3e184fe, 0xa06fa09f, 0x0000a194, 0x095d09ea, 0xc864f93a, 0xc654c6eb, 0x0000976b,
+        0xd4dcd4ef, 0x8ac7d901, 0xb0c8b06f, 0x000032dd, 0x842b84f6, 0x5306c5c3, 0xd593d5f0, 0x0000c436, 0xfadffa4a, 0x38dfe522, 0x1f7d1fa7, 0x00004cf3,
+        0x11d81149, 0x5c93d85b, 0x502c5010, 0x000001ac, 0x08e90824, 0xcef8ea0c, 0x06df061c, 0x0000d23f, 0x27f927c9, 0xbb504fd7, 0x05390506, 0x000024fc,
+        0xea83ea36, 0x711cff43, 0xb008b0b2, 0x00003a92, 0xdb9adbb7, 0x8e465922, 0x0aa10ac5, 0x000001ff, 0xe128e176, 0x2bd264bd, 0x03bc0395, 0x00003639,
+        0xa799a777, 0x9a1ef7ac, 0xd799d76a, 0x0000369c, 0x70fa7037, 0xeb58544e, 0x760e7675, 0x0000e95f, 0xa824a8e6, 0x393c81b3, 0x3b623b5d, 0x00003743,
+        0x9f349f67, 0xd26a250b, 0xf578f555, 0x0000d3a5, 0xe0a0e08f, 0x304be05d, 0xd86ad80f, 0x0000637a, 0x4b8d4bb6, 0x7fc07aff, 0xa340a38d, 0x00006da1,
+        0x02d60283, 0x6850fee5, 0x9f2e9f19, 0x00002d1c, 0x5d1c5d76, 0x2cdc9f27, 0x40074005, 0x0000c644, 0x78d57826, 0x7b70d4cb, 0x209720e7, 0x00001885,
+        0x941194c6, 0x72da4650, 0x65cb65c3, 0x0000a7e6, 0x092a092b, 0xa77e53bc, 0x22132224, 0x00004a43, 0x38313896, 0xd8206d19, 0x6dc36d90, 0x00001353,
+        0xd38bd304, 0x3baf7d3f, 0x4833481a, 0x000067f0, 0xc6f5c6dc, 0xadfd7097, 0x472847a6, 0x0000f0d2, 0xeb16eb9f, 0xb37c52ee, 0x17d51705, 0x0000770f,
+        0x596c599e, 0x03f155cc, 0x75f27576, 0x00008361, 0xb4c5b4bc, 0xab233b6f, 0xba4abaed, 0x000078ec, 0xa49aa4d9, 0x692216f0, 0x131f13d1, 0x00002556,
+        0x7c797c08, 0x6f7d14c6, 0x820c829d, 0x0000cf52, 0xf7e2f744, 0xe7e305b4, 0x0af60a58, 0x00008c50, 0x4a134a41, 0xebb98072, 0x2c322c00, 0x000083a2,
+        0xb0e5b023, 0x29f3c7fd, 0x002700de, 0x00008073, 0xab58abb7, 0x0ed509d7, 0x34083427, 0x00005567, 0x5655568c, 0x8bc705c8, 0xd565d575, 0x0000332f,
+        0xfdbefd68, 0xa01c4bdb, 0x81e081e5, 0x00005c29, 0x9ef29e7e, 0x43858993, 0x9b819b65, 0x00007461, 0x512451ad, 0xca052d46, 0xe590e582, 0x00001aca,
+        0xdaccda5d, 0x1c8a1bec, 0x079d0719, 0x00001617, 0x309f300c, 0x6940e2e8, 0xf24ef2db, 0x0000a13b, 0x110311f0, 0x67fb0285, 0xbac2ba12, 0x0000c583,
+        0xec7bec60, 0xeb12c3a8, 0xd1aed15d, 0x0000c4b2, 0x8e208eea, 0x2d30e9b0, 0x195819b9, 0x0000aa0d, 0x84ab84cd, 0x635e37ff, 0x61686119, 0x0000fac4,
+        0x4f504ff3, 0x7a0d45fb, 0x945d94f6, 0x00009f46, 0xb5d0b5d6, 0xdddb2f46, 0xb3ceb365, 0x00002466, 0x486f48d0, 0x359a3e37, 0xb3aab310, 0x0000f99e,
+        0xe896e84d, 0x56900261, 0x91719198, 0x0000e4f5, 0x25882588, 0xb247a31a, 0x154a1519, 0x00001dc3, 0xe340e333, 0x0fa5c867, 0xcb84cb31, 0x00001a6e,
+        0x7a327a14, 0x1ddac89e, 0x97909724, 0x00008ce1, 0xb9d0b99b, 0x8fc7e0bd, 0x652c65a9, 0x0000b149, 0xd808d8a4, 0x79cd03f5, 0x40f540fe, 0x0000b601,
+        0xc11ac17a, 0x931c3e30, 0x68ae6867, 0x00008972, 0xb650b62c, 0xb86c6b49, 0xeebfeeb0, 0x00009d31, 0xe3b8e37c, 0x829e813e, 0xd961d92f, 0x00008e61,
+        0xb834b84c, 0xcbeb958d, 0x125e1218, 0x000072e5, 0xe7ace74e, 0x3847f61c, 0x3a183abb, 0x0000cacf, 0x08250822, 0xb2281ce1, 0x08990871, 0x0000e2f3,
+        0x01e20101, 0x64fc0e61, 0xbe6abeec, 0x0000c90b, 0xc5aac57d, 0x54a4af89, 0x10191078, 0x0000abc8, 0x3ed13e36, 0x289252ba, 0x505d50e9, 0x00005402,
+        0xeee1eec2, 0xfa49b05a, 0xf22ef218, 0x0000e8f6, 0xe818e809, 0xe61e3df2, 0x70ac7078, 0x000002ce, 0x6822682a, 0xc65cf958, 0x0eca0e22, 0x00009715,
+        0xdb5bdb8f, 0xb962225d, 0x421942b0, 0x00000ebd, 0x35613555, 0x47da2ac6, 0xf025f0d6, 0x0000dbd5, 0x6ac96a19, 0x6a40bee4, 0xb721b7b8, 0x00005ee8,
+        0xe441e4db, 0x88256559, 0x4e4f4e44, 0x000020a9, 0x27ec277d, 0x51f0f8fa, 0x704b70c7, 0x00002cea, 0x7bb57bdd, 0x81b62b33, 0x66da6679, 0x0000c707,
+        0x56e256d7, 0xeacd1615, 0xb916b976, 0x0000e8d6, 0xae19ae9a, 0xeeecc9bb, 0x3a373afb, 0x0000af38, 0x800a8032, 0xb61acb51, 0xdb04db89, 0x000001ff,
+        0xed17ed52, 0x4e58ff28, 0x823e82a3, 0x00006c66, 0x81dd812c, 0x74bf8504, 0xda4dda1c, 0x000055e8, 0xefc1efe5, 0xdd4d3840, 0xc9fec94a, 0x00007861,
+        0x3c003cde, 0x45460239, 0x0b1c0b52, 0x0000ce56, 0xae12ae25, 0xae0fbc35, 0xa706a76e, 0x00002857, 0x50295081, 0x4f10cbd8, 0x627362b7, 0x00001d88,
+        0xd557d5de, 0xe6f26b49, 0x4b0f4b4c, 0x00009f0e, 0x35bd35db, 0x0b56c9dc, 0x66e06657, 0x00003b4c, 0x73ad733d, 0xc91da897, 0x9daa9d2f, 0x000023cb,
+        0xa414a431, 0x09d52b21, 0x5c785c3a, 0x000021a4, 0x48e7488d, 0x0132ee80, 0xc86ec8d6, 0x00000272, 0x384e38cc, 0x5cb8ffbd, 0xa2e7a22c, 0x0000e4a4,
+        0x1fc51f13, 0x1e06c3c0, 0x4c6a4c37, 0x00002e67, 0xfc38fc0b, 0x7cdd5ed2, 0xa7d9a787, 0x00007470, 0x35533524, 0x791ab8c8, 0x23dc2331, 0x0000a66f,
+        0xd6e9d6d6, 0xfbcfa0c0, 0x3705373f, 0x000058b4, 0xc689c6a6, 0xd10e2bc0, 0x35b93576, 0x0000370f, 0xf229f210, 0x1e81272b, 0x248024f1, 0x00008181,
+        0x40c540db, 0x68ded3b7, 0xbf2ebf00, 0x0000f193, 0xf437f4cb, 0x01869538, 0xb1efb1b3, 0x0000e20d, 0x1f471f68, 0x16556bf5, 0x329c32b3, 0x00000d99,
+        0xec7aec41, 0x78b5765b, 0xa48fa436, 0x0000f0cb, 0xdd34dd08, 0x53392755, 0x906b9018, 0x0000ed94, 0x067b065b, 0xb299d7ba, 0x41ac4107, 0x00007bbd,
+        0x5ca05cb2, 0x683cea2c, 0x0986093c, 0x000004cf, 0x7ba77b98, 0x85845dee, 0xd021d061, 0x00001eac, 0x0e160e71, 0xf318c2ba, 0x9ccf9c69, 0x00008518,
+        0x05160579, 0xbf635cd2, 0x786978d2, 0x000013a1, 0x78307812, 0x265a459c, 0x5a335a0f, 0x0000c9aa, 0x7a4b7a5a, 0xd13b47d4, 0x7f737fcb, 0x000076df,
+        0x020f02a2, 0x2f0facdb, 0x916d9137, 0x0000e7ad, 0x3c243c7b, 0x3d885ae3, 0xd2f2d215, 0x0000ed75, 0x339c33d2, 0x2d532e43, 0x4a364ad2, 0x0000e2a5,
+        0x70e77005, 0xfd9588d0, 0xa58ea57d, 0x00002635, 0xda49dab2, 0xa743a9bd, 0x0d000d31, 0x00005bdc, 0x1a3d1a39, 0x91836eca, 0xf898f895, 0x000052c9,
+        0xdd2cdd64, 0x3ea27232, 0xd801d864, 0x000007df, 0x7a8f7a81, 0x13f99a48, 0x98d198f4, 0x0000d048, 0x14a514f5, 0xb255cb51, 0x43f24351, 0x0000f75c,
+        0xd598d58a, 0xbf94c749, 0xa269a2a5, 0x00003a2d, 0x45ee4515, 0x731aabc0, 0xb7ecb7be, 0x0000febc, 0xb6f4b658, 0xffcf2ddf, 0xd919d943, 0x00002497,
+        0x2db42d41, 0xaf32c96b, 0xdc37dcf7, 0x0000dede, 0x7c047c58, 0x2412b5fb, 0x833683c3, 0x000046ef, 0xc523c528, 0x9bbf6a4b, 0x0f6b0f48, 0x0000d66a,
+        0x6cea6c80, 0x0a5effac, 0x857b85c2, 0x00009f31, 0xac09acd2, 0xa11df9f9, 0x85658530, 0x00005484, 0xafdfafcd, 0x40067c01, 0x09520995, 0x00007b21,
+        0x2d312dcf, 0x43a64ae6, 0x247e241b, 0x0000677f, 0x0fe30f60, 0xcc7aefef, 0xbd6ebd73, 0x00001aca, 0x732473cf, 0xdb54a9c7, 0x556d55ff, 0x00002e45,
+        0x1cc81ce2, 0xdd0cc23b, 0x890c89b9, 0x0000d477, 0x2ba62b1a, 0x115cb6e9, 0x37fa3745, 0x0000c4b3, 0xa80ca829, 0x33209c61, 0x1e341e21, 0x0000d62d,
+        0xd315d39f, 0x138cafcd, 0x56ee56c0, 0x0000c113, 0xfb96fbb3, 0x754c75ef, 0x0c400ce8, 0x00002ef9, 0x2af02acc, 0xb8348b53, 0x020f02c4, 0x00007f07,
+        0x7ab67a79, 0xfb03dceb, 0xc9e3c97c, 0x000014f7, 0xb1beb189, 0x7f3e2b3b, 0x5ddb5da2, 0x0000f873, 0xb31fb351, 0xac5b4f2b, 0xa7bba761, 0x000090f5,
+        0xe69ee6d8, 0xe5676285, 0x7b0a7b5c, 0x000071ee, 0x4d244dba, 0x8b477764, 0x133d13b3, 0x000039ed, 0x927092f0, 0xbdbe74ef, 0x7dd07dc6, 0x000041b0,
+        0x5f815f0f, 0xee02a19f, 0xc5aac5a2, 0x00002ed6, 0xaf59afb5, 0x6f800f01, 0x3a863abf, 0x000001a0, 0xcb46cb42, 0xfdb3ef69, 0xc3bcc388, 0x000042ad,
+        0xa010a078, 0x2ea391cf, 0x219721d8, 0x000053a6, 0x9fbe9f35, 0x5b903ecd, 0x0165013f, 0x00008318, 0xca2cca0e, 0x9fe5a31a, 0xc7bcc765, 0x00005df6,
+        0x55cd55f4, 0xf96fc185, 0x0a050a2b, 0x00002bea, 0x7505757e, 0xa261d8d9, 0x41764199, 0x000058bb, 0x25dc251b, 0x03644e2a, 0xbf82bf12, 0x0000d91e,
+        0xbd3fbdb7, 0x6fa0ce6e, 0xa7faa759, 0x00003e8c, 0x9ca79c4f, 0x04e420ee, 0xd4b2d4ac, 0x00007568, 0xf346f370, 0x080a8a0f, 0xc9d8c914, 0x000094a7,
+        0x50765008, 0x14af3410, 0xd1bad1e8, 0x00006aca, 0xb12eb191, 0xb61bc185, 0x7e3c7ec4, 0x0000c9ca, 0x5b5b5bdc, 0x3ce70bd7, 0x615761a9, 0x00001aad,
+        0xfcf1fc67, 0x090970d2, 0x17321771, 0x00005c74, 0x24042404, 0x9688e17d, 0x1ee41ee3, 0x00003135, 0x27ab2729, 0x1d2574e0, 0xf76af760, 0x0000fbfc,
+        0x17231707, 0xc9d57250, 0xb52bb5da, 0x000063f4, 0x01020153, 0x57ff28fb, 0xf390f370, 0x00006c14, 0xf2b6f20c, 0x2ef33763, 0x9e0e9e9b, 0x0000ae85,
+        0xfae9faa7, 0x080a2e39, 0x3e093e22, 0x0000b9e4, 0xa813a841, 0xea2005ca, 0x606f601a, 0x000065c0, 0x44f24487, 0xb708d3eb, 0x6742674f, 0x0000c840,
+        0xc92ac91d, 0xab7e74a9, 0x39573996, 0x00005f1a, 0x25d125e3, 0x8f66a0cc, 0xbda6bdb5, 0x000074f0, 0xe63fe6a1, 0xc79d5ebc, 0x5685562e, 0x0000b33e,
+        0x617061b0, 0x6e5e73d3, 0xa4c8a47c, 0x0000cbaa, 0xbfc4bfe3, 0xa59e152c, 0xb42ab42b, 0x0000e716, 0xa427a4be, 0xc4358170, 0x11f21194, 0x0000540e,
+        0x29c22925, 0xff2e938c, 0x513e5105, 0x000099e0, 0x27782799, 0xd1fb89d7, 0x75077573, 0x000046bb, 0x5d265d67, 0x60337663, 0xeb30eb4d, 0x00003a2d,
+        0x977997e3, 0x9bb2d813, 0xd707d713, 0x0000eb17, 0xebafebb1, 0xef3189e0, 0xf9b8f953, 0x00003e27, 0x4f1f4f61, 0x0d8219aa, 0x6e156e2e, 0x0000d7bb,
+        0xc028c0a8, 0x3fa27cc4, 0x7c297c3f, 0x0000ade9, 0xd699d6ba, 0x513a3edf, 0x2bbf2b77, 0x000013a0, 0xf3c9f35c, 0xe5a20186, 0xec16ecc9, 0x00003735,
+        0x90d49057, 0xe0027a43, 0x7b8e7b37, 0x000005fc, 0x3aaa3a91, 0xdbab453a, 0xf79cf7c2, 0x000013cb, 0x5033504a, 0x3cf64a4f, 0x6c696c9a, 0x0000785e,
+        0x1ebb1ec2, 0xe0810ee7, 0x1e701e78, 0x00009af5, 0xc362c321, 0xa911639c, 0xff5fffbd, 0x0000e20d, 0x763776a4, 0x4f297bbb, 0x98169823, 0x00000039,
+        0xc58ac555, 0x483981cc, 0xfe51fe3a, 0x00005fe8, 0x23f12329, 0x9a9365db, 0xe1afe16f, 0x0000bd9c, 0x5125512a, 0x67acceed, 0x5f6f5fb6, 0x0000cedc,
+        0x89098960, 0x44474c7d, 0xca3ccab2, 0x0000ee17, 0x4cf74c49, 0x6cea34ed, 0x50dd5086, 0x00001fac, 0xb9f5b951, 0xd22b23dc, 0xda13da37, 0x00009434,
+        0xb4e7b43e, 0x2e5e8517, 0x03250353, 0x00008c50, 0xc2eac254, 0xc5ebd5b7, 0xaf30af62, 0x0000d786, 0x9bd69b52, 0x02241bd0, 0xc46bc4a3, 0x00006000,
+        0xa136a12f, 0xe32cafb4, 0xaeccae60, 0x000013ba, 0x181f18c0, 0x5c6f5067, 0x1b4b1b59, 0x0000c7fb, 0xee12eec6, 0x8326ffc7, 0xe79ae785, 0x0000c18d,
+        0x598f5994, 0x5f4eedfd, 0x519e51a0, 0x000022f4, 0x68cb68ab, 0xe4a3db24, 0x017e019a, 0x0000af66, 0x49d94910, 0x072467a3, 0x3eb93ee5, 0x0000c8b2,
+        0x9da69dce, 0xa6cc6c03, 0x01a70119, 0x0000f993, 0x4f984f3e, 0x2c29e55d, 0x034603d9, 0x0000a51e, 0xc1d2c100, 0x4ef6a879, 0xd96bd97c, 0x00007ec6,
+        0xb516b58d, 0x05fbced7, 0x8aca8a4b, 0x00006e99, 0xe212e221, 0x84d66659, 0x7f917f02, 0x00005a42, 0x2fd62f7f, 0xed13632d, 0x9acb9a65, 0x00000640,
+        0x83b483b3, 0x30c37e01, 0x6fc26fb6, 0x0000432f, 0xd3cdd37c, 0x46e6d8d8, 0x646e6435, 0x0000a11e, 0xd33cd3fc, 0xf2b720e1, 0xcab8ca7a, 0x00004fcc,
+        0xd196d187, 0x92c91b2c, 0x2b4c2be3, 0x0000ad4a, 0x01e20103, 0x9867f768, 0xaadfaa03, 0x00003081, 0x701770fe, 0x78d844c4, 0x636b6334, 0x00009dae,
+        0xd12dd1c9, 0x61d00d59, 0x0eef0e4a, 0x000094e0, 0x45544564, 0x8b2789e6, 0x0c550c0d, 0x00001ff4, 0x777877af, 0xffcfac37, 0x76e77635, 0x00008ab1,
+        0xb72eb73d, 0x927667da, 0x1a591add, 0x00005898, 0x63d263c4, 0xfb9bc6b8, 0x3be83b83, 0x00001729, 0xb66eb609, 0x9489fc46, 0xa213a246, 0x000015b6,
+        0x763e76d4, 0xa3bfa803, 0xbfd7bf4a, 0x0000a12e, 0x65e1654c, 0x46a6c7b6, 0xa450a4f8, 0x0000688b, 0x5668563a, 0xf2cff832, 0x43a2435a, 0x00000383,
+        0xc9cac934, 0xb0c9d038, 0xb782b72b, 0x00000c53, 0x54cf5443, 0xcf25a3e0, 0x78cd7886, 0x00002488, 0xa1b7a176, 0x69f02102, 0x3cfa3c4d, 0x0000f482,
+        0xd3abd376, 0x50e469c9, 0x97a19786, 0x00009a00, 0x4699462b, 0x0c5af9de, 0xdcefdcf1, 0x0000b06e, 0xa6c6a6ad, 0x88c9a4b8, 0xcd8acd1d, 0x000084e6,
+        0xdd2dddc4, 0xd7690b61, 0x1e211e39, 0x0000eebb, 0xddc5dd43, 0x74ad78cc, 0x5fe25f3d, 0x00006731, 0xf31ff393, 0x0a9b2980, 0xac09ac90, 0x000021d5,
+        0xfb17fb53, 0x88aa7650, 0x545554ba, 0x0000f078, 0x5c055ca5, 0x36482337, 0xd760d700, 0x0000f963, 0xcc0fcc96, 0x8ee8bf75, 0xf060f0bf, 0x00003a60,
+        0x2d362dcc, 0x312e6b48, 0xffa9ff50, 0x0000261f, 0x06cd06c6, 0x2f16442b, 0x9efa9e1a, 0x00008bbe, 0x095d09d5, 0x15e77bef, 0xc87bc844, 0x0000ed03,
+        0xd1f0d16b, 0x692b9361, 0x8f598f0d, 0x0000f0aa, 0xa607a689, 0x540765c5, 0x82f682f3, 0x00001549, 0x7a117a38, 0xdcf3467d, 0x83ef83ec, 0x00007fb0,
+        0xb635b6fc, 0x0a2b8afe, 0xbb80bb5c, 0x000017ba, 0x3f303f83, 0x10ee24e9, 0xb0c6b039, 0x000032ce, 0x1d841ddc, 0x3f0aefed, 0x778777a5, 0x0000b145,
+        0x5d235d34, 0xa4a20107, 0x08a908ee, 0x000023ea, 0x1f591f0c, 0xeb310f00, 0x386d38d8, 0x0000d4f8, 0xbb04bb4d, 0x32028b53, 0xadbdaddf, 0x00007d4d,
+        0xae93ae23, 0x7a00e973, 0x65916532, 0x000012d6, 0x3ad63ac5, 0xb880789f, 0xa15ca1d5, 0x00005e6e, 0xa943a9c0, 0x79ff6fca, 0x320932d9, 0x0000a2de,
+        0xf677f685, 0xee539238, 0x435243e0, 0x000085ef, 0x583b581b, 0x3c183f71, 0xde4bdedd, 0x00001945, 0xf7e8f7fe, 0x95affa63, 0x7bca7b85, 0x0000ff9e,
+        0x9e469eb1, 0x41998865, 0x704b7064, 0x0000eb15, 0xc7f6c74d, 0x73741ce1, 0x93fa93e1, 0x00006de5, 0x2d622d9d, 0xe5f2da47, 0x30be3014, 0x00008818,
+        0x4e9e4e8e, 0x7a8b732f, 0x2a9c2a40, 0x0000f3f0, 0xcb20cb6c, 0x9d3b672d, 0xf713f7e6, 0x000053fb, 0x40934050, 0x7ce327c9, 0xf169f165, 0x0000849c,
+        0xa219a2f0, 0x3f60c902, 0x75157581, 0x0000f171, 0xec75ec3f, 0x4db70927, 0x4ffd4fb9, 0x00002dba, 0x23e12345, 0xf2a1e1ec, 0x88dc88c4, 0x00001c92,
+        0x462446a4, 0xc2f523b1, 0xc453c4c3, 0x0000b7a2, 0x757475fb, 0x20537566, 0xc243c23c, 0x0000be6f, 0xbe56be3f, 0x6b20fdc2, 0xa9c3a928, 0x0000b9b1,
+        0x439943fc, 0xf9b746cf, 0x714271fa, 0x00009b6a, 0x82fe8204, 0xd48edeba, 0xc664c695, 0x0000e5d2, 0xc238c285, 0x3a508071, 0x143f1411, 0x0000fd62,
+        0x9ccb9c6a, 0xd114b2e7, 0xcb66cb7a, 0x00002b76, 0xb97eb9ca, 0x5592675a, 0x866086df, 0x00002c2d, 0xbf9abfc6, 0x4cc9164b, 0xe531e5c2, 0x00002e9b,
+        0xfdfafd04, 0x6c90e393, 0x56ee5618, 0x0000c3f2, 0xd001d0f4, 0xae94b6af, 0xca38ca17, 0x0000dbea, 0xb000b08b, 0xb5a3eacf, 0x523852c8, 0x0000cc40,
+        0xd8b6d8e1, 0xd76b3e33, 0x044b04ee, 0x000044ef, 0xcd6dcd87, 0x7e221b4a, 0x79747922, 0x000093d5, 0x048d0461, 0x33cf1ed8, 0x9c899ceb, 0x00007513,
+        0xd28ed2bc, 0x5fb28440, 0x908e90a5, 0x00008ab1, 0x9b399bd0, 0x1e150619, 0x621e62b6, 0x0000ba13, 0xe89ee8c9, 0xb38f34df, 0x5d5a5db3, 0x0000ab2d,
+        0x722d724c, 0xf9cff7aa, 0xd42bd412, 0x00005f65, 0xab04ab36, 0x191f2b09, 0x9644963f, 0x0000b924, 0x4d124dc2, 0x522f9479, 0xa8b4a809, 0x0000f833,
+        0xa3b9a353, 0xa98129f6, 0x5a905ae4, 0x0000ca7e, 0x58e65864, 0xacde081e, 0xb151b162, 0x00003a13, 0x28e228e2, 0xd8387bb9, 0x240d241a, 0x00008d3a,
+        0xf557f523, 0x8f98f83b, 0xd049d01c, 0x00007f6c, 0x9e179e1a, 0x3ac3d116, 0x82a882bb, 0x0000ddce, 0x5d345d1c, 0x3dced018, 0x867186dd, 0x0000c5b1,
+        0xa4e2a43b, 0x50529c9c, 0x24112466, 0x00008c22, 0x8be98b81, 0xa06186f1, 0xfac4fa9b, 0x00007ca3, 0x7b377b66, 0xc6b50035, 0x947d94c6, 0x0000378c,
+        0x9a8a9a6d, 0x559f94be, 0x04e4041c, 0x00000be0, 0xa2bca221, 0x27b1908e, 0x26902653, 0x00008511, 0x102c100f, 0xf1f7a579, 0x4d224dff, 0x00003cf1,
+        0x4ebe4e6a, 0xc8279507, 0xd400d4f9, 0x000074d0, 0xf267f2fa, 0x1c5e49a5, 0x9d3c9d7b, 0x0000dfb3, 0xd118d109, 0xdd547550, 0x2b452be1, 0x00009ac1,
+        0x41c4417f, 0xa64da7aa, 0x3c0c3c89, 0x00008261, 0x6b656bb1, 0x68414324, 0xeaccea18, 0x000064c9, 0x5517559e, 0x611a45c5, 0xce50ce4a, 0x0000a28b,
+        0xea4feaf2, 0x9cc9e35d, 0x719e716b, 0x0000f262, 0x57c25741, 0x75b2d34a, 0x475647a3, 0x000050d8, 0x89d489c5, 0xe9dd28fb, 0x641064af, 0x0000213b,
+        0xcedace8e, 0xbccd8730, 0xda3ada92, 0x0000eeb4, 0x116a1148, 0xa64d3c9b, 0x35f935e3, 0x00007a73, 0x6cb36c0f, 0xce355734, 0xfa72fab2, 0x00006fe8,
+        0x6e276e2e, 0x67d2d409, 0xe07be0ec, 0x00009c04, 0xa2e5a2d5, 0xa2618d9c, 0xa9a7a9d1, 0x0000ba13, 0xe4e7e43c, 0xe89d0edb, 0x8d598d84, 0x00005246,
+        0xf313f363, 0x0b27d649, 0x1b9c1b6c, 0x0000864f, 0x107b105f, 0x049b30a1, 0x0e210ee4, 0x00006914, 0x8d248d3c, 0xe24304e6, 0xf2baf29f, 0x0000c38d,
+        0xfc39fc72, 0x486acc8f, 0xd93ed9ed, 0x000056ab, 0x8e628e40, 0xe413f128, 0x32f9320f, 0x000034ab, 0x4d9d4d32, 0x5c4db826, 0xd920d925, 0x00006230,
+        0xc946c9bb, 0x6aa11c32, 0x85d8858b, 0x00006bc9, 0x0fac0f85, 0x83b61d52, 0xd0b8d06f, 0x000039ed, 0xa4a9a41b, 0xd0ebd902, 0xe136e159, 0x00007931,
+        0x7a847a6f, 0x3635c13c, 0x620862df, 0x00006fa7, 0x4311437e, 0x39e161a2, 0x6b936b72, 0x0000137d, 0x892489b0, 0xd2412c5a, 0x859e8534, 0x00006ebc,
+        0xb538b5d3, 0x918e3d82, 0x01e20184, 0x0000e20c, 0x3ad43a46, 0x0bb7f26e, 0xf9b3f912, 0x0000721f, 0xf760f739, 0x0664b4d6, 0x63a96352, 0x0000d8f0,
+        0xa35da380, 0x93744dca, 0x73fe731c, 0x0000f1d8, 0xd13ed1db, 0x8507a12d, 0xab93ab3c, 0x00000c63, 0x64726490, 0x027b9ce3, 0xbb8fbbf2, 0x0000baac,
+        0x137e13a0, 0xff46e575, 0xab67abd5, 0x00005f2b, 0x993199b5, 0x2b53523e, 0xdf14dfe5, 0x00006646, 0xbe23be5c, 0x791ba840, 0x12c912ca, 0x000064af,
+        0x2d8d2da2, 0x3f72a70c, 0x465146b6, 0x0000d0da, 0xad94adff, 0x84094daf, 0xbfaebf39, 0x0000790e, 0x421242cf, 0x36cee8b0, 0xa54ea5b8, 0x00007380,
+        0xb4d4b44a, 0x3b564cf5, 0x1f0e1f3e, 0x000082ff, 0xd6acd6be, 0x444702ca, 0xf2e8f2ce, 0x00005994, 0x95d89560, 0xa123c96e, 0xe899e8e8, 0x00005306,
+        0x8b178be5, 0x785828e7, 0x629d62c8, 0x0000a9fb, 0xd505d59b, 0x98f6eeb2, 0x2b202b63, 0x0000b19a, 0xab71ab48, 0x27b0f559, 0xba25baa5, 0x000070fc,
+        0x304f304c, 0x3bc39227, 0x68356810, 0x00008c61, 0x7dbf7d75, 0xc52b8bd3, 0x610661d1, 0x0000f4b3, 0x8249827e, 0xedd1da0a, 0x92199229, 0x0000dd28,
+        0xe764e765, 0xeacd443a, 0x352335cd, 0x0000f02e, 0x4075400f, 0x289dabab, 0xc4e0c430, 0x000078fe, 0x2dba2d4c, 0xfeeea83f, 0x60666084, 0x00000eb1,
+        0x378937ba, 0x60a10206, 0x67c267c1, 0x000087a3, 0xf7b6f770, 0xf273e607, 0xcd1ccdd6, 0x00001788, 0x8d4b8da4, 0x9c2cedd3, 0xc059c02d, 0x00008460,
+        0x6b366b17, 0x545d5d92, 0x0f200fe7, 0x0000afd9, 0x850b8598, 0xf540c2ea, 0xff5ffff6, 0x00007a70, 0x9f3e9fc3, 0xa67b27d7, 0xf362f30e, 0x00006b7b,
+        0x6fd06f52, 0x74aff84d, 0x24bb2485, 0x0000bd10, 0xb905b982, 0x44a6a7ab, 0xac0cac56, 0x0000590d, 0x113c117b, 0x4af65dde, 0x634a634d, 0x000043f0,
+        0xf9c4f9c6, 0x4378eacc, 0x2e3a2e85, 0x00001a6c, 0x5cb75c18, 0xbdeb0bd7, 0x152f15ea, 0x0000b142, 0xd380d33a, 0x2253c4a9, 0xdc34dc91, 0x0000031b,
+        0xaf28afcd, 0xe9200dda, 0x788078de, 0x00007340, 0x9df49dac, 0xdc8fb837, 0x41e04177, 0x00000fe6, 0x0b1c0bd3, 0x98db456f, 0x652865ef, 0x0000c710,
+        0xc292c234, 0xa85b521c, 0x71477155, 0x0000d49a, 0x943f94c9, 0xad4ff8f9, 0xd559d5fc, 0x00001012, 0xdf4cdf86, 0xd7eb408e, 0x7ea97e8d, 0x00005176,
+        0x68c668b6, 0xb671372f, 0x286428cb, 0x0000f80c, 0x76e2766f, 0x05c4bbe9, 0xb634b6e7, 0x0000a7f1, 0xe117e120, 0x04ea02f6, 0x42c642b6, 0x0000db29,
+        0x822a827d, 0x744af557, 0x890d893b, 0x0000c793, 0xb24cb2e6, 0x50e6020a, 0x1af41a5f, 0x0000a413, 0xde15de40, 0x8f679f21, 0x2c992c5d, 0x00009dae,
+        0x846884f0, 0xec6c1289, 0xe684e679, 0x0000d377, 0xc2ecc2fd, 0x59c8dde2, 0x6bd56b8f, 0x00002702, 0xb4c2b41c, 0x23d23a31, 0x342334d2, 0x0000ded5,
+        0x722d7263, 0xab01e9c3, 0x2ff42fa7, 0x0000b78e, 0xa381a3c0, 0xb4082cc6, 0x061e06c3, 0x0000bc10, 0x5f595f26, 0x7fbca733, 0x3bf23bb8, 0x00000c63,
+        0x047804cc, 0x138e3e4c, 0x351c3537, 0x00008ae4, 0x726b72d0, 0x6a9f44ad, 0xb631b643, 0x0000bc7a, 0x43b243ba, 0x5056f6ab, 0x59d15961, 0x0000ae02,
+        0xea0cead9, 0x233e1f9c, 0xaf6dafda, 0x0000d953, 0x93fe938b, 0xd74db57b, 0xd08bd064, 0x00000e5e, 0xc791c73b, 0xae14a397, 0x664966fb, 0x00002fdb,
+        0x5c8e5c5f, 0xaad3ca18, 0xc2dcc221, 0x0000236c, 0xac89ac07, 0xf2b020eb, 0xcc11cc9a, 0x00009127, 0x41ac41b3, 0x06254419, 0xb839b849, 0x00003135,
+        0xfc33fc2e, 0x7b1e79f9, 0x94209437, 0x0000b06c, 0xddedddd0, 0x67bb9c9a, 0x457e453a, 0x000021ac, 0x65206521, 0x19714bad, 0x6c726cfb, 0x0000c6d3,
+        0x16ca16b9, 0x5b6959dd, 0xaf6faf96, 0x000008ed, 0x5cd25c96, 0xbd6874d9, 0xc268c2e5, 0x00005f74, 0xe177e17b, 0xe2d71cd0, 0x880f889e, 0x0000b6ec,
+        0x39273982, 0x0d7bb8b7, 0x040404d2, 0x0000d84b, 0x47944753, 0x14c7aace, 0x53305393, 0x00004ca9, 0x941b9406, 0x4b7f5fed, 0xba21bac6, 0x0000a1b4,
+        0x17f61712, 0x040984fe, 0x8ef08e16, 0x00006f6c, 0xfa0efa47, 0x42d64762, 0x902190ea, 0x000049a8, 0x6323633e, 0x1c21cd17, 0xb2c9b265, 0x0000eba4,
+        0x49954914, 0x8dc79338, 0x2c3d2c58, 0x0000eebe, 0x4dd24dbb, 0x90f3ac20, 0x906290bc, 0x0000acc1, 0x76b17673, 0x3031cfaa, 0xb51bb552, 0x00007e02,
+        0x5b215b9a, 0x17dad5fb, 0x7899784d, 0x0000014c, 0x37d837d2, 0x911caf7a, 0x60a8607c, 0x00001902, 0xcddecd6f, 0xa17ea4cc, 0xe312e385, 0x000016e9,
+        0x2f2e2f63, 0xe6c1d475, 0x612561f7, 0x00001c7c, 0x2cf22cd9, 0xc55ecd2d, 0x30aa30ae, 0x0000f45c, 0x331f3364, 0x490914c7, 0xdc47dc9c, 0x0000535b,
+        0xee2aee3c, 0x491fdcf8, 0xe24ae20d, 0x00005208, 0xdaefda61, 0x346f4860, 0x671467c5, 0x000079ce, 0x563856d4, 0xcc094d29, 0xd666d6d0, 0x00000e3e,
+        0x61c96146, 0xaca0b6d6, 0x6b796bd2, 0x0000dfb3, 0x617c61d3, 0xf373d735, 0x177317cb, 0x00000eca, 0x12d11286, 0xcefa8c5c, 0xd499d4b6, 0x000068b4,
+        0xd118d175, 0x4d9e7bae, 0xe116e1c8, 0x00002fa5, 0x95be952b, 0x7e5597c7, 0xc7dec7c2, 0x0000dc1f, 0xd1f1d14e, 0x86d53075, 0x96e396c4, 0x00004090,
+        0x42f04202, 0x8bb9fd8c, 0x674a67dd, 0x00002433, 0x45b34523, 0x9b5c08a6, 0x6446646a, 0x0000da03, 0x5fde5fd6, 0xcb65ec4c, 0xf1f5f151, 0x0000f2f9,
+        0x163a16d8, 0x4179574e, 0xb424b42a, 0x00008431, 0xed30edab, 0x97d4834b, 0xaa1daae7, 0x0000bacc, 0xb13db1bd, 0x9eec6e7a, 0x37243700, 0x00000d53,
+        0x204120b1, 0xe8eca62d, 0x777e77cd, 0x0000b409, 0x19e61956, 0xa211f7e3, 0x9dd99d60, 0x0000ceaa, 0x482b484c, 0x1ddadd92, 0x9f1e9f5b, 0x000034ce,
+        0x8422843a, 0xf7b9dc63, 0x0fc80f2f, 0x0000a8de, 0x8f2f8f95, 0xc0073dff, 0x30203082, 0x00006f15, 0x78e6789f, 0xa301dbfb, 0xe2f2e2ff, 0x000038e6,
+        0x0cfb0ce4, 0x65d3a93f, 0x72897249, 0x00006e00, 0x1ce71ce6, 0x691cfdbc, 0x34a53429, 0x00000b70, 0x50605071, 0x9b570d59, 0xce91ce95, 0x00001f53,
+        0xd7bed70c, 0xd854d225, 0xe6fbe6ba, 0x000012a5, 0x793879d4, 0x2b533c8e, 0xdad2da76, 0x0000cdf0, 0x3e233ecf, 0x54b81e0d, 0x760476dc, 0x00001efc,
+        0x4c2e4c54, 0x265945d5, 0x6508658c, 0x0000bd2e, 0x60226024, 0x652e01c8, 0xa051a07c, 0x00004b8f, 0x7f2f7f65, 0x3da0186b, 0xec87eca8, 0x0000a0b4,
+        0x9df79dbd, 0x58d554f1, 0x603c6018, 0x00002fa9, 0x519351f4, 0xa423a5ce, 0x8112814a, 0x0000ec37, 0x93da9354, 0xbe132a3b, 0xc433c451, 0x0000d966,
+        0xe53be5c5, 0x06cb3a11, 0x3e3e3eb9, 0x00005646, 0x141a14f2, 0xa4b453d1, 0xe940e9fe, 0x00004343, 0x30e73027, 0xaad6e45d, 0x9f939fa0, 0x0000e2a4,
+        0x193e19c0, 0x80bfb666, 0x30fd306f, 0x0000e093, 0x693269eb, 0xf3026ed5, 0xcef0cef2, 0x0000d5d7, 0x7cb67cdd, 0x84f8a2a4, 0x316031eb, 0x0000b5b7,
+        0xa2b8a2ff, 0xf9cfca2d, 0xbd73bd20, 0x00006820, 0x18c31813, 0xff46a530, 0x2b682b5e, 0x00003b6c, 0x962796ec, 0x28c09a55, 0x46a94604, 0x00008818,
+        0x02990209, 0x4f26fa9d, 0x03140362, 0x00007de1, 0xc6c2c6b6, 0xa4a3f17f, 0x09ca09bf, 0x00002867, 0x28d528ae, 0x7d6d9fa3, 0x93109371, 0x000073ec,
+        0x782f782d, 0x6feb4a60, 0xe873e8d2, 0x0000ccaa, 0xef69eff2, 0xa07cf457, 0xe310e3d6, 0x0000c1b8, 0x9bee9b1d, 0x9468efe1, 0xb5dbb57b, 0x0000cd68,
+        0x33bd33ff, 0x65cd2e9f, 0x168b1625, 0x0000e9dd, 0xae7dae83, 0xb9c4a4ab, 0x61e961f7, 0x0000fa32, 0x716271d0, 0x78021c35, 0x9aa59a3d, 0x0000b911,
+        0x23252356, 0x964cf61c, 0xf801f822, 0x00005ab5, 0x38dd38d0, 0x865e7141, 0xc195c133, 0x00002fca, 0x74af743f, 0x958255cf, 0x62fb620b, 0x00008271,
+        0xf149f130, 0xe3ecda3c, 0x2e3e2e75, 0x000013bf, 0xb25db234, 0x63a56bcb, 0xe82ce83e, 0x00007f0f, 0x6705671a, 0xa3de9b4b, 0x222c2284, 0x0000c693,
+        0xa52aa58d, 0x0ef544c4, 0x2dd32d18, 0x00000d62, 0x856c85c0, 0x4ad4b84a, 0xdd70dd56, 0x000014bf, 0x89608913, 0xa4e2baf7, 0x59845919, 0x00009b69,
+        0x8dc48dd6, 0xc4a97156, 0x8acc8a75, 0x0000d50b, 0xf137f159, 0x77855a8e, 0x0acb0a9a, 0x0000ce8d, 0x4b484b27, 0x3a6ff3b1, 0x459e455c, 0x00009ce0,
+        0x74ad7470, 0x3e3c4ee6, 0x9957994e, 0x0000aa5a, 0x119411cc, 0x9a747f42, 0xa8c3a82a, 0x00001b07, 0x1f6f1f4a, 0x45a5fbf9, 0xf4b4f459, 0x0000822b,
+        0xc6fbc620, 0x80f78c23, 0x1e1b1e09, 0x0000b582, 0xdb3ddbda, 0xc5262b45, 0x7551756d, 0x00001833, 0x097b0935, 0x66913411, 0x2c4e2cab, 0x0000c0a4,
+        0xa766a76b, 0xda38b8a4, 0x372f376c, 0x000004bd, 0x29b6294d, 0x93f167c5, 0xce2ece29, 0x00003df1, 0x87258795, 0x46899c62, 0x714b71b2, 0x0000c3b2,
+        0xd0b1d0c0, 0xa29e6a39, 0x33793373, 0x000037ce, 0x5add5a3f, 0x3bd58811, 0x558055ac, 0x00008590, 0xf9c8f9a3, 0x1ee5c51f, 0x99de995e, 0x0000ee37,
+        0xcbf1cbd3, 0xe82242db, 0xf638f647, 0x0000a1d5, 0xe2bae2f9, 0x8cf67a88, 0x257e259c, 0x0000e307, 0x785a78b9, 0x544d16fd, 0xbdcbbd6f, 0x00003033,
+        0x588f5821, 0x4eb43241, 0x2384233a, 0x0000f132, 0x5d535d24, 0x9bb50ee7, 0x66886601, 0x00003b13, 0xd52ed5c7, 0xffceaf0b, 0xa398a3ce, 0x000013ca,
+        0x30c730f7, 0xdbc4a160, 0x24352400, 0x0000d50a, 0x0f370f28, 0x50987250, 0xfe38fe33, 0x00002dd6, 0x32d032aa, 0x25d2ed72, 0x63776376, 0x00003d01,
+        0x6a346a36, 0x5e90c96e, 0x1ea81ea8, 0x00003e41, 0xad74ad1d, 0x86d6fa4e, 0x0369030b, 0x000096cb, 0x49f54986, 0xc8fac9e3, 0x658d657f, 0x00002729,
+        0xd33bd385, 0xc4c73914, 0x675b6709, 0x0000b5d4, 0x9d009d86, 0x0306ae66, 0xb194b19d, 0x00004610, 0xb65db6d6, 0x25a23d70, 0xdb0edb03, 0x0000b25e,
+        0xd727d78a, 0x81b64cad, 0x1a6e1ac4, 0x00009acd, 0x33bf33cc, 0x3edf4aa9, 0xe73fe789, 0x0000a674, 0x84de8437, 0x6ba16ac9, 0x92549287, 0x0000a938,
+        0x2a932a6e, 0x1a311ecc, 0x26cd2633, 0x00006c15, 0x4c6f4ca6, 0x8988d488, 0x64766406, 0x00009ea7, 0x63a563fe, 0xa8ea1479, 0x2f082f8b, 0x0000b7ce,
+        0x8d6d8d49, 0xf2b8aee2, 0x4d174da4, 0x0000c90b, 0xace0ac1e, 0xfd11f525, 0x1ddb1dd4, 0x00004aae, 0x632a637f, 0x8137c3c3, 0x8c9d8c2e, 0x0000efe2,
+        0xaa9baa2e, 0x5678d858, 0x5e6c5e97, 0x00006b96, 0x083e0857, 0x83b6a0e9, 0x933e9386, 0x00001e42, 0x9a5b9ae0, 0xf4ae6a48, 0xd57cd5ff, 0x00004c48,
+        0x58ce5845, 0x8437d7c8, 0x220022cf, 0x0000325f, 0xbf59bf05, 0x964a0bd7, 0xe864e850, 0x0000aaa6, 0xf892f840, 0xadcc524f, 0x1a751a3c, 0x0000c68d,
+        0xb943b91a, 0x48864e16, 0x167016cc, 0x000055df, 0x112911ad, 0x7f5837b2, 0xe190e18c, 0x00003bb8, 0xc19bc14d, 0x46897b2d, 0xcb63cb99, 0x00005a45,
+        0xad47ad45, 0xb5703550, 0x32693299, 0x00003f92, 0x880d88d0, 0x255d1e12, 0x22f422fa, 0x0000c722, 0x22152244, 0x51d58c5d, 0xb4a9b4c5, 0x000046bb,
+        0x015e01eb, 0xb62acd2d, 0x47ff47ec, 0x0000ff4e, 0x412b4100, 0x74cf88ec, 0xb62eb6f0, 0x0000db53, 0xb306b33e, 0xf8aae4a2, 0x562b56eb, 0x000086c1,
+        0xeeebee23, 0x3276560d, 0x318f3128, 0x00009214, 0xeb52eb63, 0x4361ad41, 0xae23aec7, 0x00003e22, 0xa933a940, 0x340c226b, 0x19d71935, 0x00009f8a,
+        0xaa5caa14, 0xb596cad3, 0x77a677da, 0x00000364, 0xb54fb5a2, 0xd8ed76a6, 0x4beb4b24, 0x00002cea, 0x41ad412a, 0x75cc6400, 0xb5b5b5dd, 0x0000bf9c,
+        0xf919f940, 0xdb43b826, 0x3c523c13, 0x00001e5e, 0xfde8fdc7, 0x162f074b, 0x49bd4976, 0x0000f338, 0x07770733, 0x26583a5f, 0xb329b3d7, 0x00002c74,
+        0x271227c5, 0xe2a3c5e0, 0xd326d34e, 0x0000710f, 0x69db69d4, 0xee906d62, 0x12961298, 0x0000c18d, 0x42c042cc, 0x8b284fad, 0x0f3a0f0b, 0x0000dc3f,
+        0xfc3dfc23, 0xcd2768f4, 0x512951e5, 0x0000c1b8, 0x93b3938c, 0x78550fa6, 0x53505317, 0x0000e66d, 0x9967995c, 0xbfe4bebe, 0x763a761b, 0x0000cc38,
+        0xab02ab10, 0x0ef48083, 0x8ef28ea3, 0x0000fbd2, 0xc9e6c9b1, 0x304e03f7, 0x6cdb6c64, 0x0000271f, 0x704b70ae, 0xcc7ab913, 0xdd61dded, 0x0000b73f,
+        0x4ac64abe, 0xb3e219d3, 0xd661d605, 0x0000c941, 0xf958f9b6, 0x2af30494, 0x6ad06a57, 0x0000a077, 0x6cb46c70, 0xc19aa940, 0xfa3efa0e, 0x00008f52,
+        0xecd8ec81, 0x07a82a80, 0x8a458a52, 0x000088ef, 0x13d7130e, 0x4265f2d5, 0xbf9cbf2b, 0x0000edad, 0xb6c5b672, 0xd5df5cae, 0x2c152c36, 0x0000ba71,
+        0x2aa92a2c, 0x25b152ea, 0x77a777ce, 0x000053a6, 0x66a06651, 0xf1f4722c, 0x4ab64a5a, 0x0000ea48, 0x93309388, 0xb155ef94, 0x3158319d, 0x0000918a,
+        0xc161c156, 0x08f42bc1, 0xc302c371, 0x0000b783, 0xe3a8e327, 0xeaa3e639, 0x62f3621a, 0x00004310, 0x3caf3c7f, 0x65cd6403, 0xbd75bdc6, 0x0000ad78,
+        0x6e5f6e95, 0x8cf73dcd, 0xbce0bc17, 0x00002b3e, 0x29c12955, 0x3f88fe3f, 0xcaf1ca69, 0x0000fbb4, 0xd529d57f, 0xc79cf2d5, 0x8c268cc7, 0x0000dc1f,
+        0xc624c65a, 0x5ef13726, 0x876087db, 0x00002acb, 0xc4acc45f, 0x2d483026, 0x88148868, 0x00004711, 0xe0c9e0f3, 0x9c57d54b, 0xfaa3fa51, 0x000023eb,
+        0x18801859, 0x77eac8e3, 0x8be28b3c, 0x0000867c, 0x3d1d3db3, 0xf2b62509, 0x7d437d73, 0x0000886d, 0xdb38dbe8, 0x378cf8c7, 0x671e6712, 0x00003599,
+        0x488448e4, 0x605a540e, 0xcc86ccf3, 0x00007a31, 0x170d179b, 0x7800aa8a, 0x96b0967c, 0x0000017f, 0x7dc37d66, 0x738a6e57, 0x10be10c1, 0x00004d83,
+        0x9b079bc0, 0xd22aa879, 0x3f603fc6, 0x0000055d, 0xdc83dccd, 0x393c29ba, 0xa45fa48d, 0x0000cede, 0xb2eeb2a4, 0xe66ae07d, 0x5b845bd6, 0x000045bf,
+        0x19541953, 0x34ce4714, 0xcf0dcf70, 0x0000e8a4, 0x50445018, 0x48f65fec, 0x6a246a35, 0x0000bcba, 0x296b29dc, 0x73a87da6, 0x1ab81ad4, 0x0000cbe8,
+        0xb7c0b719, 0xe2d3a94b, 0x65766504, 0x0000dafe, 0x53305346, 0xa7fe84ee, 0xc156c1eb, 0x00002f2d, 0x4c2a4c36, 0x7d63b1d9, 0x0efe0e7b, 0x0000d0f8,
+        0xc732c74d, 0xf8ff1e21, 0x1060101e, 0x0000dddf, 0xbc39bc1e, 0x3c72a2e0, 0x844184ab, 0x000043cf, 0x70ea70de, 0xabcca029, 0x9c679cc9, 0x0000829d,
+        0x609260ca, 0x095fee3e, 0x685e687e, 0x000061f7, 0x3b333baf, 0x48be59e3, 0x1fe01fe6, 0x0000e6ca, 0x65e4652b, 0x707577d2, 0x2fad2f72, 0x0000c85a,
+        0x01da0190, 0x4125dd94, 0xe76fe796, 0x0000575b, 0x80ab80d7, 0xdc7b46f8, 0x99529909, 0x00007a22, 0x121912ff, 0x5de736ee, 0x136913bf, 0x0000281c,
+        0x63216330, 0xc25532e1, 0xb62cb60b, 0x0000479d, 0xeb4febf1, 0x059b6252, 0xb566b5ca, 0x00005e18, 0xc1aec140, 0xa433580b, 0xd56ad583, 0x0000daa3,
+        0xa7daa74e, 0x487a280d, 0xd227d27e, 0x00003e8c, 0xc221c2fb, 0x657a8335, 0xa2c1a27d, 0x00006251, 0x5c255c1b, 0x6f60246b, 0xe02be02d, 0x0000ee3c,
+        0x8b8f8ba4, 0x69d8dd33, 0xa818a81f, 0x0000b4b5, 0xbd58bd32, 0xea8d6985, 0xf40bf4d5, 0x00005bb0, 0x8e748e72, 0x902e9338, 0xe571e593, 0x0000c8ce,
+        0x794f796f, 0x9fd943f8, 0x121d123f, 0x000089be, 0x426242ab, 0x02a55a22, 0xc1eec18b, 0x000089c3, 0xb5fcb52b, 0x5e681286, 0xa8c3a868, 0x0000ca7f,
+        0x28c228c8, 0x9bdc0149, 0x896089b6, 0x00004cf3, 0xf564f5ad, 0x76a2e5a2, 0xa02da0e5, 0x000095eb, 0xb388b35c, 0xc5dcd257, 0xaa9aaa7d, 0x0000f1ce,
+        0x7ced7c58, 0x1a93ce68, 0xd164d126, 0x00005b22, 0xb25eb29c, 0xc825875f, 0xfc9afca1, 0x00002d57, 0x443f44c1, 0xd0f048e9, 0xe74ae78b, 0x0000cf6c,
+        0x1516157b, 0xb8b0defb, 0x700e7076, 0x0000041b, 0xa7cfa7cd, 0x322084be, 0x334d33f0, 0x0000f638, 0xb388b350, 0xabae4e8f, 0xd60ad601, 0x0000cfcf,
+        0x290b2964, 0x067bb3db, 0x89ff89c3, 0x0000086b, 0xc51dc5b1, 0x03190416, 0x4d314dac, 0x00006a5c, 0x30c8307c, 0xcefad4f6, 0x7e647ec3, 0x0000a677,
+        0x679667d4, 0x797075a6, 0x890c8938, 0x00006f15, 0xfe04fe49, 0x102aced7, 0x214321e5, 0x0000b013, 0x8100810e, 0x979ee36d, 0x70377001, 0x0000d857,
+        0x324532da, 0xe0625e5c, 0xca3fcafc, 0x00004b37, 0x59055998, 0x53c66420, 0xf471f4f8, 0x00001081, 0xda79dab1, 0xf94956fc, 0xac8cac75, 0x000093b6,
+        0x0692062b, 0xbf99814a, 0x3a243a4c, 0x00004913, 0xb3cfb31d, 0x8515a62f, 0xd951d929, 0x0000d6da, 0xbbaebbe5, 0x8f1aeccc, 0xcc7ccce9, 0x00006de0,
+        0x735e7345, 0x6250496f, 0x12811202, 0x0000cab2, 0x35343520, 0x7ddee152, 0x650b6562, 0x000030ce, 0x3c213c9d, 0xaf20aaf8, 0x48e748e9, 0x0000bd9e,
+        0x7a407a0d, 0xdd1e1bec, 0xd299d299, 0x0000ab77, 0xda62dae1, 0x42e95448, 0x20ba2084, 0x000051c9, 0xb78ab7f6, 0xddf3d4f5, 0x559b5525, 0x00009a31,
+        0xee33eeea, 0xc70b4533, 0x9b509b75, 0x0000ee37, 0x1e6c1eba, 0xb7c430a0, 0x4dd14d80, 0x0000e272, 0x8bb38b18, 0xa261772c, 0x9cff9c1a, 0x00007757,
+        0x122c1286, 0x8d792cbf, 0xfbe0fbf1, 0x000046ef, 0x80bd8050, 0x21c6b8a4, 0x293e29d1, 0x0000f362, 0xaddbad67, 0x376b0c5e, 0x0b050bcf, 0x0000d60b,
+        0x52ae52d8, 0xc75772db, 0xeeccee1a, 0x0000e344, 0xf0b2f07a, 0x6ed08498, 0x543e54b6, 0x0000b86f, 0x853e856e, 0xd9c7bab9, 0xebd8eb6f, 0x00005a44,
+        0x3a0f3a38, 0xf5b9f0a9, 0xa2f5a2f5, 0x0000c3a1, 0x079407c2, 0xb2ebd085, 0x1b671bf6, 0x00003f33, 0xe62fe684, 0x7c6db274, 0x963b9670, 0x0000590e,
+        0x4828484c, 0xbbd253b1, 0xe445e41e, 0x0000988a, 0x38f538dd, 0x48efe4dd, 0x2acb2a7a, 0x0000ff5c, 0xc2e0c25a, 0x99061672, 0xeaaeea60, 0x000098d8,
+        0xb046b011, 0x73cdb4f8, 0x935f93b9, 0x0000e4ab, 0x6b346be8, 0x1c37e605, 0xc424c484, 0x00000f5d, 0x158f157a, 0xfdcdca67, 0x04780463, 0x000003ef,
+        0x8ecd8e71, 0x4e356703, 0xf3cbf3db, 0x00008e72, 0x87d48739, 0x5db9ff43, 0x9c109cb6, 0x0000902a, 0xdaa1dada, 0x7c3d665b, 0x30933083, 0x0000fd93,
+        0xa694a6d5, 0x1b8e0beb, 0xb84bb8fe, 0x000097f5, 0x8d958dba, 0xfed10ed9, 0x857b8593, 0x0000310a, 0xbaf2ba6e, 0x05e69894, 0x617f61b4, 0x0000ddd5,
+        0xdc5edc98, 0x0f1c2e4d, 0x0a0b0a97, 0x0000789d, 0x0f6d0f97, 0x4447ef1f, 0x8d1f8d8f, 0x000050d8, 0xfa42fa43, 0x9a1e6565, 0x975c9779, 0x000079a3,
+        0xdc5edc0d, 0x91dc9d62, 0x1891188f, 0x0000c7c4, 0xaf48af67, 0x9977be20, 0x086e08f2, 0x0000bb7a, 0x15ed15c4, 0x6b4e6b37, 0xa4e7a439, 0x00000b63,
+        0xeab8ea97, 0x1bda2594, 0x127512b1, 0x00005406, 0xd90ad92d, 0xc635d484, 0x7ee47e44, 0x0000a6d6, 0xa3aea377, 0xa90db8cc, 0x324232f0, 0x00006c18,
+        0x4c804c1d, 0xaf54e202, 0xeecaeecc, 0x00007557, 0x00f10051, 0x3f885fae, 0xad99ad32, 0x0000dd20, 0xfde0fd40, 0x240e7c01, 0x83c883b7, 0x00005ae9,
+        0xee96ee9c, 0x47b97da9, 0x7283726d, 0x0000344a, 0x351f351b, 0x5bed1c21, 0xc589c561, 0x0000ed12, 0x6b896b97, 0x5f9092d9, 0x09110940, 0x00003869,
+        0x2fde2f52, 0x9ba682ce, 0xf1f7f1ab, 0x000070e5, 0x625f6294, 0x6532de62, 0x525a52a3, 0x00006841, 0x146d1449, 0x5fad56b1, 0x3be83b57, 0x0000f552,
+        0x8e888e60, 0x0c3b69c9, 0xe7bce756, 0x00005df7, 0xb285b2d1, 0x0fa57091, 0xce03ced3, 0x00001688, 0xff75ffad, 0x8ec4b160, 0x61b761fa, 0x0000e9a2,
+        0xfbf1fbeb, 0x46992df6, 0x83b283d0, 0x00007519, 0x249d24c3, 0xa5106e34, 0x964f968c, 0x00002025, 0x7e507e0f, 0xe4022a39, 0xb2ecb2be, 0x0000c6e7,
+        0x15b21525, 0x990cfe47, 0xe74ce708, 0x0000a945, 0x3cf23c35, 0xea308f21, 0x94619414, 0x00002d57, 0x4b164b8b, 0x3c9a5cdc, 0xdae7da02, 0x00000722,
+        0x4bfe4b0b, 0x95d92630, 0x6df26de9, 0x0000c0a6, 0xe2d1e247, 0xed797bbb, 0x5c7f5c1a, 0x0000af0e, 0x49064921, 0x28c0cb23, 0x361936c7, 0x00004b46,
+        0x93e4930c, 0x10eaa733, 0xb3bdb3f1, 0x00009f15, 0x5beb5b34, 0x1fc566da, 0xa872a8f2, 0x00006949, 0x4cb34c53, 0x262095fe, 0xa6a5a6ad, 0x0000338c,
+        0x0732073a, 0xa7802606, 0xd409d4f2, 0x00006146, 0xf07ff08a, 0x99765a5f, 0xe6a6e600, 0x0000fd23, 0xee26ee6e, 0x3fe82162, 0x915c9141, 0x00006d6d,
+        0x12eb1201, 0xf9d95ed3, 0x1df91d06, 0x0000b546, 0x63ff6316, 0xbb6ccf31, 0xf08af0e9, 0x0000908a, 0xf12cf14c, 0x6021616b, 0x493b49bd, 0x000043cf,
+        0x98f898c7, 0x84082fba, 0xf118f159, 0x00009783, 0x28f3286a, 0xe0201585, 0x0b170bea, 0x00002c86, 0x8d0c8d01, 0x809bd104, 0x3d663def, 0x0000159e,
+        0xac4aac12, 0x6d1c7466, 0xf346f347, 0x00004cf0, 0xf903f965, 0x127b1cda, 0x94869454, 0x0000f405, 0x57df5742, 0xa36152b1, 0x559c55ab, 0x0000b68e,
+        0x2aa02a18, 0xb2962d71, 0x9daf9dad, 0x000041d1, 0x93b69349, 0xc48a90ba, 0xdae1daf4, 0x0000e58a, 0xea21ea22, 0xe0f2b5af, 0xd3acd35b, 0x0000b697,
+        0x5dbe5d45, 0x2f7e81d0, 0x33ae33a4, 0x0000c412, 0xb23cb22e, 0x9f975303, 0x8c788c8b, 0x0000c8cf, 0xf68ff60c, 0xfcc2b026, 0x8faf8f92, 0x00000b92,
+        0x8d2f8dac, 0xb344086c, 0x42fd42d0, 0x00005885, 0xbe0dbef6, 0xdae64faf, 0xbd71bdc2, 0x0000c312, 0xdccddc76, 0x1cb1a8c0, 0x57c357ec, 0x0000f120,
+        0x2de42d15, 0x8437834f, 0x814f8122, 0x000074d0, 0x52a0525a, 0xd2047109, 0x165216b7, 0x000097f5, 0xe2f2e230, 0xcf3516bc, 0xbc83bcdf, 0x0000cacf,
+        0xad7cadd1, 0x41247749, 0xe642e602, 0x0000e186, 0x354f3530, 0x41ee92c7, 0xf76df7d3, 0x0000b9b1, 0x6c586c23, 0xd76b0ca7, 0x0bab0b8e, 0x00008b61,
+        0xbb0fbb87, 0xfa11fd7d, 0x18fc1800, 0x00002066, 0xe028e0fb, 0x0cab892e, 0x275227f3, 0x00008b3e, 0xe59ce552, 0x0224f7e1, 0x542a5481, 0x0000a8d9,
+        0x21a121fc, 0xe2380647, 0xfdbafdd8, 0x000037f1, 0x5c8e5c98, 0x845e5d3d, 0x491b49c6, 0x00006a15, 0xc219c22a, 0xf4aec92e, 0x394c3948, 0x000065f0,
+        0xc252c2f0, 0x1560a119, 0x87af872c, 0x00009d91, 0x2f392f95, 0x014a5ae0, 0xfc86fc83, 0x00005985, 0x675267ed, 0x06d4d825, 0x78f6788c, 0x00002aea,
+        0xd41dd4cd, 0x60df5473, 0xbb41bb15, 0x00009dae, 0xddfedd40, 0x7c26bb17, 0xc9f9c942, 0x00008418, 0x4ebb4e2b, 0xbbacfe06, 0xc29dc232, 0x00002f5a,
+        0x3922392b, 0x0684c9ae, 0x2200222a, 0x0000e672, 0xe49fe44d, 0x39e21d21, 0xf2b2f296, 0x000034ab, 0xfa40fa15, 0x19b3a846, 0x1e6a1e7d, 0x0000e425,
+        0xfae4fae4, 0x3f06c757, 0x72c572d6, 0x00007770, 0xa266a26f, 0x9673d1b7, 0x267c2695, 0x0000ab09, 0x143d14cb, 0xa501900f, 0xebdcebc0, 0x0000b136,
+        0x6e5d6e40, 0xfb6e0c46, 0xd817d8f0, 0x0000670f, 0x803e8050, 0x82e9ce2c, 0x90b0907c, 0x0000ce83, 0x194319b9, 0xff4ec489, 0x07e50786, 0x00004c37,
+        0xa26aa2fa, 0x2a8305ca, 0x143814b2, 0x0000352f, 0x35a335a6, 0x9f962904, 0x2d292d58, 0x00003b4c, 0xe83ee86a, 0x53561851, 0xcb56cb4a, 0x00001617,
+        0x577657d6, 0x96cbfb8e, 0x178d1707, 0x000045ad, 0x771677cd, 0x7e6d8ea8, 0x3a353a68, 0x00000ed3, 0xa8caa86b, 0x1d15bdcb, 0x118511f5, 0x000003a0,
+        0x4c2d4c02, 0xed796874, 0x74127482, 0x00007f0a, 0xa4f8a48c, 0x4f361446, 0xa27ca233, 0x000040cf, 0x2549256f, 0x07c7b84b, 0xa4c3a45e, 0x00008f80,
+        0xca7bca1d, 0x37abc4a8, 0xc168c160, 0x0000125b, 0x2ff22f38, 0x396f4662, 0xe80ee829, 0x0000ad88, 0x4c604c61, 0xab7bec2a, 0xb3a7b342, 0x0000800e,
+        0xecdcec4e, 0xb30093c6, 0x53dd5385, 0x000035f1, 0x774c7747, 0x7512a7fe, 0x0c840c83, 0x0000e615, 0x449644cf, 0x06d8df56, 0x47d44787, 0x00002903,
+        0xf88cf836, 0xb4ec90b2, 0xe7ade764, 0x0000d2a5, 0x610061fd, 0x48efbebf, 0x150015d4, 0x0000dae6, 0x091b09e9, 0xdaf80820, 0x37e137e8, 0x0000c793,
+        0xcacfca24, 0xf54402ca, 0x7f297f4c, 0x0000e4a8, 0x32733275, 0x8cb8e930, 0x856e85d0, 0x00000a54, 0x8d4b8de9, 0xa0611cb3, 0x5ccc5c75, 0x0000f0b2,
+        0x0f1a0f52, 0xe1fc53e3, 0xb17eb1f0, 0x0000efb7, 0x322c3274, 0xa1410486, 0xbe51be59, 0x00003669, 0x45fd45d1, 0x89473fff, 0x6b1b6b7a, 0x00003194,
+        0x50d250a6, 0x0c4d4592, 0xa11ba184, 0x000073fe, 0x293e2935, 0xdd54eb0f, 0x15451543, 0x000064b0, 0x065c0640, 0x82929b05, 0x1fae1fac, 0x00002487,
+        0x6fd16fd2, 0x28e05292, 0xf99cf92a, 0x0000fc49, 0xeb87eb3e, 0x6ffd9327, 0x9e759e9e, 0x00004b3a, 0x2d1e2da8, 0x333cd775, 0x8e4e8e2f, 0x000049dc,
+        0x3ae13ae6, 0x1fdaa8b8, 0x733973f0, 0x000030c3, 0x3dd43d38, 0xb68bc9a8, 0xacb0ac0a, 0x0000ba05, 0xe134e1a0, 0xac31b4d6, 0xfd58fdc4, 0x0000085d,
+        0xef96ef57, 0x4e8599ea, 0x646364df, 0x00002024, 0x24152491, 0x4c2589ee, 0x77e87741, 0x0000e06f, 0xb52bb5d8, 0x9d522dd9, 0x768b76de, 0x00003135,
+        0xc5d6c53e, 0xab10366c, 0x25ed25b8, 0x0000b89e, 0x20f12078, 0xf551485b, 0x9e849e27, 0x00007861, 0xb070b0cc, 0x18e50b14, 0x11021112, 0x0000e2e2,
+        0x4e564ece, 0x3965effd, 0x18921897, 0x000022ee, 0x134b1330, 0x8fa782b3, 0xeb80eb8f, 0x00002353, 0x71177187, 0xd03b1bd1, 0xa477a474, 0x0000825e,
+        0x3604363c, 0xd69db984, 0xf292f22a, 0x0000f718, 0x65b165f3, 0xe613577c, 0xa292a276, 0x0000dc57, 0x664f664b, 0x382a8ba0, 0xe000e013, 0x00000039,
+        0xd5a5d5c4, 0x729665c5, 0xe6fee656, 0x0000b250, 0x0ac60a64, 0x00a3f528, 0x7817784e, 0x0000e5b5, 0x47fe478e, 0xb81b3dcd, 0x38d2380f, 0x00009b6f,
+        0x9ad49acb, 0x632011cc, 0x7a557a98, 0x0000d675, 0x29122962, 0x0ef4b7a0, 0xc1bfc18a, 0x0000d266, 0x405240b5, 0x9ea8751b, 0x39f23946, 0x00004812,
+        0x872987f6, 0x82e9a9f8, 0x596c5928, 0x0000e8e9, 0x0ca20cd9, 0xbacc1fb9, 0xf6ddf656, 0x0000a735, 0x7c077c75, 0xead36bca, 0xc177c136, 0x000060d0,
+        0x83658306, 0x926810bc, 0x57145767, 0x0000815c, 0x05d305cf, 0xb4a0c819, 0x19651943, 0x0000bb6f, 0xcdd1cd69, 0xf8881275, 0x484b4810, 0x000095eb,
+        0xbeafbe32, 0x70e2ccad, 0x995e996f, 0x0000e789, 0x395c39c5, 0xe1312c8f, 0xdcc8dc60, 0x00003322, 0x783178a6, 0x393c4cad, 0xc688c6e4, 0x0000845f,
+        0xae7baee9, 0x79e41646, 0x6a5e6af7, 0x00003643, 0x56cf565c, 0x8c477e84, 0x3fb33f53, 0x00003826, 0x9aa09ae3, 0x760e3ace, 0xdba7db26, 0x00003a2c,
+        0xc3cfc3c4, 0x14bf63a7, 0xd6f2d6b5, 0x0000201a, 0xfd71fd76, 0xbadb70ef, 0xd9c6d991, 0x0000020d, 0xb5fcb51f, 0x7fc007d7, 0x97339712, 0x00000d46,
+        0x68a1682e, 0xf11c7bd7, 0xb0d7b09e, 0x0000a52a, 0x0c920c99, 0xee934c4f, 0x35613592, 0x0000fa7e, 0x27862783, 0xffcecc7f, 0x7f297f2f, 0x00007ba3,
+        0xbabeba60, 0x4436d104, 0xe219e2ca, 0x00003439, 0x21272122, 0x43795378, 0x02710268, 0x0000a651, 0xe02ee0c1, 0xeb73dffb, 0x004700af, 0x0000a848,
+        0x3c633c13, 0xcb9a2026, 0x60a26028, 0x00008e8e, 0xe388e379, 0x55a79b57, 0x128312d6, 0x00005ee8, 0x260b26da, 0x9e538631, 0x4f0d4f6c, 0x00000cbc,
+        0x73e8739d, 0x85f7c1fe, 0x2d4c2d1f, 0x0000b811, 0x19bb1936, 0xd6bb08d7, 0x3b633b4d, 0x00007140, 0x053805e9, 0xbf1b50f3, 0xd83fd84c, 0x0000bc31,
+        0x574b5777, 0xdb3cc4dd, 0x6a496ab5, 0x0000dbd4, 0x3932391f, 0x14ba3dd1, 0x5e585ef3, 0x0000d734, 0xd638d607, 0x89f75972, 0x826782fd, 0x00000fbd,
+        0xb36cb30e, 0xd610a2e0, 0x6434645e, 0x00007202, 0xda08dac0, 0x57f03560, 0xed58ed5d, 0x000068b8, 0x9b179be6, 0xa9d1dd96, 0xb842b8a9, 0x000016f2,
+        0xd1b3d1f7, 0xbecdac3e, 0x37483752, 0x00007ba3, 0x55ee552e, 0xc17cfefa, 0xa7b8a70a, 0x000058cf, 0x93b293db, 0x88a7abfc, 0x95e495f6, 0x0000412f,
+        0x4b2b4bb3, 0x0ef5a854, 0x620b623f, 0x0000d734, 0x00d100c3, 0xf2a14d52, 0x556f5528, 0x00005365, 0x1c6d1c9f, 0x97aa36a9, 0x8ff68f2e, 0x00005579,
+        0x27882792, 0xc674b1c0, 0xe883e84b, 0x0000a7c9, 0x7e837ef0, 0xbb744f13, 0xf9a0f9ff, 0x0000e792, 0xa81ba844, 0x172f23e4, 0x9b1f9b11, 0x000027e0,
+        0x45aa4557, 0x4a869a55, 0x94a69438, 0x00001a33, 0xd8dcd894, 0x7c1d0cda, 0xd36ed33d, 0x0000f293, 0xcd71cde5, 0x87aa20eb, 0xe72ae7a8, 0x0000d91b,
+        0xfc52fca5, 0x998cc417, 0xddc8dd82, 0x0000a628, 0xdb9ddb51, 0x9115aa79, 0x1e271e15, 0x00003fbb, 0xc4bdc491, 0xbd6d9a57, 0x979197aa, 0x0000c784,
+        0x06f30654, 0x326c05b5, 0x3f163f02, 0x0000479f, 0x5e375ed0, 0x137a8101, 0x03c90337, 0x000060a6, 0x162f160c, 0xb92c6b74, 0xfd94fd28, 0x00000db5,
+        0x47b1473b, 0x4b10b960, 0xac29ac96, 0x0000a518, 0xe0c7e0fa, 0x4442c33c, 0x07dd076c, 0x00003411, 0x66146685, 0x270fc867, 0x9611969c, 0x0000f3b3,
+        0xdc08dce0, 0x11cd6d44, 0x13a7137a, 0x0000ea16, 0xa2c8a260, 0xcfa768f4, 0x12771201, 0x00000c72, 0xd8b7d821, 0x0c5a07c5, 0x106710d6, 0x00007033,
+        0x0f1e0f6c, 0x7e55d825, 0x49dc4975, 0x0000b7cd, 0xc2f4c222, 0xc45575d9, 0x4ee94e4e, 0x00002ba4, 0x2324230f, 0x92ca5c54, 0x30af3099, 0x00002976,
+        0xc3c4c3fb, 0x10efc07d, 0x241224d8, 0x00002466, 0x92e492cb, 0xfc48606d, 0x43dd4378, 0x000000a1, 0xbee9be8a, 0xbc6dab87, 0x96459638, 0x00007cb6,
+        0x5a3f5a36, 0x794be2e2, 0xc775c78d, 0x00007b5d, 0xba06ba97, 0x5ce8f357, 0xb842b8a8, 0x0000b1a8, 0x352b35ca, 0x90d768f4, 0xa048a051, 0x00009134,
+        0xda3fda5b, 0x5aaee37d, 0xca37ca8a, 0x000043b0, 0x65d3650e, 0x464664d4, 0xdc43dc87, 0x0000fd63, 0x7446746c, 0xd4729ac8, 0xd574d540, 0x0000c05a,
+        0x8a178a6a, 0xe8c071a9, 0x0c060c76, 0x0000aa54, 0x741a74c1, 0xb05f7250, 0x734e73df, 0x0000b9e5, 0x3d193d77, 0x12559115, 0xec68ecfd, 0x0000c98d,
+        0xf2cff229, 0x4526e313, 0x04bb0489, 0x0000b354, 0x192819a3, 0x138e19d5, 0x591f59dc, 0x000083a3, 0x3dfc3df9, 0x85375dd1, 0x60a66027, 0x0000bd63,
+        0xb4c5b496, 0x73a857cd, 0xfbaafb52, 0x0000d265, 0xf387f328, 0xad20b058, 0x934a937d, 0x00006f6a, 0x56585626, 0xe6c10b6f, 0x22b0228b, 0x00005dbe,
+        0x43944356, 0xd5d23bbf, 0x4c7d4c76, 0x000049a9, 0xf940f9e6, 0x4b7e239f, 0xf8d3f8f0, 0x00003edc, 0x07d00747, 0xd9f846db, 0x07390734, 0x0000bbb1,
+        0x5f835f03, 0x5d07717d, 0x8aa68a32, 0x0000a044, 0x62036247, 0xc4b5226b, 0x05810561, 0x000062f7, 0x4c2b4c99, 0xee9334df, 0x4f954f3f, 0x00000e92,
+        0xc40ac4cb, 0x9e53f2e8, 0x114311ea, 0x0000132a, 0x4fdf4fec, 0x5359c43c, 0xac8eac78, 0x00001acb, 0x766276d2, 0x09dbae14, 0xbb06bba2, 0x0000c7dc,
+        0xf1a3f18b, 0x97d917cf, 0xe4d2e466, 0x0000c9b7, 0x893e8951, 0x82372fa4, 0xcbf5cbb1, 0x0000020d, 0x2839289c, 0xa18e9778, 0xa770a73b, 0x0000ce45,
+        0x06670697, 0x30cfde5a, 0xd025d067, 0x0000e73d, 0x3891385a, 0x4c265aee, 0x9b3f9bd1, 0x00004690, 0x423f42c0, 0x4f5db692, 0x29aa2901, 0x0000e95b,
+        0x8939893e, 0xe822f83a, 0x0dae0d16, 0x00002963, 0xcf6acf3c, 0x98dd7452, 0x4937494f, 0x000082a2, 0xf449f4e0, 0xdf8bf763, 0xf64bf614, 0x0000bc81,
+        0x7445746f, 0xb8b3f2cf, 0x110d113d, 0x00005acd, 0xaa4faa9a, 0xe4a3b1d8, 0x8fbd8fa3, 0x00006478, 0xc6b3c635, 0x128acb51, 0x462046ba, 0x000012f7,
+        0xaea6ae18, 0x6f1a0ff0, 0x09d30990, 0x000079ae, 0x754b75fc, 0x3abf1e98, 0x75af752d, 0x00002128, 0x22142285, 0x6abf54a7, 0x33cd33cf, 0x00007ca3,
+        0xcddecdf8, 0x31471979, 0xb4e5b43b, 0x0000b0cd, 0x16a316de, 0xce7bc743, 0x3b3c3bf9, 0x0000ec16, 0xa5c7a5d3, 0x68c3523f, 0xde5adefe, 0x0000e015,
+        0x14d014bb, 0x6857f860, 0xaa09aa77, 0x000036c4, 0xfbcbfb19, 0x50222ac6, 0x5fc55f82, 0x000062af, 0xac03ac58, 0x51526861, 0x57f057a3, 0x0000a4e8,
+        0xd97ad967, 0xd614a0f1, 0x19b4197c, 0x00006a2b, 0x16651627, 0x287d8c62, 0x174e17bc, 0x00002f4c, 0xacc8ac3f, 0xcf18d0f5, 0xa778a7d4, 0x0000f583,
+        0xa7f4a7b9, 0xda54e55d, 0x4f6a4fab, 0x00006ce1, 0xa752a732, 0xc1b58afe, 0xbb8bbbc2, 0x0000eb65, 0xc4efc40f, 0x5078694b, 0xbee7bece, 0x000021a2,
+        0x6a026aad, 0x05b3ef53, 0xee80eede, 0x00002ef8, 0xd069d02a, 0x2559e6a2, 0x246f243b, 0x0000bc76, 0xee2aee15, 0xba4adab5, 0x00d50010, 0x0000e689,
+        0xfccefc58, 0x9b0600c8, 0x67746707, 0x000071bf, 0x3a763a8a, 0xdaab33c5, 0x148114fd, 0x000070fb, 0xa20da27e, 0x4bd4f824, 0x1e1d1ec3, 0x000035ae,
+        0x1f281f5c, 0x660c0b16, 0x8f588f77, 0x00004543, 0xb26eb2d1, 0x997290f9, 0x760e761f, 0x00001d47, 0xa175a1ff, 0xecd3438f, 0x95719564, 0x00000972,
+        0x31e33147, 0xbfbdf8e5, 0xf966f90b, 0x000011e3, 0x37983741, 0x7a8ac818, 0x2bf42b8b, 0x0000b1d7, 0xb098b057, 0x88f8a4ae, 0x3a2d3a4a, 0x0000241c,
+        0x62f062a4, 0xa50db4d5, 0x65966582, 0x000098f7, 0x43ed4328, 0x158b1e9e, 0xa51fa5fb, 0x0000f985, 0x8dac8d30, 0x97d61541, 0xac52acb9, 0x00008990,
+        0xc930c9d0, 0x3903f1d6, 0xc990c932, 0x0000004c, 0x715b712d, 0xfb12182f, 0xcba5cbe6, 0x0000efe2, 0x3f1b3fcc, 0x44fb170a, 0xda6dda6d, 0x00003d11,
+        0x971c97f5, 0x12da4450, 0xc363c37b, 0x000045a6, 0xc935c98f, 0x4197899b, 0x5a995a29, 0x00000263, 0x2a132acf, 0xb7343fcd, 0x94aa94e2, 0x00001b07,
+        0x33b833d9, 0x4f5ee55c, 0xaaafaa95, 0x000056c1, 0xd59fd585, 0xc5eb64bb, 0x5af15ab1, 0x0000f3ec, 0x2dea2dd1, 0x4d89849f, 0xe06ce0cf, 0x00000900,
+        0x35d835dc, 0x1fb5f6e7, 0xef8cef12, 0x00001228, 0x4fe64fe0, 0x5b43712f, 0xdf36dfaf, 0x0000ad4a, 0xc30bc38d, 0xf75126bf, 0x377d376b, 0x0000c732,
+        0x329332cc, 0x60239ba9, 0x4205423e, 0x0000289a, 0x29512991, 0x2f219507, 0xdb06db1c, 0x00004a6e, 0x1cc21cd5, 0x69a67e7e, 0x7f517f64, 0x0000a091,
+        0xafadaf1f, 0xf31974e2, 0x77ab77f3, 0x000026ab, 0x0ad20ad0, 0xaa3f1e67, 0xe42be4ef, 0x00005306, 0xb4f3b452, 0x20c1a165, 0x72787231, 0x00009df5,
+        0xefdeef8b, 0x8a2820e8, 0x43074359, 0x0000ee94, 0x24fc246c, 0xb9cc92be, 0xdd3ddd1c, 0x00004b05, 0xa8fba824, 0xee1739ec, 0x49404971, 0x00009615,
+        0x71ae713d, 0x658558e0, 0x5dfd5d15, 0x000038a4, 0x77c777c0, 0xde52fb8c, 0xd84ad81f, 0x0000b28e, 0xd687d688, 0xba4f2874, 0x09bd0961, 0x0000d4d7,
+        0x35ce35a8, 0x79da3f4c, 0x7cb67c58, 0x000089d8, 0x053a057f, 0x86277f88, 0x300d304a, 0x0000da52, 0x5cea5c5f, 0x6543ac54, 0x296929ff, 0x0000dfc4,
+        0xcf64cf3c, 0xb9e341c6, 0xa026a0cc, 0x00008603, 0xe087e03a, 0x66d3ef5d, 0xfacdfac9, 0x00002d0b, 0xfbf3fbb0, 0x9d5779fc, 0xb65bb6cd, 0x0000a939,
+        0x5edb5ea5, 0xb2d1aeb5, 0x47594706, 0x0000c427, 0x3ee53e95, 0xe583f5e9, 0xb90eb983, 0x0000bf9c, 0x0545052a, 0x8bb1495d, 0x6808683f, 0x0000ec16,
+        0x2c752c25, 0xb5f7f5de, 0xd9f6d971, 0x000032ae, 0x5a265ad6, 0xff325f11, 0x557855a8, 0x00005f26, 0x59cd5998, 0x6cbfc78a, 0x34043423, 0x000006a0,
+        0xcc43cc19, 0xf5dec4fd, 0xc7c8c7d1, 0x00005adc, 0xa664a6fa, 0x558a042f, 0x5abd5af5, 0x0000cdf0, 0x79b679ae, 0xbd01c27a, 0xf1def137, 0x00008a0e,
+        0x161a1651, 0x2b2035ee, 0xd51fd510, 0x000050d8, 0x3aae3a87, 0xb666219d, 0x2d4c2d15, 0x0000bfae, 0x1ce31c1c, 0xd55454ce, 0x99e599fa, 0x0000de0b,
+        0x5aab5a6d, 0xa741b3e6, 0x2b812b87, 0x0000d2a5, 0x910b9173, 0x217c133f, 0x74cb748a, 0x0000acbf, 0x1a3f1a14, 0xf5c25e5c, 0xe53ce5e5, 0x000027ba,
+        0x78397878, 0xe59d1f9a, 0x1b541b1a, 0x00004304, 0x2a502ab1, 0xc35710c1, 0xc743c7aa, 0x00007ea3, 0x66dc6625, 0x13058431, 0x158215fe, 0x00005036,
+        0x9288925d, 0x6b4ad0f5, 0xd4d2d477, 0x00003002, 0x9c109ca6, 0xd381b66e, 0x9a6f9ac0, 0x0000a907, 0xae49ae73, 0x0e82f8f4, 0x62f162cc, 0x00001165,
+        0x2a082ae0, 0xdb51e3e2, 0x664966ea, 0x00002641, 0x361e3681, 0xc2ca3f4f, 0x840a847e, 0x00008ef2, 0x504f5036, 0x7c69eef1, 0x7ab77aa5, 0x00000ed8,
+        0x804080b2, 0xce8c3b30, 0x0c080c22, 0x00007569, 0x439f4352, 0xd46d0927, 0x240a24a1, 0x00001c33, 0xe059e02e, 0x7c1af89d, 0xbae6baca, 0x0000da1b,
+        0x6f636f5d, 0x1d2a11b5, 0x0fca0f2a, 0x0000b4e6, 0x73e9730b, 0x647af860, 0x30643063, 0x0000ab64, 0xb851b866, 0xa3bef7d7, 0x6cfd6cd8, 0x0000fe9e,
+        0xcb30cb85, 0x24edfc47, 0xc83cc80d, 0x00003cf3, 0x254b257e, 0xa87111c3, 0x0f6f0ff0, 0x00005474, 0xca28ca52, 0x0ea338a7, 0x6504654d, 0x000043c7,
+        0xda97dae1, 0xb9b0ebcc, 0x551b5574, 0x0000618b, 0xbc33bcbc, 0xc527ca2e, 0x482b485b, 0x00007751, 0xbb6fbbe4, 0x2cb1fcc5, 0xb008b080, 0x00005e11,
+        0x5d5c5d97, 0x50894adf, 0xd69bd6ff, 0x00007f8f, 0x89e98915, 0x83dc94a5, 0x141f14bc, 0x000075a3, 0xe323e357, 0x0b26df38, 0x462746fc, 0x0000dfb7,
+        0x310531f2, 0x896eba86, 0xed09ed2c, 0x00005e50, 0xbb4cbb2d, 0xa1bee2ef, 0xb892b82b, 0x0000ee94, 0xdd81ddc5, 0x2b7d178b, 0x348a3476, 0x0000f3f1,
+        0xb5ebb567, 0xc962b4e7, 0x74c57492, 0x0000ed16, 0x3ad63ac4, 0xab808d81, 0x1c6c1c60, 0x0000c2a0, 0x6eb46ecd, 0xd1b02826, 0x7fff7fb1, 0x00006a6a,
+        0x172d1723, 0xbdf88267, 0x0c2d0c87, 0x00009871, 0x3c873c4f, 0xdedf3495, 0x98529870, 0x0000b279, 0x8a008ad7, 0xf5c2ee63, 0xcd1ccd99, 0x00009158,
+        0x9c679c14, 0x76dd83cf, 0x11251141, 0x00005399, 0x4c1c4c76, 0x5b06074b, 0x124b12a1, 0x00000d53, 0x5eee5e6e, 0x0ae2e931, 0xf669f631, 0x00008b61,
+        0xe426e4c6, 0x5a4ddf56, 0x946f943b, 0x00007757, 0x816d8100, 0x74753ed6, 0x85df856e, 0x0000c17a, 0xaadbaa1f, 0x8bb8f2ac, 0x2e002ecb, 0x00000600,
+        0xddc1ddbc, 0xb9a9a9bd, 0x93bd933e, 0x0000211c, 0x5bb55b41, 0x6dbd64a4, 0x2b422b21, 0x0000e289, 0xf584f58c, 0xae9bbd35, 0xcedacedb, 0x0000d2a5,
+        0xcf3dcf8c, 0x570f54ce, 0x00b200e3, 0x0000cfaf, 0x25b02545, 0x1c4ed6f6, 0x168e1603, 0x00008cb0, 0x65e365ce, 0x677aaacc, 0xac56ac8e, 0x0000785e,
+        0x2c472ca2, 0x34024d56, 0x40be4028, 0x0000f582, 0x3cf53c03, 0x47f9d014, 0x3d613d4b, 0x00004d81, 0x449e4430, 0x6f7db7e7, 0x3ff93f48, 0x000076a7,
+        0x38e6381d, 0x847f746f, 0x86508611, 0x00002487, 0xe4f0e4b8, 0xf16e82b0, 0x20de2020, 0x00006e35, 0xcd04cd67, 0xfcc2ceac, 0xae93ae43, 0x0000c412,
+        0x42e14285, 0xaceea19b, 0xd39cd3fb, 0x0000b80c, 0x44d644b2, 0xf57c7c0d, 0xb32cb305, 0x00006d83, 0x357d35b9, 0x452e6ed5, 0x261326c0, 0x0000c5b1,
+        0x5300535b, 0xb94a76a6, 0x5652568a, 0x0000ab08, 0x683a688a, 0x41242fc6, 0xe531e5f4, 0x0000e789, 0xc84ec855, 0x26e66f86, 0x9856987d, 0x0000d674,
+        0x18c6183b, 0x3ddf726f, 0xa3a4a316, 0x0000be8e, 0x2e672eb3, 0x3abfc008, 0xaaa1aa1f, 0x0000d96d, 0xcf3fcf84, 0x31d127d6, 0x89508947, 0x0000df57,
+        0xfb74fba5, 0x4646a18c, 0x5bfe5bf3, 0x00001b44, 0x467d46f0, 0x90335842, 0xbf99bfa3, 0x0000c527, 0x76947616, 0xb7586ece, 0x7f667f27, 0x0000e1e2,
+        0x31c1312e, 0xfa97b7d6, 0x956895d1, 0x000052c9, 0x025102e1, 0x52202ed6, 0x6ec56e96, 0x0000a364, 0xeef9ee4f, 0x314d495d, 0xd51ad586, 0x00009beb,
+        0xaddfad34, 0x3f3c0787, 0xfb4ffb10, 0x0000c212, 0xae48ae24, 0xd8dbee3c, 0x707d700b, 0x000045bb, 0x2534257b, 0xa2e5a587, 0x50f950f8, 0x0000f7b4,
+        0xd958d925, 0xa980fef9, 0xdb19dbd4, 0x0000d09a, 0xc192c196, 0x9169f947, 0x7b9c7b4d, 0x000065b3, 0xd9b2d9f3, 0xc4693870, 0x151f15dc, 0x0000a543,
+        0x120d12f1, 0x7e56066d, 0xaecbae2a, 0x0000e77c, 0x22f622c6, 0xec6f8ea4, 0x84a38407, 0x0000bd10, 0x5d235d99, 0x1b6a1b52, 0xca37ca57, 0x0000f0d3,
+        0x0a580a2f, 0xe00ea39d, 0x635963bf, 0x00006830, 0xb8d3b8af, 0x9b32ced3, 0x8da08d9a, 0x0000e46a, 0x3ef63e09, 0x1a4e5702, 0x58bd58f5, 0x00009076,
+        0x8ab28a96, 0x6c1c51cd, 0x978197f7, 0x0000fc5f, 0xc40ac436, 0x211660e4, 0x9f5a9f54, 0x000000b2, 0x9d749ddf, 0x99ecc33e, 0xe7abe7f7, 0x0000aa47,
+        0x50ef502b, 0xf63d750f, 0x55f055f8, 0x00004af2, 0xbe58be07, 0x625045fa, 0xe280e2e7, 0x00009214, 0x197d19cf, 0x53bf1c2c, 0x27622737, 0x00006c14,
+        0x7fe27f21, 0xb16c1c64, 0x0be30bb2, 0x0000ca41, 0x8878889b, 0x9da8e9bc, 0x8a7f8a31, 0x0000a2bb, 0xce72ce85, 0xedec315d, 0x16321645, 0x0000a51b,
+        0xc92ac9ae, 0x0fd56476, 0x3dce3d7b, 0x00009d6c, 0xe6b5e6db, 0x3ff5dde5, 0xd197d179, 0x0000d347, 0x11fa1176, 0xed93e932, 0x7a577a25, 0x0000a1d7,
+        0x85688502, 0xf42a7f70, 0x2b782b90, 0x0000d867, 0xbfb6bf62, 0x017ad8e6, 0x31ff310b, 0x0000a836, 0x61a06132, 0x0566ae66, 0x3dd33d31, 0x00008f56,
+        0xec7dec95, 0x5869af1c, 0xdc5edc3c, 0x00009e37, 0x43ed43f9, 0xc25dd184, 0x416441d3, 0x00004de6, 0x46c446fc, 0x460bd91a, 0xc015c0b6, 0x00005994,
+        0xb66cb606, 0x0b0a2755, 0x592c5993, 0x00008a1b, 0x76ec7624, 0x8df8c9a7, 0xc6b5c6fc, 0x00009fa7, 0xe787e7c3, 0x70e23120, 0x0efb0e5c, 0x0000756c,
+        0xbd13bd15, 0xd95a2456, 0xd59bd5f1, 0x0000fb01, 0x9ce99cac, 0xae5b5dd2, 0x62096268, 0x00006c2a, 0xce05ce41, 0xd4ef35a1, 0x23dc2330, 0x00008dd1,
+        0x200020d9, 0x5e68a433, 0xc42dc474, 0x0000f046, 0xd41cd4ca, 0xb0b35b87, 0xcfbecf6f, 0x00009c87, 0x12ea1242, 0x1bde5b04, 0x5ada5aeb, 0x00003040,
+        0x695c6992, 0x2730c040, 0xb6edb6b0, 0x00008850, 0x12b01215, 0xe35f34a2, 0xd61cd68a, 0x00005a1c, 0x0cf10cf6, 0x46f6195b, 0x1a651adc, 0x0000bfda,
+        0x537553d4, 0x05195c54, 0x7207720c, 0x0000045d, 0xef17ef60, 0x145367ca, 0xa29ba223, 0x00008ca0, 0xfc1bfc12, 0x5d682e4e, 0x776d77cb, 0x000045e4,
+        0xd7e5d736, 0x6a40e297, 0xeffaefa3, 0x00008c73, 0xf383f37a, 0x2b2d86de, 0xddc9dd28, 0x00009c79, 0x24c3241b, 0x86aeb84a, 0x089f08f4, 0x00005854,
+        0xe0b8e054, 0x1f651dc3, 0x8467843e, 0x000019b3, 0xdd95dd9c, 0x7909b147, 0xe88ce86a, 0x0000da1a, 0xd5a4d5c7, 0x7aeb63da, 0x09260976, 0x000025ff,
+        0xfe3bfed9, 0x42b9977f, 0xfd1dfd20, 0x00006600, 0x962a969f, 0x7b774a99, 0x2cba2c6f, 0x00002b58, 0x7bd67b94, 0x2052b826, 0x17791768, 0x0000550d,
+        0x498a49c8, 0x513aebb0, 0xac81acdc, 0x000018f2, 0xb39eb33b, 0x96ca742c, 0xe24fe202, 0x00004e37, 0xf87ef898, 0x525207c7, 0x61b661dd, 0x0000a4d9,
+        0x290129eb, 0x56f01931, 0x6bc06bbb, 0x0000405c, 0xe6bde6b6, 0xb9dbd03b, 0xafaeaf99, 0x0000b94e, 0xd5b8d52f, 0x2a4d225e, 0x62ce62e1, 0x0000b196,
+        0xfce2fcfa, 0x894717ff, 0x84648462, 0x000048f0, 0x97ab97fe, 0xdae5fc45, 0x6e296e57, 0x00003f12, 0x471347cd, 0x7fbadcfb, 0xedf8eda4, 0x00004829,
+        0xe916e962, 0x71b20b52, 0x786f7821, 0x00009741, 0x1ca81cdd, 0xe842438c, 0x30753008, 0x0000b9f1, 0xe8a3e81f, 0x30cf70af, 0x2e4f2ebe, 0x00008eb1,
+        0xdc08dce4, 0x918eaafc, 0xf551f59f, 0x0000abe9, 0x86eb868e, 0x1605c74a, 0x8a888a3a, 0x00009e8b, 0x4a1e4a4d, 0x924f35ff, 0x8d798d4e, 0x00009fae,
+        0x6bc46b99, 0x5827aaff, 0xc1aac100, 0x0000ec37, 0x8c6d8c02, 0xf55f8090, 0xbdf6bd40, 0x0000d1c3, 0xff1bffd3, 0x5d29190d, 0xe3b9e366, 0x0000a865,
+        0x030a03ff, 0xd61e438d, 0x2d3e2d09, 0x00004df6, 0xc606c627, 0xf9f458df, 0x7f527fad, 0x000029db, 0xab31ab48, 0x65d22d8d, 0x6d246db6, 0x00006b96,
+        0x9683960b, 0x1099134a, 0x68bb6879, 0x00008a4a, 0x89f9892a, 0x714a3fcd, 0xfaecfa9e, 0x0000081e, 0xe3d6e3f9, 0xa0a1698b, 0xbebabe46, 0x00009c71,
+        0xe902e931, 0xb059e9b0, 0x601860c8, 0x00009172, 0xfdd5fd56, 0x42574499, 0xbe02be85, 0x0000ff73, 0x871c8790, 0xa42e4ddd, 0x2f222f24, 0x000078e1,
+        0xb64ab64b, 0x6d60b84a, 0x503950c9, 0x00006ee0, 0xd73dd7de, 0x9abe27d4, 0xd30ed33b, 0x0000c427, 0x11bc115c, 0x87c8ad3f, 0x62096241, 0x000024f5,
+        0x7118713d, 0x252210d4, 0x489548f6, 0x00009334, 0x8d9b8d8a, 0xf45640f3, 0x733e7307, 0x000087bd, 0x088c083f, 0x83d5ea8c, 0x9d289ddc, 0x00003c88,
+        0xcfbfcf6e, 0xfb188f3a, 0xdb22db11, 0x00007e81, 0x61156180, 0x5a292639, 0x52855262, 0x0000c127, 0x7b617b69, 0x9991febd, 0xbb40bb37, 0x0000a9fb,
+        0xbf58bf98, 0xf2de50f3, 0x1d011dc0, 0x0000ac49, 0xf8ddf8aa, 0x6b002fbc, 0x0e110edf, 0x0000e337, 0xa64ba65c, 0x4cf697c5, 0x1ba61bce, 0x0000300a,
+        0xaae4aa7d, 0x7a8ae4fc, 0x244224e2, 0x00000c43, 0xb03bb000, 0x5f4d8300, 0xf979f92d, 0x00004001, 0x9ef79ebc, 0x4e2571d1, 0x53b05331, 0x0000167d,
+        0x1efb1eb4, 0xa4fe6d93, 0xd401d40c, 0x0000396c, 0x88bb8892, 0xf8036196, 0xfea5fe98, 0x00005adc, 0x7dbd7dc8, 0x939d0541, 0x882a8821, 0x00001158,
+        0x64af64df, 0x99fcf9c5, 0x893e89ad, 0x0000d889, 0xdb37dbdb, 0x70bc9164, 0xbebfbec6, 0x0000f9bb, 0xdf7adf54, 0x6f617709, 0xf90cf902, 0x0000ae08,
+        0x114a118d, 0x5c078370, 0x4e564eac, 0x0000137d, 0x8be88b31, 0x29b6416f, 0xcd05cd6b, 0x00000e27, 0x0ac30a00, 0x7e126a4b, 0xa76fa7d4, 0x0000da67,
+        0x33b7333e, 0xfd30a492, 0x2b0b2bbe, 0x0000d5ca, 0x33003305, 0xfe77abdf, 0x034b03e0, 0x00001af3, 0x98dc9897, 0x1bee1144, 0x93619373, 0x00007568,
+        0xebf7eb1a, 0xe04233e0, 0xadb2ad2e, 0x0000378e, 0x224d220f, 0xad0c3c4f, 0x0ba80b9c, 0x00006e22, 0x79ea7953, 0x47c5d8a5, 0x625762a3, 0x00001893,
+        0xf71df7c6, 0x841f7bdd, 0x782978e2, 0x00001728, 0x155315f9, 0x9bce7591, 0x5980591d, 0x0000ac47, 0x76d776d0, 0x3a5e1c1b, 0x4a4f4a81, 0x0000c01d,
+        0xd268d227, 0x25212456, 0x853785c5, 0x00001636, 0xc110c1fc, 0x58d67ab7, 0x45104557, 0x00005298, 0xdeb0deb1, 0xda3ba2d9, 0xb3b6b370, 0x0000f9e3,
+        0x0ab80a63, 0xcf45a78a, 0x01820160, 0x0000603f, 0x413a41d4, 0xed22e6f6, 0x4aa44a7d, 0x0000358c, 0xc94fc92b, 0x85048a90, 0xcc3bcc46, 0x0000cc7d,
+        0x03e3037e, 0xdff38442, 0xffd5ffdc, 0x00007622, 0xc400c438, 0xcb7a2a39, 0xd355d36d, 0x0000d818, 0xafd7af4a, 0xe0f69070, 0xef41ef04, 0x00001e88,
+        0xab3aabd3, 0x74e2e5a5, 0x89cf8956, 0x00009ea6, 0xcd90cdae, 0x1da8c271, 0x96a99686, 0x0000c173, 0x171c17fd, 0x61eca5a9, 0x0a890ae4, 0x0000a5b1,
+        0x8257827e, 0x50a91b1b, 0xbe40bea2, 0x00009418, 0x3df33d09, 0xb63506b7, 0x8ab48a03, 0x000067f2, 0xf38cf33c, 0x43d743cb, 0x3c8b3c1f, 0x0000456a,
+        0x36a736d3, 0xd34fe0dc, 0x675067ae, 0x00003752, 0xad11adbd, 0xef53fec5, 0x4609468f, 0x0000d7bb, 0x5fb65fbe, 0xe1fcf45b, 0xa96ca975, 0x0000f80b,
+        0x963996e5, 0x60907104, 0x878b870f, 0x0000f872, 0x7bc07b2a, 0x77ff946c, 0x0c750c7f, 0x0000135a, 0x2fee2fcf, 0x3845bc76, 0x0247020c, 0x00000e30,
+        0x293c29fc, 0x7b1dc63e, 0xafa4af3f, 0x0000bc13, 0xb66fb6ae, 0xb392af15, 0x728472dd, 0x0000241c, 0x98b69833, 0x9e3a89fe, 0xf77ef726, 0x000095fa,
+        0x04480484, 0xbf0381ac, 0x63dc632a, 0x000061d0, 0x44914471, 0xbc99a314, 0xc9c1c929, 0x0000c4c4, 0xe539e560, 0x5a8279ff, 0x242a2455, 0x00002aa4,
+        0x1d041d05, 0xa740242b, 0x89788989, 0x000064e1, 0x95a0950b, 0xe0c11a32, 0x687968d8, 0x0000550f, 0xd98ad964, 0x6dc2b7e9, 0xb62fb6bd, 0x0000f786,
+        0xc3e3c370, 0xc283504d, 0xc477c481, 0x0000c536, 0x4a644a65, 0x13f9d1f6, 0x148014fd, 0x00002fea, 0xf871f8b9, 0x4736cded, 0xbadeba88, 0x0000a141,
+        0xdaf8da5d, 0xcf7af3f9, 0x2e442ea5, 0x000027c5, 0xda1fda1a, 0xa3be8b90, 0xee57eec1, 0x0000b13b, 0x96e696e0, 0x98ecd35b, 0x639e638d, 0x0000ca7f,
+        0x20782003, 0xde54a6a9, 0xcfb0cfaf, 0x00007c81, 0xd6ccd67b, 0xd1f806c7, 0x80b58036, 0x00004bc6, 0xe816e8a0, 0x839a68fa, 0x834a8373, 0x00009076,
+        0xe4d5e47d, 0x06f4595f, 0x66296618, 0x00005c39, 0x6bfe6be8, 0x17a5b469, 0xf413f4ae, 0x000085cd, 0x79367961, 0x691c105c, 0x1f6a1f29, 0x000035ad,
+        0x3df83d58, 0x4d99dae4, 0xd0a3d09f, 0x0000897c, 0xf6e8f681, 0x014406bc, 0x80c98062, 0x0000e20d, 0x3bf53bb8, 0xcab35ee3, 0x0c500c54, 0x00002adb,
+        0x21042107, 0xb4dcdbdb, 0x131113de, 0x0000c3ec, 0x2a3b2a22, 0x1a1f6f8b, 0x5fba5fe1, 0x00006605, 0xbad1ba9b, 0x8c589d4c, 0x91019172, 0x0000f4b4,
+        0xcfe4cf3f, 0x1e8ad3e8, 0x5b0b5b10, 0x000094e0, 0x3bfc3b4b, 0x2d53044b, 0xa1a4a180, 0x00004526, 0xc567c58e, 0xcb27690d, 0x959d9590, 0x0000885f,
+        0x890a8934, 0x1f498bac, 0xb417b48d, 0x00005277, 0x6b8e6b9a, 0x3897c967, 0xb724b791, 0x000070ef, 0xe0cae08c, 0x56785ddd, 0xf868f871, 0x0000eb29,
+        0x770f772d, 0x1075b57b, 0x1d0c1db9, 0x00002637, 0xb146b1c8, 0xe7020ddb, 0xdc5ddcf9, 0x0000c08d, 0x803c80af, 0x1fda9639, 0xc468c414, 0x0000a8cb,
+        0x11fe11a2, 0xc609ea52, 0x110311fc, 0x0000da67, 0x8120813a, 0xba364d56, 0x45604589, 0x00009ed7, 0x385a3847, 0x1e756156, 0x9e339eef, 0x00003d13,
+        0xc7fdc702, 0x41662a40, 0x4376439d, 0x0000e00c, 0x3cc03c09, 0x2ca12d8d, 0x9e709e24, 0x00003806, 0x44fa4485, 0xbc748542, 0x9082904c, 0x00002d0a,
+        0x9396932d, 0xe95c9d56, 0x519151ea, 0x0000c227, 0x45c645b6, 0x6e409fa3, 0xdd3add1f, 0x00008a50, 0x192319a5, 0xb3e23ccf, 0xa365a300, 0x0000acbf,
+        0x9216928e, 0x62b2be74, 0x897089dc, 0x0000dd45, 0x8c178ce8, 0x11b1182e, 0xf5f5f5ae, 0x0000ad4b, 0x05410528, 0x018b15c3, 0x0aaf0afa, 0x00004fea,
+        0xf3aaf3ac, 0x2c4d585a, 0xabecabcc, 0x00004711, 0x2703276a, 0x94b633a0, 0x62e262e5, 0x0000562c, 0x5b1c5b2c, 0x41c514e3, 0xf42df4bb, 0x000097bd,
+        0x5c3e5c41, 0x138e919c, 0x51d35136, 0x00005e19, 0x9fff9f9a, 0xa746310f, 0x591359c5, 0x000061f7, 0x08a208d9, 0x64c4f628, 0x0d860d81, 0x00002864,
+        0xe07ae089, 0xcda4a133, 0x275b2705, 0x0000c7f0, 0xdd96ddc8, 0x8137d5c8, 0xa1b8a164, 0x00005046, 0xf220f2b7, 0x68104dca, 0x627062b6, 0x0000245a,
+        0xff25ff5e, 0x8587cc90, 0x797e7977, 0x00001088, 0x65e065da, 0x8b424ead, 0x057705da, 0x00003a2c, 0xef9eefaf, 0xb24582cc, 0x5b6c5bf9, 0x0000cab1,
+        0x1d361d9e, 0x113adb25, 0x1d7e1d5c, 0x000061f7, 0xa2cba28f, 0x9c2be263, 0xdb65dbcc, 0x0000f70c, 0x5e685e1d, 0x23d261d5, 0xd771d773, 0x00002a86,
+        0x837b8374, 0x97d96f49, 0xb515b52f, 0x000021ea, 0x549f54f2, 0x16bfaa07, 0xcb77cb89, 0x0000cd40, 0x77a17788, 0x7bf65f7c, 0xcbedcbfc, 0x00005bbd,
+        0xf144f140, 0x47f9655b, 0xf69cf629, 0x0000072a, 0x37f83733, 0x94a6ce2e, 0xef3cef7e, 0x00007770, 0x803b80ff, 0xb41ce932, 0x403040be, 0x00006ae1,
+        0xad24adce, 0x4ac9f18e, 0x55035579, 0x00007757, 0x63a163f0, 0x98f14d29, 0x573157e1, 0x00009514, 0x16291602, 0xf373b3e7, 0x97b99751, 0x0000598d,
+        0xf030f0c9, 0x95c9be4a, 0x7d0a7d5a, 0x00002e3a, 0x0d4c0dfb, 0xc79d118b, 0x88198830, 0x000057d8, 0x56e356d6, 0xc9f75aa1, 0xf745f7d8, 0x000098c8,
+        0x900e90d6, 0xa2b744c4, 0x224722e5, 0x0000ba55, 0xa519a552, 0x85f66b34, 0x6a4d6ae8, 0x00009114, 0x9da19dea, 0x6b40eeb0, 0x83868347, 0x0000d50b,
+        0x247a2407, 0xc9d2ec50, 0x64dc647a, 0x000055ff, 0xd7a1d77d, 0x58a7ded3, 0x874f875d, 0x00004ccc, 0xf6aef6a5, 0xb3648baa, 0xcd68cdd4, 0x0000216d,
+        0x58d25815, 0xb813d1f4, 0x7cd37c3e, 0x00005980, 0x6c7f6c52, 0xbe6ecb6f, 0xd2b9d202, 0x000080be, 0x968396b5, 0x8ff70957, 0xa3b6a32e, 0x0000ba70,
+        0x013501d7, 0xca1b9f13, 0x6a246a30, 0x0000ad75, 0x2b092b90, 0x754d0969, 0x106f10b6, 0x0000958a, 0x629a62fa, 0xc4355372, 0x75567519, 0x000015ba,
+        0x79397946, 0x0395c69e, 0x381f3866, 0x0000014c, 0xb0c0b0ab, 0x6c6efa63, 0x542f5483, 0x0000027f, 0x3da23d85, 0x31ac90af, 0x0c510c20, 0x0000ec09,
+        0xfa62fa12, 0xc105bf86, 0x692a6950, 0x000075ef, 0x4ed84e17, 0x24121bd0, 0xee11ee37, 0x0000478f, 0x1a3c1a69, 0xc79daffe, 0x5b005b59, 0x00000c33,
+        0x306a305a, 0x4d369981, 0xac66ac90, 0x000013bf, 0x5afd5abb, 0xd6e141c6, 0xa705a788, 0x0000a495, 0x9c2b9c14, 0x4636732f, 0x160b1689, 0x0000cd12,
+        0x902a90b4, 0x1ac8938c, 0x37d3378a, 0x00008360, 0x6e9b6ecd, 0x200fbf38, 0x4c724c69, 0x0000c4b2, 0xf7dcf7b6, 0xcc65dad8, 0x290c2909, 0x0000d3ba,
+        0xb97cb9d9, 0xebba0ee5, 0xbffebfe1, 0x0000f97e, 0xbb63bbb3, 0x73d32fd6, 0xe8f3e81c, 0x00007b9d, 0x305c3010, 0xbd8b39bf, 0x5b0f5b98, 0x000051a4,
+        0x793a79a6, 0x1da868b6, 0x83f58315, 0x00006717, 0xb3e7b357, 0xf2a1ceaa, 0xa81ea811, 0x0000d37a, 0xca23ca42, 0x6f821668, 0xa35ca3cd, 0x0000298b,
+        0xe94de9f9, 0x74cdae94, 0x703570c2, 0x000064a4, 0xcbe6cb3e, 0x3894e94f, 0xef78efc1, 0x000029ea, 0x100f10f5, 0x8d462c33, 0x300a303a, 0x00002675,
+        0xbe36be51, 0x9228d25a, 0x1a661af6, 0x0000adc9, 0xc333c37f, 0x015492be, 0x33c23388, 0x00001ee3, 0x41d04134, 0xc2ba7ec2, 0x05b90504, 0x0000f882,
+        0x45db4581, 0x9e2e906c, 0x840984d9, 0x00009ac0, 0xf958f925, 0x4b7d42da, 0x69236902, 0x000092ea, 0xa5aba5b0, 0xc4f48fa1, 0x58ee5804, 0x00000500,
+        0x3c603c18, 0x1cc5c6af, 0x249024f2, 0x00003483, 0xefd6ef2e, 0xa97eecd4, 0x8b568b17, 0x00004ba9, 0xd952d941, 0xe1a2e0af, 0xa27da211, 0x000004bf,
+        0xbac0bae4, 0xa2c26095, 0x87728799, 0x0000d467, 0x0d320d75, 0x97552456, 0x5613567c, 0x0000538f, 0x6d316de6, 0x4679d64f, 0x484748fb, 0x000095f5,
+        0xb747b798, 0xfbab2b0d, 0xc5b6c50d, 0x0000cc69, 0x0d480d8f, 0x28c31c23, 0x4d7a4dd1, 0x000057f9, 0x4ab64aae, 0x551d885f, 0xfdd3fdd4, 0x000023af,
+        0x40fd401f, 0xa9138bfd, 0x723a7201, 0x0000e6f5, 0x095d09d2, 0x5a2dd2cf, 0x2a452ad7, 0x0000e899, 0x3d413dbd, 0xe1935d02, 0x483248bf, 0x0000f440,
+        0x27e92743, 0x1055e0d3, 0x8c188ca4, 0x000064b0, 0x940b947f, 0x2fc15b82, 0xbd69bd01, 0x000096e0, 0x1e2b1ef7, 0xfbd2a2ed, 0x11ac119b, 0x000091d4,
+        0x248a248f, 0xc9e5393d, 0x7aa07ac4, 0x0000c62d, 0x7ccf7cde, 0xf00b6b4a, 0xd55ed5f1, 0x00007960, 0x86e186dc, 0x694e7dc2, 0x6e786edf, 0x000058a7,
+        0x8e698e14, 0xf690045b, 0x5de15d23, 0x0000f3b2, 0x78ff78ea, 0x7f6d97be, 0x2f432fe9, 0x000090c6, 0xd710d732, 0x4b09f830, 0x3520356f, 0x0000071c,
+        0x39b539dd, 0xc87a8e5f, 0xf098f096, 0x000072f3, 0x725372bb, 0x4e86417f, 0x11eb1185, 0x0000638b, 0x8e498e38, 0x43f6ff05, 0x72997298, 0x0000c5b2,
+        0x25a825ae, 0x078bb836, 0x33f03357, 0x00009501, 0x4dd94d8d, 0x4b77c36e, 0x855d8540, 0x00005c2f, 0x720072d1, 0xe61336ed, 0xd3a5d37e, 0x0000df54,
+        0xbcebbc31, 0x128bf0d0, 0x901290e5, 0x00008b1b, 0x6a836ab7, 0x0144e003, 0xa866a8b2, 0x00006e35, 0x83818338, 0x5d899a28, 0x6a016a62, 0x000034f0,
+        0x72357211, 0x346d6d89, 0x578757ac, 0x0000a091, 0x26b22669, 0x4b360374, 0x0073007e, 0x0000e289, 0x09d209be, 0x1c313550, 0xea7cea5c, 0x00005984,
+        0x613b615e, 0xc4b565a4, 0xb181b123, 0x0000fb7e, 0x785e786d, 0x4907b1f8, 0x674b67da, 0x000050d8, 0xe4bae418, 0xe880d6f5, 0xd449d41d, 0x0000cb34,
+        0x331433c1, 0x4f2985fe, 0x4d474dc3, 0x0000ae47, 0x99a2991d, 0x3f86178b, 0xf50bf548, 0x0000386c, 0x384d38d9, 0x99fac474, 0xd1a9d113, 0x00001ea9,
+        0x833c8386, 0x03661313, 0xc50fc572, 0x00005f06, 0xe8f8e8d5, 0xdf9e8cde, 0xff60ffc8, 0x0000f961, 0x5a5b5a13, 0x5da79f6a, 0x3e9b3ec9, 0x0000da67,
+        0x116c1142, 0xc8a5cfd1, 0x9c039ca9, 0x00006426, 0xcfc8cfa1, 0x348d0da5, 0xf36df313, 0x000032d1, 0x4d184d37, 0x6abf43f3, 0x615f61be, 0x00009f31,
+        0xe4e7e4c1, 0x033bd292, 0x58085816, 0x000039fc, 0xb241b24d, 0xd10421e5, 0x7c847c29, 0x0000521f, 0x98709893, 0x5e1d8081, 0x8c2a8c21, 0x00009f8a,
+        0x80998041, 0x7debb127, 0x16a716ab, 0x0000fedc, 0xb7abb7be, 0xa4a11277, 0x58b858ff, 0x0000de86, 0x3c363c8b, 0xbe019675, 0x6ef06e52, 0x0000df8c,
+        0xdb7fdbc7, 0xeb146808, 0x9b549be0, 0x000014bf, 0x90e29072, 0xd22e0ee7, 0x246c2459, 0x00001988, 0x0cfa0cbe, 0x2a19cdd7, 0x857a85d5, 0x00008b1e,
+        0xef95efde, 0x007b60ba, 0x7e3f7e16, 0x0000c4d3, 0x0bfd0ba2, 0x4af7992a, 0xe74ee7d8, 0x00004684, 0x416f412a, 0xaf407204, 0xd9aed95f, 0x0000535b,
+        0x9874984b, 0x0f872533, 0x69a76926, 0x000009f1, 0xea98eac4, 0x240ff4f4, 0x34773463, 0x00007ca2, 0x68b16841, 0xd8389ad5, 0x351935f5, 0x0000c76d,
+        0x8d328dad, 0x84f863e7, 0xe132e15a, 0x000055a7, 0x5fc35f63, 0xac2e1fd0, 0x6e1b6e70, 0x00003e6c, 0xab29abeb, 0x2a7eb454, 0x0fb90fb4, 0x00005775,
+        0x631e63a9, 0x0d8249df, 0xd095d031, 0x00001516, 0x4f824fd6, 0x50e43ce0, 0x814581b2, 0x0000976b, 0x722c72a2, 0x542d50cd, 0x9cb99c7f, 0x00007569,
+        0xc3b6c335, 0xf50bd884, 0xef68efda, 0x0000e7a4, 0xc608c67e, 0xdf1d875f, 0x9b319b4f, 0x0000de87, 0xb788b7f8, 0x21781702, 0x70127083, 0x000001f1,
+        0xca65cabd, 0x454ed2c6, 0x45ff455b, 0x000007ed, 0x557755de, 0x914c9070, 0xcce4cc7a, 0x000069b4, 0x89dd8985, 0x077b6743, 0xde9bde25, 0x00007ca3,
+        0x59b459bf, 0x6a807849, 0xfa5bfaf3, 0x0000a055, 0x384e38db, 0x3f8728bf, 0xb4d9b46b, 0x00007bcc, 0x4c574ce4, 0x57f0f65c, 0xc856c808, 0x00006526,
+        0x912a911a, 0x2e3003ca, 0x17281763, 0x000011fb, 0xc182c103, 0x716e7722, 0x38f138b7, 0x00006c15, 0x63a163f0, 0x391fd1d4, 0xfc7afcb4, 0x0000fabc,
+        0xc897c8a8, 0x6ba0da09, 0x90a4903d, 0x000074b1, 0xe13ce1b2, 0xf1a69e58, 0x494149a6, 0x0000a907, 0x5fee5f29, 0xe01ec7b6, 0x281028c0, 0x0000ade9,
+        0xa67da64c, 0x904c7f3e, 0x512f5140, 0x0000b811, 0x405040a7, 0x1755b558, 0xb2a0b2f9, 0x00000392, 0xa187a1a3, 0xb9cc10ba, 0x5e785ecb, 0x0000a8d9,
+        0x3bdf3b67, 0x706c5d50, 0x7c557c35, 0x0000efc0, 0xa320a37c, 0xa745dde5, 0xe80fe817, 0x00002166, 0x96aa96a2, 0xc43594b5, 0x222c22d8, 0x000052a6,
+        0x7b0e7ba0, 0xb0ccbfc9, 0xc92fc969, 0x00005e6f, 0x265b26d3, 0x85c836d0, 0x0c890c1b, 0x0000bf24, 0x24e8244a, 0xf888a62f, 0x89dc89c4, 0x000049ed,
+        0xbb78bbbe, 0xf897f45c, 0x168d16fa, 0x0000eb16, 0x9abe9a37, 0x189301f9, 0x8c098c9b, 0x0000cdf0, 0xb6fdb6d3, 0x7423a9b6, 0x61c961d2, 0x0000455a,
+        0x10ef109e, 0x64102af9, 0x5d565d3b, 0x0000dd74, 0x889d88e0, 0xdb548b00, 0x68dd683d, 0x0000ae8a, 0x234d23c4, 0x0acb3791, 0xd65dd6fa, 0x00004848,
+        0x23cd235d, 0xaf20dc85, 0x344834d4, 0x000027cb, 0xf17cf183, 0xf3e9ac3e, 0x588458bf, 0x00005679, 0xe0fde031, 0x379a20e9, 0x31883176, 0x0000a5b4,
+        0x69a16965, 0x49ba3f31, 0x6f186fde, 0x0000bd9c, 0xd1c6d115, 0x472632ce, 0x5e6c5ef2, 0x00000e92, 0x9bcd9b97, 0xd4df1b2e, 0xf42df4bb, 0x0000819d,
+        0xcafcca2b, 0x5b886bca, 0x2ffc2f44, 0x0000b4a2, 0x16ca16d7, 0xeef8b35b, 0x24fa2445, 0x00001802, 0xbd02bd3d, 0xad31f1cb, 0xab79ab3d, 0x00001049,
+        0x5ce35ce6, 0x694ce05d, 0x4e6e4e51, 0x000043c7, 0x2584258f, 0x73cd1671, 0xb6bab6cd, 0x00001f14, 0xf1ddf10e, 0x3d504eb6, 0x45944531, 0x000005c3,
+        0x9bff9b35, 0xcafbf6a3, 0x2a6c2a5c, 0x00002ddb, 0x084f08a2, 0x1e93f03d, 0x24102426, 0x0000e7ad, 0x3700378e, 0x33cf21e4, 0xafcfaf83, 0x00008f80,
+        0x393339aa, 0x5252c6b9, 0xfe06fe21, 0x00008a60, 0x200620d4, 0x389742b9, 0x62f962ec, 0x0000f8fa, 0xfac1fae4, 0x9616c0fe, 0x5a385ac7, 0x00005cb0,
+        0x2af12adf, 0x59c81f4a, 0xbdaabd4b, 0x00004a6d, 0x0d640d4f, 0x138a6ac9, 0x0ad40ac5, 0x000023a4, 0x6137610d, 0xb5001cb1, 0xb635b641, 0x0000e389,
+        0xa2c8a214, 0xb4637b5f, 0x640d64a1, 0x000098c8, 0x9c9d9cd9, 0xdd1e1d59, 0xf243f23d, 0x0000a6d7, 0x4f3b4f51, 0xd0dbcad8, 0xd761d7c8, 0x000073c8,
+        0x4bee4b63, 0x0e7d73ec, 0xcc6accb6, 0x0000b3a9, 0xaba2abb3, 0x3edfea72, 0x22e022ef, 0x0000b77e, 0x67d36733, 0x91fcd34a, 0x5b7d5b94, 0x00004625,
+        0x77eb773f, 0xfcaab4b9, 0x8ed88ec9, 0x00002542, 0x7a8d7a5a, 0x71129d5a, 0x8d1d8d63, 0x0000115b, 0xfee4fec3, 0xd530a587, 0xa7a7a7bd, 0x00001095,
+        0x99cc99c9, 0xa3c294f8, 0xc2b4c2dc, 0x0000f1dc, 0x409c407a, 0x9107a265, 0xac97ac31, 0x000099a8, 0xd310d324, 0x32004362, 0x4dbb4d42, 0x00002786,
+        0xddc5dddb, 0xa75104c8, 0xdda5dd5d, 0x00009de0, 0x9bd49bb1, 0x4f36cdee, 0x860a86bf, 0x00005ab6, 0xedeeedbd, 0x38d06ac9, 0x31683129, 0x0000a0c6,
+        0x1442142d, 0x10aaa40c, 0xc529c511, 0x000020a4, 0x1c2e1cac, 0x76448ebf, 0xc7d9c7cc, 0x0000bb0c, 0x203b2058, 0x53a7e607, 0xb93ab996, 0x00009c85,
+        0xc00ec030, 0xeeac2804, 0x552c55ec, 0x0000a255
+    };
+}
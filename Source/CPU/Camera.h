@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CPU/Ray.h"
+
+namespace CPU
+{
+    // Pinhole camera producing the same matrices D3DRTWindow::UpdateCameraBuffer
+    // uploads (view, projection and their inverses) and the same primary rays
+    // as RayGen.hlsl
+    struct Camera
+    {
+        float3 eye = float3(1.5f, 1.5f, 1.5f);
+        float3 center = float3(0.0f, 0.0f, 0.0f);
+        float3 up = float3(0.0f, 1.0f, 0.0f);
+        float fovAngleY = 45.0f * PI / 180.0f;
+        float nearZ = 0.1f;
+        float farZ = 1000.0f;
+
+        float4x4 view;
+        float4x4 projection;
+        float4x4 viewI;
+        float4x4 projectionI;
+
+        void Update(float aspectRatio)
+        {
+            view = LookAtRH(eye, center, up);
+            projection = PerspectiveFovRH(fovAngleY, aspectRatio, nearZ, farZ);
+            viewI = Inverse(view);
+            projectionI = Inverse(projection);
+        }
+
+        // pixel is the (sub)pixel position in [0, width) x [0, height), the
+        // RayGen shader uses launchIndex + 0.5
+        Ray GenerateRay(const float2& pixel, uint32_t width, uint32_t height) const
+        {
+            float2 d = float2(pixel.x / width, pixel.y / height) * 2.0f - float2(1.0f);
+
+            Ray ray;
+            ray.origin = mul(viewI, float4(0, 0, 0, 1)).xyz();
+            float4 dir = mul(projectionI, float4(d.x, -d.y, 1, 1));
+            ray.direction = normalize(mul(viewI, float4(dir.xyz(), 0)).xyz());
+            ray.tMin = 0.0f;
+            ray.tMax = 100000.0f;
+            return ray;
+        }
+    };
+}
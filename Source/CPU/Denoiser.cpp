@@ -0,0 +1,437 @@
+#include "CPU/Denoiser.h"
+#include <algorithm>
+#include <cmath>
+#include "CPU/Simd.h"
+
+namespace CPU
+{
+    namespace
+    {
+        // B3 spline of the a-trous transform, and the 3x3 Gaussian that
+        // smooths the variance before it stops the luminance
+        const float kKernel[5] = { 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+        const float kGaussian[3] = { 0.25f, 0.5f, 0.25f };
+        const float kLog2e = 1.4426950409f;
+        const float kDepthEpsilon = 1e-3f;
+        const float kLuminanceEpsilon = 1e-10f;
+
+        // Everything one pass reads and writes, planes are indexed
+        // y * stride + border + x
+        struct FilterArgs
+        {
+            const float* color[3];
+            const float* variance;
+            const float* normal[3];
+            const float* depth;
+            const float* depthGradient;
+            float* outColor[3];
+            float* outVariance;
+            uint32_t stride;
+            uint32_t border;
+            uint32_t height;
+            int step;
+            uint32_t normalSquarings;
+            float sigmaDepth;
+            float sigmaLuminance;
+        };
+
+        template <class V>
+        inline V Abs(const V& a)
+        {
+            return Max(a, -a);
+        }
+
+        template <class V>
+        inline V LuminanceLanes(const V& r, const V& g, const V& b)
+        {
+            return r * 0.2126f + g * 0.7152f + b * 0.0722f;
+        }
+
+        // One row of a pass from x0 on, V::Width pixels at a time. Lanes past
+        // x1 land in the border or the padding and are never read back.
+        template <class V>
+        void FilterRow(const FilterArgs& a, uint32_t y, uint32_t x0, uint32_t x1)
+        {
+            const int height = int(a.height);
+            for (uint32_t x = x0; x < x1; x += V::Width)
+            {
+                const size_t p = size_t(y) * a.stride + a.border + x;
+                const V r = V::Load(a.color[0] + p);
+                const V g = V::Load(a.color[1] + p);
+                const V b = V::Load(a.color[2] + p);
+                const V nx = V::Load(a.normal[0] + p);
+                const V ny = V::Load(a.normal[1] + p);
+                const V nz = V::Load(a.normal[2] + p);
+                const V z = V::Load(a.depth + p);
+                const V depthScale = V::Load(a.depthGradient + p) * a.sigmaDepth;
+                const V luminance = LuminanceLanes(r, g, b);
+
+                V blurredVariance(0.0f);
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const size_t row = size_t(std::clamp(int(y) + dy, 0, height - 1)) * a.stride + a.border + x;
+                    for (int dx = -1; dx <= 1; ++dx)
+                        blurredVariance = blurredVariance + V::Load(a.variance + row + dx) * (kGaussian[dx + 1] * kGaussian[dy + 1]);
+                }
+                const V luminanceScale = V(-kLog2e) / (Sqrt(Max(blurredVariance, V(0.0f))) * a.sigmaLuminance + kLuminanceEpsilon);
+
+                // Taps are 1 to 4 steps away (Manhattan), one division each
+                V depthScales[4];
+                for (int d = 0; d < 4; ++d)
+                    depthScales[d] = V(-kLog2e) / (depthScale * float(a.step * (d + 1)) + kDepthEpsilon);
+
+                // The center always counts in full, its normal is 0 on the sky
+                const float centerWeight = kKernel[2] * kKernel[2];
+                V weightSum(centerWeight);
+                V sumR = r * centerWeight;
+                V sumG = g * centerWeight;
+                V sumB = b * centerWeight;
+                V sumVariance = V::Load(a.variance + p) * (centerWeight * centerWeight);
+
+                for (int dy = -2; dy <= 2; ++dy)
+                {
+                    const int qy = int(y) + dy * a.step;
+                    if (qy < 0 || qy >= height)
+                        continue;
+                    for (int dx = -2; dx <= 2; ++dx)
+                    {
+                        if (dx == 0 && dy == 0)
+                            continue;
+                        const size_t q = size_t(qy) * a.stride + a.border + x + dx * a.step;
+
+                        // cos^sigmaNormal by squaring, the border and the sky have no normal
+                        V cosine = Max(nx * V::Load(a.normal[0] + q) + ny * V::Load(a.normal[1] + q) + nz * V::Load(a.normal[2] + q), V(0.0f));
+                        for (uint32_t i = 0; i < a.normalSquarings; ++i)
+                            cosine = cosine * cosine;
+
+                        const V qr = V::Load(a.color[0] + q);
+                        const V qg = V::Load(a.color[1] + q);
+                        const V qb = V::Load(a.color[2] + q);
+                        const V depthTerm = Abs(z - V::Load(a.depth + q)) * depthScales[std::abs(dx) + std::abs(dy) - 1];
+                        const V luminanceTerm = Abs(luminance - LuminanceLanes(qr, qg, qb)) * luminanceScale;
+                        const V weight = cosine * Exp2(luminanceTerm + depthTerm) * (kKernel[dx + 2] * kKernel[dy + 2]);
+
+                        weightSum = weightSum + weight;
+                        sumR = sumR + qr * weight;
+                        sumG = sumG + qg * weight;
+                        sumB = sumB + qb * weight;
+                        sumVariance = sumVariance + V::Load(a.variance + q) * (weight * weight);
+                    }
+                }
+
+                const V invWeight = V(1.0f) / weightSum;
+                (sumR * invWeight).Store(a.outColor[0] + p);
+                (sumG * invWeight).Store(a.outColor[1] + p);
+                (sumB * invWeight).Store(a.outColor[2] + p);
+                (sumVariance * invWeight * invWeight).Store(a.outVariance + p);
+            }
+        }
+
+        // Same math one pixel at a time, the reference of the lane kernels
+        void FilterRowScalar(const FilterArgs& a, uint32_t y, uint32_t x0, uint32_t x1)
+        {
+            const int height = int(a.height);
+            for (uint32_t x = x0; x < x1; ++x)
+            {
+                const size_t p = size_t(y) * a.stride + a.border + x;
+                const float3 c(a.color[0][p], a.color[1][p], a.color[2][p]);
+                const float3 n(a.normal[0][p], a.normal[1][p], a.normal[2][p]);
+                const float z = a.depth[p];
+                const float depthScale = a.depthGradient[p] * a.sigmaDepth;
+                const float luminance = Luminance(c);
+
+                float blurredVariance = 0.0f;
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const size_t row = size_t(std::clamp(int(y) + dy, 0, height - 1)) * a.stride + a.border + x;
+                    for (int dx = -1; dx <= 1; ++dx)
+                        blurredVariance += a.variance[row + dx] * kGaussian[dx + 1] * kGaussian[dy + 1];
+                }
+                const float luminanceScale = 1.0f / (std::sqrt(std::max(blurredVariance, 0.0f)) * a.sigmaLuminance + kLuminanceEpsilon);
+
+                const float centerWeight = kKernel[2] * kKernel[2];
+                float weightSum = centerWeight;
+                float3 sum = c * centerWeight;
+                float sumVariance = a.variance[p] * centerWeight * centerWeight;
+
+                for (int dy = -2; dy <= 2; ++dy)
+                {
+                    const int qy = int(y) + dy * a.step;
+                    if (qy < 0 || qy >= height)
+                        continue;
+                    for (int dx = -2; dx <= 2; ++dx)
+                    {
+                        if (dx == 0 && dy == 0)
+                            continue;
+                        const size_t q = size_t(qy) * a.stride + a.border + x + dx * a.step;
+
+                        float cosine = std::max(dot(n, float3(a.normal[0][q], a.normal[1][q], a.normal[2][q])), 0.0f);
+                        for (uint32_t i = 0; i < a.normalSquarings; ++i)
+                            cosine *= cosine;
+
+                        const float3 qc(a.color[0][q], a.color[1][q], a.color[2][q]);
+                        const float distance = float(a.step * (std::abs(dx) + std::abs(dy)));
+                        const float depthTerm = std::abs(z - a.depth[q]) / (depthScale * distance + kDepthEpsilon);
+                        const float luminanceTerm = std::abs(luminance - Luminance(qc)) * luminanceScale;
+                        const float weight = cosine * std::exp(-(depthTerm + luminanceTerm)) * kKernel[dx + 2] * kKernel[dy + 2];
+
+                        weightSum += weight;
+                        sum += qc * weight;
+                        sumVariance += a.variance[q] * weight * weight;
+                    }
+                }
+
+                a.outColor[0][p] = sum.x / weightSum;
+                a.outColor[1][p] = sum.y / weightSum;
+                a.outColor[2][p] = sum.z / weightSum;
+                a.outVariance[p] = sumVariance / (weightSum * weightSum);
+            }
+        }
+
+        inline uint32_t RoundUp8(uint32_t x)
+        {
+            return (x + 7) & ~7u;
+        }
+    }
+
+    // SoA planes with a zero border: normals of 0 give the border taps no
+    // weight, so the kernels need no bounds checks along x
+    struct Denoiser::Planes
+    {
+        std::vector<float> color[2][3];     // demodulated, ping-pong between passes
+        std::vector<float> variance[2];
+        std::vector<float> normal[3];
+        std::vector<float> depth;
+        std::vector<float> depthGradient;
+    };
+
+    Denoiser::Denoiser(const DenoiserSettings& settings)
+        : m_settings(settings), m_scheduler(settings.threadCount), m_planes(std::make_unique<Planes>())
+    {
+        m_settings.threadCount = m_scheduler.GetThreadCount();
+        m_settings.iterations = std::clamp(m_settings.iterations, 1u, 10u);
+        m_settings.tileSize = RoundUp8(std::max(8u, m_settings.tileSize));
+        m_settings.simdWidth = std::min(m_settings.simdWidth, GetMaxSimdWidth());
+        m_normalSquarings = static_cast<uint32_t>(std::lround(std::log2(std::max(1.0f, m_settings.sigmaNormal))));
+    }
+
+    Denoiser::~Denoiser()
+    {
+    }
+
+    void Denoiser::Resize(uint32_t width, uint32_t height)
+    {
+        if (width == m_width && height == m_height)
+            return;
+
+        // The widest pass reaches 2 << (iterations - 1) pixels out, the
+        // vector loads of the last group of a row up to 7 more
+        m_width = width;
+        m_height = height;
+        m_border = RoundUp8(1u << m_settings.iterations);
+        m_stride = m_border + RoundUp8(width) + m_border;
+        m_tiles = CreateTiles(width, height, m_settings.tileSize, TileOrder::Scanline);
+
+        const size_t size = size_t(m_stride) * height;
+        for (int i = 0; i < 2; ++i)
+        {
+            for (std::vector<float>& plane : m_planes->color[i])
+                plane.assign(size, 0.0f);
+            m_planes->variance[i].assign(size, 0.0f);
+        }
+        for (std::vector<float>& plane : m_planes->normal)
+            plane.assign(size, 0.0f);
+        m_planes->depth.assign(size, 0.0f);
+        m_planes->depthGradient.assign(size, 0.0f);
+    }
+
+    void Denoiser::Demodulate(const DenoiserInput& input, const Tile& tile)
+    {
+        Planes& planes = *m_planes;
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                const size_t i = size_t(y) * m_width + x;
+                const size_t p = size_t(y) * m_stride + m_border + x;
+                const float3 albedo = max(input.albedo[i], float3(1e-3f));
+                const float3 color = float3(input.color[i * 3], input.color[i * 3 + 1], input.color[i * 3 + 2]) / albedo;
+                const bool sky = !std::isfinite(input.depth[i]);
+
+                planes.color[0][0][p] = color.x;
+                planes.color[0][1][p] = color.y;
+                planes.color[0][2][p] = color.z;
+                planes.normal[0][p] = sky ? 0.0f : input.normal[i].x;
+                planes.normal[1][p] = sky ? 0.0f : input.normal[i].y;
+                planes.normal[2][p] = sky ? 0.0f : input.normal[i].z;
+                planes.depth[p] = sky ? 0.0f : input.depth[i];
+
+                // Negative marks the pixels EstimateVariance fills in
+                const float variance = input.variance[i];
+                const float albedoLuminance = std::max(Luminance(albedo), 1e-3f);
+                planes.variance[0][p] = variance < 0.0f ? -1.0f : variance / (albedoLuminance * albedoLuminance);
+            }
+        }
+    }
+
+    void Denoiser::PrepareGuides(const Tile& tile)
+    {
+        Planes& planes = *m_planes;
+        float* sums[3] = { planes.color[1][0].data(), planes.color[1][1].data(), planes.color[1][2].data() };
+        auto normalAt = [&](size_t p) { return float3(planes.normal[0][p], planes.normal[1][p], planes.normal[2][p]); };
+
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                const size_t p = size_t(y) * m_stride + m_border + x;
+                const float3 n = normalAt(p);
+                const float z = planes.depth[p];
+
+                // Largest depth change to a neighbour on the same surface,
+                // per pixel: the scale of the depth edge stop
+                float gradient = 0.0f;
+                const size_t neighbours[4] = { p - 1, p + 1, y > 0 ? p - m_stride : p, y + 1 < m_height ? p + m_stride : p };
+                for (size_t q : neighbours)
+                {
+                    if (dot(n, normalAt(q)) > 0.0f)
+                        gradient = std::max(gradient, std::abs(planes.depth[q] - z));
+                }
+                planes.depthGradient[p] = gradient;
+
+                // Horizontal half of the 7x7 luminance moments of
+                // EstimateVariance, over surface pixels only (the border
+                // and the sky have no normal)
+                float count = 0.0f;
+                float sum = 0.0f;
+                float sumSquares = 0.0f;
+                for (int dx = -3; dx <= 3; ++dx)
+                {
+                    const size_t q = p + dx;
+                    const float mask = planes.normal[0][q] != 0.0f || planes.normal[1][q] != 0.0f || planes.normal[2][q] != 0.0f ? 1.0f : 0.0f;
+                    const float l = Luminance(float3(planes.color[0][0][q], planes.color[0][1][q], planes.color[0][2][q])) * mask;
+                    count += mask;
+                    sum += l;
+                    sumSquares += l * l;
+                }
+                sums[0][p] = count;
+                sums[1][p] = sum;
+                sums[2][p] = sumSquares;
+            }
+        }
+    }
+
+    void Denoiser::EstimateVariance(const Tile& tile)
+    {
+        // Pixels with too few samples for a temporal estimate take the
+        // luminance variance of the 7x7 surface pixels around them
+        Planes& planes = *m_planes;
+        const float* sums[3] = { planes.color[1][0].data(), planes.color[1][1].data(), planes.color[1][2].data() };
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            const int y0 = std::max(int(y) - 3, 0);
+            const int y1 = std::min(int(y) + 3, int(m_height) - 1);
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                const size_t p = size_t(y) * m_stride + m_border + x;
+                if (planes.variance[0][p] >= 0.0f)
+                    continue;
+
+                float count = 0.0f;
+                float sum = 0.0f;
+                float sumSquares = 0.0f;
+                for (int qy = y0; qy <= y1; ++qy)
+                {
+                    const size_t q = size_t(qy) * m_stride + m_border + x;
+                    count += sums[0][q];
+                    sum += sums[1][q];
+                    sumSquares += sums[2][q];
+                }
+                const float mean = sum / std::max(count, 1.0f);
+                planes.variance[0][p] = std::max(0.0f, sumSquares / std::max(count, 1.0f) - mean * mean);
+            }
+        }
+    }
+
+    void Denoiser::Filter(uint32_t pass, const Tile& tile)
+    {
+        Planes& planes = *m_planes;
+        const uint32_t source = pass & 1;
+        const uint32_t target = source ^ 1;
+
+        FilterArgs args;
+        for (int c = 0; c < 3; ++c)
+        {
+            args.color[c] = planes.color[source][c].data();
+            args.outColor[c] = planes.color[target][c].data();
+            args.normal[c] = planes.normal[c].data();
+        }
+        args.variance = planes.variance[source].data();
+        args.outVariance = planes.variance[target].data();
+        args.depth = planes.depth.data();
+        args.depthGradient = planes.depthGradient.data();
+        args.stride = m_stride;
+        args.border = m_border;
+        args.height = m_height;
+        args.step = 1 << pass;
+        args.normalSquarings = m_normalSquarings;
+        args.sigmaDepth = m_settings.sigmaDepth;
+        args.sigmaLuminance = m_settings.sigmaLuminance;
+
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+#if defined(__AVX2__)
+            if (m_settings.simdWidth == SimdWidth::AVX2)
+            {
+                FilterRow<vfloat8>(args, y, tile.x0, tile.x1);
+                continue;
+            }
+#endif
+#if defined(D3DRT_SIMD_SSE)
+            if (m_settings.simdWidth == SimdWidth::SSE)
+            {
+                FilterRow<vfloat4>(args, y, tile.x0, tile.x1);
+                continue;
+            }
+#endif
+            FilterRowScalar(args, y, tile.x0, tile.x1);
+        }
+    }
+
+    void Denoiser::Denoise(const DenoiserInput& input, std::vector<float>& rgb)
+    {
+        Resize(input.width, input.height);
+        const uint32_t tileCount = static_cast<uint32_t>(m_tiles.size());
+        Planes& planes = *m_planes;
+
+        m_scheduler.Run(tileCount, [&](uint32_t tileIndex, uint32_t) { Demodulate(input, m_tiles[tileIndex]); });
+
+        // The vertical sums read the horizontal ones of the rows around
+        m_scheduler.Run(tileCount, [&](uint32_t tileIndex, uint32_t) { PrepareGuides(m_tiles[tileIndex]); });
+        m_scheduler.Run(tileCount, [&](uint32_t tileIndex, uint32_t) { EstimateVariance(m_tiles[tileIndex]); });
+
+        // Every pass reads the whole result of the previous one
+        for (uint32_t pass = 0; pass < m_settings.iterations; ++pass)
+            m_scheduler.Run(tileCount, [&](uint32_t tileIndex, uint32_t) { Filter(pass, m_tiles[tileIndex]); });
+
+        // Remodulate
+        const uint32_t result = m_settings.iterations & 1;
+        rgb.resize(size_t(m_width) * m_height * 3);
+        m_scheduler.Run(tileCount, [&](uint32_t tileIndex, uint32_t)
+            {
+                const Tile& tile = m_tiles[tileIndex];
+                for (uint32_t y = tile.y0; y < tile.y1; ++y)
+                {
+                    for (uint32_t x = tile.x0; x < tile.x1; ++x)
+                    {
+                        const size_t i = size_t(y) * m_width + x;
+                        const size_t p = size_t(y) * m_stride + m_border + x;
+                        const float3 albedo = max(input.albedo[i], float3(1e-3f));
+                        rgb[i * 3 + 0] = planes.color[result][0][p] * albedo.x;
+                        rgb[i * 3 + 1] = planes.color[result][1][p] * albedo.y;
+                        rgb[i * 3 + 2] = planes.color[result][2][p] * albedo.z;
+                    }
+                }
+            });
+    }
+}
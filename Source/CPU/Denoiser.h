@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "CPU/DisneySIMD.h"
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    struct DenoiserSettings
+    {
+        uint32_t iterations = 5;            // a-trous passes, taps 1, 2, 4, ... pixels apart
+        float sigmaLuminance = 4.0f;        // luminance edge stop, in standard deviations
+        float sigmaNormal = 128.0f;         // exponent of the normal cosine, rounded to a power of two
+        float sigmaDepth = 1.0f;            // depth edge stop, in depth gradients over the tap distance
+
+        uint32_t threadCount = 0;           // 0 = all hardware threads
+        uint32_t tileSize = 64;             // rounded up to a multiple of 8 pixels
+        SimdWidth simdWidth = SimdWidth::AVX2;  // clamped to the build
+    };
+
+    // A noisy frame and the features of its first hits, row major. The
+    // features are noise free (pixel center camera rays), the variance
+    // comes from the samples accumulated over the frames.
+    struct DenoiserInput
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        const float* color = nullptr;       // mean radiance, rgb (PathTracer::ResolveHDR)
+        const float* variance = nullptr;    // of the mean luminance, negative if unknown (PathTracer::ResolveVariance)
+        const float3* albedo = nullptr;     // PathTracer::RenderFeatures
+        const float3* normal = nullptr;     // 0 on the sky
+        const float* depth = nullptr;       // INFINITY on the sky
+    };
+
+    // Edge-avoiding a-trous wavelet filter of SVGF (Schied et al. 2017).
+    // The color is divided by the albedo so textures and material colors are
+    // not blurred, then filtered by iterations of a 5x5 B-spline kernel with
+    // growing holes. A tap is weighted down by the difference of its normal,
+    // its depth and its luminance, the last relative to the standard
+    // deviation of the pixel, so noisy pixels are smoothed harder than
+    // converged ones; the variance is filtered along to shrink with every
+    // pass. Pixels without a variance estimate (too few samples) take the
+    // luminance variance of the surface pixels in their 7x7 neighbourhood.
+    //
+    // Planes are stored SoA with a zero border so the kernels run vfloat8 /
+    // vfloat4 wide without edge cases; each pass is spread over the threads
+    // in tiles.
+    class Denoiser
+    {
+    public:
+        explicit Denoiser(const DenoiserSettings& settings = DenoiserSettings());
+        ~Denoiser();
+
+        // rgb has the layout of input.color
+        void Denoise(const DenoiserInput& input, std::vector<float>& rgb);
+
+        const DenoiserSettings& GetSettings() const { return m_settings; }
+
+    private:
+        struct Planes;
+
+        void Resize(uint32_t width, uint32_t height);
+        void Demodulate(const DenoiserInput& input, const Tile& tile);
+        void PrepareGuides(const Tile& tile);
+        void EstimateVariance(const Tile& tile);
+        void Filter(uint32_t pass, const Tile& tile);
+
+        DenoiserSettings m_settings;
+        TileScheduler m_scheduler;
+        std::vector<Tile> m_tiles;
+        std::unique_ptr<Planes> m_planes;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint32_t m_border = 0;
+        uint32_t m_stride = 0;
+        uint32_t m_normalSquarings = 0;
+    };
+}
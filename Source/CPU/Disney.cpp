@@ -0,0 +1,153 @@
+#include "CPU/Disney.h"
+
+namespace CPU
+{
+    float SchlickFresnel(float u)
+    {
+        float m = clamp(1 - u, 0, 1);
+        float m2 = m * m;
+        return m2 * m2 * m; // pow(m,5)
+    }
+
+    float GTR1(float NdotH, float a)
+    {
+        if (a >= 1)
+            return 1 / PI;
+        float a2 = a * a;
+        float t = 1 + (a2 - 1) * NdotH * NdotH;
+        return (a2 - 1) / (PI * std::log(a2) * t);
+    }
+
+    float GTR2(float NdotH, float a)
+    {
+        float a2 = a * a;
+        float t = 1 + (a2 - 1) * NdotH * NdotH;
+        return a2 / (PI * t * t);
+    }
+
+    float smithG_GGX(float NdotV, float alphaG)
+    {
+        float a = alphaG * alphaG;
+        float b = NdotV * NdotV;
+        return 1 / (NdotV + std::sqrt(a + b - a * b));
+    }
+
+    float3 Disney_BRDF_Sample(const Material& material, const float2& seed, float seed1,
+        const float3& V, const float3& N, const float3& T, const float3& B, float& pdf)
+    {
+        float alpha_GTR1 = lerp(0.1f, 0.001f, material.clearcoatGloss);
+        float alpha_GTR2 = std::max(0.001f, material.roughness * material.roughness);
+
+        float r_diffuse = (1.0f - material.metallic);
+        float r_specular = 1.f;
+        float r_clearcoat = 0.25f * material.clearcoat;
+        float r_sum = r_diffuse + r_specular + r_clearcoat;
+
+        float p_diffuse = r_diffuse / r_sum;
+        float p_specular = r_specular / r_sum;
+
+        TBNFrame TBN = { T, B, N };
+
+        float3 L;
+
+        if (seed1 <= p_diffuse)
+        {
+            L = cosineHemisphereSample(TBN, seed);
+        }
+        else if (seed1 <= p_diffuse + p_specular)
+        {
+            L = GTR2Sample(TBN, seed, alpha_GTR2, V);
+        }
+        else
+        {
+            L = GTR1Sample(TBN, seed, alpha_GTR1, V);
+        }
+
+        pdf = Disney_BRDF_Pdf(material, L, V, N);
+
+        return L;
+    }
+
+    float Disney_BRDF_Pdf(const Material& material, const float3& L, const float3& V, const float3& N)
+    {
+        float alpha_GTR1 = lerp(0.1f, 0.001f, material.clearcoatGloss);
+        float alpha_GTR2 = std::max(0.001f, material.roughness * material.roughness);
+
+        float r_diffuse = (1.0f - material.metallic);
+        float r_specular = 1.f;
+        float r_clearcoat = 0.25f * material.clearcoat;
+        float r_sum = r_diffuse + r_specular + r_clearcoat;
+
+        float p_diffuse = r_diffuse / r_sum;
+        float p_specular = r_specular / r_sum;
+        float p_clearcoat = r_clearcoat / r_sum;
+
+        float NdotL = dot(N, L);
+        float3 H = normalize(L + V);
+        float NdotH = dot(N, H);
+        float LdotH = dot(L, H);
+
+        float Ds = GTR2(NdotH, alpha_GTR2);
+        float Dr = GTR1(NdotH, alpha_GTR1);
+
+        float pdf_diffuse = NdotL / PI;
+        float pdf_specular = (Ds * NdotH) / (4.0f * LdotH);
+        float pdf_clearcoat = (Dr * NdotH) / (4.0f * LdotH);
+
+        float pdf = p_diffuse * pdf_diffuse + p_specular * pdf_specular + p_clearcoat * pdf_clearcoat;
+
+        return std::max(1e-10f, pdf);
+    }
+
+    float3 Disney_BRDF(const Material& material, const float3& L, const float3& V, const float3& N)
+    {
+        float NdotL = dot(N, L);
+        float NdotV = dot(N, V);
+        if (NdotL < 0 || NdotV < 0)
+            return float3(0, 0, 0);
+
+        float3 H = normalize(L + V);
+        float NdotH = dot(N, H);
+        float LdotH = dot(L, H);
+
+        float3 Cdlin = material.baseColor;
+        float Cdlum = .3f * Cdlin.x + .6f * Cdlin.y + .1f * Cdlin.z; // luminance approx.
+        float3 Ctint = Cdlum > 0 ? Cdlin / Cdlum : float3(1, 1, 1); // normalize lum. to isolate hue+sat
+
+        float FL = SchlickFresnel(NdotL);
+        float FV = SchlickFresnel(NdotV);
+        float Fd90 = 0.5f + 2 * LdotH * LdotH * material.roughness;
+        float Fd = lerp(1.0f, Fd90, FL) * lerp(1.0f, Fd90, FV);
+
+        // subsurface scattering
+        float Fss90 = LdotH * LdotH * material.roughness;
+        float Fss = lerp(1.0f, Fss90, FL) * lerp(1.0f, Fss90, FV);
+        float ss = 1.25f * (Fss * (1.0f / (NdotL + NdotV) - 0.5f) + 0.5f);
+
+        float3 F_diffuse = lerp(Fd, ss, material.subsurface) * Cdlin / PI;
+
+        float3 Cspec = material.specular * lerp(float3(1, 1, 1), Ctint, material.specularTint);
+        float3 Cspec0 = lerp(0.08f * Cspec, Cdlin, material.metallic);
+
+        // Specular
+        float alpha = std::max(0.001f, material.roughness * material.roughness);
+        float Ds = GTR2(NdotH, alpha);
+        float FH = SchlickFresnel(LdotH);
+        float3 Fs = lerp(Cspec0, float3(1, 1, 1), FH);
+        float Gs = smithG_GGX(NdotL, material.roughness) * smithG_GGX(NdotV, material.roughness);
+        float3 F_specular = Ds * Fs * Gs; // don't need to / (4 * NdotL * NdotV)
+
+        // Clearcoat
+        float Dr = GTR1(NdotH, lerp(0.1f, 0.001f, material.clearcoatGloss));
+        float Fr = lerp(0.04f, 1.0f, FH);
+        float Gr = smithG_GGX(NdotL, 0.25f) * smithG_GGX(NdotV, 0.25f);
+        float3 F_clearcoat = float3(Dr * Fr * Gr);
+
+        // Sheen
+        float3 Csheen = lerp(float3(1, 1, 1), Ctint, material.sheenTint);
+        float3 Fsheen = FH * material.sheen * Csheen;
+        F_diffuse += Fsheen;
+
+        return F_diffuse * (1.0f - material.metallic) + F_specular + F_clearcoat * 0.25f * material.clearcoat;
+    }
+}
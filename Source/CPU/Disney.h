@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CPU/Sampling.h"
+#include "CPU/Scene.h"
+
+// C++ port of the Disney principled BRDF in Shaders/Raytracing/Hit.hlsl. The
+// material parameters come from a Material instead of the DisneyMaterialParams
+// cbuffer, everything else follows the shader.
+
+namespace CPU
+{
+    float SchlickFresnel(float u);
+    float GTR1(float NdotH, float a);
+    float GTR2(float NdotH, float a);
+    float smithG_GGX(float NdotV, float alphaG);
+
+    // seed for sample
+    // seed1 for choose diffuse or specular or clearcoat
+    float3 Disney_BRDF_Sample(const Material& material, const float2& seed, float seed1,
+        const float3& V, const float3& N, const float3& T, const float3& B, float& pdf);
+
+    // Pdf of Disney_BRDF_Sample returning L, the lobe mixture it evaluates
+    // after sampling
+    float Disney_BRDF_Pdf(const Material& material, const float3& L, const float3& V, const float3& N);
+
+    float3 Disney_BRDF(const Material& material, const float3& L, const float3& V, const float3& N);
+}
@@ -0,0 +1,390 @@
+#include "CPU/DisneySIMD.h"
+#include "CPU/Disney.h"
+#include "CPU/Simd.h"
+
+namespace CPU
+{
+    namespace
+    {
+        // Material terms of Disney_BRDF / Disney_BRDF_Sample, shared by all lanes
+        struct DisneyUniforms
+        {
+            float3 diffuseColor;        // Cdlin / PI
+            float3 Cspec0;
+            float3 sheenColor;          // sheen * Csheen
+            float roughness;
+            float subsurface;
+            float diffuseWeight;        // 1 - metallic
+            float clearcoatWeight;      // 0.25 * clearcoat
+
+            float alphaGTR2Sq;
+            float alphaGTR1Sq;
+            float log2AlphaGTR1Sq;
+            float GTR1Scale;            // (a2 - 1) / (PI * log(a2)), or 1 / PI for a >= 1
+            float GTR1Slope;            // a2 - 1, or 0 for a >= 1
+
+            float pDiffuse;
+            float pSpecular;
+            float pClearcoat;
+        };
+
+        DisneyUniforms ComputeUniforms(const Material& material)
+        {
+            DisneyUniforms u;
+
+            float3 Cdlin = material.baseColor;
+            float Cdlum = .3f * Cdlin.x + .6f * Cdlin.y + .1f * Cdlin.z;
+            float3 Ctint = Cdlum > 0 ? Cdlin / Cdlum : float3(1, 1, 1);
+            float3 Cspec = material.specular * lerp(float3(1, 1, 1), Ctint, material.specularTint);
+
+            u.diffuseColor = Cdlin / PI;
+            u.Cspec0 = lerp(0.08f * Cspec, Cdlin, material.metallic);
+            u.sheenColor = material.sheen * lerp(float3(1, 1, 1), Ctint, material.sheenTint);
+            u.roughness = material.roughness;
+            u.subsurface = material.subsurface;
+            u.diffuseWeight = 1.0f - material.metallic;
+            u.clearcoatWeight = 0.25f * material.clearcoat;
+
+            float alphaGTR2 = std::max(0.001f, material.roughness * material.roughness);
+            float alphaGTR1 = lerp(0.1f, 0.001f, material.clearcoatGloss);
+            u.alphaGTR2Sq = alphaGTR2 * alphaGTR2;
+            u.alphaGTR1Sq = alphaGTR1 * alphaGTR1;
+            u.log2AlphaGTR1Sq = std::log2(u.alphaGTR1Sq);
+            if (alphaGTR1 >= 1)
+            {
+                u.GTR1Scale = 1 / PI;
+                u.GTR1Slope = 0.0f;
+            }
+            else
+            {
+                u.GTR1Scale = (u.alphaGTR1Sq - 1) / (PI * std::log(u.alphaGTR1Sq));
+                u.GTR1Slope = u.alphaGTR1Sq - 1;
+            }
+
+            float r_diffuse = (1.0f - material.metallic);
+            float r_specular = 1.f;
+            float r_clearcoat = 0.25f * material.clearcoat;
+            float r_sum = r_diffuse + r_specular + r_clearcoat;
+            u.pDiffuse = r_diffuse / r_sum;
+            u.pSpecular = r_specular / r_sum;
+            u.pClearcoat = r_clearcoat / r_sum;
+            return u;
+        }
+
+        //-----------------------------------------------------------------------------
+        // Lane versions of the Disney.h / Sampling.h helpers
+        //-----------------------------------------------------------------------------
+
+        template <class V>
+        V SchlickFresnelV(const V& u)
+        {
+            V m = Min(Max(1.0f - u, V(0.0f)), V(1.0f));
+            V m2 = m * m;
+            return m2 * m2 * m;
+        }
+
+        template <class V>
+        V GTR1V(const V& NdotH, const DisneyUniforms& u)
+        {
+            return u.GTR1Scale / (1.0f + u.GTR1Slope * NdotH * NdotH);
+        }
+
+        template <class V>
+        V GTR2V(const V& NdotH, float a2)
+        {
+            V t = 1.0f + (a2 - 1) * NdotH * NdotH;
+            return a2 / (PI * t * t);
+        }
+
+        template <class V>
+        V smithG_GGXV(const V& NdotV, float alphaG)
+        {
+            float a = alphaG * alphaG;
+            V b = NdotV * NdotV;
+            return 1.0f / (NdotV + Sqrt(a + b - a * b));
+        }
+
+        template <class V>
+        vfloat3<V> Reflect(const vfloat3<V>& i, const vfloat3<V>& n)
+        {
+            return i + n * (-2.0f * dot(i, n));
+        }
+
+        template <class V>
+        vfloat3<V> ToNormalHemisphere(const vfloat3<V>& v, const vfloat3<V>& T, const vfloat3<V>& B, const vfloat3<V>& N)
+        {
+            return normalize(T * v.x + B * v.y + N * v.z);
+        }
+
+        // cosineHemisphereSample before the TBN transform
+        template <class V>
+        vfloat3<V> CosineHemisphereLocal(const V& u, const V& v)
+        {
+            V sinTheta, cosTheta;
+            SinCos2Pi(v, sinTheta, cosTheta);
+            V r = Sqrt(u);
+            V x = r * cosTheta;
+            V y = r * sinTheta;
+            return vfloat3<V>(x, y, Sqrt(Max(1.0f - x * x - y * y, V(0.0f))));
+        }
+
+        // cos_theta_h of GTR2Sample and GTR1Sample, pow(a2, 1 - v) as exp2
+        template <class V>
+        V GTR2CosTheta(const V& v, float alphaSq)
+        {
+            return Sqrt((1.0f - v) / (1.0f + (alphaSq - 1.0f) * v));
+        }
+
+        template <class V>
+        V GTR1CosTheta(const V& v, float alphaSq, float log2AlphaSq)
+        {
+            return Sqrt((1.0f - Exp2((1.0f - v) * log2AlphaSq)) / (1.0f - alphaSq));
+        }
+
+        // Half vector of GTR1Sample / GTR2Sample before the TBN transform
+        template <class V>
+        vfloat3<V> HalfVectorLocal(const V& u, const V& cosTheta)
+        {
+            V sinPhi, cosPhi;
+            SinCos2Pi(u, sinPhi, cosPhi);
+            V sinTheta = Sqrt(Max(1.0f - cosTheta * cosTheta, V(0.0f)));
+            return vfloat3<V>(sinTheta * cosPhi, sinTheta * sinPhi, cosTheta);
+        }
+
+        template <class V>
+        vfloat3<V> Load3(const float* const* in, uint32_t first)
+        {
+            return vfloat3<V>(V::Load(in[first]), V::Load(in[first + 1]), V::Load(in[first + 2]));
+        }
+
+        template <class V>
+        void Store3(const vfloat3<V>& v, float* const* out, uint32_t first)
+        {
+            v.x.Store(out[first]);
+            v.y.Store(out[first + 1]);
+            v.z.Store(out[first + 2]);
+        }
+
+        //-----------------------------------------------------------------------------
+        // Kernels, one group of V::Width lanes
+        //-----------------------------------------------------------------------------
+
+        // in: L, V, N; out: f
+        template <class V>
+        void DisneyBRDFLanes(const DisneyUniforms& u, const float* const* in, float* const* out)
+        {
+            vfloat3<V> L = Load3<V>(in, 0);
+            vfloat3<V> Vd = Load3<V>(in, 3);
+            vfloat3<V> N = Load3<V>(in, 6);
+
+            V NdotL = dot(N, L);
+            V NdotV = dot(N, Vd);
+            V valid = (NdotL >= 0.0f) & (NdotV >= 0.0f);
+
+            vfloat3<V> H = normalize(L + Vd);
+            V NdotH = dot(N, H);
+            V LdotH = dot(L, H);
+
+            V FL = SchlickFresnelV(NdotL);
+            V FV = SchlickFresnelV(NdotV);
+            V Fd90 = 0.5f + 2.0f * LdotH * LdotH * u.roughness;
+            V Fd = Lerp(V(1.0f), Fd90, FL) * Lerp(V(1.0f), Fd90, FV);
+
+            // subsurface scattering
+            V Fss90 = LdotH * LdotH * u.roughness;
+            V Fss = Lerp(V(1.0f), Fss90, FL) * Lerp(V(1.0f), Fss90, FV);
+            V ss = 1.25f * (Fss * (1.0f / (NdotL + NdotV) - 0.5f) + 0.5f);
+            V diffuse = Lerp(Fd, ss, V(u.subsurface));
+
+            // Specular
+            V Ds = GTR2V(NdotH, u.alphaGTR2Sq);
+            V FH = SchlickFresnelV(LdotH);
+            V Gs = smithG_GGXV(NdotL, u.roughness) * smithG_GGXV(NdotV, u.roughness);
+            V DsGs = Ds * Gs;
+
+            // Clearcoat
+            V Dr = GTR1V(NdotH, u);
+            V Fr = Lerp(V(0.04f), V(1.0f), FH);
+            V Gr = smithG_GGXV(NdotL, 0.25f) * smithG_GGXV(NdotV, 0.25f);
+            V clearcoat = Dr * Fr * Gr * u.clearcoatWeight;
+
+            for (int c = 0; c < 3; ++c)
+            {
+                V F_diffuse = diffuse * u.diffuseColor[c] + FH * u.sheenColor[c];
+                V F_specular = DsGs * Lerp(V(u.Cspec0[c]), V(1.0f), FH);
+                V f = F_diffuse * u.diffuseWeight + F_specular + clearcoat;
+                Select(valid, f, V(0.0f)).Store(out[c]);
+            }
+        }
+
+        // in: seedX, seedY, seed1, V, N, T, B; out: L, pdf
+        template <class V>
+        void DisneyBRDFSampleLanes(const DisneyUniforms& u, const float* const* in, float* const* out)
+        {
+            V seedX = V::Load(in[0]);
+            V seedY = V::Load(in[1]);
+            V seed1 = V::Load(in[2]);
+            vfloat3<V> Vd = Load3<V>(in, 3);
+            vfloat3<V> N = Load3<V>(in, 6);
+            vfloat3<V> T = Load3<V>(in, 9);
+            vfloat3<V> B = Load3<V>(in, 12);
+
+            // Every lane picks its own lobe, compute the local direction of
+            // each and transform once
+            V isDiffuse = seed1 <= u.pDiffuse;
+            V isSpecular = seed1 <= u.pDiffuse + u.pSpecular;
+
+            vfloat3<V> diffuseLocal = CosineHemisphereLocal(seedX, seedY);
+            V cosThetaH = Select(isSpecular, GTR2CosTheta(seedY, u.alphaGTR2Sq), GTR1CosTheta(seedY, u.alphaGTR1Sq, u.log2AlphaGTR1Sq));
+            vfloat3<V> halfLocal = HalfVectorLocal(seedX, cosThetaH);
+
+            vfloat3<V> W = ToNormalHemisphere(Select(isDiffuse, diffuseLocal, halfLocal), T, B, N);
+            vfloat3<V> L = Select(isDiffuse, W, Reflect(-Vd, W));
+
+            V NdotL = dot(N, L);
+            vfloat3<V> H = normalize(L + Vd);
+            V NdotH = dot(N, H);
+            V LdotH = dot(L, H);
+
+            V Ds = GTR2V(NdotH, u.alphaGTR2Sq);
+            V Dr = GTR1V(NdotH, u);
+
+            V pdf_diffuse = NdotL / PI;
+            V pdf_specular = (Ds * NdotH) / (4.0f * LdotH);
+            V pdf_clearcoat = (Dr * NdotH) / (4.0f * LdotH);
+
+            V pdf = u.pDiffuse * pdf_diffuse + u.pSpecular * pdf_specular + u.pClearcoat * pdf_clearcoat;
+
+            Store3(L, out, 0);
+            Max(pdf, V(1e-10f)).Store(out[3]);
+        }
+
+        // Runs kernel over count lanes. The tail is padded with copies of the
+        // last element in stack buffers, so arrays need no padding.
+        template <class V, uint32_t InCount, uint32_t OutCount, class Kernel>
+        void RunLanes(const float* const (&in)[InCount], float* const (&out)[OutCount], uint32_t count, const Kernel& kernel)
+        {
+            const uint32_t width = V::Width;
+            const float* laneIn[InCount];
+            float* laneOut[OutCount];
+
+            uint32_t i = 0;
+            for (; i + width <= count; i += width)
+            {
+                for (uint32_t k = 0; k < InCount; ++k)
+                    laneIn[k] = in[k] + i;
+                for (uint32_t k = 0; k < OutCount; ++k)
+                    laneOut[k] = out[k] + i;
+                kernel(laneIn, laneOut);
+            }
+            if (i == count)
+                return;
+
+            float inTail[InCount][V::Width];
+            float outTail[OutCount][V::Width];
+            for (uint32_t k = 0; k < InCount; ++k)
+            {
+                for (uint32_t lane = 0; lane < width; ++lane)
+                    inTail[k][lane] = in[k][std::min(i + lane, count - 1)];
+                laneIn[k] = inTail[k];
+            }
+            for (uint32_t k = 0; k < OutCount; ++k)
+                laneOut[k] = outTail[k];
+
+            kernel(laneIn, laneOut);
+
+            for (uint32_t k = 0; k < OutCount; ++k)
+            {
+                for (uint32_t lane = 0; i + lane < count; ++lane)
+                    out[k][i + lane] = outTail[k][lane];
+            }
+        }
+
+        template <class V>
+        void RunDisneyBRDF(const DisneyUniforms& u, const float3SoA& L, const float3SoA& V_, const float3SoA& N, const float3SoA& f, uint32_t count)
+        {
+            const float* in[9] = { L.x, L.y, L.z, V_.x, V_.y, V_.z, N.x, N.y, N.z };
+            float* const out[3] = { f.x, f.y, f.z };
+            RunLanes<V>(in, out, count, [&](const float* const* laneIn, float* const* laneOut) { DisneyBRDFLanes<V>(u, laneIn, laneOut); });
+        }
+
+        template <class V>
+        void RunDisneyBRDFSample(const DisneyUniforms& u, const float* seedX, const float* seedY, const float* seed1,
+            const float3SoA& V_, const float3SoA& N, const float3SoA& T, const float3SoA& B, const float3SoA& L, float* pdf, uint32_t count)
+        {
+            const float* in[15] = { seedX, seedY, seed1, V_.x, V_.y, V_.z, N.x, N.y, N.z, T.x, T.y, T.z, B.x, B.y, B.z };
+            float* const out[4] = { L.x, L.y, L.z, pdf };
+            RunLanes<V>(in, out, count, [&](const float* const* laneIn, float* const* laneOut) { DisneyBRDFSampleLanes<V>(u, laneIn, laneOut); });
+        }
+
+        inline float3 Load(const float3SoA& v, uint32_t i)
+        {
+            return float3(v.x[i], v.y[i], v.z[i]);
+        }
+
+        inline void Store(const float3SoA& v, uint32_t i, const float3& value)
+        {
+            v.x[i] = value.x;
+            v.y[i] = value.y;
+            v.z[i] = value.z;
+        }
+    }
+
+    SimdWidth GetMaxSimdWidth()
+    {
+#if defined(__AVX2__)
+        return SimdWidth::AVX2;
+#elif defined(D3DRT_SIMD_SSE)
+        return SimdWidth::SSE;
+#else
+        return SimdWidth::Scalar;
+#endif
+    }
+
+    const char* ToString(SimdWidth width)
+    {
+        switch (width)
+        {
+        case SimdWidth::AVX2: return "avx2";
+        case SimdWidth::SSE: return "sse";
+        default: return "scalar";
+        }
+    }
+
+    void Disney_BRDF_SoA(const Material& material, const float3SoA& L, const float3SoA& V, const float3SoA& N,
+        const float3SoA& f, uint32_t count, SimdWidth width)
+    {
+        width = std::min(width, GetMaxSimdWidth());
+#if defined(__AVX2__)
+        if (width == SimdWidth::AVX2)
+            return RunDisneyBRDF<vfloat8>(ComputeUniforms(material), L, V, N, f, count);
+#endif
+#if defined(D3DRT_SIMD_SSE)
+        if (width == SimdWidth::SSE)
+            return RunDisneyBRDF<vfloat4>(ComputeUniforms(material), L, V, N, f, count);
+#endif
+        for (uint32_t i = 0; i < count; ++i)
+            Store(f, i, Disney_BRDF(material, Load(L, i), Load(V, i), Load(N, i)));
+    }
+
+    void Disney_BRDF_Sample_SoA(const Material& material, const float* seedX, const float* seedY, const float* seed1,
+        const float3SoA& V, const float3SoA& N, const float3SoA& T, const float3SoA& B,
+        const float3SoA& L, float* pdf, uint32_t count, SimdWidth width)
+    {
+        width = std::min(width, GetMaxSimdWidth());
+#if defined(__AVX2__)
+        if (width == SimdWidth::AVX2)
+            return RunDisneyBRDFSample<vfloat8>(ComputeUniforms(material), seedX, seedY, seed1, V, N, T, B, L, pdf, count);
+#endif
+#if defined(D3DRT_SIMD_SSE)
+        if (width == SimdWidth::SSE)
+            return RunDisneyBRDFSample<vfloat4>(ComputeUniforms(material), seedX, seedY, seed1, V, N, T, B, L, pdf, count);
+#endif
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            float3 l = Disney_BRDF_Sample(material, float2(seedX[i], seedY[i]), seed1[i],
+                Load(V, i), Load(N, i), Load(T, i), Load(B, i), pdf[i]);
+            Store(L, i, l);
+        }
+    }
+}
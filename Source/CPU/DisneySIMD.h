@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include "CPU/Scene.h"
+
+// Structure of arrays versions of Disney_BRDF and Disney_BRDF_Sample for
+// batches of rays that share one material, which is what the material sorted
+// wavefront shading stage hands out. Everything that only depends on the
+// material (tints, alphas, the log of GTR1, lobe probabilities) is computed
+// once per batch; per ray there is only arithmetic, sqrt and polynomial
+// sin / cos / exp2, run 8 wide (AVX2) or 4 wide (SSE2).
+
+namespace CPU
+{
+    enum class SimdWidth
+    {
+        Scalar = 1,     // loops over Disney_BRDF / Disney_BRDF_Sample, the reference
+        SSE = 4,
+        AVX2 = 8,
+    };
+
+    // Widest kernel compiled into this build
+    SimdWidth GetMaxSimdWidth();
+    const char* ToString(SimdWidth width);
+
+    // count float3 stored as three float arrays
+    struct float3SoA
+    {
+        float* x;
+        float* y;
+        float* z;
+    };
+
+    // Storage behind a float3SoA
+    struct float3Array
+    {
+        std::vector<float> x, y, z;
+
+        void Resize(uint32_t count) { x.resize(count); y.resize(count); z.resize(count); }
+        void Set(uint32_t i, const float3& v) { x[i] = v.x; y[i] = v.y; z[i] = v.z; }
+        float3 Get(uint32_t i) const { return float3(x[i], y[i], z[i]); }
+        float3SoA SoA(uint32_t offset = 0) { return { x.data() + offset, y.data() + offset, z.data() + offset }; }
+    };
+
+    // f[i] = Disney_BRDF(material, L[i], V[i], N[i]). Lanes with NdotL < 0 or
+    // NdotV < 0 are masked to 0, like the early-out of the scalar version.
+    void Disney_BRDF_SoA(const Material& material, const float3SoA& L, const float3SoA& V, const float3SoA& N,
+        const float3SoA& f, uint32_t count, SimdWidth width);
+
+    // L[i] = Disney_BRDF_Sample(material, seed[i], seed1[i], V[i], N[i], T[i], B[i], pdf[i]).
+    // The lobe choice is per lane: all three lobes are sampled and selected.
+    void Disney_BRDF_Sample_SoA(const Material& material, const float* seedX, const float* seedY, const float* seed1,
+        const float3SoA& V, const float3SoA& N, const float3SoA& T, const float3SoA& B,
+        const float3SoA& L, float* pdf, uint32_t count, SimdWidth width);
+}
@@ -0,0 +1,119 @@
+#include "CPU/EnvironmentMap.h"
+#include <algorithm>
+#include <cmath>
+#include "CPU/Image.h"
+
+namespace CPU
+{
+    namespace
+    {
+        const float kOneMinusEpsilon = 0x1.fffffep-1f;
+        const uint32_t kRowsPerTask = 16;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // EnvironmentMap
+    //
+    void EnvironmentMap::Load(const std::string& path, float scale, TileScheduler* scheduler)
+    {
+        uint32_t width, height;
+        std::vector<float> rgb;
+        ReadImageHDR(path, width, height, rgb);
+        if (scale != 1.0f)
+        {
+            for (float& v : rgb)
+                v *= scale;
+        }
+        Create(width, height, std::move(rgb), scheduler);
+    }
+
+    void EnvironmentMap::Create(uint32_t width, uint32_t height, std::vector<float>&& rgb, TileScheduler* scheduler)
+    {
+        m_width = width;
+        m_height = height;
+        m_rgb = std::move(rgb);
+
+        // Luminance weighted by the solid angle of the texel row
+        std::vector<float> weights(size_t(width) * height);
+        auto weighRows = [&](uint32_t first, uint32_t last) {
+            for (uint32_t y = first; y < last; ++y)
+            {
+                float sinTheta = std::sin(PI * (y + 0.5f) / height);
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    const float* texel = &m_rgb[3 * (size_t(y) * width + x)];
+                    weights[size_t(y) * width + x] = Luminance(float3(texel[0], texel[1], texel[2])) * sinTheta;
+                }
+            }
+        };
+        if (scheduler)
+        {
+            scheduler->Run((height + kRowsPerTask - 1) / kRowsPerTask, [&](uint32_t task, uint32_t)
+            {
+                weighRows(task * kRowsPerTask, std::min(height, (task + 1) * kRowsPerTask));
+            });
+        }
+        else
+        {
+            weighRows(0, height);
+        }
+        m_texels.Build(weights, scheduler);
+    }
+
+    float2 EnvironmentMap::DirectionToUV(const float3& direction) const
+    {
+        float u = 0.5f + std::atan2(direction.x, -direction.z) / PI2;
+        float v = std::acos(clamp(direction.y, -1.0f, 1.0f)) / PI;
+        return float2(std::min(std::max(u, 0.0f), kOneMinusEpsilon), std::min(v, kOneMinusEpsilon));
+    }
+
+    float3 EnvironmentMap::Eval(const float3& direction) const
+    {
+        float2 uv = DirectionToUV(direction);
+        uint32_t x = std::min(static_cast<uint32_t>(uv.x * m_width), m_width - 1);
+        uint32_t y = std::min(static_cast<uint32_t>(uv.y * m_height), m_height - 1);
+        const float* texel = &m_rgb[3 * (size_t(y) * m_width + x)];
+        return float3(texel[0], texel[1], texel[2]);
+    }
+
+    bool EnvironmentMap::Sample(const float2& u, float3& direction, float3& radiance, float& pdf) const
+    {
+        if (m_texels.IsEmpty())
+            return false;
+
+        // What is left of u after picking the texel places the sample in it
+        float2 offset;
+        uint32_t texel = m_texels.Sample(u, offset);
+        uint32_t x = texel % m_width;
+        uint32_t y = texel / m_width;
+        float2 uv(std::min((x + offset.x) / m_width, kOneMinusEpsilon), std::min((y + offset.y) / m_height, kOneMinusEpsilon));
+        float uvPdf = m_texels.Pmf(texel) * float(m_width) * float(m_height);
+
+        float phi = (uv.x - 0.5f) * PI2;
+        float theta = uv.y * PI;
+        float sinTheta = std::sin(theta);
+        if (uvPdf == 0.0f || sinTheta == 0.0f)
+            return false;
+
+        direction = float3(sinTheta * std::sin(phi), std::cos(theta), -sinTheta * std::cos(phi));
+        // uv -> solid angle: d(omega) = 2 pi^2 sin(theta) du dv
+        pdf = uvPdf / (2.0f * PI * PI * sinTheta);
+        radiance = Eval(direction);
+        return true;
+    }
+
+    float EnvironmentMap::Pdf(const float3& direction) const
+    {
+        if (m_texels.IsEmpty())
+            return 0.0f;
+        float2 uv = DirectionToUV(direction);
+        float sinTheta = std::sin(uv.y * PI);
+        if (sinTheta == 0.0f)
+            return 0.0f;
+        uint32_t x = std::min(static_cast<uint32_t>(uv.x * m_width), m_width - 1);
+        uint32_t y = std::min(static_cast<uint32_t>(uv.y * m_height), m_height - 1);
+        float uvPdf = m_texels.Pmf(y * m_width + x) * float(m_width) * float(m_height);
+        return uvPdf / (2.0f * PI * PI * sinTheta);
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "CPU/AliasTable.h"
+#include "CPU/TileScheduler.h"
+#include "CPU/VectorMath.h"
+
+namespace CPU
+{
+    // Latitude-longitude HDR environment seen by rays that leave the scene,
+    // in place of the Miss.hlsl gradient. v = 0 is straight up (+y), u turns
+    // around y starting at -z. Texels are looked up without filtering so
+    // the radiance is exactly the piecewise constant function the sampling
+    // distribution (luminance * sin(theta)) follows.
+    class EnvironmentMap
+    {
+    public:
+        // Throws std::runtime_error if the image cannot be read. The
+        // sampling distribution is built over scheduler, or on the calling
+        // thread without one.
+        void Load(const std::string& path, float scale = 1.0f, TileScheduler* scheduler = nullptr);
+        void Create(uint32_t width, uint32_t height, std::vector<float>&& rgb, TileScheduler* scheduler = nullptr);
+
+        bool IsEmpty() const { return m_width == 0; }
+        uint32_t GetWidth() const { return m_width; }
+        uint32_t GetHeight() const { return m_height; }
+
+        float3 Eval(const float3& direction) const;
+
+        // Direction towards the environment, its radiance and the solid
+        // angle pdf. False for a black environment.
+        bool Sample(const float2& u, float3& direction, float3& radiance, float& pdf) const;
+        float Pdf(const float3& direction) const;
+
+    private:
+        float2 DirectionToUV(const float3& direction) const;
+
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        std::vector<float> m_rgb;
+        AliasTable<float> m_texels;     // one entry per texel
+    };
+}
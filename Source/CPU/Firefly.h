@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "CPU/VectorMath.h"
+
+namespace CPU
+{
+    // Outlier-robust estimators for the accumulation, against the fireflies
+    // of rare bright paths (caustics off the glossy metal)
+    enum class FireflyFilter
+    {
+        None = 0,
+        TrimmedBucketMean,  // fireflyBuckets per pixel means, darkest and brightest dropped
+        Clamp,              // sample luminance clamped, the threshold set by fireflyBiasBudget
+    };
+
+    // Sample luminances binned 8 per octave from 2^-20 to 2^20, with the
+    // count and luminance sum of every bin. Gives the clamp threshold that
+    // removes a given fraction of the energy of the samples seen so far.
+    class LuminanceHistogram
+    {
+    public:
+        static const int kMinExponent = -20;
+        static const int kBinsPerOctave = 8;
+        static const uint32_t kBinCount = 40 * kBinsPerOctave;
+
+        LuminanceHistogram() { Clear(); }
+
+        void Clear()
+        {
+            std::fill(m_counts, m_counts + kBinCount, 0.0);
+            std::fill(m_sums, m_sums + kBinCount, 0.0);
+        }
+
+        void Add(float luminance)
+        {
+            if (!(luminance > 0.0f))
+                return;
+            int bin = int(std::floor((std::log2(luminance) - float(kMinExponent)) * float(kBinsPerOctave)));
+            bin = std::min(std::max(bin, 0), int(kBinCount) - 1);
+            m_counts[bin] += 1.0;
+            m_sums[bin] += luminance;
+        }
+
+        void Merge(const LuminanceHistogram& other)
+        {
+            for (uint32_t i = 0; i < kBinCount; ++i)
+            {
+                m_counts[i] += other.m_counts[i];
+                m_sums[i] += other.m_sums[i];
+            }
+        }
+
+        // Smallest threshold T with sum(max(L - T, 0)) <= budget * sum(L)
+        // over the samples, taking every sample at its bin mean. INFINITY
+        // without samples.
+        float GetClampThreshold(float budget) const
+        {
+            double total = 0.0;
+            for (uint32_t i = 0; i < kBinCount; ++i)
+                total += m_sums[i];
+            if (total <= 0.0)
+                return INFINITY;
+
+            // Removed energy is S - C * T for T between the means of the
+            // last bin above and the next one, bins are added from the top
+            // until the solution falls into that range
+            const double allowed = double(budget) * total;
+            double count = 0.0, sum = 0.0;
+            for (int i = int(kBinCount) - 1; i >= 0; --i)
+            {
+                if (m_counts[i] == 0.0)
+                    continue;
+                count += m_counts[i];
+                sum += m_sums[i];
+                double threshold = (sum - allowed) / count;
+
+                int next = i - 1;
+                while (next >= 0 && m_counts[next] == 0.0)
+                    --next;
+                double nextMean = next >= 0 ? m_sums[next] / m_counts[next] : 0.0;
+                if (threshold >= nextMean)
+                    return float(std::max(threshold, 0.0));
+            }
+            return 0.0f;
+        }
+
+    private:
+        double m_counts[kBinCount];
+        double m_sums[kBinCount];
+    };
+
+    // The sample scaled down to luminance threshold, the hue is kept
+    inline float3 ClampLuminance(const float3& color, float threshold)
+    {
+        float luminance = Luminance(color);
+        return luminance > threshold ? color * (threshold / luminance) : color;
+    }
+}
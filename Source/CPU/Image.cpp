@@ -0,0 +1,72 @@
+#include "CPU/Image.h"
+#include <algorithm>
+#include <stdexcept>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb/stb_image.h"
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb/stb_image_write.h"
+
+namespace CPU
+{
+    namespace
+    {
+        std::string GetExtension(const std::string& path)
+        {
+            size_t dot = path.find_last_of('.');
+            std::string ext = dot == std::string::npos ? "" : path.substr(dot + 1);
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) { return static_cast<char>(::tolower(c)); });
+            return ext;
+        }
+    }
+
+    void WriteImageRGBA8(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba)
+    {
+        if (rgba.size() < size_t(width) * height * 4)
+            throw std::runtime_error("Image data is smaller than " + std::to_string(width) + "x" + std::to_string(height));
+
+        const int w = static_cast<int>(width), h = static_cast<int>(height);
+        std::string ext = GetExtension(path);
+        int result = 0;
+        if (ext == "png")
+            result = stbi_write_png(path.c_str(), w, h, 4, rgba.data(), w * 4);
+        else if (ext == "bmp")
+            result = stbi_write_bmp(path.c_str(), w, h, 4, rgba.data());
+        else if (ext == "tga")
+            result = stbi_write_tga(path.c_str(), w, h, 4, rgba.data());
+        else if (ext == "jpg" || ext == "jpeg")
+            result = stbi_write_jpg(path.c_str(), w, h, 4, rgba.data(), 95);
+        else
+            throw std::runtime_error("Unsupported image format " + path);
+
+        if (!result)
+            throw std::runtime_error("Could not write image " + path);
+    }
+
+    void WriteImageHDR(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgb)
+    {
+        if (rgb.size() < size_t(width) * height * 3)
+            throw std::runtime_error("Image data is smaller than " + std::to_string(width) + "x" + std::to_string(height));
+
+        if (!stbi_write_hdr(path.c_str(), static_cast<int>(width), static_cast<int>(height), 3, rgb.data()))
+            throw std::runtime_error("Could not write image " + path);
+    }
+
+    void ReadImageHDR(const std::string& path, uint32_t& width, uint32_t& height, std::vector<float>& rgb)
+    {
+        int w, h, channels;
+        float* data = stbi_loadf(path.c_str(), &w, &h, &channels, 3);
+        if (!data)
+            throw std::runtime_error("Could not read image " + path + ": " + stbi_failure_reason());
+
+        width = static_cast<uint32_t>(w);
+        height = static_cast<uint32_t>(h);
+        rgb.assign(data, data + size_t(w) * h * 3);
+        stbi_image_free(data);
+    }
+
+    bool IsHDRImagePath(const std::string& path)
+    {
+        return GetExtension(path) == "hdr";
+    }
+}
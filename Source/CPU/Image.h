@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace CPU
+{
+    // Writes an 8-bit RGBA image. The format follows the extension of path
+    // (.png, .bmp, .tga or .jpg). Throws std::runtime_error on failure.
+    void WriteImageRGBA8(const std::string& path, uint32_t width, uint32_t height, const std::vector<uint8_t>& rgba);
+
+    // Writes linear float RGB as Radiance .hdr, no tone mapping or
+    // quantization. Throws std::runtime_error on failure.
+    void WriteImageHDR(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgb);
+
+    // Reads an image as linear float RGB (Radiance .hdr, or an 8-bit format
+    // converted from sRGB). Throws std::runtime_error on failure.
+    void ReadImageHDR(const std::string& path, uint32_t& width, uint32_t& height, std::vector<float>& rgb);
+
+    // True if path has the .hdr extension
+    bool IsHDRImagePath(const std::string& path);
+}
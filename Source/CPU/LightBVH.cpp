@@ -0,0 +1,374 @@
+#include "CPU/LightBVH.h"
+#include <algorithm>
+#include <cmath>
+#include "CPU/Lights.h"
+
+namespace CPU
+{
+    namespace
+    {
+        const uint32_t kBucketCount = 12;
+        const float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+        float SafeAcos(float x) { return std::acos(clamp(x, -1.0f, 1.0f)); }
+        float SafeSqrt(float x) { return std::sqrt(std::max(0.0f, x)); }
+
+        // cos(max(0, a - b)) and sin(max(0, a - b)) from the sines and cosines
+        float CosSubClamped(float sinA, float cosA, float sinB, float cosB)
+        {
+            if (cosA > cosB)
+                return 1.0f;
+            return cosA * cosB + sinA * sinB;
+        }
+
+        float SinSubClamped(float sinA, float cosA, float sinB, float cosB)
+        {
+            if (cosA > cosB)
+                return 0.0f;
+            return sinA * cosB - cosA * sinB;
+        }
+
+        // Solid angle measure of the emission cone, the orientation term of
+        // the SAOH
+        float OrientationCost(const LightBounds& b)
+        {
+            float thetaO = SafeAcos(b.cosThetaO);
+            float thetaE = SafeAcos(b.cosThetaE);
+            float thetaW = std::min(thetaO + thetaE, PI);
+            float sinThetaO = SafeSqrt(1.0f - b.cosThetaO * b.cosThetaO);
+            return 2.0f * PI * (1.0f - b.cosThetaO) + PI / 2.0f *
+                (2.0f * thetaW * sinThetaO - std::cos(thetaO - 2.0f * thetaW) - 2.0f * thetaO * sinThetaO + b.cosThetaO);
+        }
+    }
+
+    float LightBounds::Importance(const float3& position, const float3& normal) const
+    {
+        // Distance to the centre, clamped so receivers inside the bounds do
+        // not blow up
+        float3 center = bounds.Centroid();
+        float3 d = position - center;
+        float3 halfDiagonal = (bounds.boundsMax - bounds.boundsMin) * 0.5f;
+        float d2 = std::max(dot(d, d), std::max(dot(halfDiagonal, halfDiagonal), 1e-8f));
+        float3 wi = dot(d, d) > 0.0f ? d / std::sqrt(dot(d, d)) : axis;
+
+        float cosThetaW = dot(axis, wi);
+        float sinThetaW = SafeSqrt(1.0f - cosThetaW * cosThetaW);
+
+        // Angle the bounds subtend as seen from the receiver
+        float cosThetaB = -1.0f;
+        float dist2 = dot(d, d);
+        float radius2 = dot(halfDiagonal, halfDiagonal);
+        if (dist2 > radius2)
+            cosThetaB = SafeSqrt(1.0f - radius2 / dist2);
+        float sinThetaB = SafeSqrt(1.0f - cosThetaB * cosThetaB);
+
+        // Smallest angle between wi and an emission direction of the cone
+        float sinThetaO = SafeSqrt(1.0f - cosThetaO * cosThetaO);
+        float cosThetaX = CosSubClamped(sinThetaW, cosThetaW, sinThetaO, cosThetaO);
+        float sinThetaX = SinSubClamped(sinThetaW, cosThetaW, sinThetaO, cosThetaO);
+        float cosThetaP = CosSubClamped(sinThetaX, cosThetaX, sinThetaB, cosThetaB);
+        if (cosThetaP <= cosThetaE)
+            return 0.0f;
+
+        float importance = power * cosThetaP / d2;
+        if (dot(normal, normal) > 0.0f)
+        {
+            float cosThetaI = std::fabs(dot(wi, normal));
+            float sinThetaI = SafeSqrt(1.0f - cosThetaI * cosThetaI);
+            importance *= CosSubClamped(sinThetaI, cosThetaI, sinThetaB, cosThetaB);
+        }
+        return std::max(importance, 0.0f);
+    }
+
+    LightBounds GetLightBounds(const Light& light)
+    {
+        LightBounds b;
+        b.power = LightPower(light);
+        b.bounds.Grow(light.position);
+        if (light.type == LightType::Point)
+        {
+            // Emits in every direction
+            b.cosThetaO = -1.0f;
+            b.cosThetaE = 0.0f;
+            return b;
+        }
+
+        b.bounds.Grow(light.position + light.edge0);
+        b.bounds.Grow(light.position + light.edge1);
+        if (light.type == LightType::Quad)
+            b.bounds.Grow(light.position + light.edge0 + light.edge1);
+
+        // One sided diffuse emitter
+        float3 n = cross(light.edge0, light.edge1);
+        b.axis = dot(n, n) > 0.0f ? normalize(n) : float3(0.0f, 0.0f, 1.0f);
+        b.cosThetaO = 1.0f;
+        b.cosThetaE = 0.0f;
+        return b;
+    }
+
+    LightBounds Union(const LightBounds& a, const LightBounds& b)
+    {
+        // Black lights must not widen the cone
+        if (a.power == 0.0f)
+        {
+            LightBounds result = b;
+            result.bounds.Grow(a.bounds);
+            return result;
+        }
+        if (b.power == 0.0f)
+        {
+            LightBounds result = a;
+            result.bounds.Grow(b.bounds);
+            return result;
+        }
+
+        LightBounds result;
+        result.bounds = a.bounds;
+        result.bounds.Grow(b.bounds);
+        result.power = a.power + b.power;
+        result.cosThetaE = std::min(a.cosThetaE, b.cosThetaE);
+
+        // Smallest cone containing both cones
+        float thetaA = SafeAcos(a.cosThetaO);
+        float thetaB = SafeAcos(b.cosThetaO);
+        float thetaD = SafeAcos(dot(a.axis, b.axis));
+        if (std::min(thetaD + thetaB, PI) <= thetaA)
+        {
+            result.axis = a.axis;
+            result.cosThetaO = a.cosThetaO;
+            return result;
+        }
+        if (std::min(thetaD + thetaA, PI) <= thetaB)
+        {
+            result.axis = b.axis;
+            result.cosThetaO = b.cosThetaO;
+            return result;
+        }
+
+        float thetaO = (thetaA + thetaD + thetaB) * 0.5f;
+        float3 rotationAxis = cross(a.axis, b.axis);
+        if (thetaO >= PI || dot(rotationAxis, rotationAxis) == 0.0f)
+        {
+            result.axis = a.axis;
+            result.cosThetaO = -1.0f;
+            return result;
+        }
+
+        // Rotate a.axis towards b.axis by thetaO - thetaA (Rodrigues, the
+        // rotation axis is orthogonal to a.axis)
+        float thetaR = thetaO - thetaA;
+        float3 k = normalize(rotationAxis);
+        result.axis = normalize(a.axis * std::cos(thetaR) + cross(k, a.axis) * std::sin(thetaR));
+        result.cosThetaO = std::cos(thetaO);
+        return result;
+    }
+
+    void LightBVH::Build(const std::vector<Light>& lights)
+    {
+        m_nodes.clear();
+        m_lightPaths.assign(lights.size(), 0);
+        m_depth = 0;
+        if (lights.empty())
+            return;
+
+        std::vector<LightBounds> lightBounds(lights.size());
+        std::vector<uint32_t> order(lights.size());
+        for (uint32_t i = 0; i < lights.size(); ++i)
+        {
+            lightBounds[i] = GetLightBounds(lights[i]);
+            order[i] = i;
+        }
+
+        m_nodes.reserve(2 * lights.size() - 1);
+        BuildRecursive(lightBounds, order, 0, static_cast<uint32_t>(lights.size()), 0, 0);
+    }
+
+    uint32_t LightBVH::BuildRecursive(const std::vector<LightBounds>& lightBounds, std::vector<uint32_t>& order,
+        uint32_t begin, uint32_t end, uint32_t depth, uint64_t path)
+    {
+        uint32_t nodeIndex = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_depth = std::max(m_depth, depth);
+
+        if (end - begin == 1)
+        {
+            m_nodes[nodeIndex].bounds = lightBounds[order[begin]];
+            m_nodes[nodeIndex].child = order[begin];
+            m_nodes[nodeIndex].isLeaf = true;
+            m_lightPaths[order[begin]] = path;
+            return nodeIndex;
+        }
+
+        LightBounds nodeBounds = lightBounds[order[begin]];
+        AABB centroidBounds;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            if (i > begin)
+                nodeBounds = Union(nodeBounds, lightBounds[order[i]]);
+            centroidBounds.Grow(lightBounds[order[i]].bounds.Centroid());
+        }
+        m_nodes[nodeIndex].bounds = nodeBounds;
+
+        // Binned SAOH: power * orientation cost * surface area of both
+        // sides, Kr penalizes splitting thin axes of long boxes
+        float bestCost = INFINITY;
+        int bestAxis = -1;
+        uint32_t bestBucket = 0;
+        float3 extent = nodeBounds.bounds.boundsMax - nodeBounds.bounds.boundsMin;
+        float3 centroidExtent = centroidBounds.boundsMax - centroidBounds.boundsMin;
+
+        // Past kMaxDepth - 1 the paths of the leaves no longer fit, which a
+        // count median split below avoids long before
+        if (depth < kMaxDepth / 2)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (centroidExtent[axis] <= 0.0f)
+                    continue;
+
+                LightBounds buckets[kBucketCount];
+                uint32_t counts[kBucketCount] = {};
+                auto bucketOf = [&](uint32_t light) {
+                    float t = (lightBounds[light].bounds.Centroid()[axis] - centroidBounds.boundsMin[axis]) / centroidExtent[axis];
+                    return std::min(kBucketCount - 1, static_cast<uint32_t>(t * kBucketCount));
+                };
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    uint32_t b = bucketOf(order[i]);
+                    buckets[b] = counts[b] ? Union(buckets[b], lightBounds[order[i]]) : lightBounds[order[i]];
+                    counts[b]++;
+                }
+
+                float kr = MaxComponent(extent) / std::max(extent[axis], 1e-8f);
+                for (uint32_t split = 1; split < kBucketCount; ++split)
+                {
+                    LightBounds below, above;
+                    uint32_t countBelow = 0, countAbove = 0;
+                    for (uint32_t b = 0; b < split; ++b)
+                    {
+                        if (counts[b])
+                            below = countBelow ? Union(below, buckets[b]) : buckets[b];
+                        countBelow += counts[b];
+                    }
+                    for (uint32_t b = split; b < kBucketCount; ++b)
+                    {
+                        if (counts[b])
+                            above = countAbove ? Union(above, buckets[b]) : buckets[b];
+                        countAbove += counts[b];
+                    }
+                    if (countBelow == 0 || countAbove == 0)
+                        continue;
+
+                    float cost = kr * (below.power * OrientationCost(below) * below.bounds.SurfaceArea() +
+                                       above.power * OrientationCost(above) * above.bounds.SurfaceArea());
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBucket = split;
+                    }
+                }
+            }
+        }
+
+        uint32_t mid;
+        if (bestAxis >= 0)
+        {
+            float3 minCentroid = centroidBounds.boundsMin;
+            auto it = std::partition(order.begin() + begin, order.begin() + end, [&](uint32_t light) {
+                float t = (lightBounds[light].bounds.Centroid()[bestAxis] - minCentroid[bestAxis]) / centroidExtent[bestAxis];
+                return std::min(kBucketCount - 1, static_cast<uint32_t>(t * kBucketCount)) < bestBucket;
+            });
+            mid = static_cast<uint32_t>(it - order.begin());
+        }
+        else
+        {
+            // Coincident lights or a deep tree: halve by count along the
+            // widest centroid axis
+            int axis = centroidExtent.x >= centroidExtent.y && centroidExtent.x >= centroidExtent.z ? 0 :
+                (centroidExtent.y >= centroidExtent.z ? 1 : 2);
+            mid = (begin + end) / 2;
+            std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end, [&](uint32_t a, uint32_t b) {
+                return lightBounds[a].bounds.Centroid()[axis] < lightBounds[b].bounds.Centroid()[axis];
+            });
+        }
+
+        BuildRecursive(lightBounds, order, begin, mid, depth + 1, path);
+        uint32_t second = BuildRecursive(lightBounds, order, mid, end, depth + 1, path | (uint64_t(1) << depth));
+        m_nodes[nodeIndex].child = second;
+        return nodeIndex;
+    }
+
+    void LightBVH::Refit(const std::vector<Light>& lights)
+    {
+        // Children follow their parent, a reverse sweep sees them first
+        for (size_t i = m_nodes.size(); i-- > 0;)
+        {
+            Node& node = m_nodes[i];
+            if (node.isLeaf)
+                node.bounds = GetLightBounds(lights[node.child]);
+            else
+                node.bounds = Union(m_nodes[i + 1].bounds, m_nodes[node.child].bounds);
+        }
+    }
+
+    uint32_t LightBVH::Select(const float3& position, const float3& normal, float u, float& pmf) const
+    {
+        pmf = 0.0f;
+        if (m_nodes.empty() || m_nodes[0].bounds.Importance(position, normal) == 0.0f)
+            return kInvalidIndex;
+
+        uint32_t nodeIndex = 0;
+        float p = 1.0f;
+        while (!m_nodes[nodeIndex].isLeaf)
+        {
+            uint32_t first = nodeIndex + 1;
+            uint32_t second = m_nodes[nodeIndex].child;
+            float importanceFirst = m_nodes[first].bounds.Importance(position, normal);
+            float importanceSecond = m_nodes[second].bounds.Importance(position, normal);
+            if (importanceFirst + importanceSecond == 0.0f)
+                return kInvalidIndex;
+
+            // Pick a child and remap u to [0, 1) for the next level
+            float pFirst = importanceFirst / (importanceFirst + importanceSecond);
+            if (u < pFirst)
+            {
+                nodeIndex = first;
+                u = std::min(u / pFirst, kOneMinusEpsilon);
+                p *= pFirst;
+            }
+            else
+            {
+                nodeIndex = second;
+                u = std::min((u - pFirst) / (1.0f - pFirst), kOneMinusEpsilon);
+                p *= 1.0f - pFirst;
+            }
+        }
+        pmf = p;
+        return m_nodes[nodeIndex].child;
+    }
+
+    float LightBVH::Pmf(const float3& position, const float3& normal, uint32_t lightIndex) const
+    {
+        if (m_nodes.empty() || lightIndex >= m_lightPaths.size() || m_nodes[0].bounds.Importance(position, normal) == 0.0f)
+            return 0.0f;
+
+        uint64_t path = m_lightPaths[lightIndex];
+        uint32_t nodeIndex = 0;
+        float p = 1.0f;
+        for (uint32_t depth = 0; !m_nodes[nodeIndex].isLeaf; ++depth)
+        {
+            uint32_t first = nodeIndex + 1;
+            uint32_t second = m_nodes[nodeIndex].child;
+            float importanceFirst = m_nodes[first].bounds.Importance(position, normal);
+            float importanceSecond = m_nodes[second].bounds.Importance(position, normal);
+            if (importanceFirst + importanceSecond == 0.0f)
+                return 0.0f;
+
+            bool takeSecond = (path >> depth) & 1;
+            p *= (takeSecond ? importanceSecond : importanceFirst) / (importanceFirst + importanceSecond);
+            nodeIndex = takeSecond ? second : first;
+        }
+        return p;
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include "CPU/Ray.h"
+
+namespace CPU
+{
+    struct Light;
+
+    // What a set of lights can emit: their spatial bounds, total power and
+    // the cone of emission directions. axis / cosThetaO bound the normals,
+    // cosThetaE the spread around each normal (pi / 2 for diffuse emitters).
+    struct LightBounds
+    {
+        AABB bounds;
+        float3 axis = float3(0.0f, 0.0f, 1.0f);
+        float power = 0.0f;
+        float cosThetaO = 1.0f;
+        float cosThetaE = 1.0f;
+
+        // Conservative estimate of the light arriving at a receiver, the
+        // selection weight of the light BVH. A zero normal skips the
+        // receiver cosine.
+        float Importance(const float3& position, const float3& normal) const;
+    };
+
+    LightBounds GetLightBounds(const Light& light);
+    LightBounds Union(const LightBounds& a, const LightBounds& b);
+
+    // Light BVH of Conty Estevez and Kulla, "Importance Sampling of Many
+    // Lights with Adaptive Tree Splitting": a binary tree with one light per
+    // leaf, built with the surface area orientation heuristic. Selection
+    // walks from the root picking a child by importance, so a light is
+    // chosen in O(depth) and the nearby, facing ones are picked more often.
+    class LightBVH
+    {
+    public:
+        void Build(const std::vector<Light>& lights);
+
+        // Recomputes the node bounds after lights moved or changed power,
+        // the tree is kept. lights must be the list of the last Build().
+        void Refit(const std::vector<Light>& lights);
+
+        // Returns kInvalidIndex if no light can reach the receiver, pmf is
+        // the probability of the returned light
+        uint32_t Select(const float3& position, const float3& normal, float u, float& pmf) const;
+
+        // Probability of Select() returning lightIndex, walks the same path
+        float Pmf(const float3& position, const float3& normal, uint32_t lightIndex) const;
+
+        bool IsEmpty() const { return m_nodes.empty(); }
+        size_t GetNodeCount() const { return m_nodes.size(); }
+        uint32_t GetDepth() const { return m_depth; }
+
+    private:
+        // Pre-order: the first child of an interior node follows it, the
+        // second is at child. Leaves store their light in child.
+        struct Node
+        {
+            LightBounds bounds;
+            uint32_t child = 0;
+            bool isLeaf = false;
+        };
+
+        static const uint32_t kMaxDepth = 64;
+
+        uint32_t BuildRecursive(const std::vector<LightBounds>& lightBounds, std::vector<uint32_t>& order,
+            uint32_t begin, uint32_t end, uint32_t depth, uint64_t path);
+
+        std::vector<Node> m_nodes;
+        std::vector<uint64_t> m_lightPaths;     // bit d set = second child at depth d
+        uint32_t m_depth = 0;
+    };
+}
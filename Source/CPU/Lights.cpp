@@ -0,0 +1,154 @@
+#include "CPU/Lights.h"
+#include <algorithm>
+
+namespace CPU
+{
+    float3 LightNormal(const Light& light)
+    {
+        return normalize(cross(light.edge0, light.edge1));
+    }
+
+    float LightPower(const Light& light)
+    {
+        // Intensity over the sphere, radiance over the area and hemisphere
+        if (light.type == LightType::Point)
+            return 4.0f * PI * Luminance(light.emission);
+        return PI * light.area * Luminance(light.emission);
+    }
+
+    float3 SampleLight(const Light& light, const float3& position, const float2& u, float3& L, float& distance, float& pdf)
+    {
+        if (light.type == LightType::Point)
+        {
+            float3 d = light.position - position;
+            distance = length(d);
+            L = d / distance;
+            pdf = 1.0f;
+            return light.emission / (distance * distance);
+        }
+
+        float3 p;
+        if (light.type == LightType::Triangle)
+        {
+            // Uniform barycentrics
+            float s = std::sqrt(u.x);
+            p = light.position + light.edge0 * (s * (1 - u.y)) + light.edge1 * (s * u.y);
+        }
+        else
+        {
+            p = light.position + light.edge0 * u.x + light.edge1 * u.y;
+        }
+
+        float3 d = p - position;
+        distance = length(d);
+        L = d / distance;
+
+        float cosLight = -dot(L, LightNormal(light));
+        if (cosLight <= 0.0f)
+        {
+            pdf = 0.0f;
+            return float3(0.0f);
+        }
+
+        pdf = distance * distance / (cosLight * light.area);
+        return light.emission;
+    }
+
+    float LightPdf(const Light& light, const float3& L, float distance)
+    {
+        if (light.type == LightType::Point)
+            return 0.0f;
+
+        float cosLight = -dot(L, LightNormal(light));
+        if (cosLight <= 0.0f)
+            return 0.0f;
+        return distance * distance / (cosLight * light.area);
+    }
+
+    uint32_t LightList::Add(const Light& light)
+    {
+        m_lights.push_back(light);
+        return static_cast<uint32_t>(m_lights.size() - 1);
+    }
+
+    void LightList::Build()
+    {
+        BuildDistribution();
+        m_bvh.Build(m_lights);
+    }
+
+    void LightList::Refit()
+    {
+        BuildDistribution();
+        m_bvh.Refit(m_lights);
+    }
+
+    void LightList::BuildDistribution()
+    {
+        double total = 0.0;
+        for (const Light& light : m_lights)
+            total += LightPower(light);
+
+        double sum = 0.0;
+        std::vector<float> weights;
+        weights.reserve(m_lights.size());
+        for (Light& light : m_lights)
+        {
+            // Black lights never get picked, a list of only black lights
+            // falls back to uniform selection
+            double power = total > 0.0 ? LightPower(light) : 1.0;
+            light.pmf = float(power / (total > 0.0 ? total : double(m_lights.size())));
+            sum += light.pmf;
+            light.cdf = float(sum);
+            weights.push_back(light.pmf);
+        }
+        if (!m_lights.empty())
+            m_lights.back().cdf = 1.0f;
+        m_alias.Build(weights);
+    }
+
+    uint32_t LightList::Select(LightSelection selection, const float3& position, const float3& normal, float u, float& pmf) const
+    {
+        if (m_lights.empty())
+        {
+            pmf = 0.0f;
+            return kInvalidIndex;
+        }
+        if (selection == LightSelection::BVH)
+            return m_bvh.Select(position, normal, u, pmf);
+
+        uint32_t index = Select(u);
+        pmf = m_lights[index].pmf;
+        return index;
+    }
+
+    float LightList::SelectionPmf(LightSelection selection, const float3& position, const float3& normal, uint32_t lightIndex) const
+    {
+        if (selection == LightSelection::BVH)
+            return m_bvh.Pmf(position, normal, lightIndex);
+        return m_lights[lightIndex].pmf;
+    }
+
+    bool LightList::Sample(LightSelection selection, const float3& position, const float3& normal, float uSelect, const float2& u,
+        LightSample& sample) const
+    {
+        float pmf;
+        uint32_t index = Select(selection, position, normal, uSelect, pmf);
+        if (index == kInvalidIndex || pmf == 0.0f)
+            return false;
+
+        const Light& light = m_lights[index];
+        float pdf;
+        sample.radiance = SampleLight(light, position, u, sample.direction, sample.distance, pdf);
+        sample.pdf = pdf * pmf;
+        sample.isDelta = light.type == LightType::Point;
+        return sample.pdf > 0.0f;
+    }
+
+    float LightList::Pdf(LightSelection selection, uint32_t lightIndex, const float3& position, const float3& normal,
+        const float3& L, float distance) const
+    {
+        float pdf = LightPdf(m_lights[lightIndex], L, distance);
+        return pdf > 0.0f ? pdf * SelectionPmf(selection, position, normal, lightIndex) : 0.0f;
+    }
+}
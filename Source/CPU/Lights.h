@@ -0,0 +1,118 @@
+#pragma once
+
+#include <vector>
+#include "CPU/AliasTable.h"
+#include "CPU/LightBVH.h"
+#include "CPU/VectorMath.h"
+
+// C++ port of Shaders/Utils/Lights.hlsl plus the light list both renderers
+// select from. Point lights store their intensity in emission, triangle and
+// quad lights their radiance; area lights emit on the side of
+// cross(edge0, edge1).
+
+namespace CPU
+{
+    // Mirrors LIGHT_POINT / LIGHT_TRIANGLE / LIGHT_QUAD
+    enum class LightType : uint32_t
+    {
+        Point = 0,
+        Triangle,
+        Quad,
+    };
+
+    // Same layout as the Light struct of the shaders (StructuredBuffer)
+    struct Light
+    {
+        float3 position;    // point position, first vertex of triangles / corner of quads
+        LightType type = LightType::Point;
+        float3 edge0;
+        float area = 0.0f;
+        float3 edge1;
+        float pmf = 0.0f;
+        float3 emission;
+        float cdf = 0.0f;   // sum of the pmf up to and including this light
+    };
+
+    // How LightList picks the light to sample. Power is what the shaders do,
+    // BVH weighs the lights by their importance for the shading point.
+    enum class LightSelection
+    {
+        Power = 0,
+        BVH,
+    };
+
+    struct LightSample
+    {
+        float3 direction;
+        float distance = 0.0f;
+        float3 radiance;    // incident radiance, 0 if the back of an area light is seen
+        float pdf = 0.0f;   // solid angle, including the selection probability
+        bool isDelta = false;
+    };
+
+    float3 LightNormal(const Light& light);
+
+    // Power used for the selection probabilities
+    float LightPower(const Light& light);
+
+    // See SampleLight / LightPdf in Lights.hlsl. The pdfs are per solid
+    // angle and do not include the selection probability. Area lights are
+    // scene geometry on the CPU, IntersectLight is not needed.
+    float3 SampleLight(const Light& light, const float3& position, const float2& u, float3& L, float& distance, float& pdf);
+    float LightPdf(const Light& light, const float3& L, float distance);
+
+    inline float PowerHeuristic(float a, float b)
+    {
+        float a2 = a * a;
+        float b2 = b * b;
+        return a2 + b2 > 0.0f ? a2 / (a2 + b2) : 0.0f;
+    }
+
+    class LightList
+    {
+    public:
+        void Clear() { m_lights.clear(); }
+        uint32_t Add(const Light& light);
+
+        // Fills pmf / cdf, proportional to the emitted power, and builds the
+        // alias table and the light BVH
+        void Build();
+
+        // Same as Build() for a list that only moved or changed power since
+        // the last build: refits the light BVH instead of rebuilding it
+        void Refit();
+
+        bool IsEmpty() const { return m_lights.empty(); }
+        uint32_t GetCount() const { return static_cast<uint32_t>(m_lights.size()); }
+        const Light& GetLight(uint32_t index) const { return m_lights[index]; }
+        const std::vector<Light>& GetLights() const { return m_lights; }
+
+        // Alias table lookup. Picks with the pmf the shaders' binary search
+        // of the cdf uses, though not the same light for the same u.
+        uint32_t Select(float u) const { return m_alias.Sample(u); }
+
+        // Light for a shading point (normal may be 0) and its selection
+        // probability, kInvalidIndex if none can contribute
+        uint32_t Select(LightSelection selection, const float3& position, const float3& normal, float u, float& pmf) const;
+        float SelectionPmf(LightSelection selection, const float3& position, const float3& normal, uint32_t lightIndex) const;
+
+        // One light sample for a shading point: uSelect picks the light, u
+        // the point on it
+        bool Sample(LightSelection selection, const float3& position, const float3& normal, float uSelect, const float2& u,
+            LightSample& sample) const;
+
+        // Pdf of Sample() returning the point at distance along L on light
+        // lightIndex, for the MIS weight of BRDF sampled rays hitting it
+        float Pdf(LightSelection selection, uint32_t lightIndex, const float3& position, const float3& normal,
+            const float3& L, float distance) const;
+
+        const LightBVH& GetBVH() const { return m_bvh; }
+
+    private:
+        void BuildDistribution();
+
+        std::vector<Light> m_lights;
+        AliasTable<float> m_alias;
+        LightBVH m_bvh;
+    };
+}
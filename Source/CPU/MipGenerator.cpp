@@ -0,0 +1,332 @@
+#include "CPU/MipGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include "CPU/Simd.h"
+#include "CPU/VectorMath.h"
+
+namespace CPU
+{
+    namespace
+    {
+        const double kPi = 3.141592653589793;
+
+        // Source texels of every destination texel along one axis, padded
+        // to the same tap count
+        struct FilterTaps
+        {
+            std::vector<uint32_t> first;
+            std::vector<float> weights;     // taps per destination texel
+            uint32_t taps = 0;
+        };
+
+        double BesselI0(double x)
+        {
+            double sum = 1.0;
+            double term = 1.0;
+            for (int k = 1; k < 32; ++k)
+            {
+                term *= (x * 0.5 / k) * (x * 0.5 / k);
+                sum += term;
+                if (term < sum * 1e-12)
+                    break;
+            }
+            return sum;
+        }
+
+        // Source texels past the edges repeat the edge texel
+        FilterTaps BuildTaps(uint32_t sourceSize, uint32_t size, const MipGeneratorSettings& settings)
+        {
+            const double scale = double(sourceSize) / double(size);
+            const double halfWidth = settings.filter == MipFilter::Box ? 0.5 : std::max(0.5, double(settings.kaiserWidth) * 0.5);
+            const double radius = halfWidth * scale;
+            const double alpha = settings.kaiserAlpha;
+            const double windowScale = 1.0 / BesselI0(alpha);
+
+            std::vector<std::vector<double>> weights(size);
+            FilterTaps filter;
+            filter.first.resize(size);
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                const double center = (x + 0.5) * scale;
+                const int lo = int(std::floor(center - radius));
+                const int hi = int(std::ceil(center + radius));
+                const int first = std::max(lo, 0);
+                const int last = std::min(hi, int(sourceSize)) - 1;
+                std::vector<double>& w = weights[x];
+                w.assign(size_t(last - first + 1), 0.0);
+                double sum = 0.0;
+                for (int i = lo; i < hi; ++i)
+                {
+                    double weight;
+                    if (settings.filter == MipFilter::Box)
+                        weight = std::max(0.0, std::min(double(i + 1), center + radius) - std::max(double(i), center - radius));
+                    else
+                    {
+                        const double t = (i + 0.5 - center) / scale;
+                        if (std::abs(t) >= halfWidth)
+                            continue;
+                        const double sinc = t == 0.0 ? 1.0 : std::sin(kPi * t) / (kPi * t);
+                        const double r = t / halfWidth;
+                        weight = sinc * BesselI0(alpha * std::sqrt(1.0 - r * r)) * windowScale;
+                    }
+                    w[size_t(std::clamp(i, first, last) - first)] += weight;
+                    sum += weight;
+                }
+                for (double& weight : w)
+                    weight /= sum;
+                filter.first[x] = uint32_t(first);
+                filter.taps = std::max(filter.taps, uint32_t(w.size()));
+            }
+
+            filter.weights.assign(size_t(size) * filter.taps, 0.0f);
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                // Texels near the last edge start earlier, the extra taps
+                // keep a zero weight
+                const uint32_t first = std::min(filter.first[x], sourceSize - filter.taps);
+                const uint32_t offset = filter.first[x] - first;
+                for (size_t k = 0; k < weights[x].size(); ++k)
+                    filter.weights[size_t(x) * filter.taps + offset + k] = float(weights[x][k]);
+                filter.first[x] = first;
+            }
+            return filter;
+        }
+
+        // Linear value of every 8-bit code, per channel
+        struct DecodeTable
+        {
+            float values[4][256];
+        };
+
+        double SRGBToLinear(double c)
+        {
+            return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+        }
+
+        DecodeTable BuildDecodeTable(MipContent content)
+        {
+            DecodeTable table;
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int i = 0; i < 256; ++i)
+                {
+                    const double value = i / 255.0;
+                    if (c < 3 && content == MipContent::SRGB)
+                        table.values[c][i] = float(SRGBToLinear(value));
+                    else if (c < 3 && content == MipContent::NormalMap)
+                        table.values[c][i] = float(value * 2.0 - 1.0);
+                    else
+                        table.values[c][i] = float(value);
+                }
+            }
+            return table;
+        }
+
+        // Linear values where the rounded sRGB code steps up, and the code at
+        // the start of 4096 equal buckets of [0, 1]. The steps are more than
+        // a bucket apart, so one compare finishes the encode. The window
+        // links this file without the tone mapper, hence a table of its own.
+        struct SRGBEncoder
+        {
+            static const int kBuckets = 4096;
+            float thresholds[256];      // thresholds[k]: start of code k + 1
+            uint8_t codes[kBuckets + 1];
+
+            SRGBEncoder()
+            {
+                for (int k = 0; k < 255; ++k)
+                    thresholds[k] = float(SRGBToLinear((k + 0.5) / 255.0));
+                thresholds[255] = 2.0f;
+                int code = 0;
+                for (int i = 0; i <= kBuckets; ++i)
+                {
+                    while (thresholds[code] <= float(i) / kBuckets)
+                        ++code;
+                    codes[i] = uint8_t(code);
+                }
+            }
+
+            // x in [0, 1]
+            uint8_t Encode(float x) const
+            {
+                const int code = codes[int(x * kBuckets)];
+                return uint8_t(code + (x >= thresholds[code]));
+            }
+        };
+
+        inline uint8_t EncodeUnorm(float x)
+        {
+            return static_cast<uint8_t>(std::min(std::max(x, 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+
+        // row += weight * source over count floats
+        inline void AccumulateRow(float* row, const float* source, float weight, size_t count)
+        {
+            size_t i = 0;
+#if defined(__AVX2__)
+            const vfloat8 w8(weight);
+            for (; i + 8 <= count; i += 8)
+                (vfloat8::Load(row + i) + vfloat8::Load(source + i) * w8).Store(row + i);
+#endif
+#if defined(D3DRT_SIMD_SSE)
+            const vfloat4 w4(weight);
+            for (; i + 4 <= count; i += 4)
+                (vfloat4::Load(row + i) + vfloat4::Load(source + i) * w4).Store(row + i);
+#endif
+            for (; i < count; ++i)
+                row[i] += source[i] * weight;
+        }
+    }
+
+    const char* ToString(MipFilter filter)
+    {
+        return filter == MipFilter::Box ? "box" : "kaiser";
+    }
+
+    MipGenerator::MipGenerator(const MipGeneratorSettings& settings)
+        : m_settings(settings), m_scheduler(settings.threadCount)
+    {
+        m_settings.threadCount = m_scheduler.GetThreadCount();
+        m_settings.rowsPerTask = std::max(1u, m_settings.rowsPerTask);
+    }
+
+    uint32_t MipGenerator::GetMipCount(uint32_t width, uint32_t height)
+    {
+        uint32_t count = 1;
+        for (uint32_t size = std::max(width, height); size > 1; size /= 2)
+            ++count;
+        return count;
+    }
+
+    void MipGenerator::Generate(const uint8_t* texels, uint32_t width, uint32_t height, TextureLayout layout, MipContent content,
+        std::vector<TextureMip>& mips)
+    {
+        static const SRGBEncoder srgb;
+        const uint32_t channels = GetTexelSize(layout);
+        const DecodeTable decode = BuildDecodeTable(content);
+        const bool normalMap = content == MipContent::NormalMap && channels == 4;
+        const uint32_t threadCount = m_scheduler.GetThreadCount();
+
+        mips.resize(GetMipCount(width, height) - 1);
+        std::vector<float> previous, current;
+        std::vector<std::vector<float>> rows(threadCount);
+        std::vector<std::vector<float>> bands(threadCount);
+        uint32_t sourceWidth = width;
+        uint32_t sourceHeight = height;
+        for (size_t level = 0; level < mips.size(); ++level)
+        {
+            TextureMip& mip = mips[level];
+            mip.width = std::max(1u, sourceWidth / 2);
+            mip.height = std::max(1u, sourceHeight / 2);
+            mip.texels.resize(size_t(mip.width) * mip.height * channels);
+            current.resize(size_t(mip.width) * mip.height * channels);
+            const FilterTaps columns = BuildTaps(sourceWidth, mip.width, m_settings);
+            const FilterTaps rowTaps = BuildTaps(sourceHeight, mip.height, m_settings);
+            const size_t sourceStride = size_t(sourceWidth) * channels;
+            const size_t stride = size_t(mip.width) * channels;
+
+            // Small levels get thinner bands so every thread still has rows
+            const uint32_t rowsPerTask = std::max(1u, std::min(m_settings.rowsPerTask, (mip.height + threadCount - 1) / threadCount));
+            const uint32_t taskCount = (mip.height + rowsPerTask - 1) / rowsPerTask;
+            m_scheduler.Run(taskCount, [&](uint32_t task, uint32_t threadIndex)
+                {
+                    const uint32_t y0 = task * rowsPerTask;
+                    const uint32_t y1 = std::min(y0 + rowsPerTask, mip.height);
+                    std::vector<float>& row = rows[threadIndex];
+                    row.resize(sourceStride);
+
+                    // Level 1 reads the 8-bit texels, decoded once per band
+                    const uint32_t sourceY0 = rowTaps.first[y0];
+                    const float* source = previous.data();
+                    if (level == 0)
+                    {
+                        const uint32_t sourceY1 = rowTaps.first[y1 - 1] + rowTaps.taps;
+                        std::vector<float>& band = bands[threadIndex];
+                        band.resize((sourceY1 - sourceY0) * sourceStride);
+                        const uint8_t* in = texels + sourceY0 * sourceStride;
+                        for (size_t i = 0; i < band.size(); i += channels)
+                        {
+                            for (uint32_t c = 0; c < channels; ++c)
+                                band[i + c] = decode.values[c][in[i + c]];
+                        }
+                        source = band.data() - sourceY0 * sourceStride;
+                    }
+
+                    for (uint32_t y = y0; y < y1; ++y)
+                    {
+                        // Vertical: the source rows of this row, whole rows wide
+                        std::fill(row.begin(), row.end(), 0.0f);
+                        const float* rowWeights = &rowTaps.weights[size_t(y) * rowTaps.taps];
+                        for (uint32_t k = 0; k < rowTaps.taps; ++k)
+                        {
+                            if (rowWeights[k] != 0.0f)
+                                AccumulateRow(row.data(), source + (rowTaps.first[y] + k) * sourceStride, rowWeights[k], sourceStride);
+                        }
+
+                        // Horizontal, then the clamp of the filter's ringing
+                        float* out = &current[y * stride];
+                        uint8_t* encoded = &mip.texels[y * stride];
+                        const float lowest = normalMap ? -1.0f : 0.0f;
+                        for (uint32_t x = 0; x < mip.width; ++x)
+                        {
+                            const float* weights = &columns.weights[size_t(x) * columns.taps];
+                            const float* in = row.data() + size_t(columns.first[x]) * channels;
+                            float* texel = out + size_t(x) * channels;
+                            if (channels == 4)
+                            {
+#if defined(D3DRT_SIMD_SSE)
+                                vfloat4 sum(0.0f);
+                                for (uint32_t k = 0; k < columns.taps; ++k)
+                                    sum = sum + vfloat4::Load(in + k * 4) * vfloat4(weights[k]);
+                                Min(Max(sum, vfloat4(lowest)), vfloat4(1.0f)).Store(texel);
+#else
+                                for (uint32_t c = 0; c < 4; ++c)
+                                {
+                                    float sum = 0.0f;
+                                    for (uint32_t k = 0; k < columns.taps; ++k)
+                                        sum += in[k * 4 + c] * weights[k];
+                                    texel[c] = std::min(std::max(sum, lowest), 1.0f);
+                                }
+#endif
+                                if (normalMap)
+                                {
+                                    // The 8 bits get the renormalized
+                                    // direction, the float level keeps the
+                                    // average for the next one
+                                    float3 n(texel[0], texel[1], texel[2]);
+                                    const float lengthSquared = dot(n, n);
+                                    n = lengthSquared > 0.0f ? n * (1.0f / std::sqrt(lengthSquared)) : float3(0.0f, 0.0f, 1.0f);
+                                    encoded[x * 4 + 0] = EncodeUnorm(n.x * 0.5f + 0.5f);
+                                    encoded[x * 4 + 1] = EncodeUnorm(n.y * 0.5f + 0.5f);
+                                    encoded[x * 4 + 2] = EncodeUnorm(n.z * 0.5f + 0.5f);
+                                }
+                                else if (content == MipContent::SRGB)
+                                {
+                                    for (uint32_t c = 0; c < 3; ++c)
+                                        encoded[x * 4 + c] = srgb.Encode(texel[c]);
+                                }
+                                else
+                                {
+                                    for (uint32_t c = 0; c < 3; ++c)
+                                        encoded[x * 4 + c] = EncodeUnorm(texel[c]);
+                                }
+                                encoded[x * 4 + 3] = EncodeUnorm(texel[3]);
+                            }
+                            else
+                            {
+                                float sum = 0.0f;
+                                for (uint32_t k = 0; k < columns.taps; ++k)
+                                    sum += in[k] * weights[k];
+                                texel[0] = std::min(std::max(sum, 0.0f), 1.0f);
+                                encoded[x] = content == MipContent::SRGB ? srgb.Encode(texel[0]) : EncodeUnorm(texel[0]);
+                            }
+                        }
+                    }
+                });
+
+            std::swap(previous, current);
+            sourceWidth = mip.width;
+            sourceHeight = mip.height;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "CPU/TexturePipeline.h"
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    enum class MipFilter
+    {
+        Box = 0,        // exact area average, also across odd sizes
+        Kaiser,         // Kaiser windowed sinc, sharper minification
+    };
+
+    // How the texels of a map are filtered
+    enum class MipContent
+    {
+        Linear = 0,     // values averaged as stored (roughness, metallic, AO, ...)
+        SRGB,           // rgb decoded to linear light first, alpha linear
+        NormalMap,      // xyz in [-1, 1] from the 8 bits, renormalized per texel
+    };
+
+    const char* ToString(MipFilter filter);
+
+    struct MipGeneratorSettings
+    {
+        MipFilter filter = MipFilter::Kaiser;
+        float kaiserWidth = 3.0f;           // support in destination texels
+        float kaiserAlpha = 4.0f;
+
+        uint32_t threadCount = 0;           // 0 = all hardware threads
+        uint32_t rowsPerTask = 8;
+    };
+
+    struct TextureMip
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint8_t> texels;        // the layout of level 0
+    };
+
+    // Builds the mip chain of an 8-bit texture down to 1x1. Each level is
+    // max(1, previous / 2) texels wide and high, the D3D12 rule, so a level
+    // with an odd size is reduced by slightly more than two; the filter
+    // weights are computed per destination texel from the exact scale
+    // instead of averaging 2x2 blocks. The filter is separable: a
+    // destination row sums its source rows (vfloat8 / vfloat4 over the whole
+    // row), then every texel sums its columns.
+    //
+    // Levels are filtered from the float result of the previous level, not
+    // the quantized texels, and sRGB maps in linear light. That makes every
+    // level depend on the whole previous one, so levels are built one after
+    // the other and only the rows of a level are split into bands over the
+    // threads; small levels get bands thin enough to reach every thread.
+    // Levels 1 and 2 are over 90% of the work.
+    //
+    // stb_image_resize would cover the box filter and the sRGB decode, but
+    // it has no Kaiser window, goes from 8 bits to 8 bits on every call (the
+    // chain would be requantized per level or refiltered from level 0) and
+    // cannot renormalize normals.
+    class MipGenerator
+    {
+    public:
+        explicit MipGenerator(const MipGeneratorSettings& settings = MipGeneratorSettings());
+
+        // mips gets levels 1 and up, level 0 stays with the caller
+        void Generate(const uint8_t* texels, uint32_t width, uint32_t height, TextureLayout layout, MipContent content,
+            std::vector<TextureMip>& mips);
+
+        // Levels of a full chain, level 0 included
+        static uint32_t GetMipCount(uint32_t width, uint32_t height);
+
+        const MipGeneratorSettings& GetSettings() const { return m_settings; }
+
+    private:
+        MipGeneratorSettings m_settings;
+        TileScheduler m_scheduler;
+    };
+}
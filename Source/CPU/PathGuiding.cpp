@@ -0,0 +1,303 @@
+#include "CPU/PathGuiding.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CPU
+{
+    namespace
+    {
+        const float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+        inline void AtomicAdd(std::atomic<float>& target, float value)
+        {
+            float current = target.load(std::memory_order_relaxed);
+            while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        inline float2 DirectionToCanonical(const float3& d)
+        {
+            float cosTheta = clamp(d.z, -1.0f, 1.0f);
+            float phi = std::atan2(d.y, d.x);
+            if (phi < 0.0f)
+                phi += PI2;
+            return float2(std::min((cosTheta + 1.0f) * 0.5f, kOneMinusEpsilon), std::min(phi / PI2, kOneMinusEpsilon));
+        }
+
+        inline float3 CanonicalToDirection(const float2& p)
+        {
+            float cosTheta = 2.0f * p.x - 1.0f;
+            float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+            float phi = PI2 * p.y;
+            return float3(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // DTree
+    //-----------------------------------------------------------------------------
+
+    DTree::Node::Node()
+    {
+        for (std::atomic<float>& sum : sums)
+            sum.store(0.0f, std::memory_order_relaxed);
+    }
+
+    DTree::Node::Node(const Node& other)
+    {
+        *this = other;
+    }
+
+    DTree::Node& DTree::Node::operator=(const Node& other)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            sums[i].store(other.sums[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            children[i] = other.children[i];
+        }
+        return *this;
+    }
+
+    float DTree::Node::Sum() const
+    {
+        return sums[0].load(std::memory_order_relaxed) + sums[1].load(std::memory_order_relaxed) +
+            sums[2].load(std::memory_order_relaxed) + sums[3].load(std::memory_order_relaxed);
+    }
+
+    DTree::DTree()
+        : m_nodes(1)
+    {
+    }
+
+    float DTree::GetTotal() const
+    {
+        return m_nodes[0].Sum();
+    }
+
+    void DTree::Record(const float3& direction, float value)
+    {
+        if (!(value > 0.0f) || !std::isfinite(value))
+            return;
+
+        float2 p = DirectionToCanonical(direction);
+        uint32_t node = 0;
+        for (;;)
+        {
+            uint32_t x = p.x >= 0.5f ? 1 : 0;
+            uint32_t y = p.y >= 0.5f ? 1 : 0;
+            uint32_t i = x | y << 1;
+            AtomicAdd(m_nodes[node].sums[i], value);
+
+            node = m_nodes[node].children[i];
+            if (node == 0)
+                return;
+            p = float2(p.x * 2.0f - float(x), p.y * 2.0f - float(y));
+        }
+    }
+
+    float3 DTree::Sample(float2 u) const
+    {
+        // Picks the x half, then the y half within it, by their radiance and
+        // rescales u to the chosen part, down to a leaf which is uniform
+        float2 origin(0.0f);
+        float size = 1.0f;
+        uint32_t node = 0;
+        for (;;)
+        {
+            const Node& n = m_nodes[node];
+            float s[4];
+            for (int i = 0; i < 4; ++i)
+                s[i] = n.sums[i].load(std::memory_order_relaxed);
+
+            float left = s[0] + s[2];
+            float right = s[1] + s[3];
+            if (!(left + right > 0.0f))
+                return CanonicalToDirection(origin + u * size);
+
+            uint32_t x = 0;
+            float pLeft = left / (left + right);
+            if (u.x < pLeft)
+                u.x = std::min(u.x / pLeft, kOneMinusEpsilon);
+            else
+            {
+                x = 1;
+                u.x = std::min((u.x - pLeft) / (1.0f - pLeft), kOneMinusEpsilon);
+            }
+
+            uint32_t y = 0;
+            float pBottom = s[x] / (s[x] + s[x + 2]);
+            if (u.y < pBottom)
+                u.y = std::min(u.y / pBottom, kOneMinusEpsilon);
+            else
+            {
+                y = 1;
+                u.y = std::min((u.y - pBottom) / (1.0f - pBottom), kOneMinusEpsilon);
+            }
+
+            size *= 0.5f;
+            origin = origin + float2(float(x), float(y)) * size;
+            node = n.children[x | y << 1];
+            if (node == 0)
+                return CanonicalToDirection(origin + u * size);
+        }
+    }
+
+    float DTree::Pdf(const float3& direction) const
+    {
+        float2 p = DirectionToCanonical(direction);
+        float pdf = 1.0f / (4.0f * PI);
+        uint32_t node = 0;
+        for (;;)
+        {
+            const Node& n = m_nodes[node];
+            float total = n.Sum();
+            if (total <= 0.0f)
+                return pdf;
+
+            uint32_t x = p.x >= 0.5f ? 1 : 0;
+            uint32_t y = p.y >= 0.5f ? 1 : 0;
+            uint32_t i = x | y << 1;
+            pdf *= 4.0f * n.sums[i].load(std::memory_order_relaxed) / total;
+
+            node = n.children[i];
+            if (node == 0 || pdf == 0.0f)
+                return pdf;
+            p = float2(p.x * 2.0f - float(x), p.y * 2.0f - float(y));
+        }
+    }
+
+    void DTree::Refine(float threshold, uint32_t maxDepth)
+    {
+        std::vector<Node> source;
+        source.swap(m_nodes);
+        const float total = source[0].Sum();
+        if (total <= 0.0f)
+        {
+            // Nothing was recorded, keep the structure
+            for (Node& node : source)
+            {
+                for (std::atomic<float>& sum : node.sums)
+                    sum.store(0.0f, std::memory_order_relaxed);
+            }
+            m_nodes.swap(source);
+            return;
+        }
+        Subdivide(source, 0, total, threshold * total, 1, maxDepth);
+    }
+
+    uint32_t DTree::Subdivide(const std::vector<Node>& source, uint32_t sourceNode, float flux, float minFlux,
+        uint32_t depth, uint32_t maxDepth)
+    {
+        // sourceNode == kInvalidIndex: a leaf of the source split further,
+        // its flux is assumed uniform
+        const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            float childFlux = sourceNode != kInvalidIndex ? source[sourceNode].sums[i].load(std::memory_order_relaxed) : flux * 0.25f;
+            if (depth >= maxDepth || childFlux <= minFlux)
+                continue;
+
+            uint32_t sourceChild = sourceNode != kInvalidIndex ? source[sourceNode].children[i] : 0;
+            uint32_t child = Subdivide(source, sourceChild != 0 ? sourceChild : kInvalidIndex, childFlux, minFlux, depth + 1, maxDepth);
+            m_nodes[index].children[i] = child;
+        }
+        return index;
+    }
+
+    //-----------------------------------------------------------------------------
+    // SDTree
+    //-----------------------------------------------------------------------------
+
+    SDTree::SDTree(const AABB& bounds)
+        : m_nodes(1)
+    {
+        // A cube, so halving along x, y, z in turn keeps the cells cubes
+        float3 extent = bounds.boundsMax - bounds.boundsMin;
+        float size = std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-3f)) * 1.001f;
+        m_bounds.boundsMin = bounds.boundsMin - float3(size * 0.0005f);
+        m_bounds.boundsMax = m_bounds.boundsMin + float3(size);
+        m_leaves.push_back(std::make_unique<Leaf>());
+    }
+
+    uint32_t SDTree::FindLeaf(const float3& position) const
+    {
+        float3 lower = m_bounds.boundsMin;
+        float3 upper = m_bounds.boundsMax;
+        uint32_t node = 0;
+        while (m_nodes[node].child != 0)
+        {
+            uint32_t axis = m_nodes[node].depth % 3;
+            float middle = (lower[axis] + upper[axis]) * 0.5f;
+            if (position[axis] < middle)
+            {
+                upper[axis] = middle;
+                node = m_nodes[node].child;
+            }
+            else
+            {
+                lower[axis] = middle;
+                node = m_nodes[node].child + 1;
+            }
+        }
+        return m_nodes[node].leaf;
+    }
+
+    void SDTree::Record(const float3& position, const float3& direction, float value)
+    {
+        Leaf& leaf = *m_leaves[FindLeaf(position)];
+        leaf.recordCount.fetch_add(1, std::memory_order_relaxed);
+        leaf.building.Record(direction, value);
+    }
+
+    void SDTree::Refine(uint32_t frameCount, float spatialThreshold)
+    {
+        for (std::unique_ptr<Leaf>& leaf : m_leaves)
+            leaf->sampling = leaf->building;
+
+        // Both halves of a split leaf start from its trees and half its
+        // records; the loop reaches the new nodes too, so a leaf is split
+        // until its halves are below the threshold
+        const float maxRecords = spatialThreshold * std::sqrt(float(std::max(frameCount, 1u)));
+        for (size_t n = 0; n < m_nodes.size(); ++n)
+        {
+            if (m_nodes[n].child != 0 || m_nodes[n].depth >= kMaxSpatialDepth)
+                continue;
+            Leaf& leaf = *m_leaves[m_nodes[n].leaf];
+            const uint32_t records = leaf.recordCount.load(std::memory_order_relaxed);
+            if (float(records) <= maxRecords)
+                continue;
+
+            leaf.recordCount.store(records / 2, std::memory_order_relaxed);
+            auto copy = std::make_unique<Leaf>();
+            copy->sampling = leaf.sampling;
+            copy->building = leaf.building;
+            copy->recordCount.store(records / 2, std::memory_order_relaxed);
+
+            Node first, second;
+            first.leaf = m_nodes[n].leaf;
+            second.leaf = static_cast<uint32_t>(m_leaves.size());
+            first.depth = second.depth = m_nodes[n].depth + 1;
+            m_leaves.push_back(std::move(copy));
+
+            m_nodes[n].child = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.push_back(first);
+            m_nodes.push_back(second);
+        }
+
+        for (std::unique_ptr<Leaf>& leaf : m_leaves)
+        {
+            leaf->building.Refine(kDirectionalThreshold, kMaxDirectionalDepth);
+            leaf->recordCount.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t SDTree::GetDirectionalNodeCount() const
+    {
+        size_t count = 0;
+        for (const std::unique_ptr<Leaf>& leaf : m_leaves)
+            count += leaf->sampling.GetNodeCount();
+        return count;
+    }
+}
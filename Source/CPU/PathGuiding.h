@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "CPU/Ray.h"
+
+namespace CPU
+{
+    // Directional quadtree of "Practical Path Guiding" (Mueller et al. 2017)
+    // over the cylindrical mapping (cos theta around +z, phi) of the sphere,
+    // which keeps areas. A node holds the radiance arriving through each of
+    // its four quadrants; quadrants holding a large part of it are split
+    // when the tree is refined, so the tree follows the bright directions.
+    // Record() adds with atomics and may run on several threads; the
+    // structure itself only changes in Refine().
+    class DTree
+    {
+    public:
+        DTree();
+
+        // value is the radiance estimate divided by the pdf of the direction
+        void Record(const float3& direction, float value);
+
+        // Direction proportional to the recorded radiance and its solid
+        // angle pdf. Only meaningful when !IsEmpty().
+        float3 Sample(float2 u) const;
+        float Pdf(const float3& direction) const;
+
+        bool IsEmpty() const { return GetTotal() <= 0.0f; }
+        float GetTotal() const;
+        size_t GetNodeCount() const { return m_nodes.size(); }
+
+        // Rebuilds the structure from the recorded radiance: quadrants with
+        // more than threshold of the total are split, down to maxDepth
+        // levels, the others merged. The new tree has no radiance.
+        void Refine(float threshold, uint32_t maxDepth);
+
+    private:
+        // Children 0 = leaf (the root is never a child). Quadrant i covers
+        // x half i & 1, y half i >> 1.
+        struct Node
+        {
+            std::atomic<float> sums[4];
+            uint32_t children[4] = {};
+
+            Node();
+            Node(const Node& other);
+            Node& operator=(const Node& other);
+            float Sum() const;
+        };
+
+        uint32_t Subdivide(const std::vector<Node>& source, uint32_t sourceNode, float flux, float minFlux,
+            uint32_t depth, uint32_t maxDepth);
+
+        std::vector<Node> m_nodes;
+    };
+
+    // Spatial binary tree of the SD-tree over a cube around the scene: every
+    // leaf holds the DTree guiding the samples of its region (learned over
+    // the previous iterations) and the one the current iteration records
+    // into. Leaves that received many records are halved along x, y, z in
+    // turn at the end of an iteration.
+    class SDTree
+    {
+    public:
+        explicit SDTree(const AABB& bounds);
+
+        const DTree& GetSamplingTree(const float3& position) const { return m_leaves[FindLeaf(position)]->sampling; }
+
+        // Thread safe, one per path vertex
+        void Record(const float3& position, const float3& direction, float value);
+
+        // End of training iteration (0, 1, ...) that rendered frameCount
+        // frames: the recorded trees become the sampling trees, leaves with
+        // more than spatialThreshold * sqrt(frameCount) records are split
+        // and the recording trees refined for the next iteration
+        void Refine(uint32_t frameCount, float spatialThreshold);
+
+        size_t GetLeafCount() const { return m_leaves.size(); }
+        size_t GetDirectionalNodeCount() const;
+
+    private:
+        static const uint32_t kMaxSpatialDepth = 24;
+        static const uint32_t kMaxDirectionalDepth = 20;
+        static constexpr float kDirectionalThreshold = 0.01f;
+
+        struct Node
+        {
+            uint32_t child = 0;         // first of two, 0 = leaf
+            uint32_t leaf = 0;
+            uint32_t depth = 0;         // split axis depth % 3
+        };
+
+        struct Leaf
+        {
+            DTree sampling;
+            DTree building;
+            std::atomic<uint32_t> recordCount{ 0 };
+        };
+
+        uint32_t FindLeaf(const float3& position) const;
+
+        AABB m_bounds;
+        std::vector<Node> m_nodes;
+        std::vector<std::unique_ptr<Leaf>> m_leaves;
+    };
+}
@@ -0,0 +1,1018 @@
+#include <algorithm>
+#include <cmath>
+#include "CPU/PathTracer.h"
+#include "CPU/Disney.h"
+#include "CPU/Timer.h"
+
+namespace CPU
+{
+    namespace
+    {
+        inline uint8_t ToUnorm8(float x)
+        {
+            return static_cast<uint8_t>(saturate(x) * 255.0f + 0.5f);
+        }
+
+        // Per thread counters on their own cache line
+        struct alignas(64) ThreadCounters
+        {
+            RenderStats stats;
+        };
+
+        // Standard error of the mean luminance relative to the mean, the
+        // estimate RayGen uses for ADAPTIVE_THRESHOLD
+        inline float RelativeError(const float2& moments, float count)
+        {
+            if (count < 2.0f)
+                return INFINITY;
+            float variance = moments.y / (count - 1.0f);
+            return std::sqrt(variance / count) / std::max(moments.x, 1e-3f);
+        }
+
+        inline float3 SafeInverse(const float3& v)
+        {
+            return float3(v.x > 0.0f ? 1.0f / v.x : 0.0f, v.y > 0.0f ? 1.0f / v.y : 0.0f, v.z > 0.0f ? 1.0f / v.z : 0.0f);
+        }
+
+        // A bounce of a path recorded for guiding, radiance sums what the
+        // path found past it
+        struct GuidingVertex
+        {
+            float3 position;
+            float3 direction;
+            float pdf;
+            float3 inverseThroughput;
+            float3 radiance;
+        };
+
+        const uint32_t kMaxGuidingVertices = 32;
+        const uint32_t kMaxFireflyBuckets = 32;
+        const float kOneMinusEpsilon = 0x1.fffffep-1f;
+    }
+
+    // Scratch memory of one wavefront batch. Path state is indexed by the
+    // pixel of the tile, the queues hold path indices.
+    struct PathTracer::WavefrontState
+    {
+        // Path state
+        std::vector<Ray> rays;
+        std::vector<Hit> hits;
+        std::vector<float3> throughput;
+        std::vector<float3> radiance;
+        std::vector<float> bsdfPdf;             // pdf of the last bounce, 0 for camera rays
+        std::vector<float3> bsdfNormal;         // normal at the origin of the last bounce
+        std::vector<uint32_t> materialIndex;
+
+        // Queues
+        std::vector<uint32_t> generated;        // paths started by ray generation
+        std::vector<uint32_t> active;           // paths extended this bounce
+        std::vector<uint32_t> next;             // paths continuing to the next bounce
+        std::vector<uint32_t> shadeQueue;       // hit paths grouped by material
+        std::vector<uint32_t> materialOffsets;  // start of every material in shadeQueue
+        std::vector<uint32_t> materialCursor;
+
+        // SoA shading inputs / outputs in shadeQueue order
+        std::vector<float3> positions;
+        std::vector<float> seedX, seedY, seed1, pdf;
+        float3Array V, N, T, B, L, f;
+
+        // Shadow rays queued by the shading stage
+        std::vector<Ray> shadowRays;
+        std::vector<float3> shadowContribution;
+        std::vector<uint32_t> shadowPath;
+        std::vector<uint8_t> occluded;
+
+        void Resize(uint32_t pathCount)
+        {
+            rays.resize(pathCount);
+            hits.resize(pathCount);
+            throughput.resize(pathCount);
+            radiance.resize(pathCount);
+            bsdfPdf.resize(pathCount);
+            bsdfNormal.resize(pathCount);
+            materialIndex.resize(pathCount);
+            generated.reserve(pathCount);
+            active.reserve(pathCount);
+            next.reserve(pathCount);
+            shadeQueue.resize(pathCount);
+
+            positions.resize(pathCount);
+            seedX.resize(pathCount);
+            seedY.resize(pathCount);
+            seed1.resize(pathCount);
+            pdf.resize(pathCount);
+            for (float3Array* a : { &V, &N, &T, &B, &L, &f })
+                a->Resize(pathCount);
+        }
+    };
+
+    PathTracer::PathTracer(const Scene& scene, const PathTracerSettings& settings)
+        : m_scene(scene), m_settings(settings), m_scheduler(settings.threadCount)
+    {
+        m_settings.threadCount = m_scheduler.GetThreadCount();
+        m_settings.tileSize = std::max(1u, m_settings.tileSize);
+        m_settings.wavefrontTileSize = std::max(1u, m_settings.wavefrontTileSize);
+        m_settings.guidingTrainingIterations = std::min(m_settings.guidingTrainingIterations, 24u);
+        m_settings.fireflyBuckets = std::min(std::max(m_settings.fireflyBuckets, 1u), kMaxFireflyBuckets);
+        if (m_settings.pathGuiding)
+            m_settings.mode = PathTracerMode::DepthFirst;
+        const uint32_t tileSize = m_settings.mode == PathTracerMode::Wavefront ? m_settings.wavefrontTileSize : m_settings.tileSize;
+        m_tiles = CreateTiles(m_settings.width, m_settings.height, tileSize, m_settings.tileOrder);
+        m_scheduler.SetWorkStealing(m_settings.workStealing);
+
+        if (m_settings.mode == PathTracerMode::Wavefront)
+        {
+            for (uint32_t i = 0; i < m_scheduler.GetThreadCount(); ++i)
+            {
+                m_wavefrontStates.push_back(std::make_unique<WavefrontState>());
+                m_wavefrontStates.back()->Resize(tileSize * tileSize);
+            }
+        }
+
+        if (m_settings.fireflyFilter == FireflyFilter::Clamp)
+            m_threadHistograms.resize(m_scheduler.GetThreadCount());
+
+        m_camera.Update(float(m_settings.width) / float(m_settings.height));
+        m_aovs.Resize(m_settings.aovs, size_t(m_settings.width) * m_settings.height);
+        Reset();
+        if (m_settings.temporalReprojection)
+            ReprojectHistory(nullptr);
+    }
+
+    PathTracer::~PathTracer()
+    {
+    }
+
+    void PathTracer::Reset(uint32_t firstFrameIndex)
+    {
+        m_firstFrameIndex = firstFrameIndex;
+        m_frameCount = 0;
+        ClearAccumulation();
+
+        if (m_settings.pathGuiding)
+        {
+            m_guiding = std::make_unique<SDTree>(m_scene.GetBounds());
+            m_guidingIteration = 0;
+            m_guidingFrames = 0;
+        }
+    }
+
+    void PathTracer::SetCamera(const Camera& camera)
+    {
+        Camera previous = m_camera;
+        m_camera = camera;
+        m_camera.Update(float(m_settings.width) / float(m_settings.height));
+        if (m_settings.temporalReprojection)
+            ReprojectHistory(&previous);
+        else
+            Reset();
+    }
+
+    void PathTracer::ReprojectHistory(const Camera* previous)
+    {
+        const uint32_t width = m_settings.width;
+        const uint32_t height = m_settings.height;
+        const size_t pixelCount = size_t(width) * height;
+
+        std::vector<float> depth(pixelCount, INFINITY);
+        std::vector<float3> normals(pixelCount, float3(0.0f));
+        std::vector<float2> motion(pixelCount, float2(0.0f));
+        std::vector<float4> accumulation(pixelCount, float4(0.0f));
+        std::vector<float2> moments(pixelCount, float2(0.0f));
+        std::vector<float4> buckets(previous ? m_buckets.size() : 0, float4(0.0f));
+        const uint32_t bucketCount = m_buckets.empty() ? 0 : m_settings.fireflyBuckets;
+
+        float4x4 previousViewProjection;
+        float3 previousEye(0.0f);
+        if (previous)
+        {
+            previousViewProjection = mul(previous->projection, previous->view);
+            previousEye = TransformPoint(previous->viewI, float3(0.0f));
+        }
+        const float maxHistory = float(std::max(1u, m_settings.maxHistoryLength));
+
+        m_scheduler.Run(static_cast<uint32_t>(m_tiles.size()), [&](uint32_t tileIndex, uint32_t)
+            {
+                const Tile& tile = m_tiles[tileIndex];
+                for (uint32_t y = tile.y0; y < tile.y1; ++y)
+                {
+                    for (uint32_t x = tile.x0; x < tile.x1; ++x)
+                    {
+                        // The camera ray of RenderTile, the sky restarts: it
+                        // is exact after one sample anyway
+                        const size_t pixel = size_t(y) * width + x;
+                        Ray ray = m_camera.GenerateRay(float2(x + 0.5f, y + 0.5f), width, height);
+                        Hit hit;
+                        if (!m_scene.Intersect(ray, hit))
+                            continue;
+                        SurfaceHit surface = m_scene.GetSurfaceHit(ray, hit);
+                        depth[pixel] = hit.t;
+                        normals[pixel] = surface.normal;
+                        if (!previous)
+                            continue;
+
+                        float4 clip = mul(previousViewProjection, float4(surface.position, 1.0f));
+                        if (clip.w <= 0.0f)
+                            continue;
+                        float2 position((clip.x / clip.w * 0.5f + 0.5f) * width, (-clip.y / clip.w * 0.5f + 0.5f) * height);
+                        motion[pixel] = position - float2(x + 0.5f, y + 0.5f);
+
+                        // Bilinear taps around the previous position that saw
+                        // the same surface
+                        const float expectedDepth = length(surface.position - previousEye);
+                        const float fx = position.x - 0.5f;
+                        const float fy = position.y - 0.5f;
+                        const int x0 = int(std::floor(fx));
+                        const int y0 = int(std::floor(fy));
+                        const float tx = fx - float(x0);
+                        const float ty = fy - float(y0);
+
+                        float4 sum(0.0f);
+                        float2 momentSum(0.0f);
+                        float4 bucketSums[kMaxFireflyBuckets];
+                        std::fill(bucketSums, bucketSums + bucketCount, float4(0.0f));
+                        float weightSum = 0.0f;
+                        for (int tap = 0; tap < 4; ++tap)
+                        {
+                            const int px = x0 + (tap & 1);
+                            const int py = y0 + (tap >> 1);
+                            if (px < 0 || py < 0 || px >= int(width) || py >= int(height))
+                                continue;
+                            const size_t q = size_t(py) * width + px;
+                            if (m_accumulation[q].w == 0.0f ||
+                                std::abs(m_depth[q] - expectedDepth) > m_settings.reprojectionDepthTolerance * expectedDepth ||
+                                dot(m_normals[q], surface.normal) < m_settings.reprojectionNormalTolerance)
+                                continue;
+
+                            const float weight = ((tap & 1) ? tx : 1.0f - tx) * ((tap >> 1) ? ty : 1.0f - ty);
+                            sum += m_accumulation[q] * weight;
+                            momentSum = momentSum + m_moments[q] * weight;
+                            for (uint32_t b = 0; b < bucketCount; ++b)
+                                bucketSums[b] += m_buckets[q * bucketCount + b] * weight;
+                            weightSum += weight;
+                        }
+                        if (weightSum < 1e-3f)
+                            continue;
+
+                        // Sum and M2 grow with the sample count, both are
+                        // scaled down to the clamped history
+                        float4 history = sum * (1.0f / weightSum);
+                        float2 historyMoments = momentSum * (1.0f / weightSum);
+                        const float scale = std::min(history.w, maxHistory) / history.w;
+                        accumulation[pixel] = history * scale;
+                        moments[pixel] = float2(historyMoments.x, historyMoments.y * scale);
+                        for (uint32_t b = 0; b < bucketCount; ++b)
+                            buckets[pixel * bucketCount + b] = bucketSums[b] * (scale / weightSum);
+                    }
+                }
+            });
+
+        m_depth.swap(depth);
+        m_normals.swap(normals);
+        m_motion.swap(motion);
+        if (previous)
+        {
+            m_accumulation.swap(accumulation);
+            m_moments.swap(moments);
+            m_buckets.swap(buckets);
+            m_tileConverged.assign(m_tiles.size(), 0);
+        }
+    }
+
+    void PathTracer::ClearAccumulation()
+    {
+        m_accumulation.assign(size_t(m_settings.width) * m_settings.height, float4(0.0f));
+        m_moments.assign(m_accumulation.size(), float2(0.0f));
+        m_tileConverged.assign(m_tiles.size(), 0);
+
+        if (m_settings.fireflyFilter == FireflyFilter::TrimmedBucketMean)
+            m_buckets.assign(m_accumulation.size() * m_settings.fireflyBuckets, float4(0.0f));
+        m_luminanceHistogram.Clear();
+        m_clampThreshold = INFINITY;
+    }
+
+    void PathTracer::UpdateGuiding()
+    {
+        // Training iteration i renders 2^i frames. Its image is dropped at
+        // the end: the next iteration samples a better distribution and
+        // renders as many frames as all the earlier ones together.
+        if (!IsGuidingTraining() || ++m_guidingFrames < (1u << m_guidingIteration))
+            return;
+
+        m_guiding->Refine(m_guidingFrames, m_settings.guidingSpatialThreshold);
+        m_guidingFrames = 0;
+        m_guidingIteration++;
+        ClearAccumulation();
+    }
+
+    float PathTracer::GetRelativeError(size_t pixel) const
+    {
+        return RelativeError(m_moments[pixel], m_accumulation[pixel].w);
+    }
+
+    bool PathTracer::IsPixelConverged(size_t pixel) const
+    {
+        return m_settings.adaptiveSampling &&
+            m_accumulation[pixel].w >= float(std::max(2u, m_settings.adaptiveMinSamples)) &&
+            GetRelativeError(pixel) < m_settings.adaptiveThreshold;
+    }
+
+    uint32_t PathTracer::GetActiveTileCount() const
+    {
+        return static_cast<uint32_t>(std::count(m_tileConverged.begin(), m_tileConverged.end(), uint8_t(0)));
+    }
+
+    void PathTracer::AddSample(size_t pixel, float3 color, uint32_t threadIndex)
+    {
+        if (m_settings.fireflyFilter == FireflyFilter::Clamp)
+        {
+            m_threadHistograms[threadIndex].Add(Luminance(color));
+            color = ClampLuminance(color, m_clampThreshold);
+        }
+        if (!m_buckets.empty())
+            m_buckets[pixel * m_settings.fireflyBuckets + m_frameCount % m_settings.fireflyBuckets] += float4(color, 1.0f);
+
+        // gAccumulation[launchIndex] += float4(color, 1)
+        float4& sum = m_accumulation[pixel];
+        sum += float4(color, 1.0f);
+
+        // Welford update of the luminance mean / M2, as gVariance
+        float2& moments = m_moments[pixel];
+        float luminance = Luminance(color);
+        float delta = luminance - moments.x;
+        moments.x += delta / sum.w;
+        moments.y += delta * (luminance - moments.x);
+    }
+
+    void PathTracer::UpdateTileConvergence(uint32_t tileIndex)
+    {
+        if (!m_settings.adaptiveSampling)
+            return;
+
+        const Tile& tile = m_tiles[tileIndex];
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                if (!IsPixelConverged(size_t(y) * m_settings.width + x))
+                    return;
+            }
+        }
+        m_tileConverged[tileIndex] = 1;
+    }
+
+    float3 PathTracer::ResolvePixel(size_t pixel) const
+    {
+        const float4& sum = m_accumulation[pixel];
+        const float3 mean = float3(sum.x, sum.y, sum.z) * (1.0f / std::max(sum.w, 1.0f));
+        if (m_buckets.empty())
+            return mean;
+
+        // Bucket means sorted by luminance, the empty ones (fewer frames
+        // than buckets) left out
+        const uint32_t bucketCount = m_settings.fireflyBuckets;
+        const float4* buckets = &m_buckets[pixel * bucketCount];
+        float3 means[kMaxFireflyBuckets];
+        float luminances[kMaxFireflyBuckets];
+        uint32_t count = 0;
+        for (uint32_t b = 0; b < bucketCount; ++b)
+        {
+            if (buckets[b].w == 0.0f)
+                continue;
+            float3 mean = float3(buckets[b].x, buckets[b].y, buckets[b].z) * (1.0f / buckets[b].w);
+            float luminance = Luminance(mean);
+            uint32_t i = count++;
+            for (; i > 0 && luminances[i - 1] > luminance; --i)
+            {
+                means[i] = means[i - 1];
+                luminances[i] = luminances[i - 1];
+            }
+            means[i] = mean;
+            luminances[i] = luminance;
+        }
+        if (count == 0)
+            return float3(0.0f);
+
+        // Gini coefficient of the bucket luminances: 0 when they agree, the
+        // plain mean is kept, towards 1 when one bucket holds most of the
+        // energy (Buisine et al. 2021, GiniMoN)
+        float weightedSum = 0.0f;
+        float luminanceSum = 0.0f;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            weightedSum += float(i + 1) * luminances[i];
+            luminanceSum += luminances[i];
+        }
+        const float gini = luminanceSum > 0.0f ? 2.0f * weightedSum / (float(count) * luminanceSum) - float(count + 1) / float(count) : 0.0f;
+        if (gini < m_settings.fireflyGiniThreshold)
+            return mean;
+
+        // Trimmed mean of the buckets: only the darkest and the brightest are
+        // dropped, a plain median throws away too much of the rare but real
+        // energy (small lights seen in glossy reflections) and stays biased
+        if (count <= 2)
+            return count == 1 ? means[0] : (means[0] + means[1]) * 0.5f;
+        float3 trimmed(0.0f);
+        for (uint32_t i = 1; i + 1 < count; ++i)
+            trimmed += means[i];
+        return trimmed * (1.0f / float(count - 2));
+    }
+
+    void PathTracer::ResolveHDR(std::vector<float>& rgb) const
+    {
+        rgb.resize(m_accumulation.size() * 3);
+        for (size_t i = 0; i < m_accumulation.size(); ++i)
+        {
+            float3 color = ResolvePixel(i);
+            rgb[i * 3 + 0] = color.x;
+            rgb[i * 3 + 1] = color.y;
+            rgb[i * 3 + 2] = color.z;
+        }
+    }
+
+    void PathTracer::ResolveRGBA8(std::vector<uint8_t>& rgba) const
+    {
+        // Quantize only here, the sum itself stays float
+        rgba.resize(m_accumulation.size() * 4);
+        for (size_t i = 0; i < m_accumulation.size(); ++i)
+        {
+            float3 color = ResolvePixel(i);
+            rgba[i * 4 + 0] = ToUnorm8(color.x);
+            rgba[i * 4 + 1] = ToUnorm8(color.y);
+            rgba[i * 4 + 2] = ToUnorm8(color.z);
+            rgba[i * 4 + 3] = 255;
+        }
+    }
+
+    void PathTracer::ResolveVariance(std::vector<float>& variance, uint32_t minSamples) const
+    {
+        variance.resize(m_accumulation.size());
+        for (size_t i = 0; i < m_accumulation.size(); ++i)
+        {
+            const float count = m_accumulation[i].w;
+            variance[i] = count < float(std::max(2u, minSamples)) ? -1.0f : m_moments[i].y / ((count - 1.0f) * count);
+        }
+    }
+
+    void PathTracer::RenderFeatures(std::vector<float3>& albedo, std::vector<float3>& normals, std::vector<float>& depth)
+    {
+        const uint32_t width = m_settings.width;
+        const uint32_t height = m_settings.height;
+        albedo.assign(m_accumulation.size(), float3(1.0f));
+        normals.assign(m_accumulation.size(), float3(0.0f));
+        depth.assign(m_accumulation.size(), INFINITY);
+
+        m_scheduler.Run(static_cast<uint32_t>(m_tiles.size()), [&](uint32_t tileIndex, uint32_t)
+            {
+                const Tile& tile = m_tiles[tileIndex];
+                for (uint32_t y = tile.y0; y < tile.y1; ++y)
+                {
+                    for (uint32_t x = tile.x0; x < tile.x1; ++x)
+                    {
+                        const size_t pixel = size_t(y) * width + x;
+                        Ray ray = m_camera.GenerateRay(float2(x + 0.5f, y + 0.5f), width, height);
+                        Hit hit;
+                        if (!m_scene.Intersect(ray, hit))
+                            continue;
+                        FirstHit first = GetFirstHit(ray, hit);
+                        albedo[pixel] = first.albedo;
+                        normals[pixel] = first.normal;
+                        depth[pixel] = first.depth;
+                    }
+                }
+            });
+    }
+
+    RenderStats PathTracer::RenderFrame()
+    {
+        Timer timer;
+        std::vector<ThreadCounters> counters(m_scheduler.GetThreadCount());
+
+        // Converged tiles are retired, the scheduler only sees the rest
+        m_activeTiles.clear();
+        for (uint32_t i = 0; i < m_tiles.size(); ++i)
+        {
+            if (!m_tileConverged[i])
+                m_activeTiles.push_back(i);
+        }
+
+        m_scheduler.Run(static_cast<uint32_t>(m_activeTiles.size()), [&](uint32_t activeIndex, uint32_t threadIndex)
+            {
+                uint32_t tileIndex = m_activeTiles[activeIndex];
+                RenderStats& stats = counters[threadIndex].stats;
+                if (m_settings.mode == PathTracerMode::Wavefront)
+                    RenderTileWavefront(m_tiles[tileIndex], threadIndex, *m_wavefrontStates[threadIndex], stats);
+                else
+                    RenderTile(m_tiles[tileIndex], threadIndex, stats);
+                UpdateTileConvergence(tileIndex);
+            });
+
+        // The clamp of the next frame from every sample so far
+        if (m_settings.fireflyFilter == FireflyFilter::Clamp)
+        {
+            for (LuminanceHistogram& histogram : m_threadHistograms)
+            {
+                m_luminanceHistogram.Merge(histogram);
+                histogram.Clear();
+            }
+            m_clampThreshold = m_luminanceHistogram.GetClampThreshold(m_settings.fireflyBiasBudget);
+        }
+
+        m_frameCount++;
+        UpdateGuiding();
+
+        RenderStats stats;
+        for (const ThreadCounters& counter : counters)
+        {
+            stats.samples += counter.stats.samples;
+            stats.rays += counter.stats.rays;
+        }
+        stats.seconds = timer.GetSeconds();
+        return stats;
+    }
+
+    void PathTracer::RenderTile(const Tile& tile, uint32_t threadIndex, RenderStats& stats)
+    {
+        const uint32_t width = m_settings.width;
+        const uint32_t height = m_settings.height;
+
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                size_t pixel = size_t(y) * width + x;
+                if (IsPixelConverged(pixel))
+                    continue;
+
+                Ray ray = m_camera.GenerateRay(float2(x + 0.5f, y + 0.5f) + m_jitter, width, height);
+                FirstHit firstHit;
+                AddSample(pixel, TracePath(ray, x, y, m_firstFrameIndex + m_frameCount, stats.rays, m_aovs.flags ? &firstHit : nullptr), threadIndex);
+                if (m_aovs.flags)
+                    m_aovs.Write(pixel, firstHit);
+                stats.samples++;
+            }
+        }
+    }
+
+    void PathTracer::RenderTileWavefront(const Tile& tile, uint32_t threadIndex, WavefrontState& state, RenderStats& stats)
+    {
+        const uint32_t width = m_settings.width;
+        const uint32_t height = m_settings.height;
+        const uint32_t tileWidth = tile.x1 - tile.x0;
+        const uint32_t frameIndex = m_firstFrameIndex + m_frameCount;
+        const uint32_t materialCount = static_cast<uint32_t>(m_scene.GetMaterials().size());
+        const std::vector<Instance>& instances = m_scene.GetInstances();
+
+        // Ray generation: one camera ray per pixel of the tile that has not
+        // converged yet
+        state.active.clear();
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                if (IsPixelConverged(size_t(y) * width + x))
+                    continue;
+
+                uint32_t path = (y - tile.y0) * tileWidth + (x - tile.x0);
+                state.rays[path] = m_camera.GenerateRay(float2(x + 0.5f, y + 0.5f) + m_jitter, width, height);
+                state.throughput[path] = float3(1.0f);
+                state.radiance[path] = float3(0.0f);
+                state.bsdfPdf[path] = 0.0f;
+                state.active.push_back(path);
+            }
+        }
+        state.generated.assign(state.active.begin(), state.active.end());
+        stats.samples += state.generated.size();
+
+        for (uint32_t depth = 0; !state.active.empty(); ++depth)
+        {
+            // Extension: closest hit of every active path, nothing else
+            for (uint32_t path : state.active)
+            {
+                state.hits[path] = Hit();
+                m_scene.Intersect(state.rays[path], state.hits[path]);
+            }
+            stats.rays += state.active.size();
+
+            // Misses pick up the sky, hits their emission. Paths past maxDepth
+            // or on a light end, the rest are bucketed by material (counting
+            // sort)
+            state.materialOffsets.assign(materialCount + 1, 0);
+            uint32_t shadeCount = 0;
+            for (uint32_t path : state.active)
+            {
+                const Hit& hit = state.hits[path];
+                if (depth == 0 && m_aovs.flags)
+                {
+                    size_t pixel = size_t(tile.y0 + path / tileWidth) * width + tile.x0 + path % tileWidth;
+                    m_aovs.Write(pixel, hit.IsValid() ? GetFirstHit(state.rays[path], hit) : FirstHit());
+                }
+                if (!hit.IsValid())
+                {
+                    state.radiance[path] += state.throughput[path] * MissColor(state.rays[path], tile.y0 + path / tileWidth, state.bsdfPdf[path]);
+                    continue;
+                }
+                state.radiance[path] += state.throughput[path] * Emission(state.rays[path], hit, state.bsdfPdf[path], state.bsdfNormal[path]);
+                if (depth >= m_settings.maxDepth)
+                    continue;
+
+                uint32_t material = instances[hit.instanceIndex].materialIndex;
+                if (m_scene.GetMaterial(material).type == MaterialType::Light)
+                    continue;
+                state.materialIndex[path] = material;
+                state.materialOffsets[material + 1]++;
+                state.active[shadeCount++] = path;
+            }
+            for (uint32_t m = 0; m < materialCount; ++m)
+                state.materialOffsets[m + 1] += state.materialOffsets[m];
+            state.materialCursor.assign(state.materialOffsets.begin(), state.materialOffsets.end() - 1);
+            for (uint32_t i = 0; i < shadeCount; ++i)
+            {
+                uint32_t path = state.active[i];
+                state.shadeQueue[state.materialCursor[state.materialIndex[path]]++] = path;
+            }
+
+            // Shading: one material at a time, same math as TracePath. The
+            // hits of a material are gathered into SoA streams and sampled /
+            // evaluated by the Disney kernels in one go, light samples are
+            // queued as shadow rays on the way.
+            state.next.clear();
+            for (uint32_t m = 0; m < materialCount; ++m)
+            {
+                const uint32_t begin = state.materialOffsets[m];
+                const uint32_t count = state.materialOffsets[m + 1] - begin;
+                if (count == 0)
+                    continue;
+
+                const Material& material = m_scene.GetMaterial(m);
+                for (uint32_t i = begin; i < begin + count; ++i)
+                {
+                    uint32_t path = state.shadeQueue[i];
+                    const uint32_t x = tile.x0 + path % tileWidth;
+                    const uint32_t y = tile.y0 + path / tileWidth;
+                    const Ray& ray = state.rays[path];
+                    SurfaceHit surface = m_scene.GetSurfaceHit(ray, state.hits[path]);
+
+                    Ray shadowRay;
+                    float3 direct;
+                    if (m_settings.nextEventEstimation &&
+                        SampleDirect(surface, material, normalize(-ray.direction), LightSeed(x, y, frameIndex, depth), nullptr, shadowRay, direct))
+                    {
+                        state.shadowRays.push_back(shadowRay);
+                        state.shadowContribution.push_back(state.throughput[path] * direct);
+                        state.shadowPath.push_back(path);
+                    }
+
+                    float2 seed = BounceSeed(x, y, frameIndex, depth, ray, state.hits[path]);
+
+                    state.positions[i] = surface.position;
+                    state.seedX[i] = seed.x;
+                    state.seedY[i] = seed.y;
+                    state.seed1[i] = LobeSeed(x, y, frameIndex, depth, seed);
+                    state.V.Set(i, normalize(-ray.direction));
+                    state.N.Set(i, surface.normal);
+                    state.T.Set(i, surface.tangent);
+                    state.B.Set(i, surface.bitangent);
+                }
+
+                Disney_BRDF_Sample_SoA(material, &state.seedX[begin], &state.seedY[begin], &state.seed1[begin],
+                    state.V.SoA(begin), state.N.SoA(begin), state.T.SoA(begin), state.B.SoA(begin),
+                    state.L.SoA(begin), &state.pdf[begin], count, m_settings.shadingWidth);
+                Disney_BRDF_SoA(material, state.L.SoA(begin), state.V.SoA(begin), state.N.SoA(begin),
+                    state.f.SoA(begin), count, m_settings.shadingWidth);
+
+                for (uint32_t i = begin; i < begin + count; ++i)
+                {
+                    uint32_t path = state.shadeQueue[i];
+                    float3 bounceDir = state.L.Get(i);
+                    float3 brdf = state.f.Get(i);
+                    float cosI = dot(state.N.Get(i), bounceDir);
+
+                    float3& throughput = state.throughput[path];
+                    throughput *= brdf * cosI / state.pdf[i];
+                    if (throughput.x == 0.0f && throughput.y == 0.0f && throughput.z == 0.0f)
+                        continue;
+                    if (!SurvivesRoulette(throughput, tile.x0 + path % tileWidth, tile.y0 + path / tileWidth, frameIndex, depth))
+                        continue;
+
+                    state.bsdfPdf[path] = state.pdf[i];
+                    state.bsdfNormal[path] = state.N.Get(i);
+                    state.rays[path] = Ray(state.positions[i], bounceDir, 0.01f, 1000.0f);
+                    state.next.push_back(path);
+                }
+            }
+
+            // Shadow rays: any-hit packets over everything shading queued
+            if (!state.shadowRays.empty())
+            {
+                uint32_t shadowCount = static_cast<uint32_t>(state.shadowRays.size());
+                state.occluded.resize(shadowCount);
+                m_scene.OccludedBatch(state.shadowRays.data(), shadowCount, state.occluded.data());
+                stats.rays += shadowCount;
+                for (uint32_t i = 0; i < shadowCount; ++i)
+                {
+                    if (!state.occluded[i])
+                        state.radiance[state.shadowPath[i]] += state.shadowContribution[i];
+                }
+                state.shadowRays.clear();
+                state.shadowContribution.clear();
+                state.shadowPath.clear();
+            }
+
+            state.active.swap(state.next);
+        }
+
+        for (uint32_t path : state.generated)
+        {
+            uint32_t x = tile.x0 + path % tileWidth;
+            uint32_t y = tile.y0 + path / tileWidth;
+            AddSample(size_t(y) * width + x, state.radiance[path], threadIndex);
+        }
+    }
+
+    float3 PathTracer::MissColor(const Ray& ray, uint32_t y, float bsdfPdf) const
+    {
+        const EnvironmentMap& environment = m_scene.GetEnvironment();
+        if (!environment.IsEmpty())
+        {
+            // Shared with the environment sample of the previous vertex
+            float3 radiance = environment.Eval(ray.direction);
+            if (!m_settings.nextEventEstimation || bsdfPdf == 0.0f)
+                return radiance;
+            return radiance * PowerHeuristic(bsdfPdf, environment.Pdf(ray.direction) * EnvironmentProbability());
+        }
+
+        // The ramp uses the launch index of the pixel, not the ray direction,
+        // so bounce rays that escape see the same color as the primary ray
+        float ramp = y / float(m_settings.height);
+        return float3(1.0f, 1.0f, 1.0f) * ramp + float3(.5f, .7f, 1.0f) * (1 - ramp);
+    }
+
+    float PathTracer::SequenceSample(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, uint32_t offset) const
+    {
+        uint32_t dimension = depth * kDimensionsPerBounce + offset;
+        if (dimension >= kSobolMaxDimensions)
+            return hashRandom(x, y, frameIndex, dimension);
+        if (m_settings.sampler == SamplerType::BlueNoise)
+            return blueNoiseSobol(frameIndex, dimension, blueNoiseKey(x, y, offset), pixelSeed(x, y));
+        return sobolOwen(frameIndex, dimension, pixelSeed(x, y));
+    }
+
+    float2 PathTracer::BounceSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, const Ray& ray, const Hit& hit) const
+    {
+        if (UsesSequence())
+            return float2(SequenceSample(x, y, frameIndex, depth, 0), SequenceSample(x, y, frameIndex, depth, 1));
+
+        if (m_settings.sampler == SamplerType::Random)
+        {
+            // ObjectRayDirection(): the inverse of the instance transform is
+            // the transpose of its normal transform
+            const Instance& instance = m_scene.GetInstances()[hit.instanceIndex];
+            float3 direction = TransformVector(Transpose(instance.normalTransform), ray.direction);
+            return randomSeed(float2(hit.bary.x + direction.x, hit.bary.y + direction.y) * float(frameIndex + 1));
+        }
+
+        float2 seed = sobolSeed(frameIndex, depth);
+        seed = CranleyPattersonRotation(seed, x, y);
+
+        // Past the fourth bounce sobolSeed reuses the dimensions of earlier
+        // bounces, shift them per bounce so deep paths do not repeat the
+        // directions of their first bounces. Depth 0..3 match the GPU.
+        if (depth >= kSobolDimensions / 2)
+            seed = float2(frac(seed.x + hashRandom(x, y, depth, 0)), frac(seed.y + hashRandom(x, y, depth, 1)));
+        return seed;
+    }
+
+    float PathTracer::LobeSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, const float2& seed) const
+    {
+        // Sobol and Random hash the BSDF seed as the shaders do, white noise
+        // that would undo the stratification of the sequence samplers
+        if (UsesSequence())
+            return SequenceSample(x, y, frameIndex, depth, 2);
+        return rand_2to1(seed);
+    }
+
+    bool PathTracer::SurvivesRoulette(float3& throughput, uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth) const
+    {
+        // depth is the vertex just shaded, the ray leaving it is bounce depth + 1
+        if (!m_settings.russianRoulette || depth < m_settings.rouletteMinBounces)
+            return true;
+
+        float survival = std::min(0.95f, std::max(throughput.x, std::max(throughput.y, throughput.z)));
+        float u = UsesSequence() ? SequenceSample(x, y, frameIndex, depth, 6) : hashRandom(x, y, frameIndex, depth);
+        if (u >= survival)
+            return false;
+
+        throughput = throughput / survival;
+        return true;
+    }
+
+    float3 PathTracer::LightSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth) const
+    {
+        if (UsesSequence())
+        {
+            return float3(SequenceSample(x, y, frameIndex, depth, 3), SequenceSample(x, y, frameIndex, depth, 4),
+                SequenceSample(x, y, frameIndex, depth, 5));
+        }
+
+        // Past the hashRandom dimensions Russian roulette uses
+        const uint32_t dimension = 1024 + 3 * depth;
+        return float3(hashRandom(x, y, frameIndex, dimension), hashRandom(x, y, frameIndex, dimension + 1),
+            hashRandom(x, y, frameIndex, dimension + 2));
+    }
+
+    float3 PathTracer::Emission(const Ray& ray, const Hit& hit, float bsdfPdf, const float3& bsdfNormal) const
+    {
+        uint32_t lightIndex = m_scene.GetLightIndex(hit);
+        if (lightIndex == kInvalidIndex)
+            return float3(0.0f);
+
+        const Light& light = m_scene.GetLights().GetLight(lightIndex);
+        if (dot(ray.direction, LightNormal(light)) >= 0.0f)
+            return float3(0.0f);
+
+        // Camera rays and rays without light sampling at their origin take
+        // the full emission, BRDF sampled ones share it with the light
+        // sample of the previous vertex (power heuristic)
+        if (!m_settings.nextEventEstimation || bsdfPdf == 0.0f)
+            return light.emission;
+        float lightPdf = m_scene.GetLights().Pdf(m_settings.lightSelection, lightIndex, ray.origin, bsdfNormal, ray.direction, hit.t) *
+            (1.0f - EnvironmentProbability());
+        return light.emission * PowerHeuristic(bsdfPdf, lightPdf);
+    }
+
+    bool PathTracer::SampleDirect(const SurfaceHit& surface, const Material& material, const float3& wo, const float3& seed,
+        const DTree* guide, Ray& shadowRay, float3& contribution) const
+    {
+        // The environment takes the first part of the selection number, the
+        // light list the rest
+        LightSample sample;
+        float environmentProbability = EnvironmentProbability();
+        if (seed.x < environmentProbability)
+        {
+            if (!m_scene.GetEnvironment().Sample(float2(seed.y, seed.z), sample.direction, sample.radiance, sample.pdf))
+                return false;
+            sample.pdf *= environmentProbability;
+            sample.distance = 1000.0f;
+        }
+        else
+        {
+            float uSelect = std::min((seed.x - environmentProbability) / (1.0f - environmentProbability), 0x1.fffffep-1f);
+            if (!m_scene.GetLights().Sample(m_settings.lightSelection, surface.position, surface.normal, uSelect, float2(seed.y, seed.z), sample))
+                return false;
+            sample.pdf *= 1.0f - environmentProbability;
+        }
+
+        float cosI = dot(surface.normal, sample.direction);
+        if (cosI <= 0.0f)
+            return false;
+        float3 brdf = Disney_BRDF(material, sample.direction, wo, surface.normal);
+        if (brdf.x == 0.0f && brdf.y == 0.0f && brdf.z == 0.0f)
+            return false;
+
+        float weight = sample.isDelta ? 1.0f : PowerHeuristic(sample.pdf, ScatterPdf(material, sample.direction, wo, surface.normal, guide));
+        contribution = sample.radiance * brdf * (cosI * weight / sample.pdf);
+
+        // Stop short of the light, its own geometry must not occlude it
+        shadowRay = Ray(surface.position, sample.direction, 0.01f, sample.distance * 0.999f);
+        return true;
+    }
+
+    const DTree* PathTracer::GuideAt(const float3& position, const Material& material) const
+    {
+        if (!m_guiding || material.roughness < m_settings.guidingMinRoughness)
+            return nullptr;
+        const DTree& tree = m_guiding->GetSamplingTree(position);
+        return tree.IsEmpty() ? nullptr : &tree;
+    }
+
+    float3 PathTracer::SampleBounce(const Material& material, const SurfaceHit& surface, const float3& wo, float2 seed, float seed1,
+        const DTree* guide, float& pdf) const
+    {
+        if (!guide)
+            return Disney_BRDF_Sample(material, seed, seed1, wo, surface.normal, surface.tangent, surface.bitangent, pdf);
+
+        // seed.x picks the strategy and is rescaled to what is left of it,
+        // so the direction keeps the stratification of the sequence
+        const float bsdfFraction = m_settings.guidingBsdfFraction;
+        float3 direction;
+        if (seed.x < bsdfFraction)
+        {
+            seed.x = std::min(seed.x / bsdfFraction, kOneMinusEpsilon);
+            direction = Disney_BRDF_Sample(material, seed, seed1, wo, surface.normal, surface.tangent, surface.bitangent, pdf);
+        }
+        else
+        {
+            seed.x = std::min((seed.x - bsdfFraction) / (1.0f - bsdfFraction), kOneMinusEpsilon);
+            direction = guide->Sample(seed);
+        }
+        pdf = ScatterPdf(material, direction, wo, surface.normal, guide);
+        return direction;
+    }
+
+    float PathTracer::ScatterPdf(const Material& material, const float3& L, const float3& wo, const float3& N, const DTree* guide) const
+    {
+        float pdf = Disney_BRDF_Pdf(material, L, wo, N);
+        if (!guide)
+            return pdf;
+        const float bsdfFraction = m_settings.guidingBsdfFraction;
+        return bsdfFraction * pdf + (1.0f - bsdfFraction) * guide->Pdf(L);
+    }
+
+    FirstHit PathTracer::GetFirstHit(const Ray& ray, const Hit& hit) const
+    {
+        // Lights keep the white albedo of the sky, they are not reflectance
+        SurfaceHit surface = m_scene.GetSurfaceHit(ray, hit);
+        const Material& material = m_scene.GetMaterial(surface.materialIndex);
+        FirstHit first;
+        if (material.type != MaterialType::Light)
+            first.albedo = material.baseColor;
+        first.normal = surface.normal;
+        first.depth = hit.t;
+        first.instanceIndex = hit.instanceIndex;
+        first.materialIndex = surface.materialIndex;
+        return first;
+    }
+
+    float3 PathTracer::TracePath(Ray ray, uint32_t x, uint32_t y, uint32_t frameIndex, uint64_t& rayCount, FirstHit* firstHit) const
+    {
+        float3 throughput(1.0f);
+        float3 radiance(0.0f);
+        float bsdfPdf = 0.0f;
+        float3 bsdfNormal(0.0f);
+
+        // While guiding trains, every bounce also collects the radiance
+        // found past it, divided by the throughput up to it
+        GuidingVertex vertices[kMaxGuidingVertices];
+        uint32_t vertexCount = 0;
+        const bool recording = IsGuidingTraining();
+        auto addRadiance = [&](const float3& contribution)
+        {
+            radiance += contribution;
+            for (uint32_t i = 0; i < vertexCount; ++i)
+                vertices[i].radiance += contribution * vertices[i].inverseThroughput;
+        };
+
+        for (uint32_t depth = 0; ; ++depth)
+        {
+            Hit hit;
+            ++rayCount;
+            if (!m_scene.Intersect(ray, hit))
+            {
+                addRadiance(throughput * MissColor(ray, y, bsdfPdf));
+                break;
+            }
+            if (depth == 0 && firstHit)
+                *firstHit = GetFirstHit(ray, hit);
+
+            addRadiance(throughput * Emission(ray, hit, bsdfPdf, bsdfNormal));
+
+            if (depth >= m_settings.maxDepth)
+                break;
+
+            SurfaceHit surface = m_scene.GetSurfaceHit(ray, hit);
+            const Material& material = m_scene.GetMaterial(surface.materialIndex);
+            if (material.type == MaterialType::Light)
+                break;
+
+            float3 wo = normalize(-ray.direction);
+            const DTree* guide = GuideAt(surface.position, material);
+
+            // Next event estimation: one light sample per vertex
+            Ray shadowRay;
+            float3 direct;
+            if (m_settings.nextEventEstimation && SampleDirect(surface, material, wo, LightSeed(x, y, frameIndex, depth), guide, shadowRay, direct))
+            {
+                ++rayCount;
+                if (!m_scene.Occluded(shadowRay))
+                    addRadiance(throughput * direct);
+            }
+
+            float2 seed = BounceSeed(x, y, frameIndex, depth, ray, hit);
+            float seed1 = LobeSeed(x, y, frameIndex, depth, seed);
+
+            float pdf;
+            float3 bounceDir = SampleBounce(material, surface, wo, seed, seed1, guide, pdf);
+            float3 brdf = Disney_BRDF(material, bounceDir, wo, surface.normal);
+            float cosI = dot(surface.normal, bounceDir);
+
+            throughput *= brdf * cosI / pdf;
+
+            // Nothing this path finds can contribute any more
+            if (throughput.x == 0.0f && throughput.y == 0.0f && throughput.z == 0.0f)
+                break;
+            if (recording && vertexCount < kMaxGuidingVertices)
+                vertices[vertexCount++] = { surface.position, bounceDir, pdf, SafeInverse(throughput), float3(0.0f) };
+            if (!SurvivesRoulette(throughput, x, y, frameIndex, depth))
+                break;
+
+            bsdfPdf = pdf;
+            bsdfNormal = surface.normal;
+            ray = Ray(surface.position, bounceDir, 0.01f, 1000.0f);
+        }
+
+        for (uint32_t i = 0; i < vertexCount; ++i)
+            m_guiding->Record(vertices[i].position, vertices[i].direction, Luminance(vertices[i].radiance) / vertices[i].pdf);
+        return radiance;
+    }
+}
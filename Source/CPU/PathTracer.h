@@ -0,0 +1,297 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "CPU/AOV.h"
+#include "CPU/Camera.h"
+#include "CPU/DisneySIMD.h"
+#include "CPU/Firefly.h"
+#include "CPU/PathGuiding.h"
+#include "CPU/Scene.h"
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    // DepthFirst traces each path to the end before starting the next one,
+    // like the TraceRay recursion of ClosestHit. Wavefront advances a whole
+    // tile of paths one bounce at a time through separate stages (extension
+    // rays, material shading sorted by material, shadow rays), so each stage
+    // runs over a large batch with its own code and data hot in cache.
+    enum class PathTracerMode
+    {
+        DepthFirst = 0,
+        Wavefront,
+    };
+
+    // Where the random numbers of a path come from. Sobol is what the
+    // shaders do: the 8 dimensions of V with a per pixel Cranley-Patterson
+    // rotation, bounces past the fourth reuse them shifted, light samples
+    // and Russian roulette use hashRandom. OwenSobol gives every decision of
+    // every bounce its own dimension of the generated Sobol table
+    // (kDimensionsPerBounce each) and Owen scrambles the sequence per pixel,
+    // hashRandom only takes over past kSobolMaxDimensions. BlueNoise uses
+    // the same dimensions with the ranking and scrambling keys of
+    // BlueNoise.h instead, so the error of the first samples is blue noise
+    // over the image. Random is the disabled pseudorandom branch of
+    // ClosestHit: randomSeed of the barycentrics and the object space ray
+    // direction for the BSDF sample, the rest as Sobol.
+    enum class SamplerType
+    {
+        Sobol = 0,
+        OwenSobol,
+        BlueNoise,
+        Random,
+    };
+
+    struct PathTracerSettings
+    {
+        uint32_t width = 1280;
+        uint32_t height = 720;
+        uint32_t maxDepth = 4;          // payload.depth < 4 in ClosestHit
+
+        // Russian roulette: after rouletteMinBounces bounces a path continues
+        // with probability min(max(throughput), 0.95) and is reweighted, so
+        // maxDepth can be large without paying for dark paths. Off by
+        // default to match the GPU.
+        bool russianRoulette = false;
+        uint32_t rouletteMinBounces = 3;
+
+        // Adaptive sampling: a pixel stops taking samples once the standard
+        // error of its mean luminance drops below adaptiveThreshold times the
+        // mean (after at least adaptiveMinSamples), a tile whose pixels all
+        // converged is retired from the scheduler.
+        bool adaptiveSampling = false;
+        float adaptiveThreshold = 0.02f;
+        uint32_t adaptiveMinSamples = 16;
+
+        // Next event estimation: every vertex also samples one light of
+        // Scene::GetLights() (picked by power, or by the light BVH with
+        // LightSelection::BVH) and traces a shadow ray. Light samples and BRDF
+        // sampled rays hitting area lights are combined with the power
+        // heuristic. Emitters hit by BRDF rays add their emission either way.
+        bool nextEventEstimation = false;
+        LightSelection lightSelection = LightSelection::Power;  // BVH for many lights
+
+        SamplerType sampler = SamplerType::Sobol;
+
+        // Path guiding (the SD-tree of PathGuiding.h): the incident radiance
+        // is learned over guidingTrainingIterations iterations of 1, 2, 4...
+        // frames, every iteration restarting the image, later frames only
+        // sample it. Vertices at least guidingMinRoughness rough take the
+        // learned distribution with probability 1 - guidingBsdfFraction and
+        // Disney_BRDF_Sample otherwise, weighted by one-sample MIS; sharper
+        // lobes are better left to the BRDF. Always renders depth first.
+        bool pathGuiding = false;
+        uint32_t guidingTrainingIterations = 6;
+        float guidingBsdfFraction = 0.5f;
+        float guidingMinRoughness = 0.3f;
+        float guidingSpatialThreshold = 12000.0f;  // records of a spatial leaf, times sqrt(frames), before it splits
+
+        // Temporal reprojection: SetCamera keeps the samples of the pixels
+        // that stay visible instead of restarting the image. Every pixel
+        // gathers the accumulation bilinearly around where its first hit was
+        // in the previous view; taps whose first hit depth or normal do not
+        // match are disocclusions and dropped. History is clamped to
+        // maxHistoryLength samples so the blur of repeated resampling and
+        // the lag of reflections, which move differently from the surface,
+        // fade out. Off by default, the window restarts on camera moves.
+        bool temporalReprojection = false;
+        uint32_t maxHistoryLength = 16;
+        float reprojectionDepthTolerance = 0.05f;   // relative to the depth
+        float reprojectionNormalTolerance = 0.9f;   // min cosine between the normals
+
+        // First hit AOVs written every frame (AOVFlags, see AOV.h). None by
+        // default: no buffers are allocated and TracePath skips the writes.
+        uint32_t aovs = AOV_None;
+
+        // Firefly suppression, both biased. TrimmedBucketMean also sums frame i
+        // into bucket i mod fireflyBuckets of its pixel (16 bytes each);
+        // pixels whose bucket luminances have a Gini coefficient above
+        // fireflyGiniThreshold resolve to the mean of the buckets without the
+        // darkest and the brightest, so a firefly only moves one bucket, the
+        // others keep the plain mean. Clamp scales samples down to a luminance
+        // threshold, chosen after every frame so it would have removed
+        // fireflyBiasBudget of the energy of all samples so far (the first
+        // frame is not clamped). The moments behind adaptive sampling and
+        // ResolveVariance see the accumulated samples either way. Off by
+        // default to match the GPU.
+        FireflyFilter fireflyFilter = FireflyFilter::None;
+        uint32_t fireflyBuckets = 8;            // at most 32
+        float fireflyGiniThreshold = 0.5f;
+        float fireflyBiasBudget = 0.01f;
+
+        uint32_t threadCount = 0;       // 0 = all hardware threads
+        uint32_t tileSize = 32;
+        TileOrder tileOrder = TileOrder::Hilbert;
+        bool workStealing = true;
+        PathTracerMode mode = PathTracerMode::DepthFirst;
+        uint32_t wavefrontTileSize = 128;   // one tile is one wavefront batch
+        SimdWidth shadingWidth = SimdWidth::AVX2;   // wavefront shading kernels, clamped to the build
+    };
+
+    struct RenderStats
+    {
+        uint64_t samples = 0;           // paths traced, converged pixels take none
+        uint64_t rays = 0;
+        double seconds = 0.0;
+    };
+
+    // CPU version of the DXR path tracer: RayGen.hlsl camera rays, ClosestHit
+    // of Hit.hlsl (Disney_BRDF_Sample + Disney_BRDF, Sobol seeds with a per
+    // pixel Cranley-Patterson rotation) and the Miss.hlsl sky. Every frame
+    // traces one path per pixel with the seeds of GPU frame frameCount and
+    // adds it to a float radiance sum + sample count, like gAccumulation, so
+    // frame N of both renderers can be compared directly.
+    class PathTracer
+    {
+    public:
+        PathTracer(const Scene& scene, const PathTracerSettings& settings);
+        ~PathTracer();
+
+        // Restarts the image, or reprojects it into the new view with
+        // temporalReprojection (the Sobol frame index then keeps counting)
+        void SetCamera(const Camera& camera);
+
+        // Subpixel offset of the camera rays from the pixel centers, in
+        // pixels, for TemporalUpscaler::GetJitter. The reprojection, the
+        // features and the accumulation stay on the pixel grid.
+        void SetJitter(const float2& jitter) { m_jitter = jitter; }
+
+        // Clears the accumulation and restarts the path guiding training.
+        // The next frame uses the Sobol index firstFrameIndex, a reference
+        // render can start past the frames of the image it is compared
+        // against so the samples are disjoint.
+        void Reset(uint32_t firstFrameIndex = 0);
+
+        // Renders the next frame, tiles are spread over the scheduler threads
+        RenderStats RenderFrame();
+
+        // Radiance of a single path, the recursion of ClosestHit unrolled.
+        // (x, y) is the launch index, frameIndex the frameCount cbuffer value.
+        // firstHit, if given, receives what the camera ray hit.
+        float3 TracePath(Ray ray, uint32_t x, uint32_t y, uint32_t frameIndex, uint64_t& rayCount, FirstHit* firstHit = nullptr) const;
+
+        const PathTracerSettings& GetSettings() const { return m_settings; }
+        const std::vector<Tile>& GetTiles() const { return m_tiles; }
+        const TileScheduler& GetScheduler() const { return m_scheduler; }
+        uint32_t GetFrameCount() const { return m_frameCount; }
+
+        // The learned SD-tree, null without pathGuiding. The image is
+        // restarted at the end of every training iteration.
+        const SDTree* GetGuidingTree() const { return m_guiding.get(); }
+        bool IsGuidingTraining() const { return m_guiding && m_guidingIteration < m_settings.guidingTrainingIterations; }
+
+        // Row major, rgb = radiance sum, w = sample count
+        const std::vector<float4>& GetAccumulation() const { return m_accumulation; }
+
+        // Luminance the Clamp firefly filter holds the next frame's samples
+        // to, INFINITY before the first frame or with other filters
+        float GetClampThreshold() const { return m_clampThreshold; }
+
+        // First hits of the pixel centers in the current view, only kept
+        // with temporalReprojection: distance along the camera ray (INFINITY
+        // on the sky), normal, and the offset in pixels to where the point
+        // was in the previous view
+        const std::vector<float>& GetDepth() const { return m_depth; }
+        const std::vector<float3>& GetNormals() const { return m_normals; }
+        const std::vector<float2>& GetMotion() const { return m_motion; }
+
+        // The AOVs of the last frame, the buffers of disabled ones are empty
+        const AOVBuffers& GetAOVs() const { return m_aovs; }
+
+        // Relative standard error of the pixel's mean luminance
+        float GetRelativeError(size_t pixel) const;
+        bool IsPixelConverged(size_t pixel) const;
+
+        // Tiles that still take samples, 0 once the whole image converged
+        uint32_t GetActiveTileCount() const;
+
+        // Average radiance per pixel, rgb only; a trimmed mean of the
+        // bucket means with FireflyFilter::TrimmedBucketMean
+        void ResolveHDR(std::vector<float>& rgb) const;
+
+        // Average quantized to RGBA8, the content of gOutput
+        void ResolveRGBA8(std::vector<uint8_t>& rgba) const;
+
+        // Variance of the mean luminance per pixel, from the accumulated
+        // moments, or -1 where fewer than minSamples were taken
+        void ResolveVariance(std::vector<float>& variance, uint32_t minSamples = 4) const;
+
+        // Noise free features of the pixel center camera rays: base color
+        // (1 on the sky and lights), normal (0 on the sky) and hit distance
+        // (INFINITY on the sky), the guides of the Denoiser
+        void RenderFeatures(std::vector<float3>& albedo, std::vector<float3>& normals, std::vector<float>& depth);
+
+    private:
+        struct WavefrontState;
+
+        void RenderTile(const Tile& tile, uint32_t threadIndex, RenderStats& stats);
+        void RenderTileWavefront(const Tile& tile, uint32_t threadIndex, WavefrontState& state, RenderStats& stats);
+        void ClearAccumulation();
+        void AddSample(size_t pixel, float3 color, uint32_t threadIndex);
+        float3 ResolvePixel(size_t pixel) const;
+        void UpdateGuiding();
+        void ReprojectHistory(const Camera* previous);
+        void UpdateTileConvergence(uint32_t tileIndex);
+        float3 MissColor(const Ray& ray, uint32_t y, float bsdfPdf) const;
+        float2 BounceSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, const Ray& ray, const Hit& hit) const;
+        float LobeSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, const float2& seed) const;
+        float3 LightSeed(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth) const;
+        float SequenceSample(uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth, uint32_t offset) const;
+        float3 Emission(const Ray& ray, const Hit& hit, float bsdfPdf, const float3& bsdfNormal) const;
+        FirstHit GetFirstHit(const Ray& ray, const Hit& hit) const;
+
+        // Whether every decision of a path has its own sequence dimension
+        bool UsesSequence() const
+        {
+            return m_settings.sampler == SamplerType::OwenSobol || m_settings.sampler == SamplerType::BlueNoise;
+        }
+
+        // Probability that a light sample goes to the environment map
+        // rather than the light list
+        float EnvironmentProbability() const
+        {
+            if (m_scene.GetEnvironment().IsEmpty())
+                return 0.0f;
+            return m_scene.GetLights().IsEmpty() ? 1.0f : 0.5f;
+        }
+        bool SampleDirect(const SurfaceHit& surface, const Material& material, const float3& wo, const float3& seed,
+            const DTree* guide, Ray& shadowRay, float3& contribution) const;
+
+        // Path guiding: the sampling tree at a vertex (null if it is not
+        // guided), the bounce direction of the BRDF / guide mixture and its pdf
+        const DTree* GuideAt(const float3& position, const Material& material) const;
+        float3 SampleBounce(const Material& material, const SurfaceHit& surface, const float3& wo, float2 seed, float seed1,
+            const DTree* guide, float& pdf) const;
+        float ScatterPdf(const Material& material, const float3& L, const float3& wo, const float3& N, const DTree* guide) const;
+        bool SurvivesRoulette(float3& throughput, uint32_t x, uint32_t y, uint32_t frameIndex, uint32_t depth) const;
+
+        const Scene& m_scene;
+        PathTracerSettings m_settings;
+        Camera m_camera;
+        float2 m_jitter = float2(0.0f);
+
+        TileScheduler m_scheduler;
+        std::vector<Tile> m_tiles;
+        std::vector<std::unique_ptr<WavefrontState>> m_wavefrontStates;    // one per thread
+        std::vector<float4> m_accumulation;
+        std::vector<float2> m_moments;          // luminance mean, M2 (Welford)
+        std::vector<float4> m_buckets;          // fireflyBuckets per pixel with TrimmedBucketMean
+        std::vector<LuminanceHistogram> m_threadHistograms;     // samples of the current frame, Clamp only
+        LuminanceHistogram m_luminanceHistogram;
+        float m_clampThreshold = INFINITY;
+        std::vector<uint8_t> m_tileConverged;
+        std::vector<uint32_t> m_activeTiles;
+        uint32_t m_firstFrameIndex = 0;
+        uint32_t m_frameCount = 0;
+
+        std::vector<float> m_depth;
+        std::vector<float3> m_normals;
+        std::vector<float2> m_motion;
+        AOVBuffers m_aovs;
+
+        std::unique_ptr<SDTree> m_guiding;
+        uint32_t m_guidingIteration = 0;
+        uint32_t m_guidingFrames = 0;          // frames of the current training iteration
+    };
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CPU/VectorMath.h"
+
+namespace CPU
+{
+    static const uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    // Equivalent of RayDesc
+    struct Ray
+    {
+        float3 origin;
+        float3 direction;
+        float tMin = 0.0f;
+        float tMax = 100000.0f;
+
+        Ray() {}
+        Ray(const float3& o, const float3& d, float tmin = 0.0f, float tmax = 100000.0f)
+            : origin(o), direction(d), tMin(tmin), tMax(tmax) {}
+    };
+
+    // Closest hit record, the CPU side of RayTCurrent() / PrimitiveIndex() /
+    // InstanceIndex() and the triangle Attributes (bary)
+    struct Hit
+    {
+        float t = INFINITY;
+        float2 bary;                        // weights of the 2nd and 3rd vertex, as in DXR
+        uint32_t instanceIndex = kInvalidIndex;
+        uint32_t primitiveIndex = kInvalidIndex;
+
+        bool IsValid() const { return instanceIndex != kInvalidIndex; }
+    };
+}
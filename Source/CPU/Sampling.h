@@ -0,0 +1,280 @@
+#pragma once
+
+#include "CPU/BlueNoise.h"
+#include "CPU/Sobol.h"
+#include "CPU/VectorMath.h"
+
+// C++ port of Shaders/Utils/Math.hlsl and Shaders/Utils/Sampling.hlsl. The
+// functions keep their HLSL names and arithmetic so that CPU and GPU renders
+// can be compared sample by sample.
+
+namespace CPU
+{
+    // Sobol direction numbers, 8 dimensions x 32 bits (V in Math.hlsl)
+    static constexpr uint32_t SobolV[8 * 32] =
+    {
+        2147483648, 1073741824, 536870912, 268435456, 134217728, 67108864, 33554432, 16777216, 8388608, 4194304, 2097152, 1048576, 524288, 262144, 131072, 65536, 32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2, 1,
+        2147483648, 3221225472, 2684354560, 4026531840, 2281701376, 3422552064, 2852126720, 4278190080, 2155872256, 3233808384, 2694840320, 4042260480, 2290614272, 3435921408, 2863267840, 4294901760, 2147516416, 3221274624, 2684395520, 4026593280, 2281736192, 3422604288, 2852170240, 4278255360, 2155905152, 3233857728, 2694881440, 4042322160, 2290649224, 3435973836, 2863311530, 4294967295,
+        2147483648, 3221225472, 1610612736, 2415919104, 3892314112, 1543503872, 2382364672, 3305111552, 1753219072, 2629828608, 3999268864, 1435500544, 2154299392, 3231449088, 1626210304, 2421489664, 3900735488, 1556135936, 2388680704, 3314585600, 1751705600, 2627492864, 4008611328, 1431684352, 2147543168, 3221249216, 1610649184, 2415969680, 3892340840, 1543543964, 2382425838, 3305133397,
+        2147483648, 3221225472, 536870912, 1342177280, 4160749568, 1946157056, 2717908992, 2466250752, 3632267264, 624951296, 1507852288, 3872391168, 2013790208, 3020685312, 2181169152, 3271884800, 546275328, 1363623936, 4226424832, 1977167872, 2693105664, 2437829632, 3689389568, 635137280, 1484783744, 3846176960, 2044723232, 3067084880, 2148008184, 3222012020, 537002146, 1342505107,
+        2147483648, 1073741824, 536870912, 2952790016, 4160749568, 3690987520, 2046820352, 2634022912, 1518338048, 801112064, 2707423232, 4038066176, 3666345984, 1875116032, 2170683392, 1085997056, 579305472, 3016343552, 4217741312, 3719483392, 2013407232, 2617981952, 1510979072, 755882752, 2726789248, 4090085440, 3680870432, 1840435376, 2147625208, 1074478300, 537900666, 2953698205,
+        2147483648, 1073741824, 1610612736, 805306368, 2818572288, 335544320, 2113929216, 3472883712, 2290089984, 3829399552, 3059744768, 1127219200, 3089629184, 4199809024, 3567124480, 1891565568, 394297344, 3988799488, 920674304, 4193267712, 2950604800, 3977188352, 3250028032, 129093376, 2231568512, 2963678272, 4281226848, 432124720, 803643432, 1633613396, 2672665246, 3170194367,
+        2147483648, 3221225472, 2684354560, 3489660928, 1476395008, 2483027968, 1040187392, 3808428032, 3196059648, 599785472, 505413632, 4077912064, 1182269440, 1736704000, 2017853440, 2221342720, 3329785856, 2810494976, 3628507136, 1416089600, 2658719744, 864310272, 3863387648, 3076993792, 553150080, 272922560, 4167467040, 1148698640, 1719673080, 2009075780, 2149644390, 3222291575,
+        2147483648, 1073741824, 2684354560, 1342177280, 2281701376, 1946157056, 436207616, 2566914048, 2625634304, 3208642560, 2720006144, 2098200576, 111673344, 2354315264, 3464626176, 4027383808, 2886631424, 3770826752, 1691164672, 3357462528, 1993345024, 3752330240, 873073152, 2870150400, 1700563072, 87021376, 1097028000, 1222351248, 1560027592, 2977959924, 23268898, 437609937
+    };
+
+    static const uint32_t kSobolDimensions = 8;
+
+    inline uint32_t grayCode(uint32_t i)
+    {
+        return i ^ (i >> 1);
+    }
+
+    // Generate d dimension ith sobol number
+    inline float sobol(uint32_t d, uint32_t i)
+    {
+        uint32_t result = 0;
+        uint32_t offset = d * 32;
+        for (uint32_t j = 0; i; i >>= 1, j++)
+            if (i & 1)
+                result ^= SobolV[j + offset];
+
+        return float(result) * (1.0f / float(0xFFFFFFFFU));
+    }
+
+    inline float rand_1to1(float x)
+    {
+        return frac(std::sin(x) * 10000.0f);
+    }
+
+    inline float rand_2to1(const float2& uv)
+    {
+        const float a = 12.9898f, b = 78.233f, c = 43758.5453f;
+        float dt = dot(uv, float2(a, b)), sn = std::fmod(dt, PI);
+        return frac(std::sin(sn) * c);
+    }
+
+    inline uint32_t wang_hash(uint32_t& seed)
+    {
+        seed = uint32_t(seed ^ uint32_t(61)) ^ uint32_t(seed >> uint32_t(16));
+        seed *= uint32_t(9);
+        seed = seed ^ (seed >> 4);
+        seed *= uint32_t(0x27d4eb2d);
+        seed = seed ^ (seed >> 15);
+        return seed;
+    }
+
+    // Generate ith frame b bounce light's random seed. The table only has
+    // 8 dimensions, bounces past the fourth reuse the dimensions of b % 4.
+    inline float2 sobolSeed(uint32_t i, uint32_t b)
+    {
+        b %= kSobolDimensions / 2;
+        float u = sobol(b * 2, grayCode(i));
+        float v = sobol(b * 2 + 1, grayCode(i));
+        return float2(u, v);
+    }
+
+    inline float2 randomSeed(const float2& uv)
+    {
+        return float2(rand_1to1(uv.x), rand_1to1(uv.y));
+    }
+
+    inline float2 CranleyPattersonRotation(float2 seed, uint32_t x, uint32_t y)
+    {
+        uint32_t pseed = uint32_t(
+            x * uint32_t(1973) +
+            y * uint32_t(9277) +
+            uint32_t(114514 / 1919) * uint32_t(26699)) | uint32_t(1);
+
+        float u = float(wang_hash(pseed)) / 4294967296.0f;
+        float v = float(wang_hash(pseed)) / 4294967296.0f;
+
+        seed.x += u;
+        if (seed.x > 1)
+            seed.x -= 1;
+        if (seed.x < 0)
+            seed.x += 1;
+
+        seed.y += v;
+        if (seed.y > 1)
+            seed.y -= 1;
+        if (seed.y < 0)
+            seed.y += 1;
+
+        return seed;
+    }
+
+    // Uniform [0, 1) number hashed from pixel (x, y), frame i and dimension
+    // b, for decisions outside the Sobol dimensions (Russian roulette, light
+    // sampling)
+    inline float hashRandom(uint32_t x, uint32_t y, uint32_t i, uint32_t b)
+    {
+        uint32_t seed = (x * uint32_t(1973) + y * uint32_t(9277) + i * uint32_t(26699) + b * uint32_t(116539)) | uint32_t(1);
+        wang_hash(seed);
+        return float(wang_hash(seed)) / 4294967296.0f;
+    }
+
+    // reversebits() of HLSL
+    inline uint32_t reverseBits(uint32_t x)
+    {
+        x = (x << 16) | (x >> 16);
+        x = ((x & 0x00ff00ffu) << 8) | ((x & 0xff00ff00u) >> 8);
+        x = ((x & 0x0f0f0f0fu) << 4) | ((x & 0xf0f0f0f0u) >> 4);
+        x = ((x & 0x33333333u) << 2) | ((x & 0xccccccccu) >> 2);
+        x = ((x & 0x55555555u) << 1) | ((x & 0xaaaaaaaau) >> 1);
+        return x;
+    }
+
+    inline uint32_t mixBits(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // Hash based Owen scrambling (Burley 2020, "Practical Hash-based Owen
+    // Scrambling", with Vegdahl's stronger Laine-Karras style hash). Every
+    // step only lets lower bits change higher ones, on reversed bits that
+    // is a nested uniform scramble: the stratification survives, the
+    // structure of the unscrambled sequence does not.
+    inline uint32_t nestedUniformScramble(uint32_t x, uint32_t seed)
+    {
+        x = reverseBits(x);
+        x ^= x * 0x3d20adeau;
+        x += seed;
+        x *= (seed >> 16) | 1u;
+        x ^= x * 0x05526c56u;
+        x ^= x * 0x53a22864u;
+        return reverseBits(x);
+    }
+
+    // Dimension d (any of kSobolMaxDimensions) of the ith Sobol point, no
+    // gray code
+    inline uint32_t sobolBits(uint32_t d, uint32_t i)
+    {
+        const uint32_t* columns = SobolMatrices.Dimension(d);
+        uint32_t result = 0;
+        for (; i; i >>= 1, ++columns)
+            if (i & 1)
+                result ^= *columns;
+        return result;
+    }
+
+    // ith point of dimension d of the Owen scrambled sequence of seed. The
+    // index is scrambled the same way in every dimension, so each seed
+    // walks the points in its own order and any aligned power of two run of
+    // indices is still a well stratified set.
+    inline float sobolOwen(uint32_t i, uint32_t d, uint32_t seed)
+    {
+        uint32_t index = nestedUniformScramble(i, seed);
+        uint32_t result = nestedUniformScramble(sobolBits(d, index), seed ^ mixBits(d + 1));
+        return float(result >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Scramble seed of pixel (x, y) for sobolOwen
+    inline uint32_t pixelSeed(uint32_t x, uint32_t y)
+    {
+        return mixBits(x * uint32_t(1973) + y * uint32_t(9277) + uint32_t(26699));
+    }
+
+    // Dimensions one bounce takes with sobolOwen: BSDF sample (2), BSDF lobe
+    // selection (1), light selection and light sample (3), Russian roulette (1)
+    static const uint32_t kDimensionsPerBounce = 7;
+
+    // Dimension d of the sequence under the blue noise keys: Sobol with one
+    // fixed Owen scramble. Without it the ranking key would be no more than
+    // a second digital shift, since Sobol points are linear in the index.
+    inline uint32_t blueNoiseSequence(uint32_t d, uint32_t i)
+    {
+        return nestedUniformScramble(sobolBits(d, i), mixBits(~d));
+    }
+
+    // ith point of dimension d of the blue noise sampler, key is the
+    // blueNoiseKey of the pixel for d % kDimensionsPerBounce and seed its
+    // pixelSeed. The ranking key reorders the points inside aligned runs of
+    // 256, so every power of two prefix of a run stays stratified, the
+    // scrambling key flips the top 8 bits. The low bits get a random
+    // digital shift per pixel: past 256 spp the pixels keep converging
+    // independently instead of repeating the first 256 points.
+    inline float blueNoiseSobol(uint32_t i, uint32_t d, uint32_t key, uint32_t seed)
+    {
+        uint32_t value = blueNoiseSequence(d, i ^ (key >> 8));
+        value ^= (key & 0xffu) << 24 | mixBits(seed ^ mixBits(d + 1)) >> 8;
+        return float(value >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Columns T, B, N; the float3x3 TBN = transpose(float3x3(T, B, N)) of the shaders
+    struct TBNFrame
+    {
+        float3 T, B, N;
+    };
+
+    inline float3 toNormalHemisphere(const float3& v, const TBNFrame& TBN)
+    {
+        return normalize(TBN.T * v.x + TBN.B * v.y + TBN.N * v.z);
+    }
+
+    inline float3 sphereSample(const float2& seed)
+    {
+        float z = 1.0f - 2.0f * seed.x;
+        float r = std::sqrt(std::max(0.0f, 1.0f - z * z));
+        float phi = 2 * PI * seed.y;
+        float x = r * std::cos(phi);
+        float y = r * std::sin(phi);
+        return float3(x, y, z);
+    }
+
+    inline float3 hemisphereSample(const TBNFrame& TBN, const float2& seed)
+    {
+        float3 sample = sphereSample(seed);
+        if (sample.z < 0.0f)
+            sample.z *= -1.0f;
+
+        return toNormalHemisphere(sample, TBN);
+    }
+
+    // https://www.pbr-book.org/3ed-2018/Monte_Carlo_Integration/2D_Sampling_with_Multidimensional_Transformations#Cosine-WeightedHemisphereSampling
+    inline float3 cosineHemisphereSample(const TBNFrame& TBN, const float2& seed)
+    {
+        float r = std::sqrt(seed.x);
+        float theta = seed.y * 2.0f * PI;
+        float x = r * std::cos(theta);
+        float y = r * std::sin(theta);
+        float z = std::sqrt(std::max(0.0f, 1.0f - x * x - y * y));
+
+        return toNormalHemisphere(float3(x, y, z), TBN);
+    }
+
+    inline float3 GTR2Sample(const TBNFrame& TBN, const float2& seed, float alpha, const float3& V)
+    {
+        float phi_h = 2.0f * PI * seed.x;
+        float sin_phi_h = std::sin(phi_h);
+        float cos_phi_h = std::cos(phi_h);
+
+        float cos_theta_h = std::sqrt((1.0f - seed.y) / (1.0f + (alpha * alpha - 1.0f) * seed.y));
+        float sin_theta_h = std::sqrt(std::max(0.0f, 1.0f - cos_theta_h * cos_theta_h));
+
+        float3 H = float3(sin_theta_h * cos_phi_h, sin_theta_h * sin_phi_h, cos_theta_h);
+        H = toNormalHemisphere(H, TBN);
+
+        return reflect(-V, H);
+    }
+
+    inline float3 GTR1Sample(const TBNFrame& TBN, const float2& seed, float alpha, const float3& V)
+    {
+        float phi_h = 2.0f * PI * seed.x;
+        float sin_phi_h = std::sin(phi_h);
+        float cos_phi_h = std::cos(phi_h);
+
+        float cos_theta_h = std::sqrt((1.0f - std::pow(alpha * alpha, 1.0f - seed.y)) / (1.0f - alpha * alpha));
+        float sin_theta_h = std::sqrt(std::max(0.0f, 1.0f - cos_theta_h * cos_theta_h));
+
+        float3 H = float3(sin_theta_h * cos_phi_h, sin_theta_h * sin_phi_h, cos_theta_h);
+        H = toNormalHemisphere(H, TBN);
+
+        return reflect(-V, H);
+    }
+}
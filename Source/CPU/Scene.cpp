@@ -0,0 +1,305 @@
+#include "CPU/Scene.h"
+#include <algorithm>
+
+namespace CPU
+{
+    namespace
+    {
+        template <typename T>
+        T Interpolate(const std::vector<T>& attrib, const uint32_t* idx, const float3& barycentrics, const T& fallback)
+        {
+            if (attrib.empty())
+                return fallback;
+            return attrib[idx[0]] * barycentrics.x + attrib[idx[1]] * barycentrics.y + attrib[idx[2]] * barycentrics.z;
+        }
+    }
+
+    uint32_t Scene::AddMesh(Mesh&& mesh)
+    {
+        m_meshes.push_back(std::move(mesh));
+        return static_cast<uint32_t>(m_meshes.size() - 1);
+    }
+
+    uint32_t Scene::AddMaterial(const Material& material)
+    {
+        m_materials.push_back(material);
+        return static_cast<uint32_t>(m_materials.size() - 1);
+    }
+
+    uint32_t Scene::AddInstance(uint32_t meshIndex, uint32_t materialIndex, const float4x4& transform)
+    {
+        Instance instance;
+        instance.geometryType = GeometryType::Triangles;
+        instance.meshIndex = meshIndex;
+        instance.materialIndex = materialIndex;
+        instance.transform = transform;
+        instance.normalTransform = Transpose(Inverse(transform));
+        m_instances.push_back(instance);
+        m_lightsChanged = true;
+        return static_cast<uint32_t>(m_instances.size() - 1);
+    }
+
+    void Scene::SetInstanceTransform(uint32_t instanceIndex, const float4x4& transform)
+    {
+        m_instances[instanceIndex].transform = transform;
+        m_instances[instanceIndex].normalTransform = Transpose(Inverse(transform));
+    }
+
+    uint32_t Scene::AddSpheres(std::vector<Sphere>&& spheres)
+    {
+        m_sphereSets.push_back(std::move(spheres));
+        return static_cast<uint32_t>(m_sphereSets.size() - 1);
+    }
+
+    uint32_t Scene::AddSphereInstance(uint32_t sphereSetIndex, uint32_t materialIndex, const float4x4& transform)
+    {
+        uint32_t index = AddInstance(sphereSetIndex, materialIndex, transform);
+        m_instances[index].geometryType = GeometryType::ProceduralSpheres;
+        return index;
+    }
+
+    void Scene::AddPointLight(const float3& position, const float3& intensity)
+    {
+        Light light;
+        light.type = LightType::Point;
+        light.position = position;
+        light.emission = intensity;
+        m_pointLights.push_back(light);
+        m_lightsChanged = true;
+    }
+
+    uint32_t Scene::AddQuadLight(const float3& corner, const float3& edge0, const float3& edge1, const float3& emission)
+    {
+        const float3 normal = normalize(cross(edge0, edge1));
+        Mesh mesh;
+        mesh.positions = { corner, corner + edge0, corner + edge0 + edge1, corner + edge1 };
+        mesh.normals.assign(4, normal);
+        mesh.tangents.assign(4, normalize(edge0));
+        mesh.bitangents.assign(4, cross(normal, normalize(edge0)));
+        mesh.uvs = { float2(0, 0), float2(1, 0), float2(1, 1), float2(0, 1) };
+        mesh.indices = { 0, 1, 2, 0, 2, 3 };
+
+        Material material;
+        material.type = MaterialType::Light;
+        material.emission = emission;
+
+        uint32_t instance = AddInstance(AddMesh(std::move(mesh)), AddMaterial(material), float4x4());
+        m_quadLightInstances.push_back(instance);
+        return instance;
+    }
+
+    uint32_t Scene::GetLightIndex(const Hit& hit) const
+    {
+        const InstanceLights& lights = m_instanceLights[hit.instanceIndex];
+        if (lights.first == kInvalidIndex || !lights.perTriangle)
+            return lights.first;
+        return lights.first + hit.primitiveIndex;
+    }
+
+    void Scene::Build()
+    {
+        size_t triangleCount = 0;
+        size_t sphereCount = 0;
+        for (const Instance& instance : m_instances)
+        {
+            if (instance.geometryType == GeometryType::Triangles)
+                triangleCount += m_meshes[instance.meshIndex].GetTriangleCount();
+            else
+                sphereCount += m_sphereSets[instance.meshIndex].size();
+        }
+
+        // The scenes are a handful of instances, so a single level BVH over
+        // world space triangles is both simpler and faster than a TLAS/BLAS split
+        std::vector<BVHTriangle> triangles;
+        triangles.reserve(triangleCount);
+
+        std::vector<SphereBVH::Primitive> spheres;
+        spheres.reserve(sphereCount);
+
+        m_lights.Clear();
+        for (const Light& light : m_pointLights)
+            m_lights.Add(light);
+        m_instanceLights.assign(m_instances.size(), InstanceLights());
+
+        for (uint32_t i = 0; i < m_instances.size(); ++i)
+        {
+            const Instance& instance = m_instances[i];
+            if (instance.geometryType == GeometryType::ProceduralSpheres)
+            {
+                const std::vector<Sphere>& set = m_sphereSets[instance.meshIndex];
+                float scale = length(TransformVector(instance.transform, float3(1, 0, 0)));
+                for (uint32_t p = 0; p < set.size(); ++p)
+                {
+                    SphereBVH::Primitive prim;
+                    prim.sphere.center = TransformPoint(instance.transform, set[p].center);
+                    prim.sphere.radius = set[p].radius * scale;
+                    prim.instanceIndex = i;
+                    prim.primitiveIndex = p;
+                    spheres.push_back(prim);
+                }
+                continue;
+            }
+
+            const Mesh& mesh = m_meshes[instance.meshIndex];
+
+            std::vector<float3> world(mesh.positions.size());
+            for (size_t v = 0; v < mesh.positions.size(); ++v)
+                world[v] = TransformPoint(instance.transform, mesh.positions[v]);
+
+            for (uint32_t p = 0; p < mesh.GetTriangleCount(); ++p)
+            {
+                const float3& v0 = world[mesh.indices[3 * p]];
+                const float3& v1 = world[mesh.indices[3 * p + 1]];
+                const float3& v2 = world[mesh.indices[3 * p + 2]];
+
+                BVHTriangle tri;
+                tri.v0 = v0;
+                tri.e1 = v1 - v0;
+                tri.e2 = v2 - v0;
+                tri.instanceIndex = i;
+                tri.primitiveIndex = p;
+                tri.pad = 0;
+                triangles.push_back(tri);
+            }
+
+            const Material& material = m_materials[instance.materialIndex];
+            if (material.emission.x > 0.0f || material.emission.y > 0.0f || material.emission.z > 0.0f)
+                AddInstanceLights(i, world);
+        }
+        // Moved emitters keep the light BVH topology, only new ones rebuild it
+        if (m_lightsChanged)
+            m_lights.Build();
+        else
+            m_lights.Refit();
+        m_lightsChanged = false;
+
+        m_triangleBVH.Build(std::move(triangles));
+        m_sphereBVH.Build(spheres);
+    }
+
+    void Scene::AddInstanceLights(uint32_t instanceIndex, const std::vector<float3>& world)
+    {
+        const Instance& instance = m_instances[instanceIndex];
+        const Mesh& mesh = m_meshes[instance.meshIndex];
+        const float3 emission = m_materials[instance.materialIndex].emission;
+        InstanceLights& lights = m_instanceLights[instanceIndex];
+
+        if (std::find(m_quadLightInstances.begin(), m_quadLightInstances.end(), instanceIndex) != m_quadLightInstances.end())
+        {
+            // Vertices 0, 1, 3 of AddQuadLight are the corner and the ends of the edges
+            Light light;
+            light.type = LightType::Quad;
+            light.position = world[0];
+            light.edge0 = world[1] - world[0];
+            light.edge1 = world[3] - world[0];
+            light.area = length(cross(light.edge0, light.edge1));
+            light.emission = emission;
+            lights.first = m_lights.Add(light);
+            lights.perTriangle = false;
+            return;
+        }
+
+        lights.first = m_lights.GetCount();
+        for (uint32_t p = 0; p < mesh.GetTriangleCount(); ++p)
+        {
+            const uint32_t* idx = &mesh.indices[3 * p];
+            Light light;
+            light.type = LightType::Triangle;
+            light.position = world[idx[0]];
+            light.edge0 = world[idx[1]] - world[idx[0]];
+            light.edge1 = world[idx[2]] - world[idx[0]];
+            light.area = 0.5f * length(cross(light.edge0, light.edge1));
+            light.emission = emission;
+
+            // The front side is the side of the vertex normals, whatever
+            // the winding
+            if (!mesh.normals.empty())
+            {
+                float3 n = mesh.normals[idx[0]] + mesh.normals[idx[1]] + mesh.normals[idx[2]];
+                if (dot(TransformVector(instance.normalTransform, n), cross(light.edge0, light.edge1)) < 0.0f)
+                    std::swap(light.edge0, light.edge1);
+            }
+
+            // Degenerate triangles keep their slot so the index stays
+            // first + primitiveIndex, with pmf 0 they are never selected
+            if (light.area == 0.0f)
+                light.emission = float3(0.0f);
+            m_lights.Add(light);
+        }
+    }
+
+    bool Scene::Intersect(const Ray& ray, Hit& hit) const
+    {
+        bool found = m_triangleBVH.Intersect(ray, hit);
+        if (m_sphereBVH.IsEmpty())
+            return found;
+
+        Ray sphereRay = ray;
+        if (found)
+            sphereRay.tMax = hit.t;
+        return m_sphereBVH.Intersect(sphereRay, hit) || found;
+    }
+
+    bool Scene::Occluded(const Ray& ray) const
+    {
+        return m_triangleBVH.Occluded(ray) || m_sphereBVH.Occluded(ray);
+    }
+
+    void Scene::OccludedBatch(const Ray* rays, uint32_t count, uint8_t* occluded) const
+    {
+        m_triangleBVH.OccludedBatch(rays, count, occluded);
+        if (m_sphereBVH.IsEmpty())
+            return;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!occluded[i])
+                occluded[i] = m_sphereBVH.Occluded(rays[i]) ? 1 : 0;
+        }
+    }
+
+    AABB Scene::GetBounds() const
+    {
+        AABB bounds = m_triangleBVH.GetBounds();
+        if (!m_sphereBVH.IsEmpty())
+            bounds.Grow(m_sphereBVH.GetBounds());
+        return bounds;
+    }
+
+    SurfaceHit Scene::GetSurfaceHit(const Ray& ray, const Hit& hit) const
+    {
+        const Instance& instance = m_instances[hit.instanceIndex];
+
+        SurfaceHit surface;
+        surface.position = ray.origin + ray.direction * hit.t;
+        surface.instanceIndex = hit.instanceIndex;
+        surface.materialIndex = instance.materialIndex;
+
+        if (instance.geometryType == GeometryType::ProceduralSpheres)
+        {
+            // Hollow sphere: the normal always points away from the center
+            float3 center = TransformPoint(instance.transform, m_sphereSets[instance.meshIndex][hit.primitiveIndex].center);
+            float3 n = normalize(surface.position - center);
+            float3 t = std::fabs(n.y) > 0.999f ? float3(1, 0, 0) : normalize(cross(float3(0, 1, 0), n));
+            surface.normal = n;
+            surface.tangent = t;
+            surface.bitangent = cross(n, t);
+            surface.uv = float2(0.5f + std::atan2(n.z, n.x) / PI2, std::acos(clamp(n.y, -1.0f, 1.0f)) / PI);
+            return surface;
+        }
+
+        const Mesh& mesh = m_meshes[instance.meshIndex];
+        const uint32_t* idx = &mesh.indices[3 * hit.primitiveIndex];
+        float3 barycentrics(1.0f - hit.bary.x - hit.bary.y, hit.bary.x, hit.bary.y);
+
+        float3 normal = Interpolate(mesh.normals, idx, barycentrics, float3(0, 1, 0));
+        float3 tangent = Interpolate(mesh.tangents, idx, barycentrics, float3(1, 0, 0));
+        float3 bitangent = Interpolate(mesh.bitangents, idx, barycentrics, float3(0, 0, 1));
+
+        surface.normal = normalize(TransformVector(instance.normalTransform, normal));
+        surface.tangent = normalize(TransformVector(instance.transform, tangent));
+        surface.bitangent = normalize(TransformVector(instance.transform, bitangent));
+        surface.uv = Interpolate(mesh.uvs, idx, barycentrics, float2(0.0f));
+        return surface;
+    }
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <vector>
+#include "CPU/BVH.h"
+#include "CPU/EnvironmentMap.h"
+#include "CPU/Lights.h"
+#include "CPU/SphereBVH.h"
+
+namespace CPU
+{
+    // Mirrors MaterialType in Materials/Material.h
+    enum class MaterialType
+    {
+        Base = 0,
+        Phong,
+        Disney,
+        Light,
+        Count
+    };
+
+    // Mirrors DisneyMaterialParams / the DisneyMaterialParams cbuffer of Hit.hlsl
+    struct Material
+    {
+        MaterialType type = MaterialType::Disney;
+        float3 baseColor = float3(0.0f);
+        float metallic = 0.0f;
+        float subsurface = 0.0f;
+        float specular = 0.0f;
+        float roughness = 0.0f;
+        float specularTint = 0.0f;
+        float anisotropic = 0.0f;
+        float sheen = 0.0f;
+        float sheenTint = 0.0f;
+        float clearcoat = 0.0f;
+        float clearcoatGloss = 0.0f;
+
+        // Radiance leaving the front side of every triangle, triangle
+        // instances with an emissive material become area lights. Light
+        // materials only emit, paths end on them.
+        float3 emission = float3(0.0f);
+    };
+
+    // Object space triangle mesh, same attributes as the Vertex struct of Common.hlsl
+    struct Mesh
+    {
+        std::vector<float3> positions;
+        std::vector<float3> normals;
+        std::vector<float3> tangents;
+        std::vector<float3> bitangents;
+        std::vector<float2> uvs;
+        std::vector<uint32_t> indices;
+
+        uint32_t GetTriangleCount() const { return static_cast<uint32_t>(indices.size() / 3); }
+    };
+
+    // D3D12_RAYTRACING_GEOMETRY_TYPE of an instance
+    enum class GeometryType
+    {
+        Triangles = 0,
+        ProceduralSpheres,
+    };
+
+    struct Instance
+    {
+        GeometryType geometryType;
+        uint32_t meshIndex;             // index of the mesh or of the sphere set
+        uint32_t materialIndex;
+        float4x4 transform;
+        float4x4 normalTransform;   // inverse transpose of transform
+    };
+
+    // Interpolated hit attributes in world space, what ClosestHit computes
+    // from the vertex buffer and the barycentrics
+    struct SurfaceHit
+    {
+        float3 position;
+        float3 normal;
+        float3 tangent;
+        float3 bitangent;
+        float2 uv;
+        uint32_t instanceIndex;
+        uint32_t materialIndex;
+    };
+
+    class Scene
+    {
+    public:
+        uint32_t AddMesh(Mesh&& mesh);
+        uint32_t AddMaterial(const Material& material);
+        uint32_t AddInstance(uint32_t meshIndex, uint32_t materialIndex, const float4x4& transform);
+
+        // Moves an instance, e.g. an animated emitter. Build() must be
+        // called afterwards; if only transforms changed since the last
+        // build, it refits the light BVH instead of rebuilding it.
+        void SetInstanceTransform(uint32_t instanceIndex, const float4x4& transform);
+
+        // Procedural sphere geometry, e.g. particles. Spheres are given in
+        // object space; the instance transform should be a similarity
+        // transform (radii are scaled by the length of its x axis).
+        uint32_t AddSpheres(std::vector<Sphere>&& spheres);
+        uint32_t AddSphereInstance(uint32_t sphereSetIndex, uint32_t materialIndex, const float4x4& transform);
+
+        // Explicit lights. A quad light is also added as a two triangle
+        // instance with a Light material, so BRDF sampled rays can hit it;
+        // it emits on the side of cross(edge0, edge1).
+        void AddPointLight(const float3& position, const float3& intensity);
+        uint32_t AddQuadLight(const float3& corner, const float3& edge0, const float3& edge1, const float3& emission);
+
+        // Radiance of rays leaving the scene. Without one the path tracer
+        // uses the gradient of Miss.hlsl.
+        void SetEnvironment(EnvironmentMap&& environment) { m_environment = std::move(environment); }
+
+        // Flatten all instances into world space and build the acceleration
+        // structure. Must be called after the scene content changed.
+        void Build();
+
+        bool Intersect(const Ray& ray, Hit& hit) const;
+        bool Occluded(const Ray& ray) const;
+        void OccludedBatch(const Ray* rays, uint32_t count, uint8_t* occluded) const;
+
+        SurfaceHit GetSurfaceHit(const Ray& ray, const Hit& hit) const;
+
+        // Index in GetLights() of the emitter hit, kInvalidIndex if the
+        // surface does not emit
+        uint32_t GetLightIndex(const Hit& hit) const;
+        const LightList& GetLights() const { return m_lights; }
+        const EnvironmentMap& GetEnvironment() const { return m_environment; }
+
+        const std::vector<Mesh>& GetMeshes() const { return m_meshes; }
+        const std::vector<Material>& GetMaterials() const { return m_materials; }
+        const std::vector<Instance>& GetInstances() const { return m_instances; }
+        const Material& GetMaterial(uint32_t index) const { return m_materials[index]; }
+        const TriangleBVH& GetTriangleBVH() const { return m_triangleBVH; }
+        const SphereBVH& GetSphereBVH() const { return m_sphereBVH; }
+        AABB GetBounds() const;
+
+    private:
+        void AddInstanceLights(uint32_t instanceIndex, const std::vector<float3>& world);
+
+        std::vector<Mesh> m_meshes;
+        std::vector<Material> m_materials;
+        std::vector<std::vector<Sphere>> m_sphereSets;
+        std::vector<Instance> m_instances;
+        std::vector<Light> m_pointLights;
+        std::vector<uint32_t> m_quadLightInstances;
+
+        // Lights of an emissive instance: one per triangle, or a single
+        // quad light for AddQuadLight instances
+        struct InstanceLights
+        {
+            uint32_t first = kInvalidIndex;
+            bool perTriangle = true;
+        };
+        std::vector<InstanceLights> m_instanceLights;
+        LightList m_lights;
+        bool m_lightsChanged = true;    // lights were added since the last Build()
+        EnvironmentMap m_environment;
+
+        TriangleBVH m_triangleBVH;
+        SphereBVH m_sphereBVH;
+    };
+}
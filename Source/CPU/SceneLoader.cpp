@@ -0,0 +1,134 @@
+#include "CPU/SceneLoader.h"
+#include <stdexcept>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+namespace CPU
+{
+    Mesh SceneLoader::LoadModel(const std::string& path)
+    {
+        Assimp::Importer importer;
+
+        const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate |
+                                                       aiProcess_JoinIdenticalVertices |
+                                                       aiProcess_GenSmoothNormals |
+                                                       aiProcess_FlipUVs |
+                                                       aiProcess_MakeLeftHanded);
+
+        if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !scene->mRootNode)
+            throw std::runtime_error("Could not import model " + path);
+
+        Mesh mesh;
+        for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+        {
+            const aiMesh* aMesh = scene->mMeshes[i];
+            uint32_t baseVertex = static_cast<uint32_t>(mesh.positions.size());
+
+            for (unsigned int j = 0; j < aMesh->mNumVertices; j++)
+            {
+                const aiVector3D& p = aMesh->mVertices[j];
+                const aiVector3D& n = aMesh->mNormals[j];
+                mesh.positions.push_back(float3(p.x, p.y, p.z));
+                mesh.normals.push_back(float3(n.x, n.y, n.z));
+
+                if (aMesh->mTextureCoords[0])
+                    mesh.uvs.push_back(float2(aMesh->mTextureCoords[0][j].x, aMesh->mTextureCoords[0][j].y));
+                else
+                    mesh.uvs.push_back(float2(0.0f));
+
+                if (aMesh->mTangents && aMesh->mBitangents)
+                {
+                    const aiVector3D& t = aMesh->mTangents[j];
+                    const aiVector3D& b = aMesh->mBitangents[j];
+                    mesh.tangents.push_back(float3(t.x, t.y, t.z));
+                    mesh.bitangents.push_back(float3(b.x, b.y, b.z));
+                }
+                else
+                {
+                    // Build an arbitrary frame around the normal
+                    float3 nn(n.x, n.y, n.z);
+                    float3 t = std::fabs(nn.x) > 0.9f ? float3(0, 1, 0) : float3(1, 0, 0);
+                    float3 b = normalize(cross(nn, t));
+                    mesh.tangents.push_back(cross(b, nn));
+                    mesh.bitangents.push_back(b);
+                }
+            }
+
+            for (unsigned int j = 0; j < aMesh->mNumFaces; j++)
+            {
+                const aiFace& face = aMesh->mFaces[j];
+                if (face.mNumIndices != 3)
+                    continue;
+                for (unsigned int k = 0; k < 3; k++)
+                    mesh.indices.push_back(baseVertex + face.mIndices[k]);
+            }
+        }
+
+        return mesh;
+    }
+
+    Mesh SceneLoader::CreatePlane()
+    {
+        Mesh mesh;
+        mesh.positions = {
+            { -10.f, 0.0f, 10.f }, { -10.f, 0.0f, -10.f }, { 10.f, 0.0f, 10.f },
+            { 10.f, 0.0f, 10.f }, { -10.f, 0.0f, -10.f }, { 10.f, 0.0f, -10.f },
+        };
+        mesh.normals.assign(6, float3(0.0f, 1.0f, 0.0f));
+        mesh.tangents.assign(6, float3(1.0f, 0.0f, 0.0f));
+        mesh.bitangents.assign(6, float3(0.0f, 0.0f, 1.0f));
+        mesh.uvs.assign(6, float2(0.0f));
+        mesh.indices = { 0, 1, 2, 3, 4, 5 };
+        return mesh;
+    }
+
+    void SceneLoader::LoadDefaultScene(Scene& scene, const std::string& rootPath)
+    {
+        Material planeMaterial;
+        planeMaterial.baseColor = float3(0.54f, 0.55f, 0.57f);
+        planeMaterial.metallic = 0.9f;
+        planeMaterial.roughness = 0.2f;
+
+        Material dragonMaterial;
+        dragonMaterial.baseColor = float3(1.f, 0.07f, 0.16f);
+        dragonMaterial.metallic = 0.9f;
+        dragonMaterial.roughness = 0.1f;
+
+        Material armadilloMaterial;
+        armadilloMaterial.baseColor = float3(0.82f, 0.67f, 0.16f);
+        armadilloMaterial.metallic = 0.8f;
+        armadilloMaterial.specular = 0.3f;
+        armadilloMaterial.roughness = 0.25f;
+
+        uint32_t armadilloMesh = scene.AddMesh(LoadModel(rootPath + "Models/stanford-armadillo-pbr/model.dae"));
+        uint32_t planeMesh = scene.AddMesh(CreatePlane());
+        uint32_t dragonMesh = scene.AddMesh(LoadModel(rootPath + "Models/stanford-dragon-pbr/model.dae"));
+
+        uint32_t armadillo = scene.AddMaterial(armadilloMaterial);
+        uint32_t plane = scene.AddMaterial(planeMaterial);
+        uint32_t dragon = scene.AddMaterial(dragonMaterial);
+
+        const float4x4 scale = Scaling(0.008f, 0.008f, 0.008f);
+        scene.AddInstance(armadilloMesh, armadillo, scale);
+        scene.AddInstance(armadilloMesh, armadillo, mul(Translation(-1.f, 0, 0), scale));
+        scene.AddInstance(armadilloMesh, armadillo, mul(Translation(1.f, 0, 0), scale));
+        scene.AddInstance(planeMesh, plane, float4x4());
+        scene.AddInstance(dragonMesh, dragon, mul(Translation(0, 0, 0.6f), scale));
+
+        scene.Build();
+    }
+
+    void SceneLoader::AddDefaultLights(Scene& scene)
+    {
+        scene.AddQuadLight(float3(-0.2f, 1.8f, -0.2f), float3(0.4f, 0.0f, 0.0f), float3(0.0f, 0.0f, 0.4f), float3(40.0f, 34.0f, 28.0f));
+
+        Material tileMaterial;
+        tileMaterial.type = MaterialType::Light;
+        tileMaterial.emission = float3(2.0f, 6.0f, 16.0f);
+        uint32_t tileMesh = scene.AddMesh(CreatePlane());
+        scene.AddInstance(tileMesh, scene.AddMaterial(tileMaterial), mul(Translation(0.6f, 0.001f, 0.9f), Scaling(0.015f, 1.0f, 0.015f)));
+
+        scene.Build();
+    }
+}
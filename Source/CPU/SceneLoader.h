@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include "CPU/Scene.h"
+
+namespace CPU
+{
+    // Instance order of the default scene, same as m_instances in
+    // D3DRTWindow::CreateAccelerationStructures
+    enum DefaultSceneInstance : uint32_t
+    {
+        DEFAULT_SCENE_ARMADILLO_CENTER = 0,
+        DEFAULT_SCENE_ARMADILLO_LEFT,
+        DEFAULT_SCENE_ARMADILLO_RIGHT,
+        DEFAULT_SCENE_PLANE,
+        DEFAULT_SCENE_DRAGON,
+    };
+
+    class SceneLoader
+    {
+    public:
+        // Uses the same assimp post processing as ModelLoader::LoadModel.
+        // Throws std::runtime_error if the file cannot be imported.
+        static Mesh LoadModel(const std::string& path);
+
+        // Same geometry as ModelLoader::CreatePlane
+        static Mesh CreatePlane();
+
+        // Builds the scene D3DRTWindow renders: three armadillos, the metallic
+        // plane and the dragon, with the materials of D3DRTWindow::LoadMeshes.
+        // rootPath is the directory containing Models/.
+        static void LoadDefaultScene(Scene& scene, const std::string& rootPath = "");
+
+        // Explicit lights for the default scene (the GPU scene has none): a
+        // small warm quad light above the models and a blue emissive tile
+        // on the floor, made of triangle lights. Rebuilds the scene.
+        static void AddDefaultLights(Scene& scene);
+    };
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define D3DRT_SIMD_SSE 1
+#endif
+
+// Thin float lane wrappers for writing a kernel once as a template and running
+// it 4 wide (SSE2) or 8 wide (AVX2). Comparisons return a lane mask of the
+// same type (all bits set where true) for Select, so the early-outs of the
+// scalar code become masked lanes.
+
+namespace CPU
+{
+#if defined(D3DRT_SIMD_SSE)
+    struct vfloat4
+    {
+        static const uint32_t Width = 4;
+        __m128 v;
+
+        vfloat4() {}
+        vfloat4(__m128 x) : v(x) {}
+        vfloat4(float s) : v(_mm_set1_ps(s)) {}
+
+        static vfloat4 Load(const float* p) { return _mm_loadu_ps(p); }
+        void Store(float* p) const { _mm_storeu_ps(p, v); }
+    };
+
+    inline vfloat4 operator+(const vfloat4& a, const vfloat4& b) { return _mm_add_ps(a.v, b.v); }
+    inline vfloat4 operator-(const vfloat4& a, const vfloat4& b) { return _mm_sub_ps(a.v, b.v); }
+    inline vfloat4 operator*(const vfloat4& a, const vfloat4& b) { return _mm_mul_ps(a.v, b.v); }
+    inline vfloat4 operator/(const vfloat4& a, const vfloat4& b) { return _mm_div_ps(a.v, b.v); }
+    inline vfloat4 operator-(const vfloat4& a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+    inline vfloat4 operator<(const vfloat4& a, const vfloat4& b) { return _mm_cmplt_ps(a.v, b.v); }
+    inline vfloat4 operator<=(const vfloat4& a, const vfloat4& b) { return _mm_cmple_ps(a.v, b.v); }
+    inline vfloat4 operator>(const vfloat4& a, const vfloat4& b) { return _mm_cmpgt_ps(a.v, b.v); }
+    inline vfloat4 operator>=(const vfloat4& a, const vfloat4& b) { return _mm_cmpge_ps(a.v, b.v); }
+    inline vfloat4 operator&(const vfloat4& a, const vfloat4& b) { return _mm_and_ps(a.v, b.v); }
+    inline vfloat4 operator|(const vfloat4& a, const vfloat4& b) { return _mm_or_ps(a.v, b.v); }
+
+    inline vfloat4 Min(const vfloat4& a, const vfloat4& b) { return _mm_min_ps(a.v, b.v); }
+    inline vfloat4 Max(const vfloat4& a, const vfloat4& b) { return _mm_max_ps(a.v, b.v); }
+    inline vfloat4 Sqrt(const vfloat4& a) { return _mm_sqrt_ps(a.v); }
+
+    // mask ? a : b
+    inline vfloat4 Select(const vfloat4& mask, const vfloat4& a, const vfloat4& b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+    }
+
+    // SSE2 has no floor, truncate and step down where that rounded up
+    inline vfloat4 Floor(const vfloat4& a)
+    {
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a.v), _mm_set1_ps(1.0f)));
+    }
+
+    // 2^n for integer valued n in [-126, 127]
+    inline vfloat4 Pow2i(const vfloat4& n)
+    {
+        __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+    }
+
+    // Mantissa in [1, 2) and unbiased exponent of positive normal floats
+    inline vfloat4 SplitExponent(const vfloat4& a, vfloat4& exponent)
+    {
+        __m128i bits = _mm_castps_si128(a.v);
+        exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+        return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+    }
+#endif
+
+#if defined(__AVX2__)
+    struct vfloat8
+    {
+        static const uint32_t Width = 8;
+        __m256 v;
+
+        vfloat8() {}
+        vfloat8(__m256 x) : v(x) {}
+        vfloat8(float s) : v(_mm256_set1_ps(s)) {}
+
+        static vfloat8 Load(const float* p) { return _mm256_loadu_ps(p); }
+        void Store(float* p) const { _mm256_storeu_ps(p, v); }
+    };
+
+    inline vfloat8 operator+(const vfloat8& a, const vfloat8& b) { return _mm256_add_ps(a.v, b.v); }
+    inline vfloat8 operator-(const vfloat8& a, const vfloat8& b) { return _mm256_sub_ps(a.v, b.v); }
+    inline vfloat8 operator*(const vfloat8& a, const vfloat8& b) { return _mm256_mul_ps(a.v, b.v); }
+    inline vfloat8 operator/(const vfloat8& a, const vfloat8& b) { return _mm256_div_ps(a.v, b.v); }
+    inline vfloat8 operator-(const vfloat8& a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+    inline vfloat8 operator<(const vfloat8& a, const vfloat8& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+    inline vfloat8 operator<=(const vfloat8& a, const vfloat8& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+    inline vfloat8 operator>(const vfloat8& a, const vfloat8& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+    inline vfloat8 operator>=(const vfloat8& a, const vfloat8& b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+    inline vfloat8 operator&(const vfloat8& a, const vfloat8& b) { return _mm256_and_ps(a.v, b.v); }
+    inline vfloat8 operator|(const vfloat8& a, const vfloat8& b) { return _mm256_or_ps(a.v, b.v); }
+
+    inline vfloat8 Min(const vfloat8& a, const vfloat8& b) { return _mm256_min_ps(a.v, b.v); }
+    inline vfloat8 Max(const vfloat8& a, const vfloat8& b) { return _mm256_max_ps(a.v, b.v); }
+    inline vfloat8 Sqrt(const vfloat8& a) { return _mm256_sqrt_ps(a.v); }
+    inline vfloat8 Select(const vfloat8& mask, const vfloat8& a, const vfloat8& b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+    inline vfloat8 Floor(const vfloat8& a) { return _mm256_floor_ps(a.v); }
+
+    inline vfloat8 Pow2i(const vfloat8& n)
+    {
+        __m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+    }
+
+    inline vfloat8 SplitExponent(const vfloat8& a, vfloat8& exponent)
+    {
+        __m256i bits = _mm256_castps_si256(a.v);
+        exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+        return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+    }
+#endif
+
+    //-----------------------------------------------------------------------------
+    // Width independent helpers
+    //-----------------------------------------------------------------------------
+
+    template <class V>
+    inline V Lerp(const V& a, const V& b, const V& t) { return a + (b - a) * t; }
+
+    // sin(2 pi u) and cos(2 pi u). The argument is reduced in u, where it is
+    // exact, to r in [-1/8, 1/8] plus a quarter turn count; the Cephes sinf /
+    // cosf polynomials on [-pi/4, pi/4] are accurate to about 1e-7.
+    template <class V>
+    inline void SinCos2Pi(const V& u, V& s, V& c)
+    {
+        V q = Floor(u * 4.0f + 0.5f);
+        V x = (u - q * 0.25f) * 6.283185307179586f;
+        V x2 = x * x;
+
+        V sinX = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+        V cosX = 1.0f - 0.5f * x2 + x2 * x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+
+        // Quadrant k = q mod 4: (s, c), (c, -s), (-s, -c), (-c, s)
+        V k = q - Floor(q * 0.25f) * 4.0f;
+        V odd = (k - Floor(k * 0.5f) * 2.0f) > 0.5f;
+        V sinNegative = k > 1.5f;
+        V cosNegative = (k > 0.5f) & (k < 2.5f);
+
+        s = Select(odd, cosX, sinX);
+        c = Select(odd, sinX, cosX);
+        s = Select(sinNegative, -s, s);
+        c = Select(cosNegative, -c, c);
+    }
+
+    // 2^x, Cephes exp2f polynomial on [-0.5, 0.5]
+    template <class V>
+    inline V Exp2(const V& x)
+    {
+        V clamped = Min(Max(x, V(-126.0f)), V(126.0f));
+        V n = Floor(clamped + 0.5f);
+        V f = clamped - n;
+
+        V p = 1.535336188319500e-4f;
+        p = p * f + 1.339887440266574e-3f;
+        p = p * f + 9.618437357674640e-3f;
+        p = p * f + 5.550332471162809e-2f;
+        p = p * f + 2.402264791363012e-1f;
+        p = p * f + 6.931472028550421e-1f;
+        return (p * f + 1.0f) * Pow2i(n);
+    }
+
+    // log2(x) for positive normal x, Cephes logf polynomial on the mantissa
+    // moved to [sqrt(1/2), sqrt(2))
+    template <class V>
+    inline V Log2(const V& x)
+    {
+        V e;
+        V m = SplitExponent(x, e);
+        V high = m > 1.41421356f;
+        m = Select(high, m * 0.5f, m);
+        e = Select(high, e + 1.0f, e);
+
+        V f = m - 1.0f;
+        V f2 = f * f;
+        V p = 7.0376836292e-2f;
+        p = p * f - 1.1514610310e-1f;
+        p = p * f + 1.1676998740e-1f;
+        p = p * f - 1.2420140846e-1f;
+        p = p * f + 1.4249322787e-1f;
+        p = p * f - 1.6668057665e-1f;
+        p = p * f + 2.0000714765e-1f;
+        p = p * f - 2.4999993993e-1f;
+        p = p * f + 3.3333331174e-1f;
+        V ln = f + f * f2 * p - f2 * 0.5f;
+        return ln * 1.44269504089f + e;
+    }
+
+    template <class V>
+    struct vfloat3
+    {
+        V x, y, z;
+
+        vfloat3() {}
+        vfloat3(const V& x_, const V& y_, const V& z_) : x(x_), y(y_), z(z_) {}
+    };
+
+    template <class V>
+    inline vfloat3<V> operator+(const vfloat3<V>& a, const vfloat3<V>& b) { return vfloat3<V>(a.x + b.x, a.y + b.y, a.z + b.z); }
+    template <class V>
+    inline vfloat3<V> operator*(const vfloat3<V>& a, const V& s) { return vfloat3<V>(a.x * s, a.y * s, a.z * s); }
+    template <class V>
+    inline vfloat3<V> operator-(const vfloat3<V>& a) { return vfloat3<V>(-a.x, -a.y, -a.z); }
+    template <class V>
+    inline V dot(const vfloat3<V>& a, const vfloat3<V>& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    template <class V>
+    inline vfloat3<V> normalize(const vfloat3<V>& a) { return a * (V(1.0f) / Sqrt(dot(a, a))); }
+    template <class V>
+    inline vfloat3<V> Select(const V& mask, const vfloat3<V>& a, const vfloat3<V>& b)
+    {
+        return vfloat3<V>(Select(mask, a.x, b.x), Select(mask, a.y, b.y), Select(mask, a.z, b.z));
+    }
+}
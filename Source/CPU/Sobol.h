@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+// Sobol generator matrices for up to kSobolMaxDimensions dimensions, built
+// by the compiler from Joe and Kuo's primitive polynomials and direction
+// numbers (new-joe-kuo-6.21201, search criterion D6: the initial numbers
+// are chosen for good 2D projections of every pair of dimensions), embedded
+// in Sobol.cpp. Dimension 0 is the van der Corput sequence, dimension d is
+// dimension d + 1 of their table. The first 8 dimensions are copied from V
+// of Math.hlsl instead so both renderers keep seeing the same sequence; two
+// of its rows do not follow the recurrence of their polynomial and cannot be
+// regenerated.
+
+namespace CPU
+{
+    static const uint32_t kSobolMaxDimensions = 1024;
+    static const uint32_t kSobolBits = 32;
+    static const uint32_t kSobolMaxDegree = 13;         // enough primitive polynomials for 1024 dimensions
+
+    // Dimension major, kSobolBits columns per dimension, like SobolV. A
+    // plain array: constant evaluation through std::array::operator[] costs
+    // several times more steps.
+    struct SobolMatrixTable
+    {
+        uint32_t columns[kSobolMaxDimensions * kSobolBits];
+
+        constexpr uint32_t operator[](uint32_t index) const { return columns[index]; }
+        constexpr const uint32_t* Dimension(uint32_t d) const { return columns + d * kSobolBits; }
+    };
+
+    // One line of Joe and Kuo's table: the primitive polynomial
+    // x^s + a_1 x^(s - 1) + ... + a_(s - 1) x + 1 as a bit mask (their s and
+    // a), and the odd initial numbers m_k < 2^k, k = 1..s
+    struct SobolInitialNumbers
+    {
+        uint16_t polynomial;
+        uint16_t m[kSobolMaxDegree];
+    };
+
+    namespace SobolGenerator
+    {
+        constexpr uint32_t Degree(uint32_t poly)
+        {
+            uint32_t degree = 0;
+            while (poly >> (degree + 1))
+                ++degree;
+            return degree;
+        }
+
+        // shaderTable holds the first shaderDimensions dimensions (SobolV),
+        // initialNumbers all kSobolMaxDimensions
+        constexpr SobolMatrixTable Generate(const uint32_t* shaderTable, uint32_t shaderDimensions, const SobolInitialNumbers* initialNumbers)
+        {
+            SobolMatrixTable table{};
+            uint32_t* v = table.columns;
+            for (uint32_t i = 0; i < shaderDimensions * kSobolBits; ++i)
+                v[i] = shaderTable[i];
+
+            for (uint32_t d = shaderDimensions; d < kSobolMaxDimensions; ++d)
+            {
+                const uint32_t poly = initialNumbers[d].polynomial;
+                const uint32_t degree = Degree(poly);
+                const uint32_t base = d * kSobolBits;
+                for (uint32_t k = 0; k < degree; ++k)
+                    v[base + k] = uint32_t(initialNumbers[d].m[k]) << (31 - k);
+
+                // Bratley and Fox's recurrence on the columns, bit degree - i
+                // of poly is the coefficient a_i
+                for (uint32_t k = degree; k < kSobolBits; ++k)
+                {
+                    uint32_t value = v[base + k - degree] ^ (v[base + k - degree] >> degree);
+                    for (uint32_t i = 1; i < degree; ++i)
+                    {
+                        if (poly >> (degree - i) & 1)
+                            value ^= v[base + k - i];
+                    }
+                    v[base + k] = value;
+                }
+            }
+            return table;
+        }
+    }
+
+    // Evaluated at compile time in Sobol.cpp
+    extern const SobolMatrixTable SobolMatrices;
+}
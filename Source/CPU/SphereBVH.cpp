@@ -0,0 +1,278 @@
+#include "CPU/SphereBVH.h"
+#include <cassert>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace CPU
+{
+    namespace
+    {
+        // A traversal holds at most one entry per level plus the root
+        const int kStackSize = BVHBuilder::kMaxDepth + 2;
+
+        inline float IntersectAABB(const BVHNode& node, const float3& origin, const float3& invDir, float tMin, float tMax)
+        {
+            float tx0 = (node.boundsMin.x - origin.x) * invDir.x;
+            float tx1 = (node.boundsMax.x - origin.x) * invDir.x;
+            float ty0 = (node.boundsMin.y - origin.y) * invDir.y;
+            float ty1 = (node.boundsMax.y - origin.y) * invDir.y;
+            float tz0 = (node.boundsMin.z - origin.z) * invDir.z;
+            float tz1 = (node.boundsMax.z - origin.z) * invDir.z;
+
+            float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), tMin));
+            float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), tMax));
+            return tNear <= tFar ? tNear : INFINITY;
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // 8-wide RaySphereIntersectionTest. The lanes follow the scalar code step
+    // by step (same stable quadratic, same discr == 0 special case, same
+    // t0/t1 selection) so results agree with the shader and the scalar test.
+    //
+#if defined(__AVX2__)
+    uint32_t IntersectSpherePacket(const SpherePacket& packet, const Ray& ray, float tMax, float t[SpherePacket::kWidth])
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 half = _mm256_set1_ps(0.5f);
+
+        __m256 dx = _mm256_set1_ps(ray.direction.x);
+        __m256 dy = _mm256_set1_ps(ray.direction.y);
+        __m256 dz = _mm256_set1_ps(ray.direction.z);
+        __m256 a = _mm256_set1_ps(dot(ray.direction, ray.direction));
+
+        __m256 lx = _mm256_sub_ps(_mm256_set1_ps(ray.origin.x), _mm256_load_ps(packet.centerX));
+        __m256 ly = _mm256_sub_ps(_mm256_set1_ps(ray.origin.y), _mm256_load_ps(packet.centerY));
+        __m256 lz = _mm256_sub_ps(_mm256_set1_ps(ray.origin.z), _mm256_load_ps(packet.centerZ));
+
+        __m256 dDotL = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, lx), _mm256_mul_ps(dy, ly)), _mm256_mul_ps(dz, lz));
+        __m256 lDotL = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(lx, lx), _mm256_mul_ps(ly, ly)), _mm256_mul_ps(lz, lz));
+        __m256 b = _mm256_add_ps(dDotL, dDotL);
+        __m256 c = _mm256_sub_ps(lDotL, _mm256_load_ps(packet.radiusSq));
+
+        __m256 discr = _mm256_sub_ps(_mm256_mul_ps(b, b), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), a), c));
+        __m256 valid = _mm256_cmp_ps(discr, zero, _CMP_GE_OQ);
+        if (_mm256_movemask_ps(valid) == 0)
+            return 0;
+
+        // q = -0.5 * (b + sign(b) * sqrt(discr)), sign(0) counts as negative
+        __m256 sq = _mm256_sqrt_ps(_mm256_max_ps(discr, zero));
+        __m256 bPositive = _mm256_cmp_ps(b, zero, _CMP_GT_OQ);
+        __m256 q = _mm256_mul_ps(_mm256_sub_ps(zero, half),
+            _mm256_blendv_ps(_mm256_sub_ps(b, sq), _mm256_add_ps(b, sq), bPositive));
+        __m256 r0 = _mm256_div_ps(q, a);
+        __m256 r1 = _mm256_div_ps(c, q);
+
+        __m256 tangent = _mm256_cmp_ps(discr, zero, _CMP_EQ_OQ);
+        __m256 single = _mm256_div_ps(_mm256_mul_ps(_mm256_sub_ps(zero, half), b), a);
+        r0 = _mm256_blendv_ps(r0, single, tangent);
+        r1 = _mm256_blendv_ps(r1, single, tangent);
+
+        __m256 t0 = _mm256_min_ps(r0, r1);
+        __m256 t1 = _mm256_max_ps(r0, r1);
+
+        __m256 tMinV = _mm256_set1_ps(ray.tMin);
+        __m256 useT0 = _mm256_cmp_ps(t0, tMinV, _CMP_GE_OQ);
+        __m256 thit = _mm256_blendv_ps(t1, t0, useT0);
+
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(thit, tMinV, _CMP_GE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(thit, _mm256_set1_ps(tMax), _CMP_LE_OQ));
+
+        _mm256_storeu_ps(t, thit);
+        return static_cast<uint32_t>(_mm256_movemask_ps(valid));
+    }
+#else
+    uint32_t IntersectSpherePacket(const SpherePacket& packet, const Ray& ray, float tMax, float t[SpherePacket::kWidth])
+    {
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+        {
+            if (!(packet.radiusSq[i] >= 0.0f))
+                continue;
+
+            float thit, tFar;
+            float3 center(packet.centerX[i], packet.centerY[i], packet.centerZ[i]);
+            if (RaySphereIntersectionTest(ray, center, std::sqrt(packet.radiusSq[i]), thit, tFar) && thit <= tMax)
+            {
+                t[i] = thit;
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+    }
+#endif
+
+    //-----------------------------------------------------------------------------
+    //
+    // Sphere BVH
+    //
+    void SphereBVH::Build(const std::vector<Primitive>& spheres)
+    {
+        std::vector<AABB> primBounds(spheres.size());
+        m_bounds = AABB();
+        for (size_t i = 0; i < spheres.size(); ++i)
+        {
+            const Sphere& s = spheres[i].sphere;
+            float3 r(s.radius, s.radius, s.radius);
+            primBounds[i].Grow(s.center - r);
+            primBounds[i].Grow(s.center + r);
+            m_bounds.Grow(primBounds[i]);
+        }
+
+        std::vector<uint32_t> primOrder;
+        // A full packet costs about as much as a single sphere, so splitting
+        // below eight spheres rarely pays off
+        BVHBuilder::Build(primBounds, SpherePacket::kWidth, m_nodes, primOrder, 4.0f);
+        primBounds.clear();
+        primBounds.shrink_to_fit();
+
+        // Pack every leaf into its own SpherePacket, leaves then index packets
+        m_packets.clear();
+        m_packets.reserve(spheres.size() / 4 + 1);
+        for (BVHNode& node : m_nodes)
+        {
+            if (!node.IsLeaf())
+                continue;
+
+            SpherePacket packet;
+            for (uint32_t i = 0; i < SpherePacket::kWidth; ++i)
+            {
+                if (i < node.primCount)
+                {
+                    const Primitive& prim = spheres[primOrder[node.leftFirst + i]];
+                    packet.centerX[i] = prim.sphere.center.x;
+                    packet.centerY[i] = prim.sphere.center.y;
+                    packet.centerZ[i] = prim.sphere.center.z;
+                    packet.radiusSq[i] = prim.sphere.radius * prim.sphere.radius;
+                    packet.instanceIndex[i] = prim.instanceIndex;
+                    packet.primitiveIndex[i] = prim.primitiveIndex;
+                }
+                else
+                {
+                    packet.centerX[i] = packet.centerY[i] = packet.centerZ[i] = 0.0f;
+                    packet.radiusSq[i] = -INFINITY;
+                    packet.instanceIndex[i] = kInvalidIndex;
+                    packet.primitiveIndex[i] = kInvalidIndex;
+                }
+            }
+            node.leftFirst = static_cast<uint32_t>(m_packets.size());
+            m_packets.push_back(packet);
+        }
+
+        m_sphereCount = spheres.size();
+    }
+
+    bool SphereBVH::Intersect(const Ray& ray, Hit& hit) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const float3 invDir(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+        float tMax = ray.tMax;
+        bool found = false;
+
+        const BVHNode* stack[kStackSize];
+        int stackPtr = 0;
+        const BVHNode* node = &m_nodes[0];
+        if (IntersectAABB(*node, ray.origin, invDir, ray.tMin, tMax) == INFINITY)
+            return false;
+
+        while (true)
+        {
+            if (node->IsLeaf())
+            {
+                const SpherePacket& packet = m_packets[node->leftFirst];
+                alignas(32) float t[SpherePacket::kWidth];
+                uint32_t mask = IntersectSpherePacket(packet, ray, tMax, t);
+                while (mask)
+                {
+                    uint32_t i = 0;
+                    while (!(mask & (1u << i)))
+                        ++i;
+                    mask &= mask - 1;
+
+                    if (t[i] < tMax)
+                    {
+                        tMax = t[i];
+                        hit.t = t[i];
+                        hit.bary = float2(0.0f);
+                        hit.instanceIndex = packet.instanceIndex[i];
+                        hit.primitiveIndex = packet.primitiveIndex[i];
+                        found = true;
+                    }
+                }
+                if (stackPtr == 0)
+                    break;
+                node = stack[--stackPtr];
+                continue;
+            }
+
+            const BVHNode* c0 = &m_nodes[node->leftFirst];
+            const BVHNode* c1 = &m_nodes[node->leftFirst + 1];
+            float d0 = IntersectAABB(*c0, ray.origin, invDir, ray.tMin, tMax);
+            float d1 = IntersectAABB(*c1, ray.origin, invDir, ray.tMin, tMax);
+            if (d0 > d1)
+            {
+                std::swap(d0, d1);
+                std::swap(c0, c1);
+            }
+
+            if (d0 == INFINITY)
+            {
+                if (stackPtr == 0)
+                    break;
+                node = stack[--stackPtr];
+            }
+            else
+            {
+                node = c0;
+                if (d1 != INFINITY)
+                {
+                    assert(stackPtr < kStackSize);
+                    stack[stackPtr++] = c1;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    bool SphereBVH::Occluded(const Ray& ray) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const float3 invDir(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+
+        const BVHNode* stack[kStackSize];
+        int stackPtr = 0;
+        stack[stackPtr++] = &m_nodes[0];
+
+        while (stackPtr > 0)
+        {
+            const BVHNode* node = stack[--stackPtr];
+            if (IntersectAABB(*node, ray.origin, invDir, ray.tMin, ray.tMax) == INFINITY)
+                continue;
+
+            if (node->IsLeaf())
+            {
+                alignas(32) float t[SpherePacket::kWidth];
+                if (IntersectSpherePacket(m_packets[node->leftFirst], ray, ray.tMax, t))
+                    return true;
+                continue;
+            }
+
+            uint32_t first = node->leftFirst;
+            uint32_t second = node->leftFirst + 1;
+            if (node->flags & BVH_FLAG_OCCLUSION_RIGHT_FIRST)
+                std::swap(first, second);
+            assert(stackPtr + 2 <= kStackSize);
+            stack[stackPtr++] = &m_nodes[second];
+            stack[stackPtr++] = &m_nodes[first];
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+#include "CPU/BVH.h"
+
+namespace CPU
+{
+    struct Sphere
+    {
+        float3 center;
+        float radius;
+    };
+
+    // Same solver as RaySphereIntersectionTest in Procedual.hlsl: the sphere is
+    // hollow, thit is t0 if it is past tMin, otherwise t1 (ray starts inside).
+    // Returns false if the ray misses or both roots are before tMin.
+    inline bool RaySphereIntersectionTest(const Ray& ray, const float3& center, float radius, float& thit, float& tmax)
+    {
+        float3 L = ray.origin - center;
+        float a = dot(ray.direction, ray.direction);
+        float b = 2 * dot(ray.direction, L);
+        float c = dot(L, L) - radius * radius;
+
+        float t0, t1;
+        float discr = b * b - 4 * a * c;
+        if (discr < 0)
+            return false;
+        else if (discr == 0)
+            t0 = t1 = -0.5f * b / a;
+        else
+        {
+            float q = (b > 0) ? -0.5f * (b + std::sqrt(discr)) : -0.5f * (b - std::sqrt(discr));
+            t0 = q / a;
+            t1 = c / q;
+        }
+        if (t0 > t1)
+            std::swap(t0, t1);
+
+        tmax = t1;
+        if (t0 < ray.tMin)
+        {
+            if (t1 < ray.tMin)
+                return false;
+            thit = t1;
+            return true;
+        }
+        thit = t0;
+        return true;
+    }
+
+    // Eight spheres in SoA form, the content of one procedural leaf. Unused
+    // lanes have radiusSq = -inf so that they can never produce a root.
+    struct alignas(32) SpherePacket
+    {
+        static const uint32_t kWidth = 8;
+
+        float centerX[kWidth];
+        float centerY[kWidth];
+        float centerZ[kWidth];
+        float radiusSq[kWidth];
+        uint32_t instanceIndex[kWidth];
+        uint32_t primitiveIndex[kWidth];
+    };
+
+    // Tests ray against all eight spheres at once (AVX2 when available).
+    // Returns a bit mask of the lanes with a root in [ray.tMin, tMax] and
+    // writes their thit to t.
+    uint32_t IntersectSpherePacket(const SpherePacket& packet, const Ray& ray, float tMax, float t[SpherePacket::kWidth]);
+
+    // BVH over analytic spheres, the CPU counterpart of a procedural AABB
+    // geometry with the SphereIntersection shader. Every leaf holds at most
+    // one SpherePacket.
+    class SphereBVH
+    {
+    public:
+        struct Primitive
+        {
+            Sphere sphere;
+            uint32_t instanceIndex;
+            uint32_t primitiveIndex;
+        };
+
+        void Build(const std::vector<Primitive>& spheres);
+
+        // hit.bary is unused for spheres
+        bool Intersect(const Ray& ray, Hit& hit) const;
+        bool Occluded(const Ray& ray) const;
+
+        const AABB& GetBounds() const { return m_bounds; }
+        size_t GetSphereCount() const { return m_sphereCount; }
+        size_t GetNodeCount() const { return m_nodes.size(); }
+        bool IsEmpty() const { return m_sphereCount == 0; }
+
+    private:
+        std::vector<BVHNode> m_nodes;
+        std::vector<SpherePacket> m_packets;
+        size_t m_sphereCount = 0;
+        AABB m_bounds;
+    };
+}
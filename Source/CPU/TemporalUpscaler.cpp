@@ -0,0 +1,240 @@
+#include "CPU/TemporalUpscaler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CPU
+{
+    namespace
+    {
+        // exp(-2.29 d^2) is close to a Blackman-Harris window of one pixel
+        // radius, the reconstruction filter of UE4's TAAU
+        const float kFilterSharpness = 2.29f;
+
+        float RadicalInverse(uint32_t index, uint32_t base)
+        {
+            const float invBase = 1.0f / float(base);
+            float result = 0.0f;
+            float scale = invBase;
+            for (; index > 0; index /= base, scale *= invBase)
+                result += float(index % base) * scale;
+            return result;
+        }
+
+        // Bright samples are weighted down so a single firefly in the
+        // neighbourhood does not dominate the filter or the clip box
+        inline float3 ToneMap(const float3& c)
+        {
+            return c * (1.0f / (1.0f + Luminance(c)));
+        }
+
+        inline float3 InverseToneMap(const float3& c)
+        {
+            return c * (1.0f / std::max(1.0f - Luminance(c), 1e-4f));
+        }
+
+        // Moves history towards the box center until it is inside
+        inline float3 ClipToBox(const float3& history, const float3& center, const float3& extent)
+        {
+            const float3 offset = history - center;
+            const float units = std::max(std::abs(offset.x) / extent.x, std::max(std::abs(offset.y) / extent.y, std::abs(offset.z) / extent.z));
+            return units > 1.0f ? center + offset * (1.0f / units) : history;
+        }
+
+        inline void CatmullRomWeights(float t, float weights[4])
+        {
+            weights[0] = t * (-0.5f + t * (1.0f - 0.5f * t));
+            weights[1] = 1.0f + t * t * (-2.5f + 1.5f * t);
+            weights[2] = t * (0.5f + t * (2.0f - 1.5f * t));
+            weights[3] = t * t * (-0.5f + 0.5f * t);
+        }
+    }
+
+    TemporalUpscaler::TemporalUpscaler(uint32_t width, uint32_t height, const TemporalUpscalerSettings& settings)
+        : m_settings(settings), m_scheduler(settings.threadCount), m_width(width), m_height(height)
+    {
+        m_settings.threadCount = m_scheduler.GetThreadCount();
+        m_settings.maxHistoryLength = std::max(1u, m_settings.maxHistoryLength);
+        m_tiles = CreateTiles(width, height, std::max(8u, m_settings.tileSize), TileOrder::Scanline);
+        m_history.assign(size_t(width) * height, float4(0.0f));
+        m_nextHistory.assign(size_t(width) * height, float4(0.0f));
+        m_motion.assign(size_t(width) * height, float2(0.0f));
+    }
+
+    void TemporalUpscaler::Reset()
+    {
+        m_hasHistory = false;
+    }
+
+    float2 TemporalUpscaler::GetJitter(uint32_t frameIndex)
+    {
+        return float2(RadicalInverse(frameIndex + 1, 2) - 0.5f, RadicalInverse(frameIndex + 1, 3) - 0.5f);
+    }
+
+    void TemporalUpscaler::Upscale(const UpscalerInput& input, std::vector<float>& rgb)
+    {
+        if (!input.previousCamera)
+            m_hasHistory = false;
+
+        m_scheduler.Run(static_cast<uint32_t>(m_tiles.size()), [&](uint32_t tileIndex, uint32_t)
+            {
+                UpscaleTile(input, m_tiles[tileIndex]);
+            });
+        std::swap(m_history, m_nextHistory);
+        m_hasHistory = true;
+
+        rgb.resize(m_history.size() * 3);
+        for (size_t i = 0; i < m_history.size(); ++i)
+        {
+            const float3 color = InverseToneMap(m_history[i].xyz());
+            rgb[i * 3 + 0] = color.x;
+            rgb[i * 3 + 1] = color.y;
+            rgb[i * 3 + 2] = color.z;
+        }
+    }
+
+    void TemporalUpscaler::UpscaleTile(const UpscalerInput& input, const Tile& tile)
+    {
+        const int renderWidth = int(input.width);
+        const int renderHeight = int(input.height);
+        const float2 renderScale(float(input.width) / float(m_width), float(input.height) / float(m_height));
+        const float2 outputScale(float(m_width) / float(input.width), float(m_height) / float(input.height));
+        const float maxHistory = float(m_settings.maxHistoryLength);
+
+        // The matrices the tracer rendered with
+        const float aspect = float(input.width) / float(input.height);
+        Camera camera = *input.camera;
+        camera.Update(aspect);
+        float4x4 previousViewProjection;
+        if (m_hasHistory)
+        {
+            Camera previous = *input.previousCamera;
+            previous.Update(aspect);
+            previousViewProjection = mul(previous.projection, previous.view);
+        }
+
+        for (uint32_t y = tile.y0; y < tile.y1; ++y)
+        {
+            for (uint32_t x = tile.x0; x < tile.x1; ++x)
+            {
+                const size_t pixel = size_t(y) * m_width + x;
+                const float2 center(x + 0.5f, y + 0.5f);
+
+                // The 3x3 render samples around the pixel center, the middle
+                // one the closest
+                const float2 position = center * renderScale;
+                const int cx = int(std::floor(position.x - input.jitter.x));
+                const int cy = int(std::floor(position.y - input.jitter.y));
+
+                float3 sum(0.0f), m1(0.0f), m2(0.0f);
+                float weightSum = 0.0f;
+                float nearestDistance = INFINITY;
+                float closestDepth = INFINITY;
+                float2 closestSample = position;
+                uint32_t count = 0;
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const int sy = cy + dy;
+                    if (sy < 0 || sy >= renderHeight)
+                        continue;
+                    for (int dx = -1; dx <= 1; ++dx)
+                    {
+                        const int sx = cx + dx;
+                        if (sx < 0 || sx >= renderWidth)
+                            continue;
+                        const size_t s = size_t(sy) * renderWidth + sx;
+                        const float2 sample = float2(sx + 0.5f, sy + 0.5f) + input.jitter;
+                        const float2 offset = sample - position;
+                        const float3 color = ToneMap(float3(input.color[s * 3], input.color[s * 3 + 1], input.color[s * 3 + 2]));
+
+                        const float weight = std::exp(-kFilterSharpness * dot(offset, offset));
+                        sum += color * weight;
+                        weightSum += weight;
+                        m1 += color;
+                        m2 += color * color;
+                        ++count;
+
+                        const float2 outputOffset = offset * outputScale;
+                        nearestDistance = std::min(nearestDistance, dot(outputOffset, outputOffset));
+
+                        if (input.depth[s] < closestDepth || (closestDepth == INFINITY && dx == 0 && dy == 0))
+                        {
+                            closestDepth = input.depth[s];
+                            closestSample = sample;
+                        }
+                    }
+                }
+
+                // How well the samples cover this output pixel: the filter
+                // weight of the nearest one in output pixels
+                const float3 current = weightSum > 0.0f ? sum * (1.0f / weightSum) : float3(0.0f);
+                const float confidence = count > 0 ? std::exp(-kFilterSharpness * nearestDistance) : 0.0f;
+
+                // Motion of the closest surface, the sky moves with the view
+                // direction alone
+                float4 history(0.0f);
+                bool historyValid = false;
+                float2 motion(0.0f);
+                if (m_hasHistory)
+                {
+                    const Ray ray = camera.GenerateRay(closestSample, input.width, input.height);
+                    const float4 world = std::isfinite(closestDepth) ? float4(ray.origin + ray.direction * closestDepth, 1.0f) : float4(ray.direction, 0.0f);
+                    const float4 clip = mul(previousViewProjection, world);
+                    if (clip.w > 0.0f)
+                    {
+                        // The sample moved from there, the pixel center by
+                        // the same offset
+                        const float2 sampleThen((clip.x / clip.w * 0.5f + 0.5f) * m_width, (-clip.y / clip.w * 0.5f + 0.5f) * m_height);
+                        motion = sampleThen - closestSample * outputScale;
+                        const float2 previous = center + motion;
+                        historyValid = previous.x >= 0.0f && previous.y >= 0.0f && previous.x < float(m_width) && previous.y < float(m_height);
+                        if (historyValid)
+                        {
+                            // Catmull-Rom keeps the history sharp under the
+                            // repeated resampling of a moving camera
+                            const float fx = previous.x - 0.5f;
+                            const float fy = previous.y - 0.5f;
+                            const int x0 = int(std::floor(fx));
+                            const int y0 = int(std::floor(fy));
+                            float wx[4], wy[4];
+                            CatmullRomWeights(fx - float(x0), wx);
+                            CatmullRomWeights(fy - float(y0), wy);
+                            float3 color(0.0f);
+                            for (int j = 0; j < 4; ++j)
+                            {
+                                const size_t row = size_t(std::clamp(y0 - 1 + j, 0, int(m_height) - 1)) * m_width;
+                                for (int i = 0; i < 4; ++i)
+                                    color += m_history[row + std::clamp(x0 - 1 + i, 0, int(m_width) - 1)].xyz() * (wx[i] * wy[j]);
+                            }
+                            const size_t nearest = size_t(std::min(int(previous.y), int(m_height) - 1)) * m_width + std::min(int(previous.x), int(m_width) - 1);
+                            history = float4(max(color, float3(0.0f)), m_history[nearest].w);
+                        }
+                    }
+                }
+
+                float3 result = current;
+                float historyLength = confidence;
+                if (historyValid && count > 0)
+                {
+                    // Variance clipping against the current samples
+                    const float3 mean = m1 * (1.0f / float(count));
+                    const float3 variance = max(m2 * (1.0f / float(count)) - mean * mean, float3(0.0f));
+                    const float3 sigma(std::sqrt(variance.x), std::sqrt(variance.y), std::sqrt(variance.z));
+                    const float3 extent = sigma * m_settings.clipGamma + float3(1e-4f);
+                    const float3 clipped = ClipToBox(history.xyz(), mean, extent);
+
+                    historyLength = std::min(history.w + confidence, maxHistory);
+                    const float alpha = historyLength > 0.0f ? confidence / historyLength : 1.0f;
+                    result = lerp(clipped, current, alpha);
+                }
+                else if (historyValid)
+                {
+                    result = history.xyz();
+                    historyLength = history.w;
+                }
+
+                m_nextHistory[pixel] = float4(result, historyLength);
+                m_motion[pixel] = motion;
+            }
+        }
+    }
+}
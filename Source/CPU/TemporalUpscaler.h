@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include "CPU/Camera.h"
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    struct TemporalUpscalerSettings
+    {
+        uint32_t maxHistoryLength = 16;     // frames the history averages over at most
+        float clipGamma = 1.25f;            // history clip box, mean +- clipGamma standard deviations
+
+        uint32_t threadCount = 0;           // 0 = all hardware threads
+        uint32_t tileSize = 64;
+    };
+
+    // One jittered frame at the render resolution
+    struct UpscalerInput
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        const float* color = nullptr;           // rgb (PathTracer::ResolveHDR)
+        const float* depth = nullptr;           // first hit distance, INFINITY on the sky (the AOV_Depth AOV)
+        float2 jitter = float2(0.0f);           // offset of the samples from the pixel centers, in render pixels
+        const Camera* camera = nullptr;         // current view, updated for the render aspect here
+        const Camera* previousCamera = nullptr; // view of the history, null restarts it
+    };
+
+    // Temporal upscaler in the style of TAAU: every frame renders one
+    // sample per pixel at a lower resolution with a different subpixel
+    // jitter, and the output accumulates them at its own resolution.
+    //
+    // An output pixel reconstructs the current frame from the 3x3 render
+    // samples around it, Gaussian weighted by their jittered distance. Its
+    // motion vector comes from the closest depth of the same samples and
+    // the previous view, the history is fetched there with a Catmull-Rom
+    // filter and clipped towards the box of mean +- clipGamma sigma of the
+    // samples (Salvi's variance clipping) to reject disocclusions and stale
+    // shading. The blend averages up to maxHistoryLength frames, everything
+    // in a 1 / (1 + luminance) tonemapped space so lone bright samples do
+    // not smear. Output tiles are spread over the threads.
+    class TemporalUpscaler
+    {
+    public:
+        TemporalUpscaler(uint32_t width, uint32_t height, const TemporalUpscalerSettings& settings = TemporalUpscalerSettings());
+
+        // rgb gets width * height output pixels
+        void Upscale(const UpscalerInput& input, std::vector<float>& rgb);
+
+        // Drops the history, the next frame starts over
+        void Reset();
+
+        // Offset in output pixels from each output pixel to where it was in
+        // the previous frame, from the last Upscale
+        const std::vector<float2>& GetMotion() const { return m_motion; }
+
+        const TemporalUpscalerSettings& GetSettings() const { return m_settings; }
+
+        // Halton (2, 3) subpixel jitter of frame frameIndex, in [-0.5, 0.5)
+        static float2 GetJitter(uint32_t frameIndex);
+
+    private:
+        void UpscaleTile(const UpscalerInput& input, const Tile& tile);
+
+        TemporalUpscalerSettings m_settings;
+        TileScheduler m_scheduler;
+        std::vector<Tile> m_tiles;
+        uint32_t m_width;
+        uint32_t m_height;
+        std::vector<float4> m_history;          // tonemapped rgb, frames averaged
+        std::vector<float4> m_nextHistory;
+        std::vector<float2> m_motion;
+        bool m_hasHistory = false;
+    };
+}
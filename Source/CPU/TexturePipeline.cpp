@@ -0,0 +1,195 @@
+#include "CPU/TexturePipeline.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include "CPU/Timer.h"
+#include "stb/stb_image.h"
+
+namespace CPU
+{
+    namespace
+    {
+        const uint32_t kInvalidTexture = ~0u;
+
+        // Whole file in memory, empty if it cannot be read
+        std::vector<uint8_t> ReadFile(const std::string& path)
+        {
+            std::vector<uint8_t> data;
+            FILE* file = std::fopen(path.c_str(), "rb");
+            if (!file)
+                return data;
+            std::fseek(file, 0, SEEK_END);
+            long size = std::ftell(file);
+            std::fseek(file, 0, SEEK_SET);
+            if (size > 0)
+            {
+                data.resize(size_t(size));
+                if (std::fread(data.data(), 1, data.size(), file) != data.size())
+                    data.clear();
+            }
+            std::fclose(file);
+            return data;
+        }
+
+        struct SourceFile
+        {
+            std::string path;
+            std::vector<uint8_t> data;
+            size_t hash = 0;
+            double readSeconds = 0.0;
+        };
+    }
+
+    void TexelDeleter::operator()(uint8_t* texels) const
+    {
+        stbi_image_free(texels);
+    }
+
+    const char* ToString(TextureLayout layout)
+    {
+        return layout == TextureLayout::R8 ? "r8" : "rgba8";
+    }
+
+    TexturePipeline::TexturePipeline(uint32_t threadCount)
+        : m_scheduler(threadCount)
+    {
+    }
+
+    uint32_t TexturePipeline::Add(const std::string& path, TextureLayout layout, bool srgb)
+    {
+        for (uint32_t i = 0; i < m_requests.size(); ++i)
+        {
+            const Request& request = m_requests[i];
+            if (request.path == path && request.layout == layout && request.srgb == srgb)
+                return i;
+        }
+        m_requests.push_back({ path, layout, srgb, kInvalidTexture });
+        m_stats.requestCount++;
+        return static_cast<uint32_t>(m_requests.size() - 1);
+    }
+
+    void TexturePipeline::Load()
+    {
+        Timer timer;
+
+        // Distinct paths of the new handles
+        std::vector<SourceFile> files;
+        std::vector<uint32_t> requestFiles(m_requests.size(), kInvalidTexture);
+        for (uint32_t i = 0; i < m_requests.size(); ++i)
+        {
+            if (m_requests[i].texture != kInvalidTexture)
+                continue;
+            uint32_t f = 0;
+            while (f < files.size() && files[f].path != m_requests[i].path)
+                ++f;
+            if (f == files.size())
+            {
+                SourceFile file;
+                file.path = m_requests[i].path;
+                files.push_back(std::move(file));
+            }
+            requestFiles[i] = f;
+        }
+        if (files.empty())
+            return;
+
+        m_scheduler.Run(static_cast<uint32_t>(files.size()), [&](uint32_t index, uint32_t)
+            {
+                SourceFile& file = files[index];
+                Timer readTimer;
+                file.data = ReadFile(file.path);
+                file.hash = std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(file.data.data()), file.data.size()));
+                file.readSeconds = readTimer.GetSeconds();
+            });
+        for (const SourceFile& file : files)
+        {
+            if (file.data.empty())
+                throw std::runtime_error("Could not read texture " + file.path);
+            m_stats.compressedBytes += file.data.size();
+        }
+        m_stats.fileCount += static_cast<uint32_t>(files.size());
+        m_stats.readSeconds += timer.GetSeconds();
+
+        // One texture per distinct file content and target, the bytes are
+        // compared in full behind the hash
+        Timer decodeTimer;
+        typedef std::tuple<size_t, size_t, TextureLayout, bool> ContentKey;
+        std::map<ContentKey, std::vector<std::pair<uint32_t, uint32_t>>> contents;   // key -> (file, texture)
+        std::vector<uint32_t> textureFiles;
+        const uint32_t firstTexture = static_cast<uint32_t>(m_textures.size());
+        for (uint32_t i = 0; i < m_requests.size(); ++i)
+        {
+            if (requestFiles[i] == kInvalidTexture)
+                continue;
+            Request& request = m_requests[i];
+            const SourceFile& file = files[requestFiles[i]];
+            std::vector<std::pair<uint32_t, uint32_t>>& candidates = contents[ContentKey(file.hash, file.data.size(), request.layout, request.srgb)];
+            for (const std::pair<uint32_t, uint32_t>& candidate : candidates)
+            {
+                if (candidate.first == requestFiles[i] || files[candidate.first].data == file.data)
+                {
+                    request.texture = candidate.second;
+                    break;
+                }
+            }
+            if (request.texture == kInvalidTexture)
+            {
+                request.texture = static_cast<uint32_t>(m_textures.size());
+                candidates.push_back({ requestFiles[i], request.texture });
+                m_textures.emplace_back();
+                m_textures.back().layout = request.layout;
+                m_textures.back().srgb = request.srgb;
+                m_textures.back().fileSize = file.data.size();
+                textureFiles.push_back(requestFiles[i]);
+            }
+            m_textures[request.texture].shareCount++;
+        }
+
+        // Largest files first, the threads steal the small ones at the end
+        std::vector<uint32_t> order(textureFiles.size());
+        for (uint32_t i = 0; i < order.size(); ++i)
+            order[i] = firstTexture + i;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return m_textures[a].fileSize > m_textures[b].fileSize; });
+
+        std::vector<std::string> errors(order.size());
+        m_scheduler.Run(static_cast<uint32_t>(order.size()), [&](uint32_t index, uint32_t)
+            {
+                DecodedTexture& texture = m_textures[order[index]];
+                const SourceFile& file = files[textureFiles[order[index] - firstTexture]];
+                Timer textureTimer;
+                const int channels = int(GetTexelSize(texture.layout));
+                int width = 0, height = 0, fileChannels = 0;
+                stbi_uc* texels = stbi_load_from_memory(file.data.data(), int(file.data.size()), &width, &height, &fileChannels, channels);
+                if (!texels)
+                {
+                    errors[index] = "Could not decode texture " + file.path + ": " + stbi_failure_reason();
+                    return;
+                }
+                texture.width = uint32_t(width);
+                texture.height = uint32_t(height);
+                texture.texels.reset(texels);
+                texture.decodeSeconds = textureTimer.GetSeconds();
+            });
+        for (const std::string& error : errors)
+        {
+            if (!error.empty())
+                throw std::runtime_error(error);
+        }
+
+        for (uint32_t i = firstTexture; i < m_textures.size(); ++i)
+            m_stats.decodedBytes += m_textures[i].GetByteSize();
+        for (uint32_t i = 0; i < m_requests.size(); ++i)
+        {
+            if (requestFiles[i] == kInvalidTexture)
+                continue;
+            m_stats.serialSeconds += files[requestFiles[i]].readSeconds + m_textures[m_requests[i].texture].decodeSeconds;
+        }
+        m_stats.textureCount += static_cast<uint32_t>(textureFiles.size());
+        m_stats.decodeSeconds += decodeTimer.GetSeconds();
+        m_stats.totalSeconds += timer.GetSeconds();
+    }
+}
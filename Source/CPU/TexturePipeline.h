@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    // Texel layout a map is converted to when it is decoded
+    enum class TextureLayout
+    {
+        RGBA8 = 0,      // color maps, alpha 255 when the file has none
+        R8,             // scalar maps (roughness, metallic, AO, opacity), grey of the file
+    };
+
+    const char* ToString(TextureLayout layout);
+
+    inline uint32_t GetTexelSize(TextureLayout layout) { return layout == TextureLayout::RGBA8 ? 4 : 1; }
+
+    // Frees the texels the decoder allocated
+    struct TexelDeleter
+    {
+        void operator()(uint8_t* texels) const;
+    };
+
+    struct DecodedTexture
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        TextureLayout layout = TextureLayout::RGBA8;
+        bool srgb = false;                  // color values are sRGB encoded
+        std::unique_ptr<uint8_t[], TexelDeleter> texels;    // row major, GetTexelSize(layout) bytes per texel
+        uint32_t shareCount = 0;            // handles that resolved to this texture
+        uint64_t fileSize = 0;
+        double decodeSeconds = 0.0;
+
+        size_t GetByteSize() const { return size_t(width) * height * GetTexelSize(layout); }
+    };
+
+    struct TexturePipelineStats
+    {
+        uint32_t requestCount = 0;          // handles given out by Add
+        uint32_t fileCount = 0;             // distinct paths read
+        uint32_t textureCount = 0;          // distinct texel data decoded
+        uint64_t compressedBytes = 0;       // of the files read
+        uint64_t decodedBytes = 0;          // of the textures decoded
+        double readSeconds = 0.0;
+        double decodeSeconds = 0.0;
+        double totalSeconds = 0.0;
+
+        // What loading every handle on its own, one after the other, would
+        // have taken: each read and decode timed here, duplicates included
+        double serialSeconds = 0.0;
+
+        double GetDecodeMBps() const { return decodeSeconds > 0.0 ? double(decodedBytes) / decodeSeconds * 1e-6 : 0.0; }
+        double GetSecondsSaved() const { return serialSeconds - totalSeconds; }
+    };
+
+    // Loads the texture maps of all materials at once. Add queues a file with
+    // the layout it should end up in and returns a handle; Load then reads
+    // every queued file and decodes them on a pool of threads, largest first
+    // so the long JPEG decodes do not end up last on one thread.
+    //
+    // Maps are shared at two levels: the same path and layout requested
+    // twice is one handle, and files whose bytes are identical (the default
+    // emissive, metallic and opacity maps every model folder ships) are
+    // decoded once for all their handles.
+    class TexturePipeline
+    {
+    public:
+        explicit TexturePipeline(uint32_t threadCount = 0);
+
+        uint32_t Add(const std::string& path, TextureLayout layout, bool srgb = false);
+
+        // Reads and decodes everything added since the last Load. Throws
+        // std::runtime_error if a file cannot be read or decoded.
+        void Load();
+
+        const DecodedTexture& GetTexture(uint32_t handle) const { return m_textures[m_requests[handle].texture]; }
+        size_t GetTextureCount() const { return m_textures.size(); }
+
+        // Accumulated over all calls to Load
+        const TexturePipelineStats& GetStats() const { return m_stats; }
+        uint32_t GetThreadCount() const { return m_scheduler.GetThreadCount(); }
+
+    private:
+        struct Request
+        {
+            std::string path;
+            TextureLayout layout;
+            bool srgb;
+            uint32_t texture;
+        };
+
+        TileScheduler m_scheduler;
+        std::vector<Request> m_requests;
+        std::vector<DecodedTexture> m_textures;
+        TexturePipelineStats m_stats;
+    };
+}
@@ -0,0 +1,247 @@
+#include "CPU/TileScheduler.h"
+#include <algorithm>
+#include "CPU/Timer.h"
+
+namespace CPU
+{
+    namespace
+    {
+        uint32_t Part1By1(uint32_t x)
+        {
+            x &= 0x0000ffff;
+            x = (x | (x << 8)) & 0x00ff00ff;
+            x = (x | (x << 4)) & 0x0f0f0f0f;
+            x = (x | (x << 2)) & 0x33333333;
+            x = (x | (x << 1)) & 0x55555555;
+            return x;
+        }
+
+        uint32_t MortonIndex(uint32_t x, uint32_t y)
+        {
+            return Part1By1(x) | (Part1By1(y) << 1);
+        }
+
+        // Distance of (x, y) along the Hilbert curve filling an n x n grid,
+        // n a power of two
+        uint32_t HilbertIndex(uint32_t n, uint32_t x, uint32_t y)
+        {
+            uint32_t d = 0;
+            for (uint32_t s = n / 2; s > 0; s /= 2)
+            {
+                uint32_t rx = (x & s) > 0;
+                uint32_t ry = (y & s) > 0;
+                d += s * s * ((3 * rx) ^ ry);
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = s - 1 - x;
+                        y = s - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return d;
+        }
+    }
+
+    std::vector<Tile> CreateTiles(uint32_t width, uint32_t height, uint32_t tileSize, TileOrder order)
+    {
+        tileSize = std::max(1u, tileSize);
+        const uint32_t tilesX = (width + tileSize - 1) / tileSize;
+        const uint32_t tilesY = (height + tileSize - 1) / tileSize;
+
+        uint32_t n = 1;
+        while (n < std::max(tilesX, tilesY))
+            n *= 2;
+
+        std::vector<std::pair<uint32_t, Tile>> keyed;
+        keyed.reserve(size_t(tilesX) * tilesY);
+        for (uint32_t ty = 0; ty < tilesY; ++ty)
+        {
+            for (uint32_t tx = 0; tx < tilesX; ++tx)
+            {
+                Tile tile;
+                tile.x0 = tx * tileSize;
+                tile.y0 = ty * tileSize;
+                tile.x1 = std::min(tile.x0 + tileSize, width);
+                tile.y1 = std::min(tile.y0 + tileSize, height);
+
+                uint32_t key = ty * tilesX + tx;
+                if (order == TileOrder::Morton)
+                    key = MortonIndex(tx, ty);
+                else if (order == TileOrder::Hilbert)
+                    key = HilbertIndex(n, tx, ty);
+                keyed.push_back(std::make_pair(key, tile));
+            }
+        }
+
+        std::stable_sort(keyed.begin(), keyed.end(),
+            [](const std::pair<uint32_t, Tile>& a, const std::pair<uint32_t, Tile>& b) { return a.first < b.first; });
+
+        std::vector<Tile> tiles;
+        tiles.reserve(keyed.size());
+        for (const auto& k : keyed)
+            tiles.push_back(k.second);
+        return tiles;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // TileScheduler
+    //
+    TileScheduler::TileScheduler(uint32_t threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        for (uint32_t i = 0; i < threadCount; ++i)
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        m_threadStats.resize(threadCount);
+
+        for (uint32_t i = 1; i < threadCount; ++i)
+            m_threads.emplace_back(&TileScheduler::WorkerLoop, this, i);
+    }
+
+    TileScheduler::~TileScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_exit = true;
+        }
+        m_startCondition.notify_all();
+        for (std::thread& thread : m_threads)
+            thread.join();
+    }
+
+    void TileScheduler::Run(uint32_t tileCount, const TileFunction& function)
+    {
+        const uint32_t threadCount = GetThreadCount();
+
+        // Seed each deque with a contiguous run of tiles, keeping the locality
+        // of the tile order within a thread
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            uint32_t first = uint32_t(uint64_t(tileCount) * i / threadCount);
+            uint32_t last = uint32_t(uint64_t(tileCount) * (i + 1) / threadCount);
+            WorkerQueue& queue = *m_queues[i];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tiles.clear();
+            for (uint32_t t = first; t < last; ++t)
+                queue.tiles.push_back(t);
+            m_threadStats[i] = ThreadStats();
+        }
+        m_tileTimes.assign(tileCount, 0.0);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_function = &function;
+            m_busyWorkers = threadCount - 1;
+            m_generation++;
+        }
+        m_startCondition.notify_all();
+
+        Execute(0);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this]() { return m_busyWorkers == 0; });
+        m_function = nullptr;
+    }
+
+    void TileScheduler::WorkerLoop(uint32_t threadIndex)
+    {
+        uint64_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_startCondition.wait(lock, [&]() { return m_exit || m_generation != generation; });
+                if (m_exit)
+                    return;
+                generation = m_generation;
+            }
+
+            Execute(threadIndex);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_busyWorkers--;
+            }
+            m_doneCondition.notify_one();
+        }
+    }
+
+    void TileScheduler::Execute(uint32_t threadIndex)
+    {
+        ThreadStats& stats = m_threadStats[threadIndex];
+        Timer busy;
+
+        while (true)
+        {
+            uint32_t tile;
+            bool stolen = false;
+            if (!PopLocal(threadIndex, tile))
+            {
+                // Nothing is ever pushed during a run, so once every deque is
+                // empty the thread is done
+                if (!m_workStealing || !Steal(threadIndex, tile))
+                    break;
+                stolen = true;
+            }
+
+            Timer timer;
+            (*m_function)(tile, threadIndex);
+            m_tileTimes[tile] = timer.GetMilliseconds();
+
+            stats.tiles++;
+            stats.stolen += stolen ? 1 : 0;
+        }
+
+        stats.busySeconds = busy.GetSeconds();
+    }
+
+    bool TileScheduler::PopLocal(uint32_t threadIndex, uint32_t& tile)
+    {
+        WorkerQueue& queue = *m_queues[threadIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tiles.empty())
+            return false;
+        tile = queue.tiles.front();
+        queue.tiles.pop_front();
+        return true;
+    }
+
+    bool TileScheduler::Steal(uint32_t threadIndex, uint32_t& tile)
+    {
+        const uint32_t threadCount = GetThreadCount();
+
+        // Take from the back of the fullest victim: those tiles are the
+        // furthest from what the victim is working on
+        while (true)
+        {
+            uint32_t victim = threadIndex;
+            size_t victimSize = 0;
+            for (uint32_t i = 1; i < threadCount; ++i)
+            {
+                uint32_t candidate = (threadIndex + i) % threadCount;
+                WorkerQueue& queue = *m_queues[candidate];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tiles.size() > victimSize)
+                {
+                    victim = candidate;
+                    victimSize = queue.tiles.size();
+                }
+            }
+            if (victimSize == 0)
+                return false;
+
+            WorkerQueue& queue = *m_queues[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tiles.empty())
+                continue;   // raced with the owner or another thief, look again
+            tile = queue.tiles.back();
+            queue.tiles.pop_back();
+            return true;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CPU
+{
+    struct Tile
+    {
+        uint32_t x0, y0;
+        uint32_t x1, y1;                // exclusive
+    };
+
+    // Order in which tiles are listed, and therefore handed out. Morton and
+    // Hilbert keep consecutive tiles close on screen, so a thread working down
+    // its run of tiles touches neighbouring geometry and BVH nodes.
+    enum class TileOrder
+    {
+        Scanline = 0,
+        Morton,
+        Hilbert,
+    };
+
+    std::vector<Tile> CreateTiles(uint32_t width, uint32_t height, uint32_t tileSize, TileOrder order);
+
+    // Persistent worker pool running one function per tile. Each thread owns
+    // a deque seeded with a contiguous run of the tile list; it pops its own
+    // tiles from the front and, once empty, steals from the back of the other
+    // deques, so expensive regions (the dragon) do not leave threads idle
+    // while cheap ones (the sky) finish early.
+    class TileScheduler
+    {
+    public:
+        typedef std::function<void(uint32_t tileIndex, uint32_t threadIndex)> TileFunction;
+
+        struct ThreadStats
+        {
+            uint32_t tiles = 0;
+            uint32_t stolen = 0;
+            double busySeconds = 0.0;
+        };
+
+        // threadCount = 0 uses all hardware threads. The calling thread of
+        // Run is worker 0, threadCount - 1 threads are created.
+        explicit TileScheduler(uint32_t threadCount = 0);
+        ~TileScheduler();
+
+        TileScheduler(const TileScheduler&) = delete;
+        TileScheduler& operator=(const TileScheduler&) = delete;
+
+        // Runs function for every tile index in [0, tileCount) and returns
+        // when all of them are done
+        void Run(uint32_t tileCount, const TileFunction& function);
+
+        // With stealing disabled every thread only runs its own run of tiles,
+        // i.e. a static split. Used to measure what stealing buys.
+        void SetWorkStealing(bool enable) { m_workStealing = enable; }
+
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_queues.size()); }
+
+        // Timings of the last Run: milliseconds per tile index and per thread stats
+        const std::vector<double>& GetTileTimes() const { return m_tileTimes; }
+        const std::vector<ThreadStats>& GetThreadStats() const { return m_threadStats; }
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<uint32_t> tiles;
+        };
+
+        void WorkerLoop(uint32_t threadIndex);
+        void Execute(uint32_t threadIndex);
+        bool PopLocal(uint32_t threadIndex, uint32_t& tile);
+        bool Steal(uint32_t threadIndex, uint32_t& tile);
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_threads;
+        bool m_workStealing = true;
+
+        std::mutex m_mutex;
+        std::condition_variable m_startCondition;
+        std::condition_variable m_doneCondition;
+        uint64_t m_generation = 0;
+        uint32_t m_busyWorkers = 0;
+        bool m_exit = false;
+        const TileFunction* m_function = nullptr;
+
+        std::vector<double> m_tileTimes;
+        std::vector<ThreadStats> m_threadStats;
+    };
+}
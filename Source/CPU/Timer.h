@@ -0,0 +1,26 @@
+#pragma once
+
+#include <chrono>
+
+namespace CPU
+{
+    // Portable wall clock stopwatch. RenderTime is built on the Win32
+    // performance counter and is tied to the window message loop.
+    class Timer
+    {
+    public:
+        Timer() { Reset(); }
+
+        void Reset() { m_start = std::chrono::steady_clock::now(); }
+
+        double GetSeconds() const
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+        }
+
+        double GetMilliseconds() const { return GetSeconds() * 1000.0; }
+
+    private:
+        std::chrono::steady_clock::time_point m_start;
+    };
+}
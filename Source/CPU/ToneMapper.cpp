@@ -0,0 +1,401 @@
+#include "CPU/ToneMapper.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "CPU/Simd.h"
+
+namespace CPU
+{
+    namespace
+    {
+        // Encode table range: floats from 2^-13, which still encodes to 0,
+        // to the largest float below 1, in buckets of their top 17 bits
+        const uint32_t kMinBits = (127 - 13) << 23;
+        const uint32_t kAlmostOneBits = 0x3F7FFFFF;
+        const uint32_t kBucketShift = 15;
+        const uint32_t kBucketCount = (0x3F800000 - kMinBits) >> kBucketShift;
+
+        struct SRGBTable
+        {
+            int32_t value[kBucketCount];        // encode of the bucket start
+            float step[kBucketCount];           // smallest float that encodes to value + 1
+            float minValue;
+            float almostOne;
+
+            // Encodes x^gamma: 1 for linear input, 2.2 for values already
+            // display encoded for a 2.2 gamma
+            explicit SRGBTable(double gamma)
+            {
+                std::memcpy(&minValue, &kMinBits, sizeof(float));
+                std::memcpy(&almostOne, &kAlmostOneBits, sizeof(float));
+
+                // Input where the rounded encode reaches v, rounded up to the
+                // next float: x encodes to v exactly when steps[v] <= x < steps[v + 1]
+                float steps[257];
+                steps[0] = -INFINITY;
+                steps[256] = INFINITY;
+                for (int v = 1; v < 256; ++v)
+                {
+                    double s = (double(v) - 0.5) / 255.0;
+                    double linear = s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+                    double input = std::pow(linear, 1.0 / gamma);
+                    float f = static_cast<float>(input);
+                    if (double(f) < input)
+                        f = std::nextafter(f, INFINITY);
+                    steps[v] = f;
+                }
+
+                // sRGB steps are at least 0.89% apart in linear, 0.405% with
+                // the 2.2 gamma, and a bucket is 0.39% wide, so one compare
+                // per bucket is enough
+                for (uint32_t b = 0; b < kBucketCount; ++b)
+                {
+                    uint32_t bits = kMinBits + (b << kBucketShift);
+                    float start;
+                    std::memcpy(&start, &bits, sizeof(start));
+                    int32_t v = static_cast<int32_t>(std::upper_bound(steps, steps + 257, start) - steps) - 1;
+                    value[b] = v;
+                    step[b] = steps[v + 1];
+                }
+            }
+        };
+
+        const SRGBTable& GetSRGBTable()
+        {
+            static const SRGBTable table(1.0);
+            return table;
+        }
+
+        const SRGBTable& GetGamma22Table()
+        {
+            static const SRGBTable table(2.2);
+            return table;
+        }
+
+        // Scalar lanes, with the NaN behaviour of minps / maxps (the second
+        // operand wins)
+        inline float Min(float a, float b) { return a < b ? a : b; }
+        inline float Max(float a, float b) { return a > b ? a : b; }
+        inline float Log2(float x) { return std::log2(x); }
+        inline float Exp2(float x) { return std::exp2(x); }
+
+        template <class V>
+        struct Lanes
+        {
+            static const uint32_t Width = V::Width;
+        };
+
+        template <>
+        struct Lanes<float>
+        {
+            static const uint32_t Width = 1;
+        };
+
+        template <class V>
+        inline V Saturate(const V& x)
+        {
+            return Min(Max(x, V(0.0f)), V(1.0f));
+        }
+
+        // out = m * in, m row major
+        template <class V>
+        inline void Transform(const float m[9], V& r, V& g, V& b)
+        {
+            V x = r * m[0] + g * m[1] + b * m[2];
+            V y = r * m[3] + g * m[4] + b * m[5];
+            V z = r * m[6] + g * m[7] + b * m[8];
+            r = x;
+            g = y;
+            b = z;
+        }
+
+        //-----------------------------------------------------------------------------
+        // Tone curves, linear in, linear out except for AgX
+        //-----------------------------------------------------------------------------
+
+        // sRGB to the RRT input space and the ODT output back, with the
+        // RRT + ODT curve fitted in between (Stephen Hill, BakingLab)
+        const float kACESInput[9] = {
+            0.59719f, 0.35458f, 0.04823f,
+            0.07600f, 0.90834f, 0.01566f,
+            0.02840f, 0.13383f, 0.83777f,
+        };
+        const float kACESOutput[9] = {
+            1.60475f, -0.53108f, -0.07367f,
+            -0.10208f, 1.10813f, -0.00605f,
+            -0.00327f, -0.07276f, 1.07602f,
+        };
+
+        template <class V>
+        inline V ACESFit(const V& v)
+        {
+            V a = v * (v + 0.0245786f) - 0.000090537f;
+            V b = v * (v * 0.983729f + 0.4329510f) + 0.238081f;
+            return a / b;
+        }
+
+        // AgX inset and outset, the log2 range it maps to [0, 1] and the 6th
+        // order fit of its default contrast sigmoid
+        const float kAgXInset[9] = {
+            0.842479062253094f, 0.0784335999999992f, 0.0792237451477643f,
+            0.0423282422610123f, 0.878468636469772f, 0.0791661274605434f,
+            0.0423756549057051f, 0.0784336f, 0.879142973793104f,
+        };
+        const float kAgXOutset[9] = {
+            1.19687900512017f, -0.0980208811401368f, -0.0990297440797205f,
+            -0.0528968517574562f, 1.15190312990417f, -0.0989611768448433f,
+            -0.0529716355144438f, -0.0980434501171241f, 1.15107367264116f,
+        };
+        const float kAgXMinEV = -12.47393f;
+        const float kAgXMaxEV = 4.026069f;
+        const float kPositiveEpsilon = 1e-10f;
+
+        template <class V>
+        inline V AgXSigmoid(const V& v)
+        {
+            V x = Min(Max(Log2(Max(v, V(kPositiveEpsilon))), V(kAgXMinEV)), V(kAgXMaxEV));
+            x = (x - kAgXMinEV) * (1.0f / (kAgXMaxEV - kAgXMinEV));
+            V x2 = x * x;
+            V x4 = x2 * x2;
+            return x4 * x2 * 15.5f - x4 * x * 40.14f + x4 * 31.96f - x2 * x * 6.868f + x2 * 0.4298f + x * 0.1191f - 0.00232f;
+        }
+
+        // The sigmoid output is display encoded for a 2.2 gamma. The sRGB
+        // encode takes it as is through the 2.2 table, only the linear
+        // quantization needs it back in linear.
+        template <class V>
+        inline V AgXLinearize(const V& v)
+        {
+            return Exp2(Log2(Max(v, V(kPositiveEpsilon))) * 2.2f);
+        }
+
+        template <class V, ToneCurve Curve>
+        inline void ApplyCurve(bool srgb, V& r, V& g, V& b)
+        {
+            if (Curve == ToneCurve::Reinhard)
+            {
+                r = r / (r + 1.0f);
+                g = g / (g + 1.0f);
+                b = b / (b + 1.0f);
+            }
+            else if (Curve == ToneCurve::ACES)
+            {
+                Transform(kACESInput, r, g, b);
+                r = ACESFit(r);
+                g = ACESFit(g);
+                b = ACESFit(b);
+                Transform(kACESOutput, r, g, b);
+            }
+            else if (Curve == ToneCurve::AgX)
+            {
+                Transform(kAgXInset, r, g, b);
+                r = AgXSigmoid(r);
+                g = AgXSigmoid(g);
+                b = AgXSigmoid(b);
+                Transform(kAgXOutset, r, g, b);
+                if (!srgb)
+                {
+                    r = AgXLinearize(r);
+                    g = AgXLinearize(g);
+                    b = AgXLinearize(b);
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------
+        // Loads, encodes and stores per lane width
+        //-----------------------------------------------------------------------------
+
+        inline void LoadRGB(const float* p, float& r, float& g, float& b)
+        {
+            r = p[0];
+            g = p[1];
+            b = p[2];
+        }
+
+        inline uint32_t Encode(float x, bool srgb, const SRGBTable& table)
+        {
+            if (!srgb)
+                return static_cast<uint32_t>(Saturate(x) * 255.0f + 0.5f);
+            x = Min(Max(x, table.minValue), table.almostOne);
+            uint32_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            const uint32_t bucket = (bits - kMinBits) >> kBucketShift;
+            return static_cast<uint32_t>(table.value[bucket] + (x >= table.step[bucket] ? 1 : 0));
+        }
+
+        inline void StoreRGBA8(uint32_t* out, uint32_t r, uint32_t g, uint32_t b)
+        {
+            *out = r | g << 8 | b << 16 | 0xFF000000u;
+        }
+
+#if defined(D3DRT_SIMD_SSE)
+        inline void LoadRGB(const float* p, vfloat4& r, vfloat4& g, vfloat4& b)
+        {
+            // 4 pixels in 3 registers, transposed by shuffles
+            __m128 a = _mm_loadu_ps(p);             // r0 g0 b0 r1
+            __m128 c = _mm_loadu_ps(p + 4);         // g1 b1 r2 g2
+            __m128 d = _mm_loadu_ps(p + 8);         // b2 r3 g3 b3
+            // Lanes 0 and 2 of each pair hold the two pixels
+            __m128 r01 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0));     // r0 r1
+            __m128 r23 = _mm_shuffle_ps(c, d, _MM_SHUFFLE(1, 1, 2, 2));     // r2 r3
+            __m128 g01 = _mm_shuffle_ps(a, c, _MM_SHUFFLE(0, 0, 1, 1));     // g0 g1
+            __m128 g23 = _mm_shuffle_ps(c, d, _MM_SHUFFLE(2, 2, 3, 3));     // g2 g3
+            __m128 b01 = _mm_shuffle_ps(a, c, _MM_SHUFFLE(1, 1, 2, 2));     // b0 b1
+            __m128 b23 = _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 3, 0, 0));     // b2 b3
+            r = _mm_shuffle_ps(r01, r23, _MM_SHUFFLE(2, 0, 2, 0));
+            g = _mm_shuffle_ps(g01, g23, _MM_SHUFFLE(2, 0, 2, 0));
+            b = _mm_shuffle_ps(b01, b23, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        // SSE2 has no gather, the buckets are looked up one lane at a time
+        inline __m128i Encode(const vfloat4& x, bool srgb, const SRGBTable& table)
+        {
+            if (!srgb)
+                return _mm_cvttps_epi32((Saturate(x) * 255.0f + 0.5f).v);
+            vfloat4 clamped = Min(Max(x, vfloat4(table.minValue)), vfloat4(table.almostOne));
+            __m128i buckets = _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(clamped.v), _mm_set1_epi32(int(kMinBits))), kBucketShift);
+            alignas(16) uint32_t index[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(index), buckets);
+            __m128i value = _mm_setr_epi32(table.value[index[0]], table.value[index[1]], table.value[index[2]], table.value[index[3]]);
+            __m128 step = _mm_setr_ps(table.step[index[0]], table.step[index[1]], table.step[index[2]], table.step[index[3]]);
+            return _mm_sub_epi32(value, _mm_castps_si128(_mm_cmpge_ps(clamped.v, step)));
+        }
+
+        inline void StoreRGBA8(uint32_t* out, __m128i r, __m128i g, __m128i b)
+        {
+            __m128i rgba = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_set1_epi32(int(0xFF000000u))));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), rgba);
+        }
+#endif
+
+#if defined(__AVX2__)
+        inline void LoadRGB(const float* p, vfloat8& r, vfloat8& g, vfloat8& b)
+        {
+            // Two SSE transposes, pixels 0-3 in the low half
+            vfloat4 r0, g0, b0, r1, g1, b1;
+            LoadRGB(p, r0, g0, b0);
+            LoadRGB(p + 12, r1, g1, b1);
+            r = _mm256_insertf128_ps(_mm256_castps128_ps256(r0.v), r1.v, 1);
+            g = _mm256_insertf128_ps(_mm256_castps128_ps256(g0.v), g1.v, 1);
+            b = _mm256_insertf128_ps(_mm256_castps128_ps256(b0.v), b1.v, 1);
+        }
+
+        inline __m256i Encode(const vfloat8& x, bool srgb, const SRGBTable& table)
+        {
+            if (!srgb)
+                return _mm256_cvttps_epi32((Saturate(x) * 255.0f + 0.5f).v);
+            vfloat8 clamped = Min(Max(x, vfloat8(table.minValue)), vfloat8(table.almostOne));
+            __m256i buckets = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(clamped.v), _mm256_set1_epi32(int(kMinBits))), kBucketShift);
+            __m256i value = _mm256_i32gather_epi32(table.value, buckets, 4);
+            __m256 step = _mm256_i32gather_ps(table.step, buckets, 4);
+            return _mm256_sub_epi32(value, _mm256_castps_si256(_mm256_cmp_ps(clamped.v, step, _CMP_GE_OQ)));
+        }
+
+        inline void StoreRGBA8(uint32_t* out, __m256i r, __m256i g, __m256i b)
+        {
+            __m256i rgba = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)), _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_set1_epi32(int(0xFF000000u))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), rgba);
+        }
+#endif
+
+        struct MapArgs
+        {
+            float scale;                // 2^exposure
+            bool srgb;
+            const SRGBTable* table;     // of the curve output
+        };
+
+        // Pixels [x0, x1) of a row, V lanes at a time; returns where it
+        // stopped, the rest is left for narrower lanes
+        template <class V, ToneCurve Curve>
+        uint32_t MapPixels(const MapArgs& a, const float* rgb, uint32_t* rgba, uint32_t x0, uint32_t x1)
+        {
+            const uint32_t width = Lanes<V>::Width;
+            uint32_t x = x0;
+            for (; x + width <= x1; x += width)
+            {
+                V r, g, b;
+                LoadRGB(rgb + size_t(x) * 3, r, g, b);
+                r = Max(r * a.scale, V(0.0f));
+                g = Max(g * a.scale, V(0.0f));
+                b = Max(b * a.scale, V(0.0f));
+                ApplyCurve<V, Curve>(a.srgb, r, g, b);
+                StoreRGBA8(rgba + x, Encode(r, a.srgb, *a.table), Encode(g, a.srgb, *a.table), Encode(b, a.srgb, *a.table));
+            }
+            return x;
+        }
+
+        template <ToneCurve Curve>
+        void MapRow(const MapArgs& a, SimdWidth simdWidth, const float* rgb, uint32_t* rgba, uint32_t width)
+        {
+            uint32_t x = 0;
+#if defined(__AVX2__)
+            if (simdWidth == SimdWidth::AVX2)
+                x = MapPixels<vfloat8, Curve>(a, rgb, rgba, x, width);
+#endif
+#if defined(D3DRT_SIMD_SSE)
+            if (simdWidth >= SimdWidth::SSE)
+                x = MapPixels<vfloat4, Curve>(a, rgb, rgba, x, width);
+#endif
+            MapPixels<float, Curve>(a, rgb, rgba, x, width);
+        }
+    }
+
+    const char* ToString(ToneCurve curve)
+    {
+        switch (curve)
+        {
+        case ToneCurve::Reinhard: return "reinhard";
+        case ToneCurve::ACES: return "aces";
+        case ToneCurve::AgX: return "agx";
+        default: return "clamp";
+        }
+    }
+
+    uint8_t LinearToSRGB8(float x)
+    {
+        return static_cast<uint8_t>(Encode(x, true, GetSRGBTable()));
+    }
+
+    ToneMapper::ToneMapper(const ToneMapperSettings& settings)
+        : m_settings(settings)
+        , m_scheduler(settings.threadCount)
+    {
+        m_settings.threadCount = m_scheduler.GetThreadCount();
+        m_settings.rowsPerTask = std::max(1u, m_settings.rowsPerTask);
+        m_settings.simdWidth = std::min(m_settings.simdWidth, GetMaxSimdWidth());
+        GetSRGBTable();
+        GetGamma22Table();
+    }
+
+    void ToneMapper::Apply(const float* rgb, uint32_t width, uint32_t height, std::vector<uint8_t>& rgba)
+    {
+        rgba.resize(size_t(width) * height * 4);
+        uint32_t* out = reinterpret_cast<uint32_t*>(rgba.data());
+
+        MapArgs args;
+        args.scale = std::exp2(m_settings.exposure);
+        args.srgb = m_settings.srgb;
+        args.table = m_settings.curve == ToneCurve::AgX ? &GetGamma22Table() : &GetSRGBTable();
+
+        const uint32_t rowsPerTask = m_settings.rowsPerTask;
+        const uint32_t taskCount = (height + rowsPerTask - 1) / rowsPerTask;
+        m_scheduler.Run(taskCount, [&](uint32_t task, uint32_t)
+        {
+            const uint32_t y1 = std::min(height, (task + 1) * rowsPerTask);
+            for (uint32_t y = task * rowsPerTask; y < y1; ++y)
+            {
+                const float* row = rgb + size_t(y) * width * 3;
+                uint32_t* outRow = out + size_t(y) * width;
+                switch (m_settings.curve)
+                {
+                case ToneCurve::Reinhard: MapRow<ToneCurve::Reinhard>(args, m_settings.simdWidth, row, outRow, width); break;
+                case ToneCurve::ACES: MapRow<ToneCurve::ACES>(args, m_settings.simdWidth, row, outRow, width); break;
+                case ToneCurve::AgX: MapRow<ToneCurve::AgX>(args, m_settings.simdWidth, row, outRow, width); break;
+                default: MapRow<ToneCurve::Clamp>(args, m_settings.simdWidth, row, outRow, width); break;
+                }
+            }
+        });
+    }
+}
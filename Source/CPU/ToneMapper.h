@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include "CPU/DisneySIMD.h"
+#include "CPU/TileScheduler.h"
+
+namespace CPU
+{
+    enum class ToneCurve
+    {
+        Clamp = 0,      // saturate, what the GPU output does
+        Reinhard,       // x / (1 + x) per channel
+        ACES,           // Hill's fit of the ACES RRT + sRGB ODT
+        AgX,            // Sobotka's AgX base, Wrensch's polynomial sigmoid
+    };
+
+    const char* ToString(ToneCurve curve);
+
+    struct ToneMapperSettings
+    {
+        float exposure = 0.0f;              // stops, the radiance is scaled by 2^exposure
+        ToneCurve curve = ToneCurve::Clamp;
+        bool srgb = true;                   // encode with the sRGB transfer function, else quantize linearly
+
+        uint32_t threadCount = 0;           // 0 = all hardware threads
+        uint32_t rowsPerTask = 16;
+        SimdWidth simdWidth = SimdWidth::AVX2;  // clamped to the build
+    };
+
+    // Correctly rounded 8-bit sRGB of a linear value: the same result as
+    // round(255 * sRGB(saturate(x))) in double precision, for every float
+    uint8_t LinearToSRGB8(float x);
+
+    // Output stage from a float HDR buffer to RGBA8: exposure, the tone
+    // curve, then the sRGB encode. The encode is a table lookup on the top
+    // bits of the float (256 buckets per octave from 2^-13 to 1) giving the
+    // sRGB value at the bucket start and the linear value where it steps
+    // up, which happens at most once per bucket; one compare makes the
+    // result exact. Rows are split into bands over the threads, each band
+    // runs vfloat8 / vfloat4 wide with table gathers.
+    class ToneMapper
+    {
+    public:
+        explicit ToneMapper(const ToneMapperSettings& settings = ToneMapperSettings());
+
+        // rgb is row major, 3 floats per pixel (PathTracer::ResolveHDR), rgba
+        // gets 4 bytes per pixel with alpha 255
+        void Apply(const float* rgb, uint32_t width, uint32_t height, std::vector<uint8_t>& rgba);
+
+        const ToneMapperSettings& GetSettings() const { return m_settings; }
+
+    private:
+        ToneMapperSettings m_settings;
+        TileScheduler m_scheduler;
+    };
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+// Small HLSL-flavoured vector library for the CPU tracer. It deliberately has
+// no dependency on DirectXMath or Windows headers so the CPU code can be built
+// on machines without a D3D12 SDK. Matrices use the column-vector convention,
+// so mul(M, v) matches the mul(viewI, float4(...)) calls in the HLSL shaders.
+
+namespace CPU
+{
+    static const float PI = 3.141592653589793f;
+    static const float PI2 = 6.283185307179586f;
+
+    struct float2
+    {
+        float x, y;
+
+        float2() : x(0), y(0) {}
+        float2(float s) : x(s), y(s) {}
+        float2(float x_, float y_) : x(x_), y(y_) {}
+
+        float& operator[](int i) { return (&x)[i]; }
+        float operator[](int i) const { return (&x)[i]; }
+    };
+
+    struct float3
+    {
+        float x, y, z;
+
+        float3() : x(0), y(0), z(0) {}
+        float3(float s) : x(s), y(s), z(s) {}
+        float3(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+
+        float& operator[](int i) { return (&x)[i]; }
+        float operator[](int i) const { return (&x)[i]; }
+    };
+
+    struct float4
+    {
+        float x, y, z, w;
+
+        float4() : x(0), y(0), z(0), w(0) {}
+        float4(float s) : x(s), y(s), z(s), w(s) {}
+        float4(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
+        float4(const float3& v, float w_) : x(v.x), y(v.y), z(v.z), w(w_) {}
+
+        float3 xyz() const { return float3(x, y, z); }
+
+        float& operator[](int i) { return (&x)[i]; }
+        float operator[](int i) const { return (&x)[i]; }
+    };
+
+    // float2
+    inline float2 operator+(const float2& a, const float2& b) { return float2(a.x + b.x, a.y + b.y); }
+    inline float2 operator-(const float2& a, const float2& b) { return float2(a.x - b.x, a.y - b.y); }
+    inline float2 operator*(const float2& a, const float2& b) { return float2(a.x * b.x, a.y * b.y); }
+    inline float2 operator*(const float2& a, float s) { return float2(a.x * s, a.y * s); }
+    inline float2 operator*(float s, const float2& a) { return float2(a.x * s, a.y * s); }
+    inline float2 operator/(const float2& a, const float2& b) { return float2(a.x / b.x, a.y / b.y); }
+    inline float dot(const float2& a, const float2& b) { return a.x * b.x + a.y * b.y; }
+
+    // float3
+    inline float3 operator-(const float3& a) { return float3(-a.x, -a.y, -a.z); }
+    inline float3 operator+(const float3& a, const float3& b) { return float3(a.x + b.x, a.y + b.y, a.z + b.z); }
+    inline float3 operator-(const float3& a, const float3& b) { return float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+    inline float3 operator*(const float3& a, const float3& b) { return float3(a.x * b.x, a.y * b.y, a.z * b.z); }
+    inline float3 operator/(const float3& a, const float3& b) { return float3(a.x / b.x, a.y / b.y, a.z / b.z); }
+    inline float3 operator*(const float3& a, float s) { return float3(a.x * s, a.y * s, a.z * s); }
+    inline float3 operator*(float s, const float3& a) { return float3(a.x * s, a.y * s, a.z * s); }
+    inline float3 operator/(const float3& a, float s) { float inv = 1.0f / s; return a * inv; }
+    inline float3& operator+=(float3& a, const float3& b) { a.x += b.x; a.y += b.y; a.z += b.z; return a; }
+    inline float3& operator-=(float3& a, const float3& b) { a.x -= b.x; a.y -= b.y; a.z -= b.z; return a; }
+    inline float3& operator*=(float3& a, const float3& b) { a.x *= b.x; a.y *= b.y; a.z *= b.z; return a; }
+    inline float3& operator*=(float3& a, float s) { a.x *= s; a.y *= s; a.z *= s; return a; }
+
+    inline float dot(const float3& a, const float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    inline float3 cross(const float3& a, const float3& b)
+    {
+        return float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+    }
+    inline float length(const float3& a) { return std::sqrt(dot(a, a)); }
+    inline float3 normalize(const float3& a) { return a * (1.0f / std::sqrt(dot(a, a))); }
+    inline float3 min(const float3& a, const float3& b) { return float3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)); }
+    inline float3 max(const float3& a, const float3& b) { return float3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)); }
+    inline float MaxComponent(const float3& a) { return std::max(a.x, std::max(a.y, a.z)); }
+
+    // HLSL intrinsics
+    inline float lerp(float a, float b, float t) { return a + (b - a) * t; }
+    inline float3 lerp(const float3& a, const float3& b, float t) { return a + (b - a) * t; }
+    inline float saturate(float x) { return std::min(1.0f, std::max(0.0f, x)); }
+    inline float3 saturate(const float3& v) { return float3(saturate(v.x), saturate(v.y), saturate(v.z)); }
+    inline float clamp(float x, float lo, float hi) { return std::min(hi, std::max(lo, x)); }
+    inline float frac(float x) { return x - std::floor(x); }
+    // reflect(i, n) = i - 2 * n * dot(i, n)
+    inline float3 reflect(const float3& i, const float3& n) { return i - 2.0f * n * dot(i, n); }
+    inline float Luminance(const float3& c) { return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z; }
+
+    // float4
+    inline float4 operator+(const float4& a, const float4& b) { return float4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+    inline float4& operator+=(float4& a, const float4& b) { a.x += b.x; a.y += b.y; a.z += b.z; a.w += b.w; return a; }
+    inline float4 operator*(const float4& a, float s) { return float4(a.x * s, a.y * s, a.z * s, a.w * s); }
+    inline float dot(const float4& a, const float4& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+    //-----------------------------------------------------------------------------
+    //
+    // 4x4 matrix, m[row][col], column-vector convention (p' = M * p)
+    //
+    struct float4x4
+    {
+        float m[4][4];
+
+        float4x4()
+        {
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    m[r][c] = (r == c) ? 1.0f : 0.0f;
+        }
+
+        float4 Row(int r) const { return float4(m[r][0], m[r][1], m[r][2], m[r][3]); }
+    };
+
+    inline float4 mul(const float4x4& a, const float4& v)
+    {
+        return float4(dot(a.Row(0), v), dot(a.Row(1), v), dot(a.Row(2), v), dot(a.Row(3), v));
+    }
+
+    inline float4x4 mul(const float4x4& a, const float4x4& b)
+    {
+        float4x4 r;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + a.m[i][3] * b.m[3][j];
+        return r;
+    }
+
+    inline float3 TransformPoint(const float4x4& a, const float3& p) { return mul(a, float4(p, 1.0f)).xyz(); }
+    inline float3 TransformVector(const float4x4& a, const float3& v) { return mul(a, float4(v, 0.0f)).xyz(); }
+
+    inline float4x4 Transpose(const float4x4& a)
+    {
+        float4x4 r;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = a.m[j][i];
+        return r;
+    }
+
+    inline float4x4 Translation(float x, float y, float z)
+    {
+        float4x4 r;
+        r.m[0][3] = x; r.m[1][3] = y; r.m[2][3] = z;
+        return r;
+    }
+
+    inline float4x4 Scaling(float x, float y, float z)
+    {
+        float4x4 r;
+        r.m[0][0] = x; r.m[1][1] = y; r.m[2][2] = z;
+        return r;
+    }
+
+    // General inverse by cofactor expansion (double precision for stability)
+    inline float4x4 Inverse(const float4x4& a)
+    {
+        double s[16], inv[16];
+        for (int i = 0; i < 16; ++i)
+            s[i] = a.m[i / 4][i % 4];
+
+        inv[0] = s[5] * s[10] * s[15] - s[5] * s[11] * s[14] - s[9] * s[6] * s[15] + s[9] * s[7] * s[14] + s[13] * s[6] * s[11] - s[13] * s[7] * s[10];
+        inv[4] = -s[4] * s[10] * s[15] + s[4] * s[11] * s[14] + s[8] * s[6] * s[15] - s[8] * s[7] * s[14] - s[12] * s[6] * s[11] + s[12] * s[7] * s[10];
+        inv[8] = s[4] * s[9] * s[15] - s[4] * s[11] * s[13] - s[8] * s[5] * s[15] + s[8] * s[7] * s[13] + s[12] * s[5] * s[11] - s[12] * s[7] * s[9];
+        inv[12] = -s[4] * s[9] * s[14] + s[4] * s[10] * s[13] + s[8] * s[5] * s[14] - s[8] * s[6] * s[13] - s[12] * s[5] * s[10] + s[12] * s[6] * s[9];
+        inv[1] = -s[1] * s[10] * s[15] + s[1] * s[11] * s[14] + s[9] * s[2] * s[15] - s[9] * s[3] * s[14] - s[13] * s[2] * s[11] + s[13] * s[3] * s[10];
+        inv[5] = s[0] * s[10] * s[15] - s[0] * s[11] * s[14] - s[8] * s[2] * s[15] + s[8] * s[3] * s[14] + s[12] * s[2] * s[11] - s[12] * s[3] * s[10];
+        inv[9] = -s[0] * s[9] * s[15] + s[0] * s[11] * s[13] + s[8] * s[1] * s[15] - s[8] * s[3] * s[13] - s[12] * s[1] * s[11] + s[12] * s[3] * s[9];
+        inv[13] = s[0] * s[9] * s[14] - s[0] * s[10] * s[13] - s[8] * s[1] * s[14] + s[8] * s[2] * s[13] + s[12] * s[1] * s[10] - s[12] * s[2] * s[9];
+        inv[2] = s[1] * s[6] * s[15] - s[1] * s[7] * s[14] - s[5] * s[2] * s[15] + s[5] * s[3] * s[14] + s[13] * s[2] * s[7] - s[13] * s[3] * s[6];
+        inv[6] = -s[0] * s[6] * s[15] + s[0] * s[7] * s[14] + s[4] * s[2] * s[15] - s[4] * s[3] * s[14] - s[12] * s[2] * s[7] + s[12] * s[3] * s[6];
+        inv[10] = s[0] * s[5] * s[15] - s[0] * s[7] * s[13] - s[4] * s[1] * s[15] + s[4] * s[3] * s[13] + s[12] * s[1] * s[7] - s[12] * s[3] * s[5];
+        inv[14] = -s[0] * s[5] * s[14] + s[0] * s[6] * s[13] + s[4] * s[1] * s[14] - s[4] * s[2] * s[13] - s[12] * s[1] * s[6] + s[12] * s[2] * s[5];
+        inv[3] = -s[1] * s[6] * s[11] + s[1] * s[7] * s[10] + s[5] * s[2] * s[11] - s[5] * s[3] * s[10] - s[9] * s[2] * s[7] + s[9] * s[3] * s[6];
+        inv[7] = s[0] * s[6] * s[11] - s[0] * s[7] * s[10] - s[4] * s[2] * s[11] + s[4] * s[3] * s[10] + s[8] * s[2] * s[7] - s[8] * s[3] * s[6];
+        inv[11] = -s[0] * s[5] * s[11] + s[0] * s[7] * s[9] + s[4] * s[1] * s[11] - s[4] * s[3] * s[9] - s[8] * s[1] * s[7] + s[8] * s[3] * s[5];
+        inv[15] = s[0] * s[5] * s[10] - s[0] * s[6] * s[9] - s[4] * s[1] * s[10] + s[4] * s[2] * s[9] + s[8] * s[1] * s[6] - s[8] * s[2] * s[5];
+
+        double det = s[0] * inv[0] + s[1] * inv[4] + s[2] * inv[8] + s[3] * inv[12];
+        double invDet = (det != 0.0) ? 1.0 / det : 0.0;
+
+        float4x4 r;
+        for (int i = 0; i < 16; ++i)
+            r.m[i / 4][i % 4] = static_cast<float>(inv[i] * invDet);
+        return r;
+    }
+
+    // Same result as glm::lookAt (right handed), used by the camera manipulator
+    inline float4x4 LookAtRH(const float3& eye, const float3& center, const float3& up)
+    {
+        float3 f = normalize(center - eye);
+        float3 s = normalize(cross(f, up));
+        float3 u = cross(s, f);
+
+        float4x4 r;
+        r.m[0][0] = s.x;  r.m[0][1] = s.y;  r.m[0][2] = s.z;  r.m[0][3] = -dot(s, eye);
+        r.m[1][0] = u.x;  r.m[1][1] = u.y;  r.m[1][2] = u.z;  r.m[1][3] = -dot(u, eye);
+        r.m[2][0] = -f.x; r.m[2][1] = -f.y; r.m[2][2] = -f.z; r.m[2][3] = dot(f, eye);
+        return r;
+    }
+
+    // Same result as XMMatrixPerspectiveFovRH (depth mapped to [0, 1])
+    inline float4x4 PerspectiveFovRH(float fovAngleY, float aspectRatio, float nearZ, float farZ)
+    {
+        float yScale = 1.0f / std::tan(0.5f * fovAngleY);
+        float xScale = yScale / aspectRatio;
+        float range = farZ / (nearZ - farZ);
+
+        float4x4 r;
+        r.m[0][0] = xScale;
+        r.m[1][1] = yScale;
+        r.m[2][2] = range;
+        r.m[2][3] = range * nearZ;
+        r.m[3][2] = -1.0f;
+        r.m[3][3] = 0.0f;
+        return r;
+    }
+
+    //-----------------------------------------------------------------------------
+    //
+    // Axis aligned bounding box
+    //
+    struct AABB
+    {
+        float3 boundsMin = float3(INFINITY);
+        float3 boundsMax = float3(-INFINITY);
+
+        void Grow(const float3& p) { boundsMin = min(boundsMin, p); boundsMax = max(boundsMax, p); }
+        void Grow(const AABB& b) { boundsMin = min(boundsMin, b.boundsMin); boundsMax = max(boundsMax, b.boundsMax); }
+        bool IsValid() const { return boundsMin.x <= boundsMax.x; }
+        float3 Centroid() const { return (boundsMin + boundsMax) * 0.5f; }
+        float SurfaceArea() const
+        {
+            if (!IsValid())
+                return 0.0f;
+            float3 e = boundsMax - boundsMin;
+            return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+        }
+    };
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdlib>
+#include <map>
+#include <string>
+
+namespace Common
+{
+    // Command line options of the form --name=value, a bare --name is "1".
+    // Shared by D3DRTBench and D3DRTHeadless.
+    class Args
+    {
+    public:
+        Args() {}
+        Args(int argc, char** argv)
+        {
+            for (int i = 0; i < argc; ++i)
+            {
+                std::string arg = argv[i];
+                if (arg.compare(0, 2, "--") != 0)
+                    continue;
+                size_t eq = arg.find('=');
+                if (eq == std::string::npos)
+                    m_values[arg.substr(2)] = "1";
+                else
+                    m_values[arg.substr(2, eq - 2)] = arg.substr(eq + 1);
+            }
+        }
+
+        bool Has(const std::string& name) const { return m_values.count(name) != 0; }
+
+        std::string GetString(const std::string& name, const std::string& fallback) const
+        {
+            auto it = m_values.find(name);
+            return it == m_values.end() ? fallback : it->second;
+        }
+
+        int GetInt(const std::string& name, int fallback) const
+        {
+            auto it = m_values.find(name);
+            return it == m_values.end() ? fallback : std::atoi(it->second.c_str());
+        }
+
+        float GetFloat(const std::string& name, float fallback) const
+        {
+            auto it = m_values.find(name);
+            return it == m_values.end() ? fallback : static_cast<float>(std::atof(it->second.c_str()));
+        }
+
+    private:
+        std::map<std::string, std::string> m_values;
+    };
+}
@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 #include <array>
+#include <stdexcept>
 #include <string>
 #include "./DXRHelpers/nv_helpers_dx12/RaytracingPipelineGenerator.h"   
 #include "./DXRHelpers/nv_helpers_dx12/RootSignatureGenerator.h"
@@ -26,6 +27,10 @@
 #include "Windowsx.h"
 #include "stb/stb_image.h"
 #include "Util/Utility.h"
+#include "CPU/BlueNoise.h"
+#include "CPU/MipGenerator.h"
+#include "CPU/TexturePipeline.h"
+#include "CPU/Timer.h"
 #include <glm/gtc/matrix_transform.hpp>
 
 D3DRTWindow::D3DRTWindow(UINT width, UINT height, std::wstring name) :
@@ -70,6 +75,8 @@ void D3DRTWindow::OnInit()
     // Create a buffer to store the modelview and perspective camera matrices
     CreateCameraBuffer();
     CreateRayTracingGlobalConstantBuffer();
+    CreateLightBuffer();
+    CreateBlueNoiseBuffer();
 
     // Create the buffer containing the raytracing result (always output in a
     // UAV), and create the heap referencing the resources used by the raytracing,
@@ -445,8 +452,6 @@ void D3DRTWindow::PopulateCommandList()
         g_commandList->CopyResource(m_renderTargets[m_frameIndex].Get(),
             m_outputResource.Get());
 
-        UpdateFrameBuffer();
-
         transition = CD3DX12_RESOURCE_BARRIER::Transition(
             m_renderTargets[m_frameIndex].Get(), D3D12_RESOURCE_STATE_COPY_DEST,
             D3D12_RESOURCE_STATE_RENDER_TARGET);
@@ -560,7 +565,8 @@ void D3DRTWindow::CreateShaderResourceHeap()
 {
     // #DXR Extra: Perspective Camera
     // Create a SRV/UAV/CBV descriptor heap. We need 3 entries - 1 SRV for the TLAS, 1 UAV for the
-    // raytracing output and 1 CBV for the camera matrices, 1 CBV for the frame count, 1 SRV for the frame texture
+    // raytracing output and 1 CBV for the camera matrices, 1 CBV for the frame count, 1 UAV for the accumulation buffer,
+    // 1 UAV for the luminance moments of adaptive sampling
     m_srvUavHeap = nv_helpers_dx12::CreateDescriptorHeap(
         g_device.Get(), 6, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, true);
 
@@ -612,17 +618,24 @@ void D3DRTWindow::CreateShaderResourceHeap()
     globalCbvDesc.SizeInBytes = m_rayTracingGlobalConstantBufferSize;
     g_device->CreateConstantBufferView(&globalCbvDesc, srvHandle);
 
-    // Frame texture
+    // Accumulation buffer
     srvHandle.ptr +=
         g_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-    // Describe and create a constant buffer view for frame count
-    D3D12_SHADER_RESOURCE_VIEW_DESC frameSrvDesc = {};
-    frameSrvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    frameSrvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    frameSrvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    frameSrvDesc.Texture2D.MipLevels = 1;
-    g_device->CreateShaderResourceView(m_frameBuffer.Get(), &frameSrvDesc, srvHandle);
+    // Describe and create the UAV of the float radiance sum / sample count
+    D3D12_UNORDERED_ACCESS_VIEW_DESC accumulationUavDesc = {};
+    accumulationUavDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    accumulationUavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+    g_device->CreateUnorderedAccessView(m_frameBuffer.Get(), nullptr, &accumulationUavDesc, srvHandle);
+
+    // Luminance mean / M2 used by the adaptive sampler
+    srvHandle.ptr +=
+        g_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    D3D12_UNORDERED_ACCESS_VIEW_DESC varianceUavDesc = {};
+    varianceUavDesc.Format = DXGI_FORMAT_R32G32_FLOAT;
+    varianceUavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+    g_device->CreateUnorderedAccessView(m_varianceBuffer.Get(), nullptr, &varianceUavDesc, srvHandle);
 }
 
 //-----------------------------------------------------------------------------
@@ -669,8 +682,9 @@ void D3DRTWindow::CreateShaderBindingTable()
                 (void*)(m_armadilloMeshResource->GetVertexBuffer()->GetGPUVirtualAddress()),
                 (void*)(m_armadilloMeshResource->GetIndexBuffer()->GetGPUVirtualAddress()),
                 heapPointer,
-                (void*)(m_armadilloMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress())
-
+                (void*)(m_armadilloMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress()),
+                (void*)(m_lightBuffer->GetGPUVirtualAddress()),
+                (void*)(m_blueNoiseBuffer->GetGPUVirtualAddress())
             }
         );
         // #DXR Extra - Another ray type
@@ -686,7 +700,9 @@ void D3DRTWindow::CreateShaderBindingTable()
             (void*)(m_planeMeshResource->GetVertexBuffer()->GetGPUVirtualAddress()),
             (void*)(m_planeMeshResource->GetIndexBuffer()->GetGPUVirtualAddress()),
             heapPointer /*TODO: HitGroup input data is messed up*/,
-            (void*)(m_planeMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress())
+            (void*)(m_planeMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress()),
+            (void*)(m_lightBuffer->GetGPUVirtualAddress()),
+            (void*)(m_blueNoiseBuffer->GetGPUVirtualAddress())
         });
     m_sbtHelper.AddHitGroup(L"ShadowHitGroup", {});
 
@@ -696,12 +712,14 @@ void D3DRTWindow::CreateShaderBindingTable()
         (void*)(m_dragonMeshResource->GetVertexBuffer()->GetGPUVirtualAddress()),
         (void*)(m_dragonMeshResource->GetIndexBuffer()->GetGPUVirtualAddress()),
         heapPointer,
-        (void*)(m_dragonMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress())
+        (void*)(m_dragonMeshResource->GetMaterial()->GetMaterialBuffer()->GetGPUVirtualAddress()),
+        (void*)(m_lightBuffer->GetGPUVirtualAddress()),
+        (void*)(m_blueNoiseBuffer->GetGPUVirtualAddress())
         });
 
-
-    ////// #DXR Extra - Another ray type
-    //m_sbtHelper.AddHitGroup(L"ShadowHitGroup", {});
+    // #DXR Extra - Another ray type
+    // The light sampling shadow rays can be cast at the dragon too
+    m_sbtHelper.AddHitGroup(L"ShadowHitGroup", {});
 
     // Compute the size of the SBT given the number of shaders and their
     // parameters
@@ -904,22 +922,25 @@ void D3DRTWindow::CreateRaytracingPipeline() {
     // Create signature for each shader type
     m_rayGenSig.Reset(1);
 
-    m_rayGenSig[0].InitAsDescriptorTable(5);
+    m_rayGenSig[0].InitAsDescriptorTable(6);
     m_rayGenSig[0].SetTableRange(0, D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 0 /*u0*/, 1); // u0, raytracing output
     m_rayGenSig[0].SetTableRange(1, D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 0 /*t0*/, 1); // t0, TLAS
     m_rayGenSig[0].SetTableRange(2, D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 0 /*b0*/, 1); // b0, camera parameters
     m_rayGenSig[0].SetTableRange(3, D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1 /*b1*/, 1); // b1, global parameters (frameCount)
-    m_rayGenSig[0].SetTableRange(4, D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1 /*t1*/, 1); // t1, frame texture buffer
+    m_rayGenSig[0].SetTableRange(4, D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1 /*u1*/, 1); // u1, accumulation buffer
+    m_rayGenSig[0].SetTableRange(5, D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 2 /*u2*/, 1); // u2, luminance moments
 
     m_rayGenSig.Finalize(L"RayGen", D3D12_ROOT_SIGNATURE_FLAG_LOCAL_ROOT_SIGNATURE);
 
-    m_hitSig.Reset(5);
+    m_hitSig.Reset(7);
     m_hitSig[0].InitAsConstantBuffer(0 /*b0*/);
     m_hitSig[1].InitAsBufferSRV(0 /*t0*/); // vertices
     m_hitSig[2].InitAsBufferSRV(1 /*t1*/); // indices
     m_hitSig[3].InitAsDescriptorTable(1);
     m_hitSig[3].SetTableRange(0, D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 2 /*t2*/, 1, 0, 1 /*2nd slot of the heap*/); // t2, TLAS
     m_hitSig[4].InitAsConstantBuffer(1 /*b1*/); // b1, material buffer
+    m_hitSig[5].InitAsBufferSRV(3 /*t3*/); // t3, lights
+    m_hitSig[6].InitAsBufferSRV(4 /*t4*/); // t4, blue noise sampler keys
     m_hitSig.Finalize(L"Hit", D3D12_ROOT_SIGNATURE_FLAG_LOCAL_ROOT_SIGNATURE);
 
     m_missSig.Reset(0);
@@ -1121,6 +1142,7 @@ void D3DRTWindow::CreateRayTracingGlobalConstantBuffer()
 
     RayTracingGlobalParams params = {};
 	params.frameCount = 0;
+	params.lightCount = static_cast<UINT>(m_lights.size());
 
 	// Copy material data
 	uint8_t* pData;
@@ -1130,10 +1152,70 @@ void D3DRTWindow::CreateRayTracingGlobalConstantBuffer()
 
 }
 
+//-----------------------------------------------------------------------------
+// Upload the light list read by ClosestHit, with the selection probabilities
+// proportional to the power like CPU::LightList::Build. The buffer always
+// holds at least one light so the t3 root SRV is valid with no lights.
+//
+void D3DRTWindow::CreateLightBuffer()
+{
+    std::vector<RayTracingLight> lights = m_lights;
+
+    double total = 0.0;
+    std::vector<double> power(lights.size());
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        const RayTracingLight& light = lights[i];
+        double luminance = 0.2126 * light.emission.x + 0.7152 * light.emission.y + 0.0722 * light.emission.z;
+        power[i] = light.type == 0 /*LIGHT_POINT*/ ? 4.0 * XM_PI * luminance : XM_PI * light.area * luminance;
+        total += power[i];
+    }
+
+    double sum = 0.0;
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        lights[i].pmf = float(total > 0.0 ? power[i] / total : 1.0 / double(lights.size()));
+        sum += lights[i].pmf;
+        lights[i].cdf = float(sum);
+    }
+    if (!lights.empty())
+        lights.back().cdf = 1.0f;
+    else
+        lights.push_back(RayTracingLight{});
+
+    UINT bufferSize = static_cast<UINT>(lights.size() * sizeof(RayTracingLight));
+    m_lightBuffer = nv_helpers_dx12::CreateBuffer(
+        g_device.Get(), bufferSize, D3D12_RESOURCE_FLAG_NONE,
+        D3D12_RESOURCE_STATE_GENERIC_READ, nv_helpers_dx12::kUploadHeapProps);
+
+    uint8_t* pData;
+    ThrowIfFailed(m_lightBuffer->Map(0, nullptr, (void**)&pData));
+    memcpy(pData, lights.data(), bufferSize);
+    m_lightBuffer->Unmap(0, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Upload the blue noise sampler keys of CPU::BlueNoiseKeys, read by ClosestHit
+// when Hit.hlsl is compiled with SAMPLER_BLUE_NOISE.
+//
+void D3DRTWindow::CreateBlueNoiseBuffer()
+{
+    UINT bufferSize = static_cast<UINT>(sizeof(CPU::BlueNoiseKeys));
+    m_blueNoiseBuffer = nv_helpers_dx12::CreateBuffer(
+        g_device.Get(), bufferSize, D3D12_RESOURCE_FLAG_NONE,
+        D3D12_RESOURCE_STATE_GENERIC_READ, nv_helpers_dx12::kUploadHeapProps);
+
+    uint8_t* pData;
+    ThrowIfFailed(m_blueNoiseBuffer->Map(0, nullptr, (void**)&pData));
+    memcpy(pData, CPU::BlueNoiseKeys, bufferSize);
+    m_blueNoiseBuffer->Unmap(0, nullptr);
+}
+
 void D3DRTWindow::UpdateRayTracingGlobalConstantBuffer()
 {
     RayTracingGlobalParams params = {};
 	params.frameCount = m_rayTracingFrameCount;
+	params.lightCount = static_cast<UINT>(m_lights.size());
 
 	// Copy material data
 	uint8_t* pData;
@@ -1142,21 +1224,6 @@ void D3DRTWindow::UpdateRayTracingGlobalConstantBuffer()
 	m_rayTracingGlobalConstantBuffer->Unmap(0, nullptr);
 }
 
-void D3DRTWindow::UpdateFrameBuffer()
-{
-    g_commandList->ResourceBarrier(1,
-        &CD3DX12_RESOURCE_BARRIER::Transition(m_frameBuffer.Get(),
-            D3D12_RESOURCE_STATE_COMMON,
-            D3D12_RESOURCE_STATE_COPY_DEST));
-
-    g_commandList->CopyResource(m_frameBuffer.Get(), m_outputResource.Get());
-
-    g_commandList->ResourceBarrier(1,
-        &CD3DX12_RESOURCE_BARRIER::Transition(m_frameBuffer.Get(),
-            D3D12_RESOURCE_STATE_COPY_DEST,
-            D3D12_RESOURCE_STATE_COMMON));
-}
-
 void D3DRTWindow::CreateRasterizerDescriptorHeap()
 {
     // Create descriptor heap for default heap buffer
@@ -1532,22 +1599,70 @@ D3DRTWindow::AccelerationStructureBuffers D3DRTWindow::CreateAABBBottomLevelAS()
 
 
 void D3DRTWindow::ImportTexture() {
-    // Create Texture
-    int width, height, channels;
+    // Decode the PBR maps of every model at once on the CPU threads, maps
+    // with identical files are decoded once. The rasterizer only samples the
+    // dragon albedo so far.
+    const char* models[] = { "stanford-armadillo-pbr", "stanford-bunny-pbr", "stanford-dragon-pbr" };
+    const char* colorMaps[] = { "albedo", "emissive" };
+    const char* scalarMaps[] = { "roughness", "metallic", "AO", "opacity" };
+    const std::string dragon = "stanford-dragon-pbr";
+    CPU::TexturePipeline pipeline;
+    uint32_t albedo = 0;
+    for (const char* model : models)
+    {
+        const std::string folder = std::string("Models/") + model + "/textures/DefaultMaterial_";
+        for (const char* map : colorMaps)
+        {
+            const uint32_t handle = pipeline.Add(folder + map + ".jpg", CPU::TextureLayout::RGBA8, true);
+            if (model == dragon && map == std::string("albedo"))
+                albedo = handle;
+        }
+        for (const char* map : scalarMaps)
+            pipeline.Add(folder + map + ".jpg", CPU::TextureLayout::R8);
+    }
+
+    // A missing or broken map leaves the scene without texture, as a failed
+    // stbi_load of the albedo did
+    const CPU::DecodedTexture* texture = nullptr;
+    try
+    {
+        pipeline.Load();
+        texture = &pipeline.GetTexture(albedo);
 
-    // Read as 4 channel
-    unsigned char* imageData = stbi_load("Models/stanford-dragon-pbr/textures/DefaultMaterial_albedo.jpg", &width, &height, &channels, 4);
+        const CPU::TexturePipelineStats& stats = pipeline.GetStats();
+        Utility::Printf("Textures: %u maps, %u decoded on %u threads, %.1f MB at %.0f MB/s in %.1f ms (%.1f ms saved)\n",
+            stats.requestCount, stats.textureCount, pipeline.GetThreadCount(), stats.decodedBytes * 1e-6, stats.GetDecodeMBps(),
+            stats.totalSeconds * 1000.0, stats.GetSecondsSaved() * 1000.0);
+    }
+    catch (const std::runtime_error& error)
+    {
+        Utility::Printf("Textures: %s\n", error.what());
+    }
 
-    channels = 4;
+    // Create Texture
+    int channels = 4;
+    unsigned char* imageData = texture ? texture->texels.get() : nullptr;
 
     if (imageData) {
+        int width = int(texture->width);
+        int height = int(texture->height);
+
+        // Full mip chain, the albedo averaged in linear light and stored
+        // sRGB encoded again like level 0
+        CPU::Timer mipTimer;
+        CPU::MipGenerator mipGenerator;
+        std::vector<CPU::TextureMip> mips;
+        mipGenerator.Generate(imageData, texture->width, texture->height, texture->layout, CPU::MipContent::SRGB, mips);
+        Utility::Printf("Texture mips: %zu levels on %u threads in %.1f ms\n", mips.size() + 1,
+            mipGenerator.GetSettings().threadCount, mipTimer.GetMilliseconds());
+
         D3D12_RESOURCE_DESC textureDesc = {};
         textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
         textureDesc.Alignment = 0;
         textureDesc.Width = width;
         textureDesc.Height = height;
         textureDesc.DepthOrArraySize = 1;
-        textureDesc.MipLevels = 1;
+        textureDesc.MipLevels = UINT16(mips.size() + 1);
         textureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
         textureDesc.SampleDesc.Count = 1;
         textureDesc.SampleDesc.Quality = 0;
@@ -1569,7 +1684,7 @@ void D3DRTWindow::ImportTexture() {
         // Manual calculate the size of the texture is also ok, but GetCopyableFootprints is more convenient
         UINT64  textureUploadBufferSize;
         //textureHeapSize  = ((((width * 4) + 255) & ~255) * (height - 1)) + (width * 4);
-        g_device->GetCopyableFootprints(&textureDesc, 0, 1, 0, nullptr, nullptr, nullptr, &textureUploadBufferSize);
+        g_device->GetCopyableFootprints(&textureDesc, 0, textureDesc.MipLevels, 0, nullptr, nullptr, nullptr, &textureUploadBufferSize);
 
         // Create upload heap, write cpu memory data and send it to defalut heap
         ThrowIfFailed(g_device->CreateCommittedResource(
@@ -1588,14 +1703,20 @@ void D3DRTWindow::ImportTexture() {
                 D3D12_RESOURCE_STATE_COMMON,
                 D3D12_RESOURCE_STATE_COPY_DEST));
 
-        // store vertex buffer in upload heap
-        D3D12_SUBRESOURCE_DATA textureData = {};
-        textureData.pData = imageData; // pointer to our image data
-        textureData.RowPitch = textureDesc.Width * channels; // size of a row in the texture data
-        textureData.SlicePitch = textureData.RowPitch * textureDesc.Height; // size of entire texture data
+        // store every mip level in upload heap
+        std::vector<D3D12_SUBRESOURCE_DATA> textureData(textureDesc.MipLevels);
+        textureData[0].pData = imageData; // pointer to our image data
+        textureData[0].RowPitch = textureDesc.Width * channels; // size of a row in the texture data
+        textureData[0].SlicePitch = textureData[0].RowPitch * textureDesc.Height; // size of entire texture data
+        for (size_t level = 0; level < mips.size(); ++level)
+        {
+            textureData[level + 1].pData = mips[level].texels.data();
+            textureData[level + 1].RowPitch = LONG_PTR(mips[level].width) * channels;
+            textureData[level + 1].SlicePitch = textureData[level + 1].RowPitch * mips[level].height;
+        }
 
         // Now we copy the upload buffer contents to the default heap
-        UpdateSubresources(g_commandList.Get(), m_textureBuffer.Get(), m_textureUploadBuffer.Get(), 0, 0, 1, &textureData);
+        UpdateSubresources(g_commandList.Get(), m_textureBuffer.Get(), m_textureUploadBuffer.Get(), 0, 0, textureDesc.MipLevels, textureData.data());
 
         // Set resource state from copy destination to generic read (only shader can access to it)
         g_commandList->ResourceBarrier(1,
@@ -1610,13 +1731,17 @@ void D3DRTWindow::ImportTexture() {
         srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
         srvDesc.Format = textureDesc.Format;
         srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MipLevels = 1;
+        srvDesc.Texture2D.MipLevels = textureDesc.MipLevels;
         g_device->CreateShaderResourceView(m_textureBuffer.Get(), &srvDesc, textureDescHeapHandle);
     }
 }
 
 void D3DRTWindow::CreateFrameResourcesBuffer()
 {
+    // Progressive accumulation: rgb is the radiance sum and w the sample count
+    // of each pixel. Keeping the sum in float32 instead of an 8-bit running
+    // average lets the image keep converging past a few hundred samples;
+    // RayGen only quantizes when it writes the average to gOutput.
     D3D12_RESOURCE_DESC frameDesc = {};
     frameDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
     frameDesc.Alignment = 0;
@@ -1624,18 +1749,30 @@ void D3DRTWindow::CreateFrameResourcesBuffer()
     frameDesc.Height = GetHeight();
     frameDesc.DepthOrArraySize = 1;
     frameDesc.MipLevels = 1;
-    frameDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    frameDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
     frameDesc.SampleDesc.Count = 1;
     frameDesc.SampleDesc.Quality = 0;
     frameDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    frameDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+    frameDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
     ThrowIfFailed(g_device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
         D3D12_HEAP_FLAG_NONE,
         &frameDesc,
-        D3D12_RESOURCE_STATE_COMMON,// default heap is copy destination, so init as common state
+        D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
         nullptr,
         IID_PPV_ARGS(&m_frameBuffer)));
 
-    m_frameBuffer->SetName(L"Last Frame");
+    m_frameBuffer->SetName(L"Accumulation Buffer");
+
+    // Per pixel running mean and M2 (Welford) of the sample luminance, RayGen
+    // stops tracing a pixel once its relative error is below ADAPTIVE_THRESHOLD
+    frameDesc.Format = DXGI_FORMAT_R32G32_FLOAT;
+    ThrowIfFailed(g_device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+        D3D12_HEAP_FLAG_NONE,
+        &frameDesc,
+        D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+        nullptr,
+        IID_PPV_ARGS(&m_varianceBuffer)));
+
+    m_varianceBuffer->SetName(L"Variance Buffer");
 }
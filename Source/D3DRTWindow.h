@@ -75,6 +75,19 @@ struct ImGuiParams {
 
 struct RayTracingGlobalParams {
     UINT frameCount;
+    UINT lightCount;
+};
+
+// Same layout as the Light struct of Shaders/Utils/Lights.hlsl
+struct RayTracingLight {
+    XMFLOAT3 position;
+    UINT type;          // LIGHT_POINT, LIGHT_TRIANGLE, LIGHT_QUAD
+    XMFLOAT3 edge0;
+    float area;
+    XMFLOAT3 edge1;
+    float pmf;
+    XMFLOAT3 emission;
+    float cdf;
 };
 
 
@@ -148,6 +161,13 @@ private:
     ComPtr< ID3D12DescriptorHeap > m_rayTracingGlobalConstantHeap;
     uint32_t m_rayTracingGlobalConstantBufferSize = 0;
 
+    // Explicit lights for next event estimation, none by default
+    std::vector<RayTracingLight> m_lights;
+    ComPtr< ID3D12Resource > m_lightBuffer;
+
+    // Keys of the blue noise sampler, see CPU/BlueNoise.h
+    ComPtr< ID3D12Resource > m_blueNoiseBuffer;
+
     // #DXR Extra: Depth Buffering
     ComPtr<ID3D12DescriptorHeap> m_dsvHeap;
     ComPtr<ID3D12Resource> m_depthStencil;
@@ -171,7 +191,8 @@ private:
     ComPtr<ID3D12Resource> m_textureBuffer;
     ComPtr<ID3D12DescriptorHeap> m_rastSrvUavDescHeap;
 
-    ComPtr<ID3D12Resource> m_frameBuffer;
+    ComPtr<ID3D12Resource> m_frameBuffer;   // float4 radiance sum + sample count
+    ComPtr<ID3D12Resource> m_varianceBuffer; // float2 luminance mean + M2
 
     ImGuiIO* m_imGuiIO;
 
@@ -223,7 +244,8 @@ private:
     void CreateRayTracingGlobalConstantBuffer();
     void UpdateRayTracingGlobalConstantBuffer();
 
-    void UpdateFrameBuffer();
+    void CreateLightBuffer();
+    void CreateBlueNoiseBuffer();
 
     void CreateRasterizerDescriptorHeap();
 
@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include "Common/Args.h"
+#include "CPU/Denoiser.h"
+#include "CPU/Image.h"
+#include "CPU/PathTracer.h"
+#include "CPU/SceneLoader.h"
+#include "CPU/Timer.h"
+#include "CPU/ToneMapper.h"
+
+using namespace CPU;
+
+// Renders the default scene with the CPU path tracer and writes the result
+// to disk, no window or GPU needed.
+//
+//   D3DRTHeadless --spp=256 --width=1280 --height=720 --out=render.png
+//                 [--threads=N] [--tile=32] [--order=hilbert|morton|scanline]
+//                 [--depth=4] [--rr] [--minbounces=3]
+//                 [--adaptive] [--threshold=0.02] [--minspp=16]
+//                 [--lights] [--nee] [--lightselect=power|bvh]
+//                 [--env=sky.hdr] [--envscale=1] [--sampler=sobol|owen|bluenoise|random]
+//                 [--guiding] [--guidingiterations=6] [--denoise] [--aovs]
+//                 [--tonemap=clamp|reinhard|aces|agx] [--exposure=0]
+//                 [--firefly=trimmed|clamp] [--buckets=8] [--biasbudget=0.01]
+//                 [--mode=depthfirst|wavefront] [--batch=128] [--root=path/]
+//
+// An .hdr output keeps the unclamped average radiance. With --adaptive, --spp
+// is the per pixel maximum and rendering stops early once every tile converged.
+// --lights adds SceneLoader::AddDefaultLights, --nee samples them directly,
+// picking them by power or with the light BVH. --env replaces the sky gradient
+// with a latitude-longitude HDR map, which --nee samples too. --sampler=owen
+// switches from the GPU's Sobol seeds to Owen scrambled Sobol in every
+// dimension, --sampler=bluenoise to the blue noise keys of BlueNoise.h,
+// --sampler=random to the pseudorandom rand_2to1 seeds. --guiding first
+// trains the SD-tree of PathGuiding.h, then renders --spp guided frames.
+// --denoise writes the result of the a-trous filter of Denoiser.h, guided by
+// the first hit AOVs. --aovs also writes those next to the output:
+// _albedo.png, _normal.png, _depth.hdr, _instance.png and _material.png.
+// --tonemap runs a .png output through the exposure (in stops), the tone
+// curve and the sRGB encode of ToneMapper.h; without it the radiance is
+// clamped and stored linearly, like the GPU output. --firefly=trimmed resolves
+// a trimmed mean of --buckets per pixel means, --firefly=clamp clamps sample
+// luminance so that at most --biasbudget of the energy is lost.
+
+namespace
+{
+    void WriteAOVs(const std::string& outPath, uint32_t width, uint32_t height, const AOVBuffers& aovs)
+    {
+        const std::string stem = outPath.substr(0, outPath.find_last_of('.'));
+        const size_t pixelCount = size_t(width) * height;
+        auto writeRGBA8 = [&](const std::string& suffix, const std::vector<uint32_t>& colors)
+        {
+            std::vector<uint8_t> rgba(pixelCount * 4);
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                for (int c = 0; c < 4; ++c)
+                    rgba[i * 4 + c] = static_cast<uint8_t>(colors[i] >> (8 * c));
+            }
+            WriteImageRGBA8(stem + suffix, width, height, rgba);
+            std::printf("Wrote %s%s\n", stem.c_str(), suffix.c_str());
+        };
+
+        // IDs get a hashed color, the sky black
+        auto idColors = [&](const std::vector<uint16_t>& ids)
+        {
+            std::vector<uint32_t> colors(pixelCount);
+            for (size_t i = 0; i < pixelCount; ++i)
+                colors[i] = ids[i] == kInvalidAOVID ? 0xFF000000u : (uint32_t(ids[i] + 1) * 2654435761u) | 0xFF000000u;
+            return colors;
+        };
+
+        std::vector<uint32_t> normals(pixelCount);
+        for (size_t i = 0; i < pixelCount; ++i)
+            normals[i] = PackUnorm8(DecodeOctahedral(aovs.normal[i]) * 0.5f + float3(0.5f));
+
+        std::vector<float> depth(pixelCount * 3);
+        for (size_t i = 0; i < pixelCount; ++i)
+        {
+            float d = HalfToFloat(aovs.depth[i]);
+            depth[i * 3] = depth[i * 3 + 1] = depth[i * 3 + 2] = std::isfinite(d) ? d : 0.0f;
+        }
+
+        writeRGBA8("_albedo.png", aovs.albedo);
+        writeRGBA8("_normal.png", normals);
+        WriteImageHDR(stem + "_depth.hdr", width, height, depth);
+        std::printf("Wrote %s_depth.hdr\n", stem.c_str());
+        writeRGBA8("_instance.png", idColors(aovs.instanceID));
+        writeRGBA8("_material.png", idColors(aovs.materialID));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const Common::Args args(argc, argv);
+    if (args.Has("help"))
+    {
+        std::printf("Usage: D3DRTHeadless [--spp=N] [--width=W] [--height=H] [--out=file.png|.hdr]\n"
+                    "                     [--threads=N] [--tile=N] [--order=hilbert|morton|scanline]\n"
+                    "                     [--depth=N] [--rr] [--minbounces=N]\n"
+                    "                     [--adaptive] [--threshold=F] [--minspp=N]\n"
+                    "                     [--lights] [--nee] [--lightselect=power|bvh]\n"
+                    "                     [--env=file.hdr] [--envscale=F] [--sampler=sobol|owen|bluenoise|random]\n"
+                    "                     [--guiding] [--guidingiterations=N] [--denoise] [--aovs]\n"
+                    "                     [--tonemap=clamp|reinhard|aces|agx] [--exposure=F]\n"
+                    "                     [--firefly=trimmed|clamp] [--buckets=N] [--biasbudget=F]\n"
+                    "                     [--mode=depthfirst|wavefront] [--batch=N] [--root=dir/]\n");
+        return 0;
+    }
+
+    try
+    {
+        PathTracerSettings settings;
+        settings.width = args.GetInt("width", settings.width);
+        settings.height = args.GetInt("height", settings.height);
+        settings.maxDepth = args.GetInt("depth", settings.maxDepth);
+        settings.russianRoulette = args.GetInt("rr", 0) != 0;
+        settings.rouletteMinBounces = args.GetInt("minbounces", settings.rouletteMinBounces);
+        settings.adaptiveSampling = args.GetInt("adaptive", 0) != 0;
+        settings.adaptiveThreshold = args.GetFloat("threshold", 0.02f);
+        settings.adaptiveMinSamples = args.GetInt("minspp", settings.adaptiveMinSamples);
+        settings.nextEventEstimation = args.GetInt("nee", 0) != 0;
+        settings.lightSelection = args.GetString("lightselect", "power") == "bvh" ? LightSelection::BVH : LightSelection::Power;
+        const std::string sampler = args.GetString("sampler", "sobol");
+        settings.sampler = sampler == "owen" ? SamplerType::OwenSobol : sampler == "bluenoise" ? SamplerType::BlueNoise
+            : sampler == "random" ? SamplerType::Random : SamplerType::Sobol;
+        settings.pathGuiding = args.GetInt("guiding", 0) != 0;
+        settings.guidingTrainingIterations = args.GetInt("guidingiterations", settings.guidingTrainingIterations);
+        const std::string firefly = args.GetString("firefly", "");
+        settings.fireflyFilter = firefly == "trimmed" ? FireflyFilter::TrimmedBucketMean : firefly == "clamp" ? FireflyFilter::Clamp : FireflyFilter::None;
+        settings.fireflyBuckets = args.GetInt("buckets", settings.fireflyBuckets);
+        settings.fireflyBiasBudget = args.GetFloat("biasbudget", 0.01f);
+        settings.threadCount = args.GetInt("threads", settings.threadCount);
+        settings.tileSize = args.GetInt("tile", settings.tileSize);
+        const std::string order = args.GetString("order", "hilbert");
+        settings.tileOrder = order == "scanline" ? TileOrder::Scanline : order == "morton" ? TileOrder::Morton : TileOrder::Hilbert;
+        settings.mode = args.GetString("mode", "depthfirst") == "wavefront" ? PathTracerMode::Wavefront : PathTracerMode::DepthFirst;
+        settings.wavefrontTileSize = args.GetInt("batch", settings.wavefrontTileSize);
+        const bool writeAOVs = args.GetInt("aovs", 0) != 0;
+        const bool denoise = args.GetInt("denoise", 0) != 0;
+        if (writeAOVs)
+            settings.aovs = AOV_All;
+        if (denoise)
+            settings.aovs |= AOV_Albedo | AOV_Normal | AOV_Depth;
+        const std::string toneCurve = args.GetString("tonemap", "");
+        const bool toneMap = !toneCurve.empty();
+        const uint32_t spp = std::max(1, args.GetInt("spp", 64));
+        const std::string outPath = args.GetString("out", "render.png");
+
+        Timer timer;
+        Scene scene;
+        SceneLoader::LoadDefaultScene(scene, args.GetString("root", ""));
+        if (args.GetInt("lights", 0) != 0)
+            SceneLoader::AddDefaultLights(scene);
+        const std::string envPath = args.GetString("env", "");
+        if (!envPath.empty())
+        {
+            TileScheduler scheduler(settings.threadCount);
+            EnvironmentMap environment;
+            environment.Load(envPath, args.GetFloat("envscale", 1.0f), &scheduler);
+            scene.SetEnvironment(std::move(environment));
+        }
+        std::printf("Loaded scene in %.2f s (%zu triangles)\n", timer.GetSeconds(), scene.GetTriangleBVH().GetTriangleCount());
+
+        PathTracer tracer(scene, settings);
+        std::printf("Rendering %ux%u, %u spp, %u threads, %zu tiles\n",
+            settings.width, settings.height, spp, tracer.GetSettings().threadCount, tracer.GetTiles().size());
+
+        RenderStats total;
+        if (tracer.IsGuidingTraining())
+        {
+            Timer trainingTimer;
+            uint32_t frames = 0;
+            while (tracer.IsGuidingTraining())
+            {
+                tracer.RenderFrame();
+                ++frames;
+            }
+            std::printf("Path guiding trained on %u frames in %.2f s: %zu spatial leaves, %zu directional nodes\n", frames,
+                trainingTimer.GetSeconds(), tracer.GetGuidingTree()->GetLeafCount(), tracer.GetGuidingTree()->GetDirectionalNodeCount());
+        }
+
+        for (uint32_t i = 0; i < spp && tracer.GetActiveTileCount() > 0; ++i)
+        {
+            RenderStats frame = tracer.RenderFrame();
+            total.samples += frame.samples;
+            total.rays += frame.rays;
+            total.seconds += frame.seconds;
+            std::printf("\r  frame %u/%u  %.1f ms  %u tiles active", i + 1, spp, frame.seconds * 1000.0, tracer.GetActiveTileCount());
+            std::fflush(stdout);
+        }
+
+        std::printf("\nRendered in %.2f s: %.2f Msamples/s, %.2f Mrays/s\n",
+            total.seconds, total.samples / total.seconds * 1e-6, total.rays / total.seconds * 1e-6);
+
+        if (settings.adaptiveSampling)
+        {
+            std::printf("Adaptive: %.1f spp average, %u / %zu tiles still active\n",
+                double(total.samples) / (double(settings.width) * settings.height), tracer.GetActiveTileCount(), tracer.GetTiles().size());
+        }
+
+        // Tile cost spread of the last frame
+        std::vector<double> tileTimes = tracer.GetScheduler().GetTileTimes();
+        std::sort(tileTimes.begin(), tileTimes.end());
+        if (!tileTimes.empty())
+            std::printf("Tile times (last frame): min %.2f ms, median %.2f ms, max %.2f ms\n",
+                tileTimes.front(), tileTimes[tileTimes.size() / 2], tileTimes.back());
+
+        std::vector<float> rgb;
+        if (denoise)
+        {
+            Timer denoiseTimer;
+            std::vector<float3> albedo, normals;
+            std::vector<float> depth, color, variance;
+            tracer.GetAOVs().DecodeGuides(albedo, normals, depth);
+            tracer.ResolveHDR(color);
+            tracer.ResolveVariance(variance);
+
+            DenoiserSettings denoiserSettings;
+            denoiserSettings.threadCount = settings.threadCount;
+            Denoiser denoiser(denoiserSettings);
+            DenoiserInput input;
+            input.width = settings.width;
+            input.height = settings.height;
+            input.color = color.data();
+            input.variance = variance.data();
+            input.albedo = albedo.data();
+            input.normal = normals.data();
+            input.depth = depth.data();
+            denoiser.Denoise(input, rgb);
+            std::printf("Denoised in %.1f ms\n", denoiseTimer.GetMilliseconds());
+        }
+        else if (IsHDRImagePath(outPath) || toneMap)
+            tracer.ResolveHDR(rgb);
+
+        if (IsHDRImagePath(outPath))
+            WriteImageHDR(outPath, settings.width, settings.height, rgb);
+        else
+        {
+            std::vector<uint8_t> rgba;
+            if (denoise || toneMap)
+            {
+                // Without --tonemap this is the clamp of ResolveRGBA8
+                ToneMapperSettings toneSettings;
+                toneSettings.exposure = args.GetFloat("exposure", 0.0f);
+                toneSettings.curve = toneCurve == "reinhard" ? ToneCurve::Reinhard : toneCurve == "aces" ? ToneCurve::ACES
+                    : toneCurve == "agx" ? ToneCurve::AgX : ToneCurve::Clamp;
+                toneSettings.srgb = toneMap;
+                toneSettings.threadCount = settings.threadCount;
+                ToneMapper toneMapper(toneSettings);
+                Timer toneTimer;
+                toneMapper.Apply(rgb.data(), settings.width, settings.height, rgba);
+                if (toneMap)
+                    std::printf("Tone mapped (%s) in %.2f ms\n", ToString(toneSettings.curve), toneTimer.GetMilliseconds());
+            }
+            else
+                tracer.ResolveRGBA8(rgba);
+            WriteImageRGBA8(outPath, settings.width, settings.height, rgba);
+        }
+        std::printf("Wrote %s\n", outPath.c_str());
+        if (writeAOVs)
+            WriteAOVs(outPath, settings.width, settings.height, tracer.GetAOVs());
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -3,7 +3,6 @@
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
-#define STB_IMAGE_IMPLEMENTATION
 #include "stb/stb_image.h"
 #include "Util/Utility.h"
 #include <dxcapi.h>
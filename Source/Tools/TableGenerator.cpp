@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "CPU/Sampling.h"
+#include "CPU/Timer.h"
+
+using namespace CPU;
+
+// Writes the lookup tables the shaders share with the CPU renderer, from
+// the same source the CPU renderer compiles in. Run it from the repository
+// root after changing a generator:
+//
+//   D3DRTTables sobol [--dimensions=64] [--out=Shaders/Utils/SobolMatrices.hlsl]
+//   D3DRTTables bluenoise [--iterations=32] [--seed=1] [--out=Source/CPU/BlueNoiseKeys.cpp]
+
+namespace
+{
+    std::string GetOption(int argc, char** argv, const char* name, const std::string& fallback)
+    {
+        const size_t length = std::strlen(name);
+        for (int i = 2; i < argc; ++i)
+        {
+            if (std::strncmp(argv[i], "--", 2) == 0 && std::strncmp(argv[i] + 2, name, length) == 0 && argv[i][2 + length] == '=')
+                return argv[i] + 3 + length;
+        }
+        return fallback;
+    }
+
+    int WriteSobol(int argc, char** argv)
+    {
+        const uint32_t dimensions = std::min<uint32_t>(std::atoi(GetOption(argc, argv, "dimensions", "64").c_str()), kSobolMaxDimensions);
+        const std::string path = GetOption(argc, argv, "out", "Shaders/Utils/SobolMatrices.hlsl");
+
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+            return 1;
+        }
+
+        std::fprintf(file, "// Generated by D3DRTTables sobol, do not edit. The first %u dimensions of\n", dimensions);
+        std::fprintf(file, "// CPU::SobolMatrices (Source/CPU/Sobol.h), 32 columns per dimension.\n\n");
+        std::fprintf(file, "static const uint kSobolMatrixDimensions = %u;\n\n", dimensions);
+        std::fprintf(file, "static const uint SobolMatrices[%u * 32] =\n{\n", dimensions);
+        for (uint32_t d = 0; d < dimensions; ++d)
+        {
+            std::fprintf(file, "    ");
+            for (uint32_t k = 0; k < kSobolBits; ++k)
+                std::fprintf(file, "0x%08x%s", SobolMatrices[d * kSobolBits + k], d + 1 == dimensions && k + 1 == kSobolBits ? "" : ", ");
+            std::fprintf(file, "\n");
+        }
+        std::fprintf(file, "};\n");
+        std::fclose(file);
+
+        std::printf("Wrote %u Sobol dimensions to %s\n", dimensions, path.c_str());
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+    // Blue noise keys, optimized in two steps like Heitz et al. 2019. With
+    // the ranking key fixed, the first sample of a pixel only depends on the
+    // scrambling key, so the optimizer keeps (ranking key, first sample)
+    // and derives the scrambling key at the end:
+    // 1. the first samples are swapped between pixels until they form a blue
+    //    noise mask (Georgiev and Fajardo 2016), so the 1 spp error of any
+    //    integrand is blue noise;
+    // 2. the ranking keys are swapped, the first samples staying in place,
+    //    until the errors of a set of step functions at 2 to 16 spp differ
+    //    as much as possible between nearby pixels.
+    // Swapping keeps the set of keys of the tile, only their arrangement
+    // changes.
+
+    const uint32_t kSampleLevels[] = { 2, 4, 8, 16 };
+    const uint32_t kLevelCount = 4;
+    const uint32_t kMaxSamples = 16;
+    const uint32_t kIntegrands = 32;
+    const uint32_t kErrorSize = kLevelCount * kIntegrands;
+    const int kRadius = 6;
+    const float kSigma = 2.1f;          // pixels, like Georgiev and Fajardo
+    const uint32_t kPixelCount = kBlueNoiseTileSize * kBlueNoiseTileSize;
+
+    // Keys optimized together, sharing their ranking key so the pair stays
+    // a stratified 2D point set: the BSDF sample and the light sample are 2D
+    // integrals, the lobe selection, light selection and Russian roulette 1D
+    struct KeyGroup
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+    const KeyGroup kKeyGroups[] = { { 0, 2 }, { 2, 1 }, { 3, 1 }, { 4, 2 }, { 6, 1 } };
+
+    // Top 8 bits of blueNoiseSequence, what the keys act on
+    uint32_t SequenceCell(uint32_t d, uint32_t i)
+    {
+        return blueNoiseSequence(d, i) >> 24;
+    }
+
+    class BlueNoiseOptimizer
+    {
+    public:
+        BlueNoiseOptimizer(uint32_t seed)
+            : m_rng(seed)
+            , m_ranks(kPixelCount * kBlueNoiseKeysPerPixel)
+            , m_firsts(kPixelCount * kBlueNoiseKeysPerPixel)
+            , m_errors(size_t(kPixelCount) * kErrorSize)
+        {
+            std::uniform_int_distribution<uint32_t> byte(0, 0xff);
+            for (uint32_t p = 0; p < kPixelCount; ++p)
+            {
+                for (const KeyGroup& group : kKeyGroups)
+                {
+                    uint32_t rank = byte(m_rng);
+                    for (uint32_t k = group.first; k < group.first + group.count; ++k)
+                    {
+                        m_ranks[p * kBlueNoiseKeysPerPixel + k] = rank;
+                        m_firsts[p * kBlueNoiseKeysPerPixel + k] = byte(m_rng);
+                    }
+                }
+            }
+
+            for (int dy = -kRadius; dy <= kRadius; ++dy)
+            {
+                for (int dx = -kRadius; dx <= kRadius; ++dx)
+                {
+                    if (dx != 0 || dy != 0)
+                        m_neighbours.push_back({ dx, dy, std::exp(-float(dx * dx + dy * dy) / (kSigma * kSigma)) });
+                }
+            }
+        }
+
+        // Both return the mean energy per pixel before and after
+        float2 OptimizeFirstSamples(const KeyGroup& group, uint32_t iterations)
+        {
+            auto energy = [&](uint32_t p, uint32_t q)
+            {
+                float distance = 0.0f;
+                for (uint32_t k = group.first; k < group.first + group.count; ++k)
+                {
+                    float d = (float(m_firsts[p * kBlueNoiseKeysPerPixel + k]) - float(m_firsts[q * kBlueNoiseKeysPerPixel + k])) / 256.0f;
+                    distance += d * d;
+                }
+                // |v_p - v_q|^(d / 2) of Georgiev and Fajardo
+                return std::exp(-std::pow(distance, 0.25f * float(group.count)));
+            };
+            auto swap = [&](uint32_t p, uint32_t q)
+            {
+                for (uint32_t k = group.first; k < group.first + group.count; ++k)
+                    std::swap(m_firsts[p * kBlueNoiseKeysPerPixel + k], m_firsts[q * kBlueNoiseKeysPerPixel + k]);
+            };
+            return Optimize(iterations, energy, swap);
+        }
+
+        float2 OptimizeRanking(const KeyGroup& group, uint32_t iterations)
+        {
+            CreateStepFunctions(group);
+            for (uint32_t p = 0; p < kPixelCount; ++p)
+                ComputeErrors(group, p);
+            Normalize();
+
+            auto energy = [&](uint32_t p, uint32_t q)
+            {
+                const float* a = &m_errors[size_t(p) * kErrorSize];
+                const float* b = &m_errors[size_t(q) * kErrorSize];
+                float distance = 0.0f;
+                for (uint32_t c = 0; c < kErrorSize; ++c)
+                    distance += (a[c] - b[c]) * (a[c] - b[c]);
+                return std::exp(-std::sqrt(distance / float(kErrorSize)));
+            };
+            auto swap = [&](uint32_t p, uint32_t q)
+            {
+                for (uint32_t k = group.first; k < group.first + group.count; ++k)
+                    std::swap(m_ranks[p * kBlueNoiseKeysPerPixel + k], m_ranks[q * kBlueNoiseKeysPerPixel + k]);
+                ComputeErrors(group, p);
+                ComputeErrors(group, q);
+                NormalizePixel(p);
+                NormalizePixel(q);
+            };
+            return Optimize(iterations, energy, swap);
+        }
+
+        // Packed like BlueNoiseKeys
+        std::vector<uint32_t> GetWords() const
+        {
+            std::vector<uint32_t> words(kPixelCount * kBlueNoiseWordsPerPixel, 0);
+            for (uint32_t p = 0; p < kPixelCount; ++p)
+            {
+                for (uint32_t k = 0; k < kBlueNoiseKeysPerPixel; ++k)
+                {
+                    uint32_t rank = m_ranks[p * kBlueNoiseKeysPerPixel + k];
+                    uint32_t scramble = m_firsts[p * kBlueNoiseKeysPerPixel + k] ^ SequenceCell(k, rank);
+                    words[p * kBlueNoiseWordsPerPixel + k / 2] |= (rank << 8 | scramble) << (16 * (k & 1));
+                }
+            }
+            return words;
+        }
+
+    private:
+        struct Neighbour
+        {
+            int dx;
+            int dy;
+            float weight;
+        };
+
+        // A step function: 1 on one side of a line (2D) or of a point (1D)
+        struct StepFunction
+        {
+            float2 normal;
+            float offset;
+        };
+
+        // Greedy swaps with random partners, kept when they lower the energy
+        // of the two pixels with their neighbours on the repeated tile
+        template<typename Energy, typename Swap>
+        float2 Optimize(uint32_t iterations, Energy energy, Swap swap)
+        {
+            auto local = [&](uint32_t p)
+            {
+                const int size = int(kBlueNoiseTileSize);
+                const int x = int(p % kBlueNoiseTileSize), y = int(p / kBlueNoiseTileSize);
+                float sum = 0.0f;
+                for (const Neighbour& n : m_neighbours)
+                    sum += n.weight * energy(p, uint32_t(((y + n.dy + size) % size) * size + (x + n.dx + size) % size));
+                return sum;
+            };
+            auto total = [&]()
+            {
+                double sum = 0.0;
+                for (uint32_t p = 0; p < kPixelCount; ++p)
+                    sum += local(p);
+                return float(sum / kPixelCount);
+            };
+
+            const float before = total();
+            std::uniform_int_distribution<uint32_t> pixel(0, kPixelCount - 1);
+            for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                for (uint32_t p = 0; p < kPixelCount; ++p)
+                {
+                    uint32_t q = pixel(m_rng);
+                    if (q == p)
+                        continue;
+                    float current = local(p) + local(q);
+                    swap(p, q);
+                    if (local(p) + local(q) >= current)
+                        swap(p, q);
+                }
+            }
+            return float2(before, total());
+        }
+
+        void CreateStepFunctions(const KeyGroup& group)
+        {
+            std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+            for (StepFunction& step : m_steps)
+            {
+                float angle = uniform(m_rng) * 6.28318531f;
+                step.normal = group.count == 2 ? float2(std::cos(angle), std::sin(angle)) : float2(1.0f, 0.0f);
+                step.offset = dot(step.normal, float2(uniform(m_rng), uniform(m_rng)));
+            }
+        }
+
+        // Estimates of the step functions with the first kSampleLevels
+        // samples of pixel p. The reference values cancel in the energy.
+        void ComputeErrors(const KeyGroup& group, uint32_t p)
+        {
+            float2 samples[kMaxSamples];
+            for (uint32_t j = 0; j < group.count; ++j)
+            {
+                const uint32_t k = group.first + j;
+                const uint32_t rank = m_ranks[p * kBlueNoiseKeysPerPixel + k];
+                const uint32_t scramble = m_firsts[p * kBlueNoiseKeysPerPixel + k] ^ SequenceCell(k, rank);
+                for (uint32_t i = 0; i < kMaxSamples; ++i)
+                    samples[i][j] = (float(SequenceCell(k, i ^ rank) ^ scramble) + 0.5f) / 256.0f;
+            }
+            if (group.count == 1)
+            {
+                for (float2& sample : samples)
+                    sample.y = 0.0f;
+            }
+
+            float* error = &m_errors[size_t(p) * kErrorSize];
+            for (uint32_t m = 0; m < kIntegrands; ++m)
+            {
+                float sum = 0.0f;
+                uint32_t level = 0;
+                for (uint32_t i = 0; i < kMaxSamples; ++i)
+                {
+                    sum += dot(m_steps[m].normal, samples[i]) < m_steps[m].offset ? 1.0f : 0.0f;
+                    if (i + 1 == kSampleLevels[level])
+                        error[level++ * kIntegrands + m] = sum / float(i + 1);
+                }
+            }
+        }
+
+        // Scales every component to unit variance over the tile, so all
+        // step functions and sample counts weigh the same
+        void Normalize()
+        {
+            for (uint32_t c = 0; c < kErrorSize; ++c)
+            {
+                double mean = 0.0, squares = 0.0;
+                for (uint32_t p = 0; p < kPixelCount; ++p)
+                {
+                    double e = m_errors[size_t(p) * kErrorSize + c];
+                    mean += e;
+                    squares += e * e;
+                }
+                mean /= kPixelCount;
+                double deviation = std::sqrt(std::max(squares / kPixelCount - mean * mean, 0.0));
+                m_mean[c] = float(mean);
+                m_scale[c] = deviation > 1e-6 ? float(1.0 / deviation) : 0.0f;
+            }
+            for (uint32_t p = 0; p < kPixelCount; ++p)
+                NormalizePixel(p);
+        }
+
+        void NormalizePixel(uint32_t p)
+        {
+            float* error = &m_errors[size_t(p) * kErrorSize];
+            for (uint32_t c = 0; c < kErrorSize; ++c)
+                error[c] = (error[c] - m_mean[c]) * m_scale[c];
+        }
+
+        std::mt19937 m_rng;
+        std::vector<uint32_t> m_ranks;      // kBlueNoiseKeysPerPixel per pixel
+        std::vector<uint32_t> m_firsts;     // top 8 bits of the first sample
+        std::vector<float> m_errors;        // kErrorSize per pixel
+        std::vector<Neighbour> m_neighbours;
+        StepFunction m_steps[kIntegrands];
+        float m_mean[kErrorSize];
+        float m_scale[kErrorSize];
+    };
+
+    int WriteBlueNoise(int argc, char** argv)
+    {
+        const uint32_t iterations = std::max(0, std::atoi(GetOption(argc, argv, "iterations", "32").c_str()));
+        const uint32_t seed = std::atoi(GetOption(argc, argv, "seed", "1").c_str());
+        const std::string path = GetOption(argc, argv, "out", "Source/CPU/BlueNoiseKeys.cpp");
+
+        BlueNoiseOptimizer optimizer(seed);
+        for (const KeyGroup& group : kKeyGroups)
+        {
+            Timer timer;
+            float2 first = optimizer.OptimizeFirstSamples(group, iterations);
+            float2 ranking = optimizer.OptimizeRanking(group, iterations);
+            std::printf("keys %u-%u: first samples %.4f -> %.4f, ranking %.4f -> %.4f (%.1f s)\n", group.first,
+                group.first + group.count - 1, first.x, first.y, ranking.x, ranking.y, timer.GetSeconds());
+        }
+
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+            return 1;
+        }
+
+        const std::vector<uint32_t> words = optimizer.GetWords();
+        std::fprintf(file, "// Generated by D3DRTTables bluenoise --iterations=%u --seed=%u, do not edit.\n", iterations, seed);
+        std::fprintf(file, "// See Source/CPU/BlueNoise.h for the layout.\n\n");
+        std::fprintf(file, "#include \"CPU/BlueNoise.h\"\n\n");
+        std::fprintf(file, "namespace CPU\n{\n");
+        std::fprintf(file, "    const uint32_t BlueNoiseKeys[kBlueNoiseTileSize * kBlueNoiseTileSize * kBlueNoiseWordsPerPixel] =\n    {\n");
+        for (size_t i = 0; i < words.size(); i += 12)
+        {
+            std::fprintf(file, "        ");
+            for (size_t j = i; j < std::min(i + 12, words.size()); ++j)
+                std::fprintf(file, "0x%08x%s", words[j], j + 1 == words.size() ? "" : j + 1 == i + 12 ? "," : ", ");
+            std::fprintf(file, "\n");
+        }
+        std::fprintf(file, "    };\n}\n");
+        std::fclose(file);
+
+        std::printf("Wrote %zu blue noise key words to %s\n", words.size(), path.c_str());
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && std::strcmp(argv[1], "sobol") == 0)
+        return WriteSobol(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "bluenoise") == 0)
+        return WriteBlueNoise(argc, argv);
+
+    std::printf("Usage: D3DRTTables sobol [--dimensions=N] [--out=file.hlsl]\n"
+                "       D3DRTTables bluenoise [--iterations=N] [--seed=N] [--out=file.cpp]\n");
+    return argc >= 2 ? 1 : 0;
+}